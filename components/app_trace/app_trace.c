@@ -44,6 +44,9 @@ esp_err_t esp_apptrace_init(const esp_apptrace_config_t *config)
         const esp_apptrace_uart_config_t *uart_config = &config->dest_cfg.uart;
         s_trace_ch.hw = esp_apptrace_uart_hw_get(uart_config->uart_num, &hw_data);
         s_trace_ch.hw_data = hw_data;
+#elif CONFIG_APPTRACE_DEST_NET
+        s_trace_ch.hw = esp_apptrace_net_hw_get(&hw_data);
+        s_trace_ch.hw_data = hw_data;
 #else // CONFIG_APPTRACE_DEST_ALL allows runtime selection between destinations
         if (config->dest == ESP_APPTRACE_DEST_JTAG) {
             s_trace_ch.hw = esp_apptrace_jtag_hw_get(&hw_data);
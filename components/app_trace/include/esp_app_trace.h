@@ -280,8 +280,25 @@ int esp_apptrace_feof(void *stream);
 }
 #endif
 
-// Default picks JTAG if available, otherwise UART
-#if !CONFIG_APPTRACE_DEST_UART
+#if CONFIG_APPTRACE_DEST_NET
+#define APPTRACE_NET_CONFIG_DEFAULT() {                     \
+    .dest = ESP_APPTRACE_DEST_NET,                          \
+    .dest_cfg.net = {                                       \
+        .host         = CONFIG_APPTRACE_NET_DEST_HOST,      \
+        .port         = CONFIG_APPTRACE_NET_DEST_PORT,      \
+        .use_udp      = CONFIG_APPTRACE_NET_USE_UDP,        \
+        .tx_buff_size = CONFIG_APPTRACE_NET_TX_BUFF_SIZE,   \
+        .tx_msg_size  = CONFIG_APPTRACE_NET_TX_MSG_SIZE,    \
+    },                                                      \
+    .flush_tmo    = CONFIG_APPTRACE_ONPANIC_HOST_FLUSH_TMO, \
+    .flush_thresh = CONFIG_APPTRACE_POSTMORTEM_FLUSH_THRESH, \
+}
+#endif
+
+// Default picks the selected dedicated destination, JTAG before UART otherwise
+#if CONFIG_APPTRACE_DEST_NET
+#define APPTRACE_CONFIG_DEFAULT() APPTRACE_NET_CONFIG_DEFAULT()
+#elif !CONFIG_APPTRACE_DEST_UART
 #define APPTRACE_CONFIG_DEFAULT() APPTRACE_JTAG_CONFIG_DEFAULT()
 #else
 #define APPTRACE_CONFIG_DEFAULT() APPTRACE_UART_CONFIG_DEFAULT()
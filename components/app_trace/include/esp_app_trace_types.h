@@ -6,6 +6,7 @@
 #ifndef ESP_APP_TRACE_TYPES_H_
 #define ESP_APP_TRACE_TYPES_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "spinlock.h"
 
@@ -49,6 +50,7 @@ typedef struct {
 typedef enum {
     ESP_APPTRACE_DEST_JTAG,
     ESP_APPTRACE_DEST_UART,
+    ESP_APPTRACE_DEST_NET,
 } esp_apptrace_dest_t;
 
 /**
@@ -63,6 +65,17 @@ typedef struct {
     uint32_t tx_msg_size;   ///< Maximum size of the single message to transfer.
 } esp_apptrace_uart_config_t;
 
+/**
+ * Application trace configuration for network destination
+ */
+typedef struct {
+    const char *host;       ///< Numeric IPv4 address of the trace collector
+    uint16_t port;          ///< TCP or UDP port of the trace collector
+    bool use_udp;           ///< Send datagrams instead of a TCP stream
+    uint32_t tx_buff_size;  ///< TX ring buffer size (must be power of two)
+    uint32_t tx_msg_size;   ///< Maximum size of the single message to transfer.
+} esp_apptrace_net_config_t;
+
 /**
  * Application trace trace header size in bytes. It is 2 bytes for SEGGER SystemView
  */
@@ -79,6 +92,7 @@ typedef struct {
 
     union {
         esp_apptrace_uart_config_t uart; ///< UART configuration (when dest is ESP_APPTRACE_DEST_UART)
+        esp_apptrace_net_config_t net;   ///< Network configuration (when dest is ESP_APPTRACE_DEST_NET)
         struct {                         ///< Reserved for JTAG (when dest is ESP_APPTRACE_DEST_JTAG)
             uint8_t _unused;
         } jtag;
@@ -29,6 +29,7 @@ typedef struct {
 
 esp_apptrace_hw_t *esp_apptrace_jtag_hw_get(void **data);
 esp_apptrace_hw_t *esp_apptrace_uart_hw_get(int num, void **data);
+esp_apptrace_hw_t *esp_apptrace_net_hw_get(void **data);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,517 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_netif.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lwip/sockets.h"
+
+#include "esp_app_trace_port.h"
+#include "esp_app_trace_util.h"
+#include "esp_app_trace_types.h"
+
+static const char *TAG = "esp_apptrace_net";
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+/* Maximum payload carried by a single frame. Small enough to fit a standard MTU
+ * when UDP is used, large enough to amortize the header over TCP. */
+#define ESP_APPTRACE_NET_FRAME_PAYLOAD_MAX 1024
+/* How often the streamer wakes up to look for pending data when nobody notified it */
+#define ESP_APPTRACE_NET_POLL_PERIOD_MS 100
+/* How long the streamer sleeps between connection attempts */
+#define ESP_APPTRACE_NET_RECONNECT_PERIOD_MS 1000
+/* Bound on a single send() so a stalled collector cannot block the streamer */
+#define ESP_APPTRACE_NET_SEND_TMO_MS 100
+
+/* Every chunk sent to the collector is prefixed with this little-endian header.
+ * `seq` increments per frame, `dropped` is the cumulative number of trace bytes
+ * lost so far (ring overflow or send failures), so the host can both detect
+ * gaps and quantify them. */
+typedef struct __attribute__((packed)) {
+    uint16_t magic;         ///< ESP_APPTRACE_NET_FRAME_MAGIC
+    uint16_t payload_len;   ///< Number of trace bytes following this header
+    uint32_t seq;           ///< Frame sequence number
+    uint32_t dropped;       ///< Cumulative dropped trace bytes
+} esp_apptrace_net_frame_hdr_t;
+
+#define ESP_APPTRACE_NET_FRAME_MAGIC 0xA77E
+
+typedef struct {
+    uint8_t *buffer;            ///< Ring buffer data
+    uint32_t max_size;          ///< Ring buffer maximum size (must be power of 2)
+    volatile uint32_t count;    ///< Number of bytes currently in the buffer
+    volatile uint32_t head;     ///< Write pointer index
+    volatile uint32_t tail;     ///< Read pointer index
+} esp_apptrace_net_rb_t;
+
+typedef struct {
+    int inited;
+    esp_apptrace_net_config_t config;   ///< Collector address and buffer sizing
+    esp_apptrace_net_rb_t tx_ring;      ///< TX ring buffer
+    TaskHandle_t task;                  ///< Streamer task draining the ring
+    volatile int sock;                  ///< Current socket, -1 when not connected
+    volatile uint32_t dropped_bytes;    ///< Cumulative dropped trace bytes
+    uint32_t seq;                       ///< Next frame sequence number (streamer task only)
+    uint8_t *frame_buff;                ///< Frame assembly buffer (streamer task only)
+
+    /* TX message buffer */
+    uint8_t *tx_msg_buff;               ///< TX message buffer to provide with get_up_buffer
+    uint32_t tx_msg_buff_size;          ///< TX message buffer size & maximum size of the single message to transfer.
+    uint32_t tx_pending_msg_size;       ///< Pending message size to send with put_up_buffer
+
+    /* RX message buffer */
+    uint8_t *rx_msg_buff;               ///< RX message buffer provided with down_buffer_config function
+    uint32_t rx_msg_buff_size;          ///< RX message buffer size provided with down_buffer_config function
+
+#if CONFIG_APPTRACE_LOCK_ENABLE
+    esp_apptrace_lock_t lock;           ///< Sync lock
+#endif
+} esp_apptrace_net_data_t;
+
+static inline bool is_power_of_two(uint32_t n)
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+static inline uint32_t ring_buffer_mask(const esp_apptrace_net_rb_t *rb)
+{
+    return rb->max_size - 1;
+}
+
+static inline uint32_t ring_buffer_data_len(const esp_apptrace_net_rb_t *rb)
+{
+    return rb->count;
+}
+
+static inline uint32_t ring_buffer_free_len(const esp_apptrace_net_rb_t *rb)
+{
+    return rb->max_size - rb->count;
+}
+
+static inline void ring_buffer_advance_tail(esp_apptrace_net_rb_t *rb, uint32_t count)
+{
+    rb->tail = (rb->tail + count) & ring_buffer_mask(rb);
+    rb->count -= count;
+}
+
+static inline void ring_buffer_advance_head(esp_apptrace_net_rb_t *rb, uint32_t count)
+{
+    rb->head = (rb->head + count) & ring_buffer_mask(rb);
+    rb->count += count;
+}
+
+static esp_err_t esp_apptrace_net_lock(esp_apptrace_net_data_t *net_data, esp_apptrace_tmo_t *tmo)
+{
+#if CONFIG_APPTRACE_LOCK_ENABLE
+    esp_err_t ret = esp_apptrace_lock_take(&net_data->lock, tmo);
+    if (ret != ESP_OK) {
+        return ESP_FAIL;
+    }
+#endif
+    return ESP_OK;
+}
+
+static esp_err_t esp_apptrace_net_unlock(esp_apptrace_net_data_t *net_data)
+{
+    esp_err_t ret = ESP_OK;
+#if CONFIG_APPTRACE_LOCK_ENABLE
+    ret = esp_apptrace_lock_give(&net_data->lock);
+    assert(ret == ESP_OK && "Failed to unlock apptrace net lock!");
+#endif
+    return ret;
+}
+
+/* Called with the lock held. Drops the oldest bytes when the ring cannot hold the
+ * new message, keeping the most recent trace data and accounting for the loss. */
+static void ring_buffer_put(esp_apptrace_net_data_t *net_data, const uint8_t *data, uint32_t len)
+{
+    esp_apptrace_net_rb_t *rb = &net_data->tx_ring;
+    uint32_t free_len = ring_buffer_free_len(rb);
+    if (len > free_len) {
+        uint32_t need = len - free_len;
+        ring_buffer_advance_tail(rb, need);
+        net_data->dropped_bytes += need;
+    }
+
+    uint32_t head = rb->head;
+    uint32_t space_to_end = rb->max_size - head;
+
+    if (len <= space_to_end) {
+        memcpy(&rb->buffer[head], data, len);
+    } else {
+        memcpy(&rb->buffer[head], data, space_to_end);
+        memcpy(&rb->buffer[0], &data[space_to_end], len - space_to_end);
+    }
+
+    ring_buffer_advance_head(rb, len);
+}
+
+/* Called with the lock held. Copies up to max_len contiguous-ordered bytes out of
+ * the ring into dst and consumes them. */
+static uint32_t ring_buffer_get(esp_apptrace_net_rb_t *rb, uint8_t *dst, uint32_t max_len)
+{
+    uint32_t len = MIN(ring_buffer_data_len(rb), max_len);
+    uint32_t tail = rb->tail;
+    uint32_t cont = MIN(len, rb->max_size - tail);
+
+    memcpy(dst, &rb->buffer[tail], cont);
+    if (len > cont) {
+        memcpy(&dst[cont], &rb->buffer[0], len - cont);
+    }
+    ring_buffer_advance_tail(rb, len);
+    return len;
+}
+
+static void net_socket_close(esp_apptrace_net_data_t *net_data)
+{
+    if (net_data->sock >= 0) {
+        close(net_data->sock);
+        net_data->sock = -1;
+    }
+}
+
+static bool net_try_connect(esp_apptrace_net_data_t *net_data)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(net_data->config.port),
+    };
+
+    if (esp_netif_get_default_netif() == NULL) {
+        // Network stack is not up yet
+        return false;
+    }
+    addr.sin_addr.s_addr = inet_addr(net_data->config.host);
+    if (addr.sin_addr.s_addr == INADDR_NONE) {
+        ESP_APPTRACE_LOGE("Invalid collector address '%s'", net_data->config.host);
+        return false;
+    }
+
+    int sock = socket(AF_INET, net_data->config.use_udp ? SOCK_DGRAM : SOCK_STREAM, 0);
+    if (sock < 0) {
+        return false;
+    }
+    struct timeval snd_tmo = {
+        .tv_sec = 0,
+        .tv_usec = ESP_APPTRACE_NET_SEND_TMO_MS * 1000,
+    };
+    setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &snd_tmo, sizeof(snd_tmo));
+
+    if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(sock);
+        return false;
+    }
+    net_data->sock = sock;
+    ESP_LOGI(TAG, "connected to trace collector %s:%u (%s)", net_data->config.host,
+             net_data->config.port, net_data->config.use_udp ? "UDP" : "TCP");
+    return true;
+}
+
+static bool net_send_all(esp_apptrace_net_data_t *net_data, const uint8_t *data, uint32_t len)
+{
+    while (len > 0) {
+        int res = send(net_data->sock, data, len, 0);
+        if (res < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                // Collector stalled; the frame is accounted as dropped by the caller,
+                // but the connection is kept
+                return false;
+            }
+            net_socket_close(net_data);
+            return false;
+        }
+        data += res;
+        len -= res;
+    }
+    return true;
+}
+
+static void esp_apptrace_net_task(void *arg)
+{
+    esp_apptrace_net_data_t *net_data = arg;
+
+    while (true) {
+        ulTaskNotifyTake(pdFALSE, pdMS_TO_TICKS(ESP_APPTRACE_NET_POLL_PERIOD_MS));
+
+        if (net_data->sock < 0 && !net_try_connect(net_data)) {
+            vTaskDelay(pdMS_TO_TICKS(ESP_APPTRACE_NET_RECONNECT_PERIOD_MS));
+            continue;
+        }
+
+        while (true) {
+            esp_apptrace_net_frame_hdr_t *hdr = (esp_apptrace_net_frame_hdr_t *)net_data->frame_buff;
+            esp_apptrace_tmo_t tmo;
+            esp_apptrace_tmo_init(&tmo, ESP_APPTRACE_TMO_INFINITE);
+
+            if (esp_apptrace_net_lock(net_data, &tmo) != ESP_OK) {
+                break;
+            }
+            uint32_t payload = ring_buffer_get(&net_data->tx_ring, net_data->frame_buff + sizeof(*hdr),
+                                               ESP_APPTRACE_NET_FRAME_PAYLOAD_MAX);
+            hdr->magic = ESP_APPTRACE_NET_FRAME_MAGIC;
+            hdr->payload_len = payload;
+            hdr->seq = net_data->seq;
+            hdr->dropped = net_data->dropped_bytes;
+            esp_apptrace_net_unlock(net_data);
+
+            if (payload == 0) {
+                break;
+            }
+            net_data->seq++;
+            if (!net_send_all(net_data, net_data->frame_buff, sizeof(*hdr) + payload)) {
+                // The frame left the ring already; account it as lost so the
+                // sequence stream stays consistent for the collector
+                net_data->dropped_bytes += payload;
+                break;
+            }
+        }
+    }
+}
+
+static esp_err_t esp_apptrace_net_init(void *hw_data, const esp_apptrace_config_t *config)
+{
+    esp_apptrace_net_data_t *net_data = hw_data;
+    const esp_apptrace_net_config_t *net_config = &config->dest_cfg.net;
+
+    /* Init function is called on every core, so ensure to do main setup only once */
+    int core_id = esp_cpu_get_core_id();
+    if (core_id == 0) {
+        if (net_config->host == NULL || net_config->port == 0) {
+            ESP_APPTRACE_LOGE("Trace collector host/port are not configured");
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (net_config->tx_buff_size == 0 || !is_power_of_two(net_config->tx_buff_size)) {
+            ESP_APPTRACE_LOGE("TX ring buffer size (%" PRIu32 ") must be a power of two and greater than 0",
+                              net_config->tx_buff_size);
+            return ESP_ERR_INVALID_ARG;
+        }
+        net_data->config = *net_config;
+        net_data->sock = -1;
+
+        net_data->tx_ring.buffer = heap_caps_malloc(net_config->tx_buff_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (net_data->tx_ring.buffer == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        net_data->tx_ring.max_size = net_config->tx_buff_size;
+        net_data->tx_ring.count = 0;
+        net_data->tx_ring.head = 0;
+        net_data->tx_ring.tail = 0;
+
+        net_data->tx_msg_buff_size = net_config->tx_msg_size;
+        net_data->tx_msg_buff = heap_caps_malloc(net_data->tx_msg_buff_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (net_data->tx_msg_buff == NULL) {
+            heap_caps_free(net_data->tx_ring.buffer);
+            return ESP_ERR_NO_MEM;
+        }
+
+        net_data->frame_buff = heap_caps_malloc(sizeof(esp_apptrace_net_frame_hdr_t) + ESP_APPTRACE_NET_FRAME_PAYLOAD_MAX,
+                                                MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (net_data->frame_buff == NULL) {
+            heap_caps_free(net_data->tx_msg_buff);
+            heap_caps_free(net_data->tx_ring.buffer);
+            return ESP_ERR_NO_MEM;
+        }
+
+#if CONFIG_APPTRACE_LOCK_ENABLE
+        esp_apptrace_lock_init(&net_data->lock);
+#endif
+        /* The streamer connects lazily: at this point the network stack is not up
+         * yet, so the task retries until the collector becomes reachable. */
+        if (xTaskCreate(esp_apptrace_net_task, "apptrace_net", CONFIG_APPTRACE_NET_TASK_STACK_SIZE,
+                        net_data, CONFIG_APPTRACE_NET_TASK_PRIO, &net_data->task) != pdPASS) {
+            ESP_APPTRACE_LOGE("Failed to create apptrace net task");
+            heap_caps_free(net_data->frame_buff);
+            heap_caps_free(net_data->tx_msg_buff);
+            heap_caps_free(net_data->tx_ring.buffer);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    net_data->inited |= 1 << core_id;
+
+    return ESP_OK;
+}
+
+static uint8_t *esp_apptrace_net_up_buffer_get(void *hw_data, uint32_t size, esp_apptrace_tmo_t *tmo)
+{
+    esp_apptrace_net_data_t *net_data = hw_data;
+
+    if (size == 0 || size > net_data->tx_msg_buff_size) {
+        return NULL;
+    }
+
+    if (esp_apptrace_net_lock(net_data, tmo) != ESP_OK) {
+        return NULL;
+    }
+
+    if (net_data->tx_pending_msg_size != 0) {
+        // A previous message was not sent.
+        esp_apptrace_net_unlock(net_data);
+        return NULL;
+    }
+
+    net_data->tx_pending_msg_size = size;
+
+    esp_apptrace_net_unlock(net_data);
+
+    return net_data->tx_msg_buff;
+}
+
+static esp_err_t esp_apptrace_net_up_buffer_put(void *hw_data, uint8_t *ptr, esp_apptrace_tmo_t *tmo)
+{
+    esp_apptrace_net_data_t *net_data = hw_data;
+
+    esp_err_t res = esp_apptrace_net_lock(net_data, tmo);
+    if (res != ESP_OK) {
+        return res;
+    }
+
+    /* Add data to ring buffer */
+    ring_buffer_put(net_data, ptr, net_data->tx_pending_msg_size);
+    net_data->tx_pending_msg_size = 0;
+
+    esp_apptrace_net_unlock(net_data);
+
+    /* Kick the streamer; trace writes can happen in ISR context */
+    if (net_data->task) {
+        if (xPortInIsrContext()) {
+            BaseType_t higher_prio_task_woken = pdFALSE;
+            vTaskNotifyGiveFromISR(net_data->task, &higher_prio_task_woken);
+            if (higher_prio_task_woken == pdTRUE) {
+                portYIELD_FROM_ISR();
+            }
+        } else {
+            xTaskNotifyGive(net_data->task);
+        }
+    }
+
+    return ESP_OK;
+}
+
+static void esp_apptrace_net_down_buffer_config(void *hw_data, uint8_t *buf, uint32_t size)
+{
+    esp_apptrace_net_data_t *net_data = hw_data;
+
+    assert(buf != NULL && "Down buffer cannot be NULL");
+    assert(size > 0 && "Down buffer size must be greater than 0");
+
+    net_data->rx_msg_buff = buf;
+    net_data->rx_msg_buff_size = size;
+}
+
+static uint8_t *esp_apptrace_net_down_buffer_get(void *hw_data, uint32_t *size, esp_apptrace_tmo_t *tmo)
+{
+    esp_apptrace_net_data_t *net_data = hw_data;
+    if (!size || *size == 0) {
+        return NULL;
+    }
+
+    if (!net_data->rx_msg_buff) {
+        ESP_APPTRACE_LOGE("RX message buffer is not configured. Call down_buffer_config() first.");
+        return NULL;
+    }
+
+    if (net_data->sock < 0) {
+        return NULL;
+    }
+
+    if (esp_apptrace_net_lock(net_data, tmo) != ESP_OK) {
+        return NULL;
+    }
+
+    int res = recv(net_data->sock, net_data->rx_msg_buff,
+                   MIN(net_data->rx_msg_buff_size, *size), MSG_DONTWAIT);
+    *size = (res > 0) ? res : 0;
+
+    esp_apptrace_net_unlock(net_data);
+
+    return (*size > 0) ? net_data->rx_msg_buff : NULL;
+}
+
+static esp_err_t esp_apptrace_net_down_buffer_put(void *hw_data, uint8_t *ptr, esp_apptrace_tmo_t *tmo)
+{
+    (void)hw_data;
+    (void)ptr;
+    (void)tmo;
+
+    /* No action needed - data was already read in get function */
+    return ESP_OK;
+}
+
+static bool esp_apptrace_net_host_is_connected(void *hw_data)
+{
+    esp_apptrace_net_data_t *net_data = hw_data;
+
+    return net_data->sock >= 0;
+}
+
+static esp_err_t esp_apptrace_net_flush_nolock(void *hw_data, uint32_t min_sz, esp_apptrace_tmo_t *tmo)
+{
+    esp_apptrace_net_data_t *net_data = hw_data;
+    esp_apptrace_net_rb_t *rb = &net_data->tx_ring;
+
+    uint32_t pending = ring_buffer_data_len(rb);
+    if (pending < min_sz) {
+        ESP_APPTRACE_LOGD("Ignore network flush request for min %" PRIu32 " bytes. Pending bytes: %" PRIu32,
+                          min_sz, pending);
+        return ESP_OK;
+    }
+
+    if (net_data->sock < 0) {
+        // No collector attached; nothing to wait for
+        return ESP_OK;
+    }
+
+    if (net_data->task) {
+        xTaskNotifyGive(net_data->task);
+    }
+    while (ring_buffer_data_len(rb) > 0) {
+        if (esp_apptrace_tmo_check(tmo) != ESP_OK) {
+            return ESP_ERR_TIMEOUT;
+        }
+        vTaskDelay(1);
+    }
+
+    return ESP_OK;
+}
+
+static esp_err_t esp_apptrace_net_flush(void *hw_data, esp_apptrace_tmo_t *tmo)
+{
+    /* Unlike the UART port, draining happens in a task, so the lock must not be
+     * held while waiting for the ring to empty. */
+    return esp_apptrace_net_flush_nolock(hw_data, 0, tmo);
+}
+
+esp_apptrace_hw_t *esp_apptrace_net_hw_get(void **data)
+{
+    ESP_APPTRACE_LOGD("esp_apptrace_net_hw_get");
+
+    static esp_apptrace_net_data_t s_net_hw_data;
+    static esp_apptrace_hw_t s_net_hw = {
+        .init = esp_apptrace_net_init,
+        .get_up_buffer = esp_apptrace_net_up_buffer_get,
+        .put_up_buffer = esp_apptrace_net_up_buffer_put,
+        .flush_up_buffer_nolock = esp_apptrace_net_flush_nolock,
+        .flush_up_buffer = esp_apptrace_net_flush,
+        .down_buffer_config = esp_apptrace_net_down_buffer_config,
+        .get_down_buffer = esp_apptrace_net_down_buffer_get,
+        .put_down_buffer = esp_apptrace_net_down_buffer_put,
+        .host_is_connected = esp_apptrace_net_host_is_connected,
+    };
+    *data = &s_net_hw_data;
+    return &s_net_hw;
+}
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_image_format.h"
+#include "sdkconfig.h"
+
+static const char *TAG = "ota_bg_verify";
+
+static atomic_bool s_verify_running = false;
+
+static void background_verify_task(void *arg)
+{
+    esp_ota_background_verify_config_t *config = (esp_ota_background_verify_config_t *) arg;
+    esp_err_t result = ESP_ERR_OTA_VALIDATE_FAILED;
+
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (running != NULL) {
+        const esp_partition_pos_t part_pos = {
+            .offset = running->address,
+            .size = running->size,
+        };
+        esp_image_metadata_t data;
+        result = esp_image_verify(ESP_IMAGE_VERIFY_SILENT, &part_pos, &data);
+        if (result != ESP_OK) {
+            result = ESP_ERR_OTA_VALIDATE_FAILED;
+        }
+    }
+
+    if (result == ESP_OK) {
+        ESP_LOGI(TAG, "Running app image verified");
+#ifdef CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE
+        esp_err_t err = esp_ota_mark_app_valid_cancel_rollback();
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to cancel rollback: %s", esp_err_to_name(err));
+        }
+#endif
+    } else {
+        ESP_LOGE(TAG, "Running app image verification failed");
+        if (config->rollback_on_failure) {
+            // Only returns when the rollback itself is impossible.
+            esp_err_t err = esp_ota_mark_app_invalid_rollback_and_reboot();
+            ESP_LOGE(TAG, "Rollback failed: %s", esp_err_to_name(err));
+        }
+    }
+
+    if (config->on_done != NULL) {
+        config->on_done(result, config->user_ctx);
+    }
+    free(config);
+    atomic_store(&s_verify_running, false);
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_ota_background_verify_start(const esp_ota_background_verify_config_t *config)
+{
+    if (config == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    bool expected = false;
+    if (!atomic_compare_exchange_strong(&s_verify_running, &expected, true)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // The task outlives this call, give it its own copy of the configuration.
+    esp_ota_background_verify_config_t *config_copy = malloc(sizeof(*config_copy));
+    if (config_copy == NULL) {
+        atomic_store(&s_verify_running, false);
+        return ESP_ERR_NO_MEM;
+    }
+    *config_copy = *config;
+
+    BaseType_t res = xTaskCreatePinnedToCore(background_verify_task, "ota_verify",
+                                             config->task_stack_size, config_copy,
+                                             config->task_priority, NULL,
+                                             (config->core_id < 0) ? tskNO_AFFINITY : config->core_id);
+    if (res != pdPASS) {
+        free(config_copy);
+        atomic_store(&s_verify_running, false);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
@@ -534,9 +534,16 @@ static esp_err_t rewrite_ota_seq(esp_ota_select_entry_t *two_otadata, uint32_t s
     esp_err_t ret = esp_partition_erase_range(ota_data_partition, sec_id * ota_data_partition->erase_size, ota_data_partition->erase_size);
     if (ret != ESP_OK) {
         return ret;
-    } else {
-        return esp_partition_write(ota_data_partition, ota_data_partition->erase_size * sec_id, &two_otadata[sec_id], sizeof(esp_ota_select_entry_t));
     }
+    ret = esp_partition_write(ota_data_partition, ota_data_partition->erase_size * sec_id, &two_otadata[sec_id], sizeof(esp_ota_select_entry_t));
+#ifdef CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+    if (ret == ESP_OK) {
+        // The boot decision may have changed, the one cached in RTC memory must not be
+        // reused on the next warm boot
+        bootloader_common_update_rtc_retain_mem_image_digest(NULL);
+    }
+#endif
+    return ret;
 }
 
 /**
@@ -687,7 +694,13 @@ esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition)
         if (partition->subtype == ESP_PARTITION_SUBTYPE_APP_FACTORY) {
             const esp_partition_t *find_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_OTA, NULL);
             if (find_partition != NULL) {
-                return esp_partition_erase_range(find_partition, 0, find_partition->size);
+                esp_err_t ret = esp_partition_erase_range(find_partition, 0, find_partition->size);
+#ifdef CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+                if (ret == ESP_OK) {
+                    bootloader_common_update_rtc_retain_mem_image_digest(NULL);
+                }
+#endif
+                return ret;
             } else {
                 return ESP_ERR_NOT_FOUND;
             }
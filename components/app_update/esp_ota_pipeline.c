@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include "esp_log.h"
+#include "esp_ota_pipeline.h"
+
+#define PIPELINE_BUF_NUM            (2)
+#define PIPELINE_DEFAULT_BUF_SIZE   (4096)
+#define PIPELINE_MIN_BUF_SIZE       (256)
+#define PIPELINE_TASK_STACK_SIZE    (4096)
+
+const static char *TAG = "esp_ota_pipeline";
+
+/* A message with buf == NULL is a control message: the writer task
+ * acknowledges it through sync_sem (and exits when exit_task is set),
+ * which gives drain/destroy a fence behind all staged data. */
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    bool exit_task;
+} pipeline_msg_t;
+
+struct esp_ota_pipeline_ctx {
+    esp_ota_handle_t ota_handle;
+    size_t buf_size;
+    uint8_t *buffers[PIPELINE_BUF_NUM];
+    QueueHandle_t free_q;
+    QueueHandle_t filled_q;
+    SemaphoreHandle_t sync_sem;
+    esp_err_t write_err;    /* first esp_ota_write error, sticky */
+};
+
+static void ota_pipeline_task(void *arg)
+{
+    struct esp_ota_pipeline_ctx *ctx = (struct esp_ota_pipeline_ctx *)arg;
+    pipeline_msg_t msg;
+    bool exit_task = false;
+
+    while (!exit_task) {
+        xQueueReceive(ctx->filled_q, &msg, portMAX_DELAY);
+        if (msg.buf == NULL) {
+            exit_task = msg.exit_task;
+            /* ctx must not be touched after the final give, destroy may free it */
+            xSemaphoreGive(ctx->sync_sem);
+            continue;
+        }
+        if (ctx->write_err == ESP_OK) {
+            ctx->write_err = esp_ota_write(ctx->ota_handle, msg.buf, msg.len);
+            if (ctx->write_err != ESP_OK) {
+                ESP_LOGE(TAG, "background esp_ota_write failed (%s)", esp_err_to_name(ctx->write_err));
+            }
+        }
+        xQueueSend(ctx->free_q, &msg, portMAX_DELAY);
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_ota_pipeline_create(esp_ota_handle_t ota_handle, size_t buffer_size, esp_ota_pipeline_handle_t *out_handle)
+{
+    if (out_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (buffer_size == 0) {
+        buffer_size = PIPELINE_DEFAULT_BUF_SIZE;
+    }
+    if (buffer_size < PIPELINE_MIN_BUF_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct esp_ota_pipeline_ctx *ctx = calloc(1, sizeof(struct esp_ota_pipeline_ctx));
+    if (ctx == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->ota_handle = ota_handle;
+    ctx->buf_size = buffer_size;
+    ctx->write_err = ESP_OK;
+
+    /* one extra slot in filled_q for a control message */
+    ctx->free_q = xQueueCreate(PIPELINE_BUF_NUM, sizeof(pipeline_msg_t));
+    ctx->filled_q = xQueueCreate(PIPELINE_BUF_NUM + 1, sizeof(pipeline_msg_t));
+    ctx->sync_sem = xSemaphoreCreateBinary();
+    if (ctx->free_q == NULL || ctx->filled_q == NULL || ctx->sync_sem == NULL) {
+        goto err;
+    }
+
+    for (int i = 0; i < PIPELINE_BUF_NUM; i++) {
+        ctx->buffers[i] = malloc(buffer_size);
+        if (ctx->buffers[i] == NULL) {
+            goto err;
+        }
+        pipeline_msg_t msg = { .buf = ctx->buffers[i], .len = 0, .exit_task = false };
+        xQueueSend(ctx->free_q, &msg, 0);
+    }
+
+    /* Inherit the caller's priority so the writer cannot starve the producer */
+    if (xTaskCreate(ota_pipeline_task, "ota_pipeline", PIPELINE_TASK_STACK_SIZE, ctx,
+                    uxTaskPriorityGet(NULL), NULL) != pdPASS) {
+        goto err;
+    }
+
+    *out_handle = ctx;
+    return ESP_OK;
+
+err:
+    for (int i = 0; i < PIPELINE_BUF_NUM; i++) {
+        free(ctx->buffers[i]);
+    }
+    if (ctx->free_q) {
+        vQueueDelete(ctx->free_q);
+    }
+    if (ctx->filled_q) {
+        vQueueDelete(ctx->filled_q);
+    }
+    if (ctx->sync_sem) {
+        vSemaphoreDelete(ctx->sync_sem);
+    }
+    free(ctx);
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t esp_ota_pipeline_write(esp_ota_pipeline_handle_t handle, const void *data, size_t size)
+{
+    if (handle == NULL || data == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const uint8_t *data_bytes = (const uint8_t *)data;
+
+    while (size > 0) {
+        if (handle->write_err != ESP_OK) {
+            return handle->write_err;
+        }
+        pipeline_msg_t msg;
+        xQueueReceive(handle->free_q, &msg, portMAX_DELAY);
+        size_t chunk = MIN(size, handle->buf_size);
+        memcpy(msg.buf, data_bytes, chunk);
+        msg.len = chunk;
+        xQueueSend(handle->filled_q, &msg, portMAX_DELAY);
+        data_bytes += chunk;
+        size -= chunk;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_ota_pipeline_drain(esp_ota_pipeline_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pipeline_msg_t msg = { .buf = NULL, .len = 0, .exit_task = false };
+    xQueueSend(handle->filled_q, &msg, portMAX_DELAY);
+    xSemaphoreTake(handle->sync_sem, portMAX_DELAY);
+    return handle->write_err;
+}
+
+esp_err_t esp_ota_pipeline_destroy(esp_ota_pipeline_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pipeline_msg_t msg = { .buf = NULL, .len = 0, .exit_task = true };
+    xQueueSend(handle->filled_q, &msg, portMAX_DELAY);
+    xSemaphoreTake(handle->sync_sem, portMAX_DELAY);
+
+    for (int i = 0; i < PIPELINE_BUF_NUM; i++) {
+        free(handle->buffers[i]);
+    }
+    vQueueDelete(handle->free_q);
+    vQueueDelete(handle->filled_q);
+    vSemaphoreDelete(handle->sync_sem);
+    free(handle);
+    return ESP_OK;
+}
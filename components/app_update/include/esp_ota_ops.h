@@ -359,6 +359,53 @@ esp_err_t esp_ota_mark_app_invalid_rollback(void);
  */
 esp_err_t esp_ota_mark_app_invalid_rollback_and_reboot(void);
 
+/**
+ * @brief Configuration for esp_ota_background_verify_start()
+ */
+typedef struct {
+    unsigned task_priority;     /*!< Priority of the verification task; keep it low so hashing does not preempt latency-critical tasks */
+    size_t task_stack_size;     /*!< Stack size of the verification task (in bytes) */
+    int core_id;                /*!< Core affinity of the verification task, or -1 for no affinity */
+    bool rollback_on_failure;   /*!< Call esp_ota_mark_app_invalid_rollback_and_reboot() when the verification fails */
+    void (*on_done)(esp_err_t result, void *user_ctx); /*!< Optional completion callback, invoked from the verification task */
+    void *user_ctx;             /*!< Opaque pointer passed to on_done */
+} esp_ota_background_verify_config_t;
+
+#define ESP_OTA_BACKGROUND_VERIFY_CONFIG_DEFAULT() {  \
+    .task_priority = 1,  \
+    .task_stack_size = 4096,  \
+    .core_id = -1,  \
+    .rollback_on_failure = true,  \
+    .on_done = NULL,  \
+    .user_ctx = NULL,  \
+}
+
+/**
+ * @brief Verify the running application image from a background task.
+ *
+ * Runs the full image verification (checksum, SHA-256 and, when enabled, the signature)
+ * of the currently running partition in a dedicated task, then gates the rollback
+ * decision on the result: on success esp_ota_mark_app_valid_cancel_rollback() is called,
+ * on failure the image stays in its pending state or, with rollback_on_failure set,
+ * esp_ota_mark_app_invalid_rollback_and_reboot() is invoked.
+ *
+ * Intended for configurations which shorten the first boot after an OTA update by
+ * skipping the bootloader validation (see the BOOTLOADER_SKIP_VALIDATE options): the
+ * application comes up immediately and the full flash pass happens in the background.
+ * Note that with Secure Boot the bootloader validation cannot be skipped, the signature
+ * covers a digest of the entire image; this function then serves as an in-field
+ * integrity check before the rollback window is closed.
+ *
+ * @param config Task and policy configuration
+ *
+ * @return
+ *  - ESP_OK: verification task started.
+ *  - ESP_ERR_INVALID_ARG: config is NULL.
+ *  - ESP_ERR_INVALID_STATE: a verification task is already running.
+ *  - ESP_ERR_NO_MEM: task creation failed.
+ */
+esp_err_t esp_ota_background_verify_start(const esp_ota_background_verify_config_t *config);
+
 /**
  * @brief Returns last partition with invalid state (ESP_OTA_IMG_INVALID or ESP_OTA_IMG_ABORTED).
  *
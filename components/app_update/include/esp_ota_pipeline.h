@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_ota_ops.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque handle for a pipelined OTA writer
+ */
+typedef struct esp_ota_pipeline_ctx *esp_ota_pipeline_handle_t;
+
+/**
+ * @brief Create a pipelined writer on top of an OTA update handle
+ *
+ * The writer owns two staging buffers and a dedicated task: while the task
+ * erases and programs one buffer into the update partition, the caller can
+ * already download and stage the next one, overlapping network and flash
+ * time. Useful for esp_https_ota style downloads where every
+ * esp_ota_write() otherwise stalls the TLS receive path for the duration
+ * of a sector erase + program.
+ *
+ * The OTA handle must come from esp_ota_begin() and must not be written to
+ * directly while the pipeline exists.
+ *
+ * @param[in]  ota_handle  Update handle obtained from esp_ota_begin()
+ * @param[in]  buffer_size Size of each staging buffer in bytes, 0 selects 4096
+ * @param[out] out_handle  Returned pipeline handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG if out_handle is NULL or buffer_size is unreasonably small
+ *          - ESP_ERR_NO_MEM      if buffers, queues or the writer task cannot be allocated
+ *          - ESP_OK              on success
+ */
+esp_err_t esp_ota_pipeline_create(esp_ota_handle_t ota_handle, size_t buffer_size, esp_ota_pipeline_handle_t *out_handle);
+
+/**
+ * @brief Stage OTA data for background writing
+ *
+ * Copies the data into a free staging buffer and returns; the call only
+ * blocks when both buffers are still being written to flash. A flash error
+ * encountered by the writer task is returned by this call or, at the
+ * latest, by esp_ota_pipeline_drain().
+ *
+ * @param[in] handle Pipeline handle
+ * @param[in] data   Data to write
+ * @param[in] size   Size of the data, in bytes
+ * @return
+ *          - ESP_ERR_INVALID_ARG if handle or data is NULL
+ *          - ESP_OK              on success
+ *          - Error codes from esp_ota_write() on write failure
+ */
+esp_err_t esp_ota_pipeline_write(esp_ota_pipeline_handle_t handle, const void *data, size_t size);
+
+/**
+ * @brief Wait until all staged data has been written to flash
+ *
+ * Must be called before esp_ota_end() so the image is complete on flash.
+ *
+ * @param[in] handle Pipeline handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG if handle is NULL
+ *          - ESP_OK              when all staged data hit the flash
+ *          - Error codes from esp_ota_write() on write failure
+ */
+esp_err_t esp_ota_pipeline_drain(esp_ota_pipeline_handle_t handle);
+
+/**
+ * @brief Stop the writer task and free the pipeline resources
+ *
+ * Pending staged data is still written out before the task exits; call
+ * esp_ota_pipeline_drain() first if the result matters. The underlying OTA
+ * handle stays valid and must still be finished with esp_ota_end() or
+ * esp_ota_abort().
+ *
+ * @param[in] handle Pipeline handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG if handle is NULL
+ *          - ESP_OK              on success
+ */
+esp_err_t esp_ota_pipeline_destroy(esp_ota_pipeline_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -48,6 +48,13 @@ void __attribute__((noreturn)) call_start_cpu0(void)
     // If it is not successful try to load an application as usual.
 #endif
 
+#ifdef CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+    // On a warm boot reuse the boot decision cached in RTC memory, skipping the
+    // partition table and otadata reads, as long as the cached digest still
+    // matches the image on flash. Falls through on a cache miss.
+    bootloader_utility_load_boot_image_from_rtc_cache();
+#endif
+
     // 2. Select the number of boot partition
     bootloader_state_t bs = {0};
     int boot_index = select_partition_number(&bs);
@@ -241,6 +241,34 @@ esp_partition_pos_t* bootloader_common_get_rtc_retain_mem_partition(void);
  */
 void bootloader_common_update_rtc_retain_mem(esp_partition_pos_t* partition, bool reboot_counter);
 
+#if CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+/**
+ * @brief Returns the cached image digest from rtc_retain_mem
+ *
+ * Uses to get the SHA-256 digest of the application which was validated on the previous boot.
+ * Note: This function operates the RTC FAST memory which available only for PRO_CPU.
+ *       Make sure that this function is used only PRO_CPU.
+ *
+ * @return digest: If rtc_retain_mem is valid.
+ *        - NULL: If it is not valid.
+ */
+uint8_t* bootloader_common_get_rtc_retain_mem_image_digest(void);
+
+/**
+ * @brief Update the cached image digest in rtc_retain_mem.
+ *
+ * This function saves the digest of the validated application so that a warm boot can skip
+ * re-reading the partition table and otadata. Pass NULL to invalidate the cached digest,
+ * forcing the next boot to take the fully validated path.
+ * Note: This function operates the RTC FAST memory which available only for PRO_CPU.
+ *       Make sure that this function is used only PRO_CPU.
+ *
+ * @param[in] image_digest   SHA-256 digest of the application image. Can be NULL, in this case
+ *                           the cached digest is cleared.
+ */
+void bootloader_common_update_rtc_retain_mem_image_digest(const uint8_t* image_digest);
+#endif // CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+
 /**
  * @brief Reset entire rtc_retain_mem.
  *
@@ -57,6 +57,9 @@ typedef struct {
         uint8_t val;
     } flags;
     uint8_t reserve;                /*!< Reserve */
+#ifdef CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+    uint8_t image_digest[ESP_IMAGE_HASH_LEN]; /*!< SHA-256 digest appended to the last successfully validated image */
+#endif
 #ifdef CONFIG_BOOTLOADER_CUSTOM_RESERVE_RTC
     uint8_t custom[CONFIG_BOOTLOADER_CUSTOM_RESERVE_RTC_SIZE]; /*!< Reserve for custom propose */
 #endif
@@ -75,6 +75,19 @@ __attribute__((__noreturn__)) void bootloader_utility_load_boot_image(const boot
 void bootloader_utility_load_boot_image_from_deep_sleep(void);
 #endif
 
+#ifdef CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+/**
+ * @brief Load the application which was selected and fully validated on a previous boot.
+ *
+ * On a warm boot (software reset or wake up from deep sleep), if the RTC memory holds a valid
+ * boot cache and the digest appended to the cached image still matches the cached digest, then
+ * the application is loaded directly, without reading the partition table and the otadata.
+ * Returns without booting when the cache does not validate, so that the regular fully
+ * validated boot path can run instead.
+ */
+void bootloader_utility_load_boot_image_from_rtc_cache(void);
+#endif
+
 /**
  * @brief Software reset the ESP32
  *
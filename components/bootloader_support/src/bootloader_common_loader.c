@@ -259,6 +259,30 @@ void bootloader_common_update_rtc_retain_mem(esp_partition_pos_t* partition, boo
     update_rtc_retain_mem_crc();
 }
 
+#if CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+uint8_t* bootloader_common_get_rtc_retain_mem_image_digest(void)
+{
+    if (is_retain_mem_valid()) {
+        return bootloader_common_get_rtc_retain_mem()->image_digest;
+    }
+    return NULL;
+}
+
+void bootloader_common_update_rtc_retain_mem_image_digest(const uint8_t* image_digest)
+{
+    rtc_retain_mem_t* rtc_retain_mem = bootloader_common_get_rtc_retain_mem();
+    if (!is_retain_mem_valid()) {
+        bootloader_common_reset_rtc_retain_mem();
+    }
+    if (image_digest != NULL) {
+        memcpy(rtc_retain_mem->image_digest, image_digest, sizeof(rtc_retain_mem->image_digest));
+    } else {
+        memset(rtc_retain_mem->image_digest, 0, sizeof(rtc_retain_mem->image_digest));
+    }
+    update_rtc_retain_mem_crc();
+}
+#endif // CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+
 rtc_retain_mem_t* bootloader_common_get_rtc_retain_mem(void)
 {
 #ifdef BOOTLOADER_BUILD
@@ -478,6 +478,13 @@ static bool try_load_partition(const esp_partition_pos_t *partition, esp_image_m
 #ifdef BOOTLOADER_BUILD
     if (bootloader_load_image(partition, data) == ESP_OK) {
         ESP_LOGI(TAG, "Loaded app from partition at offset 0x%" PRIx32, partition->offset);
+#ifdef CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+        if (data->image.hash_appended) {
+            // The image passed the full validation, remember its digest so that the
+            // next warm boot can take the cached boot path
+            bootloader_common_update_rtc_retain_mem_image_digest(data->image_digest);
+        }
+#endif
         return true;
     }
 #endif
@@ -504,7 +511,7 @@ static void set_actual_ota_seq(const bootloader_state_t *bs, int index)
 #endif
     }
 #if CONFIG_BOOTLOADER_RESERVE_RTC_MEM
-#ifdef CONFIG_BOOTLOADER_SKIP_VALIDATE_IN_DEEP_SLEEP
+#if defined(CONFIG_BOOTLOADER_SKIP_VALIDATE_IN_DEEP_SLEEP) || defined(CONFIG_BOOTLOADER_RTC_BOOT_CACHE)
     esp_partition_pos_t partition = index_to_partition(bs, index);
     bootloader_common_update_rtc_retain_mem(&partition, true);
 #else
@@ -550,6 +557,41 @@ void bootloader_utility_load_boot_image_from_deep_sleep(void)
 }
 #endif
 
+#ifdef CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+void bootloader_utility_load_boot_image_from_rtc_cache(void)
+{
+    soc_reset_reason_t reset_reason = esp_rom_get_reset_reason(0);
+    if (reset_reason != RESET_REASON_CORE_SW && reset_reason != RESET_REASON_CORE_DEEP_SLEEP) {
+        // Cold boots and abnormal resets (power-on, brownout, panic, watchdog) always take
+        // the fully validated path: the flash may have been reprogrammed, or the cached
+        // decision itself may be the reason why the chip went down.
+        return;
+    }
+    esp_partition_pos_t *partition = bootloader_common_get_rtc_retain_mem_partition();
+    uint8_t *cached_digest = bootloader_common_get_rtc_retain_mem_image_digest();
+    if (partition == NULL || cached_digest == NULL) {
+        return;
+    }
+    esp_image_metadata_t image_data;
+    if (bootloader_load_image_no_verify(partition, &image_data) != ESP_OK || !image_data.image.hash_appended) {
+        ESP_LOGI(TAG, "Cached boot partition is not loadable, fall back to the regular boot path");
+        return;
+    }
+    // Comparing the digest appended to the image against the cached one is enough here:
+    // the image contents were fully validated on the boot that filled the cache.
+    uint8_t appended_digest[ESP_IMAGE_HASH_LEN];
+    if (bootloader_flash_read(partition->offset + image_data.image_len - ESP_IMAGE_HASH_LEN,
+                              appended_digest, ESP_IMAGE_HASH_LEN, true) != ESP_OK
+            || memcmp(appended_digest, cached_digest, ESP_IMAGE_HASH_LEN) != 0) {
+        ESP_LOGI(TAG, "Cached boot digest mismatch, fall back to the regular boot path");
+        return;
+    }
+    ESP_LOGI(TAG, "Fast booting app from cached partition at offset 0x%"PRIx32, partition->offset);
+    bootloader_common_update_rtc_retain_mem(NULL, true);
+    load_image(&image_data);
+}
+#endif // CONFIG_BOOTLOADER_RTC_BOOT_CACHE
+
 #if CONFIG_SECURE_ENABLE_TEE
 void bootloader_utility_load_tee_image(const bootloader_state_t *bs)
 {
@@ -61,6 +61,36 @@ ESP_LOG_ATTR_TAG(TAG, "esp_image");
 /* Headroom to ensure between stack SP (at time of checking) and data loaded from flash */
 #define STACK_LOAD_HEADROOM 32768
 
+#if CONFIG_BOOTLOADER_IMAGE_LOAD_PERF_STATS
+/* CPU cycles spent in each phase of the current image_load() call.
+
+   Segment loading hashes in the same pass as the copy & checksum (see the
+   SHA_CHUNK handling in process_segment_data), so "sha" cycles are a subset
+   of the word loop and are reported separately from the pure copy time. */
+static struct {
+    uint32_t map_cycles;    // bootloader_mmap of segment data
+    uint32_t loop_cycles;   // copy + checksum word loop, including SHA updates
+    uint32_t sha_cycles;    // bootloader_sha256_data calls inside the loop
+    uint32_t verify_cycles; // final digest computation and hash/signature check
+} s_load_perf;
+
+#define LOAD_PERF_BEGIN(phase) uint32_t _perf_start_##phase = esp_cpu_get_cycle_count()
+#define LOAD_PERF_END(phase) (s_load_perf.phase##_cycles += esp_cpu_get_cycle_count() - _perf_start_##phase)
+
+static void load_perf_log(void)
+{
+    uint32_t mhz = ets_get_cpu_frequency();
+    ESP_LOGI(TAG, "image load: map %"PRIu32"us copy+checksum %"PRIu32"us sha %"PRIu32"us verify %"PRIu32"us",
+             s_load_perf.map_cycles / mhz,
+             (s_load_perf.loop_cycles - s_load_perf.sha_cycles) / mhz,
+             s_load_perf.sha_cycles / mhz,
+             s_load_perf.verify_cycles / mhz);
+}
+#else
+#define LOAD_PERF_BEGIN(phase)
+#define LOAD_PERF_END(phase)
+#endif // CONFIG_BOOTLOADER_IMAGE_LOAD_PERF_STATS
+
 #ifdef BOOTLOADER_BUILD
 /* 64 bits of random data to obfuscate loaded RAM with, until verification is complete
    (Means loaded code isn't executable until after the secure boot check.)
@@ -184,6 +214,10 @@ static esp_err_t image_load(esp_image_load_mode_t mode, const esp_partition_pos_
         return ESP_ERR_INVALID_ARG;
     }
 
+#if CONFIG_BOOTLOADER_IMAGE_LOAD_PERF_STATS
+    memset(&s_load_perf, 0, sizeof(s_load_perf));
+#endif
+
 #if CONFIG_SECURE_BOOT_V2_ENABLED
     // For Secure Boot V2, we do verify signature on bootloader which includes the SHA calculation.
     verify_sha = do_verify;
@@ -205,6 +239,7 @@ static esp_err_t image_load(esp_image_load_mode_t mode, const esp_partition_pos_
     bool skip_check_checksum = !do_verify || esp_cpu_dbgr_is_attached();
     CHECK_ERR(process_checksum(sha_handle, checksum_word, data, silent, skip_check_checksum));
     CHECK_ERR(process_appended_hash_and_sig(data, part->offset, part->size, do_verify, silent));
+    LOAD_PERF_BEGIN(verify);
     if (verify_sha) {
 #if (SECURE_BOOT_CHECK_SIGNATURE == 1)
         // secure boot images have a signature appended
@@ -228,6 +263,7 @@ static esp_err_t image_load(esp_image_load_mode_t mode, const esp_partition_pos_
         }
 #endif // SECURE_BOOT_CHECK_SIGNATURE
     } // verify_sha
+    LOAD_PERF_END(verify);
 
     // bootloader may still have a sha256 digest handle open
     if (sha_handle != NULL) {
@@ -295,6 +331,9 @@ static esp_err_t image_load(esp_image_load_mode_t mode, const esp_partition_pos_
 #endif // BOOTLOADER_BUILD
 
     // Success!
+#if CONFIG_BOOTLOADER_IMAGE_LOAD_PERF_STATS
+    load_perf_log();
+#endif
     return ESP_OK;
 
 err:
@@ -727,12 +766,14 @@ static esp_err_t process_segment_data(int segment, intptr_t load_addr, uint32_t
         return ESP_OK;
     }
 
+    LOAD_PERF_BEGIN(map);
     const uint32_t *data = (const uint32_t *)bootloader_mmap(data_addr, data_len);
     if (!data) {
         ESP_LOGE(TAG, "bootloader_mmap(0x%"PRIx32", 0x%"PRIx32") failed",
                  data_addr, data_len);
         return ESP_FAIL;
     }
+    LOAD_PERF_END(map);
 
     if (checksum == NULL && sha_handle == NULL) {
         memcpy((void *)load_addr, data, data_len);
@@ -785,6 +826,7 @@ static esp_err_t process_segment_data(int segment, intptr_t load_addr, uint32_t
 #endif // CONFIG_BOOTLOADER_APP_ANTI_ROLLBACK
     }
 
+    LOAD_PERF_BEGIN(loop);
     for (size_t i = 0; i < data_len; i += 4) {
         int w_i = i / 4; // Word index
         uint32_t w = src[w_i];
@@ -802,10 +844,13 @@ static esp_err_t process_segment_data(int segment, intptr_t load_addr, uint32_t
         // SHA256 block size.
         const size_t SHA_CHUNK = 1024;
         if (sha_handle != NULL && i % SHA_CHUNK == 0) {
+            LOAD_PERF_BEGIN(sha);
             bootloader_sha256_data(sha_handle, &src[w_i],
                                    MIN(SHA_CHUNK, data_len - i));
+            LOAD_PERF_END(sha);
         }
     }
+    LOAD_PERF_END(loop);
 #if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
     if (do_load && esp_ptr_in_iram((uint32_t *)load_addr)) {
         /* If we have manipulated data over dcache that will be read over icache then we need
@@ -312,6 +312,49 @@ esp_err_t esp_ble_gatts_send_indicate(esp_gatt_if_t gatts_if, uint16_t conn_id,
                 btc_gatts_arg_deep_free) == BT_STATUS_SUCCESS ? ESP_OK : ESP_FAIL);
 }
 
+esp_err_t esp_ble_gatts_send_notifications(esp_gatt_if_t gatts_if, uint16_t conn_id, uint16_t notify_num,
+                                           const esp_ble_gatts_notify_data_t *notify_data)
+{
+    if (notify_num == 0 || notify_data == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (uint16_t i = 0; i < notify_num; i++) {
+        if (notify_data[i].value == NULL || notify_data[i].value_len == 0 ||
+                notify_data[i].value_len > ESP_GATT_MAX_ATTR_LEN) {
+            LOG_ERROR("%s, invalid value in batch entry %d.", __func__, i);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    btc_msg_t msg = {0};
+    btc_ble_gatts_args_t arg;
+
+    ESP_BLUEDROID_STATUS_CHECK(ESP_BLUEDROID_STATUS_ENABLED);
+
+    tGATT_TCB       *p_tcb = gatt_get_tcb_by_idx(conn_id);
+    if (!gatt_check_connection_state_by_tcb(p_tcb)) {
+        LOG_WARN("%s, The connection not created.", __func__);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (L2CA_CheckIsCongest(L2CAP_ATT_CID, p_tcb->peer_bda)) {
+        LOG_DEBUG("%s, the l2cap channel is congest.", __func__);
+        return ESP_FAIL;
+    }
+
+    msg.sig = BTC_SIG_API_CALL;
+    msg.pid = BTC_PID_GATTS;
+    msg.act = BTC_GATTS_ACT_SEND_NOTIFY_BATCH;
+    arg.send_notify_batch.conn_id = BTC_GATT_CREATE_CONN_ID(gatts_if, conn_id);
+    arg.send_notify_batch.notify_num = notify_num;
+    arg.send_notify_batch.notify_data = (esp_ble_gatts_notify_data_t *)notify_data;
+    for (uint16_t i = 0; i < notify_num; i++) {
+        l2ble_update_att_acl_pkt_num(L2CA_ADD_BTC_NUM, NULL);
+    }
+    return (btc_transfer_context(&msg, &arg, sizeof(btc_ble_gatts_args_t), btc_gatts_arg_deep_copy,
+                btc_gatts_arg_deep_free) == BT_STATUS_SUCCESS ? ESP_OK : ESP_FAIL);
+}
+
 esp_err_t esp_ble_gatts_send_response(esp_gatt_if_t gatts_if, uint16_t conn_id, uint32_t trans_id,
                                       esp_gatt_status_t status, esp_gatt_rsp_t *rsp)
 {
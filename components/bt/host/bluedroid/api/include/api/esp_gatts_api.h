@@ -43,8 +43,18 @@ typedef enum {
     ESP_GATTS_CREAT_ATTR_TAB_EVT      = 22,      /*!< This event is triggered when a service attribute table is created using `esp_ble_gatts_create_attr_tab`. */
     ESP_GATTS_SET_ATTR_VAL_EVT        = 23,      /*!< This event is triggered when an attribute value is set using `esp_ble_gatts_set_attr_value`. */
     ESP_GATTS_SEND_SERVICE_CHANGE_EVT = 24,      /*!< This event is triggered when a service change indication is sent using `esp_ble_gatts_send_service_change_indication`. */
+    ESP_GATTS_NOTIFY_BATCH_CMPL_EVT   = 25,      /*!< This event is triggered when a batch of notifications queued with `esp_ble_gatts_send_notifications` has been handed to the controller. */
 } esp_gatts_cb_event_t;
 
+/**
+ * @brief One notification of a batch passed to `esp_ble_gatts_send_notifications`
+ */
+typedef struct {
+    uint16_t attr_handle;               /*!< Attribute handle to notify */
+    uint16_t value_len;                 /*!< Notification value length in bytes */
+    uint8_t *value;                     /*!< Notification value */
+} esp_ble_gatts_notify_data_t;
+
 /**
  * @brief GATT Server callback parameters
  */
@@ -267,6 +277,16 @@ typedef union {
         esp_gatt_status_t status;        /*!< Operation status */
     } service_change;                    /*!< Callback parameter for the event `ESP_GATTS_SEND_SERVICE_CHANGE_EVT` */
 
+    /**
+    * @brief Callback parameter for the event `ESP_GATTS_NOTIFY_BATCH_CMPL_EVT`
+    */
+    struct gatts_notify_batch_cmpl_evt_param{
+        esp_gatt_status_t status;        /*!< Operation status */
+        uint16_t conn_id;                /*!< Connection ID */
+        uint16_t sent_num;               /*!< Number of notifications of the batch handed to the controller */
+        uint16_t free_credit_num;        /*!< Controller buffer credits still available on this connection; pace the next batch on this */
+    } notify_batch_cmpl;                 /*!< Callback parameter for the event `ESP_GATTS_NOTIFY_BATCH_CMPL_EVT` */
+
 } esp_ble_gatts_cb_param_t;
 
 /**
@@ -496,6 +516,34 @@ esp_err_t esp_ble_gatts_stop_service(uint16_t service_handle);
 esp_err_t esp_ble_gatts_send_indicate(esp_gatt_if_t gatts_if, uint16_t conn_id, uint16_t attr_handle,
                                       uint16_t value_len, uint8_t *value, bool need_confirm);
 
+/**
+ * @brief  Send a batch of notifications to a GATT Client
+ *
+ * Queues all notifications towards the controller in one host context switch,
+ * instead of one per `esp_ble_gatts_send_indicate` call. With enough data
+ * queued the controller can pack several notification PDUs into each
+ * connection event, which is the key to high notification throughput.
+ *
+ * @param[in]       gatts_if      GATT Server access interface
+ * @param[in]       conn_id       Connection ID
+ * @param[in]       notify_num    Number of notifications in the batch
+ * @param[in]       notify_data   Array of handle/value pairs to notify
+ *
+ * @note
+ *       1. This function triggers a single `ESP_GATTS_NOTIFY_BATCH_CMPL_EVT` for the whole batch (no per-notification `ESP_GATTS_CONF_EVT`).
+ *          The event carries the remaining controller buffer credits; use it to pace the next batch instead of polling.
+ *       2. The size of each notification value must be less than or equal to MTU size - 3, see `esp_ble_gattc_send_mtu_req`.
+ *       3. Do not queue more notifications than `esp_ble_get_cur_sendable_packets_num` reports available, or the surplus is dropped by the stack.
+ *
+ * @return
+ *       - ESP_OK: Success
+ *       - ESP_ERR_INVALID_ARG: Invalid batch array
+ *       - ESP_ERR_INVALID_STATE: The connection has not been established
+ *       - ESP_FAIL: Failure due to other reasons
+ */
+esp_err_t esp_ble_gatts_send_notifications(esp_gatt_if_t gatts_if, uint16_t conn_id, uint16_t notify_num,
+                                           const esp_ble_gatts_notify_data_t *notify_data);
+
 /**
  * @brief  Send a response to a request
  *
@@ -18,9 +18,12 @@
 #include "esp_gatts_api.h"
 #include "btc/btc_storage.h"
 #include "common/bt_defs.h"
+#include "stack/l2c_api.h"
 
 #if (GATTS_INCLUDED == TRUE)
 
+extern UINT16 L2CA_GetCurFreePktBufferNum_LE(UINT16 conn_id);
+
 #define A2C_GATTS_EVT(_bta_event) (_bta_event) //BTA TO BTC EVT
 #define C2A_GATTS_EVT(_btc_event) (_btc_event) //BTC TO BTA EVT
 
@@ -95,6 +98,30 @@ void btc_gatts_arg_deep_copy(btc_msg_t *msg, void *p_dest, void *p_src)
         break;
 
     }
+    case BTC_GATTS_ACT_SEND_NOTIFY_BATCH: {
+        uint16_t num = src->send_notify_batch.notify_num;
+        dst->send_notify_batch.notify_data = NULL;
+        if (src->send_notify_batch.notify_data && num > 0) {
+            esp_ble_gatts_notify_data_t *notify_data =
+                (esp_ble_gatts_notify_data_t *) osi_malloc(num * sizeof(esp_ble_gatts_notify_data_t));
+            if (notify_data == NULL) {
+                BTC_TRACE_ERROR("%s %d no mem\n", __func__, msg->act);
+                break;
+            }
+            memcpy(notify_data, src->send_notify_batch.notify_data, num * sizeof(esp_ble_gatts_notify_data_t));
+            for (uint16_t i = 0; i < num; i++) {
+                notify_data[i].value = (uint8_t *) osi_malloc(notify_data[i].value_len);
+                if (notify_data[i].value) {
+                    memcpy(notify_data[i].value, src->send_notify_batch.notify_data[i].value,
+                           notify_data[i].value_len);
+                } else {
+                    BTC_TRACE_ERROR("%s %d no mem\n", __func__, msg->act);
+                }
+            }
+            dst->send_notify_batch.notify_data = notify_data;
+        }
+        break;
+    }
     case BTC_GATTS_ACT_ADD_CHAR: {
         if (src->add_char.char_val.attr_value && (src->add_char.char_val.attr_len > 0)) {
             dst->add_char.char_val.attr_value = (uint8_t *) osi_malloc(src->add_char.char_val.attr_len);
@@ -186,6 +213,17 @@ void btc_gatts_arg_deep_free(btc_msg_t *msg)
         }
         break;
     }
+    case BTC_GATTS_ACT_SEND_NOTIFY_BATCH: {
+        if (arg->send_notify_batch.notify_data) {
+            for (uint16_t i = 0; i < arg->send_notify_batch.notify_num; i++) {
+                if (arg->send_notify_batch.notify_data[i].value) {
+                    osi_free(arg->send_notify_batch.notify_data[i].value);
+                }
+            }
+            osi_free(arg->send_notify_batch.notify_data);
+        }
+        break;
+    }
     case BTC_GATTS_ACT_ADD_CHAR:{
         if (arg->add_char.char_val.attr_value != NULL) {
             osi_free(arg->add_char.char_val.attr_value);
@@ -681,6 +719,35 @@ void btc_gatts_call_handler(btc_msg_t *msg)
         BTA_GATTS_HandleValueIndication(arg->send_ind.conn_id, arg->send_ind.attr_handle,
                                         arg->send_ind.value_len, arg->send_ind.value, arg->send_ind.need_confirm);
         break;
+    case BTC_GATTS_ACT_SEND_NOTIFY_BATCH: {
+        esp_ble_gatts_cb_param_t param;
+        uint16_t num = arg->send_notify_batch.notify_num;
+        uint16_t sent_num = 0;
+
+        /* Hand the whole batch to the stack back to back so the controller
+         * can pack as many notification PDUs as fit into each connection event */
+        for (uint16_t i = 0; i < num; i++) {
+            esp_ble_gatts_notify_data_t *notify_data =
+                arg->send_notify_batch.notify_data ? &arg->send_notify_batch.notify_data[i] : NULL;
+            if (notify_data == NULL || notify_data->value == NULL) {
+                /* Deep copy ran out of memory for this entry, return its credit */
+                l2ble_update_att_acl_pkt_num(L2CA_DECREASE_BTC_NUM, NULL);
+                continue;
+            }
+            BTA_GATTS_HandleValueIndication(arg->send_notify_batch.conn_id, notify_data->attr_handle,
+                                            notify_data->value_len, notify_data->value, false);
+            sent_num++;
+        }
+
+        param.notify_batch_cmpl.status = (sent_num == num) ? ESP_GATT_OK : ESP_GATT_NO_RESOURCES;
+        param.notify_batch_cmpl.conn_id = BTC_GATT_GET_CONN_ID(arg->send_notify_batch.conn_id);
+        param.notify_batch_cmpl.sent_num = sent_num;
+        param.notify_batch_cmpl.free_credit_num =
+            L2CA_GetCurFreePktBufferNum_LE(BTC_GATT_GET_CONN_ID(arg->send_notify_batch.conn_id));
+        btc_gatts_cb_to_app(ESP_GATTS_NOTIFY_BATCH_CMPL_EVT,
+                            BTC_GATT_GET_GATT_IF(arg->send_notify_batch.conn_id), &param);
+        break;
+    }
     case BTC_GATTS_ACT_SEND_RESPONSE: {
         esp_ble_gatts_cb_param_t param;
         esp_gatt_rsp_t *p_rsp = arg->send_rsp.rsp;
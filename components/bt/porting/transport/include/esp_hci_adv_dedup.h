@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef H_ESP_HCI_ADV_DEDUP_
+#define H_ESP_HCI_ADV_DEDUP_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stdint.h>
+
+/**
+ * @brief Counters kept by the advertising report deduplication filter
+ */
+typedef struct {
+    uint32_t reports_seen;        /*!< Advertising report events received from the controller */
+    uint32_t reports_suppressed;  /*!< Events suppressed as duplicates within the suppression window */
+    uint32_t reports_batched;     /*!< Events held back and delivered as part of a batched flush */
+    uint32_t batch_flushes;       /*!< Number of batched deliveries to the host */
+} esp_hci_adv_dedup_stats_t;
+
+/**
+ * @brief Function used by the filter to forward a held event buffer to the host transport driver.
+ */
+typedef int hci_adv_dedup_forward_fn(uint8_t *hci_ev);
+
+/**
+ * @brief Initialize the advertising report deduplication filter.
+ *        It is called by the HCI transport layer during hci_transport_init().
+ *
+ * @param forward_cb Callback used to forward batched events to the transport driver.
+ *
+ * @return int    Returns 0 on success, or a non-zero error code on failure.
+ */
+int hci_adv_dedup_init(hci_adv_dedup_forward_fn *forward_cb);
+
+/**
+ * @brief Deinitialize the filter, flushing any held advertising report events.
+ */
+void hci_adv_dedup_deinit(void);
+
+/**
+ * @brief Examine a controller-to-host HCI event before it is forwarded.
+ *
+ * @param hci_ev Event buffer as handed out by the controller.
+ *
+ * @return int  Returns 1 when the caller shall forward the event as usual;
+ *              0 when the filter consumed the event (suppressed it as a
+ *              duplicate or held it back for a batched delivery).
+ */
+int hci_adv_dedup_intercept(uint8_t *hci_ev);
+
+/**
+ * @brief Get a snapshot of the filter counters.
+ * @param stats Filled with the current counter values.
+ */
+void esp_hci_adv_dedup_get_stats(esp_hci_adv_dedup_stats_t *stats);
+
+/**
+ * @brief Reset the filter counters and forget all tracked advertiser addresses.
+ */
+void esp_hci_adv_dedup_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* H_ESP_HCI_ADV_DEDUP_ */
@@ -0,0 +1,268 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_hci_transport.h"
+#include "esp_hci_internal.h"
+#include "esp_hci_adv_dedup.h"
+
+/* Event parsing offsets. Advertising reports arrive as LE Meta events; the
+ * controller reports one advertisement per event, so suppression works on
+ * whole events. Multi-report events (possible per spec) are forwarded
+ * unfiltered when any contained report is fresh. */
+#define HCI_EVT_CODE_LE_META            (0x3E)
+#define HCI_LE_SUBEV_ADV_RPT            (0x02)
+#define HCI_LE_SUBEV_EXT_ADV_RPT        (0x0D)
+#define HCI_RSSI_NOT_AVAILABLE          (127)
+
+#define ADV_DEDUP_CACHE_SIZE            CONFIG_BT_LE_ADV_REPORT_DEDUP_CACHE_SIZE
+#define ADV_DEDUP_WINDOW_MS             CONFIG_BT_LE_ADV_REPORT_DEDUP_WINDOW_MS
+#define ADV_DEDUP_RSSI_DELTA            CONFIG_BT_LE_ADV_REPORT_DEDUP_RSSI_DELTA
+#define ADV_DEDUP_BATCH_COUNT           CONFIG_BT_LE_ADV_REPORT_DEDUP_BATCH_COUNT
+#define ADV_DEDUP_BATCH_FLUSH_MS        CONFIG_BT_LE_ADV_REPORT_DEDUP_BATCH_FLUSH_MS
+
+typedef struct {
+    uint8_t addr[6];
+    uint8_t addr_type;
+    int8_t rssi;
+    uint32_t last_ms;
+    bool in_use;
+} adv_dedup_entry_t;
+
+typedef struct {
+    adv_dedup_entry_t entries[ADV_DEDUP_CACHE_SIZE];
+    uint16_t evict_idx;
+    hci_adv_dedup_forward_fn *forward_cb;
+    SemaphoreHandle_t lock;
+#if ADV_DEDUP_BATCH_COUNT > 0
+    esp_timer_handle_t flush_timer;
+    uint8_t *held_evts[ADV_DEDUP_BATCH_COUNT];
+    uint8_t held_cnt;
+#endif
+    esp_hci_adv_dedup_stats_t stats;
+} hci_adv_dedup_env_t;
+
+static hci_adv_dedup_env_t s_adv_dedup_env;
+
+/* Extract address type, address and RSSI from a single-report advertising
+ * report event. Returns 0 on a parsable single report, -1 otherwise. */
+static int
+hci_adv_dedup_parse_report(const uint8_t *hci_ev, uint8_t *addr_type, const uint8_t **addr, int8_t *rssi)
+{
+    uint8_t param_len = hci_ev[1];
+    uint8_t subevt = hci_ev[2];
+    uint8_t num_reports = hci_ev[3];
+
+    if (num_reports != 1) {
+        return -1;
+    }
+
+    if (subevt == HCI_LE_SUBEV_ADV_RPT) {
+        /* event_type(1), addr_type(1), addr(6), data_len(1), data, rssi(1) */
+        if (param_len < 12) {
+            return -1;
+        }
+        uint8_t data_len = hci_ev[12];
+        if (param_len < 12 + data_len) {
+            return -1;
+        }
+        *addr_type = hci_ev[5];
+        *addr = &hci_ev[6];
+        *rssi = (int8_t)hci_ev[13 + data_len];
+    } else {
+        /* evt_type(2), addr_type(1), addr(6), phys(2), sid(1), tx_power(1),
+         * rssi(1), periodic_itvl(2), direct_addr_type(1), direct_addr(6),
+         * data_len(1), data */
+        if (param_len < 26) {
+            return -1;
+        }
+        *addr_type = hci_ev[6];
+        *addr = &hci_ev[7];
+        *rssi = (int8_t)hci_ev[17];
+    }
+    return 0;
+}
+
+/* Decide whether a report is a duplicate. Updates the tracking entry either
+ * way, so a forwarded report restarts its suppression window. */
+static bool
+hci_adv_dedup_is_duplicate(uint8_t addr_type, const uint8_t *addr, int8_t rssi)
+{
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    adv_dedup_entry_t *entry = NULL;
+
+    for (int i = 0; i < ADV_DEDUP_CACHE_SIZE; i++) {
+        if (s_adv_dedup_env.entries[i].in_use &&
+                s_adv_dedup_env.entries[i].addr_type == addr_type &&
+                memcmp(s_adv_dedup_env.entries[i].addr, addr, 6) == 0) {
+            entry = &s_adv_dedup_env.entries[i];
+            break;
+        }
+    }
+
+    if (!entry) {
+        entry = &s_adv_dedup_env.entries[s_adv_dedup_env.evict_idx];
+        s_adv_dedup_env.evict_idx = (s_adv_dedup_env.evict_idx + 1) % ADV_DEDUP_CACHE_SIZE;
+        entry->in_use = true;
+        entry->addr_type = addr_type;
+        memcpy(entry->addr, addr, 6);
+        entry->rssi = rssi;
+        entry->last_ms = now_ms;
+        return false;
+    }
+
+    bool in_window = (now_ms - entry->last_ms) < ADV_DEDUP_WINDOW_MS;
+    bool rssi_moved = (rssi != HCI_RSSI_NOT_AVAILABLE) && (entry->rssi != HCI_RSSI_NOT_AVAILABLE) &&
+                      (rssi > entry->rssi ? rssi - entry->rssi : entry->rssi - rssi) >= ADV_DEDUP_RSSI_DELTA;
+    if (in_window && !rssi_moved) {
+        return true;
+    }
+
+    entry->rssi = rssi;
+    entry->last_ms = now_ms;
+    return false;
+}
+
+#if ADV_DEDUP_BATCH_COUNT > 0
+/* Forward all held events back-to-back so the host transport wakes once per
+ * batch instead of once per advertisement. Called with the lock held. */
+static void
+hci_adv_dedup_flush_locked(void)
+{
+    esp_timer_stop(s_adv_dedup_env.flush_timer);
+    if (s_adv_dedup_env.held_cnt == 0) {
+        return;
+    }
+    for (int i = 0; i < s_adv_dedup_env.held_cnt; i++) {
+        s_adv_dedup_env.forward_cb(s_adv_dedup_env.held_evts[i]);
+    }
+    s_adv_dedup_env.held_cnt = 0;
+    s_adv_dedup_env.stats.batch_flushes++;
+}
+
+static void
+hci_adv_dedup_flush_timer_cb(void *arg)
+{
+    xSemaphoreTake(s_adv_dedup_env.lock, portMAX_DELAY);
+    hci_adv_dedup_flush_locked();
+    xSemaphoreGive(s_adv_dedup_env.lock);
+}
+#endif /* ADV_DEDUP_BATCH_COUNT > 0 */
+
+int
+hci_adv_dedup_intercept(uint8_t *hci_ev)
+{
+    uint8_t addr_type;
+    const uint8_t *addr;
+    int8_t rssi;
+
+    if (hci_ev[0] != HCI_EVT_CODE_LE_META || hci_ev[1] < 2 ||
+            (hci_ev[2] != HCI_LE_SUBEV_ADV_RPT && hci_ev[2] != HCI_LE_SUBEV_EXT_ADV_RPT)) {
+#if ADV_DEDUP_BATCH_COUNT > 0
+        /* Deliver held reports first so other events cannot overtake them;
+         * the host must not see e.g. a scan-disable completion before
+         * reports that preceded it. */
+        xSemaphoreTake(s_adv_dedup_env.lock, portMAX_DELAY);
+        hci_adv_dedup_flush_locked();
+        xSemaphoreGive(s_adv_dedup_env.lock);
+#endif
+        return 1;
+    }
+
+    if (hci_adv_dedup_parse_report(hci_ev, &addr_type, &addr, &rssi) != 0) {
+        return 1;
+    }
+
+    xSemaphoreTake(s_adv_dedup_env.lock, portMAX_DELAY);
+    s_adv_dedup_env.stats.reports_seen++;
+
+    if (hci_adv_dedup_is_duplicate(addr_type, addr, rssi)) {
+        s_adv_dedup_env.stats.reports_suppressed++;
+        xSemaphoreGive(s_adv_dedup_env.lock);
+        r_ble_hci_trans_buf_free(hci_ev);
+        return 0;
+    }
+
+#if ADV_DEDUP_BATCH_COUNT > 0
+    s_adv_dedup_env.held_evts[s_adv_dedup_env.held_cnt++] = hci_ev;
+    s_adv_dedup_env.stats.reports_batched++;
+    if (s_adv_dedup_env.held_cnt == ADV_DEDUP_BATCH_COUNT) {
+        hci_adv_dedup_flush_locked();
+    } else if (s_adv_dedup_env.held_cnt == 1) {
+        esp_timer_start_once(s_adv_dedup_env.flush_timer, ADV_DEDUP_BATCH_FLUSH_MS * 1000);
+    }
+    xSemaphoreGive(s_adv_dedup_env.lock);
+    return 0;
+#else
+    xSemaphoreGive(s_adv_dedup_env.lock);
+    return 1;
+#endif
+}
+
+void
+esp_hci_adv_dedup_get_stats(esp_hci_adv_dedup_stats_t *stats)
+{
+    if (!stats || !s_adv_dedup_env.lock) {
+        return;
+    }
+    xSemaphoreTake(s_adv_dedup_env.lock, portMAX_DELAY);
+    *stats = s_adv_dedup_env.stats;
+    xSemaphoreGive(s_adv_dedup_env.lock);
+}
+
+void
+esp_hci_adv_dedup_reset(void)
+{
+    if (!s_adv_dedup_env.lock) {
+        return;
+    }
+    xSemaphoreTake(s_adv_dedup_env.lock, portMAX_DELAY);
+    memset(s_adv_dedup_env.entries, 0, sizeof(s_adv_dedup_env.entries));
+    s_adv_dedup_env.evict_idx = 0;
+    memset(&s_adv_dedup_env.stats, 0, sizeof(s_adv_dedup_env.stats));
+    xSemaphoreGive(s_adv_dedup_env.lock);
+}
+
+int
+hci_adv_dedup_init(hci_adv_dedup_forward_fn *forward_cb)
+{
+    memset(&s_adv_dedup_env, 0, sizeof(hci_adv_dedup_env_t));
+    s_adv_dedup_env.forward_cb = forward_cb;
+    s_adv_dedup_env.lock = xSemaphoreCreateMutex();
+    if (!s_adv_dedup_env.lock) {
+        return -1;
+    }
+#if ADV_DEDUP_BATCH_COUNT > 0
+    esp_timer_create_args_t timer_args = {
+        .callback = hci_adv_dedup_flush_timer_cb,
+        .name = "hci_adv_dedup",
+    };
+    if (esp_timer_create(&timer_args, &s_adv_dedup_env.flush_timer) != ESP_OK) {
+        vSemaphoreDelete(s_adv_dedup_env.lock);
+        s_adv_dedup_env.lock = NULL;
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+void
+hci_adv_dedup_deinit(void)
+{
+    if (!s_adv_dedup_env.lock) {
+        return;
+    }
+#if ADV_DEDUP_BATCH_COUNT > 0
+    xSemaphoreTake(s_adv_dedup_env.lock, portMAX_DELAY);
+    hci_adv_dedup_flush_locked();
+    xSemaphoreGive(s_adv_dedup_env.lock);
+    esp_timer_delete(s_adv_dedup_env.flush_timer);
+#endif
+    vSemaphoreDelete(s_adv_dedup_env.lock);
+    memset(&s_adv_dedup_env, 0, sizeof(hci_adv_dedup_env_t));
+}
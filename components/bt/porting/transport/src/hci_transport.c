@@ -9,6 +9,9 @@
 #include "esp_hci_transport.h"
 #include "esp_hci_internal.h"
 #include "esp_bt.h"
+#if CONFIG_BT_LE_ADV_REPORT_DEDUP
+#include "esp_hci_adv_dedup.h"
+#endif
 
 typedef struct hci_transport_env
 {
@@ -68,6 +71,16 @@ hci_transport_controller_tx_dummy(void *data, void *arg)
     return -1;
 }
 
+#if CONFIG_BT_LE_ADV_REPORT_DEDUP
+static int
+hci_transport_adv_dedup_forward(uint8_t *hci_ev)
+{
+    uint32_t len = hci_ev[1] + 2;
+    return s_hci_transport_env.driver_ops->hci_driver_tx(HCI_DRIVER_TYPE_EVT, hci_ev, len,
+                                                         HCI_DRIVER_DIR_C2H);
+}
+#endif // CONFIG_BT_LE_ADV_REPORT_DEDUP
+
 static int
 hci_transport_controller_evt_tx(uint8_t *hci_ev, void *arg)
 {
@@ -78,6 +91,13 @@ hci_transport_controller_evt_tx(uint8_t *hci_ev, void *arg)
         return -1;
     }
 
+#if CONFIG_BT_LE_ADV_REPORT_DEDUP
+    if (hci_adv_dedup_intercept(hci_ev) == 0) {
+        /* Suppressed as a duplicate or held back for a batched delivery. */
+        return 0;
+    }
+#endif // CONFIG_BT_LE_ADV_REPORT_DEDUP
+
     len = hci_ev[1] + 2;
     return s_hci_transport_env.driver_ops->hci_driver_tx(HCI_DRIVER_TYPE_EVT, hci_ev, len,
                                                          HCI_DRIVER_DIR_C2H);
@@ -154,6 +174,14 @@ hci_transport_init(uint8_t hci_transport_mode)
     }
 
     s_hci_transport_env.driver_ops = ops;
+
+#if CONFIG_BT_LE_ADV_REPORT_DEDUP
+    rc = hci_adv_dedup_init(hci_transport_adv_dedup_forward);
+    if (rc) {
+        goto error;
+    }
+#endif // CONFIG_BT_LE_ADV_REPORT_DEDUP
+
     r_ble_hci_trans_cfg_hs(hci_transport_controller_evt_tx, NULL, hci_transport_controller_acl_tx, NULL);
 
     return 0;
@@ -171,6 +199,10 @@ hci_transport_deinit(void)
     r_ble_hci_trans_cfg_hs((esp_hci_internal_rx_cmd_fn *)hci_transport_controller_tx_dummy, NULL,
                            (esp_hci_internal_rx_acl_fn *)hci_transport_controller_tx_dummy, NULL);
 
+#if CONFIG_BT_LE_ADV_REPORT_DEDUP
+    hci_adv_dedup_deinit();
+#endif // CONFIG_BT_LE_ADV_REPORT_DEDUP
+
     ops = s_hci_transport_env.driver_ops;
     if (ops) {
         ops->hci_driver_deinit();
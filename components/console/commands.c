@@ -56,6 +56,63 @@ static const cmd_item_t *find_command_by_name(const char *name);
 
 static esp_console_help_verbose_level_e s_verbose_level = ESP_CONSOLE_HELP_VERBOSE_LEVEL_1;
 
+#if CONFIG_CONSOLE_CMD_SORTED_INDEX
+/** sorted array of pointers into s_cmd_list, used for binary-search lookup */
+static cmd_item_t **s_cmd_index;
+static size_t s_cmd_index_count;
+static size_t s_cmd_index_cap;
+
+/* Index of the first entry whose command name compares greater than or equal
+ * to the first `len` characters of `name`. Passing strlen(name) + 1 as `len`
+ * makes the comparison exact; a shorter `len` locates the start of a prefix
+ * range. The returned index doubles as the insertion point.
+ */
+static size_t cmd_index_lower_bound(const char *name, size_t len)
+{
+    size_t lo = 0;
+    size_t hi = s_cmd_index_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (strncmp(s_cmd_index[mid]->command, name, len) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static esp_err_t cmd_index_insert(cmd_item_t *item)
+{
+    if (s_cmd_index_count == s_cmd_index_cap) {
+        size_t new_cap = s_cmd_index_cap + 8;
+        cmd_item_t **new_index = heap_caps_realloc(s_cmd_index, new_cap * sizeof(*new_index),
+                                                   s_config.heap_alloc_caps);
+        if (new_index == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        s_cmd_index = new_index;
+        s_cmd_index_cap = new_cap;
+    }
+    size_t pos = cmd_index_lower_bound(item->command, strlen(item->command) + 1);
+    memmove(&s_cmd_index[pos + 1], &s_cmd_index[pos],
+            (s_cmd_index_count - pos) * sizeof(*s_cmd_index));
+    s_cmd_index[pos] = item;
+    s_cmd_index_count++;
+    return ESP_OK;
+}
+
+static void cmd_index_remove(const cmd_item_t *item)
+{
+    size_t pos = cmd_index_lower_bound(item->command, strlen(item->command) + 1);
+    if (pos < s_cmd_index_count && s_cmd_index[pos] == item) {
+        memmove(&s_cmd_index[pos], &s_cmd_index[pos + 1],
+                (s_cmd_index_count - pos - 1) * sizeof(*s_cmd_index));
+        s_cmd_index_count--;
+    }
+}
+#endif // CONFIG_CONSOLE_CMD_SORTED_INDEX
+
 esp_err_t esp_console_init(const esp_console_config_t *config)
 {
     if (!config) {
@@ -91,11 +148,20 @@ esp_err_t esp_console_deinit(void)
         free(it->hint);
         free(it);
     }
+#if CONFIG_CONSOLE_CMD_SORTED_INDEX
+    free(s_cmd_index);
+    s_cmd_index = NULL;
+    s_cmd_index_count = 0;
+    s_cmd_index_cap = 0;
+#endif
     return ESP_OK;
 }
 
 void esp_console_rm_item_free_hint(cmd_item_t *item)
 {
+#if CONFIG_CONSOLE_CMD_SORTED_INDEX
+    cmd_index_remove(item);
+#endif
     SLIST_REMOVE(&s_cmd_list, item, cmd_item_, next);
     free(item->hint);
 }
@@ -160,6 +226,14 @@ esp_err_t esp_console_cmd_register(const esp_console_cmd_t *cmd)
         item->context = cmd->context;
     }
 
+#if CONFIG_CONSOLE_CMD_SORTED_INDEX
+    if (cmd_index_insert(item) != ESP_OK) {
+        free(item->hint);
+        heap_caps_free(item);
+        return ESP_ERR_NO_MEM;
+    }
+#endif
+
     cmd_item_t *last;
     cmd_item_t *it;
 #if CONFIG_CONSOLE_SORTED_HELP
@@ -192,6 +266,15 @@ void esp_console_get_completion(const char *buf, linenoiseCompletions *lc)
     if (len == 0) {
         return;
     }
+#if CONFIG_CONSOLE_CMD_SORTED_INDEX
+    for (size_t pos = cmd_index_lower_bound(buf, len); pos < s_cmd_index_count; pos++) {
+        /* The index is sorted, so all commands starting with buf are contiguous */
+        if (strncmp(buf, s_cmd_index[pos]->command, len) != 0) {
+            break;
+        }
+        linenoiseAddCompletion(lc, s_cmd_index[pos]->command);
+    }
+#else
     cmd_item_t *it;
     SLIST_FOREACH(it, &s_cmd_list, next) {
         /* Check if command starts with buf */
@@ -199,10 +282,19 @@ void esp_console_get_completion(const char *buf, linenoiseCompletions *lc)
             linenoiseAddCompletion(lc, it->command);
         }
     }
+#endif
 }
 
 const char *esp_console_get_hint(const char *buf, int *color, int *bold)
 {
+#if CONFIG_CONSOLE_CMD_SORTED_INDEX
+    const cmd_item_t *cmd = find_command_by_name(buf);
+    if (cmd != NULL) {
+        *color = s_config.hint_color;
+        *bold = s_config.hint_bold;
+        return cmd->hint;
+    }
+#else
     size_t len = strlen(buf);
     cmd_item_t *it;
     SLIST_FOREACH(it, &s_cmd_list, next) {
@@ -213,12 +305,19 @@ const char *esp_console_get_hint(const char *buf, int *color, int *bold)
             return it->hint;
         }
     }
+#endif
     return NULL;
 }
 
 static const cmd_item_t *find_command_by_name(const char *name)
 {
     const cmd_item_t *cmd = NULL;
+#if CONFIG_CONSOLE_CMD_SORTED_INDEX
+    size_t pos = cmd_index_lower_bound(name, strlen(name) + 1);
+    if (pos < s_cmd_index_count && strcmp(name, s_cmd_index[pos]->command) == 0) {
+        cmd = s_cmd_index[pos];
+    }
+#else
     cmd_item_t *it;
     size_t len = strlen(name);
     SLIST_FOREACH(it, &s_cmd_list, next) {
@@ -228,6 +327,7 @@ static const cmd_item_t *find_command_by_name(const char *name)
             break;
         }
     }
+#endif
     return cmd;
 }
 
@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <new>
+#include <cassert>
+#include "esp_err.h"
+
+/**
+ * @file esp_expected.hpp
+ * @brief Lightweight error transport for C++ code built without exceptions
+ *
+ * esp::expected<T, E> holds either a value of type T or an error of type E
+ * (esp_err_t by default) in-place, without heap allocation, RTTI or unwind
+ * tables. It is a small subset of std::expected (C++23) which compiles under
+ * -fno-exceptions: accessing the wrong alternative is a programming error
+ * checked with assert() instead of a throw.
+ *
+ * Typical use:
+ * @code
+ * esp::expected<uint32_t> read_counter()
+ * {
+ *     uint32_t value;
+ *     esp_err_t err = nvs_get_u32(handle, "counter", &value);
+ *     if (err != ESP_OK) {
+ *         return esp::unexpected<>(err);
+ *     }
+ *     return value;
+ * }
+ * @endcode
+ */
+
+namespace esp {
+
+/**
+ * @brief Wrapper marking a value as the error alternative of esp::expected
+ */
+template <typename E = esp_err_t>
+class unexpected {
+public:
+    explicit constexpr unexpected(E error) : m_error(std::move(error)) {}
+
+    constexpr const E &error() const & { return m_error; }
+    constexpr E &error() & { return m_error; }
+    constexpr E &&error() && { return std::move(m_error); }
+
+private:
+    E m_error;
+};
+
+/**
+ * @brief Holds either a value of type T or an error of type E, in-place
+ */
+template <typename T, typename E = esp_err_t>
+class expected {
+    static_assert(!std::is_reference<T>::value, "expected cannot hold a reference");
+    static_assert(!std::is_same<T, void>::value, "use expected<void, E> specialization");
+
+public:
+    using value_type = T;
+    using error_type = E;
+
+    expected(const T &value) : m_has_value(true)
+    {
+        new (&m_storage.value) T(value);
+    }
+
+    expected(T &&value) : m_has_value(true)
+    {
+        new (&m_storage.value) T(std::move(value));
+    }
+
+    expected(unexpected<E> unexp) : m_has_value(false)
+    {
+        new (&m_storage.error) E(std::move(unexp).error());
+    }
+
+    expected(const expected &other) : m_has_value(other.m_has_value)
+    {
+        if (m_has_value) {
+            new (&m_storage.value) T(other.m_storage.value);
+        } else {
+            new (&m_storage.error) E(other.m_storage.error);
+        }
+    }
+
+    expected(expected &&other) : m_has_value(other.m_has_value)
+    {
+        if (m_has_value) {
+            new (&m_storage.value) T(std::move(other.m_storage.value));
+        } else {
+            new (&m_storage.error) E(std::move(other.m_storage.error));
+        }
+    }
+
+    expected &operator=(const expected &other)
+    {
+        if (this != &other) {
+            destroy();
+            m_has_value = other.m_has_value;
+            if (m_has_value) {
+                new (&m_storage.value) T(other.m_storage.value);
+            } else {
+                new (&m_storage.error) E(other.m_storage.error);
+            }
+        }
+        return *this;
+    }
+
+    expected &operator=(expected &&other)
+    {
+        if (this != &other) {
+            destroy();
+            m_has_value = other.m_has_value;
+            if (m_has_value) {
+                new (&m_storage.value) T(std::move(other.m_storage.value));
+            } else {
+                new (&m_storage.error) E(std::move(other.m_storage.error));
+            }
+        }
+        return *this;
+    }
+
+    ~expected()
+    {
+        destroy();
+    }
+
+    constexpr bool has_value() const { return m_has_value; }
+    constexpr explicit operator bool() const { return m_has_value; }
+
+    /// Access the contained value; the caller must have checked has_value()
+    T &value() &
+    {
+        assert(m_has_value);
+        return m_storage.value;
+    }
+
+    const T &value() const &
+    {
+        assert(m_has_value);
+        return m_storage.value;
+    }
+
+    T &&value() &&
+    {
+        assert(m_has_value);
+        return std::move(m_storage.value);
+    }
+
+    T &operator*() & { return value(); }
+    const T &operator*() const & { return value(); }
+    T &&operator*() && { return std::move(*this).value(); }
+
+    T *operator->() { return &value(); }
+    const T *operator->() const { return &value(); }
+
+    /// Access the contained error; the caller must have checked !has_value()
+    E &error() &
+    {
+        assert(!m_has_value);
+        return m_storage.error;
+    }
+
+    const E &error() const &
+    {
+        assert(!m_has_value);
+        return m_storage.error;
+    }
+
+    /// The contained value, or `fallback` when an error is held
+    template <typename U>
+    T value_or(U &&fallback) const &
+    {
+        return m_has_value ? m_storage.value : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    template <typename U>
+    T value_or(U &&fallback) &&
+    {
+        return m_has_value ? std::move(m_storage.value) : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    /// The contained error, or `fallback` (ESP_OK by default) when a value is held
+    E error_or(E fallback = static_cast<E>(0)) const
+    {
+        return m_has_value ? fallback : m_storage.error;
+    }
+
+private:
+    void destroy()
+    {
+        if (m_has_value) {
+            m_storage.value.~T();
+        } else {
+            m_storage.error.~E();
+        }
+    }
+
+    union storage_t {
+        storage_t() {} // NOLINT: active member is constructed by expected
+        ~storage_t() {}
+        T value;
+        E error;
+    } m_storage;
+    bool m_has_value;
+};
+
+/**
+ * @brief Specialization for operations which produce no value, only success or an error
+ */
+template <typename E>
+class expected<void, E> {
+public:
+    using value_type = void;
+    using error_type = E;
+
+    constexpr expected() : m_error(), m_has_value(true) {}
+
+    constexpr expected(unexpected<E> unexp) : m_error(std::move(unexp).error()), m_has_value(false) {}
+
+    constexpr bool has_value() const { return m_has_value; }
+    constexpr explicit operator bool() const { return m_has_value; }
+
+    const E &error() const
+    {
+        assert(!m_has_value);
+        return m_error;
+    }
+
+    E error_or(E fallback = static_cast<E>(0)) const
+    {
+        return m_has_value ? fallback : m_error;
+    }
+
+private:
+    E m_error;
+    bool m_has_value;
+};
+
+} // namespace esp
@@ -158,6 +158,16 @@ void esp_efuse_utility_reset(void);
  */
 void esp_efuse_utility_update_virt_blocks(void);
 
+/**
+ * @brief   Fills the RAM shadow cache by values from the eFuse read registers.
+ *
+ * Takes a single pass over all blocks; afterwards every read API call is served
+ * from RAM. A no-op unless CONFIG_EFUSE_RAM_SHADOW_CACHE is enabled. It is
+ * called at startup and after every burn; call it manually only after
+ * programming eFuses outside of the esp_efuse API.
+ */
+void esp_efuse_utility_update_shadow_cache(void);
+
 /**
  * @brief   Prints efuse values for all registers.
  */
@@ -35,6 +35,10 @@ ESP_LOG_ATTR_TAG(TAG, "efuse_init");
 
 ESP_SYSTEM_INIT_FN(init_efuse_check, CORE, BIT(0), 1)
 {
+#ifdef CONFIG_EFUSE_RAM_SHADOW_CACHE
+    // One controller pass into the RAM image; all later eFuse reads are served from it.
+    esp_efuse_utility_update_shadow_cache();
+#endif
     // (Only for C3): We check if the efuse BLOCK0 has certain coding errors then reset the chip.
     if (esp_efuse_check_errors() != ESP_OK) {
         esp_restart();
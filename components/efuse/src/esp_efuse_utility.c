@@ -25,6 +25,12 @@ static volatile unsigned s_burn_counter = 0;
 uint32_t virt_blocks[EFUSE_BLK_MAX][COUNT_EFUSE_REG_PER_BLOCK];
 #endif // CONFIG_EFUSE_VIRTUAL
 
+// RAM image of the eFuse read registers, filled with one pass at startup.
+#ifdef CONFIG_EFUSE_RAM_SHADOW_CACHE
+static uint32_t s_shadow_blocks[EFUSE_BLK_MAX][COUNT_EFUSE_REG_PER_BLOCK];
+static volatile bool s_shadow_valid = false;
+#endif // CONFIG_EFUSE_RAM_SHADOW_CACHE
+
 extern const esp_efuse_range_addr_t range_read_addr_blocks[];
 extern const esp_efuse_range_addr_t range_write_addr_blocks[];
 
@@ -180,6 +186,8 @@ esp_err_t esp_efuse_utility_burn_efuses(void)
     esp_efuse_utility_debug_dump_pending();
 #endif
     esp_err_t err = esp_efuse_utility_burn_chip();
+    // The burn has changed the read registers, take a fresh pass into the shadow cache.
+    esp_efuse_utility_update_shadow_cache();
     ++s_burn_counter;
     return err;
 }
@@ -221,6 +229,20 @@ void esp_efuse_utility_update_virt_blocks(void)
 #endif
 }
 
+// Fills the shadow cache with one pass over the eFuse read registers.
+void esp_efuse_utility_update_shadow_cache(void)
+{
+#ifdef CONFIG_EFUSE_RAM_SHADOW_CACHE
+    for (int num_block = EFUSE_BLK0; num_block < EFUSE_BLK_MAX; num_block++) {
+        int subblock = 0;
+        for (uintptr_t addr_rd_block = range_read_addr_blocks[num_block].start; addr_rd_block <= range_read_addr_blocks[num_block].end; addr_rd_block += 4) {
+            s_shadow_blocks[num_block][subblock++] = REG_READ(addr_rd_block);
+        }
+    }
+    s_shadow_valid = true;
+#endif // CONFIG_EFUSE_RAM_SHADOW_CACHE
+}
+
 // Prints efuse values for a single block
 void esp_efuse_utility_debug_dump_single_block(int num_block, bool from_read)
 {
@@ -281,6 +303,9 @@ uint32_t esp_efuse_utility_read_reg(esp_efuse_block_t blk, unsigned int num_reg)
     uint32_t value;
 #ifdef CONFIG_EFUSE_VIRTUAL
     value = virt_blocks[blk][num_reg];
+#elif defined(CONFIG_EFUSE_RAM_SHADOW_CACHE)
+    // Reads before the cache is filled (early startup) go to the registers.
+    value = s_shadow_valid ? s_shadow_blocks[blk][num_reg] : REG_READ(range_read_addr_blocks[blk].start + num_reg * 4);
 #else
     value = REG_READ(range_read_addr_blocks[blk].start + num_reg * 4);
 #endif
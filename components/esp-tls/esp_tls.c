@@ -71,6 +71,8 @@ static const char *TAG = "esp-tls";
 #define _esp_tls_net_init                   esp_mbedtls_net_init
 #define _esp_tls_get_client_session         esp_mbedtls_get_client_session
 #define _esp_tls_free_client_session        esp_mbedtls_free_client_session
+#define _esp_tls_serialize_client_session   esp_mbedtls_serialize_client_session
+#define _esp_tls_deserialize_client_session esp_mbedtls_deserialize_client_session
 #define _esp_tls_get_ssl_context            esp_mbedtls_get_ssl_context
 #define _esp_tls_server_session_create      esp_mbedtls_server_session_create
 #define _esp_tls_server_session_init        esp_mbedtls_server_session_init
@@ -78,6 +80,8 @@ static const char *TAG = "esp-tls";
 #define _esp_tls_server_session_delete      esp_mbedtls_server_session_delete
 #define _esp_tls_server_session_ticket_ctx_init    esp_mbedtls_server_session_ticket_ctx_init
 #define _esp_tls_server_session_ticket_ctx_free    esp_mbedtls_server_session_ticket_ctx_free
+#define _esp_tls_server_session_cache_ctx_init     esp_mbedtls_server_session_cache_ctx_init
+#define _esp_tls_server_session_cache_ctx_free     esp_mbedtls_server_session_cache_ctx_free
 #define _esp_tls_get_bytes_avail            esp_mbedtls_get_bytes_avail
 #define _esp_tls_init_global_ca_store       esp_mbedtls_init_global_ca_store
 #define _esp_tls_set_global_ca_store        esp_mbedtls_set_global_ca_store                 /*!< Callback function for setting global CA store data for TLS/SSL */
@@ -672,6 +676,16 @@ void esp_tls_free_client_session(esp_tls_client_session_t *client_session)
 {
     _esp_tls_free_client_session(client_session);
 }
+
+esp_err_t esp_tls_serialize_client_session(esp_tls_client_session_t *client_session, uint8_t *buffer, size_t buffer_len, size_t *out_len)
+{
+    return _esp_tls_serialize_client_session(client_session, buffer, buffer_len, out_len);
+}
+
+esp_tls_client_session_t *esp_tls_deserialize_client_session(const uint8_t *buffer, size_t buffer_len)
+{
+    return _esp_tls_deserialize_client_session(buffer, buffer_len);
+}
 #endif /* CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS */
 
 
@@ -704,6 +718,38 @@ void esp_tls_cfg_server_session_tickets_free(esp_tls_cfg_server_t *cfg)
 #endif
 }
 
+esp_err_t esp_tls_cfg_server_session_cache_init(esp_tls_cfg_server_t *cfg)
+{
+#if defined(CONFIG_ESP_TLS_SERVER_SESSION_CACHE)
+    if (!cfg || cfg->cache_ctx) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    cfg->cache_ctx = calloc(1, sizeof(esp_tls_server_session_cache_ctx_t));
+    if (!cfg->cache_ctx) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret =  _esp_tls_server_session_cache_ctx_init(cfg->cache_ctx);
+    if (ret != ESP_OK) {
+        free(cfg->cache_ctx);
+        cfg->cache_ctx = NULL;
+    }
+    return ret;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+void esp_tls_cfg_server_session_cache_free(esp_tls_cfg_server_t *cfg)
+{
+#if defined(CONFIG_ESP_TLS_SERVER_SESSION_CACHE)
+    if (cfg && cfg->cache_ctx) {
+        _esp_tls_server_session_cache_ctx_free(cfg->cache_ctx);
+        free(cfg->cache_ctx);
+        cfg->cache_ctx = NULL;
+    }
+#endif
+}
+
 /**
  * @brief      Create a server side TLS/SSL connection
  */
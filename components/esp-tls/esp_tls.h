@@ -16,6 +16,9 @@
 #ifdef CONFIG_ESP_TLS_SERVER_SESSION_TICKETS
 #include "mbedtls/ssl_ticket.h"
 #endif
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_CACHE
+#include "mbedtls/ssl_cache.h"
+#endif
 #elif CONFIG_ESP_TLS_USING_WOLFSSL
 #include "wolfssl/wolfcrypt/settings.h"
 #include "wolfssl/ssl.h"
@@ -248,6 +251,15 @@ typedef struct esp_tls_server_session_ticket_ctx {
 } esp_tls_server_session_ticket_ctx_t;
 #endif
 
+#if defined(CONFIG_ESP_TLS_SERVER_SESSION_CACHE)
+/**
+ * @brief Data structures necessary to support server-side session resumption based on session IDs
+ */
+typedef struct esp_tls_server_session_cache_ctx {
+    mbedtls_ssl_cache_context cache_ctx;                                       /*!< Session cache context */
+} esp_tls_server_session_cache_ctx_t;
+#endif
+
 #if defined(CONFIG_ESP_TLS_SERVER_CERT_SELECT_HOOK)
 /**
  * @brief tls handshake callback
@@ -347,6 +359,14 @@ typedef struct esp_tls_cfg_server {
                                                     to free the data associated with this context. */
 #endif
 
+#if defined(CONFIG_ESP_TLS_SERVER_SESSION_CACHE)
+    esp_tls_server_session_cache_ctx_t * cache_ctx; /*!< Session cache context.
+                                                    You have to call esp_tls_cfg_server_session_cache_init
+                                                    to use it.
+                                                    Call esp_tls_cfg_server_session_cache_free
+                                                    to free the data associated with this context. */
+#endif
+
     void *userdata;                             /*!< User data to be added to the ssl context.
                                                   Can be retrieved by callbacks */
 #if defined(CONFIG_ESP_TLS_SERVER_CERT_SELECT_HOOK)
@@ -394,6 +414,30 @@ esp_err_t esp_tls_cfg_server_session_tickets_init(esp_tls_cfg_server_t *cfg);
  */
 void esp_tls_cfg_server_session_tickets_free(esp_tls_cfg_server_t *cfg);
 
+/**
+ * @brief Initialize the server side TLS session cache context
+ *
+ * This function initializes the server side tls session cache context
+ * which holds the session state of recently connected clients, enabling
+ * session resumption based on session IDs.
+ * Use esp_tls_cfg_server_session_cache_free to free the data.
+ *
+ * @param[in]  cfg server configuration as esp_tls_cfg_server_t
+ * @return
+ *             ESP_OK if setup succeeded
+ *             ESP_ERR_INVALID_ARG if context is already initialized
+ *             ESP_ERR_NO_MEM if memory allocation failed
+ *             ESP_ERR_NOT_SUPPORTED if the session cache is not available due to build configuration
+ */
+esp_err_t esp_tls_cfg_server_session_cache_init(esp_tls_cfg_server_t *cfg);
+
+/**
+ * @brief Free the server side TLS session cache context
+ *
+ * @param cfg server configuration as esp_tls_cfg_server_t
+ */
+void esp_tls_cfg_server_session_cache_free(esp_tls_cfg_server_t *cfg);
+
 typedef struct esp_tls esp_tls_t;
 
 /**
@@ -819,6 +863,44 @@ esp_tls_client_session_t *esp_tls_get_client_session(esp_tls_t *tls);
  *
  */
 void esp_tls_free_client_session(esp_tls_client_session_t *client_session);
+
+/**
+ * @brief Serialize a client session into a flat buffer
+ *
+ * The serialized form can be stored in any persistent medium (e.g. an NVS blob
+ * or RTC RAM) so that a session obtained with esp_tls_get_client_session() can
+ * be restored after a reboot or deep-sleep cycle, turning the next connection
+ * into an abbreviated handshake.
+ *
+ * Call with buffer set to NULL to query the required buffer size in out_len.
+ *
+ * @param[in]  client_session Client session obtained from esp_tls_get_client_session()
+ * @param[out] buffer         Destination buffer, or NULL for a size query
+ * @param[in]  buffer_len     Size of the destination buffer in bytes
+ * @param[out] out_len        Number of bytes written (or required, for a size query)
+ * @return
+ *             ESP_OK on success
+ *             ESP_ERR_INVALID_ARG  if client_session or out_len is NULL
+ *             ESP_ERR_INVALID_SIZE if the buffer is too small (required size in out_len)
+ *             ESP_FAIL on other serialization errors
+ */
+esp_err_t esp_tls_serialize_client_session(esp_tls_client_session_t *client_session, uint8_t *buffer, size_t buffer_len, size_t *out_len);
+
+/**
+ * @brief Recreate a client session from its serialized form
+ *
+ * The returned session can be passed in the client_session member of
+ * esp_tls_cfg_t to attempt session resumption, and must be freed with
+ * esp_tls_free_client_session().
+ *
+ * @param[in]  buffer     Buffer produced by esp_tls_serialize_client_session()
+ * @param[in]  buffer_len Length of the serialized data in bytes
+ * @return
+ *             Pointer to the restored client session.
+ *             NULL on Failure (e.g. corrupt data, or data saved by an
+ *             incompatible TLS library version)
+ */
+esp_tls_client_session_t *esp_tls_deserialize_client_session(const uint8_t *buffer, size_t buffer_len);
 #endif /* CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS */
 #ifdef __cplusplus
 }
@@ -254,6 +254,53 @@ void esp_mbedtls_free_client_session(esp_tls_client_session_t *client_session)
         free(client_session);
     }
 }
+
+esp_err_t esp_mbedtls_serialize_client_session(esp_tls_client_session_t *client_session, uint8_t *buffer, size_t buffer_len, size_t *out_len)
+{
+    if (client_session == NULL || out_len == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t olen = 0;
+    int ret = mbedtls_ssl_session_save(&(client_session->saved_session), buffer, (buffer != NULL) ? buffer_len : 0, &olen);
+    *out_len = olen;
+    if (buffer == NULL) {
+        /* Size query: mbedtls reports the required length in olen */
+        return ESP_OK;
+    }
+    if (ret == MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (ret != 0) {
+        ESP_LOGE(TAG, "Error in serializing the client ssl session");
+        mbedtls_print_error_msg(ret);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_tls_client_session_t *esp_mbedtls_deserialize_client_session(const uint8_t *buffer, size_t buffer_len)
+{
+    if (buffer == NULL || buffer_len == 0) {
+        return NULL;
+    }
+
+    esp_tls_client_session_t *client_session = calloc(1, sizeof(esp_tls_client_session_t));
+    if (client_session == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate memory for client session ctx");
+        return NULL;
+    }
+
+    int ret = mbedtls_ssl_session_load(&(client_session->saved_session), buffer, buffer_len);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "Error in loading the client ssl session");
+        mbedtls_print_error_msg(ret);
+        mbedtls_ssl_session_free(&(client_session->saved_session));
+        free(client_session);
+        return NULL;
+    }
+    return client_session;
+}
 #endif /* CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS */
 
 int esp_mbedtls_handshake(esp_tls_t *tls, const esp_tls_cfg_t *cfg)
@@ -713,6 +760,26 @@ void esp_mbedtls_server_session_ticket_ctx_free(esp_tls_server_session_ticket_ct
 }
 #endif
 
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_CACHE
+esp_err_t esp_mbedtls_server_session_cache_ctx_init(esp_tls_server_session_cache_ctx_t *ctx)
+{
+    if (!ctx) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    mbedtls_ssl_cache_init(&ctx->cache_ctx);
+    mbedtls_ssl_cache_set_timeout(&ctx->cache_ctx, CONFIG_ESP_TLS_SERVER_SESSION_CACHE_TIMEOUT);
+    mbedtls_ssl_cache_set_max_entries(&ctx->cache_ctx, CONFIG_ESP_TLS_SERVER_SESSION_CACHE_ENTRIES);
+    return ESP_OK;
+}
+
+void esp_mbedtls_server_session_cache_ctx_free(esp_tls_server_session_cache_ctx_t *ctx)
+{
+    if (ctx) {
+        mbedtls_ssl_cache_free(&ctx->cache_ctx);
+    }
+}
+#endif
+
 static esp_err_t set_server_config(esp_tls_cfg_server_t *cfg, esp_tls_t *tls)
 {
     assert(cfg != NULL);
@@ -859,6 +926,17 @@ static esp_err_t set_server_config(esp_tls_cfg_server_t *cfg, esp_tls_t *tls)
     }
 #endif
 
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_CACHE
+    if (cfg->cache_ctx) {
+        ESP_LOGD(TAG, "Enabling server-side tls session cache");
+
+        mbedtls_ssl_conf_session_cache( &tls->conf,
+                &cfg->cache_ctx->cache_ctx,
+                mbedtls_ssl_cache_get,
+                mbedtls_ssl_cache_set );
+    }
+#endif
+
     // Configure per-service TLS version
     const esp_tls_proto_ver_t tls_ver = cfg->tls_version;
     if (tls_ver == ESP_TLS_VER_TLS_1_3) {
@@ -104,6 +104,22 @@ esp_err_t esp_mbedtls_server_session_ticket_ctx_init(esp_tls_server_session_tick
 void esp_mbedtls_server_session_ticket_ctx_free(esp_tls_server_session_ticket_ctx_t *cfg);
 #endif
 
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_CACHE
+/**
+ * Internal function to setup server side session cache context
+ *
+ * /note :- The function can only be used with mbedtls ssl library
+ */
+esp_err_t esp_mbedtls_server_session_cache_ctx_init(esp_tls_server_session_cache_ctx_t *cfg);
+
+/**
+ * Internal function to free server side session cache context
+ *
+ * /note :- The function can only be used with mbedtls ssl library
+ */
+void esp_mbedtls_server_session_cache_ctx_free(esp_tls_server_session_cache_ctx_t *cfg);
+#endif
+
 /**
  * Internal Callback for set_client_config_function
  */
@@ -119,6 +135,16 @@ esp_tls_client_session_t *esp_mbedtls_get_client_session(esp_tls_t *tls);
  * Internal Callback for mbedtls_free_client_session
  */
 void esp_mbedtls_free_client_session(esp_tls_client_session_t *client_session);
+
+/**
+ * Internal Callback for mbedtls_serialize_client_session
+ */
+esp_err_t esp_mbedtls_serialize_client_session(esp_tls_client_session_t *client_session, uint8_t *buffer, size_t buffer_len, size_t *out_len);
+
+/**
+ * Internal Callback for mbedtls_deserialize_client_session
+ */
+esp_tls_client_session_t *esp_mbedtls_deserialize_client_session(const uint8_t *buffer, size_t buffer_len);
 #endif
 
 /**
@@ -83,7 +83,16 @@ static IRAM_ATTR bool adc_dma_intr(adc_continuous_ctx_t *adc_digi_ctx)
         }
 #endif
 
-        ret = xRingbufferSendFromISR(adc_digi_ctx->ringbuf_hdl, finished_buffer, finished_size, &taskAwoken);
+        if (adc_digi_ctx->flags.borrow_frames) {
+            //deliver the frame by reference, the data stays in the DMA buffer
+            adc_continuous_evt_data_t frame = {
+                .conv_frame_buffer = finished_buffer,
+                .size = finished_size,
+            };
+            ret = xQueueSendFromISR(adc_digi_ctx->frame_queue, &frame, &taskAwoken);
+        } else {
+            ret = xRingbufferSendFromISR(adc_digi_ctx->ringbuf_hdl, finished_buffer, finished_size, &taskAwoken);
+        }
         need_yield |= (taskAwoken == pdTRUE);
 
         if (adc_digi_ctx->cbs.on_conv_done) {
@@ -97,7 +106,20 @@ static IRAM_ATTR bool adc_dma_intr(adc_continuous_ctx_t *adc_digi_ctx)
         }
 
         if (ret == pdFALSE) {
-            if (adc_digi_ctx->flags.flush_pool) {
+            if (adc_digi_ctx->flags.borrow_frames) {
+                if (adc_digi_ctx->flags.flush_pool) {
+                    //drop the oldest undelivered frame, its memory is re-used by the DMA anyway
+                    adc_continuous_evt_data_t old_frame;
+                    if (xQueueReceiveFromISR(adc_digi_ctx->frame_queue, &old_frame, &taskAwoken) == pdTRUE) {
+                        adc_continuous_evt_data_t frame = {
+                            .conv_frame_buffer = finished_buffer,
+                            .size = finished_size,
+                        };
+                        xQueueSendFromISR(adc_digi_ctx->frame_queue, &frame, &taskAwoken);
+                        need_yield |= (taskAwoken == pdTRUE);
+                    }
+                }
+            } else if (adc_digi_ctx->flags.flush_pool) {
                 size_t actual_size = 0;
                 uint8_t *old_data = xRingbufferReceiveUpToFromISR(adc_digi_ctx->ringbuf_hdl, &actual_size, adc_digi_ctx->ringbuf_size);
                 /**
@@ -167,39 +189,68 @@ esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *hdl_confi
 #endif
     esp_err_t ret = ESP_OK;
     ESP_RETURN_ON_FALSE((hdl_config->conv_frame_size % SOC_ADC_DIGI_DATA_BYTES_PER_CONV == 0), ESP_ERR_INVALID_ARG, ADC_TAG, "conv_frame_size should be in multiples of `SOC_ADC_DIGI_DATA_BYTES_PER_CONV`");
+    uint32_t frame_num = hdl_config->conv_frame_num ? hdl_config->conv_frame_num : INTERNAL_BUF_NUM;
+    ESP_RETURN_ON_FALSE(frame_num >= 2, ESP_ERR_INVALID_ARG, ADC_TAG, "at least 2 conversion frames are needed");
+    if (hdl_config->conv_frame_pool) {
+        ESP_RETURN_ON_FALSE(hdl_config->conv_frame_num, ESP_ERR_INVALID_ARG, ADC_TAG, "conv_frame_num is needed when conv_frame_pool is given");
+        ESP_RETURN_ON_FALSE(esp_ptr_dma_capable(hdl_config->conv_frame_pool), ESP_ERR_INVALID_ARG, ADC_TAG, "conv_frame_pool is not DMA capable");
+    }
 
     adc_continuous_ctx_t *adc_ctx = heap_caps_calloc(1, sizeof(adc_continuous_ctx_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     if (adc_ctx == NULL) {
         ret = ESP_ERR_NO_MEM;
         goto cleanup;
     }
+    adc_ctx->frame_num = frame_num;
+    adc_ctx->conv_frame_size = hdl_config->conv_frame_size;
+    adc_ctx->flags.borrow_frames = hdl_config->flags.borrow_frames;
+
+    if (hdl_config->flags.borrow_frames) {
+        //frame queue storage/struct buffer: completed frames are delivered by reference, no data copy
+        adc_ctx->frame_queue_storage = heap_caps_calloc(frame_num, sizeof(adc_continuous_evt_data_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        adc_ctx->frame_queue_struct = heap_caps_calloc(1, sizeof(StaticQueue_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!adc_ctx->frame_queue_storage || !adc_ctx->frame_queue_struct) {
+            ret = ESP_ERR_NO_MEM;
+            goto cleanup;
+        }
+        adc_ctx->frame_queue = xQueueCreateStatic(frame_num, sizeof(adc_continuous_evt_data_t), adc_ctx->frame_queue_storage, adc_ctx->frame_queue_struct);
+        if (!adc_ctx->frame_queue) {
+            ret = ESP_ERR_NO_MEM;
+            goto cleanup;
+        }
+    } else {
+        //ringbuffer storage/struct buffer
+        adc_ctx->ringbuf_size = hdl_config->max_store_buf_size;
+        adc_ctx->ringbuf_storage = heap_caps_calloc(1, hdl_config->max_store_buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        adc_ctx->ringbuf_struct = heap_caps_calloc(1, sizeof(StaticRingbuffer_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!adc_ctx->ringbuf_storage || !adc_ctx->ringbuf_struct) {
+            ret = ESP_ERR_NO_MEM;
+            goto cleanup;
+        }
 
-    //ringbuffer storage/struct buffer
-    adc_ctx->ringbuf_size = hdl_config->max_store_buf_size;
-    adc_ctx->ringbuf_storage = heap_caps_calloc(1, hdl_config->max_store_buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-    adc_ctx->ringbuf_struct = heap_caps_calloc(1, sizeof(StaticRingbuffer_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-    if (!adc_ctx->ringbuf_storage || !adc_ctx->ringbuf_struct) {
-        ret = ESP_ERR_NO_MEM;
-        goto cleanup;
-    }
-
-    //ringbuffer
-    adc_ctx->ringbuf_hdl = xRingbufferCreateStatic(hdl_config->max_store_buf_size, RINGBUF_TYPE_BYTEBUF, adc_ctx->ringbuf_storage, adc_ctx->ringbuf_struct);
-    if (!adc_ctx->ringbuf_hdl) {
-        ret = ESP_ERR_NO_MEM;
-        goto cleanup;
+        //ringbuffer
+        adc_ctx->ringbuf_hdl = xRingbufferCreateStatic(hdl_config->max_store_buf_size, RINGBUF_TYPE_BYTEBUF, adc_ctx->ringbuf_storage, adc_ctx->ringbuf_struct);
+        if (!adc_ctx->ringbuf_hdl) {
+            ret = ESP_ERR_NO_MEM;
+            goto cleanup;
+        }
     }
 
-    //malloc internal buffer used by DMA
-    adc_ctx->rx_dma_buf = heap_caps_calloc(INTERNAL_BUF_NUM, hdl_config->conv_frame_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
-    if (!adc_ctx->rx_dma_buf) {
-        ret = ESP_ERR_NO_MEM;
-        goto cleanup;
+    //internal buffer used by DMA: application-owned pool when given, malloc otherwise
+    if (hdl_config->conv_frame_pool) {
+        adc_ctx->rx_dma_buf = hdl_config->conv_frame_pool;
+        adc_ctx->flags.user_pool = 1;
+    } else {
+        adc_ctx->rx_dma_buf = heap_caps_calloc(frame_num, hdl_config->conv_frame_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+        if (!adc_ctx->rx_dma_buf) {
+            ret = ESP_ERR_NO_MEM;
+            goto cleanup;
+        }
     }
 
     //malloc dma descriptor
     uint32_t dma_desc_num_per_frame = (hdl_config->conv_frame_size + DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED - 1) / DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED;
-    uint32_t dma_desc_max_num = dma_desc_num_per_frame * INTERNAL_BUF_NUM;
+    uint32_t dma_desc_max_num = dma_desc_num_per_frame * frame_num;
     adc_ctx->hal.rx_desc = heap_caps_aligned_calloc(ADC_DMA_DESC_ALIGN, dma_desc_max_num, sizeof(dma_descriptor_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
 
 #if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
@@ -235,7 +286,7 @@ esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *hdl_confi
     ret = adc_dma_intr_event_init(adc_ctx);
 
     adc_hal_dma_config_t config = {
-        .eof_desc_num = INTERNAL_BUF_NUM,
+        .eof_desc_num = frame_num,
         .eof_step = dma_desc_num_per_frame,
         .eof_num = hdl_config->conv_frame_size / SOC_ADC_DIGI_DATA_BYTES_PER_CONV
     };
@@ -270,6 +321,12 @@ esp_err_t adc_continuous_start(adc_continuous_handle_t handle)
     }
 #endif
 
+    if (handle->frame_queue) {
+        //drop frames left over from a previous run, their memory is re-linked to the DMA below
+        xQueueReset(handle->frame_queue);
+        handle->frames_borrowed = 0;
+    }
+
     handle->fsm = ADC_FSM_STARTED;
     sar_periph_ctrl_adc_continuous_power_acquire();
     //reset flags
@@ -393,6 +450,7 @@ esp_err_t adc_continuous_read(adc_continuous_handle_t handle, uint8_t *buf, uint
 {
     ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver isn't initialised");
     ESP_RETURN_ON_FALSE(handle->fsm == ADC_FSM_STARTED, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver is already stopped");
+    ESP_RETURN_ON_FALSE(!handle->flags.borrow_frames, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver is in borrow mode, use `adc_continuous_borrow_frame` instead");
 
     TickType_t ticks_to_wait;
     esp_err_t ret = ESP_OK;
@@ -420,6 +478,47 @@ esp_err_t adc_continuous_read(adc_continuous_handle_t handle, uint8_t *buf, uint
     return ret;
 }
 
+esp_err_t adc_continuous_borrow_frame(adc_continuous_handle_t handle, uint8_t **frame_buf, uint32_t *size, uint32_t timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver isn't initialised");
+    ESP_RETURN_ON_FALSE(frame_buf && size, ESP_ERR_INVALID_ARG, ADC_TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(handle->fsm == ADC_FSM_STARTED, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver is already stopped");
+    ESP_RETURN_ON_FALSE(handle->flags.borrow_frames, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver wasn't created with `flags.borrow_frames`");
+
+    TickType_t ticks_to_wait = timeout_ms / portTICK_PERIOD_MS;
+    if (timeout_ms == ADC_MAX_DELAY) {
+        ticks_to_wait = portMAX_DELAY;
+    }
+
+    adc_continuous_evt_data_t frame;
+    if (xQueueReceive(handle->frame_queue, &frame, ticks_to_wait) != pdTRUE) {
+        ESP_LOGV(ADC_TAG, "No data, increase timeout");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    handle->frames_borrowed++;
+    *frame_buf = frame.conv_frame_buffer;
+    *size = frame.size;
+    assert((frame.size % 4) == 0);
+
+    return ESP_OK;
+}
+
+esp_err_t adc_continuous_return_frame(adc_continuous_handle_t handle, uint8_t *frame_buf)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver isn't initialised");
+    ESP_RETURN_ON_FALSE(handle->flags.borrow_frames, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver wasn't created with `flags.borrow_frames`");
+    bool in_pool = (frame_buf >= handle->rx_dma_buf) &&
+                   (frame_buf < handle->rx_dma_buf + handle->frame_num * handle->conv_frame_size) &&
+                   (((uintptr_t)(frame_buf - handle->rx_dma_buf) % handle->conv_frame_size) == 0);
+    ESP_RETURN_ON_FALSE(in_pool, ESP_ERR_INVALID_ARG, ADC_TAG, "not a frame of the DMA pool");
+    ESP_RETURN_ON_FALSE(handle->frames_borrowed > 0, ESP_ERR_INVALID_STATE, ADC_TAG, "no frame is borrowed");
+
+    //The DMA cycles through the pool by itself, returning a frame is pure bookkeeping
+    handle->frames_borrowed--;
+    return ESP_OK;
+}
+
 esp_err_t adc_continuous_deinit(adc_continuous_handle_t handle)
 {
     ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_STATE, ADC_TAG, "The driver isn't initialised");
@@ -432,13 +531,22 @@ esp_err_t adc_continuous_deinit(adc_continuous_handle_t handle)
         free(handle->ringbuf_struct);
     }
 
+    if (handle->frame_queue) {
+        vQueueDelete(handle->frame_queue);
+        handle->frame_queue = NULL;
+        free(handle->frame_queue_storage);
+        free(handle->frame_queue_struct);
+    }
+
 #if CONFIG_PM_ENABLE
     if (handle->pm_lock) {
         esp_pm_lock_delete(handle->pm_lock);
     }
 #endif
 
-    free(handle->rx_dma_buf);
+    if (!handle->flags.user_pool) {
+        free(handle->rx_dma_buf);
+    }
     free(handle->hal.rx_desc);
     free(handle->hal_digi_ctrlr_cfg.adc_pattern);
     adc_dma_deinit(handle->adc_dma);
@@ -570,6 +678,13 @@ esp_err_t adc_continuous_flush_pool(adc_continuous_handle_t handle)
     ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, ADC_TAG, "invalid argument");
     ESP_RETURN_ON_FALSE(handle->fsm == ADC_FSM_INIT, ESP_ERR_INVALID_STATE, ADC_TAG, "ADC continuous mode isn't in the init state, it's started already");
 
+    if (handle->flags.borrow_frames) {
+        adc_continuous_evt_data_t frame;
+        while (xQueueReceive(handle->frame_queue, &frame, 0) == pdTRUE) {
+        }
+        return ESP_OK;
+    }
+
     size_t actual_size = 0;
     uint8_t *old_data = NULL;
 
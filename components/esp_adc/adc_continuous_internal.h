@@ -12,6 +12,7 @@
 #include "esp_pm.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/ringbuf.h"
+#include "freertos/queue.h"
 #include "hal/adc_types.h"
 #include "hal/adc_hal.h"
 //For DMA
@@ -80,6 +81,12 @@ struct adc_continuous_ctx_t {
     void*                           ringbuf_storage;            //Ringbuffer storage buffer
     void*                           ringbuf_struct;             //Ringbuffer structure buffer
     size_t                          ringbuf_size;               //Ringbuffer size
+    QueueHandle_t                   frame_queue;                //Completed DMA frames delivered by reference (borrow mode)
+    void*                           frame_queue_storage;        //Frame queue storage buffer
+    void*                           frame_queue_struct;         //Frame queue structure buffer
+    uint32_t                        frame_num;                  //Number of conversion frames in the DMA pool
+    uint32_t                        conv_frame_size;            //Conversion frame size, in bytes
+    uint32_t                        frames_borrowed;            //Frames currently held by the application
     intptr_t                        rx_eof_desc_addr;           //eof descriptor address of RX channel
     adc_fsm_t                       fsm;                        //ADC continuous mode driver internal states
     bool                            use_adc1;                   //1: ADC unit1 will be used; 0: ADC unit1 won't be used.
@@ -95,6 +102,8 @@ struct adc_continuous_ctx_t {
 #endif
     struct {
         uint32_t flush_pool: 1;     //Flush the internal pool when the pool is full. With this flag, the `on_pool_ovf` event will not happen.
+        uint32_t borrow_frames: 1;  //Deliver completed DMA frames by reference instead of copying them into the ringbuffer
+        uint32_t user_pool: 1;      //rx_dma_buf is owned by the application, don't free it on deinit
     } flags;
 #if SOC_ADC_DIG_IIR_FILTER_SUPPORTED
     adc_iir_filter_t                *iir_filter[SOC_ADC_DIGI_IIR_FILTER_NUM];  //ADC IIR filter context
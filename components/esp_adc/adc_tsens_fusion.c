@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "driver/gptimer.h"
+#include "esp_adc/adc_tsens_fusion.h"
+#include "esp_private/adc_private.h"
+#include "soc/soc_caps.h"
+
+static const char *TAG = "adc_tsens_fusion";
+
+#define ADC_TSENS_FUSION_MEM_CAPS         (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+// The timer counts microseconds, so the alarm period maps 1:1 to the record timestamps
+#define ADC_TSENS_FUSION_TIMER_RES_HZ     (1 * 1000 * 1000)
+
+typedef struct adc_tsens_fusion_ctx_t {
+    gptimer_handle_t gptimer;                   // Timer paces the sampling sequence
+    adc_oneshot_unit_handle_t adc_unit;         // Borrowed oneshot ADC unit
+    temperature_sensor_handle_t tsens;          // Borrowed temperature sensor
+    adc_channel_t adc_channel_list[SOC_ADC_MAX_CHANNEL_NUM];
+    size_t adc_channel_num;
+    adc_tsens_fusion_done_callback_t on_record;
+    void *user_ctx;
+    bool is_running;
+    adc_tsens_fusion_record_t record;           // Scratch record, filled and delivered in the alarm ISR
+} adc_tsens_fusion_ctx_t;
+
+static bool s_fusion_alarm_cb(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_ctx)
+{
+    adc_tsens_fusion_ctx_t *ctx = (adc_tsens_fusion_ctx_t *)user_ctx;
+    adc_tsens_fusion_record_t *record = &ctx->record;
+
+    record->timestamp_us = esp_timer_get_time();
+    temperature_sensor_get_celsius_isr(ctx->tsens, &record->tsens_celsius);
+    for (size_t i = 0; i < ctx->adc_channel_num; i++) {
+        adc_oneshot_read_isr(ctx->adc_unit, ctx->adc_channel_list[i], &record->adc_raw[i]);
+    }
+    return ctx->on_record(ctx, record, ctx->user_ctx);
+}
+
+esp_err_t adc_new_tsens_fusion_sampler(const adc_tsens_fusion_config_t *config, adc_tsens_fusion_handle_t *ret_handle)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && ret_handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    ESP_RETURN_ON_FALSE(config->adc_unit && config->tsens, ESP_ERR_INVALID_ARG, TAG, "invalid adc unit or tsens handle");
+    ESP_RETURN_ON_FALSE(config->adc_channel_list && config->adc_channel_num && config->adc_channel_num <= SOC_ADC_MAX_CHANNEL_NUM,
+                        ESP_ERR_INVALID_ARG, TAG, "invalid channel list");
+    ESP_RETURN_ON_FALSE(config->on_record, ESP_ERR_INVALID_ARG, TAG, "record callback not set");
+    ESP_RETURN_ON_FALSE(config->sample_freq_hz > 0 && config->sample_freq_hz <= ADC_TSENS_FUSION_TIMER_RES_HZ,
+                        ESP_ERR_INVALID_ARG, TAG, "invalid sample frequency");
+
+    adc_tsens_fusion_ctx_t *ctx = heap_caps_calloc(1, sizeof(adc_tsens_fusion_ctx_t), ADC_TSENS_FUSION_MEM_CAPS);
+    ESP_RETURN_ON_FALSE(ctx, ESP_ERR_NO_MEM, TAG, "no mem for fusion sampler");
+    ctx->adc_unit = config->adc_unit;
+    ctx->tsens = config->tsens;
+    ctx->adc_channel_num = config->adc_channel_num;
+    memcpy(ctx->adc_channel_list, config->adc_channel_list, config->adc_channel_num * sizeof(adc_channel_t));
+    ctx->on_record = config->on_record;
+    ctx->user_ctx = config->user_ctx;
+
+    gptimer_config_t timer_config = {
+        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = ADC_TSENS_FUSION_TIMER_RES_HZ,
+    };
+    ESP_GOTO_ON_ERROR(gptimer_new_timer(&timer_config, &ctx->gptimer), err, TAG, "no free gptimer for fusion sampler");
+    gptimer_event_callbacks_t cbs = {
+        .on_alarm = s_fusion_alarm_cb,
+    };
+    ESP_GOTO_ON_ERROR(gptimer_register_event_callbacks(ctx->gptimer, &cbs, ctx), err, TAG, "register alarm callback failed");
+    gptimer_alarm_config_t alarm_config = {
+        .alarm_count = ADC_TSENS_FUSION_TIMER_RES_HZ / config->sample_freq_hz,
+        .reload_count = 0,
+        .flags.auto_reload_on_alarm = true,
+    };
+    ESP_GOTO_ON_ERROR(gptimer_set_alarm_action(ctx->gptimer, &alarm_config), err, TAG, "set alarm action failed");
+    ESP_GOTO_ON_ERROR(gptimer_enable(ctx->gptimer), err, TAG, "enable gptimer failed");
+
+    *ret_handle = ctx;
+    return ESP_OK;
+
+err:
+    if (ctx->gptimer) {
+        gptimer_del_timer(ctx->gptimer);
+    }
+    free(ctx);
+    return ret;
+}
+
+esp_err_t adc_tsens_fusion_start(adc_tsens_fusion_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    ESP_RETURN_ON_FALSE(!handle->is_running, ESP_ERR_INVALID_STATE, TAG, "fusion sampler already running");
+    ESP_RETURN_ON_ERROR(gptimer_start(handle->gptimer), TAG, "start gptimer failed");
+    handle->is_running = true;
+    return ESP_OK;
+}
+
+esp_err_t adc_tsens_fusion_stop(adc_tsens_fusion_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    ESP_RETURN_ON_FALSE(handle->is_running, ESP_ERR_INVALID_STATE, TAG, "fusion sampler not running");
+    ESP_RETURN_ON_ERROR(gptimer_stop(handle->gptimer), TAG, "stop gptimer failed");
+    handle->is_running = false;
+    return ESP_OK;
+}
+
+esp_err_t adc_del_tsens_fusion_sampler(adc_tsens_fusion_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    ESP_RETURN_ON_FALSE(!handle->is_running, ESP_ERR_INVALID_STATE, TAG, "fusion sampler still running");
+    ESP_RETURN_ON_ERROR(gptimer_disable(handle->gptimer), TAG, "disable gptimer failed");
+    ESP_RETURN_ON_ERROR(gptimer_del_timer(handle->gptimer), TAG, "delete gptimer failed");
+    free(handle);
+    return ESP_OK;
+}
@@ -50,10 +50,14 @@ typedef struct adc_continuous_ctx_t *adc_continuous_handle_t;
  * @brief ADC continuous mode driver initial configurations
  */
 typedef struct {
-    uint32_t max_store_buf_size;    ///< Max length of the conversion results that driver can store, in bytes.
+    uint32_t max_store_buf_size;    ///< Max length of the conversion results that driver can store, in bytes. Ignored when `flags.borrow_frames` is set.
     uint32_t conv_frame_size;       ///< Conversion frame size, in bytes. This should be in multiples of `SOC_ADC_DIGI_DATA_BYTES_PER_CONV`.
+    uint8_t *conv_frame_pool;       ///< Optional application-owned memory for the DMA conversion frames, `conv_frame_num` * `conv_frame_size` bytes.
+                                    ///< Must be DMA-capable and satisfy the DMA alignment requirements of the target. Set to NULL to let the driver allocate the frames internally.
+    uint32_t conv_frame_num;        ///< Number of conversion frames in the DMA pool, at least 2. 0 selects the driver internal default. Required when `conv_frame_pool` is given.
     struct {
         uint32_t flush_pool: 1;     ///< Flush the internal pool when the pool is full.
+        uint32_t borrow_frames: 1;  ///< Deliver completed DMA frames by reference via `adc_continuous_borrow_frame` instead of copying them into an internal ringbuffer. See the function description for the constraints of this mode.
     } flags;                        ///< Driver flags
 } adc_continuous_handle_cfg_t;
 
@@ -175,6 +179,47 @@ esp_err_t adc_continuous_start(adc_continuous_handle_t handle);
  */
 esp_err_t adc_continuous_read(adc_continuous_handle_t handle, uint8_t *buf, uint32_t length_max, uint32_t *out_length, uint32_t timeout_ms);
 
+/**
+ * @brief Borrow one completed conversion frame from the driver, without copying
+ *
+ * Only available when the driver was created with `flags.borrow_frames` set. The returned
+ * pointer references the DMA frame memory directly (the pool given in `conv_frame_pool`, or
+ * the driver internal frames), so the conversion results are consumed in place instead of
+ * being copied out of a ringbuffer. Hand the frame back with `adc_continuous_return_frame`
+ * when done.
+ *
+ * @note The DMA keeps cycling through the frame pool while frames are borrowed. A borrowed
+ *       frame is overwritten by the hardware after (`conv_frame_num` - 1) further frames
+ *       have completed, so it must be processed and returned within that window. Size the
+ *       pool for the worst-case processing latency.
+ * @note This API is expected to be called from a single task.
+ *
+ * @param[in]  handle      ADC continuous mode driver handle
+ * @param[out] frame_buf   Pointer to the conversion frame
+ * @param[out] size        Size of the conversion frame, in bytes
+ * @param[in]  timeout_ms  Time to wait for a completed frame, in millisecond. `ADC_MAX_DELAY` means waiting forever
+ *
+ * @return
+ *         - ESP_ERR_INVALID_STATE Driver state is invalid, or the driver wasn't created with `flags.borrow_frames`
+ *         - ESP_ERR_INVALID_ARG   Invalid arguments
+ *         - ESP_ERR_TIMEOUT       No completed frame within the given time
+ *         - ESP_OK                On success
+ */
+esp_err_t adc_continuous_borrow_frame(adc_continuous_handle_t handle, uint8_t **frame_buf, uint32_t *size, uint32_t timeout_ms);
+
+/**
+ * @brief Return a conversion frame obtained from `adc_continuous_borrow_frame`
+ *
+ * @param[in] handle     ADC continuous mode driver handle
+ * @param[in] frame_buf  Frame pointer obtained from `adc_continuous_borrow_frame`
+ *
+ * @return
+ *         - ESP_ERR_INVALID_STATE Driver state is invalid, or no frame is currently borrowed
+ *         - ESP_ERR_INVALID_ARG   The pointer is not a frame of the DMA pool
+ *         - ESP_OK                On success
+ */
+esp_err_t adc_continuous_return_frame(adc_continuous_handle_t handle, uint8_t *frame_buf);
+
 /**
  * @brief Stop the ADC. After this, the hardware stops working.
  *
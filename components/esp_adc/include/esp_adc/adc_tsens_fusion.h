@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "soc/soc_caps.h"
+#include "esp_adc/adc_oneshot.h"
+#include "driver/temperature_sensor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Type of ADC/temperature-sensor fusion sampler handle
+ */
+typedef struct adc_tsens_fusion_ctx_t *adc_tsens_fusion_handle_t;
+
+/**
+ * @brief One fused sample record
+ *
+ * All fields are latched within a single timer alarm, so the temperature reading,
+ * the ADC readings and the timestamp belong to the same instant (within the
+ * conversion time of the sequence, typically a few tens of microseconds).
+ */
+typedef struct {
+    int64_t timestamp_us;                     /*!< Timestamp taken right before the sequence, in microseconds since boot (`esp_timer` time base) */
+    float tsens_celsius;                      /*!< On-chip temperature in degrees Celsius */
+    int adc_raw[SOC_ADC_MAX_CHANNEL_NUM];     /*!< Raw ADC conversion results, in the order of `adc_channel_list`, only the first `adc_channel_num` entries are valid */
+} adc_tsens_fusion_record_t;
+
+/**
+ * @brief Fusion sampler record callback
+ * @note  Runs in ISR context, on every timer alarm. The record is only valid during the callback.
+ *
+ * @param[in] handle   Fusion sampler handle, created by `adc_new_tsens_fusion_sampler()`
+ * @param[in] record   The fused sample of this alarm
+ * @param[in] user_ctx User registered context, passed from `adc_tsens_fusion_config_t`
+ *
+ * @return Whether a high priority task has been waken up by this callback function
+ */
+typedef bool (*adc_tsens_fusion_done_callback_t)(adc_tsens_fusion_handle_t handle, const adc_tsens_fusion_record_t *record, void *user_ctx);
+
+/**
+ * @brief ADC/temperature-sensor fusion sampler configurations
+ */
+typedef struct {
+    adc_oneshot_unit_handle_t adc_unit;       /*!< Oneshot ADC unit to sample from, the channels must be configured via `adc_oneshot_config_channel` beforehand */
+    const adc_channel_t *adc_channel_list;    /*!< List of ADC channels to latch on every alarm */
+    size_t adc_channel_num;                   /*!< Number of channels in `adc_channel_list` */
+    temperature_sensor_handle_t tsens;        /*!< Temperature sensor handle, must be enabled before starting the sampler */
+    uint32_t sample_freq_hz;                  /*!< Frequency of the fused sampling sequence, in Hz */
+    adc_tsens_fusion_done_callback_t on_record; /*!< Callback invoked with every fused record */
+    void *user_ctx;                           /*!< User context, passed to the callback */
+} adc_tsens_fusion_config_t;
+
+/**
+ * @brief Create an ADC/temperature-sensor fusion sampler
+ *
+ * The sampler owns a GPTimer instance. On every alarm it latches a timestamp, the on-chip
+ * temperature and all configured ADC channels inside one interrupt, and delivers them as a
+ * single fused record, avoiding the scheduling skew of separate driver calls.
+ *
+ * @note The sampler borrows the ADC unit and the temperature sensor, it doesn't take their
+ *       ownership. Don't delete them before deleting the sampler.
+ *
+ * @param[in]  config     Fusion sampler configurations
+ * @param[out] ret_handle Returned fusion sampler handle
+ * @return
+ *     - ESP_OK                 On success
+ *     - ESP_ERR_INVALID_ARG    Invalid arguments (null pointers, no channel, zero frequency)
+ *     - ESP_ERR_NO_MEM         No memory for the sampler context
+ *     - ESP_ERR_NOT_FOUND      No free GPTimer instance
+ */
+esp_err_t adc_new_tsens_fusion_sampler(const adc_tsens_fusion_config_t *config, adc_tsens_fusion_handle_t *ret_handle);
+
+/**
+ * @brief Start the fusion sampler
+ *
+ * @param[in] handle Fusion sampler handle, created by `adc_new_tsens_fusion_sampler()`
+ * @return
+ *     - ESP_OK                 On success
+ *     - ESP_ERR_INVALID_ARG    Invalid handle
+ *     - ESP_ERR_INVALID_STATE  The sampler is already running
+ */
+esp_err_t adc_tsens_fusion_start(adc_tsens_fusion_handle_t handle);
+
+/**
+ * @brief Stop the fusion sampler
+ *
+ * @param[in] handle Fusion sampler handle, created by `adc_new_tsens_fusion_sampler()`
+ * @return
+ *     - ESP_OK                 On success
+ *     - ESP_ERR_INVALID_ARG    Invalid handle
+ *     - ESP_ERR_INVALID_STATE  The sampler is not running
+ */
+esp_err_t adc_tsens_fusion_stop(adc_tsens_fusion_handle_t handle);
+
+/**
+ * @brief Delete the fusion sampler and recycle its GPTimer
+ *
+ * @param[in] handle Fusion sampler handle, created by `adc_new_tsens_fusion_sampler()`
+ * @return
+ *     - ESP_OK                 On success
+ *     - ESP_ERR_INVALID_ARG    Invalid handle
+ *     - ESP_ERR_INVALID_STATE  The sampler is still running
+ */
+esp_err_t adc_del_tsens_fusion_sampler(adc_tsens_fusion_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/**
+ * @file
+ * @brief Microbenchmark harness with cycle-accurate timing
+ *
+ * The harness runs a fixture-based benchmark (setup / body / teardown),
+ * timing each iteration of the body with the CPU cycle counter. Warmup
+ * iterations are executed untimed, the configured percentage of fastest
+ * and slowest samples is rejected, and the remaining samples are reduced
+ * to min / max / median / mean. Results can be printed as JSON lines for
+ * host-side collection and checked against baseline tables with a
+ * relative tolerance, so performance regressions fail loudly in CI.
+ */
+
+/**
+ * @brief Benchmark definition (fixture + body + run parameters)
+ */
+typedef struct {
+    const char *name;               /*!< Benchmark name, used in results and baselines */
+    void (*setup)(void *ctx);       /*!< Optional, runs once before the warmup */
+    void (*teardown)(void *ctx);    /*!< Optional, runs once after the last iteration */
+    void (*body)(void *ctx);        /*!< One timed iteration of the workload */
+    void *ctx;                      /*!< Passed to setup / body / teardown */
+    uint32_t warmup_iters;          /*!< Untimed warmup iterations, 0 for the default (8) */
+    uint32_t iters;                 /*!< Timed iterations, 0 for the configured default */
+    bool cold_cache;                /*!< Thrash the data cache before every timed iteration,
+                                         so each one starts with a cold cache state */
+} esp_benchmark_def_t;
+
+/**
+ * @brief Benchmark result statistics
+ *
+ * Cycle statistics are computed after outlier rejection; median_ns is
+ * derived from the median cycle count and the current CPU frequency.
+ */
+typedef struct {
+    const char *name;           /*!< Benchmark name (points into the definition) */
+    uint32_t iters;             /*!< Number of timed iterations executed */
+    uint32_t rejected;          /*!< Samples discarded as outliers */
+    uint32_t min_cycles;        /*!< Fastest kept iteration */
+    uint32_t max_cycles;        /*!< Slowest kept iteration */
+    uint32_t median_cycles;     /*!< Median of the kept iterations */
+    uint32_t mean_cycles;       /*!< Mean of the kept iterations */
+    uint64_t median_ns;         /*!< Median converted to nanoseconds */
+} esp_benchmark_result_t;
+
+/**
+ * @brief Baseline entry for regression checking
+ *
+ * Baseline tables are typically generated from a previous run's JSON
+ * output and checked into the project next to the benchmark suite.
+ */
+typedef struct {
+    const char *name;           /*!< Benchmark name to match */
+    uint32_t median_cycles;     /*!< Expected median cycle count */
+} esp_benchmark_baseline_t;
+
+/**
+ * @brief Run a benchmark and compute its statistics
+ *
+ * @param[in]  def  Benchmark definition
+ * @param[out] out  Result statistics
+ *
+ * @return
+ *  - ESP_OK : Success
+ *  - ESP_ERR_INVALID_ARG : Missing definition, body or output pointer
+ *  - ESP_ERR_NO_MEM : Sample buffer allocation failed
+ */
+esp_err_t esp_benchmark_run(const esp_benchmark_def_t *def, esp_benchmark_result_t *out);
+
+/**
+ * @brief Print a result as a single JSON line on stdout
+ *
+ * Format:
+ * {"name":"...","iters":N,"rejected":N,"cycles":{"min":N,"max":N,"median":N,"mean":N},"median_ns":N}
+ *
+ * @param[in] res  Result to print
+ */
+void esp_benchmark_print_json(const esp_benchmark_result_t *res);
+
+/**
+ * @brief Check a result against a baseline table
+ *
+ * Looks up the result name in the table and fails if the measured median
+ * exceeds the baseline median by more than the given tolerance. Faster
+ * results always pass.
+ *
+ * @param[in] res            Result to check
+ * @param[in] baselines      Baseline table
+ * @param[in] count          Number of entries in the table
+ * @param[in] tolerance_pct  Allowed regression in percent of the baseline
+ *
+ * @return
+ *  - ESP_OK : Within tolerance
+ *  - ESP_ERR_NOT_FOUND : No baseline entry with a matching name
+ *  - ESP_FAIL : Median exceeds baseline by more than the tolerance
+ */
+esp_err_t esp_benchmark_check(const esp_benchmark_result_t *res,
+                              const esp_benchmark_baseline_t *baselines,
+                              size_t count, uint32_t tolerance_pct);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "esp_err.h"
+
+/**
+ * @file
+ * @brief Bundled benchmark suites (CONFIG_ESP_BENCHMARK_SUITES)
+ *
+ * Each suite runs a small set of benchmarks for one subsystem and prints
+ * the results as JSON lines. Intended to be invoked from a test app or a
+ * console command to quantify the performance impact of an IDF upgrade.
+ */
+
+/**
+ * @brief Benchmark heap_caps allocation and free paths
+ *
+ * @return ESP_OK on success, otherwise see esp_err_t
+ */
+esp_err_t esp_benchmark_suite_heap(void);
+
+/**
+ * @brief Benchmark NVS get/set/commit on the default partition
+ *
+ * NVS must be initialized (nvs_flash_init()) before running this suite.
+ *
+ * @return ESP_OK on success, otherwise see esp_err_t
+ */
+esp_err_t esp_benchmark_suite_nvs(void);
+
+/**
+ * @brief Benchmark memcpy/memset/memcmp for various sizes
+ *
+ * Useful to quantify the effect of CONFIG_LIBC_OPTIMIZED_MEM_FUNCS_IN_IRAM
+ * against the ROM implementations on a given chip.
+ *
+ * @return ESP_OK on success, otherwise see esp_err_t
+ */
+esp_err_t esp_benchmark_suite_mem(void);
+
+/**
+ * @brief Benchmark esp_flash reads from the main flash chip
+ *
+ * @return ESP_OK on success, otherwise see esp_err_t
+ */
+esp_err_t esp_benchmark_suite_flash(void);
+
+/**
+ * @brief Benchmark lwIP TCP loopback throughput
+ *
+ * The TCP/IP stack (esp_netif_init() and the lwIP loopback interface)
+ * must be up before running this suite.
+ *
+ * @return ESP_OK on success, otherwise see esp_err_t
+ */
+esp_err_t esp_benchmark_suite_lwip(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_private/esp_clk.h"
+#include "sdkconfig.h"
+
+#include "esp_benchmark.h"
+
+#define ESP_BENCHMARK_DEF_WARMUP_ITERS  8
+
+static const char *TAG = "esp_benchmark";
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t va = *(const uint32_t *)a;
+    uint32_t vb = *(const uint32_t *)b;
+    return (va > vb) - (va < vb);
+}
+
+/* Walk a buffer larger than the data cache so that every timed iteration
+ * starts with the workload's own data evicted */
+static void thrash_cache(volatile uint32_t *buf, size_t words)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < words; i++) {
+        sum += buf[i];
+    }
+    (void)sum;
+}
+
+esp_err_t esp_benchmark_run(const esp_benchmark_def_t *def, esp_benchmark_result_t *out)
+{
+    if (def == NULL || def->body == NULL || out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t warmup = def->warmup_iters ? def->warmup_iters : ESP_BENCHMARK_DEF_WARMUP_ITERS;
+    uint32_t iters = def->iters ? def->iters : CONFIG_ESP_BENCHMARK_DEFAULT_ITERATIONS;
+
+    uint32_t *samples = malloc(iters * sizeof(uint32_t));
+    if (samples == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    uint32_t *thrash_buf = NULL;
+    const size_t thrash_words = CONFIG_ESP_BENCHMARK_CACHE_THRASH_SIZE / sizeof(uint32_t);
+    if (def->cold_cache) {
+        thrash_buf = malloc(CONFIG_ESP_BENCHMARK_CACHE_THRASH_SIZE);
+        if (thrash_buf == NULL) {
+            free(samples);
+            return ESP_ERR_NO_MEM;
+        }
+        memset(thrash_buf, 0xA5, CONFIG_ESP_BENCHMARK_CACHE_THRASH_SIZE);
+    }
+
+    if (def->setup) {
+        def->setup(def->ctx);
+    }
+
+    for (uint32_t i = 0; i < warmup; i++) {
+        def->body(def->ctx);
+    }
+
+    for (uint32_t i = 0; i < iters; i++) {
+        if (thrash_buf) {
+            thrash_cache(thrash_buf, thrash_words);
+        }
+        uint32_t start = esp_cpu_get_cycle_count();
+        def->body(def->ctx);
+        samples[i] = esp_cpu_get_cycle_count() - start;
+    }
+
+    if (def->teardown) {
+        def->teardown(def->ctx);
+    }
+    free(thrash_buf);
+
+    qsort(samples, iters, sizeof(uint32_t), cmp_u32);
+
+    /* Reject the configured percentage of samples from both tails */
+    uint32_t drop_each = (iters * CONFIG_ESP_BENCHMARK_OUTLIER_REJECT_PCT) / 100;
+    if (2 * drop_each >= iters) {
+        drop_each = 0;
+    }
+    uint32_t first = drop_each;
+    uint32_t last = iters - drop_each;     /* exclusive */
+    uint32_t kept = last - first;
+
+    uint64_t sum = 0;
+    for (uint32_t i = first; i < last; i++) {
+        sum += samples[i];
+    }
+
+    out->name = def->name;
+    out->iters = iters;
+    out->rejected = 2 * drop_each;
+    out->min_cycles = samples[first];
+    out->max_cycles = samples[last - 1];
+    out->median_cycles = samples[first + kept / 2];
+    out->mean_cycles = (uint32_t)(sum / kept);
+    out->median_ns = ((uint64_t)out->median_cycles * 1000000000ULL) / (uint64_t)esp_clk_cpu_freq();
+
+    free(samples);
+    return ESP_OK;
+}
+
+void esp_benchmark_print_json(const esp_benchmark_result_t *res)
+{
+    if (res == NULL) {
+        return;
+    }
+    printf("{\"name\":\"%s\",\"iters\":%" PRIu32 ",\"rejected\":%" PRIu32
+           ",\"cycles\":{\"min\":%" PRIu32 ",\"max\":%" PRIu32
+           ",\"median\":%" PRIu32 ",\"mean\":%" PRIu32 "},\"median_ns\":%" PRIu64 "}\n",
+           res->name, res->iters, res->rejected,
+           res->min_cycles, res->max_cycles, res->median_cycles, res->mean_cycles,
+           res->median_ns);
+}
+
+esp_err_t esp_benchmark_check(const esp_benchmark_result_t *res,
+                              const esp_benchmark_baseline_t *baselines,
+                              size_t count, uint32_t tolerance_pct)
+{
+    if (res == NULL || baselines == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(baselines[i].name, res->name) != 0) {
+            continue;
+        }
+        uint64_t limit = ((uint64_t)baselines[i].median_cycles * (100 + tolerance_pct)) / 100;
+        if (res->median_cycles > limit) {
+            ESP_LOGE(TAG, "%s: median %" PRIu32 " cycles exceeds baseline %" PRIu32 " (+%" PRIu32 "%% tolerance)",
+                     res->name, res->median_cycles, baselines[i].median_cycles, tolerance_pct);
+            return ESP_FAIL;
+        }
+        ESP_LOGI(TAG, "%s: median %" PRIu32 " cycles within baseline %" PRIu32 " (+%" PRIu32 "%% tolerance)",
+                 res->name, res->median_cycles, baselines[i].median_cycles, tolerance_pct);
+        return ESP_OK;
+    }
+
+    ESP_LOGW(TAG, "No baseline entry for %s", res->name);
+    return ESP_ERR_NOT_FOUND;
+}
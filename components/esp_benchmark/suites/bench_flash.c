@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdlib.h>
+
+#include "esp_log.h"
+#include "esp_flash.h"
+
+#include "esp_benchmark.h"
+#include "esp_benchmark_suites.h"
+
+static const char *TAG = "bench_flash";
+
+typedef struct {
+    uint8_t *buf;
+    size_t size;
+} flash_bench_ctx_t;
+
+static void flash_read_body(void *arg)
+{
+    flash_bench_ctx_t *ctx = (flash_bench_ctx_t *)arg;
+    /* Read from the start of flash (bootloader region), which is always
+     * present and not remapped by the cache */
+    esp_flash_read(NULL, ctx->buf, 0x1000, ctx->size);
+}
+
+static esp_err_t run_one(const char *name, size_t size, bool cold)
+{
+    flash_bench_ctx_t ctx = { .size = size };
+    ctx.buf = malloc(size);
+    if (ctx.buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_benchmark_def_t def = {
+        .name = name,
+        .body = flash_read_body,
+        .ctx = &ctx,
+        .iters = 32,
+        .cold_cache = cold,
+    };
+    esp_benchmark_result_t res;
+    esp_err_t err = esp_benchmark_run(&def, &res);
+    free(ctx.buf);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s failed: %s", name, esp_err_to_name(err));
+        return err;
+    }
+    esp_benchmark_print_json(&res);
+    return ESP_OK;
+}
+
+esp_err_t esp_benchmark_suite_flash(void)
+{
+    esp_err_t err;
+    if ((err = run_one("flash_read_256", 256, false)) != ESP_OK) {
+        return err;
+    }
+    if ((err = run_one("flash_read_4096", 4096, false)) != ESP_OK) {
+        return err;
+    }
+    if ((err = run_one("flash_read_4096_cold", 4096, true)) != ESP_OK) {
+        return err;
+    }
+    return ESP_OK;
+}
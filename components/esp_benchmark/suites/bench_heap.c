@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "esp_heap_caps.h"
+
+#include "esp_benchmark.h"
+#include "esp_benchmark_suites.h"
+
+typedef struct {
+    size_t size;
+    uint32_t caps;
+} heap_bench_ctx_t;
+
+static void heap_alloc_free_body(void *arg)
+{
+    heap_bench_ctx_t *ctx = (heap_bench_ctx_t *)arg;
+    void *p = heap_caps_malloc(ctx->size, ctx->caps);
+    heap_caps_free(p);
+}
+
+static esp_err_t run_one(const char *name, size_t size, uint32_t caps, bool cold)
+{
+    heap_bench_ctx_t ctx = { .size = size, .caps = caps };
+    esp_benchmark_def_t def = {
+        .name = name,
+        .body = heap_alloc_free_body,
+        .ctx = &ctx,
+        .cold_cache = cold,
+    };
+    esp_benchmark_result_t res;
+    esp_err_t err = esp_benchmark_run(&def, &res);
+    if (err != ESP_OK) {
+        return err;
+    }
+    esp_benchmark_print_json(&res);
+    return ESP_OK;
+}
+
+esp_err_t esp_benchmark_suite_heap(void)
+{
+    esp_err_t err;
+    if ((err = run_one("heap_alloc_free_64", 64, MALLOC_CAP_DEFAULT, false)) != ESP_OK) {
+        return err;
+    }
+    if ((err = run_one("heap_alloc_free_512", 512, MALLOC_CAP_DEFAULT, false)) != ESP_OK) {
+        return err;
+    }
+    if ((err = run_one("heap_alloc_free_4096", 4096, MALLOC_CAP_DEFAULT, false)) != ESP_OK) {
+        return err;
+    }
+    if ((err = run_one("heap_alloc_free_64_8bit", 64, MALLOC_CAP_8BIT, false)) != ESP_OK) {
+        return err;
+    }
+    if ((err = run_one("heap_alloc_free_64_cold", 64, MALLOC_CAP_DEFAULT, true)) != ESP_OK) {
+        return err;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lwip/sockets.h"
+
+#include "esp_benchmark.h"
+#include "esp_benchmark_suites.h"
+
+#define BENCH_LWIP_PORT        23459
+#define BENCH_LWIP_CHUNK_SIZE  1460    /* one full TCP segment */
+
+static const char *TAG = "bench_lwip";
+
+typedef struct {
+    int send_sock;
+    int listen_sock;
+    uint8_t chunk[BENCH_LWIP_CHUNK_SIZE];
+    volatile bool sink_running;
+} lwip_bench_ctx_t;
+
+/* Accepts the benchmark connection and discards everything received */
+static void lwip_bench_sink_task(void *arg)
+{
+    lwip_bench_ctx_t *ctx = (lwip_bench_ctx_t *)arg;
+    uint8_t buf[512];
+
+    int sock = accept(ctx->listen_sock, NULL, NULL);
+    if (sock >= 0) {
+        while (ctx->sink_running) {
+            int len = recv(sock, buf, sizeof(buf), 0);
+            if (len <= 0) {
+                break;
+            }
+        }
+        close(sock);
+    }
+    ctx->sink_running = false;
+    vTaskDelete(NULL);
+}
+
+static void lwip_send_body(void *arg)
+{
+    lwip_bench_ctx_t *ctx = (lwip_bench_ctx_t *)arg;
+    send(ctx->send_sock, ctx->chunk, sizeof(ctx->chunk), 0);
+}
+
+esp_err_t esp_benchmark_suite_lwip(void)
+{
+    lwip_bench_ctx_t *ctx = calloc(1, sizeof(lwip_bench_ctx_t));
+    if (ctx == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->send_sock = -1;
+    ctx->listen_sock = -1;
+
+    esp_err_t ret = ESP_FAIL;
+
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(BENCH_LWIP_PORT),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+
+    ctx->listen_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (ctx->listen_sock < 0) {
+        ESP_LOGE(TAG, "Failed to create listening socket");
+        goto cleanup;
+    }
+    if (bind(ctx->listen_sock, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(ctx->listen_sock, 1) != 0) {
+        ESP_LOGE(TAG, "Failed to bind/listen on loopback");
+        goto cleanup;
+    }
+
+    ctx->sink_running = true;
+    if (xTaskCreate(lwip_bench_sink_task, "bench_sink", 3072, ctx,
+                    tskIDLE_PRIORITY + 2, NULL) != pdPASS) {
+        ctx->sink_running = false;
+        ret = ESP_ERR_NO_MEM;
+        goto cleanup;
+    }
+
+    ctx->send_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (ctx->send_sock < 0 ||
+        connect(ctx->send_sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        ESP_LOGE(TAG, "Failed to connect to loopback sink");
+        goto cleanup;
+    }
+
+    esp_benchmark_def_t def = {
+        .name = "lwip_loopback_tcp_send_1460",
+        .body = lwip_send_body,
+        .ctx = ctx,
+        .iters = 128,
+    };
+    esp_benchmark_result_t res;
+    ret = esp_benchmark_run(&def, &res);
+    if (ret == ESP_OK) {
+        esp_benchmark_print_json(&res);
+        if (res.median_ns > 0) {
+            ESP_LOGI(TAG, "Loopback TCP throughput: ~%" PRIu32 " KB/s",
+                     (uint32_t)(((uint64_t)BENCH_LWIP_CHUNK_SIZE * 1000000000ULL) / res.median_ns / 1024));
+        }
+    }
+
+cleanup:
+    if (ctx->send_sock >= 0) {
+        close(ctx->send_sock);
+    }
+    ctx->sink_running = false;
+    if (ctx->listen_sock >= 0) {
+        close(ctx->listen_sock);
+    }
+    /* Give the sink task a chance to notice the closed connection */
+    vTaskDelay(pdMS_TO_TICKS(20));
+    free(ctx);
+    return ret;
+}
@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "esp_log.h"
+
+#include "esp_benchmark.h"
+#include "esp_benchmark_suites.h"
+
+static const char *TAG = "bench_mem";
+
+typedef struct {
+    uint8_t *dst;
+    uint8_t *src;
+    size_t size;
+    volatile int sink;  /* keeps memcmp results observable */
+} mem_bench_ctx_t;
+
+static void memcpy_body(void *arg)
+{
+    mem_bench_ctx_t *ctx = (mem_bench_ctx_t *)arg;
+    memcpy(ctx->dst, ctx->src, ctx->size);
+}
+
+static void memset_body(void *arg)
+{
+    mem_bench_ctx_t *ctx = (mem_bench_ctx_t *)arg;
+    memset(ctx->dst, 0x5a, ctx->size);
+}
+
+static void memcmp_body(void *arg)
+{
+    mem_bench_ctx_t *ctx = (mem_bench_ctx_t *)arg;
+    ctx->sink = memcmp(ctx->dst, ctx->src, ctx->size);
+}
+
+static esp_err_t run_one(const char *func, void (*body)(void *ctx),
+                         mem_bench_ctx_t *ctx, size_t size)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%s_%u", func, (unsigned)size);
+
+    ctx->size = size;
+    esp_benchmark_def_t def = {
+        .name = name,
+        .body = body,
+        .ctx = ctx,
+    };
+    esp_benchmark_result_t res;
+    esp_err_t err = esp_benchmark_run(&def, &res);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s failed: %s", name, esp_err_to_name(err));
+        return err;
+    }
+    esp_benchmark_print_json(&res);
+    return ESP_OK;
+}
+
+esp_err_t esp_benchmark_suite_mem(void)
+{
+    static const size_t sizes[] = { 16, 64, 512, 4096 };
+
+    mem_bench_ctx_t ctx = { 0 };
+    ctx.dst = malloc(sizes[sizeof(sizes) / sizeof(sizes[0]) - 1]);
+    ctx.src = malloc(sizes[sizeof(sizes) / sizeof(sizes[0]) - 1]);
+    if (ctx.dst == NULL || ctx.src == NULL) {
+        free(ctx.dst);
+        free(ctx.src);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(ctx.src, 0x5a, sizes[sizeof(sizes) / sizeof(sizes[0]) - 1]);
+
+    esp_err_t err = ESP_OK;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]) && err == ESP_OK; i++) {
+        if ((err = run_one("memcpy", memcpy_body, &ctx, sizes[i])) == ESP_OK &&
+            (err = run_one("memset", memset_body, &ctx, sizes[i])) == ESP_OK) {
+            err = run_one("memcmp", memcmp_body, &ctx, sizes[i]);
+        }
+    }
+
+    free(ctx.dst);
+    free(ctx.src);
+    return err;
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "esp_log.h"
+#include "nvs.h"
+
+#include "esp_benchmark.h"
+#include "esp_benchmark_suites.h"
+
+static const char *TAG = "bench_nvs";
+
+typedef struct {
+    nvs_handle_t handle;
+    uint32_t counter;
+} nvs_bench_ctx_t;
+
+static void nvs_get_body(void *arg)
+{
+    nvs_bench_ctx_t *ctx = (nvs_bench_ctx_t *)arg;
+    uint32_t val;
+    nvs_get_u32(ctx->handle, "bench_u32", &val);
+}
+
+static void nvs_set_commit_body(void *arg)
+{
+    nvs_bench_ctx_t *ctx = (nvs_bench_ctx_t *)arg;
+    nvs_set_u32(ctx->handle, "bench_u32", ctx->counter++);
+    nvs_commit(ctx->handle);
+}
+
+esp_err_t esp_benchmark_suite_nvs(void)
+{
+    nvs_bench_ctx_t ctx = { 0 };
+
+    esp_err_t err = nvs_open("bench", NVS_READWRITE, &ctx.handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS namespace (is NVS initialized?): %s", esp_err_to_name(err));
+        return err;
+    }
+
+    err = nvs_set_u32(ctx.handle, "bench_u32", 0);
+    if (err != ESP_OK) {
+        nvs_close(ctx.handle);
+        return err;
+    }
+
+    esp_benchmark_def_t def = {
+        .name = "nvs_get_u32",
+        .body = nvs_get_body,
+        .ctx = &ctx,
+    };
+    esp_benchmark_result_t res;
+    err = esp_benchmark_run(&def, &res);
+    if (err == ESP_OK) {
+        esp_benchmark_print_json(&res);
+
+        /* Each iteration erases/rewrites an entry, so keep the count low
+         * to limit flash wear */
+        def.name = "nvs_set_u32_commit";
+        def.body = nvs_set_commit_body;
+        def.iters = 32;
+        def.warmup_iters = 2;
+        err = esp_benchmark_run(&def, &res);
+        if (err == ESP_OK) {
+            esp_benchmark_print_json(&res);
+        }
+    }
+
+    nvs_erase_key(ctx.handle, "bench_u32");
+    nvs_commit(ctx.handle);
+    nvs_close(ctx.handle);
+    return err;
+}
@@ -135,6 +135,56 @@ typedef struct esp_blockdev_geometry_t {
 typedef struct esp_blockdev_t* esp_blockdev_handle_t;
 #define ESP_BLOCKDEV_HANDLE_INVALID NULL
 
+/**
+ * @brief One segment of a scatter-gather list
+ */
+typedef struct esp_blockdev_sg_entry_t {
+    uint8_t* buf;                                   /*!< Segment memory buffer (destination for read, source for write) */
+    size_t len;                                     /*!< Segment length (in bytes) */
+} esp_blockdev_sg_entry_t;
+
+/**
+ * @brief Asynchronous request operation type
+ */
+typedef enum {
+    ESP_BLOCKDEV_REQ_READ,                          /*!< read into the scatter-gather segments */
+    ESP_BLOCKDEV_REQ_WRITE,                         /*!< write from the scatter-gather segments */
+    ESP_BLOCKDEV_REQ_ERASE,                         /*!< erase a range, no segments involved */
+} esp_blockdev_req_op_t;
+
+typedef struct esp_blockdev_req_t esp_blockdev_req_t;
+
+/**
+ * @brief Completion callback of an asynchronous request
+ *
+ * Invoked exactly once per submitted request, from the context of the device's completion
+ * processing (a driver task or the caller of the poll operation, never an ISR).
+ *
+ * @param req The completed request; the device no longer accesses it afterwards
+ * @param result Final status of the request
+ * @param user_ctx The user_ctx member of the request
+ */
+typedef void (*esp_blockdev_req_done_cb_t)(esp_blockdev_req_t* req, esp_err_t result, void* user_ctx);
+
+/**
+ * @brief Asynchronous block device request
+ *
+ * The request and its scatter-gather list must stay valid and unmodified from the submit
+ * call until the completion callback fires. The segments are processed in order at
+ * consecutive device addresses starting at addr.
+ */
+struct esp_blockdev_req_t {
+    esp_blockdev_req_op_t op;                       /*!< Operation to perform */
+    uint64_t addr;                                  /*!< Device address of the first byte accessed */
+    const esp_blockdev_sg_entry_t* sg_list;         /*!< Scatter-gather segments (READ/WRITE); NULL for ERASE */
+    size_t sg_count;                                /*!< Number of scatter-gather segments */
+    size_t erase_len;                               /*!< Length of the range to erase (ERASE only, in bytes) */
+    esp_blockdev_req_done_cb_t on_complete;         /*!< Completion callback, mandatory */
+    void* user_ctx;                                 /*!< Opaque pointer passed to the completion callback */
+    esp_err_t result;                               /*!< Final status, written by the device before the callback */
+    void* driver_ctx;                               /*!< Reserved for the device while the request is in flight */
+};
+
 /**
  * @brief Block device operations
  *
@@ -202,6 +252,32 @@ typedef struct esp_blockdev_ops_t {
      * */
     esp_err_t (*release)(esp_blockdev_handle_t dev_handle);
 
+    /** SUBMIT operation (optional, NULL on devices without asynchronous support):
+     *   Queue an asynchronous request and return without waiting for the device.
+     *   The completion callback of the request is invoked exactly once when it finishes.
+     *
+     * @param dev_handle Target device handle
+     * @param req Request descriptor, owned by the device until its completion callback fires
+     * @return ESP_OK if queued, ESP_ERR_NO_MEM if the request queue is full
+     * */
+    esp_err_t (*submit)(esp_blockdev_handle_t dev_handle, esp_blockdev_req_t* req);
+
+    /** POLL operation (optional, NULL on devices without asynchronous support):
+     *   Drive completion processing on devices which need it and report the queue state.
+     *   On devices which deliver completions from their own context this only reports.
+     *
+     * @param dev_handle Target device handle
+     * @return ESP_OK when no requests are in flight, ESP_ERR_NOT_FINISHED otherwise
+     * */
+    esp_err_t (*poll)(esp_blockdev_handle_t dev_handle);
+
+    /** In-flight depth reporting (optional, NULL on devices without asynchronous support):
+     *   Number of submitted requests which have not completed yet.
+     *
+     * @param dev_handle Target device handle
+     * */
+    size_t (*inflight_count)(esp_blockdev_handle_t dev_handle);
+
 } esp_blockdev_ops_t;
 
 /**
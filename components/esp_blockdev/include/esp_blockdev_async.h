@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_blockdev.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file esp_blockdev_async.h
+ * @brief Asynchronous adapter for synchronous BDL devices.
+ *
+ * Wraps any block device in a request queue drained by a worker task, providing the
+ * optional submit/poll/inflight_count operations of esp_blockdev_ops_t on top of
+ * backends whose read/write/erase is blocking (sdmmc, spi_flash, ...). Filesystems
+ * get read-ahead and write-behind behavior without every driver growing its own
+ * queueing; a driver with native asynchronous hardware support can still implement
+ * the operations directly and skip the adapter.
+ */
+
+/**
+ * @brief Configuration of the asynchronous adapter
+ */
+typedef struct {
+    size_t queue_depth;        /*!< Maximum number of in-flight requests, must be greater than 0 */
+    size_t task_stack_size;    /*!< Stack size of the worker task (in bytes) */
+    unsigned task_priority;    /*!< Priority of the worker task */
+    int task_core_id;          /*!< Core affinity of the worker task, or tskNO_AFFINITY */
+} esp_blockdev_async_config_t;
+
+#define ESP_BLOCKDEV_ASYNC_CONFIG_DEFAULT() {  \
+    .queue_depth = 8,  \
+    .task_stack_size = 3584,  \
+    .task_priority = 5,  \
+    .task_core_id = -1,  \
+}
+
+/**
+ * @brief Wrap a block device with an asynchronous request queue
+ *
+ * The returned handle exposes the same geometry and flags as the base device, forwards
+ * the synchronous operations to it, and implements submit/poll/inflight_count with a
+ * queue and a worker task. Completion callbacks run in the worker task context.
+ * The sync operation of the wrapper first waits for all in-flight requests.
+ *
+ * The base device stays owned by the caller and must not be released before the
+ * wrapper. Releasing the wrapper waits for the queue to drain, stops the worker task
+ * and frees the wrapper only.
+ *
+ * @param base Device to wrap
+ * @param config Adapter configuration
+ * @param[out] out_handle Handle of the wrapping device
+ *
+ * @return
+ *      - ESP_OK: wrapper created
+ *      - ESP_ERR_INVALID_ARG: NULL argument or zero queue depth
+ *      - ESP_ERR_NO_MEM: out of memory
+ */
+esp_err_t esp_blockdev_async_wrap(esp_blockdev_handle_t base,
+                                  const esp_blockdev_async_config_t* config,
+                                  esp_blockdev_handle_t* out_handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
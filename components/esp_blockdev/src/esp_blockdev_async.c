@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_blockdev.h"
+#include "esp_blockdev_async.h"
+
+static const char* TAG = "blockdev_async";
+
+typedef struct {
+    esp_blockdev_handle_t base;    // wrapped device, owned by the creator
+    QueueHandle_t req_queue;       // esp_blockdev_req_t* entries; NULL is the shutdown marker
+    TaskHandle_t worker;
+    SemaphoreHandle_t drained;     // given by the worker whenever the queue runs empty
+    SemaphoreHandle_t stopped;     // given by the worker on shutdown
+    _Atomic size_t inflight;
+} async_ctx_t;
+
+// Runs one request against the blocking operations of the base device,
+// walking the scatter-gather segments at consecutive device addresses.
+static esp_err_t execute_request(esp_blockdev_handle_t base, esp_blockdev_req_t* req)
+{
+    esp_err_t err = ESP_OK;
+
+    if (req->op == ESP_BLOCKDEV_REQ_ERASE) {
+        return base->ops->erase(base, req->addr, req->erase_len);
+    }
+
+    uint64_t addr = req->addr;
+    for (size_t i = 0; i < req->sg_count && err == ESP_OK; ++i) {
+        const esp_blockdev_sg_entry_t* seg = &req->sg_list[i];
+        if (req->op == ESP_BLOCKDEV_REQ_READ) {
+            err = base->ops->read(base, seg->buf, seg->len, addr, seg->len);
+        } else {
+            err = base->ops->write(base, seg->buf, addr, seg->len);
+        }
+        addr += seg->len;
+    }
+    return err;
+}
+
+static void async_worker_task(void* arg)
+{
+    async_ctx_t* ctx = (async_ctx_t*) arg;
+    esp_blockdev_req_t* req;
+
+    while (true) {
+        if (xQueueReceive(ctx->req_queue, &req, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (req == NULL) { // shutdown marker
+            break;
+        }
+        req->result = execute_request(ctx->base, req);
+        // decrement before the callback so that inflight_count == 0 seen by the
+        // callback really means "nothing left in the device"
+        atomic_fetch_sub(&ctx->inflight, 1);
+        req->on_complete(req, req->result, req->user_ctx);
+        if (atomic_load(&ctx->inflight) == 0) {
+            xSemaphoreGive(ctx->drained);
+        }
+    }
+    xSemaphoreGive(ctx->stopped);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t async_submit(esp_blockdev_handle_t handle, esp_blockdev_req_t* req)
+{
+    if (handle == NULL || req == NULL || req->on_complete == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (req->op != ESP_BLOCKDEV_REQ_ERASE && (req->sg_list == NULL || req->sg_count == 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+
+    atomic_fetch_add(&ctx->inflight, 1);
+    if (xQueueSend(ctx->req_queue, &req, 0) != pdTRUE) {
+        atomic_fetch_sub(&ctx->inflight, 1);
+        return ESP_ERR_NO_MEM; // queue full, retry after some requests completed
+    }
+    return ESP_OK;
+}
+
+static esp_err_t async_poll(esp_blockdev_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+    // completions are delivered from the worker task, poll only reports
+    return (atomic_load(&ctx->inflight) == 0) ? ESP_OK : ESP_ERR_NOT_FINISHED;
+}
+
+static size_t async_inflight_count(esp_blockdev_handle_t handle)
+{
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+    return atomic_load(&ctx->inflight);
+}
+
+static void async_wait_drained(async_ctx_t* ctx)
+{
+    while (atomic_load(&ctx->inflight) != 0) {
+        xSemaphoreTake(ctx->drained, portMAX_DELAY);
+    }
+}
+
+static esp_err_t async_read(esp_blockdev_handle_t handle, uint8_t* dst_buf, size_t dst_buf_size, uint64_t src_addr, size_t data_read_len)
+{
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+    return ctx->base->ops->read(ctx->base, dst_buf, dst_buf_size, src_addr, data_read_len);
+}
+
+static esp_err_t async_write(esp_blockdev_handle_t handle, const uint8_t* src_buf, uint64_t dst_addr, size_t data_write_len)
+{
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+    return ctx->base->ops->write(ctx->base, src_buf, dst_addr, data_write_len);
+}
+
+static esp_err_t async_erase(esp_blockdev_handle_t handle, uint64_t start_addr, size_t erase_len)
+{
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+    return ctx->base->ops->erase(ctx->base, start_addr, erase_len);
+}
+
+static esp_err_t async_sync(esp_blockdev_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+    async_wait_drained(ctx);
+    return ctx->base->ops->sync(ctx->base);
+}
+
+static esp_err_t async_ioctl(esp_blockdev_handle_t handle, const uint8_t cmd, void* args)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+    return ctx->base->ops->ioctl(ctx->base, cmd, args);
+}
+
+static esp_err_t async_release(esp_blockdev_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    async_ctx_t* ctx = (async_ctx_t*) handle->ctx;
+
+    async_wait_drained(ctx);
+    esp_blockdev_req_t* marker = NULL;
+    while (xQueueSend(ctx->req_queue, &marker, portMAX_DELAY) != pdTRUE) { }
+    xSemaphoreTake(ctx->stopped, portMAX_DELAY);
+
+    vQueueDelete(ctx->req_queue);
+    vSemaphoreDelete(ctx->drained);
+    vSemaphoreDelete(ctx->stopped);
+    free(ctx);
+    free(handle);
+    return ESP_OK;
+}
+
+static const esp_blockdev_ops_t async_blockdev_ops = {
+    .read = async_read,
+    .write = async_write,
+    .erase = async_erase,
+    .sync = async_sync,
+    .ioctl = async_ioctl,
+    .release = async_release,
+    .submit = async_submit,
+    .poll = async_poll,
+    .inflight_count = async_inflight_count,
+};
+
+esp_err_t esp_blockdev_async_wrap(esp_blockdev_handle_t base,
+                                  const esp_blockdev_async_config_t* config,
+                                  esp_blockdev_handle_t* out_handle)
+{
+    if (base == NULL || config == NULL || out_handle == NULL || config->queue_depth == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t err = ESP_ERR_NO_MEM;
+    esp_blockdev_handle_t out = (esp_blockdev_handle_t) calloc(1, sizeof(esp_blockdev_t));
+    async_ctx_t* ctx = (async_ctx_t*) calloc(1, sizeof(async_ctx_t));
+    if (out == NULL || ctx == NULL) {
+        goto fail;
+    }
+
+    ctx->base = base;
+    ctx->req_queue = xQueueCreate(config->queue_depth, sizeof(esp_blockdev_req_t*));
+    ctx->drained = xSemaphoreCreateBinary();
+    ctx->stopped = xSemaphoreCreateBinary();
+    if (ctx->req_queue == NULL || ctx->drained == NULL || ctx->stopped == NULL) {
+        goto fail;
+    }
+
+    if (xTaskCreatePinnedToCore(async_worker_task, "bdl_async", config->task_stack_size, ctx,
+                                config->task_priority, &ctx->worker,
+                                (config->task_core_id < 0) ? tskNO_AFFINITY : config->task_core_id) != pdPASS) {
+        ESP_LOGE(TAG, "failed to create the worker task");
+        goto fail;
+    }
+
+    out->ctx = ctx;
+    out->device_flags = base->device_flags;
+    out->geometry = base->geometry;
+    out->ops = &async_blockdev_ops;
+
+    *out_handle = out;
+    return ESP_OK;
+
+fail:
+    if (ctx != NULL) {
+        if (ctx->req_queue != NULL) {
+            vQueueDelete(ctx->req_queue);
+        }
+        if (ctx->drained != NULL) {
+            vSemaphoreDelete(ctx->drained);
+        }
+        if (ctx->stopped != NULL) {
+            vSemaphoreDelete(ctx->stopped);
+        }
+        free(ctx);
+    }
+    free(out);
+    *out_handle = ESP_BLOCKDEV_HANDLE_INVALID;
+    return err;
+}
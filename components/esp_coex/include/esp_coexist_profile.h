@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_ESP_COEX_PROFILE_ENABLE || defined __DOXYGEN__
+
+/*
+ * Coexistence profiles: named sets of arbitration parameters which can be
+ * switched at runtime as the application moves between phases (e.g. BLE
+ * provisioning while Wi-Fi streams). A profile expresses relative priority
+ * weights per traffic class; applying it maps the weights onto the controls
+ * the coexistence scheduler exposes (preference, arbitration window length,
+ * flexible period). Switches are rate-limited by a hysteresis interval so
+ * bursty phase changes don't thrash the scheduler, and counters record how
+ * switches and profile airtime were distributed.
+ */
+
+/**
+ * @brief Traffic classes weighted by a coexistence profile
+ */
+typedef enum {
+    ESP_COEX_TRAFFIC_WIFI_VOICE = 0, /*!< Latency-sensitive Wi-Fi traffic (voice, control) */
+    ESP_COEX_TRAFFIC_WIFI_BULK,      /*!< Throughput Wi-Fi traffic (streaming, OTA) */
+    ESP_COEX_TRAFFIC_BLE_CONN,       /*!< BLE connection events */
+    ESP_COEX_TRAFFIC_BLE_SCAN,       /*!< BLE scanning / advertising */
+    ESP_COEX_TRAFFIC_CLASS_NUM,
+} esp_coex_traffic_class_t;
+
+/// Maximum length of a profile name, including the terminating NUL
+#define ESP_COEX_PROFILE_NAME_LEN 16
+
+/**
+ * @brief One named coexistence profile
+ */
+typedef struct {
+    const char *name;                             /*!< Profile name, at most ESP_COEX_PROFILE_NAME_LEN-1 characters */
+    uint8_t weights[ESP_COEX_TRAFFIC_CLASS_NUM];  /*!< Relative priority weight per traffic class, 0-100 */
+    uint32_t schm_interval_ms;                    /*!< Arbitration window length handed to the scheduler, 0 keeps the current value */
+    uint8_t flexible_period;                      /*!< Flexible period of the scheduler, 0 keeps the current value */
+} esp_coex_profile_t;
+
+/**
+ * @brief Per-profile statistics
+ */
+typedef struct {
+    char name[ESP_COEX_PROFILE_NAME_LEN]; /*!< Profile name */
+    uint32_t times_applied;               /*!< Number of times this profile became active */
+    uint64_t total_active_us;             /*!< Accumulated time this profile was active */
+} esp_coex_profile_entry_stats_t;
+
+/**
+ * @brief Statistics of the profile engine
+ *
+ * The RF-level grant/deny decisions happen inside the coexistence scheduler
+ * and are not exported; the per-profile airtime below together with the
+ * scheduler phase getters (coex_schm_*) is the observable proxy for the
+ * airtime split.
+ */
+typedef struct {
+    uint32_t switches_applied;   /*!< Profile switches that took effect */
+    uint32_t switches_deferred;  /*!< Switch requests held back by the hysteresis interval */
+    uint32_t switches_coalesced; /*!< Deferred requests replaced by a newer one before taking effect */
+    uint32_t profile_count;      /*!< Number of registered profiles */
+    esp_coex_profile_entry_stats_t profiles[CONFIG_ESP_COEX_PROFILE_MAX]; /*!< Per-profile statistics */
+} esp_coex_profile_stats_t;
+
+/**
+ * @brief Register a coexistence profile
+ *
+ * The profile contents are copied; re-registering an existing name updates
+ * the stored parameters (they take effect on the next apply).
+ *
+ * @param profile Profile to register
+ * @return
+ *      - ESP_OK: profile registered
+ *      - ESP_ERR_INVALID_ARG: profile or name is NULL, or the name is too long
+ *      - ESP_ERR_NO_MEM: profile table is full (CONFIG_ESP_COEX_PROFILE_MAX)
+ */
+esp_err_t esp_coex_profile_register(const esp_coex_profile_t *profile);
+
+/**
+ * @brief Make a registered profile the active one
+ *
+ * When called within the hysteresis interval of the previous switch, the
+ * request is stored and applied when the interval expires; a newer request
+ * arriving before that replaces the stored one.
+ *
+ * @param name Name of a registered profile
+ * @return
+ *      - ESP_OK: profile applied or scheduled
+ *      - ESP_ERR_NOT_FOUND: no profile with this name
+ *      - ESP_ERR_INVALID_ARG: name is NULL
+ */
+esp_err_t esp_coex_profile_apply(const char *name);
+
+/**
+ * @brief Get the name of the active profile
+ *
+ * @param[out] out_name Buffer of at least ESP_COEX_PROFILE_NAME_LEN bytes
+ * @return
+ *      - ESP_OK: name copied
+ *      - ESP_ERR_INVALID_ARG: out_name is NULL
+ *      - ESP_ERR_INVALID_STATE: no profile was applied yet
+ */
+esp_err_t esp_coex_profile_get_active(char *out_name);
+
+/**
+ * @brief Set the minimum time between two profile switches
+ *
+ * @param min_dwell_ms Hysteresis interval in milliseconds, 0 disables it
+ * @return ESP_OK
+ */
+esp_err_t esp_coex_profile_set_hysteresis(uint32_t min_dwell_ms);
+
+/**
+ * @brief Get the statistics of the profile engine
+ *
+ * @param[out] out_stats Statistics destination
+ * @return
+ *      - ESP_OK: statistics copied
+ *      - ESP_ERR_INVALID_ARG: out_stats is NULL
+ */
+esp_err_t esp_coex_profile_get_stats(esp_coex_profile_stats_t *out_stats);
+
+/**
+ * @brief Reset the statistics counters (registered profiles stay untouched)
+ */
+void esp_coex_profile_reset_stats(void);
+
+#endif // CONFIG_ESP_COEX_PROFILE_ENABLE || defined __DOXYGEN__
+
+#ifdef __cplusplus
+}
+#endif
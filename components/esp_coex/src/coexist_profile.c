@@ -0,0 +1,260 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+
+#if CONFIG_ESP_COEX_PROFILE_ENABLE
+
+#include "esp_coexist.h"
+#include "esp_coexist_profile.h"
+#include "private/esp_coexist_internal.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+
+static const char *TAG = "coex_profile";
+
+typedef struct {
+    char name[ESP_COEX_PROFILE_NAME_LEN];
+    uint8_t weights[ESP_COEX_TRAFFIC_CLASS_NUM];
+    uint32_t schm_interval_ms;
+    uint8_t flexible_period;
+    uint32_t times_applied;
+    uint64_t total_active_us;
+} profile_slot_t;
+
+static profile_slot_t s_profiles[CONFIG_ESP_COEX_PROFILE_MAX];
+static uint32_t s_profile_count;
+static int s_active_idx = -1;
+static int s_pending_idx = -1;
+static int64_t s_active_since_us;
+static int64_t s_last_switch_us;
+static uint32_t s_min_dwell_ms = CONFIG_ESP_COEX_PROFILE_MIN_DWELL_MS;
+static uint32_t s_switches_applied;
+static uint32_t s_switches_deferred;
+static uint32_t s_switches_coalesced;
+static esp_timer_handle_t s_dwell_timer;
+static portMUX_TYPE s_profile_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static int profile_find(const char *name)
+{
+    for (uint32_t i = 0; i < s_profile_count; i++) {
+        if (strcmp(s_profiles[i].name, name) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+/* Collapse the per-class weights onto the preference knob the scheduler
+ * exposes. Connection-oriented classes count double: missing a BLE connection
+ * event or a voice deadline costs more than a delayed bulk/scan window. */
+static esp_coex_prefer_t profile_preference(const profile_slot_t *p)
+{
+    uint32_t wifi = 2 * p->weights[ESP_COEX_TRAFFIC_WIFI_VOICE] + p->weights[ESP_COEX_TRAFFIC_WIFI_BULK];
+    uint32_t bt = 2 * p->weights[ESP_COEX_TRAFFIC_BLE_CONN] + p->weights[ESP_COEX_TRAFFIC_BLE_SCAN];
+    /* Within ~15 % of each other the split is best left to the scheduler */
+    if (wifi > bt + bt / 8) {
+        return ESP_COEX_PREFER_WIFI;
+    }
+    if (bt > wifi + wifi / 8) {
+        return ESP_COEX_PREFER_BT;
+    }
+    return ESP_COEX_PREFER_BALANCE;
+}
+
+/* Must be called without s_profile_mux held: the coex_* calls may block */
+static void profile_do_apply(int idx)
+{
+    profile_slot_t *p = &s_profiles[idx];
+
+    esp_err_t err = coex_preference_set((coex_prefer_t)profile_preference(p));
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "preference set failed for \"%s\" (0x%x)", p->name, err);
+    }
+    if (p->schm_interval_ms != 0) {
+        coex_schm_interval_set(p->schm_interval_ms);
+    }
+    if (p->flexible_period != 0) {
+        coex_schm_flexible_period_set(p->flexible_period);
+    }
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_profile_mux);
+    if (s_active_idx >= 0) {
+        s_profiles[s_active_idx].total_active_us += (uint64_t)(now - s_active_since_us);
+    }
+    s_active_idx = idx;
+    s_active_since_us = now;
+    s_last_switch_us = now;
+    p->times_applied++;
+    s_switches_applied++;
+    portEXIT_CRITICAL(&s_profile_mux);
+
+    ESP_LOGD(TAG, "profile \"%s\" active", p->name);
+}
+
+static void dwell_timer_cb(void *arg)
+{
+    portENTER_CRITICAL(&s_profile_mux);
+    int idx = s_pending_idx;
+    s_pending_idx = -1;
+    portEXIT_CRITICAL(&s_profile_mux);
+    if (idx >= 0 && idx != s_active_idx) {
+        profile_do_apply(idx);
+    }
+}
+
+static esp_err_t ensure_dwell_timer(void)
+{
+    if (s_dwell_timer != NULL) {
+        return ESP_OK;
+    }
+    const esp_timer_create_args_t args = {
+        .callback = dwell_timer_cb,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "coex_profile",
+    };
+    return esp_timer_create(&args, &s_dwell_timer);
+}
+
+esp_err_t esp_coex_profile_register(const esp_coex_profile_t *profile)
+{
+    if (profile == NULL || profile->name == NULL ||
+            strlen(profile->name) >= ESP_COEX_PROFILE_NAME_LEN) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int idx = profile_find(profile->name);
+    if (idx < 0) {
+        if (s_profile_count >= CONFIG_ESP_COEX_PROFILE_MAX) {
+            return ESP_ERR_NO_MEM;
+        }
+        idx = (int)s_profile_count;
+    }
+
+    profile_slot_t *slot = &s_profiles[idx];
+    portENTER_CRITICAL(&s_profile_mux);
+    strlcpy(slot->name, profile->name, sizeof(slot->name));
+    memcpy(slot->weights, profile->weights, sizeof(slot->weights));
+    slot->schm_interval_ms = profile->schm_interval_ms;
+    slot->flexible_period = profile->flexible_period;
+    if (idx == (int)s_profile_count) {
+        s_profile_count++;
+    }
+    portEXIT_CRITICAL(&s_profile_mux);
+    return ESP_OK;
+}
+
+esp_err_t esp_coex_profile_apply(const char *name)
+{
+    if (name == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int idx = profile_find(name);
+    if (idx < 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    esp_err_t err = ensure_dwell_timer();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    int64_t now = esp_timer_get_time();
+    bool defer = false;
+    int64_t remaining_us = 0;
+    portENTER_CRITICAL(&s_profile_mux);
+    if (s_min_dwell_ms != 0 && s_active_idx >= 0) {
+        int64_t elapsed = now - s_last_switch_us;
+        if (elapsed < (int64_t)s_min_dwell_ms * 1000) {
+            if (s_pending_idx >= 0 && s_pending_idx != idx) {
+                s_switches_coalesced++;
+            }
+            s_pending_idx = idx;
+            s_switches_deferred++;
+            remaining_us = (int64_t)s_min_dwell_ms * 1000 - elapsed;
+            defer = true;
+        }
+    }
+    portEXIT_CRITICAL(&s_profile_mux);
+
+    if (defer) {
+        /* Re-arming an already running timer just moves the deadline; the
+         * callback always applies the latest pending profile. */
+        esp_timer_stop(s_dwell_timer);
+        return esp_timer_start_once(s_dwell_timer, remaining_us);
+    }
+    if (idx != s_active_idx) {
+        profile_do_apply(idx);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_coex_profile_get_active(char *out_name)
+{
+    if (out_name == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_OK;
+    portENTER_CRITICAL(&s_profile_mux);
+    if (s_active_idx < 0) {
+        err = ESP_ERR_INVALID_STATE;
+    } else {
+        strlcpy(out_name, s_profiles[s_active_idx].name, ESP_COEX_PROFILE_NAME_LEN);
+    }
+    portEXIT_CRITICAL(&s_profile_mux);
+    return err;
+}
+
+esp_err_t esp_coex_profile_set_hysteresis(uint32_t min_dwell_ms)
+{
+    portENTER_CRITICAL(&s_profile_mux);
+    s_min_dwell_ms = min_dwell_ms;
+    portEXIT_CRITICAL(&s_profile_mux);
+    return ESP_OK;
+}
+
+esp_err_t esp_coex_profile_get_stats(esp_coex_profile_stats_t *out_stats)
+{
+    if (out_stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(out_stats, 0, sizeof(*out_stats));
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_profile_mux);
+    out_stats->switches_applied = s_switches_applied;
+    out_stats->switches_deferred = s_switches_deferred;
+    out_stats->switches_coalesced = s_switches_coalesced;
+    out_stats->profile_count = s_profile_count;
+    for (uint32_t i = 0; i < s_profile_count; i++) {
+        strlcpy(out_stats->profiles[i].name, s_profiles[i].name, ESP_COEX_PROFILE_NAME_LEN);
+        out_stats->profiles[i].times_applied = s_profiles[i].times_applied;
+        out_stats->profiles[i].total_active_us = s_profiles[i].total_active_us;
+        if ((int)i == s_active_idx) {
+            out_stats->profiles[i].total_active_us += (uint64_t)(now - s_active_since_us);
+        }
+    }
+    portEXIT_CRITICAL(&s_profile_mux);
+    return ESP_OK;
+}
+
+void esp_coex_profile_reset_stats(void)
+{
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_profile_mux);
+    s_switches_applied = 0;
+    s_switches_deferred = 0;
+    s_switches_coalesced = 0;
+    for (uint32_t i = 0; i < s_profile_count; i++) {
+        s_profiles[i].times_applied = 0;
+        s_profiles[i].total_active_us = 0;
+    }
+    s_active_since_us = now;
+    portEXIT_CRITICAL(&s_profile_mux);
+}
+
+#endif // CONFIG_ESP_COEX_PROFILE_ENABLE
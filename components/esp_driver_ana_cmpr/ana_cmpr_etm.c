@@ -37,3 +37,59 @@ esp_err_t ana_cmpr_new_etm_event(ana_cmpr_handle_t cmpr, const ana_cmpr_etm_even
     *ret_event = &event->base;
     return ESP_OK;
 }
+
+typedef struct ana_cmpr_etm_trip_chain_t {
+    esp_etm_event_handle_t event;       // comparator cross event shared by all channels of the chain
+    size_t num_channels;
+    esp_etm_channel_handle_t channels[];
+} ana_cmpr_etm_trip_chain_t;
+
+esp_err_t ana_cmpr_new_etm_trip_chain(ana_cmpr_handle_t cmpr, const ana_cmpr_etm_trip_chain_config_t *config, ana_cmpr_etm_trip_chain_handle_t *ret_chain)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(cmpr && config && ret_chain, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->tasks && config->num_tasks, ESP_ERR_INVALID_ARG, TAG, "empty task array");
+
+    ana_cmpr_etm_trip_chain_t *chain = heap_caps_calloc(1, sizeof(ana_cmpr_etm_trip_chain_t) +
+                                                        config->num_tasks * sizeof(esp_etm_channel_handle_t), ETM_MEM_ALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(chain, ESP_ERR_NO_MEM, TAG, "no mem for trip chain");
+
+    ana_cmpr_etm_event_config_t evt_cfg = {
+        .event_type = config->event_type,
+    };
+    ESP_GOTO_ON_ERROR(ana_cmpr_new_etm_event(cmpr, &evt_cfg, &chain->event), err, TAG, "create cross event failed");
+
+    // one ETM channel per task, all of them triggered by the same cross event
+    esp_etm_channel_config_t chan_cfg = {};
+    for (size_t i = 0; i < config->num_tasks; i++) {
+        ESP_GOTO_ON_FALSE(config->tasks[i], ESP_ERR_INVALID_ARG, err, TAG, "invalid task handle");
+        ESP_GOTO_ON_ERROR(esp_etm_new_channel(&chan_cfg, &chain->channels[i]), err, TAG, "allocate ETM channel failed");
+        chain->num_channels++;
+        ESP_GOTO_ON_ERROR(esp_etm_channel_connect(chain->channels[i], chain->event, config->tasks[i]), err, TAG, "connect ETM channel failed");
+        ESP_GOTO_ON_ERROR(esp_etm_channel_enable(chain->channels[i]), err, TAG, "enable ETM channel failed");
+    }
+
+    ESP_LOGD(TAG, "new trip chain @%p, %d tasks", chain, (int)chain->num_channels);
+    *ret_chain = chain;
+    return ESP_OK;
+
+err:
+    ana_cmpr_del_etm_trip_chain(chain);
+    return ret;
+}
+
+esp_err_t ana_cmpr_del_etm_trip_chain(ana_cmpr_etm_trip_chain_handle_t chain)
+{
+    ESP_RETURN_ON_FALSE(chain, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    for (size_t i = 0; i < chain->num_channels; i++) {
+        // the channel might not be enabled if the chain setup bailed out halfway
+        esp_etm_channel_disable(chain->channels[i]);
+        ESP_RETURN_ON_ERROR(esp_etm_del_channel(chain->channels[i]), TAG, "delete ETM channel failed");
+    }
+    if (chain->event) {
+        ESP_RETURN_ON_ERROR(esp_etm_del_event(chain->event), TAG, "delete cross event failed");
+    }
+    free(chain);
+    return ESP_OK;
+}
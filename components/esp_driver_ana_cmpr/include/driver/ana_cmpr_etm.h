@@ -48,6 +48,54 @@ typedef struct {
  */
 esp_err_t ana_cmpr_new_etm_event(ana_cmpr_handle_t cmpr, const ana_cmpr_etm_event_config_t *config, esp_etm_event_handle_t *ret_event);
 
+/**
+ * @brief Type of Analog Comparator ETM trip chain handle
+ */
+typedef struct ana_cmpr_etm_trip_chain_t *ana_cmpr_etm_trip_chain_handle_t;
+
+/**
+ * @brief Analog Comparator ETM trip chain configuration
+ */
+typedef struct {
+    ana_cmpr_event_type_t event_type;       /*!< Which kind of cross type triggers the chained tasks */
+    const esp_etm_task_handle_t *tasks;     /*!< Array of the ETM tasks to trigger on the cross event,
+                                                 e.g. an MCPWM brake task or a GPTimer capture task */
+    size_t num_tasks;                       /*!< Number of tasks in the array */
+} ana_cmpr_etm_trip_chain_config_t;
+
+/**
+ * @brief Allocate and enable an Analog Comparator ETM trip chain
+ *
+ * The trip chain wires one comparator cross event to a group of ETM tasks in hardware,
+ * so that the tasks (e.g. the MCPWM one-shot brake trip and the GPTimer counter capture)
+ * are triggered without any CPU involvement. The chain allocates one ETM channel per task
+ * and enables all of them before returning. The task handles stay owned by the caller,
+ * so that e.g. the captured timestamp can be queried afterwards via `gptimer_get_captured_count`.
+ *
+ * @param[in]  cmpr         Analog Comparator handle that allocated by `ana_cmpr_new_unit`
+ * @param[in]  config       Analog Comparator ETM trip chain configuration
+ * @param[out] ret_chain    The returned trip chain handle
+ * @return
+ *      - ESP_OK                Success to create and enable the trip chain
+ *      - ESP_ERR_NO_MEM        No memory for the trip chain
+ *      - ESP_ERR_INVALID_ARG   NULL pointer of the input parameters or empty task array
+ *      - ESP_ERR_NOT_FOUND     No free ETM channel for the chain
+ */
+esp_err_t ana_cmpr_new_etm_trip_chain(ana_cmpr_handle_t cmpr, const ana_cmpr_etm_trip_chain_config_t *config, ana_cmpr_etm_trip_chain_handle_t *ret_chain);
+
+/**
+ * @brief Disable and delete an Analog Comparator ETM trip chain
+ *
+ * Disables and frees the ETM channels and the comparator event that were allocated by
+ * `ana_cmpr_new_etm_trip_chain`. The chained tasks are not deleted, they still belong to the caller.
+ *
+ * @param[in]  chain        Trip chain handle that allocated by `ana_cmpr_new_etm_trip_chain`
+ * @return
+ *      - ESP_OK                Success to delete the trip chain
+ *      - ESP_ERR_INVALID_ARG   NULL pointer of the input parameters
+ */
+esp_err_t ana_cmpr_del_etm_trip_chain(ana_cmpr_etm_trip_chain_handle_t chain);
+
 #ifdef __cplusplus
 }
 #endif
@@ -157,3 +157,46 @@ TEST_CASE("ana_cmpr etm event", "[ana_cmpr][etm]")
 
     TEST_ASSERT_UINT_WITHIN(TEST_TIME_US * 0.1, TEST_TIME_US, cnt_us);
 }
+
+TEST_CASE("ana_cmpr etm trip chain", "[ana_cmpr][etm]")
+{
+    gptimer_handle_t gptimer = test_ana_cmpr_gptimer_init();
+    TEST_ESP_OK(gptimer_start(gptimer));
+    ana_cmpr_handle_t cmpr = test_ana_cmpr_init();
+    int src_gpio = test_init_src_chan_gpio(TEST_ANA_CMPR_UNIT_ID, 1);
+
+    /* Allocate the GPTimer capture task, it stays owned by the test so the timestamp can be queried */
+    esp_etm_task_handle_t gptimer_cap_task = NULL;
+    gptimer_etm_task_config_t gptimer_etm_task_conf = {
+        .task_type = GPTIMER_ETM_TASK_CAPTURE,
+    };
+    TEST_ESP_OK(gptimer_new_etm_task(gptimer, &gptimer_etm_task_conf, &gptimer_cap_task));
+
+    /* Wire the negative cross event to the capture task with one call */
+    ana_cmpr_etm_trip_chain_handle_t chain = NULL;
+    ana_cmpr_etm_trip_chain_config_t chain_cfg = {
+        .event_type = ANA_CMPR_EVENT_NEG_CROSS,
+        .tasks = &gptimer_cap_task,
+        .num_tasks = 1,
+    };
+    TEST_ESP_OK(ana_cmpr_new_etm_trip_chain(cmpr, &chain_cfg, &chain));
+
+    // negedge after ~TEST_TIME_US, the hardware captures the timestamp without CPU involvement
+    TEST_ESP_OK(gptimer_set_raw_count(gptimer, 0));
+    esp_rom_delay_us(TEST_TIME_US);
+    gpio_set_level(src_gpio, 0);
+    esp_rom_delay_us(100);
+    gpio_set_level(src_gpio, 1);
+
+    uint64_t cap_us = 0;
+    TEST_ESP_OK(gptimer_get_captured_count(gptimer, &cap_us));
+    printf("Captured: %" PRIu64 "\n", cap_us);
+
+    TEST_ESP_OK(ana_cmpr_del_etm_trip_chain(chain));
+    TEST_ESP_OK(esp_etm_del_task(gptimer_cap_task));
+    test_ana_cmpr_deinit(cmpr);
+    TEST_ESP_OK(gptimer_stop(gptimer));
+    test_ana_cmpr_gptimer_deinit(gptimer);
+
+    TEST_ASSERT_UINT_WITHIN(TEST_TIME_US * 0.1, TEST_TIME_US, cap_us);
+}
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "soc/soc_caps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Handle for a BitScrambler format converter instance
+ */
+typedef struct esp_bs_convert_t *esp_bs_convert_handle_t;
+
+/**
+ * @brief Pixel/byte swizzle conversions with prebuilt BitScrambler programs
+ */
+typedef enum {
+    ESP_BS_CONVERT_RGB888_TO_RGB565,    /*!< Pack 24-bit R,G,B byte triplets into little-endian RGB565 */
+    ESP_BS_CONVERT_RGB888_TO_BGR888,    /*!< Swap the R and B bytes of 24-bit pixels */
+    ESP_BS_CONVERT_SWAP_BYTES_16,       /*!< Swap the two bytes of each 16-bit word (e.g. RGB565 endianness) */
+    ESP_BS_CONVERT_SWAP_BYTES_32,       /*!< Reverse the four bytes of each 32-bit word */
+    ESP_BS_CONVERT_MAX,                 /*!< Number of available conversions, invalid as an argument */
+} esp_bs_convert_format_t;
+
+/**
+ * @brief Create a format converter
+ *
+ * On chips with a BitScrambler the converter claims a hardware channel in loopback mode and loads
+ * the validated program for the requested conversion; the data then moves through loopback DMA
+ * without CPU involvement. When the peripheral is not available, or no free channel is left, the
+ * converter transparently falls back to a CPU implementation with identical results.
+ *
+ * @param[in] format The conversion to perform, see `esp_bs_convert_format_t`
+ * @param[in] attach_to Peripheral to attach the BitScrambler to, one of SOC_BITSCRAMBLER_ATTACH_.
+ *        See `bitscrambler_loopback_create` for the attachment semantics. Ignored by the CPU fallback.
+ * @param[in] max_transfer_sz_bytes Maximum size of the input or output of one `esp_bs_convert` call
+ * @param[out] ret_handle Returned converter handle
+ *
+ * @return
+ *        - ESP_OK
+ *        - ESP_ERR_INVALID_ARG: Invalid argument passed to function
+ *        - ESP_ERR_NO_MEM: No memory available
+ */
+esp_err_t esp_bs_convert_create(esp_bs_convert_format_t format, int attach_to, size_t max_transfer_sz_bytes, esp_bs_convert_handle_t *ret_handle);
+
+/**
+ * @brief Convert a buffer
+ *
+ * @note `src_len` must be a multiple of the conversion's input unit (3 bytes for the RGB888
+ *       conversions, 2 or 4 bytes for the byte swaps). In-place conversion (src == dst) is only
+ *       allowed for the conversions that keep the pixel size.
+ *
+ * @param[in] handle Converter handle
+ * @param[in] src Input buffer
+ * @param[in] src_len Size of the input data, in bytes
+ * @param[out] dst Output buffer
+ * @param[in] dst_size Size of the output buffer, in bytes
+ * @param[out] out_len Optional, the number of bytes written to the output buffer
+ *
+ * @return
+ *        - ESP_OK
+ *        - ESP_ERR_INVALID_ARG: Invalid argument passed to function
+ *        - ESP_ERR_INVALID_SIZE: Input not a multiple of the conversion unit, output buffer too
+ *          small, or a buffer exceeds max_transfer_sz_bytes
+ *        - ESP_ERR_TIMEOUT: The BitScrambler program did not complete
+ */
+esp_err_t esp_bs_convert(esp_bs_convert_handle_t handle, const void *src, size_t src_len, void *dst, size_t dst_size, size_t *out_len);
+
+/**
+ * @brief Whether the converter runs on the BitScrambler rather than the CPU fallback
+ *
+ * @param[in] handle Converter handle
+ *
+ * @return True when conversions are offloaded to the BitScrambler
+ */
+bool esp_bs_convert_is_accelerated(esp_bs_convert_handle_t handle);
+
+/**
+ * @brief Delete a format converter and release its BitScrambler channel, if any
+ *
+ * @param[in] handle Converter handle
+ *
+ * @return
+ *        - ESP_OK
+ *        - ESP_ERR_INVALID_ARG: Invalid handle
+ */
+esp_err_t esp_bs_convert_delete(esp_bs_convert_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "soc/soc_caps.h"
+#include "driver/bitscrambler_convert.h"
+#if SOC_BITSCRAMBLER_SUPPORTED
+#include "driver/bitscrambler.h"
+#include "driver/bitscrambler_loopback.h"
+#endif
+
+static const char *TAG = "bs_convert";
+
+typedef struct {
+    uint8_t in_unit;   // input bytes per pixel/word
+    uint8_t out_unit;  // output bytes per pixel/word
+} esp_bs_convert_unit_t;
+
+static const esp_bs_convert_unit_t s_convert_units[ESP_BS_CONVERT_MAX] = {
+    [ESP_BS_CONVERT_RGB888_TO_RGB565] = { .in_unit = 3, .out_unit = 2 },
+    [ESP_BS_CONVERT_RGB888_TO_BGR888] = { .in_unit = 3, .out_unit = 3 },
+    [ESP_BS_CONVERT_SWAP_BYTES_16]    = { .in_unit = 2, .out_unit = 2 },
+    [ESP_BS_CONVERT_SWAP_BYTES_32]    = { .in_unit = 4, .out_unit = 4 },
+};
+
+#if SOC_BITSCRAMBLER_SUPPORTED
+BITSCRAMBLER_PROGRAM(bs_program_rgb888_to_rgb565, "bs_convert_rgb888_to_rgb565");
+BITSCRAMBLER_PROGRAM(bs_program_rgb888_to_bgr888, "bs_convert_rgb888_to_bgr888");
+BITSCRAMBLER_PROGRAM(bs_program_swap_bytes_16, "bs_convert_swap_bytes_16");
+BITSCRAMBLER_PROGRAM(bs_program_swap_bytes_32, "bs_convert_swap_bytes_32");
+
+static const uint8_t *s_convert_programs[ESP_BS_CONVERT_MAX] = {
+    [ESP_BS_CONVERT_RGB888_TO_RGB565] = bs_program_rgb888_to_rgb565,
+    [ESP_BS_CONVERT_RGB888_TO_BGR888] = bs_program_rgb888_to_bgr888,
+    [ESP_BS_CONVERT_SWAP_BYTES_16]    = bs_program_swap_bytes_16,
+    [ESP_BS_CONVERT_SWAP_BYTES_32]    = bs_program_swap_bytes_32,
+};
+#endif // SOC_BITSCRAMBLER_SUPPORTED
+
+struct esp_bs_convert_t {
+    esp_bs_convert_format_t format;
+    size_t max_transfer_sz_bytes;
+#if SOC_BITSCRAMBLER_SUPPORTED
+    bitscrambler_handle_t bs;  // NULL when running the CPU fallback
+#endif
+};
+
+// CPU implementations, bit-exact with the BitScrambler programs
+static void s_convert_on_cpu(esp_bs_convert_format_t format, const uint8_t *src, size_t src_len, uint8_t *dst)
+{
+    switch (format) {
+    case ESP_BS_CONVERT_RGB888_TO_RGB565:
+        for (size_t i = 0, o = 0; i < src_len; i += 3, o += 2) {
+            uint16_t pixel = ((src[i] & 0xF8) << 8) | ((src[i + 1] & 0xFC) << 3) | (src[i + 2] >> 3);
+            dst[o] = pixel & 0xFF;
+            dst[o + 1] = pixel >> 8;
+        }
+        break;
+    case ESP_BS_CONVERT_RGB888_TO_BGR888:
+        for (size_t i = 0; i < src_len; i += 3) {
+            uint8_t r = src[i];
+            dst[i] = src[i + 2];
+            dst[i + 1] = src[i + 1];
+            dst[i + 2] = r;
+        }
+        break;
+    case ESP_BS_CONVERT_SWAP_BYTES_16:
+        for (size_t i = 0; i < src_len; i += 2) {
+            uint8_t low = src[i];
+            dst[i] = src[i + 1];
+            dst[i + 1] = low;
+        }
+        break;
+    case ESP_BS_CONVERT_SWAP_BYTES_32:
+        for (size_t i = 0; i < src_len; i += 4) {
+            uint8_t b0 = src[i];
+            uint8_t b1 = src[i + 1];
+            dst[i] = src[i + 3];
+            dst[i + 1] = src[i + 2];
+            dst[i + 2] = b1;
+            dst[i + 3] = b0;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+esp_err_t esp_bs_convert_create(esp_bs_convert_format_t format, int attach_to, size_t max_transfer_sz_bytes, esp_bs_convert_handle_t *ret_handle)
+{
+    ESP_RETURN_ON_FALSE(format < ESP_BS_CONVERT_MAX && max_transfer_sz_bytes > 0 && ret_handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    struct esp_bs_convert_t *cvt = heap_caps_calloc(1, sizeof(struct esp_bs_convert_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(cvt, ESP_ERR_NO_MEM, TAG, "no mem for converter");
+    cvt->format = format;
+    cvt->max_transfer_sz_bytes = max_transfer_sz_bytes;
+
+#if SOC_BITSCRAMBLER_SUPPORTED
+    esp_err_t ret = bitscrambler_loopback_create(&cvt->bs, attach_to, max_transfer_sz_bytes);
+    if (ret == ESP_OK) {
+        ret = bitscrambler_load_program(cvt->bs, s_convert_programs[format]);
+        if (ret != ESP_OK) {
+            bitscrambler_free(cvt->bs);
+            cvt->bs = NULL;
+        }
+    }
+    if (cvt->bs == NULL) {
+        // No free channel or program load failure: keep working, just on the CPU
+        ESP_LOGW(TAG, "BitScrambler not available (%s), using CPU fallback", esp_err_to_name(ret));
+    }
+#else
+    (void)attach_to;
+#endif
+
+    *ret_handle = cvt;
+    return ESP_OK;
+}
+
+esp_err_t esp_bs_convert(esp_bs_convert_handle_t handle, const void *src, size_t src_len, void *dst, size_t dst_size, size_t *out_len)
+{
+    ESP_RETURN_ON_FALSE(handle && src && dst, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    const esp_bs_convert_unit_t *unit = &s_convert_units[handle->format];
+    ESP_RETURN_ON_FALSE(src_len % unit->in_unit == 0, ESP_ERR_INVALID_SIZE, TAG, "input not a multiple of %d bytes", unit->in_unit);
+    size_t needed = src_len / unit->in_unit * unit->out_unit;
+    ESP_RETURN_ON_FALSE(dst_size >= needed, ESP_ERR_INVALID_SIZE, TAG, "output buffer too small");
+    ESP_RETURN_ON_FALSE(src_len <= handle->max_transfer_sz_bytes && needed <= handle->max_transfer_sz_bytes, ESP_ERR_INVALID_SIZE, TAG, "buffer exceeds max transfer size");
+
+#if SOC_BITSCRAMBLER_SUPPORTED
+    if (handle->bs) {
+        size_t written = 0;
+        ESP_RETURN_ON_ERROR(bitscrambler_loopback_run(handle->bs, (void *)src, src_len, dst, needed, &written), TAG, "loopback run failed");
+        ESP_RETURN_ON_FALSE(written == needed, ESP_FAIL, TAG, "unexpected output length");
+        if (out_len) {
+            *out_len = written;
+        }
+        return ESP_OK;
+    }
+#endif
+
+    s_convert_on_cpu(handle->format, src, src_len, dst);
+    if (out_len) {
+        *out_len = needed;
+    }
+    return ESP_OK;
+}
+
+bool esp_bs_convert_is_accelerated(esp_bs_convert_handle_t handle)
+{
+#if SOC_BITSCRAMBLER_SUPPORTED
+    return handle && handle->bs;
+#else
+    return false;
+#endif
+}
+
+esp_err_t esp_bs_convert_delete(esp_bs_convert_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+#if SOC_BITSCRAMBLER_SUPPORTED
+    if (handle->bs) {
+        bitscrambler_free(handle->bs);
+    }
+#endif
+    free(handle);
+    return ESP_OK;
+}
@@ -53,6 +53,11 @@ static esp_err_t s_csi_ctlr_disable(esp_cam_ctlr_handle_t ctlr);
 static esp_err_t s_ctlr_csi_receive(esp_cam_ctlr_handle_t handle, esp_cam_ctlr_trans_t *trans, uint32_t timeout_ms);
 static void *s_csi_ctlr_alloc_buffer(esp_cam_ctlr_t *handle, size_t size, uint32_t buf_caps);
 static esp_err_t s_csi_ctlr_format_conversion(esp_cam_ctlr_t *handle, const cam_ctlr_format_conv_config_t *config);
+static esp_err_t s_csi_ctlr_set_line_window(esp_cam_ctlr_t *handle, uint32_t start_line, uint32_t line_num);
+static bool s_csi_config_next_segment(csi_controller_t *ctlr, dw_gdma_channel_handle_t chan, uint8_t *frame_buf);
+
+//number of lines the discard bounce buffer can hold, each chunk of skipped lines costs one dma interrupt
+#define CSI_LINE_WINDOW_DISCARD_LINES    16
 
 static esp_err_t s_csi_claim_controller(csi_controller_t *controller)
 {
@@ -229,6 +234,7 @@ esp_err_t esp_cam_new_csi_ctlr(const esp_cam_ctlr_csi_config_t *config, esp_cam_
     ctlr->base.get_buffer_len = s_csi_ctlr_get_buffer_length;
     ctlr->base.alloc_buffer = s_csi_ctlr_alloc_buffer;
     ctlr->base.format_conversion = s_csi_ctlr_format_conversion;
+    ctlr->base.set_line_window = s_csi_ctlr_set_line_window;
 
     *ret_handle = &(ctlr->base);
 
@@ -268,6 +274,9 @@ esp_err_t s_del_csi_ctlr(csi_controller_t *ctlr)
     if (!ctlr->bk_buffer_dis) {
         free(ctlr->backup_buffer);
     }
+    if (ctlr->discard_buffer) {
+        free(ctlr->discard_buffer);
+    }
     vQueueDeleteWithCaps(ctlr->trans_que);
     free(ctlr);
 
@@ -311,6 +320,51 @@ static esp_err_t s_csi_ctlr_get_buffer_length(esp_cam_ctlr_handle_t handle, size
     return ESP_OK;
 }
 
+//Configure the DMA for the next segment of the current frame: window lines go to the frame
+//buffer, lines outside the window are bounced into the discard buffer chunk by chunk.
+//Returns false when all lines of the frame have been transferred.
+IRAM_ATTR static bool s_csi_config_next_segment(csi_controller_t *ctlr, dw_gdma_channel_handle_t chan, uint8_t *frame_buf)
+{
+    uint32_t line = ctlr->seg_line;
+    uint32_t lines = 0;
+    uint32_t dst = 0;
+
+    if (line >= ctlr->v_res) {
+        return false;
+    }
+    if (line < ctlr->cur_win_start) {
+        lines = MIN(ctlr->cur_win_start - line, ctlr->discard_lines);
+        dst = (uint32_t)ctlr->discard_buffer;
+    } else if (line < ctlr->cur_win_start + ctlr->cur_win_lines) {
+        lines = ctlr->cur_win_lines;
+        dst = (uint32_t)frame_buf;
+    } else {
+        lines = MIN(ctlr->v_res - line, ctlr->discard_lines);
+        dst = (uint32_t)ctlr->discard_buffer;
+    }
+    ctlr->seg_line = line + lines;
+
+    dw_gdma_block_transfer_config_t csi_dma_transfer_config = {
+        .src = {
+            .addr = MIPI_CSI_BRG_MEM_BASE,
+            .burst_mode = DW_GDMA_BURST_MODE_FIXED,
+            .burst_items = DW_GDMA_BURST_ITEMS_512,
+            .burst_len = 16,
+            .width = DW_GDMA_TRANS_WIDTH_64,
+        },
+        .dst = {
+            .addr = dst,
+            .burst_mode = DW_GDMA_BURST_MODE_INCREMENT,
+            .burst_items = DW_GDMA_BURST_ITEMS_512,
+            .burst_len = 16,
+            .width = DW_GDMA_TRANS_WIDTH_64,
+        },
+        .size = lines * ctlr->line_words,
+    };
+    dw_gdma_channel_config_transfer(chan, &csi_dma_transfer_config);
+    return true;
+}
+
 IRAM_ATTR static bool csi_dma_trans_done_callback(dw_gdma_channel_handle_t chan, const dw_gdma_trans_done_event_data_t *event_data, void *user_data)
 {
     bool need_yield = false;
@@ -318,6 +372,16 @@ IRAM_ATTR static bool csi_dma_trans_done_callback(dw_gdma_channel_handle_t chan,
     csi_controller_t *ctlr = (csi_controller_t *)user_data;
     bool has_new_trans = false;
 
+    //line window mode: intermediate segments of the frame, nothing to deliver yet
+    if (ctlr->cur_win_lines && s_csi_config_next_segment(ctlr, chan, ctlr->trans.buffer)) {
+        dw_gdma_channel_enable_ctrl(chan, true);
+        return false;
+    }
+    //size of the frame that just finished, before the pending window is latched
+    size_t finished_size = ctlr->cur_win_lines ? ctlr->cur_win_lines * ctlr->line_bytes : ctlr->fb_size_in_bytes;
+    //size the next transaction buffer must have, based on the pending window
+    size_t next_trans_size = ctlr->win_line_num ? ctlr->win_line_num * ctlr->line_bytes : ctlr->fb_size_in_bytes;
+
     dw_gdma_block_transfer_config_t csi_dma_transfer_config = {};
     csi_dma_transfer_config = (dw_gdma_block_transfer_config_t) {
         .src = {
@@ -340,12 +404,12 @@ IRAM_ATTR static bool csi_dma_trans_done_callback(dw_gdma_channel_handle_t chan,
 
     if (ctlr->cbs.on_get_new_trans) {
         need_yield = ctlr->cbs.on_get_new_trans(&(ctlr->base), &new_trans, ctlr->cbs_user_data);
-        if (new_trans.buffer && new_trans.buflen >= ctlr->fb_size_in_bytes) {
+        if (new_trans.buffer && new_trans.buflen >= next_trans_size) {
             csi_dma_transfer_config.dst.addr = (uint32_t)(new_trans.buffer);
             has_new_trans = true;
         }
     } else if (xQueueReceiveFromISR(ctlr->trans_que, &new_trans, &high_task_woken) == pdTRUE) {
-        if (new_trans.buffer && new_trans.buflen >= ctlr->fb_size_in_bytes) {
+        if (new_trans.buffer && new_trans.buflen >= next_trans_size) {
             csi_dma_transfer_config.dst.addr = (uint32_t)(new_trans.buffer);
             has_new_trans = true;
         }
@@ -366,8 +430,17 @@ IRAM_ATTR static bool csi_dma_trans_done_callback(dw_gdma_channel_handle_t chan,
     assert(ret == ESP_OK);
     (void)ret;
 
+    //latch the pending line window for the frame that is about to start
+    ctlr->cur_win_start = ctlr->win_start_line;
+    ctlr->cur_win_lines = ctlr->win_line_num;
+    ctlr->seg_line = 0;
+
     ESP_EARLY_LOGD(TAG, "new_trans.buffer: %p, new_trans.buflen: %d", new_trans.buffer, new_trans.buflen);
-    dw_gdma_channel_config_transfer(chan, &csi_dma_transfer_config);
+    if (ctlr->cur_win_lines) {
+        s_csi_config_next_segment(ctlr, chan, new_trans.buffer);
+    } else {
+        dw_gdma_channel_config_transfer(chan, &csi_dma_transfer_config);
+    }
     dw_gdma_channel_enable_ctrl(chan, true);
 
     if ((ctlr->trans.buffer != ctlr->backup_buffer) || ctlr->bk_buffer_exposed) {
@@ -376,7 +449,7 @@ IRAM_ATTR static bool csi_dma_trans_done_callback(dw_gdma_channel_handle_t chan,
         (void)ret;
         assert(ctlr->cbs.on_trans_finished);
         if (ctlr->cbs.on_trans_finished) {
-            ctlr->trans.received_size = ctlr->fb_size_in_bytes;
+            ctlr->trans.received_size = finished_size;
             need_yield = ctlr->cbs.on_trans_finished(&(ctlr->base), &ctlr->trans, ctlr->cbs_user_data);
         }
     }
@@ -481,6 +554,10 @@ esp_err_t s_ctlr_csi_start(esp_cam_ctlr_handle_t handle)
 
     portENTER_CRITICAL(&ctlr->spinlock);
     ctlr->csi_fsm = CSI_FSM_STARTED;
+    //latch the pending line window for the first frame
+    ctlr->cur_win_start = ctlr->win_start_line;
+    ctlr->cur_win_lines = ctlr->win_line_num;
+    ctlr->seg_line = 0;
     portEXIT_CRITICAL(&ctlr->spinlock);
 
     dw_gdma_block_transfer_config_t csi_dma_transfer_config = {};
@@ -501,7 +578,11 @@ esp_err_t s_ctlr_csi_start(esp_cam_ctlr_handle_t handle)
         },
         .size = ctlr->csi_transfer_size,
     };
-    ESP_RETURN_ON_ERROR(dw_gdma_channel_config_transfer(ctlr->dma_chan, &csi_dma_transfer_config), TAG, "failed to configure dwgdma transfer");
+    if (ctlr->cur_win_lines) {
+        s_csi_config_next_segment(ctlr, ctlr->dma_chan, trans.buffer);
+    } else {
+        ESP_RETURN_ON_ERROR(dw_gdma_channel_config_transfer(ctlr->dma_chan, &csi_dma_transfer_config), TAG, "failed to configure dwgdma transfer");
+    }
     ESP_RETURN_ON_ERROR(dw_gdma_channel_enable_ctrl(ctlr->dma_chan, true), TAG, "failed to enable dwgdma");
 
     //enable CSI bridge
@@ -534,7 +615,8 @@ esp_err_t s_ctlr_csi_receive(esp_cam_ctlr_handle_t handle, esp_cam_ctlr_trans_t
     csi_controller_t *ctlr = __containerof(handle, csi_controller_t, base);
 
     ESP_RETURN_ON_FALSE(trans->buffer, ESP_ERR_INVALID_ARG, TAG, "invalid argument: no trans buffer");
-    ESP_RETURN_ON_FALSE((trans->buflen >= ctlr->fb_size_in_bytes), ESP_ERR_INVALID_ARG, TAG, "invalid argument: trans buffer smaller than framebuffer size");
+    size_t min_trans_size = ctlr->win_line_num ? ctlr->win_line_num * ctlr->line_bytes : ctlr->fb_size_in_bytes;
+    ESP_RETURN_ON_FALSE((trans->buflen >= min_trans_size), ESP_ERR_INVALID_ARG, TAG, "invalid argument: trans buffer smaller than the configured capture size");
 
     TickType_t ticks_to_wait = timeout_ms / portTICK_PERIOD_MS;
     if (timeout_ms == ESP_CAM_CTLR_MAX_DELAY) {
@@ -577,3 +659,48 @@ static esp_err_t s_csi_ctlr_format_conversion(esp_cam_ctlr_t *handle, const cam_
     // CSI controller doesn't support format conversion yet
     return ESP_ERR_NOT_SUPPORTED;
 }
+
+static esp_err_t s_csi_ctlr_set_line_window(esp_cam_ctlr_t *handle, uint32_t start_line, uint32_t line_num)
+{
+    csi_controller_t *ctlr = __containerof(handle, csi_controller_t, base);
+    ESP_RETURN_ON_FALSE(start_line + line_num <= ctlr->v_res, ESP_ERR_INVALID_ARG, TAG, "line window exceeds the frame height");
+
+    if (line_num == 0 || line_num == ctlr->v_res) {
+        //full frame, take the single block transfer path again
+        portENTER_CRITICAL(&ctlr->spinlock);
+        ctlr->win_start_line = 0;
+        ctlr->win_line_num = 0;
+        portEXIT_CRITICAL(&ctlr->spinlock);
+        return ESP_OK;
+    }
+
+    //the dma moves the stream in 64-bit words and line segments must be whole words
+    ESP_RETURN_ON_FALSE((ctlr->h_res * ctlr->in_bpp) % 64 == 0, ESP_ERR_INVALID_ARG, TAG, "line size not 64bit aligned");
+    //line addressing in the frame buffer only holds when the stream is not repacked on the way to memory
+    ESP_RETURN_ON_FALSE(ctlr->in_bpp == ctlr->out_bpp, ESP_ERR_INVALID_STATE, TAG, "line window needs matching input and output bit depth");
+
+    if (!ctlr->discard_buffer) {
+        size_t line_bytes = ctlr->h_res * ctlr->in_bpp / 8;
+        size_t discard_lines = MIN(CSI_LINE_WINDOW_DISCARD_LINES, ctlr->v_res - line_num);
+        size_t dma_alignment = 4;  //TODO: IDF-9126, replace with dwgdma alignment API
+        size_t cache_alignment = 1;
+        ESP_RETURN_ON_ERROR(esp_cache_get_alignment(MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA, &cache_alignment), TAG, "failed to get cache alignment");
+        size_t alignment = MAX(cache_alignment, dma_alignment);
+
+        //the discarded lines bounce into internal ram, so they never cost psram write bandwidth
+        ctlr->discard_buffer = heap_caps_aligned_alloc(alignment, discard_lines * line_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        ESP_RETURN_ON_FALSE(ctlr->discard_buffer, ESP_ERR_NO_MEM, TAG, "no mem for discard buffer");
+        ESP_RETURN_ON_ERROR(esp_cache_msync(ctlr->discard_buffer, discard_lines * line_bytes, ESP_CACHE_MSYNC_FLAG_DIR_C2M), TAG, "failed to sync(C2M) discard buffer");
+        ctlr->discard_lines = discard_lines;
+        ctlr->line_bytes = line_bytes;
+        ctlr->line_words = ctlr->h_res * ctlr->in_bpp / 64;
+    }
+
+    //the window is latched at the next frame boundary, so it can change while streaming
+    portENTER_CRITICAL(&ctlr->spinlock);
+    ctlr->win_start_line = start_line;
+    ctlr->win_line_num = line_num;
+    portEXIT_CRITICAL(&ctlr->spinlock);
+
+    return ESP_OK;
+}
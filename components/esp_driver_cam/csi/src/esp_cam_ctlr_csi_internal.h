@@ -66,6 +66,15 @@ struct csi_controller_t {
     void                        *cbs_user_data;     //callback userdata
     dw_gdma_channel_handle_t    dma_chan;           //dwgdma channel handle
     size_t                      csi_transfer_size;  //csi transfer size for dwgdma
+    size_t                      line_words;         //words (dma transfer width) per frame line
+    size_t                      line_bytes;         //bytes per frame line
+    uint32_t                    win_start_line;     //pending line window start, latched at frame boundary
+    uint32_t                    win_line_num;       //pending line window height, 0 for full frame
+    uint32_t                    cur_win_start;      //line window start of the in-flight frame
+    uint32_t                    cur_win_lines;      //line window height of the in-flight frame, 0 for full frame
+    uint32_t                    seg_line;           //next frame line the dma will transfer
+    void                        *discard_buffer;    //internal bounce buffer for lines outside the window
+    size_t                      discard_lines;      //capacity of the discard buffer, in lines
 #if CONFIG_PM_ENABLE
     esp_pm_lock_handle_t        pm_lock;            //Power management lock
 #endif
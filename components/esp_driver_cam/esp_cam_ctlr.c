@@ -100,6 +100,14 @@ void *esp_cam_ctlr_alloc_buffer(esp_cam_ctlr_handle_t handle, size_t size, uint3
     return handle->alloc_buffer(handle, size, buf_caps);
 }
 
+esp_err_t esp_cam_ctlr_set_line_window(esp_cam_ctlr_handle_t handle, uint32_t start_line, uint32_t line_num)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    ESP_RETURN_ON_FALSE(handle->set_line_window, ESP_ERR_NOT_SUPPORTED, TAG, "line window function not supported");
+
+    return handle->set_line_window(handle, start_line, line_num);
+}
+
 esp_err_t esp_cam_ctlr_format_conversion(esp_cam_ctlr_handle_t handle,
                                          const cam_ctlr_format_conv_config_t *conv_cfg)
 {
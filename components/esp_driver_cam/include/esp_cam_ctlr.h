@@ -165,6 +165,27 @@ void *esp_cam_ctlr_alloc_buffer(esp_cam_ctlr_handle_t handle, size_t size, uint3
  */
 esp_err_t esp_cam_ctlr_format_conversion(esp_cam_ctlr_handle_t handle, const cam_ctlr_format_conv_config_t *conv_cfg);
 
+/**
+ * @brief Restrict capture to a window of frame lines.
+ *
+ * Only the configured lines are written into the transaction buffer, which then only needs to be
+ * `line_num` lines large; the remaining lines of each frame are drained into a small internal
+ * bounce buffer and discarded. The window takes effect at the next frame boundary, so it can be
+ * changed while the controller is running, e.g. to switch between a region of interest and
+ * on-demand full frames.
+ *
+ * @param[in] handle ESP CAM controller handle.
+ * @param[in] start_line First line of the window.
+ * @param[in] line_num Number of lines in the window. Pass 0 to restore full-frame capture.
+ *
+ * @return
+ *      - ESP_OK: Success.
+ *      - ESP_ERR_INVALID_ARG: Invalid argument.
+ *      - ESP_ERR_NO_MEM: No memory for the internal bounce buffer.
+ *      - ESP_ERR_NOT_SUPPORTED: Line windows not supported by this controller.
+ */
+esp_err_t esp_cam_ctlr_set_line_window(esp_cam_ctlr_handle_t handle, uint32_t start_line, uint32_t line_num);
+
 #ifdef __cplusplus
 }
 #endif
@@ -163,6 +163,20 @@ struct esp_cam_ctlr_t {
      */
     esp_err_t (*format_conversion)(esp_cam_ctlr_t *, const cam_ctlr_format_conv_config_t *);
 
+    /**
+     * @brief Restrict capture to a window of frame lines.
+     *
+     * @param[in] esp_cam_ctlr_t *      ESP CAM controller handle.
+     * @param[in] uint32_t              First line of the window.
+     * @param[in] uint32_t              Number of lines in the window, 0 to restore full-frame capture.
+     *
+     * @return
+     *      - ESP_OK: Success.
+     *      - ESP_ERR_INVALID_ARG: Invalid argument.
+     *      - ESP_ERR_NOT_SUPPORTED: Line windows not supported by this controller.
+     */
+    esp_err_t (*set_line_window)(esp_cam_ctlr_t *, uint32_t, uint32_t);
+
     void *user_data; /*!< User data. */
 };
 
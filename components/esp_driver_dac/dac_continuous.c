@@ -76,6 +76,8 @@ struct dac_continuous_s {
 
     lldesc_t                **desc;
     uint8_t                 **bufs;
+    uint32_t                cyclic_desc_cnt;             /* The number of descriptors that hold the cyclic data */
+    size_t                  cyclic_total_bytes;          /* The total source data bytes loaded by the last cyclic write */
     STAILQ_HEAD(desc_chain_s, lldesc_s) head;           /* Head of the descriptor chain
                                                          * The descriptors in the chain are pending to be sent or sending now */
     dac_event_callbacks_t   cbs;                        /* Interrupt callbacks */
@@ -416,6 +418,8 @@ esp_err_t dac_continuous_start_async_writing(dac_continuous_handle_t handle)
         for (int i = 0; i < handle->cfg.desc_num; i++) {
             STAILQ_NEXT(handle->desc[i], qe) = NULL;
         }
+        /* The EOF interrupt might be masked while writing cyclically */
+        dac_dma_periph_enable_eof_intr(true);
     }
     /* Wait for the previous DMA stop */
     while (atomic_load(&handle->is_running)) {}
@@ -533,6 +537,12 @@ esp_err_t dac_continuous_write_cyclically(dac_continuous_handle_t handle, uint8_
     }
     /* Link the tail to the head as a ring */
     STAILQ_NEXT(handle->desc[i - 1], qe) = handle->desc[0];
+    handle->cyclic_desc_cnt = i;
+    handle->cyclic_total_bytes = src_buf_size - buf_size;
+
+    /* The ring is converted endlessly without descriptor maintenance, so the per descriptor
+     * interrupt is only needed if the application wants the 'on_convert_done' callback */
+    dac_dma_periph_enable_eof_intr(handle->cbs.on_convert_done != NULL);
 
     dac_dma_periph_dma_trans_start((uint32_t)handle->desc[0]);
     atomic_store(&handle->is_running, true);
@@ -544,6 +554,77 @@ esp_err_t dac_continuous_write_cyclically(dac_continuous_handle_t handle, uint8_
     return ret;
 }
 
+/**
+ * @brief Get the source data length (in bytes) that is held by a cyclic descriptor
+ */
+static inline size_t s_dac_cyclic_desc_src_len(dac_continuous_handle_t handle, uint32_t desc_idx)
+{
+    return handle->desc[desc_idx]->length / DAC_16BIT_ALIGN_COEFF;
+}
+
+esp_err_t dac_continuous_get_cyclic_writable_region(dac_continuous_handle_t handle, size_t *start_offset, size_t *region_size)
+{
+    DAC_NULL_POINTER_CHECK(handle);
+    DAC_NULL_POINTER_CHECK(start_offset);
+    DAC_NULL_POINTER_CHECK(region_size);
+    ESP_RETURN_ON_FALSE(atomic_load(&handle->is_cyclic), ESP_ERR_INVALID_STATE, TAG, "The channels are not in cyclic writing mode");
+    ESP_RETURN_ON_FALSE(atomic_load(&handle->is_running), ESP_ERR_INVALID_STATE, TAG, "The cyclic conversion is not running");
+
+    /* The hardware keeps updating the EOF descriptor register even while the EOF interrupt is masked,
+     * so the descriptor that is currently being converted can be located by polling it.
+     * The in-flight descriptor is the one following the last finished (EOF) descriptor */
+    uint32_t eof_addr = dac_dma_periph_intr_get_eof_desc();
+    uint32_t in_flight = 0;
+    size_t offset = 0;
+    for (uint32_t i = 0; i < handle->cyclic_desc_cnt; i++) {
+        if ((uint32_t)handle->desc[i] == eof_addr) {
+            in_flight = (i + 1) % handle->cyclic_desc_cnt;
+            break;
+        }
+    }
+    /* The writable region starts right after the in-flight descriptor and covers the whole
+     * ring except the in-flight descriptor itself */
+    for (uint32_t i = 0; i < (in_flight + 1) % handle->cyclic_desc_cnt; i++) {
+        offset += s_dac_cyclic_desc_src_len(handle, i);
+    }
+    *start_offset = offset % handle->cyclic_total_bytes;
+    *region_size = handle->cyclic_total_bytes - s_dac_cyclic_desc_src_len(handle, in_flight);
+    return ESP_OK;
+}
+
+esp_err_t dac_continuous_rewrite_cyclically(dac_continuous_handle_t handle, size_t offset, const uint8_t *buf, size_t buf_size, size_t *bytes_loaded)
+{
+    DAC_NULL_POINTER_CHECK(handle);
+    DAC_NULL_POINTER_CHECK(buf);
+    ESP_RETURN_ON_FALSE(atomic_load(&handle->is_cyclic), ESP_ERR_INVALID_STATE, TAG, "The channels are not in cyclic writing mode");
+    ESP_RETURN_ON_FALSE(offset < handle->cyclic_total_bytes, ESP_ERR_INVALID_ARG, TAG, "The offset exceeds the cyclic buffer length");
+    ESP_RETURN_ON_FALSE(buf_size <= handle->cyclic_total_bytes, ESP_ERR_INVALID_ARG, TAG, "The data size exceeds the cyclic buffer length");
+
+    xSemaphoreTake(handle->mutex, portMAX_DELAY);
+    size_t loaded = 0;
+    while (loaded < buf_size) {
+        /* Locate the descriptor and the intra-descriptor offset of the current stream position */
+        size_t stream_off = (offset + loaded) % handle->cyclic_total_bytes;
+        uint32_t i = 0;
+        while (stream_off >= s_dac_cyclic_desc_src_len(handle, i)) {
+            stream_off -= s_dac_cyclic_desc_src_len(handle, i);
+            i++;
+        }
+        size_t chunk = s_dac_cyclic_desc_src_len(handle, i) - stream_off;
+        chunk = (chunk > buf_size - loaded) ? buf_size - loaded : chunk;
+        /* Patch the data in place, the descriptor ownership and length stay untouched
+         * so the conversion goes on without any glitch */
+        s_dac_load_data_into_buf(handle, handle->bufs[i] + stream_off * DAC_16BIT_ALIGN_COEFF,
+                                 chunk * DAC_16BIT_ALIGN_COEFF, buf + loaded, chunk);
+        loaded += chunk;
+    }
+    if (bytes_loaded) {
+        *bytes_loaded = loaded;
+    }
+    xSemaphoreGive(handle->mutex);
+    return ESP_OK;
+}
+
 static esp_err_t s_dac_wait_to_load_dma_data(dac_continuous_handle_t handle, uint8_t *buf, size_t buf_size, size_t *w_size, TickType_t timeout_tick)
 {
     lldesc_t *desc;
@@ -601,6 +682,8 @@ esp_err_t dac_continuous_write(dac_continuous_handle_t handle, uint8_t *buf, siz
         }
         STAILQ_INIT(&handle->head);
         atomic_store(&handle->is_cyclic, false);
+        /* The EOF interrupt might be masked while writing cyclically */
+        dac_dma_periph_enable_eof_intr(true);
     }
     /* When there is no descriptor in the chain, DMA has stopped, load data and start the DMA link */
     if (STAILQ_FIRST(&handle->head) == NULL) {
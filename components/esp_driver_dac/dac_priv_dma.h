@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include "esp_err.h"
 #include "esp_intr_alloc.h"
 
@@ -60,6 +61,17 @@ void dac_dma_periph_enable(void);
  */
 void dac_dma_periph_disable(void);
 
+/**
+ * @brief Enable or disable the EOF (i.e. descriptor finished) interrupt
+ * @note  The total EOF (i.e. DMA stopped) interrupt is not affected.
+ *        The EOF descriptor register keeps being updated by the hardware even
+ *        while the interrupt is disabled, so the finished descriptors can
+ *        still be queried by 'dac_dma_periph_intr_get_eof_desc'
+ *
+ * @param[in]   enable      Whether to enable the EOF interrupt
+ */
+void dac_dma_periph_enable_eof_intr(bool enable);
+
 /**
  * @brief Whether the TX_EOF interrupt is triggered
  *
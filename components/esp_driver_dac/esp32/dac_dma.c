@@ -213,6 +213,11 @@ void dac_dma_periph_disable(void)
     s_dac_dma_periph_stop();
 }
 
+void dac_dma_periph_enable_eof_intr(bool enable)
+{
+    i2s_ll_enable_intr(s_ddp->periph_dev, I2S_LL_EVENT_TX_EOF, enable);
+}
+
 uint32_t IRAM_ATTR dac_dma_periph_intr_is_triggered(void)
 {
     uint32_t status = i2s_ll_get_intr_status(s_ddp->periph_dev);
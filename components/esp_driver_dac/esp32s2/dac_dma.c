@@ -202,6 +202,15 @@ void dac_dma_periph_disable(void)
     dac_ll_digi_trigger_output(false);
 }
 
+void dac_dma_periph_enable_eof_intr(bool enable)
+{
+    if (enable) {
+        spi_ll_enable_intr(s_ddp->periph_dev, SPI_LL_INTR_OUT_EOF);
+    } else {
+        spi_ll_disable_intr(s_ddp->periph_dev, SPI_LL_INTR_OUT_EOF);
+    }
+}
+
 uint32_t IRAM_ATTR dac_dma_periph_intr_is_triggered(void)
 {
     uint32_t ret = 0;
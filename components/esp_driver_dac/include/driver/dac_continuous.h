@@ -189,6 +189,47 @@ esp_err_t dac_continuous_write(dac_continuous_handle_t handle, uint8_t *buf, siz
  */
 esp_err_t dac_continuous_write_cyclically(dac_continuous_handle_t handle, uint8_t *buf, size_t buf_size, size_t *bytes_loaded);
 
+/**
+ * @brief Get the region of the cyclic buffer that can be safely rewritten
+ * @note  The region is the part of the cyclic buffer that is behind the DMA read pointer,
+ *        i.e. all the data except the DMA buffer that is currently being converted.
+ *        It is located by polling the finished descriptor that is recorded by the hardware,
+ *        so no interrupt is involved.
+ * @note  The region is given in the coordinates of the source buffer that was loaded by
+ *        `dac_continuous_write_cyclically`, it can wrap around the end of the cyclic buffer.
+ *
+ * @param[in]  handle       The DAC continuous channel handle that obtained from 'dac_continuous_new_channels'
+ * @param[out] start_offset The byte offset in the cyclic buffer where the writable region starts
+ * @param[out] region_size  The size of the writable region in bytes, it can be zero if
+ *                          the cyclic buffer only occupies a single DMA buffer
+ * @return
+ *      - ESP_ERR_INVALID_ARG   The input parameter is invalid
+ *      - ESP_ERR_INVALID_STATE The channels are not converting cyclically
+ *      - ESP_OK                Success to get the writable region
+ */
+esp_err_t dac_continuous_get_cyclic_writable_region(dac_continuous_handle_t handle, size_t *start_offset, size_t *region_size);
+
+/**
+ * @brief Rewrite a part of the cyclic buffer while it keeps being converted
+ * @note  The data is patched into the DMA buffers in place, without stopping or restarting
+ *        the DMA, so the conversion continues without any glitch.
+ *        To avoid tearing in the region that is currently being converted, only write within
+ *        the region reported by `dac_continuous_get_cyclic_writable_region`.
+ * @note  The offset can be anywhere in the cyclic buffer and the data wraps around its end,
+ *        but offset and size must not exceed the length loaded by `dac_continuous_write_cyclically`.
+ *
+ * @param[in]  handle   The DAC continuous channel handle that obtained from 'dac_continuous_new_channels'
+ * @param[in]  offset   The byte offset in the cyclic buffer to start rewriting at
+ * @param[in]  buf      The digital data buffer to convert
+ * @param[in]  buf_size The buffer size of digital data buffer
+ * @param[out] bytes_loaded The bytes that has been loaded into DMA buffer, can be NULL if don't need it
+ * @return
+ *      - ESP_ERR_INVALID_ARG   The input parameter is invalid or out of the cyclic buffer range
+ *      - ESP_ERR_INVALID_STATE The channels are not in cyclic writing mode
+ *      - ESP_OK                Success to rewrite the cyclic DAC data
+ */
+esp_err_t dac_continuous_rewrite_cyclically(dac_continuous_handle_t handle, size_t offset, const uint8_t *buf, size_t buf_size, size_t *bytes_loaded);
+
 /**
  * @brief Set event callbacks for DAC continuous mode
  *
@@ -319,6 +319,55 @@ TEST_CASE("DAC_dma_convert_frequency_test", "[dac]")
 }
 #endif
 
+TEST_CASE("DAC_cyclic_rewrite_test", "[dac]")
+{
+    dac_continuous_handle_t cont_handle;
+    dac_continuous_config_t cont_cfg = {
+        .chan_mask = DAC_CHANNEL_MASK_ALL,
+        .desc_num = 8,
+        .buf_size = 1024,
+        .freq_hz = 48000,
+        .offset = 0,
+        .clk_src = DAC_DIGI_CLK_SRC_DEFAULT,
+        .chan_mode = DAC_CHANNEL_MODE_SIMUL,
+    };
+    size_t len = 4000;
+    uint8_t buf[len];
+    for (int i = 0; i < len; i++) {
+        buf[i] = i % 256;
+    }
+
+    TEST_ESP_OK(dac_continuous_new_channels(&cont_cfg, &cont_handle));
+    TEST_ESP_OK(dac_continuous_enable(cont_handle));
+    /* The safe window can only be queried while converting cyclically */
+    size_t start_offset = 0;
+    size_t region_size = 0;
+    TEST_ASSERT(dac_continuous_get_cyclic_writable_region(cont_handle, &start_offset, &region_size) == ESP_ERR_INVALID_STATE);
+    TEST_ASSERT(dac_continuous_rewrite_cyclically(cont_handle, 0, buf, len, NULL) == ESP_ERR_INVALID_STATE);
+
+    TEST_ESP_OK(dac_continuous_write_cyclically(cont_handle, buf, len, NULL));
+    /* The offset and size are limited by the loaded cyclic buffer length */
+    TEST_ASSERT(dac_continuous_rewrite_cyclically(cont_handle, len, buf, len, NULL) == ESP_ERR_INVALID_ARG);
+    TEST_ASSERT(dac_continuous_rewrite_cyclically(cont_handle, 0, buf, len + 1, NULL) == ESP_ERR_INVALID_ARG);
+
+    /* Keep patching the safe region while the conversion goes on */
+    for (int i = 0; i < 20; i++) {
+        TEST_ESP_OK(dac_continuous_get_cyclic_writable_region(cont_handle, &start_offset, &region_size));
+        TEST_ASSERT(start_offset < len);
+        TEST_ASSERT(region_size > 0 && region_size < len);
+        size_t w_size = region_size > 512 ? 512 : region_size;
+        size_t bytes_loaded = 0;
+        TEST_ESP_OK(dac_continuous_rewrite_cyclically(cont_handle, start_offset, buf, w_size, &bytes_loaded));
+        TEST_ASSERT_EQUAL(w_size, bytes_loaded);
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    /* Rewriting across the end of the cyclic buffer must wrap around */
+    TEST_ESP_OK(dac_continuous_rewrite_cyclically(cont_handle, len - 100, buf, 200, NULL));
+
+    TEST_ESP_OK(dac_continuous_disable(cont_handle));
+    TEST_ESP_OK(dac_continuous_del_channels(cont_handle));
+}
+
 TEST_CASE("DAC_cosine_wave_test", "[dac]")
 {
     dac_cosine_handle_t cos_chan0_handle;
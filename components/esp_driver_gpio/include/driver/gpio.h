@@ -388,6 +388,21 @@ esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void
   */
 esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num);
 
+#if CONFIG_GPIO_ISR_SERVICE_BH_DISPATCH
+/**
+  * @brief Get the number of bottom-half ring overflows of the GPIO ISR service
+  *
+  * Each count means a fired-pin set could not be queued to the bottom-half
+  * dispatch task because its work ring was full; the affected handlers ran
+  * coalesced with the next GPIO interrupt instead of immediately. A rising
+  * count indicates the dispatch task is not keeping up (consider a larger
+  * ESP_SYSTEM_BH_QUEUE_LEN or lighter handlers).
+  *
+  * @return Number of overflows since boot
+  */
+uint32_t gpio_isr_service_get_bh_overflow_count(void);
+#endif // CONFIG_GPIO_ISR_SERVICE_BH_DISPATCH
+
 /**
   * @brief Set GPIO pad drive capability
   *
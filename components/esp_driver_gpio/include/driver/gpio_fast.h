@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "soc/soc_caps.h"
+#include "hal/gpio_ll.h"
+#include "hal/gpio_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file gpio_fast.h
+ * @brief Fast GPIO output access, resolved at compile time
+ *
+ * The functions below skip all argument checking and handle indirection of the regular
+ * `gpio_set_level` path. They are force-inlined thin wrappers over the LL layer, so with a
+ * compile-time constant GPIO number the compiler folds them down to a single W1TS/W1TC
+ * register write, which is what bit-banging tight protocols needs.
+ *
+ * Use the regular checked driver (`gpio_config`, `gpio_set_direction`, ...) for all pin
+ * configuration. These functions only drive pins that are already configured as outputs,
+ * passing an invalid GPIO number or a pin of the wrong direction is undefined behavior.
+ */
+
+/**
+ * @brief Bank id of a GPIO, each bank covers 32 GPIOs
+ */
+#define GPIO_FAST_BANK_ID(gpio_num)   ((uint32_t)(gpio_num) / 32)
+
+/**
+ * @brief Bit mask of a GPIO inside its bank, OR these together for the multi-pin functions
+ */
+#define GPIO_FAST_BANK_MASK(gpio_num) (1UL << ((uint32_t)(gpio_num) % 32))
+
+/**
+ * @brief Drive a GPIO high, without any argument check
+ *
+ * @param gpio_num GPIO number, must be a valid output GPIO, ideally a compile-time constant
+ */
+__attribute__((always_inline))
+static inline void gpio_fast_set_high(gpio_num_t gpio_num)
+{
+    gpio_ll_set_level(GPIO_LL_GET_HW(GPIO_PORT_0), gpio_num, 1);
+}
+
+/**
+ * @brief Drive a GPIO low, without any argument check
+ *
+ * @param gpio_num GPIO number, must be a valid output GPIO, ideally a compile-time constant
+ */
+__attribute__((always_inline))
+static inline void gpio_fast_set_low(gpio_num_t gpio_num)
+{
+    gpio_ll_set_level(GPIO_LL_GET_HW(GPIO_PORT_0), gpio_num, 0);
+}
+
+/**
+ * @brief Set the output level of a GPIO, without any argument check
+ *
+ * @param gpio_num GPIO number, must be a valid output GPIO, ideally a compile-time constant
+ * @param level Output level, 0: low, others: high
+ */
+__attribute__((always_inline))
+static inline void gpio_fast_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    gpio_ll_set_level(GPIO_LL_GET_HW(GPIO_PORT_0), gpio_num, level);
+}
+
+/**
+ * @brief Drive multiple GPIOs of one bank high with a single register write
+ *
+ * @param bank_id Bank id, see `GPIO_FAST_BANK_ID`
+ * @param mask OR-ed `GPIO_FAST_BANK_MASK` of the GPIOs to drive high, all must belong to `bank_id`
+ */
+__attribute__((always_inline))
+static inline void gpio_fast_set_mask(uint32_t bank_id, uint32_t mask)
+{
+    gpio_ll_set_output_bits(GPIO_LL_GET_HW(GPIO_PORT_0), bank_id, mask);
+}
+
+/**
+ * @brief Drive multiple GPIOs of one bank low with a single register write
+ *
+ * @param bank_id Bank id, see `GPIO_FAST_BANK_ID`
+ * @param mask OR-ed `GPIO_FAST_BANK_MASK` of the GPIOs to drive low, all must belong to `bank_id`
+ */
+__attribute__((always_inline))
+static inline void gpio_fast_clear_mask(uint32_t bank_id, uint32_t mask)
+{
+    gpio_ll_clear_output_bits(GPIO_LL_GET_HW(GPIO_PORT_0), bank_id, mask);
+}
+
+/**
+ * @brief Read the input level of a GPIO, without any argument check
+ *
+ * @param gpio_num GPIO number, the pad must be configured for input
+ * @return 0: low, 1: high
+ */
+__attribute__((always_inline))
+static inline int gpio_fast_get_level(gpio_num_t gpio_num)
+{
+    return gpio_ll_get_level(GPIO_LL_GET_HW(GPIO_PORT_0), gpio_num);
+}
+
+#ifdef __cplusplus
+}
+#endif
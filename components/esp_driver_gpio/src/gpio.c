@@ -22,6 +22,9 @@
 #include "hal/gpio_hal.h"
 #include "esp_private/esp_gpio_reserve.h"
 #include "esp_private/io_mux.h"
+#if CONFIG_GPIO_ISR_SERVICE_BH_DISPATCH
+#include "esp_private/esp_bh.h"
+#endif
 
 #if (SOC_RTCIO_PIN_COUNT > 0)
 #include "hal/rtc_io_hal.h"
@@ -504,6 +507,52 @@ static inline void IRAM_ATTR gpio_isr_loop(uint32_t status, const uint32_t gpio_
     }
 }
 
+#if CONFIG_GPIO_ISR_SERVICE_BH_DISPATCH
+static void IRAM_ATTR gpio_bh_run_handlers(uint32_t status, const uint32_t gpio_num_start)
+{
+    while (status) {
+        int nbit = __builtin_ffs(status) - 1;
+        status &= ~(1 << nbit);
+        int gpio_num = gpio_num_start + nbit;
+
+        if (gpio_context.gpio_isr_func != NULL && gpio_context.gpio_isr_func[gpio_num].fn != NULL) {
+            gpio_context.gpio_isr_func[gpio_num].fn(gpio_context.gpio_isr_func[gpio_num].args);
+        }
+    }
+}
+
+static void IRAM_ATTR gpio_bh_run_handlers_low(void *arg)
+{
+    gpio_bh_run_handlers((uint32_t)(uintptr_t)arg, 0);
+}
+
+static void IRAM_ATTR gpio_bh_run_handlers_high(void *arg)
+{
+    gpio_bh_run_handlers((uint32_t)(uintptr_t)arg, 32);
+}
+
+static void IRAM_ATTR gpio_bh_clear_intr_status(uint32_t status, const uint32_t gpio_num_start)
+{
+    while (status) {
+        int nbit = __builtin_ffs(status) - 1;
+        status &= ~(1 << nbit);
+        gpio_hal_clear_intr_status_bit(gpio_context.gpio_hal, gpio_num_start + nbit);
+    }
+}
+
+/* Pin masks whose dispatch did not fit the bottom-half ring, carried over and
+ * merged into the next interrupt's dispatch (only touched from the ISR), plus
+ * a counter of such overflows for diagnostics */
+static uint32_t s_gpio_bh_deferred_low;
+static uint32_t s_gpio_bh_deferred_high;
+static volatile uint32_t s_gpio_bh_overflow_count;
+
+uint32_t gpio_isr_service_get_bh_overflow_count(void)
+{
+    return s_gpio_bh_overflow_count;
+}
+#endif // CONFIG_GPIO_ISR_SERVICE_BH_DISPATCH
+
 static void IRAM_ATTR gpio_intr_service(void *arg)
 {
     //GPIO intr process
@@ -515,17 +564,49 @@ static void IRAM_ATTR gpio_intr_service(void *arg)
     uint32_t gpio_intr_status;
     gpio_hal_get_intr_status(gpio_context.gpio_hal, gpio_context.isr_core_id, &gpio_intr_status);
 
-    if (gpio_intr_status) {
-        gpio_isr_loop(gpio_intr_status, 0);
-    }
-
     //read status1 to get interrupt status for GPIO32-39
     uint32_t gpio_intr_status_h;
     gpio_hal_get_intr_status_high(gpio_context.gpio_hal, gpio_context.isr_core_id, &gpio_intr_status_h);
 
+#if CONFIG_GPIO_ISR_SERVICE_BH_DISPATCH
+    /* Clear the captured status here (a new edge re-raises the interrupt)
+     * and run the per-pin handlers from the bottom-half dispatch task. When
+     * the ring is full the fired mask is kept and merged into the next
+     * dispatch, so the handlers run late (coalesced) rather than never;
+     * each overflow is counted. */
+    bool need_yield = false;
+    if (gpio_intr_status || s_gpio_bh_deferred_low) {
+        uint32_t dispatch_mask = gpio_intr_status | s_gpio_bh_deferred_low;
+        gpio_bh_clear_intr_status(gpio_intr_status, 0);
+        if (esp_bh_schedule_from_isr(gpio_bh_run_handlers_low, (void *)(uintptr_t)dispatch_mask, &need_yield) == ESP_OK) {
+            s_gpio_bh_deferred_low = 0;
+        } else {
+            s_gpio_bh_deferred_low = dispatch_mask;
+            s_gpio_bh_overflow_count++;
+        }
+    }
+    if (gpio_intr_status_h || s_gpio_bh_deferred_high) {
+        uint32_t dispatch_mask = gpio_intr_status_h | s_gpio_bh_deferred_high;
+        gpio_bh_clear_intr_status(gpio_intr_status_h, 32);
+        if (esp_bh_schedule_from_isr(gpio_bh_run_handlers_high, (void *)(uintptr_t)dispatch_mask, &need_yield) == ESP_OK) {
+            s_gpio_bh_deferred_high = 0;
+        } else {
+            s_gpio_bh_deferred_high = dispatch_mask;
+            s_gpio_bh_overflow_count++;
+        }
+    }
+    if (need_yield) {
+        portYIELD_FROM_ISR();
+    }
+#else
+    if (gpio_intr_status) {
+        gpio_isr_loop(gpio_intr_status, 0);
+    }
+
     if (gpio_intr_status_h) {
         gpio_isr_loop(gpio_intr_status_h, 32);
     }
+#endif // CONFIG_GPIO_ISR_SERVICE_BH_DISPATCH
 }
 
 esp_err_t gpio_install_isr_service(int intr_alloc_flags)
@@ -598,6 +679,11 @@ esp_err_t gpio_uninstall_isr_service(void)
     gpio_isr_handle_free = gpio_context.gpio_isr_handle;
     gpio_context.gpio_isr_handle = NULL;
     gpio_context.isr_core_id = GPIO_ISR_CORE_ID_UNINIT;
+#if CONFIG_GPIO_ISR_SERVICE_BH_DISPATCH
+    // don't let a carried-over fired-pin mask leak into a later reinstall
+    s_gpio_bh_deferred_low = 0;
+    s_gpio_bh_deferred_high = 0;
+#endif
     portEXIT_CRITICAL(&gpio_context.gpio_spinlock);
     esp_intr_free(gpio_isr_handle_free);
     free(gpio_isr_func_free);
@@ -837,7 +837,7 @@ static void i2c_master_isr_handler_default(void *arg)
         };
         s_i2c_send_command_async(i2c_master, &HPTaskAwoken);
         if (i2c_master->trans_done) {
-            if (i2c_dev->on_trans_done) {
+            if (i2c_dev->on_trans_done && !i2c_master->i2c_trans.suppress_done_cb) {
                 i2c_dev->on_trans_done(i2c_dev, &evt, i2c_dev->user_ctx);
             }
             if (i2c_master->new_queue && i2c_master->num_trans_inqueue > 0 && i2c_master->in_progress == false) {
@@ -931,7 +931,7 @@ static esp_err_t i2c_master_bus_destroy(i2c_master_bus_handle_t bus_handle)
     return ESP_OK;
 }
 
-static esp_err_t s_i2c_asynchronous_transaction(i2c_master_dev_handle_t i2c_dev, i2c_operation_t *i2c_ops, size_t ops_dim, int timeout_ms)
+static esp_err_t s_i2c_asynchronous_transaction_ex(i2c_master_dev_handle_t i2c_dev, i2c_operation_t *i2c_ops, size_t ops_dim, bool suppress_done_cb, TickType_t queue_wait, int timeout_ms)
 {
     i2c_master_bus_t *i2c_master = i2c_dev->master_bus;
     if (i2c_master->sent_all == true && i2c_master->num_trans_inqueue == 0) {
@@ -941,6 +941,7 @@ static esp_err_t s_i2c_asynchronous_transaction(i2c_master_dev_handle_t i2c_dev,
             .device_address = i2c_dev->device_address,
             .ops = i2c_master->i2c_ops,
             .cmd_count = ops_dim,
+            .suppress_done_cb = suppress_done_cb,
         };
 
         i2c_master->sent_all = false;
@@ -971,17 +972,18 @@ static esp_err_t s_i2c_asynchronous_transaction(i2c_master_dev_handle_t i2c_dev,
 
         i2c_transaction_t i2c_queue_pre;
         if (i2c_master->num_trans_inflight < i2c_master->queue_size) {
-            ESP_RETURN_ON_FALSE(xQueueReceive(i2c_master->trans_queues[I2C_TRANS_QUEUE_READY], &i2c_queue_pre, portMAX_DELAY) == pdTRUE, ESP_FAIL, TAG, "no transaction in the ready queue");
+            ESP_RETURN_ON_FALSE(xQueueReceive(i2c_master->trans_queues[I2C_TRANS_QUEUE_READY], &i2c_queue_pre, queue_wait) == pdTRUE, ESP_FAIL, TAG, "no transaction in the ready queue");
         } else {
-            ESP_RETURN_ON_FALSE(xQueueReceive(i2c_master->trans_queues[I2C_TRANS_QUEUE_COMPLETE], &i2c_queue_pre, portMAX_DELAY) == pdTRUE, ESP_FAIL, TAG, "recycle transaction from done queue failed");
+            ESP_RETURN_ON_FALSE(xQueueReceive(i2c_master->trans_queues[I2C_TRANS_QUEUE_COMPLETE], &i2c_queue_pre, queue_wait) == pdTRUE, ESP_FAIL, TAG, "recycle transaction from done queue failed");
             i2c_master->num_trans_inflight--;
         }
         i2c_queue_pre = (i2c_transaction_t) {
             .device_address = i2c_dev->device_address,
             .ops = ops_current,
             .cmd_count = ops_dim,
+            .suppress_done_cb = suppress_done_cb,
         };
-        if (xQueueSend(i2c_master->trans_queues[I2C_TRANS_QUEUE_PROGRESS], &i2c_queue_pre, portMAX_DELAY) == pdTRUE) {
+        if (xQueueSend(i2c_master->trans_queues[I2C_TRANS_QUEUE_PROGRESS], &i2c_queue_pre, queue_wait) == pdTRUE) {
             i2c_master->num_trans_inflight++;
             i2c_master->num_trans_inqueue++;
             if (i2c_master->sent_all == true) {
@@ -1003,6 +1005,11 @@ static esp_err_t s_i2c_asynchronous_transaction(i2c_master_dev_handle_t i2c_dev,
     return ESP_OK;
 }
 
+static esp_err_t s_i2c_asynchronous_transaction(i2c_master_dev_handle_t i2c_dev, i2c_operation_t *i2c_ops, size_t ops_dim, int timeout_ms)
+{
+    return s_i2c_asynchronous_transaction_ex(i2c_dev, i2c_ops, ops_dim, false, portMAX_DELAY, timeout_ms);
+}
+
 static esp_err_t s_i2c_synchronous_transaction(i2c_master_dev_handle_t i2c_dev, i2c_operation_t *i2c_ops, size_t ops_dim, int timeout_ms)
 {
     esp_err_t ret = ESP_OK;
@@ -1361,6 +1368,64 @@ esp_err_t i2c_master_receive(i2c_master_dev_handle_t i2c_dev, uint8_t *read_buff
     return ret;
 }
 
+esp_err_t i2c_master_queue_transfers(i2c_master_dev_handle_t i2c_dev, const i2c_master_transfer_info_t *transfer_array, size_t array_size, int xfer_timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(i2c_dev != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c handle not initialized");
+    ESP_RETURN_ON_FALSE((transfer_array != NULL) && (array_size > 0), ESP_ERR_INVALID_ARG, TAG, "transfer array is empty");
+    i2c_master_bus_t *i2c_master = i2c_dev->master_bus;
+    ESP_RETURN_ON_FALSE(i2c_master->async_trans == true, ESP_ERR_INVALID_STATE, TAG, "queued transfers need asynchronous mode, set trans_queue_depth and register event callbacks");
+
+    for (size_t i = 0; i < array_size; i++) {
+        ESP_RETURN_ON_FALSE((transfer_array[i].write_size == 0) == (transfer_array[i].write_buffer == NULL), ESP_ERR_INVALID_ARG, TAG, "i2c transmit buffer or size invalid");
+        ESP_RETURN_ON_FALSE((transfer_array[i].read_size == 0) == (transfer_array[i].read_buffer == NULL), ESP_ERR_INVALID_ARG, TAG, "i2c receive buffer or size invalid");
+        ESP_RETURN_ON_FALSE((transfer_array[i].write_size > 0) || (transfer_array[i].read_size > 0), ESP_ERR_INVALID_ARG, TAG, "empty transfer descriptor");
+#if CONFIG_I2C_ISR_IRAM_SAFE
+        if (transfer_array[i].read_size > 0) {
+            ESP_RETURN_ON_FALSE(esp_ptr_internal(transfer_array[i].read_buffer), ESP_ERR_INVALID_ARG, TAG, "read buffer not in internal RAM");
+        }
+#endif
+    }
+
+    // Admit the batch only when it fits in the transaction pool as a whole, so a partial
+    // submission can never leave the final (callback carrying) transfer unqueued.
+    xSemaphoreTake(i2c_master->bus_lock_mux, portMAX_DELAY);
+    size_t free_slots = i2c_master->queue_size - i2c_master->ops_cur_size;
+    xSemaphoreGive(i2c_master->bus_lock_mux);
+    ESP_RETURN_ON_FALSE(free_slots >= array_size, ESP_ERR_INVALID_STATE, TAG, "not enough free transaction slots, please increase your trans_queue_depth");
+
+    for (size_t i = 0; i < array_size; i++) {
+        const i2c_master_transfer_info_t *xfer = &transfer_array[i];
+        size_t op_index = 0;
+        i2c_operation_t i2c_ops[SOC_I2C_CMD_REG_NUM] = {};
+        if (xfer->write_size > 0) {
+            i2c_ops[op_index++] = (i2c_operation_t) {
+                .hw_cmd = I2C_TRANS_START_COMMAND
+            };
+            i2c_ops[op_index++] = (i2c_operation_t) {
+                .hw_cmd = I2C_TRANS_WRITE_COMMAND(i2c_dev->ack_check_disable ? false : true), .data = (uint8_t *)xfer->write_buffer, .total_bytes = xfer->write_size
+            };
+        }
+        if (xfer->read_size > 0) {
+            i2c_ops[op_index++] = (i2c_operation_t) {
+                .hw_cmd = I2C_TRANS_START_COMMAND
+            };
+            i2c_ops[op_index++] = (i2c_operation_t) {
+                .hw_cmd = I2C_TRANS_READ_COMMAND(I2C_ACK_VAL), .data = xfer->read_buffer, .total_bytes = xfer->read_size - 1
+            };
+            i2c_ops[op_index++] = (i2c_operation_t) {
+                .hw_cmd = I2C_TRANS_READ_COMMAND(I2C_NACK_VAL), .data = (xfer->read_buffer + xfer->read_size - 1), .total_bytes = 1
+            };
+        }
+        i2c_ops[op_index++] = (i2c_operation_t) {
+            .hw_cmd = I2C_TRANS_STOP_COMMAND
+        };
+        // Only the last transfer of the batch reports through the done callback.
+        bool last = (i + 1 == array_size);
+        ESP_RETURN_ON_ERROR(s_i2c_asynchronous_transaction_ex(i2c_dev, i2c_ops, op_index, !last, 0, xfer_timeout_ms), TAG, "queue transfer %d failed", (int)i);
+    }
+    return ESP_OK;
+}
+
 esp_err_t i2c_master_probe(i2c_master_bus_handle_t bus_handle, uint16_t address, int xfer_timeout_ms)
 {
     ESP_RETURN_ON_FALSE(bus_handle != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c handle not initialized");
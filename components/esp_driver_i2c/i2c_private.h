@@ -102,6 +102,7 @@ typedef struct {
     uint32_t device_address; // Address of I2C device
     i2c_operation_t *ops; // Pointer to I2C operation structure
     size_t cmd_count; // Record how many I2C hardware commands in one transaction
+    bool suppress_done_cb; // Skip the done callback for this transaction, used by queued transfer batches so that only the last transfer notifies
 } i2c_transaction_t;
 
 struct i2c_bus_t {
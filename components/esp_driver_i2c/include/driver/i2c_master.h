@@ -98,6 +98,19 @@ typedef struct {
     size_t buffer_size;                  /*!< Size of data to be written. */
 } i2c_master_transmit_multi_buffer_info_t;
 
+/**
+ * @brief I2C master transfer descriptor, one entry of a queued transfer batch
+ *
+ * Depending on which buffers are set, the descriptor is a write (write only), a read (read only),
+ * or a write-read with a repeated START between the two phases.
+ */
+typedef struct {
+    const uint8_t *write_buffer;         /*!< Data bytes to send, NULL for a pure read. */
+    size_t write_size;                   /*!< Size, in bytes, of the write buffer. */
+    uint8_t *read_buffer;                /*!< Buffer for data received from the bus, NULL for a pure write. */
+    size_t read_size;                    /*!< Size, in bytes, of the read buffer. */
+} i2c_master_transfer_info_t;
+
 /**
  * @brief Group of I2C master callbacks, can be used to get status during transaction or doing other small things. But take care potential concurrency issues.
  * @note The callbacks are all running under ISR context
@@ -233,6 +246,31 @@ esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t i2c_dev, const uin
  */
 esp_err_t i2c_master_receive(i2c_master_dev_handle_t i2c_dev, uint8_t *read_buffer, size_t read_size, int xfer_timeout_ms);
 
+/**
+ * @brief Queue a batch of transfers to be executed back-to-back without blocking.
+ *
+ * The transfers are handed to the hardware command engine one after another, chained from the
+ * transaction-done interrupt, so no task wakeup happens between them. Only the last transfer of the
+ * batch invokes the `on_trans_done` callback, giving one notification per batch. The function never
+ * sleeps waiting for a free slot: when the batch does not fit in the transaction queue as a whole,
+ * it returns ESP_ERR_INVALID_STATE without queueing anything.
+ *
+ * @note This function requires the asynchronous mode: the bus must be created with a non-zero
+ *       `trans_queue_depth` and a callback must be registered with `i2c_master_register_event_callbacks`.
+ *       The queue depth must be at least the batch size. All buffers must stay valid and prepared
+ *       until the completion callback runs.
+ *
+ * @param[in] i2c_dev I2C master device handle that created by `i2c_master_bus_add_device`.
+ * @param[in] transfer_array Array of transfer descriptors, executed in order.
+ * @param[in] array_size Number of entries in the transfer array.
+ * @param[in] xfer_timeout_ms Wait timeout, in ms, for the bus recovery before the first transfer. Note: -1 means wait forever.
+ * @return
+ *      - ESP_OK: All transfers queued successfully.
+ *      - ESP_ERR_INVALID_ARG: Invalid handle or transfer descriptor.
+ *      - ESP_ERR_INVALID_STATE: Asynchronous mode not configured, or not enough free transaction slots for the whole batch.
+ */
+esp_err_t i2c_master_queue_transfers(i2c_master_dev_handle_t i2c_dev, const i2c_master_transfer_info_t *transfer_array, size_t array_size, int xfer_timeout_ms);
+
 /**
  * @brief Probe I2C address, if address is correct and ACK is received, this function will return ESP_OK.
  *
@@ -442,6 +442,34 @@ err:
     return ret;
 }
 
+esp_err_t i2s_channel_set_duplex_pipeline(i2s_chan_handle_t rx_handle, i2s_chan_handle_t tx_handle, i2s_duplex_process_callback_t process_cb, void *user_ctx)
+{
+    I2S_NULL_POINTER_CHECK(TAG, rx_handle);
+    ESP_RETURN_ON_FALSE(rx_handle->dir == I2S_DIR_RX, ESP_ERR_INVALID_ARG, TAG, "pipeline can only be installed on an RX channel");
+    esp_err_t ret = ESP_OK;
+    if (process_cb) {
+        I2S_NULL_POINTER_CHECK(TAG, tx_handle);
+        ESP_RETURN_ON_FALSE(tx_handle->dir == I2S_DIR_TX, ESP_ERR_INVALID_ARG, TAG, "paired channel is not a TX channel");
+        ESP_RETURN_ON_FALSE(rx_handle->dma.buf_size && (rx_handle->dma.buf_size == tx_handle->dma.buf_size), ESP_ERR_INVALID_ARG, TAG,
+                            "RX and TX channels must be initialized with the same DMA buffer size");
+#if CONFIG_I2S_ISR_IRAM_SAFE
+        ESP_RETURN_ON_FALSE(esp_ptr_in_iram(process_cb), ESP_ERR_INVALID_ARG, TAG, "process callback not in IRAM");
+        if (user_ctx) {
+            ESP_RETURN_ON_FALSE(esp_ptr_internal(user_ctx), ESP_ERR_INVALID_ARG, TAG, "user context not in internal RAM");
+        }
+#endif
+    }
+
+    xSemaphoreTake(rx_handle->mutex, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(rx_handle->state < I2S_CHAN_STATE_RUNNING, ESP_ERR_INVALID_STATE, err, TAG, "invalid state, I2S has enabled");
+    rx_handle->duplex_tx_chan = process_cb ? tx_handle : NULL;
+    rx_handle->duplex_user_data = user_ctx;
+    rx_handle->duplex_process_cb = process_cb;
+err:
+    xSemaphoreGive(rx_handle->mutex);
+    return ret;
+}
+
 uint32_t i2s_get_buf_size(i2s_chan_handle_t handle, uint32_t data_bit_width, uint32_t dma_frame_num)
 {
     uint32_t active_chan = handle->active_slot;
@@ -628,6 +656,22 @@ static bool i2s_dma_rx_callback(gdma_channel_handle_t dma_chan, gdma_event_data_
         .dma_buf = (void *)finish_desc->buf,
         .size = handle->dma.buf_size,
     };
+    if (handle->duplex_process_cb) {
+        // run the processing stage on the finished RX buffer and hand the result to a recycled
+        // TX DMA buffer, no TX buffer is available yet while the TX ring sends its first round
+        void *tx_buf = NULL;
+        if (xQueueReceiveFromISR(handle->duplex_tx_chan->msg_queue, &tx_buf, &need_yield1)) {
+            i2s_duplex_event_data_t duplex_evt = {
+                .rx_buf = (void *)finish_desc->buf,
+                .tx_buf = tx_buf,
+                .size = handle->dma.buf_size,
+            };
+            user_need_yield |= handle->duplex_process_cb(handle, &duplex_evt, handle->duplex_user_data);
+#if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
+            esp_cache_msync(tx_buf, handle->dma.buf_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+#endif
+        }
+    }
     if (handle->callbacks.on_recv) {
         user_need_yield |= handle->callbacks.on_recv(handle, &evt, handle->user_data);
     }
@@ -709,6 +753,19 @@ static void i2s_dma_rx_callback(void *arg)
         i2s_hal_get_in_eof_des_addr(&(handle->controller->hal), (uint32_t *)&finish_desc);
         evt.dma_buf = (void *)finish_desc->buf;
         evt.size = handle->dma.buf_size;
+        if (handle->duplex_process_cb) {
+            // run the processing stage on the finished RX buffer and hand the result to a recycled
+            // TX DMA buffer, no TX buffer is available yet while the TX ring sends its first round
+            void *tx_buf = NULL;
+            if (xQueueReceiveFromISR(handle->duplex_tx_chan->msg_queue, &tx_buf, &need_yield1)) {
+                i2s_duplex_event_data_t duplex_evt = {
+                    .rx_buf = (void *)finish_desc->buf,
+                    .tx_buf = tx_buf,
+                    .size = handle->dma.buf_size,
+                };
+                user_need_yield |= handle->duplex_process_cb(handle, &duplex_evt, handle->duplex_user_data);
+            }
+        }
         if (handle->callbacks.on_recv) {
             user_need_yield |= handle->callbacks.on_recv(handle, &evt, handle->user_data);
         }
@@ -1080,6 +1137,12 @@ esp_err_t i2s_del_channel(i2s_chan_handle_t handle)
     i2s_dir_t __attribute__((unused)) dir = handle->dir;
     bool is_bound = true;
 
+    // break the duplex pipeline if this TX channel still feeds one on the same controller
+    if (dir == I2S_DIR_TX && i2s_obj->rx_chan && i2s_obj->rx_chan->duplex_tx_chan == handle) {
+        i2s_obj->rx_chan->duplex_process_cb = NULL;
+        i2s_obj->rx_chan->duplex_tx_chan = NULL;
+    }
+
 #if SOC_I2S_HW_VERSION_2
     I2S_CLOCK_SRC_ATOMIC() {
         if (dir == I2S_DIR_TX) {
@@ -187,6 +187,10 @@ struct i2s_channel_obj_t {
     uint64_t                reserve_gpio_mask; /*!< The gpio mask that has been reserved by I2S */
     i2s_event_callbacks_internal_t   callbacks;      /*!< Callback functions */
     void                    *user_data;     /*!< User data for callback functions */
+    /* Full-duplex pipeline (RX channel only) */
+    i2s_duplex_process_callback_t duplex_process_cb; /*!< Processing stage invoked on every finished RX DMA buffer, NULL if pipeline not installed */
+    i2s_chan_handle_t       duplex_tx_chan; /*!< Paired TX channel whose recycled DMA buffers carry the processed frames */
+    void                    *duplex_user_data;  /*!< User data for the pipeline processing stage */
     void (*start)(i2s_chan_handle_t);       /*!< start tx/rx channel */
     void (*stop)(i2s_chan_handle_t);        /*!< stop tx/rx channel */
 };
@@ -229,6 +229,35 @@ esp_err_t i2s_channel_read(i2s_chan_handle_t handle, void *dest, size_t size, si
  */
 esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle, const i2s_event_callbacks_t *callbacks, void *user_data);
 
+/**
+ * @brief Install a zero-copy full-duplex processing pipeline between an RX and a TX channel
+ *
+ * Once installed, every completed RX DMA buffer is passed to `process_cb` directly in the ISR together with a
+ * recycled TX DMA buffer of the paired channel, and the processed frame is transmitted when the TX ring reaches
+ * that buffer. The data is never copied through `i2s_channel_read` / `i2s_channel_write` ring copies, so each
+ * frame costs exactly one processing pass. The driver invalidates the RX buffer cache before the callback and
+ * writes back the TX buffer cache after it, on targets where this is required.
+ *
+ * @note Only allowed to be called when the RX channel state is REGISTERED / READY, (i.e., before channel starts)
+ * @note Both channels must be initialized with the same DMA buffer size (same `dma_desc_num` / `dma_frame_num`
+ *       configuration), and the paired TX channel must not be fed with `i2s_channel_write` while the pipeline
+ *       is installed, as both would compete for the recycled TX buffers.
+ * @note The first few RX frames are dropped for transmission until the TX ring has sent its preloaded buffers
+ *       once, afterwards the pipeline latency stays constant at one TX ring length.
+ * @note When CONFIG_I2S_ISR_IRAM_SAFE is enabled, the callback itself and functions called by it should be placed
+ *       in IRAM. The variables used in the function should be in the SRAM as well.
+ *
+ * @param[in] rx_handle     I2S RX channel handler the pipeline is installed on
+ * @param[in] tx_handle     Paired I2S TX channel handler, only evaluated when `process_cb` is not NULL
+ * @param[in] process_cb    Processing stage invoked on every received frame, set NULL to uninstall the pipeline
+ * @param[in] user_ctx      User data, which will be passed to the processing stage directly
+ * @return
+ *      - ESP_OK                Install (or uninstall) the pipeline successfully
+ *      - ESP_ERR_INVALID_ARG   Invalid channel direction or mismatched DMA buffer sizes
+ *      - ESP_ERR_INVALID_STATE The RX channel has been enabled already
+ */
+esp_err_t i2s_channel_set_duplex_pipeline(i2s_chan_handle_t rx_handle, i2s_chan_handle_t tx_handle, i2s_duplex_process_callback_t process_cb, void *user_ctx);
+
 /************************************************ Advanced APIs *******************************************************/
 /**
  * @brief Preload the data into TX DMA buffer
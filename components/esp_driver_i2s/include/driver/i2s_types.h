@@ -126,6 +126,29 @@ typedef struct lp_i2s_channel_obj_t    *lp_i2s_chan_handle_t;  /*!< I2S channel
  */
 typedef bool (*i2s_isr_callback_t)(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
 
+/**
+ * @brief Event structure of one full-duplex pipeline frame, see `i2s_channel_set_duplex_pipeline()`
+ */
+typedef struct {
+    void                *rx_buf; /**< DMA buffer holding the frame that just finished receiving */
+    void                *tx_buf; /**< DMA buffer to fill with the frame to transmit, its previous content has been sent */
+    size_t              size;    /**< Size of both buffers in bytes */
+} i2s_duplex_event_data_t;
+
+/**
+ * @brief I2S full-duplex pipeline processing callback
+ * @note  Runs in ISR context on every completed RX DMA buffer, process the frame in `rx_buf` and
+ *        write the result to `tx_buf` (in-place processing with `rx_buf == tx_buf` content is allowed,
+ *        the buffers stay distinct), the driver handles the cache synchronization of both buffers.
+ *
+ * @param[in] rx_handle RX channel handle the pipeline is installed on
+ * @param[in] event     Pipeline frame data
+ * @param[in] user_ctx  User registered context, passed from `i2s_channel_set_duplex_pipeline()`
+ *
+ * @return Whether a high priority task has been waken up by this callback function
+ */
+typedef bool (*i2s_duplex_process_callback_t)(i2s_chan_handle_t rx_handle, i2s_duplex_event_data_t *event, void *user_ctx);
+
 /**
  * @brief LP I2S event callback type
  *
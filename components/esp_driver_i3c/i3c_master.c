@@ -127,6 +127,66 @@ static bool handle_tx_data_buf_threshold_int(i3c_master_bus_handle_t i3c_master,
     return false;
 }
 
+/**
+    Issue the pre-built read sequence for the first device with a pending IBI.
+    Only one read is started at a time: when it completes, the complete interrupt
+    handler serves the next pending IBI (or the next queued transaction).
+*/
+static void i3c_master_serve_pending_ibi_reads(i3c_master_bus_handle_t i3c_master)
+{
+    i3c_master_i2c_dev_t *dev;
+    SLIST_FOREACH(dev, &i3c_master->device_list, next) {
+        if (dev->ibi_read_enabled == false || dev->ibi_pending == 0) {
+            continue;
+        }
+        i3c_fsm_t expected_fsm = I3C_FSM_ENABLE;
+        if (atomic_compare_exchange_strong(&i3c_master->fsm, &expected_fsm, I3C_FSM_WAIT)) {
+            dev->ibi_pending--;
+            dev->ibi_trans.read_buffer = dev->ibi_bufs[dev->ibi_buf_idx];
+            dev->ibi_buf_idx = (dev->ibi_buf_idx + 1) % dev->ibi_buf_count;
+            atomic_store(&i3c_master->fsm, I3C_FSM_RUN);
+            i3c_master->transaction_handler(i3c_master, &dev->ibi_trans);
+        }
+        break;
+    }
+}
+
+/**
+    Handle IBI detect interrupt
+    Drain the IBI status buffer, record a pending read for every watched device
+    that raised an IBI, then start the read sequence if the bus is idle.
+*/
+static void handle_ibi_detect_int(i3c_master_bus_handle_t i3c_master)
+{
+    portENTER_CRITICAL_SAFE(&i3c_master->spinlock);
+    uint8_t status_cnt = i3c_master_ll_get_ibi_status_count(i3c_master->hal.dev);
+    while (status_cnt--) {
+        i3c_master_ll_ibi_status_descriptor_t ibi_status = i3c_master_ll_get_ibi_status(i3c_master->hal.dev);
+        /* Drain the payload words that came along with the IBI, the read engine
+         * fetches the batch data with a separate read sequence */
+        for (uint32_t i = 0; i < (ibi_status.data_length + 3) / 4; i++) {
+            (void)i3c_master_ll_get_ibi_data(i3c_master->hal.dev);
+        }
+        uint8_t ibi_address = ibi_status.ibi_id >> 1;
+        i3c_master_i2c_dev_t *dev;
+        SLIST_FOREACH(dev, &i3c_master->device_list, next) {
+            if (dev->ibi_read_enabled && dev->address == ibi_address) {
+                dev->ibi_pending++;
+                break;
+            }
+        }
+    }
+    portEXIT_CRITICAL_SAFE(&i3c_master->spinlock);
+
+    i3c_master_serve_pending_ibi_reads(i3c_master);
+
+    /* Keep watching for the next IBI, the default ISR disabled all triggered interrupts */
+    portENTER_CRITICAL_SAFE(&i3c_master->spinlock);
+    i3c_master_ll_clear_intr_mask(i3c_master->hal.dev, I3C_LL_MASTER_IBI_EVENT_INTR);
+    i3c_master_ll_enable_intr_mask(i3c_master->hal.dev, I3C_LL_MASTER_IBI_EVENT_INTR);
+    portEXIT_CRITICAL_SAFE(&i3c_master->spinlock);
+}
+
 /**
     Handle complete interrupt
     If there is still some remaining data to be received, receive data to buffer.
@@ -163,6 +223,41 @@ static bool handle_transfer_complete_int(i3c_master_bus_handle_t i3c_master)
         i3c_i2c_transaction_desc_t *trans_desc = NULL;
 
         i3c_fsm_t expected_fsm = I3C_FSM_RUN;
+        if (i3c_master->cur_trans->from_ibi) {
+            /* IBI engine transactions do not come from the transaction pool, hand the
+             * filled ring buffer to the application instead of the complete queue */
+            if (atomic_compare_exchange_strong(&i3c_master->fsm, &expected_fsm, I3C_FSM_ENABLE)) {
+                i3c_master_i2c_device_handle_t i2c_dev = i3c_master->cur_trans->dev_handle;
+                size_t dma_rcv_size = gdma_link_count_buffer_size_till_eof(i3c_master->rx_dma_link, 0);
+                size_t c2m_aligned_size = I3C_ALIGN_UP(dma_rcv_size, i3c_master->cache_line_size);
+                esp_cache_msync(i3c_master->cur_trans->read_buffer, c2m_aligned_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+                i3c_master_i2c_device_event_data_t evt_data = {
+                    .data = i3c_master->cur_trans->read_buffer,
+                    .data_size = dma_rcv_size,
+                    .event = event,
+                };
+                if (i2c_dev->on_ibi_batch) {
+                    if (i2c_dev->on_ibi_batch(i2c_dev, &evt_data, i2c_dev->ibi_user_ctx)) {
+                        need_yield = true;
+                    }
+                }
+            }
+            i3c_master_serve_pending_ibi_reads(i3c_master);
+
+            expected_fsm = I3C_FSM_ENABLE;
+            if (atomic_compare_exchange_strong(&i3c_master->fsm, &expected_fsm, I3C_FSM_WAIT)) {
+                if (xQueueReceiveFromISR(i3c_master->trans_queues[I3C_TRANS_QUEUE_PROGRESS], &trans_desc, &do_yield) == pdTRUE) {
+                    atomic_store(&i3c_master->fsm, I3C_FSM_RUN);
+                    i3c_master->transaction_handler(i3c_master, trans_desc);
+                    if (do_yield) {
+                        need_yield = true;
+                    }
+                } else {
+                    atomic_store(&i3c_master->fsm, I3C_FSM_ENABLE);
+                }
+            }
+            return need_yield;
+        }
         if (atomic_compare_exchange_strong(&i3c_master->fsm, &expected_fsm, I3C_FSM_WAIT)) {
             trans_desc = i3c_master->cur_trans;
             xQueueSendFromISR(i3c_master->trans_queues[I3C_TRANS_QUEUE_COMPLETE], &trans_desc, &do_yield);
@@ -190,6 +285,8 @@ static bool handle_transfer_complete_int(i3c_master_bus_handle_t i3c_master)
             }
         }
 
+        i3c_master_serve_pending_ibi_reads(i3c_master);
+
         expected_fsm = I3C_FSM_ENABLE;
         if (atomic_compare_exchange_strong(&i3c_master->fsm, &expected_fsm, I3C_FSM_WAIT)) {
             if (xQueueReceiveFromISR(i3c_master->trans_queues[I3C_TRANS_QUEUE_PROGRESS], &trans_desc, &do_yield) == pdTRUE) {
@@ -246,6 +343,10 @@ static void i3c_master_isr_handler_default(void *arg)
         handle_rx_data_buf_threshold_int(i3c_master);
     }
 
+    if (int_mask & I3C_MST_IBI_DETECT_INT_ST) {
+        handle_ibi_detect_int(i3c_master);
+    }
+
     if (need_yield) {
         portYIELD_FROM_ISR();
     }
@@ -647,7 +748,7 @@ esp_err_t i3c_new_master_bus(const i3c_master_bus_config_t *bus_config, i3c_mast
         isr_flags |= 1 << (bus_config->intr_priority);
     }
 
-    ret = esp_intr_alloc_intrstatus(i3c_master_periph_signal->irq, isr_flags, (uint32_t)i3c_master_ll_get_interrupt_status_reg(i3c_master_handle->hal.dev), I3C_LL_MASTER_EVENT_INTR, i3c_master_isr_handler_default, i3c_master_handle, &i3c_master_handle->intr_handle);
+    ret = esp_intr_alloc_intrstatus(i3c_master_periph_signal->irq, isr_flags, (uint32_t)i3c_master_ll_get_interrupt_status_reg(i3c_master_handle->hal.dev), I3C_LL_MASTER_EVENT_INTR | I3C_LL_MASTER_IBI_EVENT_INTR, i3c_master_isr_handler_default, i3c_master_handle, &i3c_master_handle->intr_handle);
     ESP_GOTO_ON_ERROR(ret, err, TAG, "install i3c master interrupt failed");
 
     // Disable DMA by default, will be enabled when decorator is called
@@ -674,6 +775,7 @@ err:
 esp_err_t i3c_master_bus_rm_i2c_device(i3c_master_i2c_device_handle_t handle)
 {
     ESP_RETURN_ON_FALSE((handle != NULL), ESP_ERR_INVALID_ARG, TAG, "this device is not initialized");
+    ESP_RETURN_ON_FALSE(handle->ibi_read_enabled == false, ESP_ERR_INVALID_STATE, TAG, "please disable the IBI driven read before removing the device");
 
     i3c_master_bus_handle_t i3c_master = handle->bus_handle;
     portENTER_CRITICAL_SAFE(&handle->bus_handle->spinlock);
@@ -951,6 +1053,112 @@ esp_err_t i3c_master_i2c_device_register_event_callbacks(i3c_master_i2c_device_h
     return ESP_OK;
 }
 
+esp_err_t i3c_master_i2c_device_enable_ibi_read(i3c_master_i2c_device_handle_t dev_handle, const i3c_master_i2c_ibi_read_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(dev_handle != NULL, ESP_ERR_INVALID_ARG, TAG, "i3c-i2c handle not initialized");
+    ESP_RETURN_ON_FALSE(config, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->read_size > 0 && config->buffer_count > 0, ESP_ERR_INVALID_ARG, TAG, "invalid read size or buffer count");
+
+    i3c_master_bus_handle_t bus_handle = dev_handle->bus_handle;
+    if (bus_handle->async_transaction == false || bus_handle->dma_initialized == false) {
+        ESP_LOGE(TAG, "IBI driven read requires async transaction and DMA, please call `i3c_master_bus_decorate_dma()` first");
+        return ESP_ERR_INVALID_STATE;
+    }
+    ESP_RETURN_ON_FALSE(dev_handle->ibi_read_enabled == false, ESP_ERR_INVALID_STATE, TAG, "IBI driven read is already enabled on this device");
+
+#if CONFIG_I3C_MASTER_ISR_CACHE_SAFE
+    if (config->on_batch_done) {
+        ESP_RETURN_ON_FALSE(esp_ptr_in_iram(config->on_batch_done), ESP_ERR_INVALID_ARG, TAG, "i3c ibi batch callback not in IRAM");
+    }
+    if (config->user_ctx) {
+        ESP_RETURN_ON_FALSE(esp_ptr_internal(config->user_ctx), ESP_ERR_INVALID_ARG, TAG, "user context not in internal RAM");
+    }
+#endif // CONFIG_I3C_MASTER_ISR_CACHE_SAFE
+
+    /* The ring buffers are filled by DMA and synchronized cache line by cache line,
+     * align both the address and the size so neighbouring memory is never synced away */
+    size_t buf_alignment = MAX(bus_handle->cache_line_size, I3C_MASTER_DMA_INTERFACE_ALIGNMENT);
+    size_t buf_size = I3C_ALIGN_UP(config->read_size, buf_alignment);
+    dev_handle->ibi_bufs = (uint8_t **)heap_caps_calloc(config->buffer_count, sizeof(uint8_t *), I3C_MASTER_MEM_ALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(dev_handle->ibi_bufs, ESP_ERR_NO_MEM, TAG, "no mem for IBI buffer ring");
+    for (size_t i = 0; i < config->buffer_count; i++) {
+        dev_handle->ibi_bufs[i] = (uint8_t *)heap_caps_aligned_calloc(buf_alignment, 1, buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        if (dev_handle->ibi_bufs[i] == NULL) {
+            for (size_t j = 0; j < i; j++) {
+                heap_caps_free(dev_handle->ibi_bufs[j]);
+            }
+            heap_caps_free(dev_handle->ibi_bufs);
+            dev_handle->ibi_bufs = NULL;
+            ESP_RETURN_ON_FALSE(false, ESP_ERR_NO_MEM, TAG, "no mem for IBI buffer ring");
+        }
+    }
+    dev_handle->ibi_buf_count = config->buffer_count;
+    dev_handle->ibi_buf_idx = 0;
+    dev_handle->ibi_pending = 0;
+    dev_handle->on_ibi_batch = config->on_batch_done;
+    dev_handle->ibi_user_ctx = config->user_ctx;
+
+    /* Pre-build the read sequence, the ISR only has to pick the next ring buffer and start it */
+    i3c_master_ll_i2c_speed_mode_t i2c_work_mode = (dev_handle->scl_freq_hz > 400 * 1000) ? I3C_MASTER_LL_I2C_FAST_MODE_PLUS : I3C_MASTER_LL_I2C_FAST_MODE;
+    dev_handle->ibi_addr_table[0] = (i3c_master_ll_device_address_descriptor_t) {
+        .i2c_static = {.static_addr = dev_handle->address, .dnrc = 0x0, .mode = I3C_MASTER_LL_MODE_I2C,}
+    };
+    dev_handle->ibi_command[0] = (i3c_master_ll_command_descriptor_t) {
+        .cmd_l.regular = {.cmd_attr = I3C_MASTER_LL_COMMAND_REGULAR, .tid = 0x0, .cmd = 0x0, .cp = 0x0, .dev_indx = 0x0, .mode = i2c_work_mode, .rnw = I3C_MASTER_LL_TRANSFER_DIR_READ, .roc = 0x1, .toc = 0x1},
+        .cmd_h.regular = {.dl = config->read_size},
+    };
+    dev_handle->ibi_trans = (i3c_i2c_transaction_desc_t) {
+        .addr_table = dev_handle->ibi_addr_table,
+        .addr_table_num = 1,
+        .command_table = dev_handle->ibi_command,
+        .command_table_num = 1,
+        .scl_freq_hz = dev_handle->scl_freq_hz,
+        .dev_handle = dev_handle,
+        .from_ibi = true,
+    };
+
+    portENTER_CRITICAL_SAFE(&bus_handle->spinlock);
+    dev_handle->ibi_read_enabled = true;
+    if (bus_handle->ibi_watch_cnt++ == 0) {
+        /* Without the broadcast address ahead of private transfers, IBIs may lose bus arbitration */
+        i3c_master_ll_inject_broadcast_address_head(bus_handle->hal.dev, true);
+        i3c_master_ll_set_ibi_sir_reject(bus_handle->hal.dev, 0);
+        i3c_master_ll_clear_intr_mask(bus_handle->hal.dev, I3C_LL_MASTER_IBI_EVENT_INTR);
+        i3c_master_ll_enable_intr_mask(bus_handle->hal.dev, I3C_LL_MASTER_IBI_EVENT_INTR);
+    }
+    portEXIT_CRITICAL_SAFE(&bus_handle->spinlock);
+
+    return ESP_OK;
+}
+
+esp_err_t i3c_master_i2c_device_disable_ibi_read(i3c_master_i2c_device_handle_t dev_handle)
+{
+    ESP_RETURN_ON_FALSE(dev_handle != NULL, ESP_ERR_INVALID_ARG, TAG, "i3c-i2c handle not initialized");
+    ESP_RETURN_ON_FALSE(dev_handle->ibi_read_enabled, ESP_ERR_INVALID_STATE, TAG, "IBI driven read is not enabled on this device");
+
+    i3c_master_bus_handle_t bus_handle = dev_handle->bus_handle;
+    portENTER_CRITICAL_SAFE(&bus_handle->spinlock);
+    dev_handle->ibi_read_enabled = false;
+    dev_handle->ibi_pending = 0;
+    if (--bus_handle->ibi_watch_cnt == 0) {
+        i3c_master_ll_disable_intr_mask(bus_handle->hal.dev, I3C_LL_MASTER_IBI_EVENT_INTR);
+        i3c_master_ll_inject_broadcast_address_head(bus_handle->hal.dev, false);
+    }
+    portEXIT_CRITICAL_SAFE(&bus_handle->spinlock);
+
+    /* Make sure a read that is still in flight has handed over its ring buffer */
+    ESP_RETURN_ON_ERROR(i3c_master_bus_wait_all_done(bus_handle, -1), TAG, "wait all transactions done failed");
+
+    for (size_t i = 0; i < dev_handle->ibi_buf_count; i++) {
+        heap_caps_free(dev_handle->ibi_bufs[i]);
+    }
+    heap_caps_free(dev_handle->ibi_bufs);
+    dev_handle->ibi_bufs = NULL;
+    dev_handle->ibi_buf_count = 0;
+
+    return ESP_OK;
+}
+
 esp_err_t i3c_master_bus_wait_all_done(i3c_master_bus_handle_t bus_handle, int timeout_ms)
 {
     ESP_RETURN_ON_FALSE(bus_handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
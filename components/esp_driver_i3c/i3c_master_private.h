@@ -93,6 +93,7 @@ typedef struct {
     uint8_t *read_buffer;                   /**< Pointer to the data buffer for reading. */
     uint32_t scl_freq_hz;                  /**< Speed of the SCL clock in Hz for the transaction. */
     i3c_master_i2c_device_handle_t dev_handle;  /**< Direct storage of device handle. */
+    bool from_ibi;                          /**< Whether the transaction was issued by the IBI driven read engine. Such transactions do not come from the transaction pool. */
 } i3c_i2c_transaction_desc_t;
 
 /**
@@ -163,6 +164,7 @@ struct i3c_master_bus_t {
     gdma_link_list_handle_t rx_dma_link; /**< Linked list for RX DMA. */
     size_t dma_buffer_alignment; /**< Alignment of the DMA buffer. */
     i3c_transaction_handler_t transaction_handler; /**< Function pointer for transaction handling (FIFO or DMA) */
+    uint32_t ibi_watch_cnt; /**< Number of devices with the IBI driven read engine enabled. */
 };
 
 /**
@@ -177,6 +179,16 @@ struct i3c_master_i2c_dev_t {
     uint32_t scl_freq_hz; /**< I2C clock speed for this device, in Hz. */
     i3c_master_i2c_callback_t on_trans_done; /**< Callback function invoked upon transaction completion. */
     void *user_ctx; /**< User-defined context passed to the callback function. */
+    bool ibi_read_enabled; /**< Whether the IBI driven read engine is enabled for this device. */
+    uint8_t **ibi_bufs; /**< Ring of DMA capable buffers filled by the IBI driven read engine. */
+    size_t ibi_buf_count; /**< Number of buffers in the IBI ring. */
+    size_t ibi_buf_idx; /**< Index of the next IBI ring buffer to fill. */
+    uint32_t ibi_pending; /**< IBIs received while the bus was busy, served when the bus turns idle. */
+    i3c_master_ll_device_address_descriptor_t ibi_addr_table[1]; /**< Pre-built address table for the IBI read sequence. */
+    i3c_master_ll_command_descriptor_t ibi_command[1]; /**< Pre-built command table for the IBI read sequence. */
+    i3c_i2c_transaction_desc_t ibi_trans; /**< Pre-built transaction descriptor for the IBI read sequence. */
+    i3c_master_i2c_callback_t on_ibi_batch; /**< Callback function invoked when one IBI ring buffer has been filled. */
+    void *ibi_user_ctx; /**< User-defined context passed to the IBI batch callback. */
     SLIST_ENTRY(i3c_master_i2c_dev_t) next; /**< Pointer to the next device in the single-linked list. */
 };
 
@@ -164,6 +164,63 @@ esp_err_t i3c_master_i2c_device_transmit_receive(i3c_master_i2c_device_handle_t
  */
 esp_err_t i3c_master_i2c_device_register_event_callbacks(i3c_master_i2c_device_handle_t dev_handle, const i3c_master_i2c_event_callbacks_t *cbs, void *user_data);
 
+/**
+ * @brief Configuration structure for the IBI driven read engine of a device
+ *
+ * When the engine is enabled, every In-Band Interrupt raised by the device makes the
+ * driver autonomously issue a read of `read_size` bytes into the next buffer of an
+ * internal ring, and invoke `on_batch_done` once the buffer has been filled.
+ */
+typedef struct {
+    size_t read_size;                           /*!< Number of bytes to read from the device on every IBI */
+    size_t buffer_count;                        /*!< Number of buffers in the internal ring. The buffer handed to the callback stays valid until `buffer_count - 1` further IBIs have been served */
+    i3c_master_i2c_callback_t on_batch_done;    /*!< Callback invoked when one ring buffer has been filled. It runs in ISR context */
+    void *user_ctx;                             /*!< User data passed to the callback */
+} i3c_master_i2c_ibi_read_config_t;
+
+/**
+ * @brief Enable the IBI driven read engine for a device on the I3C master bus
+ *
+ * Instead of polling the device, the application registers the read sequence once and the
+ * driver serves every In-Band Interrupt from interrupt context: it reads `read_size` bytes
+ * into the next ring buffer and signals the application per batch via `on_batch_done`.
+ * IBIs that arrive while the bus is busy with another transaction are recorded and served
+ * as soon as the bus turns idle.
+ *
+ * @note The engine requires asynchronous transactions and DMA, enable them via the
+ *       `enable_async_trans` flag and `i3c_master_bus_decorate_dma()` before calling this function.
+ * @note When CONFIG_I3C_MASTER_ISR_CACHE_SAFE is enabled, the callback itself and functions called
+ *       by it should be placed in IRAM, the `user_ctx` should be in internal RAM as well.
+ *
+ * @param[in] dev_handle Handle to the I2C device that raises the IBIs.
+ * @param[in] config     Pointer to the IBI read engine configuration structure.
+ *
+ * @return
+ *      - ESP_OK: IBI driven read enabled successfully.
+ *      - ESP_ERR_INVALID_ARG: Invalid parameters.
+ *      - ESP_ERR_INVALID_STATE: Asynchronous transactions or DMA are not enabled, or the engine is already enabled.
+ *      - ESP_ERR_NO_MEM: Memory allocation for the buffer ring failed.
+ */
+esp_err_t i3c_master_i2c_device_enable_ibi_read(i3c_master_i2c_device_handle_t dev_handle, const i3c_master_i2c_ibi_read_config_t *config);
+
+/**
+ * @brief Disable the IBI driven read engine for a device
+ *
+ * Stops serving In-Band Interrupts for the device, waits for a read that is still in
+ * flight to finish and releases the internal buffer ring.
+ *
+ * @note Make sure the device has stopped raising IBIs before calling this function,
+ *       otherwise unserved IBIs are silently dropped.
+ *
+ * @param[in] dev_handle Handle to the I2C device.
+ *
+ * @return
+ *      - ESP_OK: IBI driven read disabled successfully.
+ *      - ESP_ERR_INVALID_ARG: The device handle is invalid or NULL.
+ *      - ESP_ERR_INVALID_STATE: The engine is not enabled on this device.
+ */
+esp_err_t i3c_master_i2c_device_disable_ibi_read(i3c_master_i2c_device_handle_t dev_handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -109,6 +109,51 @@ TEST_CASE("I3C device add & remove check", "[i3c]")
     TEST_ESP_OK(i3c_del_master_bus(bus_handle));
 }
 
+TEST_CASE("I3C IBI driven read state check", "[i3c]")
+{
+    i3c_master_bus_config_t i3c_bus_config = {
+        .sda_io_num = I3C_MASTER_SDA_IO,
+        .scl_io_num = I3C_MASTER_SCL_IO,
+        .clock_source = I3C_MASTER_CLK_SRC_DEFAULT,
+        .trans_queue_depth = 30,
+        .intr_priority = 0,
+        .flags = {.enable_async_trans = 1}
+    };
+    i3c_master_bus_handle_t bus_handle;
+    TEST_ESP_OK(i3c_new_master_bus(&i3c_bus_config, &bus_handle));
+
+    i3c_device_i2c_config_t dev_cfg = {
+        .device_address = 0x10,
+        .scl_freq_hz = 100 * 1000
+    };
+    i3c_master_i2c_device_handle_t dev;
+    TEST_ESP_OK(i3c_master_bus_add_i2c_device(bus_handle, &dev_cfg, &dev));
+
+    i3c_master_i2c_ibi_read_config_t ibi_cfg = {
+        .read_size = 16,
+        .buffer_count = 4,
+        .on_batch_done = NULL,
+        .user_ctx = NULL,
+    };
+    // The IBI driven read requires DMA to be decorated first
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, i3c_master_i2c_device_enable_ibi_read(dev, &ibi_cfg));
+
+    i3c_master_dma_config_t dma_config = {
+        .max_transfer_size = 256,
+        .dma_burst_size = 16,
+    };
+    TEST_ESP_OK(i3c_master_bus_decorate_dma(bus_handle, &dma_config));
+    TEST_ESP_OK(i3c_master_i2c_device_enable_ibi_read(dev, &ibi_cfg));
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, i3c_master_i2c_device_enable_ibi_read(dev, &ibi_cfg));
+    // The device can't be removed while the IBI driven read is enabled
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, i3c_master_bus_rm_i2c_device(dev));
+    TEST_ESP_OK(i3c_master_i2c_device_disable_ibi_read(dev));
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, i3c_master_i2c_device_disable_ibi_read(dev));
+
+    TEST_ESP_OK(i3c_master_bus_rm_i2c_device(dev));
+    TEST_ESP_OK(i3c_del_master_bus(bus_handle));
+}
+
 TEST_CASE("I3C master clock frequency test", "[i3c]")
 {
     uint8_t data_wr[500] = { 0 };
@@ -24,5 +24,6 @@
 #include "driver/isp_hist.h"
 #include "driver/isp_lsc.h"
 #include "driver/isp_sharpen.h"
+#include "driver/isp_stats.h"
 #include "driver/isp_wbg.h"
 #include "driver/isp_crop.h"
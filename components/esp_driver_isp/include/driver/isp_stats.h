@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/isp_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Statistics types that can be collected by the stats collector
+ */
+typedef enum {
+    ISP_STATS_TYPE_AE   = (1 << 0),     ///< AE block luminance statistics
+    ISP_STATS_TYPE_AWB  = (1 << 1),     ///< AWB white patch statistics
+    ISP_STATS_TYPE_HIST = (1 << 2),     ///< Histogram statistics
+} isp_stats_type_t;
+
+/**
+ * @brief Per-frame statistics snapshot
+ *
+ * One snapshot gathers the statistics of all collected types for the same frame,
+ * tagged with a monotonically increasing frame sequence number.
+ */
+typedef struct {
+    uint32_t              frame_seq;    ///< Frame sequence tag, increases by one per completed snapshot
+    uint32_t              valid_mask;   ///< Bitwise OR of `isp_stats_type_t`, indicating which results are valid
+    isp_ae_result_t       ae_result;    ///< AE statistics result, valid when `ISP_STATS_TYPE_AE` is set in `valid_mask`
+    isp_awb_stat_result_t awb_result;   ///< AWB statistics result, valid when `ISP_STATS_TYPE_AWB` is set in `valid_mask`
+    isp_hist_result_t     hist_result;  ///< Histogram statistics result, valid when `ISP_STATS_TYPE_HIST` is set in `valid_mask`
+} esp_isp_stats_frame_t;
+
+/**
+ * @brief ISP stats collector configurations
+ */
+typedef struct {
+    uint32_t collect_mask;              ///< Bitwise OR of `isp_stats_type_t`, the statistics types to gather per frame
+} esp_isp_stats_collector_config_t;
+
+/**
+ * @brief Stats collector event data
+ */
+typedef struct {
+    const esp_isp_stats_frame_t *frame; ///< Completed per-frame statistics snapshot
+} esp_isp_stats_evt_data_t;
+
+/**
+ * @brief Prototype of ISP stats collector event callback
+ *
+ * @param[in] stats_ctlr ISP stats collector handle
+ * @param[in] edata      ISP stats collector event data
+ * @param[in] user_data  User registered context, registered when in `esp_isp_stats_register_event_callbacks()`
+ *
+ * @return Whether a high priority task is woken up by this function
+ */
+typedef bool (*esp_isp_stats_callback_t)(isp_stats_ctlr_t stats_ctlr, const esp_isp_stats_evt_data_t *edata, void *user_data);
+
+/**
+ * @brief Group of ISP stats collector callbacks
+ *
+ * @note These callbacks are all running in an ISR environment.
+ * @note When CONFIG_ISP_ISR_IRAM_SAFE is enabled, the callback itself and functions called by it should be placed in IRAM.
+ *       Involved variables should be in internal RAM as well.
+ */
+typedef struct {
+    esp_isp_stats_callback_t on_frame_done;     ///< Event callback, invoked when the statistics of all collected types have landed for one frame
+} esp_isp_stats_cbs_t;
+
+/**
+ * @brief New an ISP stats collector
+ *
+ * The stats collector batches the statistics of the enabled AE / AWB / histogram submodules
+ * into one per-frame snapshot held in a double-buffered shared region. The snapshot is filled
+ * from the existing submodule interrupts, consumers read it lock-free via
+ * `esp_isp_stats_collector_get_latest_frame()`, and at most one `on_frame_done` notification
+ * is raised per frame instead of one callback per submodule.
+ *
+ * @param[in]  isp_proc   ISP Processor handle
+ * @param[in]  config     Pointer to stats collector config. For config details, see `esp_isp_stats_collector_config_t`
+ * @param[out] ret_hdl    Stats collector handle
+ *
+ * @return
+ *         - ESP_OK                On success
+ *         - ESP_ERR_INVALID_ARG   If the combination of arguments is invalid
+ *         - ESP_ERR_NOT_FOUND     No free stats collector
+ *         - ESP_ERR_NO_MEM        If out of memory
+ */
+esp_err_t esp_isp_new_stats_collector(isp_proc_handle_t isp_proc, const esp_isp_stats_collector_config_t *config, isp_stats_ctlr_t *ret_hdl);
+
+/**
+ * @brief Delete an ISP stats collector
+ *
+ * @param[in] stats_ctlr Stats collector handle
+ *
+ * @return
+ *         - ESP_OK                On success
+ *         - ESP_ERR_INVALID_ARG   If the combination of arguments is invalid
+ *         - ESP_ERR_INVALID_STATE Driver state is invalid
+ */
+esp_err_t esp_isp_del_stats_collector(isp_stats_ctlr_t stats_ctlr);
+
+/**
+ * @brief Enable an ISP stats collector
+ *
+ * After enabling, the collector starts gathering the statistics delivered by the submodule
+ * interrupts. The controllers of all collected types need to be created beforehand, and their
+ * statistics (oneshot or continuous) still need to be started via their own APIs.
+ *
+ * @param[in] stats_ctlr Stats collector handle
+ *
+ * @return
+ *         - ESP_OK                On success
+ *         - ESP_ERR_INVALID_ARG   If the combination of arguments is invalid
+ *         - ESP_ERR_INVALID_STATE Driver state is invalid, or a collected type has no controller created
+ */
+esp_err_t esp_isp_stats_collector_enable(isp_stats_ctlr_t stats_ctlr);
+
+/**
+ * @brief Disable an ISP stats collector
+ *
+ * @param[in] stats_ctlr Stats collector handle
+ *
+ * @return
+ *         - ESP_OK                On success
+ *         - ESP_ERR_INVALID_ARG   If the combination of arguments is invalid
+ *         - ESP_ERR_INVALID_STATE Driver state is invalid
+ */
+esp_err_t esp_isp_stats_collector_disable(isp_stats_ctlr_t stats_ctlr);
+
+/**
+ * @brief Get the latest completed per-frame statistics snapshot
+ *
+ * This function is lock-free: it copies the snapshot out of the shared region and retries if the
+ * collector completed a new frame in the middle of the copy. It never blocks and can be called
+ * from the 3A task at any rate, independently from the frame rate.
+ *
+ * @param[in]  stats_ctlr Stats collector handle
+ * @param[out] out_frame  Latest completed snapshot
+ *
+ * @return
+ *         - ESP_OK                On success
+ *         - ESP_ERR_INVALID_ARG   If the combination of arguments is invalid
+ *         - ESP_ERR_NOT_FOUND     No frame has been completed yet
+ */
+esp_err_t esp_isp_stats_collector_get_latest_frame(isp_stats_ctlr_t stats_ctlr, esp_isp_stats_frame_t *out_frame);
+
+/**
+ * @brief Register ISP stats collector event callbacks
+ *
+ * @note User can deregister a previously registered callback by calling this function and setting the to-be-deregistered callback member in
+ *       the `cbs` structure to NULL.
+ *
+ * @param[in] stats_ctlr Stats collector handle
+ * @param[in] cbs        Group of callback functions
+ * @param[in] user_data  User data, which will be delivered to the callback functions directly
+ *
+ * @return
+ *         - ESP_OK                On success
+ *         - ESP_ERR_INVALID_ARG   If the combination of arguments is invalid
+ *         - ESP_ERR_INVALID_STATE Driver state is invalid, you shouldn't call this API at this moment
+ */
+esp_err_t esp_isp_stats_register_event_callbacks(isp_stats_ctlr_t stats_ctlr, const esp_isp_stats_cbs_t *cbs, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
@@ -92,6 +92,11 @@ typedef struct isp_ae_controller_t *isp_ae_ctlr_t;
  */
 typedef struct isp_hist_controller_t *isp_hist_ctlr_t;
 
+/**
+ * @brief Type of ISP stats collector handle
+ */
+typedef struct isp_stats_collector_t *isp_stats_ctlr_t;
+
 /*---------------------------------------------
                 Event Callbacks
 ----------------------------------------------*/
@@ -79,6 +79,7 @@ typedef struct isp_processor_t {
     isp_awb_ctlr_t              awb_ctlr;
     isp_ae_ctlr_t               ae_ctlr;
     isp_hist_ctlr_t             hist_ctlr;
+    isp_stats_ctlr_t            stats_ctlr;
     ISP_ATOMIC_TYPE(isp_fsm_t)  bf_fsm;
     ISP_ATOMIC_TYPE(isp_fsm_t)  blc_fsm;
     ISP_ATOMIC_TYPE(isp_fsm_t)  ccm_fsm;
@@ -125,6 +126,11 @@ bool esp_isp_ae_isr(isp_proc_handle_t proc, uint32_t ae_events);
 bool esp_isp_awb_isr(isp_proc_handle_t proc, uint32_t awb_events);
 bool esp_isp_sharpen_isr(isp_proc_handle_t proc, uint32_t sharp_events);
 bool esp_isp_hist_isr(isp_proc_handle_t proc, uint32_t hist_events);
+#if SOC_ISP_SUPPORTED
+bool esp_isp_stats_collector_feed_ae(isp_proc_handle_t proc, const isp_ae_result_t *res);
+bool esp_isp_stats_collector_feed_awb(isp_proc_handle_t proc, const isp_awb_stat_result_t *res);
+bool esp_isp_stats_collector_feed_hist(isp_proc_handle_t proc, const isp_hist_result_t *res);
+#endif
 
 #ifdef __cplusplus
 }
@@ -302,6 +302,8 @@ bool IRAM_ATTR esp_isp_ae_isr(isp_proc_handle_t proc, uint32_t ae_events)
      * Should decide a detector instance according to the hw event.
      */
     if (ae_events & ISP_LL_EVENT_AE_FDONE) {
+        // Feed the stats collector, if one is gathering per-frame snapshots
+        need_yield |= esp_isp_stats_collector_feed_ae(proc, &edata.ae_result);
         if (ae_ctlr->cbs.on_env_statistics_done) {
             need_yield |= ae_ctlr->cbs.on_env_statistics_done(ae_ctlr, &edata, ae_ctlr->user_data);
         }
@@ -305,6 +305,8 @@ bool IRAM_ATTR esp_isp_awb_isr(isp_proc_handle_t proc, uint32_t awb_events)
             }
         }
 
+        // Feed the stats collector, if one is gathering per-frame snapshots
+        need_yield |= esp_isp_stats_collector_feed_awb(proc, &edata.awb_result);
         // Invoke the callback if the callback is registered
         if (awb_ctlr->cbs.on_statistics_done) {
             need_yield |= awb_ctlr->cbs.on_statistics_done(awb_ctlr, &edata, awb_ctlr->user_data);
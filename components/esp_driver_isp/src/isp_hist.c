@@ -243,6 +243,8 @@ bool IRAM_ATTR esp_isp_hist_isr(isp_proc_handle_t proc, uint32_t hist_events)
         for (int i = 0; i < ISP_HIST_SEGMENT_NUMS; i++) {
             edata.hist_result.hist_value[i] = hist_value[i];
         }
+        // Feed the stats collector, if one is gathering per-frame snapshots
+        need_yield |= esp_isp_stats_collector_feed_hist(proc, &edata.hist_result);
         // Invoke the callback if the callback is registered
         if (hist_ctlr->cbs.on_statistics_done) {
             need_yield |= hist_ctlr->cbs.on_statistics_done(hist_ctlr, &edata, hist_ctlr->user_data);
@@ -0,0 +1,240 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <esp_types.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "driver/isp_stats.h"
+#include "esp_private/isp_private.h"
+
+#define ISP_STATS_SUPPORTED_MASK    (ISP_STATS_TYPE_AE | ISP_STATS_TYPE_AWB | ISP_STATS_TYPE_HIST)
+
+typedef struct isp_stats_collector_t {
+    _Atomic isp_fsm_t                  fsm;
+    portMUX_TYPE                       spinlock;
+    isp_proc_handle_t                  isp_proc;
+    uint32_t                           collect_mask;
+    /**
+     * Double-buffered shared region. One buffer is being filled by the submodule ISRs,
+     * the other one holds the latest completed frame and is read lock-free by consumers.
+     * `buf_seq` is odd while the buffer content is unstable, even when it is consistent.
+     */
+    esp_isp_stats_frame_t              frames[2];
+    _Atomic uint32_t                   buf_seq[2];
+    _Atomic int                        latest_idx;
+    int                                write_idx;
+    uint32_t                           collected_mask;
+    uint32_t                           frame_seq;
+    esp_isp_stats_cbs_t                cbs;
+    void                               *user_data;
+} isp_stats_collector_t;
+
+static const char *TAG = "ISP_STATS";
+
+/*---------------------------------------------
+                STATS
+----------------------------------------------*/
+static esp_err_t s_isp_claim_stats_collector(isp_proc_handle_t isp_proc, isp_stats_ctlr_t stats_ctlr)
+{
+    assert(isp_proc && stats_ctlr);
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    esp_os_enter_critical(&isp_proc->spinlock);
+    if (!isp_proc->stats_ctlr) {
+        isp_proc->stats_ctlr = stats_ctlr;
+        ret = ESP_OK;
+    }
+    esp_os_exit_critical(&isp_proc->spinlock);
+
+    return ret;
+}
+
+static void s_isp_declaim_stats_collector(isp_stats_ctlr_t stats_ctlr)
+{
+    if (stats_ctlr && stats_ctlr->isp_proc) {
+        esp_os_enter_critical(&stats_ctlr->isp_proc->spinlock);
+        stats_ctlr->isp_proc->stats_ctlr = NULL;
+        esp_os_exit_critical(&stats_ctlr->isp_proc->spinlock);
+    }
+}
+
+esp_err_t esp_isp_new_stats_collector(isp_proc_handle_t isp_proc, const esp_isp_stats_collector_config_t *config, isp_stats_ctlr_t *ret_hdl)
+{
+    esp_err_t ret = ESP_FAIL;
+    ESP_RETURN_ON_FALSE(isp_proc && config && ret_hdl, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    ESP_RETURN_ON_FALSE(config->collect_mask && !(config->collect_mask & ~ISP_STATS_SUPPORTED_MASK), ESP_ERR_INVALID_ARG, TAG, "invalid collect mask");
+
+    isp_stats_ctlr_t stats_ctlr = heap_caps_calloc(1, sizeof(isp_stats_collector_t), ISP_MEM_ALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(stats_ctlr, ESP_ERR_NO_MEM, TAG, "no mem for stats collector");
+    atomic_init(&stats_ctlr->fsm, ISP_FSM_INIT);
+    atomic_init(&stats_ctlr->latest_idx, -1);
+    stats_ctlr->spinlock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+    stats_ctlr->isp_proc = isp_proc;
+    stats_ctlr->collect_mask = config->collect_mask;
+
+    // Claim a stats collector
+    ESP_GOTO_ON_ERROR(s_isp_claim_stats_collector(isp_proc, stats_ctlr), err, TAG, "no available collector");
+
+    *ret_hdl = stats_ctlr;
+
+    return ESP_OK;
+
+err:
+    free(stats_ctlr);
+
+    return ret;
+}
+
+esp_err_t esp_isp_del_stats_collector(isp_stats_ctlr_t stats_ctlr)
+{
+    ESP_RETURN_ON_FALSE(stats_ctlr && stats_ctlr->isp_proc, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    ESP_RETURN_ON_FALSE(stats_ctlr->isp_proc->stats_ctlr == stats_ctlr, ESP_ERR_INVALID_ARG, TAG, "collector isn't in use");
+    ESP_RETURN_ON_FALSE(atomic_load(&stats_ctlr->fsm) == ISP_FSM_INIT, ESP_ERR_INVALID_STATE, TAG, "collector not in init state");
+
+    s_isp_declaim_stats_collector(stats_ctlr);
+    free(stats_ctlr);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_isp_stats_collector_enable(isp_stats_ctlr_t stats_ctlr)
+{
+    ESP_RETURN_ON_FALSE(stats_ctlr && stats_ctlr->isp_proc, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    // The collector taps the statistics out of the submodule interrupts, so the controllers
+    // of all collected types need to exist before the collector starts
+    if (stats_ctlr->collect_mask & ISP_STATS_TYPE_AE) {
+        ESP_RETURN_ON_FALSE(stats_ctlr->isp_proc->ae_ctlr, ESP_ERR_INVALID_STATE, TAG, "AE controller not created");
+    }
+    if (stats_ctlr->collect_mask & ISP_STATS_TYPE_AWB) {
+        ESP_RETURN_ON_FALSE(stats_ctlr->isp_proc->awb_ctlr, ESP_ERR_INVALID_STATE, TAG, "AWB controller not created");
+    }
+    if (stats_ctlr->collect_mask & ISP_STATS_TYPE_HIST) {
+        ESP_RETURN_ON_FALSE(stats_ctlr->isp_proc->hist_ctlr, ESP_ERR_INVALID_STATE, TAG, "HIST controller not created");
+    }
+
+    isp_fsm_t expected_fsm = ISP_FSM_INIT;
+    ESP_RETURN_ON_FALSE(atomic_compare_exchange_strong(&stats_ctlr->fsm, &expected_fsm, ISP_FSM_ENABLE),
+                        ESP_ERR_INVALID_STATE, TAG, "collector not in init state");
+
+    return ESP_OK;
+}
+
+esp_err_t esp_isp_stats_collector_disable(isp_stats_ctlr_t stats_ctlr)
+{
+    ESP_RETURN_ON_FALSE(stats_ctlr, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+
+    isp_fsm_t expected_fsm = ISP_FSM_ENABLE;
+    ESP_RETURN_ON_FALSE(atomic_compare_exchange_strong(&stats_ctlr->fsm, &expected_fsm, ISP_FSM_INIT),
+                        ESP_ERR_INVALID_STATE, TAG, "collector not in enable state");
+
+    // Drop a partially gathered frame, the next enable starts from a clean snapshot
+    esp_os_enter_critical(&stats_ctlr->spinlock);
+    stats_ctlr->collected_mask = 0;
+    esp_os_exit_critical(&stats_ctlr->spinlock);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_isp_stats_collector_get_latest_frame(isp_stats_ctlr_t stats_ctlr, esp_isp_stats_frame_t *out_frame)
+{
+    ESP_RETURN_ON_FALSE(stats_ctlr && out_frame, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+
+    // Seqlock style read: copy the latest completed buffer, retry if the ISR
+    // started refilling it (odd sequence) or completed a new frame meanwhile
+    while (1) {
+        int idx = atomic_load(&stats_ctlr->latest_idx);
+        if (idx < 0) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        uint32_t seq_begin = atomic_load(&stats_ctlr->buf_seq[idx]);
+        if (seq_begin & 1) {
+            continue;
+        }
+        memcpy(out_frame, &stats_ctlr->frames[idx], sizeof(esp_isp_stats_frame_t));
+        uint32_t seq_end = atomic_load(&stats_ctlr->buf_seq[idx]);
+        if (seq_begin == seq_end) {
+            return ESP_OK;
+        }
+    }
+}
+
+esp_err_t esp_isp_stats_register_event_callbacks(isp_stats_ctlr_t stats_ctlr, const esp_isp_stats_cbs_t *cbs, void *user_data)
+{
+    ESP_RETURN_ON_FALSE(stats_ctlr && cbs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(atomic_load(&stats_ctlr->fsm) == ISP_FSM_INIT, ESP_ERR_INVALID_STATE, TAG, "collector not in init state");
+#if CONFIG_ISP_ISR_IRAM_SAFE
+    if (cbs->on_frame_done) {
+        ESP_RETURN_ON_FALSE(esp_ptr_in_iram(cbs->on_frame_done), ESP_ERR_INVALID_ARG, TAG, "on_frame_done callback not in IRAM");
+    }
+    if (user_data) {
+        ESP_RETURN_ON_FALSE(esp_ptr_internal(user_data), ESP_ERR_INVALID_ARG, TAG, "user context not in internal RAM");
+    }
+#endif
+    stats_ctlr->cbs.on_frame_done = cbs->on_frame_done;
+    stats_ctlr->user_data = user_data;
+
+    return ESP_OK;
+}
+
+/*---------------------------------------------------------------
+                      INTR
+---------------------------------------------------------------*/
+static bool IRAM_ATTR s_isp_stats_collector_feed(isp_proc_handle_t proc, isp_stats_type_t type, const void *result, size_t result_size, size_t result_offset)
+{
+    bool need_yield = false;
+    isp_stats_ctlr_t stats_ctlr = proc->stats_ctlr;
+
+    if (!stats_ctlr || atomic_load(&stats_ctlr->fsm) != ISP_FSM_ENABLE || !(stats_ctlr->collect_mask & type)) {
+        return false;
+    }
+
+    esp_isp_stats_frame_t *frame = &stats_ctlr->frames[stats_ctlr->write_idx];
+    if (stats_ctlr->collected_mask == 0) {
+        // First statistics of a new frame, mark the buffer content as unstable
+        atomic_fetch_add(&stats_ctlr->buf_seq[stats_ctlr->write_idx], 1);
+    }
+    memcpy((uint8_t *)frame + result_offset, result, result_size);
+    stats_ctlr->collected_mask |= type;
+
+    if ((stats_ctlr->collected_mask & stats_ctlr->collect_mask) == stats_ctlr->collect_mask) {
+        // All collected types have landed, seal the snapshot and publish it
+        frame->frame_seq = ++stats_ctlr->frame_seq;
+        frame->valid_mask = stats_ctlr->collected_mask;
+        atomic_fetch_add(&stats_ctlr->buf_seq[stats_ctlr->write_idx], 1);
+        atomic_store(&stats_ctlr->latest_idx, stats_ctlr->write_idx);
+        stats_ctlr->write_idx ^= 1;
+        stats_ctlr->collected_mask = 0;
+        if (stats_ctlr->cbs.on_frame_done) {
+            esp_isp_stats_evt_data_t edata = {
+                .frame = frame,
+            };
+            need_yield |= stats_ctlr->cbs.on_frame_done(stats_ctlr, &edata, stats_ctlr->user_data);
+        }
+    }
+
+    return need_yield;
+}
+
+bool IRAM_ATTR esp_isp_stats_collector_feed_ae(isp_proc_handle_t proc, const isp_ae_result_t *res)
+{
+    return s_isp_stats_collector_feed(proc, ISP_STATS_TYPE_AE, res, sizeof(isp_ae_result_t), offsetof(esp_isp_stats_frame_t, ae_result));
+}
+
+bool IRAM_ATTR esp_isp_stats_collector_feed_awb(isp_proc_handle_t proc, const isp_awb_stat_result_t *res)
+{
+    return s_isp_stats_collector_feed(proc, ISP_STATS_TYPE_AWB, res, sizeof(isp_awb_stat_result_t), offsetof(esp_isp_stats_frame_t, awb_result));
+}
+
+bool IRAM_ATTR esp_isp_stats_collector_feed_hist(isp_proc_handle_t proc, const isp_hist_result_t *res)
+{
+    return s_isp_stats_collector_feed(proc, ISP_STATS_TYPE_HIST, res, sizeof(isp_hist_result_t), offsetof(esp_isp_stats_frame_t, hist_result));
+}
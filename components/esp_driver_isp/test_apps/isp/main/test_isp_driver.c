@@ -454,3 +454,68 @@ TEST_CASE("ISP HIST controller exhausted allocation", "[isp]")
     }
     TEST_ESP_OK(esp_isp_del_processor(isp_proc));
 }
+
+/*---------------------------------------------------------------
+                      STATS
+---------------------------------------------------------------*/
+
+TEST_CASE("ISP stats collector state check", "[isp]")
+{
+    esp_isp_processor_cfg_t isp_config = {
+        .clk_hz = 80 * 1000 * 1000,
+        .input_data_source = ISP_INPUT_DATA_SOURCE_CSI,
+        .input_data_color_type = ISP_COLOR_RAW8,
+        .output_data_color_type = ISP_COLOR_RGB565,
+    };
+    isp_proc_handle_t isp_proc = NULL;
+    TEST_ESP_OK(esp_isp_new_processor(&isp_config, &isp_proc));
+
+    esp_isp_stats_collector_config_t stats_config = {
+        .collect_mask = ISP_STATS_TYPE_AE | ISP_STATS_TYPE_HIST,
+    };
+    isp_stats_ctlr_t stats_ctlr = NULL;
+    isp_stats_ctlr_t stats_ctlr2 = NULL;
+    esp_isp_stats_frame_t frame = {};
+    TEST_ESP_OK(esp_isp_new_stats_collector(isp_proc, &stats_config, &stats_ctlr));
+    /* Only one collector per processor */
+    TEST_ASSERT(esp_isp_new_stats_collector(isp_proc, &stats_config, &stats_ctlr2) == ESP_ERR_NOT_FOUND);
+    /* The controllers of the collected types have to exist before enabling */
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, esp_isp_stats_collector_enable(stats_ctlr));
+
+    esp_isp_ae_config_t ae_config = {
+        .sample_point = ISP_AE_SAMPLE_POINT_AFTER_DEMOSAIC,
+    };
+    isp_ae_ctlr_t ae_ctlr = NULL;
+    TEST_ESP_OK(esp_isp_new_ae_controller(isp_proc, &ae_config, &ae_ctlr));
+
+    esp_isp_hist_config_t hist_config = {
+        .segment_threshold = {16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240},
+        .hist_mode = ISP_HIST_SAMPLING_RGB,
+        .rgb_coefficient.coeff_r = {{86, 0}},
+        .rgb_coefficient.coeff_g = {{85, 0}},
+        .rgb_coefficient.coeff_b = {{85, 0}},
+        .window_weight = {
+            {{16, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}},
+            {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}},
+            {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}},
+            {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}},
+            {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}}, {{10, 0}},
+        },
+    };
+    isp_hist_ctlr_t hist_ctlr = NULL;
+    TEST_ESP_OK(esp_isp_new_hist_controller(isp_proc, &hist_config, &hist_ctlr));
+
+    TEST_ESP_OK(esp_isp_stats_collector_enable(stats_ctlr));
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, esp_isp_stats_collector_enable(stats_ctlr));
+    /* No submodule statistics started, so no frame can be completed yet */
+    TEST_ESP_ERR(ESP_ERR_NOT_FOUND, esp_isp_stats_collector_get_latest_frame(stats_ctlr, &frame));
+    /* The collector can't be deleted while it is enabled */
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, esp_isp_del_stats_collector(stats_ctlr));
+    TEST_ESP_OK(esp_isp_stats_collector_disable(stats_ctlr));
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, esp_isp_stats_collector_disable(stats_ctlr));
+    TEST_ESP_OK(esp_isp_del_stats_collector(stats_ctlr));
+
+    TEST_ESP_OK(esp_isp_del_hist_controller(hist_ctlr));
+    TEST_ESP_OK(esp_isp_del_ae_controller(ae_ctlr));
+    TEST_ESP_OK(esp_isp_del_processor(isp_proc));
+}
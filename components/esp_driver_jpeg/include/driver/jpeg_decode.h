@@ -107,6 +107,61 @@ esp_err_t jpeg_decoder_get_info(const uint8_t *bit_stream, uint32_t stream_size,
  */
 esp_err_t jpeg_decoder_process(jpeg_decoder_handle_t decoder_engine, const jpeg_decode_cfg_t *decode_cfg, const uint8_t *bit_stream, uint32_t stream_size, uint8_t *decode_outbuf, uint32_t outbuf_size, uint32_t *out_size);
 
+/**
+ * @brief One slice of decoded image data, handed to the slice callback.
+ */
+typedef struct {
+    uint8_t *buffer;          /*!< Bounce buffer holding the decoded rows */
+    uint32_t buffer_size;     /*!< Number of valid bytes in the buffer */
+    uint32_t start_row;       /*!< Index of the first row of this slice within the frame */
+    uint32_t num_rows;        /*!< Number of decoded rows in this slice */
+} jpeg_decode_slice_t;
+
+/**
+ * @brief Callback invoked for every decoded slice during jpeg_decoder_process_slices().
+ *
+ * Runs in the context of the task that called jpeg_decoder_process_slices(). The slice
+ * buffer may be reused by the hardware after the callback returns, so the data must be
+ * consumed (e.g. pushed to a panel) before returning.
+ *
+ * @param[in] decoder_engine Handle of the JPEG decoder instance.
+ * @param[in] slice Decoded slice data.
+ * @param[in] user_ctx User context given to jpeg_decoder_process_slices().
+ * @return ESP_OK to continue the decode, any other value to abort it (the value is
+ *         propagated as the return value of jpeg_decoder_process_slices()).
+ */
+typedef esp_err_t (*jpeg_decode_slice_cb_t)(jpeg_decoder_handle_t decoder_engine, const jpeg_decode_slice_t *slice, void *user_ctx);
+
+/**
+ * @brief Process a JPEG image, emitting the output as MCU-row slices into bounce buffers.
+ *
+ * Instead of decoding into one full-frame buffer, the decoder fills the two given bounce
+ * buffers in ping-pong order, one slice of whole MCU rows at a time, and invokes `slice_cb`
+ * for each finished slice. While the callback consumes one buffer (for example by handing
+ * it to `esp_lcd_panel_draw_bitmap()`), the hardware decodes the next slice into the other
+ * one, so decode and panel transfer overlap and no full-size framebuffer is needed.
+ *
+ * The slice height is derived from `slice_buf_size`: the largest multiple of the picture's
+ * MCU height whose rows fit into one buffer. Each buffer must therefore hold at least one
+ * MCU row (16 rows of output for a YUV420 source, 8 for YUV444/gray). Buffers must satisfy
+ * the same cache alignment rules as the output buffer of jpeg_decoder_process(); use
+ * jpeg_alloc_decoder_mem() to allocate them.
+ *
+ * @param[in] decoder_engine Handle of the JPEG decoder instance to use for processing.
+ * @param[in] decode_cfg Config structure of decoder.
+ * @param[in] bit_stream Pointer to the buffer containing the input JPEG image data.
+ * @param[in] stream_size Size of the input JPEG image data in bytes.
+ * @param[in] slice_buf Two bounce buffers filled with decoded slices in ping-pong order.
+ * @param[in] slice_buf_size The size of each bounce buffer in bytes.
+ * @param[in] slice_cb Callback invoked for every decoded slice.
+ * @param[in] user_ctx User context passed to `slice_cb`.
+ * @return
+ *      - ESP_OK: JPEG decoder process successfully.
+ *      - ESP_ERR_INVALID_ARG: JPEG decoder process failed because of invalid argument.
+ *      - Any other value returned by `slice_cb`: decode was aborted by the callback.
+ */
+esp_err_t jpeg_decoder_process_slices(jpeg_decoder_handle_t decoder_engine, const jpeg_decode_cfg_t *decode_cfg, const uint8_t *bit_stream, uint32_t stream_size, uint8_t *slice_buf[2], uint32_t slice_buf_size, jpeg_decode_slice_cb_t slice_cb, void *user_ctx);
+
 /**
  * @brief Release resources used by a JPEG decoder instance.
  *
@@ -38,6 +38,10 @@ static const char *TAG = "jpeg.decoder";
 
 static void s_decoder_error_log_print(uint32_t status);
 static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_engine);
+static esp_err_t jpeg_dec_get_dma_hb(jpeg_decoder_handle_t decoder_engine, uint32_t *dma_hb);
+static dma2d_descriptor_t *jpeg_dec_slice_desc(jpeg_decoder_handle_t decoder_engine, uint32_t idx);
+static void cfg_desc(jpeg_decoder_handle_t decoder_engine, dma2d_descriptor_t *dsc, uint8_t en_2d, uint8_t mode, uint16_t vb, uint16_t hb, uint8_t eof, uint32_t pbyte, uint8_t owner, uint16_t va, uint16_t ha, uint8_t *buf, dma2d_descriptor_t *next_dsc);
+static void jpeg_dec_config_slice_descriptor(jpeg_decoder_handle_t decoder_engine, uint32_t idx, uint8_t owner, uint8_t *slice_buf[2], uint32_t slice_rows, uint32_t dma_hb);
 static esp_err_t jpeg_parse_marker(jpeg_decoder_handle_t decoder_engine, const uint8_t *in_buf, uint32_t inbuf_len);
 static esp_err_t jpeg_check_marker(jpeg_decoder_handle_t decoder_engine);
 static esp_err_t jpeg_parse_header_info_to_hw(jpeg_decoder_handle_t decoder_engine);
@@ -312,6 +316,155 @@ err2:
     return ret;
 }
 
+esp_err_t jpeg_decoder_process_slices(jpeg_decoder_handle_t decoder_engine, const jpeg_decode_cfg_t *decode_cfg, const uint8_t *bit_stream, uint32_t stream_size, uint8_t *slice_buf[2], uint32_t slice_buf_size, jpeg_decode_slice_cb_t slice_cb, void *user_ctx)
+{
+    ESP_RETURN_ON_FALSE(decoder_engine, ESP_ERR_INVALID_ARG, TAG, "jpeg decode handle is null");
+    ESP_RETURN_ON_FALSE(decode_cfg, ESP_ERR_INVALID_ARG, TAG, "jpeg decode config is null");
+    ESP_RETURN_ON_FALSE(slice_buf && slice_buf[0] && slice_buf[1] && slice_buf_size, ESP_ERR_INVALID_ARG, TAG, "jpeg decode slice buffer is null");
+    ESP_RETURN_ON_FALSE(slice_cb, ESP_ERR_INVALID_ARG, TAG, "jpeg decode slice callback is null");
+
+    for (int i = 0; i < 2; i++) {
+        uint32_t cache_line_size = esp_cache_get_line_size_by_addr(slice_buf[i]);
+        ESP_RETURN_ON_FALSE(_check_buffer_alignment(slice_buf[i], slice_buf_size, cache_line_size), ESP_ERR_INVALID_ARG, TAG,
+                            "jpeg decode slice buffer or its size is not aligned, please use jpeg_alloc_decoder_mem to malloc your buffer");
+    }
+
+    esp_err_t ret = ESP_OK;
+
+#if CONFIG_PM_ENABLE
+    if (decoder_engine->codec_base->pm_lock) {
+        ESP_RETURN_ON_ERROR(esp_pm_lock_acquire(decoder_engine->codec_base->pm_lock), TAG, "acquire pm_lock failed");
+    }
+#endif
+
+    xSemaphoreTake(decoder_engine->codec_base->codec_mutex, portMAX_DELAY);
+    /* Reset queue */
+    xQueueReset(decoder_engine->evt_queue);
+
+    decoder_engine->output_format = decode_cfg->output_format;
+    decoder_engine->rgb_order = decode_cfg->rgb_order;
+    decoder_engine->conv_std = decode_cfg->conv_std;
+    decoder_engine->decoded_buf = NULL;
+
+    ESP_GOTO_ON_ERROR(jpeg_parse_marker(decoder_engine, bit_stream, stream_size), err2, TAG, "jpeg parse marker failed");
+    ESP_GOTO_ON_ERROR(jpeg_check_marker(decoder_engine), err2, TAG, "jpeg check marker failed");
+    ESP_GOTO_ON_ERROR(jpeg_parse_header_info_to_hw(decoder_engine), err2, TAG, "write header info to hw failed");
+
+    uint32_t dma_hb = 0;
+    ESP_GOTO_ON_ERROR(jpeg_dec_get_dma_hb(decoder_engine, &dma_hb), err2, TAG, "get dma horizontal block size failed");
+
+    jpeg_dec_header_info_t *header_info = decoder_engine->header_info;
+    uint32_t bytes_per_row = header_info->process_h * decoder_engine->bit_per_pixel / 8;
+    // Largest whole number of MCU rows that fits into one bounce buffer
+    uint32_t slice_rows = (slice_buf_size / bytes_per_row) / header_info->mcuy * header_info->mcuy;
+    ESP_GOTO_ON_FALSE(slice_rows != 0, ESP_ERR_INVALID_ARG, err2, TAG,
+                      "slice buffer too small: one MCU row needs %d rows of %" PRIu32 " bytes", header_info->mcuy, bytes_per_row);
+    uint32_t num_slices = (header_info->process_v + slice_rows - 1) / slice_rows;
+
+    uint32_t cache_line_size = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_EXT_MEM, CACHE_TYPE_DATA);
+    decoder_engine->slice_link = (dma2d_descriptor_t *)heap_caps_aligned_calloc(cache_line_size, num_slices, decoder_engine->dma_desc_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | JPEG_MEM_ALLOC_CAPS);
+    ESP_GOTO_ON_FALSE(decoder_engine->slice_link, ESP_ERR_NO_MEM, err2, TAG, "no memory for jpeg decode slice descriptors");
+    decoder_engine->slice_link_count = num_slices;
+
+    // Configure tx link descriptor
+    cfg_desc(decoder_engine, decoder_engine->txlink, JPEG_DMA2D_2D_DISABLE, DMA2D_DESCRIPTOR_BLOCK_RW_MODE_SINGLE, header_info->buffer_left & JPEG_DMA2D_MAX_SIZE, header_info->buffer_left & JPEG_DMA2D_MAX_SIZE, JPEG_DMA2D_EOF_NOT_LAST, 1, DMA2D_DESCRIPTOR_BUFFER_OWNER_DMA, (header_info->buffer_left >> JPEG_DMA2D_1D_HIGH_14BIT), (header_info->buffer_left >> JPEG_DMA2D_1D_HIGH_14BIT), header_info->buffer_offset, NULL);
+
+    // Configure one rx descriptor per slice. Only the first two (one per bounce buffer)
+    // are owned by the DMA; with owner check enabled the RX engine halts at the first
+    // CPU-owned descriptor until the consumer releases the matching bounce buffer.
+    for (uint32_t i = 0; i < num_slices; i++) {
+        jpeg_dec_config_slice_descriptor(decoder_engine, i, (i < 2) ? DMA2D_DESCRIPTOR_BUFFER_OWNER_DMA : DMA2D_DESCRIPTOR_BUFFER_OWNER_CPU, slice_buf, slice_rows, dma_hb);
+    }
+
+    dma2d_trans_config_t trans_desc = {
+        .tx_channel_num = 1,
+        .rx_channel_num = 1,
+        .channel_flags = DMA2D_CHANNEL_FUNCTION_FLAG_RX_REORDER,
+        .user_config = decoder_engine,
+        .on_job_picked = jpeg_dec_transaction_on_picked,
+    };
+
+    // Before 2DDMA starts. sync buffer from cache to psram
+    ret = esp_cache_msync((void*)header_info->buffer_offset, header_info->buffer_left, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+    assert(ret == ESP_OK);
+
+    // Before 2DDMA starts, invalidate both bounce buffers ahead of time.
+    for (int i = 0; i < 2; i++) {
+        ret = esp_cache_msync((void*)slice_buf[i], slice_buf_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+        assert(ret == ESP_OK);
+    }
+
+    decoder_engine->slice_mode = true;
+    ESP_GOTO_ON_ERROR(dma2d_enqueue(decoder_engine->dma2d_group_handle, &trans_desc, decoder_engine->trans_desc), err2, TAG, "enqueue dma2d failed");
+    bool need_yield;
+    uint32_t consumed = 0;
+    while (consumed < num_slices) {
+        jpeg_dma2d_dec_evt_t jpeg_dma2d_event;
+        BaseType_t ret_val = xQueueReceive(decoder_engine->evt_queue, &jpeg_dma2d_event, decoder_engine->timeout_tick);
+        ESP_GOTO_ON_FALSE(ret_val == pdTRUE, ESP_ERR_TIMEOUT, err1, TAG, "jpeg-dma2d handle jpeg decode timeout, please check image accuracy and `timeout_ms` ");
+
+        // Dealing with JPEG event
+        if (jpeg_dma2d_event.jpgd_status != 0) {
+            uint32_t status = jpeg_dma2d_event.jpgd_status;
+            s_decoder_error_log_print(status);
+            ret = ESP_ERR_INVALID_STATE;
+            goto err1;
+        }
+
+        if (jpeg_dma2d_event.dma_evt & JPEG_DMA2D_RX_DONE) {
+            uint8_t *buffer = slice_buf[consumed % 2];
+            uint32_t start_row = consumed * slice_rows;
+            uint32_t num_rows = (start_row + slice_rows > header_info->process_v) ? (header_info->process_v - start_row) : slice_rows;
+            if (esp_cache_get_line_size_by_addr(buffer) > 0) {
+                ret = esp_cache_msync((void*)buffer, slice_buf_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+                assert(ret == ESP_OK);
+            }
+            jpeg_decode_slice_t slice = {
+                .buffer = buffer,
+                .buffer_size = num_rows * bytes_per_row,
+                .start_row = start_row,
+                .num_rows = num_rows,
+            };
+            ret = slice_cb(decoder_engine, &slice, user_ctx);
+            ESP_GOTO_ON_ERROR(ret, err1, TAG, "decode aborted by slice callback");
+            // The consumer is done with this bounce buffer: hand it back to the DMA
+            // for the slice that reuses it, and tell the RX engine to re-scan its link.
+            if (consumed + 2 < num_slices) {
+                jpeg_dec_config_slice_descriptor(decoder_engine, consumed + 2, DMA2D_DESCRIPTOR_BUFFER_OWNER_DMA, slice_buf, slice_rows, dma_hb);
+                dma2d_append(decoder_engine->dma2d_rx_channel);
+            }
+            consumed++;
+        }
+    }
+
+    decoder_engine->slice_mode = false;
+    free(decoder_engine->slice_link);
+    decoder_engine->slice_link = NULL;
+    xSemaphoreGive(decoder_engine->codec_base->codec_mutex);
+#if CONFIG_PM_ENABLE
+    if (decoder_engine->codec_base->pm_lock) {
+        ESP_RETURN_ON_ERROR(esp_pm_lock_release(decoder_engine->codec_base->pm_lock), TAG, "release pm_lock failed");
+    }
+#endif
+    return ESP_OK;
+
+err1:
+    dma2d_force_end(decoder_engine->trans_desc, &need_yield);
+err2:
+    decoder_engine->slice_mode = false;
+    if (decoder_engine->slice_link) {
+        free(decoder_engine->slice_link);
+        decoder_engine->slice_link = NULL;
+    }
+    xSemaphoreGive(decoder_engine->codec_base->codec_mutex);
+#if CONFIG_PM_ENABLE
+    if (decoder_engine->codec_base->pm_lock) {
+        esp_pm_lock_release(decoder_engine->codec_base->pm_lock);
+    }
+#endif
+    return ret;
+}
+
 esp_err_t jpeg_del_decoder_engine(jpeg_decoder_handle_t decoder_engine)
 {
     ESP_RETURN_ON_FALSE(decoder_engine, ESP_ERR_INVALID_ARG, TAG, "jpeg decode handle is null");
@@ -326,6 +479,9 @@ esp_err_t jpeg_del_decoder_engine(jpeg_decoder_handle_t decoder_engine)
         if (decoder_engine->header_info) {
             free(decoder_engine->header_info);
         }
+        if (decoder_engine->slice_link) {
+            free(decoder_engine->slice_link);
+        }
         if (decoder_engine->trans_desc) {
             free(decoder_engine->trans_desc);
         }
@@ -385,10 +541,8 @@ static void cfg_desc(jpeg_decoder_handle_t decoder_engine, dma2d_descriptor_t *d
     (void)ret;
 }
 
-static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_engine)
+static esp_err_t jpeg_dec_get_dma_hb(jpeg_decoder_handle_t decoder_engine, uint32_t *dma_hb)
 {
-    ESP_LOGD(TAG, "Config 2DDMA parameter start");
-
     jpeg_dec_format_hb_t best_hb_idx = 0;
     decoder_engine->bit_per_pixel = color_hal_pixel_format_fourcc_get_bit_depth(decoder_engine->output_format);
     if (decoder_engine->no_color_conversion == false) {
@@ -437,7 +591,16 @@ static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_en
         return ESP_ERR_NOT_SUPPORTED;
     }
 
-    uint32_t dma_hb = dec_hb_tbl[sample_method_idx][best_hb_idx];
+    *dma_hb = dec_hb_tbl[sample_method_idx][best_hb_idx];
+    return ESP_OK;
+}
+
+static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_engine)
+{
+    ESP_LOGD(TAG, "Config 2DDMA parameter start");
+
+    uint32_t dma_hb = 0;
+    ESP_RETURN_ON_ERROR(jpeg_dec_get_dma_hb(decoder_engine, &dma_hb), TAG, "get dma horizontal block size failed");
     uint32_t dma_vb = decoder_engine->header_info->mcuy;
 
     // Configure tx link descriptor
@@ -449,6 +612,35 @@ static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_en
     return ESP_OK;
 }
 
+static dma2d_descriptor_t *jpeg_dec_slice_desc(jpeg_decoder_handle_t decoder_engine, uint32_t idx)
+{
+    return (dma2d_descriptor_t *)((uint8_t *)decoder_engine->slice_link + idx * decoder_engine->dma_desc_size);
+}
+
+static void jpeg_dec_config_slice_descriptor(jpeg_decoder_handle_t decoder_engine, uint32_t idx, uint8_t owner, uint8_t *slice_buf[2], uint32_t slice_rows, uint32_t dma_hb)
+{
+    jpeg_dec_header_info_t *header_info = decoder_engine->header_info;
+    uint32_t start_row = idx * slice_rows;
+    uint32_t num_rows = (start_row + slice_rows > header_info->process_v) ? (header_info->process_v - start_row) : slice_rows;
+    bool last = (idx == decoder_engine->slice_link_count - 1);
+    dma2d_descriptor_t *next = last ? NULL : jpeg_dec_slice_desc(decoder_engine, idx + 1);
+
+    cfg_desc(decoder_engine, jpeg_dec_slice_desc(decoder_engine, idx), JPEG_DMA2D_2D_ENABLE, DMA2D_DESCRIPTOR_BLOCK_RW_MODE_MULTIPLE, header_info->mcuy, dma_hb, last ? JPEG_DMA2D_EOF_LAST : JPEG_DMA2D_EOF_NOT_LAST, dma2d_desc_pixel_format_to_pbyte_value(decoder_engine->output_format), owner, num_rows, header_info->process_h, slice_buf[idx % 2], next);
+}
+
+static bool jpeg_rx_desc_done(dma2d_channel_handle_t dma2d_chan, dma2d_event_data_t *event_data, void *user_data)
+{
+    portBASE_TYPE higher_priority_task_awoken = pdFALSE;
+    jpeg_dma2d_dec_evt_t dec_evt = {
+        .jpgd_status = 0,
+        .dma_evt = JPEG_DMA2D_RX_DONE,
+    };
+    jpeg_decoder_handle_t decoder_engine = (jpeg_decoder_handle_t) user_data;
+    xQueueSendFromISR(decoder_engine->evt_queue, &dec_evt, &higher_priority_task_awoken);
+
+    return higher_priority_task_awoken;
+}
+
 static bool jpeg_rx_eof(dma2d_channel_handle_t dma2d_chan, dma2d_event_data_t *event_data, void *user_data)
 {
     portBASE_TYPE higher_priority_task_awoken = pdFALSE;
@@ -586,14 +778,28 @@ static bool jpeg_dec_transaction_on_picked(uint32_t channel_num, const dma2d_tra
     jpeg_dec_config_dma_trans_ability(decoder_engine);
     jpeg_dec_config_dma_csc(decoder_engine, rx_chan);
 
-    dma2d_rx_event_callbacks_t jpeg_dec_cbs = {
-        .on_recv_eof = jpeg_rx_eof,
-    };
-
-    dma2d_register_rx_event_callbacks(rx_chan, &jpeg_dec_cbs, decoder_engine);
+    if (decoder_engine->slice_mode) {
+        // Halt the RX engine at CPU-owned slice descriptors until the consumer
+        // releases the matching bounce buffer (see jpeg_decoder_process_slices)
+        dma2d_strategy_config_t rx_strategy = {
+            .owner_check = true,
+        };
+        dma2d_apply_strategy(rx_chan, &rx_strategy);
+
+        dma2d_rx_event_callbacks_t jpeg_dec_slice_cbs = {
+            .on_desc_done = jpeg_rx_desc_done,
+        };
+        dma2d_register_rx_event_callbacks(rx_chan, &jpeg_dec_slice_cbs, decoder_engine);
+        dma2d_set_desc_addr(rx_chan, (intptr_t)decoder_engine->slice_link);
+    } else {
+        dma2d_rx_event_callbacks_t jpeg_dec_cbs = {
+            .on_recv_eof = jpeg_rx_eof,
+        };
+        dma2d_register_rx_event_callbacks(rx_chan, &jpeg_dec_cbs, decoder_engine);
+        dma2d_set_desc_addr(rx_chan, (intptr_t)decoder_engine->rxlink);
+    }
 
     dma2d_set_desc_addr(tx_chan, (intptr_t)decoder_engine->txlink);
-    dma2d_set_desc_addr(rx_chan, (intptr_t)decoder_engine->rxlink);
     dma2d_start(tx_chan);
     dma2d_start(rx_chan);
     jpeg_ll_process_start(hal->dev);
@@ -115,6 +115,10 @@ struct jpeg_decoder_t {
     dma2d_channel_handle_t dma2d_rx_channel;     // DMA2D RX channel handle
     dma2d_channel_handle_t dma2d_tx_channel;     // DMA2D TX channel handle
     dma2d_trans_t* trans_desc;   // DMA2D transaction descriptor
+    // streaming (slice) decode state
+    dma2d_descriptor_t *slice_link;              // Chain of rx slice descriptors, one per slice (stride is dma_desc_size)
+    uint32_t slice_link_count;                   // Number of descriptors in slice_link
+    bool slice_mode;                             // Current transaction emits MCU-row slices into bounce buffers
 };
 
 typedef enum {
@@ -168,6 +168,38 @@ esp_err_t ledc_timer_config(const ledc_timer_config_t *timer_conf);
  */
 esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel);
 
+/**
+ * @brief Per-channel duty entry of a grouped duty update, see `ledc_set_duty_and_update_multi()`
+ */
+typedef struct {
+    ledc_channel_t channel;     /*!< LEDC channel (0 - LEDC_CHANNEL_MAX-1) */
+    uint32_t duty;              /*!< New duty of the channel, range is [0, (2**duty_resolution)] */
+} ledc_channel_duty_t;
+
+/**
+ * @brief Set and update the duty of several LEDC channels in one call
+ *
+ * @note  All duties are staged and all update bits are set within one critical section, so the channels
+ *        bound to the same timer latch their new duties in the same PWM cycle (at the timer's next
+ *        counter overflow), without the stagger of per-channel ledc_set_duty + ledc_update_duty calls.
+ * @note  Unlike ledc_set_duty_and_update, this function does not synchronize with the fade service,
+ *        do not call it while a fade is still in progress on any of the listed channels.
+ * @note  This function is allowed to run within ISR context, e.g. a timer callback can stream
+ *        per-frame duty arrays through it to pace multi-channel fades.
+ * @note  If `CONFIG_LEDC_CTRL_FUNC_IN_IRAM` is enabled, this function will be placed in the IRAM by linker,
+ *        makes it possible to execute even when the Cache is disabled.
+ *
+ * @param speed_mode Select the LEDC channel group with specified speed mode. Note that not all targets support high speed mode.
+ * @param ch_duty_list Array of channel/duty pairs, all in the given speed mode
+ * @param list_num Number of entries in ch_duty_list
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *     - ESP_ERR_INVALID_STATE Channel group not initialized
+ */
+esp_err_t ledc_set_duty_and_update_multi(ledc_mode_t speed_mode, const ledc_channel_duty_t *ch_duty_list, size_t list_num);
+
 /**
  * @brief Set LEDC output gpio.
  *
@@ -1038,6 +1038,27 @@ esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
     return ESP_OK;
 }
 
+esp_err_t ledc_set_duty_and_update_multi(ledc_mode_t speed_mode, const ledc_channel_duty_t *ch_duty_list, size_t list_num)
+{
+    LEDC_ARG_CHECK_ISR(speed_mode < LEDC_SPEED_MODE_MAX, "speed_mode");
+    LEDC_ARG_CHECK_ISR(ch_duty_list != NULL && list_num > 0, "ch_duty_list");
+    LEDC_CHECK_ISR(p_ledc_obj[speed_mode] != NULL, LEDC_NOT_INIT, ESP_ERR_INVALID_STATE);
+    for (size_t i = 0; i < list_num; i++) {
+        LEDC_ARG_CHECK_ISR(ch_duty_list[i].channel < LEDC_CHANNEL_MAX, "channel");
+    }
+    portENTER_CRITICAL_SAFE(&ledc_spinlock);
+    // stage all duties first, then pulse the duty_start bits back to back, so every channel
+    // of the group latches its new duty at its bound timer's next counter overflow
+    for (size_t i = 0; i < list_num; i++) {
+        ledc_duty_config(speed_mode, ch_duty_list[i].channel, LEDC_VAL_NO_CHANGE, ch_duty_list[i].duty, 1, 1, 1, 0);
+    }
+    for (size_t i = 0; i < list_num; i++) {
+        _ledc_update_duty(speed_mode, ch_duty_list[i].channel);
+    }
+    portEXIT_CRITICAL_SAFE(&ledc_spinlock);
+    return ESP_OK;
+}
+
 esp_err_t ledc_stop(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t idle_level)
 {
     LEDC_ARG_CHECK_ISR(speed_mode < LEDC_SPEED_MODE_MAX, "speed_mode");
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "esp_err.h"
 #include "driver/mcpwm_types.h"
 
@@ -114,6 +115,32 @@ esp_err_t mcpwm_comparator_register_event_callbacks(mcpwm_cmpr_handle_t cmpr, co
  */
 esp_err_t mcpwm_comparator_set_compare_value(mcpwm_cmpr_handle_t cmpr, uint32_t cmp_ticks);
 
+/**
+ * @brief Set the compare values of multiple MCPWM comparators in one group commit
+ *
+ * Each new compare value is first staged in the comparator's shadow register while the shadow to active transfer
+ * is held off, then all staged values are latched into the active registers by a single forced update of the
+ * MCPWM group. Comparators spread across different operators therefore take effect at the very same moment,
+ * which e.g. lets a multi-axis motor drive update all duty cycles within the same carrier period.
+ *
+ * @note All comparators must be allocated by `mcpwm_new_comparator()` (event comparators are not supported)
+ *       and must belong to the same MCPWM group, with their operators connected to a timer.
+ * @note The forced update also flushes the other shadowed registers of the group (e.g. generator actions),
+ *       which re-latches whatever value they already hold.
+ * @note This function is allowed to run within ISR context, and is placed in IRAM if `CONFIG_MCPWM_CTRL_FUNC_IN_IRAM`
+ *       is enabled, so it can be called from a control loop ISR.
+ *
+ * @param[in] cmprs Array of MCPWM comparator handles
+ * @param[in] cmp_ticks Array of new compare values, one per comparator
+ * @param[in] num_cmprs Number of comparators (and compare values) in the arrays
+ * @return
+ *      - ESP_OK: Set MCPWM compare values successfully
+ *      - ESP_ERR_INVALID_ARG: Set MCPWM compare values failed because of invalid argument (e.g. a compare value is out of range, or the comparators belong to different groups)
+ *      - ESP_ERR_INVALID_STATE: Set MCPWM compare values failed because an operator doesn't have a timer connected
+ *      - ESP_FAIL: Set MCPWM compare values failed because of other error
+ */
+esp_err_t mcpwm_comparator_group_set_compare_values(mcpwm_cmpr_handle_t *cmprs, const uint32_t *cmp_ticks, size_t num_cmprs);
+
 #ifdef __cplusplus
 }
 #endif
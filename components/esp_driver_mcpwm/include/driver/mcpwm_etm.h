@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include "esp_err.h"
 #include "esp_etm.h"
+#include "soc/soc_caps.h"
 #include "driver/mcpwm_types.h"
 
 #ifdef __cplusplus
@@ -38,6 +39,33 @@ typedef struct {
  */
 esp_err_t mcpwm_comparator_new_etm_event(mcpwm_cmpr_handle_t cmpr, const mcpwm_cmpr_etm_event_config_t *config, esp_etm_event_handle_t *out_event);
 
+#if SOC_MCPWM_SUPPORT_ETM_TASK
+/**
+ * @brief MCPWM operator ETM task configuration
+ */
+typedef struct {
+    mcpwm_operator_etm_task_type_t task_type; /*!< MCPWM operator ETM task type */
+} mcpwm_operator_etm_task_config_t;
+
+/**
+ * @brief Get the ETM task for MCPWM operator
+ *
+ * @note The created ETM task object can be deleted later by calling `esp_etm_del_task`
+ * @note The `MCPWM_OPER_ETM_TASK_TZ_OST` task triggers the operator's one-shot trip directly in hardware,
+ *       the brake behavior of the generators on the one-shot trip still needs to be configured beforehand
+ *       by `mcpwm_generator_set_action_on_brake_event()`
+ *
+ * @param[in] oper MCPWM operator, allocated by `mcpwm_new_operator()`
+ * @param[in] config MCPWM ETM operator task configuration
+ * @param[out] out_task Returned ETM task handle
+ * @return
+ *      - ESP_OK: Get ETM task successfully
+ *      - ESP_ERR_INVALID_ARG: Get ETM task failed because of invalid argument
+ *      - ESP_FAIL: Get ETM task failed because of other error
+ */
+esp_err_t mcpwm_operator_new_etm_task(mcpwm_oper_handle_t oper, const mcpwm_operator_etm_task_config_t *config, esp_etm_task_handle_t *out_task);
+#endif // SOC_MCPWM_SUPPORT_ETM_TASK
+
 #ifdef __cplusplus
 }
 #endif
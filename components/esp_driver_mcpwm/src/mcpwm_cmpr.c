@@ -209,6 +209,48 @@ esp_err_t mcpwm_comparator_set_compare_value(mcpwm_cmpr_handle_t cmpr, uint32_t
     return ESP_OK;
 }
 
+esp_err_t mcpwm_comparator_group_set_compare_values(mcpwm_cmpr_handle_t *cmprs, const uint32_t *cmp_ticks, size_t num_cmprs)
+{
+    ESP_RETURN_ON_FALSE_ISR(cmprs && cmp_ticks && num_cmprs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mcpwm_group_t *group = NULL;
+    for (size_t i = 0; i < num_cmprs; i++) {
+        mcpwm_cmpr_t *cmpr = cmprs[i];
+        ESP_RETURN_ON_FALSE_ISR(cmpr, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+        ESP_RETURN_ON_FALSE_ISR(cmpr->type == MCPWM_OPERATOR_COMPARATOR, ESP_ERR_INVALID_ARG, TAG, "only operator comparators support group commit");
+        mcpwm_oper_t *oper = cmpr->oper;
+        if (!group) {
+            group = oper->group;
+        }
+        ESP_RETURN_ON_FALSE_ISR(oper->group == group, ESP_ERR_INVALID_ARG, TAG, "comparators are not in the same group");
+        mcpwm_timer_t *timer = oper->timer;
+        ESP_RETURN_ON_FALSE_ISR(timer, ESP_ERR_INVALID_STATE, TAG, "timer and operator are not connected");
+        ESP_RETURN_ON_FALSE_ISR(cmp_ticks[i] <= timer->peak_ticks, ESP_ERR_INVALID_ARG, TAG, "compare value out of range");
+    }
+
+    mcpwm_hal_context_t *hal = &group->hal;
+    portENTER_CRITICAL_SAFE(&group->spinlock);
+    // hold off the shadow->active transfer of every involved comparator, so that a timer event
+    // occurring while the values are being staged can't latch a partial set
+    for (size_t i = 0; i < num_cmprs; i++) {
+        mcpwm_ll_operator_stop_update_compare(hal->dev, cmprs[i]->oper->oper_id, cmprs[i]->cmpr_id, true);
+    }
+    for (size_t i = 0; i < num_cmprs; i++) {
+        mcpwm_ll_operator_set_compare_value(hal->dev, cmprs[i]->oper->oper_id, cmprs[i]->cmpr_id, cmp_ticks[i]);
+    }
+    // one forced update latches all staged values into the active registers at the same moment
+    mcpwm_ll_group_flush_shadow(hal->dev);
+    // resume the comparators' configured update events
+    for (size_t i = 0; i < num_cmprs; i++) {
+        mcpwm_ll_operator_stop_update_compare(hal->dev, cmprs[i]->oper->oper_id, cmprs[i]->cmpr_id, false);
+    }
+    portEXIT_CRITICAL_SAFE(&group->spinlock);
+
+    for (size_t i = 0; i < num_cmprs; i++) {
+        cmprs[i]->compare_ticks = cmp_ticks[i];
+    }
+    return ESP_OK;
+}
+
 esp_err_t mcpwm_comparator_register_event_callbacks(mcpwm_cmpr_handle_t cmpr, const mcpwm_comparator_event_callbacks_t *cbs, void *user_data)
 {
     ESP_RETURN_ON_FALSE(cmpr && cbs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
@@ -89,3 +89,54 @@ err:
     }
     return ret;
 }
+
+#if SOC_MCPWM_SUPPORT_ETM_TASK
+typedef struct {
+    esp_etm_task_t base;
+    mcpwm_oper_handle_t oper;
+    mcpwm_operator_etm_task_type_t task_type;
+} mcpwm_operator_etm_task_t;
+
+static esp_err_t mcpwm_del_etm_task(esp_etm_task_t *task)
+{
+    mcpwm_operator_etm_task_t *etm_task = __containerof(task, mcpwm_operator_etm_task_t, base);
+    mcpwm_oper_t *oper = etm_task->oper;
+    mcpwm_group_t *group = oper->group;
+    mcpwm_hal_context_t *hal = &group->hal;
+
+    portENTER_CRITICAL(&group->spinlock);
+    mcpwm_ll_etm_enable_operator_task(hal->dev, oper->oper_id, etm_task->task_type, false);
+    portEXIT_CRITICAL(&group->spinlock);
+    free(etm_task);
+    return ESP_OK;
+}
+
+esp_err_t mcpwm_operator_new_etm_task(mcpwm_oper_handle_t oper, const mcpwm_operator_etm_task_config_t *config, esp_etm_task_handle_t *out_task)
+{
+    ESP_RETURN_ON_FALSE(oper && config && out_task, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->task_type < MCPWM_OPER_ETM_TASK_MAX, ESP_ERR_INVALID_ARG, TAG, "invalid task type");
+    mcpwm_operator_etm_task_t *task = heap_caps_calloc(1, sizeof(mcpwm_operator_etm_task_t), MCPWM_MEM_ALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(task, ESP_ERR_NO_MEM, TAG, "no memory for ETM task");
+
+    mcpwm_group_t *group = oper->group;
+    mcpwm_hal_context_t *hal = &group->hal;
+    int group_id = group->group_id;
+    int oper_id = oper->oper_id;
+
+    portENTER_CRITICAL(&group->spinlock);
+    mcpwm_ll_etm_enable_operator_task(hal->dev, oper_id, config->task_type, true);
+    portEXIT_CRITICAL(&group->spinlock);
+    uint32_t task_id = MCPWM_LL_ETM_OPERATOR_TASK_TABLE(group_id, oper_id, config->task_type);
+    ESP_LOGD(TAG, "MCPWM (%d) oper (%d) task_id (%"PRId32")", group_id, oper_id, task_id);
+
+    // fill the ETM task object
+    task->oper = oper;
+    task->task_type = config->task_type;
+    task->base.task_id = task_id;
+    task->base.trig_periph = ETM_TRIG_PERIPH_MCPWM;
+    task->base.del = mcpwm_del_etm_task;
+
+    *out_task = &task->base;
+    return ESP_OK;
+}
+#endif // SOC_MCPWM_SUPPORT_ETM_TASK
@@ -112,3 +112,74 @@ TEST_CASE("mcpwm_comparator_event_callback", "[mcpwm]")
     TEST_ESP_OK(mcpwm_del_operator(oper));
     TEST_ESP_OK(mcpwm_del_timer(timer));
 }
+
+TEST_CASE("mcpwm_comparator_group_commit", "[mcpwm]")
+{
+    mcpwm_timer_handle_t timer;
+    mcpwm_oper_handle_t opers[2];
+    mcpwm_cmpr_handle_t comparators[2];
+
+    mcpwm_timer_config_t timer_config = {
+        .group_id = 0,
+        .clk_src = MCPWM_TIMER_CLK_SRC_DEFAULT,
+        .resolution_hz = 1 * 1000 * 1000,
+        .period_ticks = 10 * 1000, // 10ms
+        .count_mode = MCPWM_TIMER_COUNT_MODE_UP,
+    };
+    mcpwm_operator_config_t operator_config = {
+        .group_id = 0,
+    };
+    mcpwm_comparator_config_t comparator_config = {};
+    printf("install timer, operators and comparators\r\n");
+    TEST_ESP_OK(mcpwm_new_timer(&timer_config, &timer));
+    for (int i = 0; i < 2; i++) {
+        TEST_ESP_OK(mcpwm_new_operator(&operator_config, &opers[i]));
+        TEST_ESP_OK(mcpwm_new_comparator(opers[i], &comparator_config, &comparators[i]));
+    }
+
+    uint32_t cmp_ticks[2] = {3 * 1000, 5 * 1000};
+    // group commit requires every operator to have a timer connected
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, mcpwm_comparator_group_set_compare_values(comparators, cmp_ticks, 2));
+    printf("connect MCPWM timer and operators\r\n");
+    for (int i = 0; i < 2; i++) {
+        TEST_ESP_OK(mcpwm_operator_connect_timer(opers[i], timer));
+    }
+    // compare ticks can't exceed the timer's period ticks
+    cmp_ticks[1] = 20 * 1000;
+    TEST_ESP_ERR(ESP_ERR_INVALID_ARG, mcpwm_comparator_group_set_compare_values(comparators, cmp_ticks, 2));
+    cmp_ticks[1] = 5 * 1000;
+    TEST_ESP_OK(mcpwm_comparator_group_set_compare_values(comparators, cmp_ticks, 2));
+
+    printf("register compare event callbacks\r\n");
+    uint32_t compare_counts[2] = {0, 0};
+    mcpwm_comparator_event_callbacks_t cbs = {
+        .on_reach = test_compare_on_reach,
+    };
+    for (int i = 0; i < 2; i++) {
+        TEST_ESP_OK(mcpwm_comparator_register_event_callbacks(comparators[i], &cbs, &compare_counts[i]));
+    }
+
+    printf("start timer\r\n");
+    TEST_ESP_OK(mcpwm_timer_enable(timer));
+    TEST_ESP_OK(mcpwm_timer_start_stop(timer, MCPWM_TIMER_START_NO_STOP));
+
+    // commit new values while the timer is running, both committed values must stay effective
+    cmp_ticks[0] = 4 * 1000;
+    cmp_ticks[1] = 6 * 1000;
+    TEST_ESP_OK(mcpwm_comparator_group_set_compare_values(comparators, cmp_ticks, 2));
+
+    esp_rom_delay_us(1000 * 1000);
+    TEST_ESP_OK(mcpwm_timer_start_stop(timer, MCPWM_TIMER_STOP_EMPTY));
+    printf("compare_counts=%"PRIu32",%"PRIu32"\r\n", compare_counts[0], compare_counts[1]);
+    // the timer period is 10ms, the expected compare_counts = 1s/10ms = 100 for each comparator
+    TEST_ASSERT_INT_WITHIN(1, 100, compare_counts[0]);
+    TEST_ASSERT_INT_WITHIN(1, 100, compare_counts[1]);
+
+    printf("uninstall timer, operators and comparators\r\n");
+    TEST_ESP_OK(mcpwm_timer_disable(timer));
+    for (int i = 0; i < 2; i++) {
+        TEST_ESP_OK(mcpwm_del_comparator(comparators[i]));
+        TEST_ESP_OK(mcpwm_del_operator(opers[i]));
+    }
+    TEST_ESP_OK(mcpwm_del_timer(timer));
+}
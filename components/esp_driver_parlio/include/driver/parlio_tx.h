@@ -165,6 +165,32 @@ typedef struct {
  */
 esp_err_t parlio_tx_unit_transmit(parlio_tx_unit_handle_t tx_unit, const void *payload, size_t payload_bits, const parlio_transmit_config_t *config);
 
+/**
+ * @brief Swap in a freshly patched buffer for an on going loop transmission
+ *
+ * The loop transmission keeps the DMA circulating without any interrupt in steady state. This function
+ * mounts the given buffer on the spare DMA link list and chains it after the active one, so the hardware
+ * glides into the new waveform at the loop boundary, without any gap on the bus. The buffer that leaves
+ * the loop (the one passed to the previous call, or to `parlio_tx_unit_transmit`) can be patched again
+ * once the next call to this function returns `ESP_OK`, or once the `on_buffer_switched` callback fires.
+ *
+ * @note The driver takes care of the cache maintenance of the new buffer, the application only needs to
+ *       keep the buffer untouched after this function returns.
+ * @note If the DMA has not yet taken over the previously swapped buffer, this function rejects the swap
+ *       with `ESP_ERR_INVALID_STATE`. The application can simply retry, no interrupt is involved.
+ *
+ * @param[in] tx_unit Parallel IO TX unit that created by `parlio_new_tx_unit`
+ * @param[in] payload Pointer to the new data to be transmitted repeatedly
+ * @param[in] payload_bits Length of the new data, in bits
+ * @return
+ *      - ESP_OK: Swap the loop buffer successfully
+ *      - ESP_ERR_INVALID_ARG: Swap the loop buffer failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Swap the loop buffer failed because no loop transmission is on going,
+ *                               or the previous swapped buffer is still in flight
+ *      - ESP_FAIL: Swap the loop buffer failed because of other error
+ */
+esp_err_t parlio_tx_unit_swap_loop_buffer(parlio_tx_unit_handle_t tx_unit, const void *payload, size_t payload_bits);
+
 /**
  * @brief Wait for all pending TX transactions done
  *
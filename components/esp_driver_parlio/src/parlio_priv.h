@@ -187,6 +187,7 @@ typedef struct parlio_tx_unit_t {
     uint32_t idle_value_mask;          // mask of idle value
     _Atomic parlio_tx_fsm_t fsm;       // Driver FSM state
     _Atomic bool buffer_need_switch;   // whether the buffer need to be switched
+    bool loop_swap_pending;            // whether a swapped loop buffer is still waiting to be fetched by the DMA
     parlio_tx_done_callback_t on_trans_done; // callback function when the transmission is done
     parlio_tx_buffer_switched_callback_t on_buffer_switched; // callback function when the buffer is switched in loop transmission
     void *user_data;                   // user data passed to the callback function
@@ -146,7 +146,10 @@ static esp_err_t parlio_tx_unit_init_dma(parlio_tx_unit_t *tx_unit, const parlio
     ESP_RETURN_ON_ERROR(PARLIO_GDMA_NEW_CHANNEL(&dma_chan_config, &tx_unit->dma_chan), TAG, "allocate TX DMA channel failed");
     gdma_connect(tx_unit->dma_chan, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_PARLIO, 0));
     gdma_strategy_config_t gdma_strategy_conf = {
-        .auto_update_desc = false, // for loop transmission, we have no chance to change the owner
+        // let the DMA write back the descriptor owner field, so the driver can tell, without any interrupt,
+        // whether a freshly swapped loop buffer has been fetched by the DMA (see `parlio_tx_unit_swap_loop_buffer`).
+        // The ownership is not checked by the hardware (owner_check is false), so the write back is side-effect free
+        .auto_update_desc = true,
         .owner_check = false,
         .eof_till_data_popped = true,
     };
@@ -729,6 +732,49 @@ esp_err_t parlio_tx_unit_transmit(parlio_tx_unit_handle_t tx_unit, const void *p
 }
 
 #if SOC_PARLIO_TX_SUPPORT_LOOP_TRANSMISSION
+esp_err_t parlio_tx_unit_swap_loop_buffer(parlio_tx_unit_handle_t tx_unit, const void *payload, size_t payload_bits)
+{
+    ESP_RETURN_ON_FALSE(tx_unit && payload && payload_bits, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE((payload_bits % tx_unit->data_width) == 0, ESP_ERR_INVALID_ARG, TAG, "payload bit length must align to bus width");
+    ESP_RETURN_ON_FALSE(payload_bits <= tx_unit->max_transfer_bits, ESP_ERR_INVALID_ARG, TAG, "payload bit length too large");
+#if !PARLIO_LL_SUPPORT(TRANS_BIT_ALIGN)
+    ESP_RETURN_ON_FALSE((payload_bits % 8) == 0, ESP_ERR_INVALID_ARG, TAG, "payload bit length must be multiple of 8");
+#endif // !PARLIO_LL_SUPPORT(TRANS_BIT_ALIGN)
+
+    size_t alignment = esp_ptr_external_ram(payload) ? tx_unit->ext_mem_align : tx_unit->int_mem_align;
+    ESP_RETURN_ON_FALSE(((uint32_t)payload & (alignment - 1)) == 0, ESP_ERR_INVALID_ARG, TAG, "payload address not aligned");
+    ESP_RETURN_ON_FALSE((payload_bits & (alignment - 1)) == 0, ESP_ERR_INVALID_ARG, TAG, "payload size not aligned");
+
+    parlio_tx_trans_desc_t *t = tx_unit->cur_trans;
+    ESP_RETURN_ON_FALSE(t && t->flags.loop_transmission, ESP_ERR_INVALID_STATE, TAG, "no loop transmission on going");
+
+    // The previous swap must have been fetched by the DMA already, otherwise we would remount
+    // the link list node that the hardware is still draining and glitch the output.
+    // The DMA clears the descriptor owner field when it fetches the node (auto_update_desc is enabled)
+    if (tx_unit->loop_swap_pending) {
+        gdma_lli_owner_t owner = GDMA_LLI_OWNER_DMA;
+        gdma_link_get_owner(tx_unit->dma_link[t->dma_link_idx], 0, &owner);
+        ESP_RETURN_ON_FALSE(owner == GDMA_LLI_OWNER_CPU, ESP_ERR_INVALID_STATE, TAG, "previous loop buffer not taken over by DMA yet");
+        tx_unit->loop_swap_pending = false;
+    }
+
+    if (esp_cache_get_line_size_by_addr(payload) > 0) {
+        // Write back to cache to synchronize the cache before the DMA fetches the new buffer
+        ESP_RETURN_ON_ERROR(esp_cache_msync((void *)payload, (payload_bits + 7) / 8,
+                                            ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED), TAG, "cache sync failed");
+    }
+
+    t->payload = payload;
+    t->payload_bits = payload_bits;
+    // mount the new buffer on the spare link list and concatenate it after the active one,
+    // the mount also hands the fresh node back to the DMA (owner field set to GDMA_LLI_OWNER_DMA)
+    parlio_mount_buffer(tx_unit, t);
+    tx_unit->loop_swap_pending = true;
+    // keep the optional `on_buffer_switched` notification working for applications that prefer the callback
+    atomic_store(&tx_unit->buffer_need_switch, true);
+    return ESP_OK;
+}
+
 static bool parlio_tx_gdma_eof_callback(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data)
 {
     parlio_tx_unit_t *tx_unit = (parlio_tx_unit_t *) user_data;
@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "esp_etm.h"
+#include "driver/pulse_cnt.h"
+#include "hal/pcnt_types.h"
+#include "soc/soc_caps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SOC_PCNT_SUPPORT_ETM
+
+/**
+ * @brief PCNT ETM event configuration
+ */
+typedef struct {
+    pcnt_etm_event_type_t event_type; /*!< PCNT ETM event type */
+} pcnt_etm_event_config_t;
+
+/**
+ * @brief Get the ETM event for PCNT
+ *
+ * @note The created ETM event object can be deleted later by calling `esp_etm_del_event`
+ * @note The event matrix only exposes one set of PCNT event sources, which reflect the
+ *       first unit of the peripheral, so only unit 0 can generate ETM events.
+ *
+ * @param[in] unit PCNT unit handle, allocated by `pcnt_new_unit`
+ * @param[in] config PCNT ETM event configuration
+ * @param[out] out_event Returned ETM event handle
+ * @return
+ *      - ESP_OK: Get ETM event successfully
+ *      - ESP_ERR_INVALID_ARG: Get ETM event failed because of invalid argument
+ *      - ESP_ERR_NOT_SUPPORTED: Get ETM event failed because the unit can't generate ETM events
+ *      - ESP_FAIL: Get ETM event failed because of other error
+ */
+esp_err_t pcnt_unit_new_etm_event(pcnt_unit_handle_t unit, const pcnt_etm_event_config_t *config, esp_etm_event_handle_t *out_event);
+
+#endif // SOC_PCNT_SUPPORT_ETM
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/pulse_cnt.h"
+#include "driver/gptimer.h"
+#include "hal/pcnt_types.h"
+#include "soc/soc_caps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SOC_PCNT_SUPPORT_ETM && SOC_TIMER_SUPPORT_ETM
+
+/**
+ * @brief Type of PCNT velocity meter handle
+ */
+typedef struct pcnt_velocity_meter_t *pcnt_velocity_meter_handle_t;
+
+/**
+ * @brief PCNT velocity meter configuration
+ */
+typedef struct {
+    gptimer_handle_t gptimer;           /*!< Timer used as the timebase, must be created, enabled and
+                                             started by the caller before any sample is expected */
+    pcnt_etm_event_type_t sample_event; /*!< PCNT event whose occurrence latches the timer count */
+    size_t sample_ring_depth;           /*!< Capacity of the sample ring, new samples overwrite the oldest ones when it is full */
+} pcnt_velocity_meter_config_t;
+
+/**
+ * @brief One hardware-timestamped count snapshot
+ */
+typedef struct {
+    uint64_t timestamp;    /*!< Timer count value captured by hardware when the watch event fired, in timer ticks */
+    int watch_point_value; /*!< Watch point value that triggered the sample */
+} pcnt_velocity_sample_t;
+
+/**
+ * @brief Create a velocity meter on top of a PCNT unit
+ *
+ * The meter connects the configured PCNT watch event to the capture task of the given
+ * GPTimer through an ETM channel, so the timer count is latched by hardware at the very
+ * moment the counter reaches the watch point, free of interrupt jitter. The watch event
+ * interrupt then only moves the captured value into the sample ring; the velocity is
+ * computed by the consumer from the count and timestamp deltas of adjacent samples.
+ *
+ * @note The watch points have to be added by the caller via `pcnt_unit_add_watch_point`.
+ * @note The meter occupies the `on_reach` callback of the unit, the unit must be in the
+ *       init state and must not have its own watch callback registered.
+ *
+ * @param[in] unit PCNT unit handle, allocated by `pcnt_new_unit`
+ * @param[in] config Velocity meter configuration
+ * @param[out] ret_meter Returned velocity meter handle
+ * @return
+ *      - ESP_OK: Create velocity meter successfully
+ *      - ESP_ERR_INVALID_ARG: Create velocity meter failed because of invalid argument
+ *      - ESP_ERR_NO_MEM: Create velocity meter failed because out of memory
+ *      - ESP_ERR_NOT_SUPPORTED: Create velocity meter failed because the unit can't generate ETM events
+ *      - ESP_FAIL: Create velocity meter failed because of other error
+ */
+esp_err_t pcnt_new_velocity_meter(pcnt_unit_handle_t unit, const pcnt_velocity_meter_config_t *config, pcnt_velocity_meter_handle_t *ret_meter);
+
+/**
+ * @brief Fetch accumulated samples from the velocity meter, oldest first
+ *
+ * @param[in] meter Velocity meter handle, allocated by `pcnt_new_velocity_meter`
+ * @param[out] samples Array to copy the samples into
+ * @param[in,out] num In: capacity of the array, out: number of samples copied
+ * @return
+ *      - ESP_OK: Fetch samples successfully
+ *      - ESP_ERR_INVALID_ARG: Fetch samples failed because of invalid argument
+ */
+esp_err_t pcnt_velocity_meter_get_samples(pcnt_velocity_meter_handle_t meter, pcnt_velocity_sample_t *samples, size_t *num);
+
+/**
+ * @brief Delete the velocity meter and release the underlying ETM resources
+ *
+ * The PCNT unit and the GPTimer stay allocated, they belong to the caller.
+ *
+ * @param[in] meter Velocity meter handle, allocated by `pcnt_new_velocity_meter`
+ * @return
+ *      - ESP_OK: Delete velocity meter successfully
+ *      - ESP_ERR_INVALID_ARG: Delete velocity meter failed because of invalid argument
+ */
+esp_err_t pcnt_del_velocity_meter(pcnt_velocity_meter_handle_t meter);
+
+#endif // SOC_PCNT_SUPPORT_ETM && SOC_TIMER_SUPPORT_ETM
+
+#ifdef __cplusplus
+}
+#endif
@@ -27,6 +27,10 @@
 #include "hal/pcnt_ll.h"
 #include "driver/gpio.h"
 #include "driver/pulse_cnt.h"
+#if SOC_PCNT_SUPPORT_ETM
+#include "driver/pulse_cnt_etm.h"
+#include "esp_private/etm_interface.h"
+#endif
 #include "esp_private/esp_clk.h"
 #include "esp_private/periph_ctrl.h"
 #include "esp_private/sleep_retention.h"
@@ -1133,6 +1137,32 @@ IRAM_ATTR static void pcnt_default_isr(void *args)
     }
 }
 
+#if SOC_PCNT_SUPPORT_ETM
+static esp_err_t pcnt_del_etm_event(esp_etm_event_t *event)
+{
+    free(event);
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_new_etm_event(pcnt_unit_handle_t unit, const pcnt_etm_event_config_t *config, esp_etm_event_handle_t *out_event)
+{
+    esp_etm_event_t *event = NULL;
+    ESP_RETURN_ON_FALSE(unit && config && out_event, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->event_type < PCNT_ETM_EVENT_MAX, ESP_ERR_INVALID_ARG, TAG, "invalid event type");
+    // the event matrix only exposes one set of PCNT event sources, which reflect the first unit
+    ESP_RETURN_ON_FALSE(unit->group->group_id == 0 && unit->unit_id == 0, ESP_ERR_NOT_SUPPORTED, TAG, "only unit 0 can generate ETM events");
+    event = heap_caps_calloc(1, sizeof(esp_etm_event_t), PCNT_MEM_ALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(event, ESP_ERR_NO_MEM, TAG, "no memory for ETM event");
+
+    // fill the ETM event object
+    event->event_id = PCNT_LL_ETM_EVENT_TABLE(config->event_type);
+    event->trig_periph = ETM_TRIG_PERIPH_PCNT;
+    event->del = pcnt_del_etm_event;
+    *out_event = event;
+    return ESP_OK;
+}
+#endif // SOC_PCNT_SUPPORT_ETM
+
 #if CONFIG_PCNT_ENABLE_DEBUG_LOG
 __attribute__((constructor))
 static void pcnt_override_default_log_level(void)
@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_check.h"
+#include "esp_etm.h"
+#include "driver/pulse_cnt.h"
+#include "driver/pulse_cnt_etm.h"
+#include "driver/pulse_cnt_velocity.h"
+#include "driver/gptimer.h"
+#include "driver/gptimer_etm.h"
+
+static const char *TAG = "pcnt-velocity";
+
+typedef struct pcnt_velocity_meter_t {
+    pcnt_unit_handle_t unit;             // PCNT unit the meter is attached to
+    gptimer_handle_t gptimer;            // timer whose count is captured on the watch event
+    esp_etm_channel_handle_t etm_channel; // channel routing the watch event to the capture task
+    esp_etm_event_handle_t etm_event;    // PCNT watch event
+    esp_etm_task_handle_t etm_task;      // GPTimer capture task
+    portMUX_TYPE spinlock;               // protects the sample ring against the watch ISR
+    pcnt_velocity_sample_t *samples;     // sample ring storage
+    size_t depth;                        // capacity of the sample ring
+    size_t write_idx;                    // ring position the next sample is written to
+    size_t count;                        // number of valid samples in the ring
+} pcnt_velocity_meter_t;
+
+static bool pcnt_velocity_on_reach(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *user_ctx)
+{
+    pcnt_velocity_meter_t *meter = user_ctx;
+    // the count value was latched by hardware when the watch point fired, reading it here is not time critical
+    uint64_t captured = 0;
+    gptimer_get_captured_count(meter->gptimer, &captured);
+    portENTER_CRITICAL_ISR(&meter->spinlock);
+    meter->samples[meter->write_idx] = (pcnt_velocity_sample_t) {
+        .timestamp = captured,
+        .watch_point_value = edata->watch_point_value,
+    };
+    meter->write_idx = (meter->write_idx + 1) % meter->depth;
+    if (meter->count < meter->depth) {
+        meter->count++;
+    }
+    portEXIT_CRITICAL_ISR(&meter->spinlock);
+    return false;
+}
+
+esp_err_t pcnt_new_velocity_meter(pcnt_unit_handle_t unit, const pcnt_velocity_meter_config_t *config, pcnt_velocity_meter_handle_t *ret_meter)
+{
+    esp_err_t ret = ESP_OK;
+    pcnt_velocity_meter_t *meter = NULL;
+    ESP_RETURN_ON_FALSE(unit && config && ret_meter, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->gptimer && config->sample_ring_depth, ESP_ERR_INVALID_ARG, TAG, "invalid timer or ring depth");
+
+    meter = heap_caps_calloc(1, sizeof(pcnt_velocity_meter_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(meter, ESP_ERR_NO_MEM, TAG, "no memory for velocity meter");
+    meter->samples = heap_caps_calloc(config->sample_ring_depth, sizeof(pcnt_velocity_sample_t), MALLOC_CAP_DEFAULT);
+    ESP_GOTO_ON_FALSE(meter->samples, ESP_ERR_NO_MEM, err, TAG, "no memory for sample ring");
+    meter->unit = unit;
+    meter->gptimer = config->gptimer;
+    meter->depth = config->sample_ring_depth;
+    meter->spinlock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+
+    pcnt_etm_event_config_t event_config = {
+        .event_type = config->sample_event,
+    };
+    ESP_GOTO_ON_ERROR(pcnt_unit_new_etm_event(unit, &event_config, &meter->etm_event), err, TAG, "create PCNT ETM event failed");
+    gptimer_etm_task_config_t task_config = {
+        .task_type = GPTIMER_ETM_TASK_CAPTURE,
+    };
+    ESP_GOTO_ON_ERROR(gptimer_new_etm_task(config->gptimer, &task_config, &meter->etm_task), err, TAG, "create GPTimer capture task failed");
+    esp_etm_channel_config_t channel_config = {};
+    ESP_GOTO_ON_ERROR(esp_etm_new_channel(&channel_config, &meter->etm_channel), err, TAG, "allocate ETM channel failed");
+    ESP_GOTO_ON_ERROR(esp_etm_channel_connect(meter->etm_channel, meter->etm_event, meter->etm_task), err, TAG, "connect ETM channel failed");
+    ESP_GOTO_ON_ERROR(esp_etm_channel_enable(meter->etm_channel), err, TAG, "enable ETM channel failed");
+
+    pcnt_event_callbacks_t cbs = {
+        .on_reach = pcnt_velocity_on_reach,
+    };
+    ESP_GOTO_ON_ERROR(pcnt_unit_register_event_callbacks(unit, &cbs, meter), err, TAG, "register watch callback failed");
+
+    *ret_meter = meter;
+    return ESP_OK;
+
+err:
+    pcnt_del_velocity_meter(meter);
+    return ret;
+}
+
+esp_err_t pcnt_velocity_meter_get_samples(pcnt_velocity_meter_handle_t meter, pcnt_velocity_sample_t *samples, size_t *num)
+{
+    ESP_RETURN_ON_FALSE(meter && samples && num, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    portENTER_CRITICAL(&meter->spinlock);
+    size_t to_copy = *num < meter->count ? *num : meter->count;
+    size_t read_idx = (meter->write_idx + meter->depth - meter->count) % meter->depth;
+    for (size_t i = 0; i < to_copy; i++) {
+        samples[i] = meter->samples[read_idx];
+        read_idx = (read_idx + 1) % meter->depth;
+    }
+    meter->count -= to_copy;
+    portEXIT_CRITICAL(&meter->spinlock);
+    *num = to_copy;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_del_velocity_meter(pcnt_velocity_meter_handle_t meter)
+{
+    ESP_RETURN_ON_FALSE(meter, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    if (meter->etm_channel) {
+        esp_etm_channel_disable(meter->etm_channel);
+        esp_etm_del_channel(meter->etm_channel);
+    }
+    if (meter->etm_event) {
+        esp_etm_del_event(meter->etm_event);
+    }
+    if (meter->etm_task) {
+        esp_etm_del_task(meter->etm_task);
+    }
+    if (meter->unit) {
+        // detach the watch callback so the unit can be reused by the caller
+        pcnt_event_callbacks_t cbs = {
+            .on_reach = NULL,
+        };
+        pcnt_unit_register_event_callbacks(meter->unit, &cbs, NULL);
+    }
+    free(meter->samples);
+    free(meter);
+    return ESP_OK;
+}
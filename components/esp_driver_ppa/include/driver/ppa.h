@@ -309,6 +309,117 @@ esp_err_t ppa_do_fill(ppa_client_handle_t ppa_client, const ppa_fill_oper_config
  */
 esp_err_t ppa_set_rgb2gray_formula(uint8_t r_weight, uint8_t g_weight, uint8_t b_weight);
 
+/**
+ * @brief Maximum number of operations in one PPA sequence
+ */
+#define PPA_SEQ_OPER_NUM_MAX    8
+
+/**
+ * @brief Type of PPA sequence executor handle
+ */
+typedef struct ppa_seq_t *ppa_seq_handle_t;
+typedef struct ppa_seq_t ppa_seq_t;
+
+/**
+ * @brief One operation step in a PPA sequence
+ */
+typedef struct {
+    ppa_operation_t oper_type;                     /*!< Which PPA operation this step performs */
+    union {
+        ppa_srm_oper_config_t srm_config;          /*!< Configuration of a SRM step */
+        ppa_blend_oper_config_t blend_config;      /*!< Configuration of a blend step */
+        ppa_fill_oper_config_t fill_config;        /*!< Configuration of a fill step */
+    };
+} ppa_seq_oper_item_t;
+
+/**
+ * @brief Type of PPA sequence done callback
+ *
+ * Invoked from the sequence executor task after the last step of a sequence has finished.
+ *
+ * @param[in] seq PPA sequence executor handle
+ * @param[in] result ESP_OK when all steps succeeded, otherwise the error of the step that aborted the sequence
+ * @param[in] user_data User data passed to `ppa_seq_submit`
+ */
+typedef void (*ppa_seq_done_callback_t)(ppa_seq_handle_t seq, esp_err_t result, void *user_data);
+
+/**
+ * @brief A collection of configuration items for creating a PPA sequence executor
+ */
+typedef struct {
+    uint32_t max_pending_seq_num;                  /*!< The maximum number of submitted but unfinished sequences. By default, it will be 1 */
+    uint32_t task_priority;                        /*!< Priority of the sequence executor task. By default, it will be 5 */
+    uint32_t task_stack_size;                      /*!< Stack size of the sequence executor task. By default, it will be 3072 */
+    ppa_data_burst_length_t data_burst_length;     /*!< The desired data burst length for all the steps of the sequences, see `ppa_client_config_t` */
+    ppa_seq_done_callback_t on_seq_done;           /*!< Optional, invoked after each completed sequence */
+} ppa_seq_config_t;
+
+/**
+ * @brief Create a PPA sequence executor
+ *
+ * A sequence executor owns one client per PPA operation type and an internal task that runs
+ * submitted sequences step by step, so a multi-operation composition (e.g. scale then blend)
+ * costs one submission instead of one blocking call per operation.
+ *
+ * @param[in] config Pointer to a collection of configurations for the sequence executor
+ * @param[out] ret_seq Returned sequence executor handle
+ *
+ * @return
+ *      - ESP_OK: Create the PPA sequence executor successfully
+ *      - ESP_ERR_INVALID_ARG: Create the PPA sequence executor failed because of invalid argument
+ *      - ESP_ERR_NO_MEM: Create the PPA sequence executor failed because out of memory
+ */
+esp_err_t ppa_seq_new(const ppa_seq_config_t *config, ppa_seq_handle_t *ret_seq);
+
+/**
+ * @brief Delete a PPA sequence executor
+ *
+ * @param[in] seq PPA sequence executor handle, allocated by `ppa_seq_new`
+ *
+ * @return
+ *      - ESP_OK: Delete the PPA sequence executor successfully
+ *      - ESP_ERR_INVALID_ARG: Delete the PPA sequence executor failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Delete the PPA sequence executor failed because there are unfinished sequences
+ */
+esp_err_t ppa_seq_del(ppa_seq_handle_t seq);
+
+/**
+ * @brief Submit a sequence of PPA operations
+ *
+ * The steps are executed in order, each one starting after the previous one completed, so a later
+ * step can consume the output buffer of an earlier one. The operation configs are copied, they do
+ * not need to stay valid after this call; the pixel buffers they point to must stay valid until
+ * the sequence completes. The `mode` field of the step configs is ignored.
+ *
+ * @param[in] seq PPA sequence executor handle
+ * @param[in] opers Array of operation steps
+ * @param[in] oper_num Number of steps, at most `PPA_SEQ_OPER_NUM_MAX`
+ * @param[in] user_data User data passed to the `on_seq_done` callback
+ *
+ * @return
+ *      - ESP_OK: Submit the sequence successfully
+ *      - ESP_ERR_INVALID_ARG: Submit the sequence failed because of invalid argument
+ *      - ESP_FAIL: Submit the sequence failed because the pending sequences reached the maximum capacity
+ */
+esp_err_t ppa_seq_submit(ppa_seq_handle_t seq, const ppa_seq_oper_item_t *opers, uint32_t oper_num, void *user_data);
+
+/**
+ * @brief Wait until one submitted sequence has completed
+ *
+ * Acts as a fence: each completed sequence releases exactly one waiter, so submitting one
+ * sequence per frame and calling this once per frame keeps the compositor in lockstep with
+ * the PPA.
+ *
+ * @param[in] seq PPA sequence executor handle
+ * @param[in] timeout_ms Maximum time to wait, in milliseconds; -1 means wait forever
+ *
+ * @return
+ *      - ESP_OK: A sequence completed
+ *      - ESP_ERR_INVALID_ARG: Wait failed because of invalid argument
+ *      - ESP_ERR_TIMEOUT: No sequence completed within the timeout
+ */
+esp_err_t ppa_seq_wait(ppa_seq_handle_t seq, int timeout_ms);
+
 #ifdef __cplusplus
 }
 #endif
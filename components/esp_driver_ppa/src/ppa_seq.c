@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "freertos/idf_additions.h"
+#include "driver/ppa.h"
+#include "ppa_priv.h"
+
+static const char *TAG = "ppa_seq";
+
+// One submitted sequence, copied by value into the job queue so the caller's
+// operation configs do not need to outlive ppa_seq_submit
+typedef struct {
+    uint32_t oper_num;
+    void *user_data;
+    ppa_seq_oper_item_t opers[PPA_SEQ_OPER_NUM_MAX];
+} ppa_seq_job_t;
+
+struct ppa_seq_t {
+    ppa_client_handle_t srm_client;               // Client performing the SRM steps of the sequences
+    ppa_client_handle_t blend_client;             // Client performing the blend steps of the sequences
+    ppa_client_handle_t fill_client;              // Client performing the fill steps of the sequences
+    QueueHandle_t job_queue;                      // Queue of submitted, not yet executed sequences
+    SemaphoreHandle_t fence;                      // Counting semaphore, one count per completed sequence
+    TaskHandle_t task;                            // Executor task walking the sequences
+    volatile bool run;                            // Cleared to let the executor task exit
+    portMUX_TYPE spinlock;                        // Protects pending_num
+    uint32_t pending_num;                         // Number of submitted sequences not completed yet
+    ppa_seq_done_callback_t done_cb;              // Invoked from the executor task after each sequence
+};
+
+static void ppa_seq_task(void *arg)
+{
+    ppa_seq_handle_t seq = (ppa_seq_handle_t)arg;
+    ppa_seq_job_t job;
+
+    while (seq->run) {
+        if (xQueueReceive(seq->job_queue, &job, pdMS_TO_TICKS(100)) != pdTRUE) {
+            continue;
+        }
+        esp_err_t ret = ESP_OK;
+        for (uint32_t i = 0; i < job.oper_num && ret == ESP_OK; i++) {
+            ppa_seq_oper_item_t *item = &job.opers[i];
+            // The executor owns the ordering, each step runs to completion before the
+            // next one starts, so the steps themselves are performed blocking
+            switch (item->oper_type) {
+            case PPA_OPERATION_SRM:
+                item->srm_config.mode = PPA_TRANS_MODE_BLOCKING;
+                ret = ppa_do_scale_rotate_mirror(seq->srm_client, &item->srm_config);
+                break;
+            case PPA_OPERATION_BLEND:
+                item->blend_config.mode = PPA_TRANS_MODE_BLOCKING;
+                ret = ppa_do_blend(seq->blend_client, &item->blend_config);
+                break;
+            case PPA_OPERATION_FILL:
+                item->fill_config.mode = PPA_TRANS_MODE_BLOCKING;
+                ret = ppa_do_fill(seq->fill_client, &item->fill_config);
+                break;
+            default:
+                ret = ESP_ERR_INVALID_ARG;
+                break;
+            }
+            if (ret != ESP_OK) {
+                ESP_LOGE(TAG, "sequence aborted, step %"PRIu32" failed (%s)", i, esp_err_to_name(ret));
+            }
+        }
+        portENTER_CRITICAL(&seq->spinlock);
+        seq->pending_num--;
+        portEXIT_CRITICAL(&seq->spinlock);
+        xSemaphoreGive(seq->fence);
+        if (seq->done_cb) {
+            seq->done_cb(seq, ret, job.user_data);
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t ppa_seq_new(const ppa_seq_config_t *config, ppa_seq_handle_t *ret_seq)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && ret_seq, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    ppa_seq_t *seq = (ppa_seq_t *)heap_caps_calloc(1, sizeof(ppa_seq_t), PPA_MEM_ALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(seq, ESP_ERR_NO_MEM, TAG, "no mem to create sequence executor");
+    seq->spinlock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+    seq->done_cb = config->on_seq_done;
+    seq->run = true;
+
+    uint32_t queue_depth = MAX(1, config->max_pending_seq_num);
+    seq->job_queue = xQueueCreateWithCaps(queue_depth, sizeof(ppa_seq_job_t), PPA_MEM_ALLOC_CAPS);
+    ESP_GOTO_ON_FALSE(seq->job_queue, ESP_ERR_NO_MEM, err, TAG, "no mem for job queue");
+    seq->fence = xSemaphoreCreateCountingWithCaps(queue_depth, 0, PPA_MEM_ALLOC_CAPS);
+    ESP_GOTO_ON_FALSE(seq->fence, ESP_ERR_NO_MEM, err, TAG, "no mem for fence semaphore");
+
+    // One client per operation type, the executor task is their only caller
+    ppa_client_config_t client_config = {
+        .oper_type = PPA_OPERATION_SRM,
+        .max_pending_trans_num = 1,
+        .data_burst_length = config->data_burst_length,
+    };
+    ESP_GOTO_ON_ERROR(ppa_register_client(&client_config, &seq->srm_client), err, TAG, "failed to register SRM client");
+    client_config.oper_type = PPA_OPERATION_BLEND;
+    ESP_GOTO_ON_ERROR(ppa_register_client(&client_config, &seq->blend_client), err, TAG, "failed to register blend client");
+    client_config.oper_type = PPA_OPERATION_FILL;
+    ESP_GOTO_ON_ERROR(ppa_register_client(&client_config, &seq->fill_client), err, TAG, "failed to register fill client");
+
+    uint32_t stack_size = config->task_stack_size ? config->task_stack_size : 3072;
+    uint32_t task_prio = config->task_priority ? config->task_priority : 5;
+    ESP_GOTO_ON_FALSE(xTaskCreate(ppa_seq_task, "ppa_seq", stack_size, seq, task_prio, &seq->task) == pdTRUE,
+                      ESP_ERR_NO_MEM, err, TAG, "failed to create executor task");
+
+    *ret_seq = seq;
+    return ESP_OK;
+
+err:
+    seq->run = false;
+    if (seq->fill_client) {
+        ppa_unregister_client(seq->fill_client);
+    }
+    if (seq->blend_client) {
+        ppa_unregister_client(seq->blend_client);
+    }
+    if (seq->srm_client) {
+        ppa_unregister_client(seq->srm_client);
+    }
+    if (seq->fence) {
+        vSemaphoreDeleteWithCaps(seq->fence);
+    }
+    if (seq->job_queue) {
+        vQueueDeleteWithCaps(seq->job_queue);
+    }
+    free(seq);
+    return ret;
+}
+
+esp_err_t ppa_seq_del(ppa_seq_handle_t seq)
+{
+    ESP_RETURN_ON_FALSE(seq, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    portENTER_CRITICAL(&seq->spinlock);
+    uint32_t pending = seq->pending_num;
+    portEXIT_CRITICAL(&seq->spinlock);
+    ESP_RETURN_ON_FALSE(pending == 0, ESP_ERR_INVALID_STATE, TAG, "sequences still pending");
+
+    seq->run = false;
+    // The executor task polls the run flag between jobs and deletes itself
+    vTaskDelay(pdMS_TO_TICKS(200));
+
+    ppa_unregister_client(seq->fill_client);
+    ppa_unregister_client(seq->blend_client);
+    ppa_unregister_client(seq->srm_client);
+    vSemaphoreDeleteWithCaps(seq->fence);
+    vQueueDeleteWithCaps(seq->job_queue);
+    free(seq);
+    return ESP_OK;
+}
+
+esp_err_t ppa_seq_submit(ppa_seq_handle_t seq, const ppa_seq_oper_item_t *opers, uint32_t oper_num, void *user_data)
+{
+    ESP_RETURN_ON_FALSE(seq && opers, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(oper_num > 0 && oper_num <= PPA_SEQ_OPER_NUM_MAX, ESP_ERR_INVALID_ARG, TAG, "invalid operation number");
+
+    ppa_seq_job_t job = {
+        .oper_num = oper_num,
+        .user_data = user_data,
+    };
+    memcpy(job.opers, opers, oper_num * sizeof(ppa_seq_oper_item_t));
+
+    portENTER_CRITICAL(&seq->spinlock);
+    seq->pending_num++;
+    portEXIT_CRITICAL(&seq->spinlock);
+    if (xQueueSend(seq->job_queue, &job, 0) != pdTRUE) {
+        portENTER_CRITICAL(&seq->spinlock);
+        seq->pending_num--;
+        portEXIT_CRITICAL(&seq->spinlock);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t ppa_seq_wait(ppa_seq_handle_t seq, int timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(seq, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    TickType_t ticks_to_wait = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    ESP_RETURN_ON_FALSE(xSemaphoreTake(seq->fence, ticks_to_wait) == pdTRUE, ESP_ERR_TIMEOUT, TAG, "timeout waiting for sequence fence");
+    return ESP_OK;
+}
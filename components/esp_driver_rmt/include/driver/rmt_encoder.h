@@ -154,6 +154,20 @@ typedef struct {
                                            to 64 if zero / not given. */
 } rmt_simple_encoder_config_t;
 
+/**
+ * @brief Cache encoder configuration
+ */
+typedef struct {
+    rmt_encoder_handle_t primary_encoder; /*!< Encoder that produces the symbols on a cache miss. It is driven exclusively
+                                               by the cache encoder and must not be used with another channel or encoder.
+                                               It must only rely on the channel memory interface for its output
+                                               (e.g. the bytes encoder, the copy encoder, or a combination of them). */
+    size_t max_cached_symbols;            /*!< Capacity of one cache entry, in RMT symbols. A payload whose symbol stream
+                                               exceeds this is transmitted without caching. */
+    size_t max_payload_bytes;             /*!< Largest payload eligible for caching, in bytes */
+    size_t cache_entries;                 /*!< Number of distinct payloads to keep cached, 0 selects 1 */
+} rmt_cache_encoder_config_t;
+
 /**
  * @brief Create RMT bytes encoder, which can encode byte stream into RMT symbols
  *
@@ -227,6 +241,30 @@ esp_err_t rmt_new_bitscrambler_encoder(const rmt_bs_encoder_config_t *config, rm
  */
 esp_err_t rmt_new_simple_encoder(const rmt_simple_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder);
 
+/**
+ * @brief Create RMT cache encoder, which captures the symbol stream of another encoder and replays it for repeated payloads
+ *
+ * On the first transmission of a payload, the primary encoder runs once into a heap symbol buffer;
+ * subsequent transmissions of a byte-identical payload skip the primary encoder entirely and the
+ * captured symbols are copied straight into the RMT memory (or DMA buffer). This suits workloads
+ * that retransmit the same frame frequently, e.g. a LED strip refreshed with unchanged content.
+ *
+ * Cached payloads are looked up by hash, then verified byte-wise, so a hash collision can not
+ * replay the wrong symbol stream. The memory cost is `cache_entries` * (`max_cached_symbols` * 4 +
+ * `max_payload_bytes`) bytes.
+ *
+ * @note Deleting the cache encoder doesn't delete the primary encoder, the creator keeps its ownership.
+ *
+ * @param[in] config Cache encoder configuration
+ * @param[out] ret_encoder Returned encoder handle
+ * @return
+ *      - ESP_OK: Create RMT cache encoder successfully
+ *      - ESP_ERR_INVALID_ARG: Create RMT cache encoder failed because of invalid argument
+ *      - ESP_ERR_NO_MEM: Create RMT cache encoder failed because out of memory
+ *      - ESP_FAIL: Create RMT cache encoder failed because of other error
+ */
+esp_err_t rmt_new_cache_encoder(const rmt_cache_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder);
+
 /**
  * @brief Delete RMT encoder
  *
@@ -57,6 +57,12 @@ typedef struct {
     struct extra_rmt_receive_flags {
         uint32_t en_partial_rx: 1; /*!< Set this flag if the incoming data is very long, and the driver can only receive the data piece by piece,
                                         because the user buffer is not sufficient to save all the data. */
+        uint32_t en_continuous_rx: 1; /*!< Set this flag to keep the receiver running indefinitely: the user buffer is treated as a circular ring
+                                           that the hardware fills, each filled segment is handed out by the `on_recv_done` callback (with
+                                           `is_last` unset), and when the signal goes idle the tail is delivered (with `is_last` set) and
+                                           reception is re-armed inside the interrupt handler, without losing edges to a re-arm gap.
+                                           The stream only stops when `rmt_disable()` is called. This flag implies partial delivery, so the
+                                           symbols must be consumed from the callback before the ring wraps around. */
     } flags;                       /*!< Receive specific config flags */
 } rmt_receive_config_t;
 
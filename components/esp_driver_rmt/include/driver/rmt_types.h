@@ -56,9 +56,12 @@ typedef bool (*rmt_tx_done_callback_t)(rmt_channel_handle_t tx_chan, const rmt_t
 typedef struct {
     rmt_symbol_word_t *received_symbols; /*!< Point to the received RMT symbols */
     size_t num_symbols;                  /*!< The number of received RMT symbols */
+    uint64_t timestamp_us;               /*!< Time when this batch of symbols was handed out, in microseconds.
+                                              Useful for the continuous receive mode, where decoding may run a full buffer behind the hardware. */
     /// Extra flags
     struct extra_rmt_rx_done_event_flags {
-        uint32_t is_last: 1; /*!< Indicating if the current received data are the last part of the transaction */
+        uint32_t is_last: 1; /*!< Indicating if the current received data are the last part of the transaction.
+                                  In the continuous receive mode, it indicates the signal went idle after this batch (frame boundary). */
     } flags;                 /*!< Extra flags */
 } rmt_rx_done_event_data_t;
 
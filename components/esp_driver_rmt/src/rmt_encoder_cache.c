@@ -0,0 +1,192 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "driver/rmt_encoder.h"
+#include "rmt_private.h"
+
+typedef struct {
+    uint32_t hash;              // FNV-1a hash of the payload, used as a fast reject on lookup
+    size_t payload_size;        // size of the cached payload, in bytes
+    size_t symbol_num;          // number of captured symbols
+    uint8_t *payload;           // copy of the payload, compared on lookup to rule out hash collisions
+    rmt_symbol_word_t *symbols; // captured symbol stream
+    bool valid;
+} rmt_cache_entry_t;
+
+typedef struct rmt_cache_encoder_t {
+    rmt_encoder_t base;             // encoder base class
+    rmt_encoder_handle_t primary;   // encoder that produces the symbols on a cache miss
+    rmt_encoder_handle_t copier;    // replays a captured symbol stream into the channel memory
+    rmt_tx_channel_t *capture_chan; // stand-in channel whose "hardware memory" is a cache entry buffer
+    size_t max_symbols;             // capacity of one cache entry, in symbols
+    size_t max_payload;             // largest payload eligible for caching, in bytes
+    size_t num_entries;             // number of cache entries
+    size_t next_victim;             // round-robin replacement cursor
+    rmt_cache_entry_t *cur;         // entry replayed in the ongoing encoding session, NULL means pass-through
+    bool session_active;            // whether an encoding session is ongoing
+    rmt_cache_entry_t entries[];    // cache entries
+} rmt_cache_encoder_t;
+
+RMT_ENCODER_FUNC_ATTR
+static uint32_t rmt_cache_encoder_hash(const uint8_t *data, size_t size)
+{
+    uint32_t hash = 2166136261UL;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+RMT_ENCODER_FUNC_ATTR
+static bool rmt_cache_encoder_capture(rmt_cache_encoder_t *cache_encoder, rmt_cache_entry_t *entry,
+                                      const void *data, size_t data_size, uint32_t hash)
+{
+    rmt_tx_channel_t *capture_chan = cache_encoder->capture_chan;
+    entry->valid = false;
+    // the primary encoder writes into the entry buffer through the stand-in channel,
+    // with the "hardware memory" large enough that no ping-pong wrap can happen
+    capture_chan->base.hw_mem_base = entry->symbols;
+    capture_chan->mem_off_bytes = 0;
+    capture_chan->mem_end = cache_encoder->max_symbols;
+    capture_chan->ping_pong_symbols = cache_encoder->max_symbols;
+    cache_encoder->primary->reset(cache_encoder->primary);
+
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    while (!(state & RMT_ENCODING_COMPLETE)) {
+        size_t encoded = cache_encoder->primary->encode(cache_encoder->primary, &capture_chan->base, data, data_size, &state);
+        if (((state & RMT_ENCODING_MEM_FULL) || encoded == 0) && !(state & RMT_ENCODING_COMPLETE)) {
+            // the symbol stream doesn't fit into the cache entry, give up and pass through
+            cache_encoder->primary->reset(cache_encoder->primary);
+            return false;
+        }
+    }
+
+    memcpy(entry->payload, data, data_size);
+    entry->payload_size = data_size;
+    entry->hash = hash;
+    entry->symbol_num = capture_chan->mem_off_bytes / sizeof(rmt_symbol_word_t);
+    entry->valid = true;
+    return true;
+}
+
+RMT_ENCODER_FUNC_ATTR
+static size_t rmt_encode_cache(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
+                               const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state)
+{
+    rmt_cache_encoder_t *cache_encoder = __containerof(encoder, rmt_cache_encoder_t, base);
+
+    if (!cache_encoder->session_active) {
+        // a new encoding session begins, decide between replay and pass-through once
+        cache_encoder->session_active = true;
+        cache_encoder->cur = NULL;
+        if (data_size <= cache_encoder->max_payload) {
+            uint32_t hash = rmt_cache_encoder_hash(primary_data, data_size);
+            rmt_cache_entry_t *entry = NULL;
+            for (size_t i = 0; i < cache_encoder->num_entries; i++) {
+                rmt_cache_entry_t *it = &cache_encoder->entries[i];
+                if (it->valid && it->hash == hash && it->payload_size == data_size &&
+                        memcmp(it->payload, primary_data, data_size) == 0) {
+                    entry = it;
+                    break;
+                }
+            }
+            if (!entry) {
+                // cache miss: capture the encode pass into an entry, then replay it below
+                rmt_cache_entry_t *victim = &cache_encoder->entries[cache_encoder->next_victim];
+                cache_encoder->next_victim = (cache_encoder->next_victim + 1) % cache_encoder->num_entries;
+                if (rmt_cache_encoder_capture(cache_encoder, victim, primary_data, data_size, hash)) {
+                    entry = victim;
+                }
+            }
+            cache_encoder->cur = entry;
+        }
+    }
+
+    size_t encoded;
+    if (cache_encoder->cur) {
+        encoded = cache_encoder->copier->encode(cache_encoder->copier, channel, cache_encoder->cur->symbols,
+                                                cache_encoder->cur->symbol_num * sizeof(rmt_symbol_word_t), ret_state);
+    } else {
+        encoded = cache_encoder->primary->encode(cache_encoder->primary, channel, primary_data, data_size, ret_state);
+    }
+    if (*ret_state & RMT_ENCODING_COMPLETE) {
+        cache_encoder->session_active = false;
+    }
+    return encoded;
+}
+
+RMT_ENCODER_FUNC_ATTR
+static esp_err_t rmt_cache_encoder_reset(rmt_encoder_t *encoder)
+{
+    rmt_cache_encoder_t *cache_encoder = __containerof(encoder, rmt_cache_encoder_t, base);
+    cache_encoder->session_active = false;
+    cache_encoder->cur = NULL;
+    cache_encoder->primary->reset(cache_encoder->primary);
+    cache_encoder->copier->reset(cache_encoder->copier);
+    return ESP_OK;
+}
+
+static esp_err_t rmt_del_cache_encoder(rmt_encoder_t *encoder)
+{
+    rmt_cache_encoder_t *cache_encoder = __containerof(encoder, rmt_cache_encoder_t, base);
+    if (cache_encoder->copier) {
+        rmt_del_encoder(cache_encoder->copier);
+    }
+    for (size_t i = 0; i < cache_encoder->num_entries; i++) {
+        free(cache_encoder->entries[i].symbols);
+        free(cache_encoder->entries[i].payload);
+    }
+    free(cache_encoder->capture_chan);
+    free(cache_encoder);
+    return ESP_OK;
+}
+
+esp_err_t rmt_new_cache_encoder(const rmt_cache_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder)
+{
+    esp_err_t ret = ESP_OK;
+    rmt_cache_encoder_t *encoder = NULL;
+    ESP_GOTO_ON_FALSE(config && ret_encoder && config->primary_encoder, ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+    ESP_GOTO_ON_FALSE(config->max_cached_symbols && config->max_payload_bytes, ESP_ERR_INVALID_ARG, err, TAG, "invalid cache capacity");
+
+    size_t num_entries = config->cache_entries ? config->cache_entries : 1;
+    encoder = rmt_alloc_encoder_mem(sizeof(rmt_cache_encoder_t) + num_entries * sizeof(rmt_cache_entry_t));
+    ESP_GOTO_ON_FALSE(encoder, ESP_ERR_NO_MEM, err, TAG, "no mem for cache encoder");
+    encoder->num_entries = num_entries;
+    encoder->max_symbols = config->max_cached_symbols;
+    encoder->max_payload = config->max_payload_bytes;
+    encoder->primary = config->primary_encoder;
+
+    encoder->capture_chan = rmt_alloc_encoder_mem(sizeof(rmt_tx_channel_t));
+    ESP_GOTO_ON_FALSE(encoder->capture_chan, ESP_ERR_NO_MEM, err, TAG, "no mem for capture channel");
+
+    for (size_t i = 0; i < num_entries; i++) {
+        encoder->entries[i].symbols = rmt_alloc_encoder_mem(config->max_cached_symbols * sizeof(rmt_symbol_word_t));
+        encoder->entries[i].payload = rmt_alloc_encoder_mem(config->max_payload_bytes);
+        ESP_GOTO_ON_FALSE(encoder->entries[i].symbols && encoder->entries[i].payload, ESP_ERR_NO_MEM, err, TAG, "no mem for cache entry");
+    }
+
+    rmt_copy_encoder_config_t copy_config = {};
+    ESP_GOTO_ON_ERROR(rmt_new_copy_encoder(&copy_config, &encoder->copier), err, TAG, "create copy encoder failed");
+
+    encoder->base.encode = rmt_encode_cache;
+    encoder->base.del = rmt_del_cache_encoder;
+    encoder->base.reset = rmt_cache_encoder_reset;
+    // return general encoder handle
+    *ret_encoder = &encoder->base;
+    ESP_LOGD(TAG, "new cache encoder @%p, %u entries of %u symbols", encoder, (unsigned)num_entries, (unsigned)config->max_cached_symbols);
+    return ESP_OK;
+err:
+    if (encoder) {
+        for (size_t i = 0; i < encoder->num_entries; i++) {
+            free(encoder->entries[i].symbols);
+            free(encoder->entries[i].payload);
+        }
+        free(encoder->capture_chan);
+        free(encoder);
+    }
+    return ret;
+}
@@ -211,6 +211,7 @@ typedef struct {
     int dma_desc_index;         // tracking the DMA descriptor used by ping-pong
     struct {
         uint32_t en_partial_rx: 1; // packet is too long, we need to notify the user to process the data piece by piece, in a ping-pong approach
+        uint32_t en_continuous_rx: 1; // never-ending reception: the buffer is a ring, segments are handed out as they fill, and the receiver re-arms in the ISR
     } flags;
 } rmt_rx_trans_desc_t;
 
@@ -6,6 +6,7 @@
 
 #include "esp_memory_utils.h"
 #include "esp_cache.h"
+#include "esp_timer.h"
 #include "esp_rom_gpio.h"
 #include "driver/gpio.h"
 #include "driver/rmt_rx.h"
@@ -21,7 +22,7 @@ static void rmt_rx_default_isr(void *args);
 static bool rmt_dma_rx_one_block_cb(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data);
 
 __attribute__((always_inline))
-static inline void rmt_rx_mount_dma_buffer(rmt_rx_channel_t *rx_chan, const void *buffer, size_t buffer_size, size_t mem_alignment, size_t per_block_size, size_t last_block_size)
+static inline void rmt_rx_mount_dma_buffer(rmt_rx_channel_t *rx_chan, const void *buffer, size_t buffer_size, size_t mem_alignment, size_t per_block_size, size_t last_block_size, bool circular)
 {
     uint8_t *data = (uint8_t *)buffer;
     gdma_buffer_mount_config_t mount_configs[rx_chan->num_dma_nodes];
@@ -37,6 +38,10 @@ static inline void rmt_rx_mount_dma_buffer(rmt_rx_channel_t *rx_chan, const void
         };
     }
     mount_configs[rx_chan->num_dma_nodes - 1].length = last_block_size;
+    if (circular) {
+        // chain the last descriptor back to the head, so the hardware fills the ring indefinitely without descriptor re-arm
+        mount_configs[rx_chan->num_dma_nodes - 1].flags.mark_final = GDMA_FINAL_LINK_TO_HEAD;
+    }
     gdma_link_mount_buffers(rx_chan->dma_link, 0, mount_configs, rx_chan->num_dma_nodes, NULL);
 }
 
@@ -349,6 +354,7 @@ esp_err_t rmt_receive(rmt_channel_handle_t channel, void *buffer, size_t buffer_
     ESP_RETURN_ON_FALSE_ISR(channel->direction == RMT_CHANNEL_DIRECTION_RX, ESP_ERR_INVALID_ARG, TAG, "invalid channel direction");
 #if !SOC_RMT_SUPPORT_RX_PINGPONG
     ESP_RETURN_ON_FALSE_ISR(!config->flags.en_partial_rx, ESP_ERR_NOT_SUPPORTED, TAG, "partial receive not supported");
+    ESP_RETURN_ON_FALSE_ISR(!config->flags.en_continuous_rx, ESP_ERR_NOT_SUPPORTED, TAG, "continuous receive not supported");
 #endif
     rmt_rx_channel_t *rx_chan = __containerof(channel, rmt_rx_channel_t, base);
     size_t mem_alignment = sizeof(rmt_symbol_word_t);
@@ -386,6 +392,14 @@ esp_err_t rmt_receive(rmt_channel_handle_t channel, void *buffer, size_t buffer_
     }
 #endif // SOC_RMT_SUPPORT_DMA
 
+#if SOC_RMT_SUPPORT_RX_PINGPONG
+    if (config->flags.en_continuous_rx && !channel->dma_chan) {
+        // the ring is drained in ping-pong halves, so it must hold at least one of them
+        ESP_RETURN_ON_FALSE_ISR(buffer_size >= rx_chan->ping_pong_symbols * sizeof(rmt_symbol_word_t),
+                                ESP_ERR_INVALID_ARG, TAG, "buffer too small for continuous receive, must hold %d symbols", rx_chan->ping_pong_symbols);
+    }
+#endif
+
     rmt_group_t *group = channel->group;
     rmt_hal_context_t *hal = &group->hal;
     int channel_id = channel->channel_id;
@@ -408,7 +422,9 @@ esp_err_t rmt_receive(rmt_channel_handle_t channel, void *buffer, size_t buffer_
     t->received_symbol_num = 0;
     t->copy_dest_off = 0;
     t->dma_desc_index = 0;
-    t->flags.en_partial_rx = config->flags.en_partial_rx;
+    // continuous reception hands out every filled segment, i.e. it implies the partial delivery path
+    t->flags.en_partial_rx = config->flags.en_partial_rx || config->flags.en_continuous_rx;
+    t->flags.en_continuous_rx = config->flags.en_continuous_rx;
 
 #if SOC_RMT_SUPPORT_DMA
     if (channel->dma_chan) {
@@ -422,7 +438,7 @@ esp_err_t rmt_receive(rmt_channel_handle_t channel, void *buffer, size_t buffer_
         size_t per_dma_block_size = buffer_size / rx_chan->num_dma_nodes;
         per_dma_block_size = ALIGN_DOWN(per_dma_block_size, mem_alignment);
         size_t last_dma_block_size = buffer_size - per_dma_block_size * (rx_chan->num_dma_nodes - 1);
-        rmt_rx_mount_dma_buffer(rx_chan, buffer, buffer_size, mem_alignment, per_dma_block_size, last_dma_block_size);
+        rmt_rx_mount_dma_buffer(rx_chan, buffer, buffer_size, mem_alignment, per_dma_block_size, last_dma_block_size, t->flags.en_continuous_rx);
         gdma_reset(channel->dma_chan);
         gdma_start(channel->dma_chan, gdma_link_get_head_addr(rx_chan->dma_link)); // note, we must use the cached descriptor address to start the DMA
     }
@@ -615,6 +631,46 @@ bool rmt_isr_handle_rx_done(rmt_rx_channel_t *rx_chan)
 
     size_t mem_want = (offset >= rx_chan->mem_off ? offset - rx_chan->mem_off : rx_chan->mem_off - offset);
     mem_want *= sizeof(rmt_symbol_word_t);
+
+    if (trans_desc->flags.en_continuous_rx) {
+        // the signal went idle: hand out the tail of the frame and re-arm the receiver without leaving the ISR
+        if (mem_want > trans_desc->buffer_size - trans_desc->copy_dest_off) {
+            trans_desc->copy_dest_off = 0; // wrap the ring
+        }
+        size_t tail_size = MIN(mem_want, trans_desc->buffer_size);
+        if (tail_size < mem_want) {
+            ESP_DRAM_LOGD(TAG, "user buffer too small, received symbols truncated");
+        }
+        uint8_t *dest = (uint8_t *)trans_desc->buffer + trans_desc->copy_dest_off;
+        portENTER_CRITICAL_ISR(&channel->spinlock);
+        rmt_ll_rx_set_mem_owner(hal->regs, channel_id, RMT_LL_MEM_OWNER_SW);
+        memcpy(dest, channel->hw_mem_base + rx_chan->mem_off, tail_size);
+        rmt_ll_rx_set_mem_owner(hal->regs, channel_id, RMT_LL_MEM_OWNER_HW);
+        // only re-arm if the channel is still running, rmt_disable() may have stopped the stream meanwhile;
+        // checked inside the critical section so it can't cross a concurrent rmt_rx_disable()
+        if (atomic_load(&channel->fsm) == RMT_FSM_RUN) {
+            // gap-free re-arm: reset the memory writer and restart the RX engine right here,
+            // so the next frame's leading edges are not lost to a task-level rmt_receive()
+            rmt_ll_rx_reset_pointer(hal->regs, channel_id);
+            rmt_ll_rx_enable(hal->regs, channel_id, true);
+        }
+        portEXIT_CRITICAL_ISR(&channel->spinlock);
+        trans_desc->copy_dest_off += tail_size;
+        rx_chan->mem_off = 0;
+        if (cb) {
+            rmt_rx_done_event_data_t edata = {
+                .received_symbols = (rmt_symbol_word_t *)dest,
+                .num_symbols = tail_size / sizeof(rmt_symbol_word_t),
+                .timestamp_us = (uint64_t)esp_timer_get_time(),
+                .flags.is_last = true, // frame boundary, the stream itself keeps running
+            };
+            if (cb(channel, &edata, rx_chan->user_data)) {
+                need_yield = true;
+            }
+        }
+        return need_yield;
+    }
+
     size_t mem_have = trans_desc->buffer_size - trans_desc->copy_dest_off;
     size_t copy_size = mem_want;
     if (mem_want > mem_have) {
@@ -625,6 +681,7 @@ bool rmt_isr_handle_rx_done(rmt_rx_channel_t *rx_chan)
                     rmt_rx_done_event_data_t edata = {
                         .received_symbols = trans_desc->buffer,
                         .num_symbols = trans_desc->received_symbol_num,
+                        .timestamp_us = (uint64_t)esp_timer_get_time(),
                         .flags.is_last = false,
                     };
                     if (cb(channel, &edata, rx_chan->user_data)) {
@@ -677,6 +734,7 @@ bool rmt_isr_handle_rx_done(rmt_rx_channel_t *rx_chan)
         rmt_rx_done_event_data_t edata = {
             .received_symbols = trans_desc->buffer,
             .num_symbols = trans_desc->received_symbol_num,
+            .timestamp_us = (uint64_t)esp_timer_get_time(),
             .flags.is_last = true,
         };
         if (cb(channel, &edata, rx_chan->user_data)) {
@@ -701,6 +759,37 @@ bool rmt_isr_handle_rx_threshold(rmt_rx_channel_t *rx_chan)
     size_t mem_want = rx_chan->ping_pong_symbols * sizeof(rmt_symbol_word_t);
     size_t mem_have = trans_desc->buffer_size - trans_desc->copy_dest_off;
     size_t copy_size = mem_want;
+
+    if (trans_desc->flags.en_continuous_rx) {
+        // watermark event: hand out the freshly filled ping-pong half as one segment
+        if (mem_want > mem_have) {
+            trans_desc->copy_dest_off = 0; // wrap the ring
+        }
+        uint8_t *dest = (uint8_t *)trans_desc->buffer + trans_desc->copy_dest_off;
+        portENTER_CRITICAL_ISR(&channel->spinlock);
+        rmt_ll_rx_set_mem_owner(hal->regs, channel_id, RMT_LL_MEM_OWNER_SW);
+        memcpy(dest, channel->hw_mem_base + rx_chan->mem_off, mem_want);
+        rmt_ll_rx_set_mem_owner(hal->regs, channel_id, RMT_LL_MEM_OWNER_HW);
+        portEXIT_CRITICAL_ISR(&channel->spinlock);
+        trans_desc->copy_dest_off += mem_want;
+        trans_desc->received_symbol_num += rx_chan->ping_pong_symbols;
+        // update the hw memory offset, where stores the next RMT symbols to copy
+        rx_chan->mem_off = rx_chan->ping_pong_symbols - rx_chan->mem_off;
+        rmt_rx_done_callback_t cb = rx_chan->on_recv_done;
+        if (cb) {
+            rmt_rx_done_event_data_t edata = {
+                .received_symbols = (rmt_symbol_word_t *)dest,
+                .num_symbols = rx_chan->ping_pong_symbols,
+                .timestamp_us = (uint64_t)esp_timer_get_time(),
+                .flags.is_last = false,
+            };
+            if (cb(channel, &edata, rx_chan->user_data)) {
+                need_yield = true;
+            }
+        }
+        return need_yield;
+    }
+
     if (mem_want > mem_have) {
         if (trans_desc->flags.en_partial_rx) {
             // notify the user to process the received symbols if the buffer is going to be full
@@ -710,6 +799,7 @@ bool rmt_isr_handle_rx_threshold(rmt_rx_channel_t *rx_chan)
                     rmt_rx_done_event_data_t edata = {
                         .received_symbols = trans_desc->buffer,
                         .num_symbols = trans_desc->received_symbol_num,
+                        .timestamp_us = (uint64_t)esp_timer_get_time(),
                         .flags.is_last = false,
                     };
                     if (cb(channel, &edata, rx_chan->user_data)) {
@@ -814,7 +904,33 @@ static bool rmt_dma_rx_one_block_cb(gdma_channel_handle_t dma_chan, gdma_event_d
         esp_cache_msync(trans_desc->buffer, trans_desc->buffer_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
     }
 
-    if (event_data->flags.normal_eof) {
+    if (event_data->flags.normal_eof && trans_desc->flags.en_continuous_rx) {
+        // the RMT peripheral received an "end marker": hand out the tail block as a frame boundary,
+        // the circular descriptor chain keeps the DMA serving the ring across the end marker
+        size_t dma_desc_index = trans_desc->dma_desc_index;
+        if (rx_chan->on_recv_done) {
+            rmt_rx_done_event_data_t edata = {
+                .received_symbols = gdma_link_get_buffer(rx_chan->dma_link, dma_desc_index),
+                .num_symbols = rmt_rx_count_symbols_for_single_block(rx_chan, dma_desc_index),
+                .timestamp_us = (uint64_t)esp_timer_get_time(),
+                .flags.is_last = true, // frame boundary, the stream itself keeps running
+            };
+            if (rx_chan->on_recv_done(channel, &edata, rx_chan->user_data)) {
+                need_yield = true;
+            }
+        }
+        trans_desc->dma_desc_index = (dma_desc_index + 1) % rx_chan->num_dma_nodes;
+        portENTER_CRITICAL_ISR(&channel->spinlock);
+        // only re-arm if the channel is still running, rmt_disable() may have stopped the stream meanwhile;
+        // checked inside the critical section so it can't cross a concurrent rmt_rx_disable()
+        if (atomic_load(&channel->fsm) == RMT_FSM_RUN) {
+            // gap-free re-arm: restart the RX engine right here, the DMA descriptors need no touch
+            rmt_ll_rx_enable(hal->regs, channel_id, false);
+            rmt_ll_rx_reset_pointer(hal->regs, channel_id);
+            rmt_ll_rx_enable(hal->regs, channel_id, true);
+        }
+        portEXIT_CRITICAL_ISR(&channel->spinlock);
+    } else if (event_data->flags.normal_eof) {
         // if the DMA received an EOF, it means the RMT peripheral has received an "end marker"
         portENTER_CRITICAL_ISR(&channel->spinlock);
         // disable the RX engine, it will be enabled again in the next `rmt_receive()`
@@ -829,6 +945,7 @@ static bool rmt_dma_rx_one_block_cb(gdma_channel_handle_t dma_chan, gdma_event_d
             rmt_rx_done_event_data_t edata = {
                 .received_symbols = gdma_link_get_buffer(rx_chan->dma_link, recycle_start_index),
                 .num_symbols = rmt_rx_count_symbols_until_eof(rx_chan, recycle_start_index),
+                .timestamp_us = (uint64_t)esp_timer_get_time(),
                 .flags.is_last = true,
             };
             if (rx_chan->on_recv_done(channel, &edata, rx_chan->user_data)) {
@@ -843,6 +960,7 @@ static bool rmt_dma_rx_one_block_cb(gdma_channel_handle_t dma_chan, gdma_event_d
                 rmt_rx_done_event_data_t edata = {
                     .received_symbols = gdma_link_get_buffer(rx_chan->dma_link, dma_desc_index),
                     .num_symbols = rmt_rx_count_symbols_for_single_block(rx_chan, dma_desc_index),
+                    .timestamp_us = (uint64_t)esp_timer_get_time(),
                     .flags.is_last = false,
                 };
                 if (rx_chan->on_recv_done(channel, &edata, rx_chan->user_data)) {
@@ -119,6 +119,22 @@ esp_err_t sdio_slave_reset_hw(void);
  */
 sdio_slave_buf_handle_t sdio_slave_recv_register_buf(uint8_t *start);
 
+/** Register an array of receiving buffers in one call.
+ *
+ * Equivalent to calling ``sdio_slave_recv_register_buf`` for each buffer, but allocates all the descriptors first and
+ * links them to the driver in a single critical section, which is noticeably cheaper when registering many buffers.
+ *
+ * @param start Array of start addresses of the buffers. Same requirements as ``sdio_slave_recv_register_buf``.
+ * @param buf_num Number of buffers in the array.
+ * @param[out] handle_ret Output array of ``buf_num`` buffer handles.
+ *
+ * @return
+ *     - ESP_ERR_INVALID_ARG    if any argument is NULL, ``buf_num`` is 0, or any buffer is not DMA capable and 32-bit aligned
+ *     - ESP_ERR_NO_MEM         if descriptor allocation fails; no buffer is registered in this case
+ *     - ESP_OK if success
+ */
+esp_err_t sdio_slave_recv_register_buf_multi(uint8_t *const start[], size_t buf_num, sdio_slave_buf_handle_t handle_ret[]);
+
 /** Unregister buffer from driver, and free the space used by the descriptor pointing to the buffer.
  *
  * @param handle Handle to the buffer to release.
@@ -139,6 +155,21 @@ esp_err_t sdio_slave_recv_unregister_buf(sdio_slave_buf_handle_t handle);
  */
 esp_err_t sdio_slave_recv_load_buf(sdio_slave_buf_handle_t handle);
 
+/** Load an array of buffers to the queue waiting to receive data in one call.
+ *
+ * Equivalent to calling ``sdio_slave_recv_load_buf`` for each handle, but loads all the buffers onto the link list in a
+ * single critical section. Use this to re-queue the buffers returned by ``sdio_slave_recv_packet_multi`` in one go.
+ *
+ * @param handles Array of handles to buffers ready to receive data.
+ * @param buf_num Number of handles in the array.
+ *
+ * @return
+ *     - ESP_ERR_INVALID_ARG    if ``handles`` is NULL, ``buf_num`` is 0, or any handle is invalid or already in the
+ *                              queue; no buffer is loaded in this case
+ *     - ESP_OK if success
+ */
+esp_err_t sdio_slave_recv_load_buf_multi(sdio_slave_buf_handle_t *handles, size_t buf_num);
+
 /** Get buffer of received data if exist with packet information. The driver returns the ownership of the buffer to the app.
  *
  * When you see return value is ``ESP_ERR_NOT_FINISHED``, you should call this API iteratively until the return value is ``ESP_OK``.
@@ -161,6 +192,30 @@ esp_err_t sdio_slave_recv_load_buf(sdio_slave_buf_handle_t handle);
  */
 esp_err_t sdio_slave_recv_packet(sdio_slave_buf_handle_t* handle_ret, uint32_t wait);
 
+/** Get all the buffers of one packet from the host in one call. The driver returns the ownership of the buffers to the app.
+ *
+ * When a host transfer is longer than the receiving buffer size, it spans several buffers on the link list. This API
+ * collects all the finished buffers of such a transfer in a single critical section, instead of one
+ * ``sdio_slave_recv_packet`` call (and one critical section) per buffer.
+ *
+ * @param[out] handle_ret Output array of handles of the buffers holding received data, in receiving order.
+ * @param buf_num Size of the ``handle_ret`` array.
+ * @param[out] recv_num Output of the number of handles actually written to ``handle_ret``.
+ * @param wait Time to wait before the first buffer is received. Remaining buffers of the packet are only taken if
+ *             already finished, without extra waiting.
+ *
+ * @note Re-queue the returned buffers with ``sdio_slave_recv_load_buf_multi`` to receive in the same buffers again.
+ *
+ * @return
+ *     - ESP_ERR_INVALID_ARG    if any argument is NULL or ``buf_num`` is 0
+ *     - ESP_ERR_TIMEOUT        if timeout before receiving new data
+ *     - ESP_ERR_NOT_FINISHED   if the last returned buffer is not the end of a packet from the host (the array filled
+ *                              up, or the rest of the packet is still being received), call this API again for the
+ *                              remaining buffers of the packet
+ *     - ESP_OK if the last returned buffer is the end of a packet
+ */
+esp_err_t sdio_slave_recv_packet_multi(sdio_slave_buf_handle_t handle_ret[], size_t buf_num, size_t *recv_num, uint32_t wait);
+
 /** Get received data if exist. The driver returns the ownership of the buffer to the app.
  *
  * @param handle_ret Handle to the buffer holding received data. Use this handle in ``sdio_slave_recv_load_buf`` to receive in the same buffer again.
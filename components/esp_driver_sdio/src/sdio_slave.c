@@ -783,6 +783,56 @@ sdio_slave_buf_handle_t sdio_slave_recv_register_buf(uint8_t *start)
     return desc;
 }
 
+esp_err_t sdio_slave_recv_register_buf_multi(uint8_t *const start[], size_t buf_num, sdio_slave_buf_handle_t handle_ret[])
+{
+    SDIO_SLAVE_CHECK(start != NULL && handle_ret != NULL && buf_num > 0, "invalid argument", ESP_ERR_INVALID_ARG);
+    for (size_t i = 0; i < buf_num; i++) {
+        SDIO_SLAVE_CHECK(esp_ptr_dma_capable(start[i]) && (uint32_t)start[i] % 4 == 0,
+                         "buffer to register should be DMA capable and 32-bit aligned", ESP_ERR_INVALID_ARG);
+    }
+
+    for (size_t i = 0; i < buf_num; i++) {
+        recv_desc_t *desc = (recv_desc_t *)heap_caps_malloc(sizeof(recv_desc_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT | MALLOC_CAP_DMA);
+        if (desc == NULL) {
+            SDIO_SLAVE_LOGE("cannot allocate lldesc for new buffer");
+            for (size_t j = 0; j < i; j++) {
+                free(handle_ret[j]);
+                handle_ret[j] = NULL;
+            }
+            return ESP_ERR_NO_MEM;
+        }
+        sdio_slave_hal_recv_init_desc(context.hal, &desc->hal_desc, start[i]);
+        handle_ret[i] = desc;
+    }
+
+    //link all the new descriptors to the reg list in one critical section
+    critical_enter_recv();
+    for (size_t i = 0; i < buf_num; i++) {
+        TAILQ_INSERT_TAIL(&context.recv_reg_list, (recv_desc_t *)handle_ret[i], tail_entry);
+    }
+    critical_exit_recv();
+    return ESP_OK;
+}
+
+esp_err_t sdio_slave_recv_load_buf_multi(sdio_slave_buf_handle_t *handles, size_t buf_num)
+{
+    SDIO_SLAVE_CHECK(handles != NULL && buf_num > 0, "invalid argument", ESP_ERR_INVALID_ARG);
+    //the app owns these buffers, so `not_receiving` cannot change concurrently once checked
+    for (size_t i = 0; i < buf_num; i++) {
+        CHECK_HANDLE_IDLE((recv_desc_t *)handles[i]);
+    }
+
+    critical_enter_recv();
+    for (size_t i = 0; i < buf_num; i++) {
+        recv_desc_t *desc = (recv_desc_t *)handles[i];
+        TAILQ_REMOVE(&context.recv_reg_list, desc, tail_entry);
+        desc->not_receiving = 0; //manually remove the prev link (by set not_receiving=0), to indicate this is in the queue
+        sdio_slave_hal_load_buf(context.hal, &desc->hal_desc);
+    }
+    critical_exit_recv();
+    return ESP_OK;
+}
+
 esp_err_t sdio_slave_recv(sdio_slave_buf_handle_t *handle_ret, uint8_t **out_addr, size_t *out_len, uint32_t wait)
 {
     esp_err_t ret = sdio_slave_recv_packet(handle_ret, wait);
@@ -826,6 +876,47 @@ esp_err_t sdio_slave_recv_packet(sdio_slave_buf_handle_t *handle_ret, uint32_t w
     return ret;
 }
 
+esp_err_t sdio_slave_recv_packet_multi(sdio_slave_buf_handle_t handle_ret[], size_t buf_num, size_t *recv_num, uint32_t wait)
+{
+    SDIO_SLAVE_CHECK(handle_ret != NULL && buf_num > 0 && recv_num != NULL, "invalid argument", ESP_ERR_INVALID_ARG);
+    *recv_num = 0;
+    BaseType_t err = xSemaphoreTake(context.recv_event, wait);
+    if (err == pdFALSE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    //take the events of buffers already finished without blocking, so that all of them
+    //can be unloaded and returned to the reg list in a single critical section
+    size_t taken = 1;
+    while (taken < buf_num && xSemaphoreTake(context.recv_event, 0) == pdTRUE) {
+        taken++;
+    }
+
+    esp_err_t ret = ESP_ERR_NOT_FINISHED;
+    size_t cnt = 0;
+    critical_enter_recv();
+    while (cnt < taken) {
+        recv_desc_t *desc = (recv_desc_t *)sdio_slave_hal_recv_unload_desc(context.hal);
+        assert(desc != NULL && desc->hal_desc.owner == 0);
+        TAILQ_INSERT_TAIL(&context.recv_reg_list, desc, tail_entry);
+        handle_ret[cnt++] = (sdio_slave_buf_handle_t)desc;
+        if (desc->hal_desc.eof) {
+            ret = ESP_OK;
+            break;
+        }
+    }
+    critical_exit_recv();
+
+    //events taken beyond the end of the packet belong to the next packet, hand them back
+    while (cnt < taken) {
+        xSemaphoreGive(context.recv_event);
+        taken--;
+    }
+
+    *recv_num = cnt;
+    return ret;
+}
+
 esp_err_t sdio_slave_recv_unregister_buf(sdio_slave_buf_handle_t handle)
 {
     recv_desc_t *desc = (recv_desc_t *)handle;
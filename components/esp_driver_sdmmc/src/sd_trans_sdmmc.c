@@ -179,6 +179,10 @@ void sd_host_dma_prepare(sd_host_sdmmc_slot_t *slot, void *data_ptr, size_t data
 ---------------------------------------------------------------*/
 static bool cmd_needs_auto_stop(const sdmmc_command_t *cmd)
 {
+    /* Transfers pre-sized with CMD23 end by themselves, CMD12 must not be sent */
+    if (cmd->flags & SCF_NO_AUTO_STOP) {
+        return false;
+    }
     /* SDMMC host needs an "auto stop" flag for the following commands: */
     return cmd->datalen > 0 &&
            (cmd->opcode == MMC_WRITE_BLOCK_MULTIPLE ||
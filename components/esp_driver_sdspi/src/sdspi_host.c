@@ -29,6 +29,11 @@
 #define GPIO_UNUSED 0xff                //!< Flag indicating that CD/WP is unused
 /// Size of the buffer returned by get_block_buf
 #define SDSPI_BLOCK_BUF_SIZE    (SDSPI_MAX_DATA_LEN + 4)
+/// Per-block overhead on the wire in burst reads: start token + CRC16
+#define SDSPI_BURST_BLOCK_OVERHEAD  3
+/// Number of blocks the burst read buffer is sized for (actual size is
+/// additionally capped by the maximum transaction length of the SPI bus)
+#define SDSPI_BURST_MAX_BLOCKS  8
 /// Maximum number of dummy bytes between the request and response (minimum is 1)
 #define SDSPI_RESPONSE_MAX_DELAY  8
 
@@ -44,6 +49,8 @@ typedef struct {
     spi_host_device_t   host_id; //!< SPI host id.
     spi_device_handle_t spi_handle; //!< SPI device handle, used for transactions
     uint8_t* block_buf;
+    uint8_t* burst_buf;         //!< DMA buffer for multi-block burst reads, allocated on demand
+    size_t   burst_buf_size;    //!< Size of burst_buf in bytes
     /// semaphore of gpio interrupt
     SemaphoreHandle_t   semphr_int;
     uint16_t duty_cycle_pos;  ///< Duty cycle of positive clock, in 1/256th increments (128 = 50%/50% duty). Setting this to 0 (=not setting it) is equivalent to setting this to 128.
@@ -170,6 +177,33 @@ static esp_err_t get_block_buf(slot_info_t *slot, uint8_t **out_buf)
     return ESP_OK;
 }
 
+/// Get pointer to the DMA buffer used for burst reads, allocate if necessary.
+/// Returns ESP_ERR_NOT_SUPPORTED if the SPI bus cannot transfer at least one
+/// whole block per transaction (e.g. the bus was initialized without DMA).
+static esp_err_t get_burst_buf(slot_info_t *slot, uint8_t **out_buf, size_t *out_size)
+{
+    if (slot->burst_buf == NULL) {
+        size_t max_trans_len = 0;
+        esp_err_t err = spi_bus_get_max_transaction_len(slot->host_id, &max_trans_len);
+        if (err != ESP_OK) {
+            return err;
+        }
+        size_t size = MIN(max_trans_len,
+                          SDSPI_BURST_MAX_BLOCKS * (SDSPI_MAX_DATA_LEN + SDSPI_BURST_BLOCK_OVERHEAD));
+        if (size < SDSPI_MAX_DATA_LEN + SDSPI_BURST_BLOCK_OVERHEAD) {
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+        slot->burst_buf = heap_caps_malloc(size, MALLOC_CAP_DMA);
+        if (slot->burst_buf == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        slot->burst_buf_size = size;
+    }
+    *out_buf = slot->burst_buf;
+    *out_size = slot->burst_buf_size;
+    return ESP_OK;
+}
+
 /// Clock out one byte (CS has to be high) to make the card release MISO
 /// (clocking one bit would work as well, but that triggers a bug in SPI DMA)
 static void release_bus(slot_info_t *slot)
@@ -236,6 +270,9 @@ static esp_err_t deinit_slot(slot_info_t *slot)
         slot->spi_handle = NULL;
         free(slot->block_buf);
         slot->block_buf = NULL;
+        free(slot->burst_buf);
+        slot->burst_buf = NULL;
+        slot->burst_buf_size = 0;
     }
 
     uint64_t pin_bit_mask = 0;
@@ -713,6 +750,220 @@ static esp_err_t shift_cmd_response(sdspi_hw_cmd_t* cmd, int sent_bytes)
     return ESP_OK;
 }
 
+// Send CMD12 to end a multi block read and wait for the card to process it
+static esp_err_t send_stop_transmission(slot_info_t *slot, int timeout_ms)
+{
+    sdspi_hw_cmd_t stop_cmd;
+    make_hw_cmd(MMC_STOP_TRANSMISSION, 0, timeout_ms, &stop_cmd);
+    esp_err_t ret = start_command_default(slot, SDSPI_CMD_FLAG_RSP_R1B, &stop_cmd);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (stop_cmd.r1 != 0) {
+        ESP_LOGD(TAG, "%s: STOP_TRANSMISSION response 0x%02x", __func__, stop_cmd.r1);
+    }
+    return poll_busy(slot, timeout_ms, use_polling);
+}
+
+/* Incremental parser for the byte stream of a multi block read. The stream is
+ * a repetition of: idle bytes (0xff), TOKEN_BLOCK_START, SDSPI_MAX_DATA_LEN
+ * data bytes, 2 bytes of CRC. The parser consumes the stream in arbitrarily
+ * sized chunks, copies data bytes to the destination buffer and verifies the
+ * CRC of each completed block, so block boundaries don't have to line up with
+ * SPI transaction boundaries.
+ */
+typedef struct {
+    enum {
+        BURST_WAIT_TOKEN, // waiting for TOKEN_BLOCK_START
+        BURST_DATA,       // receiving data bytes of the current block
+        BURST_CRC,        // receiving the CRC of the current block
+    } state;
+    uint8_t *dest;            // destination for the next data byte
+    uint32_t rx_remaining;    // data bytes not yet written to dest
+    size_t block_remaining;   // data bytes left in the current block
+    uint8_t *block_start;     // start of the current block in dest, for CRC
+    uint8_t crc_buf[2];
+    size_t crc_received;
+    bool crc_enabled;
+    size_t blocks_done;
+} burst_parser_t;
+
+static esp_err_t burst_parser_feed(burst_parser_t *p, const uint8_t *buf, size_t len)
+{
+    while (len > 0) {
+        switch (p->state) {
+        case BURST_WAIT_TOKEN: {
+            uint8_t rd_data = *buf++;
+            --len;
+            if (rd_data == TOKEN_BLOCK_START) {
+                p->block_start = p->dest;
+                p->block_remaining = MIN(p->rx_remaining, SDSPI_MAX_DATA_LEN);
+                p->state = BURST_DATA;
+            } else if (rd_data != 0xff && rd_data != 0) {
+                ESP_LOGD(TAG, "%s: received 0x%02x while waiting for data",
+                         __func__, rd_data);
+                return ESP_ERR_INVALID_RESPONSE;
+            }
+            break;
+        }
+        case BURST_DATA: {
+            size_t chunk = MIN(len, p->block_remaining);
+            memcpy(p->dest, buf, chunk);
+            p->dest += chunk;
+            p->rx_remaining -= chunk;
+            p->block_remaining -= chunk;
+            buf += chunk;
+            len -= chunk;
+            if (p->block_remaining == 0) {
+                p->crc_received = 0;
+                p->state = BURST_CRC;
+            }
+            break;
+        }
+        case BURST_CRC: {
+            size_t chunk = MIN(len, sizeof(p->crc_buf) - p->crc_received);
+            memcpy(p->crc_buf + p->crc_received, buf, chunk);
+            p->crc_received += chunk;
+            buf += chunk;
+            len -= chunk;
+            if (p->crc_received == sizeof(p->crc_buf)) {
+                if (p->crc_enabled) {
+                    uint16_t crc;
+                    memcpy(&crc, p->crc_buf, sizeof(crc));
+                    uint16_t crc_of_data = sdspi_crc16(p->block_start, p->dest - p->block_start);
+                    if (crc_of_data != crc) {
+                        ESP_LOGE(TAG, "data CRC failed, got=0x%04x expected=0x%04x", crc_of_data, crc);
+                        ESP_LOG_BUFFER_HEX(TAG, p->block_start, 16);
+                        return ESP_ERR_INVALID_CRC;
+                    }
+                }
+                p->blocks_done++;
+                p->state = BURST_WAIT_TOKEN;
+            }
+            break;
+        }
+        }
+    }
+    return ESP_OK;
+}
+
+/* Minimum number of bytes the card still has to send, assuming every pending
+ * block token arrives with no idle bytes in front of it. Receiving exactly
+ * this much can never overshoot the final CRC: idle bytes only push the
+ * stream contents further out, in which case the parser picks the rest up in
+ * the next round.
+ */
+static size_t burst_parser_min_pending(const burst_parser_t *p)
+{
+    size_t pending = 0;
+    uint32_t data_not_started = p->rx_remaining;
+    switch (p->state) {
+    case BURST_WAIT_TOKEN:
+        break;
+    case BURST_DATA:
+        pending += p->block_remaining + sizeof(p->crc_buf);
+        data_not_started -= p->block_remaining;
+        break;
+    case BURST_CRC:
+        pending += sizeof(p->crc_buf) - p->crc_received;
+        break;
+    }
+    // one token + data + CRC for every block not started yet
+    size_t blocks_not_started = (data_not_started + SDSPI_MAX_DATA_LEN - 1) / SDSPI_MAX_DATA_LEN;
+    pending += data_not_started + blocks_not_started * (1 + sizeof(p->crc_buf));
+    return pending;
+}
+
+/* Burst variant of start_command_read_blocks: instead of one SPI transaction
+ * per 512-byte block, receive as many whole blocks per DMA transaction as the
+ * burst buffer holds and scan for the start tokens in the received buffer.
+ * This removes the inter-transaction dead time (~95 us per block, see below)
+ * from all block boundaries inside a burst, which roughly doubles the
+ * throughput of large multi-block reads.
+ */
+static esp_err_t start_command_read_blocks_burst(slot_info_t *slot, sdspi_hw_cmd_t *cmd,
+                                                 uint8_t *data, uint32_t rx_length)
+{
+    uint8_t *burst_buf;
+    size_t burst_buf_size;
+    esp_err_t ret = get_burst_buf(slot, &burst_buf, &burst_buf_size);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    spi_transaction_t t_command = {
+        .length = (SDSPI_CMD_R1_SIZE + SDSPI_RESPONSE_MAX_DELAY) * 8,
+        .tx_buffer = cmd,
+        .rx_buffer = cmd,
+    };
+    ret = spi_device_polling_transmit(slot->spi_handle, &t_command);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    uint8_t* cmd_u8 = (uint8_t*) cmd;
+    size_t pre_scan_data_size = SDSPI_RESPONSE_MAX_DELAY;
+    uint8_t* pre_scan_data_ptr = cmd_u8 + SDSPI_CMD_R1_SIZE;
+
+    /* R1 response is delayed by 1-8 bytes from the request.
+     * This loop searches for the response and writes it to cmd->r1.
+     */
+    while ((cmd->r1 & SD_SPI_R1_NO_RESPONSE) != 0 && pre_scan_data_size > 0) {
+        cmd->r1 = *pre_scan_data_ptr;
+        ++pre_scan_data_ptr;
+        --pre_scan_data_size;
+    }
+    if (cmd->r1 & SD_SPI_R1_NO_RESPONSE) {
+        ESP_LOGD(TAG, "no response token found");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    burst_parser_t parser = {
+        .state = BURST_WAIT_TOKEN,
+        .dest = data,
+        .rx_remaining = rx_length,
+        .crc_enabled = slot->data_crc_enabled,
+    };
+
+    // bytes clocked in along with the R1 response may already contain the
+    // first data token and the beginning of the data
+    ret = burst_parser_feed(&parser, pre_scan_data_ptr, pre_scan_data_size);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    size_t last_blocks_done = parser.blocks_done;
+    int64_t t_end = esp_timer_get_time() + cmd->timeout_ms * 1000;
+    size_t pending;
+    while ((pending = burst_parser_min_pending(&parser)) > 0) {
+        size_t will_receive = MIN(pending, burst_buf_size);
+        memset(burst_buf, SDSPI_MOSI_IDLE_VAL, will_receive);
+        spi_transaction_t t_data = {
+            .length = will_receive * 8,
+            .rx_buffer = burst_buf,
+            .tx_buffer = burst_buf,
+        };
+        ret = spi_device_transmit(slot->spi_handle, &t_data);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        ret = burst_parser_feed(&parser, burst_buf, will_receive);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+
+        if (parser.blocks_done != last_blocks_done) {
+            // made progress, rearm the data token timeout
+            last_blocks_done = parser.blocks_done;
+            t_end = esp_timer_get_time() + cmd->timeout_ms * 1000;
+        } else if (esp_timer_get_time() > t_end) {
+            ESP_LOGD(TAG, "%s: timeout", __func__);
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+    return ESP_OK;
+}
+
 /**
  * Receiving one or more blocks of data happens as follows:
  * 1. send command + receive r1 response (SDSPI_CMD_R1_SIZE bytes total)
@@ -757,6 +1008,21 @@ static esp_err_t shift_cmd_response(sdspi_hw_cmd_t* cmd, int sent_bytes)
 static esp_err_t start_command_read_blocks(slot_info_t *slot, sdspi_hw_cmd_t *cmd,
                                            uint8_t *data, uint32_t rx_length, bool need_stop_command)
 {
+    // Whole multi-block transfers go through the burst path; fall through to
+    // the per-block path only when the burst buffer is not available (no DMA
+    // on the bus, or out of DMA-capable memory). get_burst_buf fails before
+    // any SPI traffic, so falling through is safe.
+    if (rx_length > SDSPI_MAX_DATA_LEN && rx_length % SDSPI_MAX_DATA_LEN == 0) {
+        esp_err_t ret = start_command_read_blocks_burst(slot, cmd, data, rx_length);
+        if (ret != ESP_ERR_NO_MEM && ret != ESP_ERR_NOT_SUPPORTED) {
+            if (ret == ESP_OK && need_stop_command) {
+                ret = send_stop_transmission(slot, cmd->timeout_ms);
+            }
+            return ret;
+        }
+        ESP_LOGD(TAG, "%s: burst buffer unavailable, using per-block transfers", __func__);
+    }
+
     spi_transaction_t t_command = {
         .length = (SDSPI_CMD_R1_SIZE + SDSPI_RESPONSE_MAX_DELAY) * 8,
         .tx_buffer = cmd,
@@ -865,16 +1131,7 @@ static esp_err_t start_command_read_blocks(slot_info_t *slot, sdspi_hw_cmd_t *cm
     if (need_stop_command) {
         // To end multi block transfer, send stop command and wait for the
         // card to process it
-        sdspi_hw_cmd_t stop_cmd;
-        make_hw_cmd(MMC_STOP_TRANSMISSION, 0, cmd->timeout_ms, &stop_cmd);
-        ret = start_command_default(slot, SDSPI_CMD_FLAG_RSP_R1B, &stop_cmd);
-        if (ret != ESP_OK) {
-            return ret;
-        }
-        if (stop_cmd.r1 != 0) {
-            ESP_LOGD(TAG, "%s: STOP_TRANSMISSION response 0x%02x", __func__, stop_cmd.r1);
-        }
-        ret = poll_busy(slot, cmd->timeout_ms, use_polling);
+        ret = send_stop_transmission(slot, cmd->timeout_ms);
         if (ret != ESP_OK) {
             return ret;
         }
@@ -115,6 +115,29 @@ esp_err_t spi_device_queue_multi_trans(spi_device_handle_t handle, spi_multi_tra
  *        - ESP_ERR_TIMEOUT:       Timeout, didn't get a completed SCT transaction
  */
 esp_err_t spi_device_get_multi_trans_result(spi_device_handle_t handle, spi_multi_transaction_t **seg_trans_desc, uint32_t ticks_to_wait);
+
+/**
+ * @brief Send an SPI Segmented-Configure-Transaction (SCT) list as one polling transaction.
+ *
+ * Search for `@Backgrounds: `SCT Mode`` in this header file to know what is SCT mode
+ *
+ * The whole list is linked into a single chain of DMA descriptors and transferred back-to-back, so the
+ * bus acquisition, CS setup and completion handling are paid once per list instead of once per transaction.
+ * The CPU busy-waits until the chain is done, no interrupt is used. Useful for many small transactions
+ * issued at a high rate, where per-transaction interrupt overhead dominates.
+ *
+ * @note Do not mix this API with `spi_device_queue_multi_trans` while queued transactions are pending.
+ *
+ * @param handle         Device handle obtained using spi_host_add_dev
+ * @param seg_trans_desc Pointer to the transaction segments list head (a one-segment-list is also acceptable)
+ * @param trans_num      Transaction number in this segment
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *        - ESP_ERR_INVALID_STATE: Invalid states, e.g.: an SPI polling transaction is ongoing, SCT mode isn't enabled, DMA descriptors not enough, etc.
+ */
+esp_err_t spi_device_polling_multi_transmit(spi_device_handle_t handle, spi_multi_transaction_t *seg_trans_desc, uint32_t trans_num);
 #endif  //#ifdef SOC_SPI_SCT_SUPPORTED
 
 #ifdef __cplusplus
@@ -1820,18 +1820,12 @@ static void SPI_MASTER_ATTR s_sct_format_conf_buffer(spi_device_handle_t handle,
     spi_hal_sct_format_conf_buffer(hal, &seg_config, hal_dev, buffer);
 }
 
-esp_err_t SPI_MASTER_ATTR spi_device_queue_multi_trans(spi_device_handle_t handle, spi_multi_transaction_t *seg_trans_desc, uint32_t trans_num, uint32_t ticks_to_wait)
+/* Format the conf buffer and link all segments of one multi-transaction into
+ * TX/RX DMA descriptor chains. On success, out_sct_desc holds the chain heads,
+ * the conf buffer and the used descriptor counts.
+ */
+static esp_err_t SPI_MASTER_ATTR s_sct_setup_dma_chain(spi_device_handle_t handle, spi_multi_transaction_t *seg_trans_desc, uint32_t trans_num, spi_sct_trans_priv_t *out_sct_desc)
 {
-    SPI_CHECK(handle, "Invalid arguments.", ESP_ERR_INVALID_ARG);
-    SPI_CHECK(SOC_SPI_SCT_SUPPORTED(handle->host->id), "Invalid arguments", ESP_ERR_INVALID_ARG);
-    SPI_CHECK(handle->host->sct_mode_enabled == 1, "SCT mode isn't enabled", ESP_ERR_INVALID_STATE);
-
-    esp_err_t ret = ESP_OK;
-    for (int i = 0; i < trans_num; i++) {
-        ESP_RETURN_ON_ERROR(check_trans_valid(handle, (spi_transaction_t *)&seg_trans_desc[i]), SPI_TAG, "Invalid transaction");
-    }
-    SPI_CHECK(!spi_bus_device_is_polling(handle), "Cannot queue new transaction while previous polling transaction is not terminated.", ESP_ERR_INVALID_STATE);
-
     uint32_t *conf_buffer = heap_caps_malloc(trans_num * SPI_LL_SCT_CONF_BUF_NUM * sizeof(uint32_t), MALLOC_CAP_DMA);
     SPI_CHECK(conf_buffer, "No enough memory", ESP_ERR_NO_MEM);
 
@@ -1887,11 +1881,7 @@ esp_err_t SPI_MASTER_ATTR spi_device_queue_multi_trans(spi_device_handle_t handl
         }
     }
 
-#ifdef CONFIG_PM_ENABLE
-    esp_pm_lock_acquire(handle->host->bus_attr->pm_lock);
-#endif
-
-    spi_sct_trans_priv_t sct_desc = {
+    *out_sct_desc = (spi_sct_trans_priv_t) {
         .tx_seg_head = tx_seg_head,
         .rx_seg_head = rx_seg_head,
         .sct_trans_desc_head = seg_trans_desc,
@@ -1899,9 +1889,44 @@ esp_err_t SPI_MASTER_ATTR spi_device_queue_multi_trans(spi_device_handle_t handl
         .tx_used_desc_num = tx_used_dma_desc_num,
         .rx_used_desc_num = rx_used_dma_desc_num,
     };
+    return ESP_OK;
+}
+
+/* Undo s_sct_setup_dma_chain for a chain which was never started */
+static void SPI_MASTER_ATTR s_sct_discard_dma_chain(spi_host_t *host, spi_sct_trans_priv_t *sct_desc)
+{
+    free(sct_desc->sct_conf_buffer);
+    portENTER_CRITICAL(&host->spinlock);
+    spi_hal_sct_tx_dma_desc_recycle(&host->sct_desc_pool, sct_desc->tx_used_desc_num);
+    spi_hal_sct_rx_dma_desc_recycle(&host->sct_desc_pool, sct_desc->rx_used_desc_num);
+    portEXIT_CRITICAL(&host->spinlock);
+}
+
+esp_err_t SPI_MASTER_ATTR spi_device_queue_multi_trans(spi_device_handle_t handle, spi_multi_transaction_t *seg_trans_desc, uint32_t trans_num, uint32_t ticks_to_wait)
+{
+    SPI_CHECK(handle, "Invalid arguments.", ESP_ERR_INVALID_ARG);
+    SPI_CHECK(SOC_SPI_SCT_SUPPORTED(handle->host->id), "Invalid arguments", ESP_ERR_INVALID_ARG);
+    SPI_CHECK(handle->host->sct_mode_enabled == 1, "SCT mode isn't enabled", ESP_ERR_INVALID_STATE);
+
+    esp_err_t ret = ESP_OK;
+    for (int i = 0; i < trans_num; i++) {
+        ESP_RETURN_ON_ERROR(check_trans_valid(handle, (spi_transaction_t *)&seg_trans_desc[i]), SPI_TAG, "Invalid transaction");
+    }
+    SPI_CHECK(!spi_bus_device_is_polling(handle), "Cannot queue new transaction while previous polling transaction is not terminated.", ESP_ERR_INVALID_STATE);
+
+    spi_sct_trans_priv_t sct_desc;
+    ret = s_sct_setup_dma_chain(handle, seg_trans_desc, trans_num, &sct_desc);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+#ifdef CONFIG_PM_ENABLE
+    esp_pm_lock_acquire(handle->host->bus_attr->pm_lock);
+#endif
 
     BaseType_t r = xQueueSend(handle->trans_queue, (void *)&sct_desc, ticks_to_wait);
     if (!r) {
+        s_sct_discard_dma_chain(handle->host, &sct_desc);
 #ifdef CONFIG_PM_ENABLE
         //Release APB frequency lock
         esp_pm_lock_release(handle->host->bus_attr->pm_lock);
@@ -1934,4 +1959,67 @@ esp_err_t SPI_MASTER_ATTR spi_device_get_multi_trans_result(spi_device_handle_t
 
     return ESP_OK;
 }
+
+esp_err_t SPI_MASTER_ATTR spi_device_polling_multi_transmit(spi_device_handle_t handle, spi_multi_transaction_t *seg_trans_desc, uint32_t trans_num)
+{
+    SPI_CHECK(handle, "Invalid arguments.", ESP_ERR_INVALID_ARG);
+    SPI_CHECK(SOC_SPI_SCT_SUPPORTED(handle->host->id), "Invalid arguments", ESP_ERR_INVALID_ARG);
+    SPI_CHECK(handle->host->sct_mode_enabled == 1, "SCT mode isn't enabled", ESP_ERR_INVALID_STATE);
+
+    esp_err_t ret = ESP_OK;
+    for (int i = 0; i < trans_num; i++) {
+        ESP_RETURN_ON_ERROR(check_trans_valid(handle, (spi_transaction_t *)&seg_trans_desc[i]), SPI_TAG, "Invalid transaction");
+    }
+    SPI_CHECK(!spi_bus_device_is_polling(handle), "Cannot send polling transaction while the previous polling transaction is not terminated.", ESP_ERR_INVALID_STATE);
+    SPI_CHECK(uxQueueMessagesWaiting(handle->trans_queue) == 0, "Cannot poll a multi transaction while queued multi transactions are pending", ESP_ERR_INVALID_STATE);
+
+    spi_host_t *host = handle->host;
+    spi_sct_trans_priv_t sct_desc;
+    ret = s_sct_setup_dma_chain(handle, seg_trans_desc, trans_num, &sct_desc);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    /* Same bus acquisition rules as spi_device_polling_start() */
+    if (host->device_acquiring_lock != handle) {
+        if ((seg_trans_desc[0].base.flags & SPI_TRANS_CS_KEEP_ACTIVE) != 0) {
+            ret = ESP_ERR_INVALID_ARG;
+        } else {
+            ret = spi_bus_lock_acquire_start(handle->dev_lock, portMAX_DELAY);
+        }
+    } else {
+        ret = spi_bus_lock_wait_bg_done(handle->dev_lock, portMAX_DELAY);
+    }
+    if (ret != ESP_OK) {
+        s_sct_discard_dma_chain(host, &sct_desc);
+        ESP_LOGE(SPI_TAG, "polling can't get buslock");
+        return ret;
+    }
+
+    host->polling = true;
+    host->cur_sct_trans = sct_desc;
+
+    ESP_LOGV(SPI_TAG, "polling multi trans");
+    spi_new_sct_trans(handle, &host->cur_sct_trans);
+
+    /* The whole chain completes with a single SEG_DONE event; no interrupt is
+     * enabled here, the status bit is polled instead. It is cleared by
+     * s_sct_load_dma_link() when the next chain is loaded.
+     */
+    while (!spi_hal_usr_is_done(&host->hal) && !spi_hal_get_intr_mask(&host->hal, SPI_LL_INTR_SEG_DONE)) {
+        // busy waiting until the transaction chain is done
+    }
+
+    ESP_LOGV(SPI_TAG, "polling multi trans done");
+    //deal with the in-flight transaction, frees the conf buffer and recycles the descriptors
+    spi_post_sct_trans(host);
+
+    host->polling = false;
+    if (host->device_acquiring_lock != handle) {
+        assert(host->device_acquiring_lock == NULL);
+        spi_bus_lock_acquire_end(handle->dev_lock);
+    }
+
+    return ESP_OK;
+}
 #endif  //#ifdef SOC_SPI_SCT_SUPPORTED
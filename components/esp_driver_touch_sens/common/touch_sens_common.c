@@ -68,6 +68,12 @@ static void s_touch_free_resource(touch_sensor_handle_t sens_handle)
         vSemaphoreDeleteWithCaps(sens_handle->mutex);
         sens_handle->mutex = NULL;
     }
+#if SOC_TOUCH_SENSOR_VERSION >= 2
+    if (sens_handle->sweep_data) {
+        free(sens_handle->sweep_data);
+        sens_handle->sweep_data = NULL;
+    }
+#endif
     free(g_touch);
     g_touch = NULL;
 }
@@ -460,6 +466,74 @@ esp_err_t touch_channel_read_data(touch_channel_handle_t chan_handle, touch_chan
     return touch_priv_channel_read_data(chan_handle, type, data);
 }
 
+#if SOC_TOUCH_SENSOR_VERSION >= 2
+esp_err_t touch_sensor_config_sweep_collect(touch_sensor_handle_t sens_handle, const touch_sweep_collect_config_t *sweep_cfg)
+{
+    TOUCH_NULL_POINTER_CHECK(sens_handle);
+
+    esp_err_t ret = ESP_OK;
+    xSemaphoreTakeRecursive(sens_handle->mutex, portMAX_DELAY);
+    TOUCH_GOTO_ON_FALSE_FSM(!sens_handle->is_enabled, ESP_ERR_INVALID_STATE, err, TAG, "Please disable the touch sensor first");
+
+    if (sweep_cfg) {
+        uint32_t *sweep_data = sens_handle->sweep_data;
+        if (!sweep_data) {
+            sweep_data = (uint32_t *)heap_caps_calloc(TOUCH_TOTAL_CHAN_NUM * TOUCH_SAMPLE_CFG_NUM,
+                                                      sizeof(uint32_t), TOUCH_MEM_ALLOC_CAPS);
+            ESP_GOTO_ON_FALSE(sweep_data, ESP_ERR_NO_MEM, err, TAG, "No memory for the sweep snapshot buffer");
+        }
+        sens_handle->sweep_data_type = sweep_cfg->data_type;
+        sens_handle->sweep_cnt = 0;
+        /* Assign the buffer at last, it enables the collection in the interrupt handler */
+        sens_handle->sweep_data = sweep_data;
+    } else {
+        /* Detach the buffer before freeing, so that the interrupt handler won't access it anymore */
+        uint32_t *sweep_data = sens_handle->sweep_data;
+        sens_handle->sweep_data = NULL;
+        free(sweep_data);
+    }
+
+    TOUCH_FSM_ERR_TAG(err)
+    xSemaphoreGiveRecursive(sens_handle->mutex);
+    return ret;
+}
+
+esp_err_t touch_sensor_read_sweep_data(touch_sensor_handle_t sens_handle, uint32_t *data, size_t data_len, uint32_t *sweep_cnt)
+{
+    TOUCH_NULL_POINTER_CHECK(sens_handle);
+    TOUCH_NULL_POINTER_CHECK(data);
+    ESP_RETURN_ON_FALSE(data_len >= TOUCH_TOTAL_CHAN_NUM * TOUCH_SAMPLE_CFG_NUM, ESP_ERR_INVALID_ARG,
+                        TAG, "The output array is shorter than the sweep snapshot");
+    ESP_RETURN_ON_FALSE(sens_handle->sweep_data, ESP_ERR_INVALID_STATE, TAG, "The sweep collection is not configured");
+
+    /* Copy within the critical section so that the snapshot stays coherent with one sweep */
+    TOUCH_ENTER_CRITICAL(TOUCH_PERIPH_LOCK);
+    memcpy(data, sens_handle->sweep_data, TOUCH_TOTAL_CHAN_NUM * TOUCH_SAMPLE_CFG_NUM * sizeof(uint32_t));
+    if (sweep_cnt) {
+        *sweep_cnt = sens_handle->sweep_cnt;
+    }
+    TOUCH_EXIT_CRITICAL(TOUCH_PERIPH_LOCK);
+    return ESP_OK;
+}
+
+void touch_priv_sweep_collect(void)
+{
+    touch_sensor_handle_t sens_handle = g_touch;
+    if (!sens_handle || !sens_handle->sweep_data) {
+        return;
+    }
+    TOUCH_ENTER_CRITICAL_SAFE(TOUCH_PERIPH_LOCK);
+    FOR_EACH_TOUCH_CHANNEL(i) {
+        if (sens_handle->ch[i]) {
+            touch_priv_channel_read_data(sens_handle->ch[i], sens_handle->sweep_data_type,
+                                         &sens_handle->sweep_data[i * TOUCH_SAMPLE_CFG_NUM]);
+        }
+    }
+    sens_handle->sweep_cnt++;
+    TOUCH_EXIT_CRITICAL_SAFE(TOUCH_PERIPH_LOCK);
+}
+#endif  // SOC_TOUCH_SENSOR_VERSION >= 2
+
 /******************************************************************************/
 /*                            Scope: Private APIs                             */
 /******************************************************************************/
@@ -104,6 +104,14 @@ struct touch_sensor_s {
 
     SemaphoreHandle_t       mutex;                      /*!< Mutex lock to ensure thread safety */
 
+#if SOC_TOUCH_SENSOR_VERSION >= 2
+    uint32_t                *sweep_data;                /*!< Per-sweep snapshot buffer, NULL if the sweep collection is not configured.
+                                                         *   Holds TOUCH_SAMPLE_CFG_NUM values per channel, latched on every scan done interrupt.
+                                                         */
+    touch_chan_data_type_t  sweep_data_type;            /*!< The per-channel data type that is latched into the sweep snapshot */
+    volatile uint32_t       sweep_cnt;                  /*!< Number of completed sweeps since the sweep collection was configured */
+#endif
+
     uint8_t                 sample_cfg_num;             /*!< The number of sample configurations that in used */
     void                    *user_ctx;                  /*!< User context that will pass to the callback function */
     union {
@@ -233,6 +241,16 @@ esp_err_t touch_priv_channel_read_data(touch_channel_handle_t chan_handle, touch
 void touch_priv_execute_sw_filter(void *arg);
 #endif
 
+#if SOC_TOUCH_SENSOR_VERSION >= 2
+/**
+ * @brief Latch the configured data of all registered channels into the sweep snapshot buffer
+ * @note  This is a private interface of `esp_driver_touch_sens`
+ *        It is called from the default interrupt handler on every scan done interrupt,
+ *        and does nothing when the sweep collection is not configured
+ */
+void touch_priv_sweep_collect(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
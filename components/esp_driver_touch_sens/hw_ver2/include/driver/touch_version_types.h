@@ -414,6 +414,14 @@ typedef struct {
     bool                            do_reset;                /*!< Whether to reset the benchmark to the channel's latest smooth data */
 } touch_chan_benchmark_config_t;
 
+/**
+ * @brief Touch sensor sweep collection configurations
+ *
+ */
+typedef struct {
+    touch_chan_data_type_t          data_type;               /*!< The per-channel data type to latch into the sweep snapshot on every scan done interrupt */
+} touch_sweep_collect_config_t;
+
 #ifdef __cplusplus
 }
 #endif
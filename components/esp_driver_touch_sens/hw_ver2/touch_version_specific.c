@@ -97,8 +97,12 @@ void IRAM_ATTR touch_priv_default_intr_handler(void *arg)
            The scan done interrupt will be triggered twice for channel 13 and 14,
            but we only hope it be triggered after channel 14 measurement done. */
         bool fake_scan_done = data.chan_id == 13 && (g_touch->chan_mask >> 13 == 0x03);
+        if (!fake_scan_done) {
+            touch_priv_sweep_collect();
+        }
         if (g_touch->cbs.on_scan_done && !fake_scan_done)
 #else
+        touch_priv_sweep_collect();
         if (g_touch->cbs.on_scan_done)
 #endif
         {
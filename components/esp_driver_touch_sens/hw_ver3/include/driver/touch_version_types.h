@@ -441,6 +441,14 @@ typedef struct {
     uint32_t                        sample_cfg_id;          /*!< The sample configuration index to update the benchmark, only available when `do_force_update` is true */
 } touch_chan_benchmark_config_t;
 
+/**
+ * @brief Touch sensor sweep collection configurations
+ *
+ */
+typedef struct {
+    touch_chan_data_type_t          data_type;              /*!< The per-channel data type to latch into the sweep snapshot on every scan done interrupt */
+} touch_sweep_collect_config_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -80,6 +80,7 @@ void IRAM_ATTR touch_priv_default_intr_handler(void *arg)
         }
     }
     if (status & TOUCH_LL_INTR_MASK_SCAN_DONE) {
+        touch_priv_sweep_collect();
         if (g_touch->cbs.on_scan_done) {
             need_yield |= g_touch->cbs.on_scan_done(g_touch, &data, g_touch->user_ctx);
         }
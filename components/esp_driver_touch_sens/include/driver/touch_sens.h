@@ -244,6 +244,43 @@ esp_err_t touch_channel_read_data(touch_channel_handle_t chan_handle, touch_chan
 esp_err_t touch_channel_config_benchmark(touch_channel_handle_t chan_handle, const touch_chan_benchmark_config_t *benchmark_cfg);
 #endif  // SOC_TOUCH_SUPPORT_BENCHMARK
 
+#if SOC_TOUCH_SENSOR_VERSION >= 2
+/**
+ * @brief Configure the per-sweep batch data collection
+ * @note  When configured, the driver latches the specified data of all the registered channels
+ *        into an internal snapshot buffer on every scan done interrupt, so that one full sweep
+ *        only produces one readable snapshot instead of per-channel register reads.
+ *        The snapshot can be read via `touch_sensor_read_sweep_data`.
+ *
+ * @param[in]  sens_handle      Touch sensor controller handle
+ * @param[in]  sweep_cfg        The sweep collection configurations, set NULL to disable the sweep collection
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   NULL controller handle
+ *      - ESP_ERR_INVALID_STATE The touch sensor controller is not disabled
+ *      - ESP_ERR_NO_MEM        No memory for the snapshot buffer
+ */
+esp_err_t touch_sensor_config_sweep_collect(touch_sensor_handle_t sens_handle, const touch_sweep_collect_config_t *sweep_cfg);
+
+/**
+ * @brief Read the latest per-sweep snapshot
+ * @note  The snapshot holds `TOUCH_SAMPLE_CFG_NUM` values per channel, indexed by
+ *        `(chan_id - TOUCH_MIN_CHAN_ID) * TOUCH_SAMPLE_CFG_NUM`. Channels that are
+ *        not registered read as zero.
+ *
+ * @param[in]  sens_handle      Touch sensor controller handle
+ * @param[out] data             The output snapshot array
+ * @param[in]  data_len         The length of the output array in `uint32_t` words,
+ *                              should be `TOUCH_TOTAL_CHAN_NUM * TOUCH_SAMPLE_CFG_NUM`
+ * @param[out] sweep_cnt        The number of completed sweeps since the collection was configured (can be NULL)
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   NULL pointer or the output array is too short
+ *      - ESP_ERR_INVALID_STATE The sweep collection is not configured
+ */
+esp_err_t touch_sensor_read_sweep_data(touch_sensor_handle_t sens_handle, uint32_t *data, size_t data_len, uint32_t *sweep_cnt);
+#endif  // SOC_TOUCH_SENSOR_VERSION >= 2
+
 #if SOC_TOUCH_SUPPORT_WATERPROOF
 /**
  * @brief Configure the touch sensor water proof channels
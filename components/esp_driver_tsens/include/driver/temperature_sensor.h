@@ -104,6 +104,23 @@ esp_err_t temperature_sensor_disable(temperature_sensor_handle_t tsens);
  */
 esp_err_t temperature_sensor_get_celsius(temperature_sensor_handle_t tsens, float *out_celsius);
 
+/**
+ * @brief Read temperature sensor data that is converted to degrees Celsius, from ISR context.
+ * @note  Unlike `temperature_sensor_get_celsius`, this function does not re-select the measurement
+ *        range when the ambient temperature drifts out of the current one. If the application keeps
+ *        reading from ISR only, it should still call `temperature_sensor_get_celsius` from a task
+ *        once in a while to keep the range optimal.
+ *
+ * @param tsens The handle created by `temperature_sensor_install()`.
+ * @param out_celsius The measure output value.
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG invalid arguments
+ *     - ESP_ERR_INVALID_STATE Temperature sensor is not enabled yet.
+ *     - ESP_FAIL Parse the sensor data into ambient temperature failed (e.g. out of the range).
+ */
+esp_err_t temperature_sensor_get_celsius_isr(temperature_sensor_handle_t tsens, float *out_celsius);
+
 #if SOC_TEMPERATURE_SENSOR_INTR_SUPPORT
 
 /**
@@ -38,6 +38,8 @@ static const char *TAG = "temperature_sensor";
 
 static int s_deltaT = INT_MIN; // unused number
 
+static esp_err_t read_delta_t_from_efuse(void);
+
 #if SOC_TEMPERATURE_SENSOR_INTR_SUPPORT
 static int8_t s_temperature_regval_2_celsius(temperature_sensor_handle_t tsens, uint8_t regval);
 #endif // SOC_TEMPERATURE_SENSOR_INTR_SUPPORT
@@ -257,6 +259,11 @@ esp_err_t temperature_sensor_enable(temperature_sensor_handle_t tsens)
     // the output value gradually approaches the true temperature
     // value as the measurement time increases. 300us is recommended.
     esp_rom_delay_us(300);
+    // Preload the calibration parameter here so that the first conversion can
+    // also happen in ISR context, where reading the eFuse is not allowed
+    if (s_deltaT == INT_MIN) {
+        read_delta_t_from_efuse();
+    }
     tsens->fsm = TEMP_SENSOR_FSM_ENABLE;
     return ESP_OK;
 }
@@ -319,6 +326,23 @@ esp_err_t temperature_sensor_get_celsius(temperature_sensor_handle_t tsens, floa
     return ESP_OK;
 }
 
+esp_err_t temperature_sensor_get_celsius_isr(temperature_sensor_handle_t tsens, float *out_celsius)
+{
+    ESP_RETURN_ON_FALSE_ISR((tsens != NULL), ESP_ERR_INVALID_ARG, TAG, "Has not been installed");
+    ESP_RETURN_ON_FALSE_ISR(out_celsius != NULL, ESP_ERR_INVALID_ARG, TAG, "Celsius points to nothing");
+    ESP_RETURN_ON_FALSE_ISR(tsens->fsm == TEMP_SENSOR_FSM_ENABLE, ESP_ERR_INVALID_STATE, TAG, "tsens not enabled yet");
+    bool range_changed;
+    int16_t tsens_out = temp_sensor_get_raw_value(&range_changed);
+    *out_celsius = parse_temp_sensor_raw_value(tsens_out);
+
+    if (*out_celsius < TEMPERATURE_SENSOR_LL_MEASURE_MIN || *out_celsius > TEMPERATURE_SENSOR_LL_MEASURE_MAX) {
+        return ESP_FAIL;
+    }
+    // The measurement range attribute can not be re-selected here, a periodic
+    // `temperature_sensor_get_celsius` call from task context takes care of it
+    return ESP_OK;
+}
+
 #if SOC_TEMPERATURE_SENSOR_INTR_SUPPORT
 
 static uint8_t s_temperature_celsius_2_regval(temperature_sensor_handle_t tsens, int8_t celsius)
@@ -61,6 +61,102 @@ uint32_t twai_node_timing_calc_param(const uint32_t source_freq, const twai_timi
     return source_freq / (pre_div * (prop + tseg_1 + tseg_2 + 1));
 }
 
+// One entry of the working set the filter compiler clusters: a single ID is {id, UINT32_MAX},
+// an ID range is its common prefix {low & mask, mask}
+typedef struct {
+    uint32_t base;
+    uint32_t mask;
+} twai_filter_item_t;
+
+static int _filter_item_cmp(const void *a, const void *b)
+{
+    uint32_t base_a = ((const twai_filter_item_t *)a)->base;
+    uint32_t base_b = ((const twai_filter_item_t *)b)->base;
+    return (base_a > base_b) - (base_a < base_b);
+}
+
+// smallest "keep the common prefix" mask whose acceptance set covers the whole range [low, high]
+static uint32_t _range_prefix_mask(uint32_t low, uint32_t high)
+{
+    uint32_t diff = low ^ high;
+    return diff ? ~((2UL << (31 - __builtin_clz(diff))) - 1) : UINT32_MAX;
+}
+
+size_t twai_filter_compile_masks(const twai_id_filter_list_t *filter_list, twai_mask_filter_config_t *out_cfg, size_t num_filters)
+{
+    size_t item_num = filter_list->id_num + filter_list->range_num;
+    if (!item_num || !num_filters) {
+        return 0;
+    }
+    size_t cluster_max = MIN(item_num, num_filters);
+    twai_filter_item_t *items = malloc(item_num * sizeof(twai_filter_item_t) + cluster_max * sizeof(size_t));
+    if (!items) {
+        return 0;
+    }
+    size_t *cut_idx = (size_t *)(items + item_num);     // cut before item cut_idx[n], cut_idx[0] fixed to 0
+    for (size_t i = 0; i < filter_list->id_num; i++) {
+        items[i].base = filter_list->id_list[i];
+        items[i].mask = UINT32_MAX;
+    }
+    for (size_t i = 0; i < filter_list->range_num; i++) {
+        uint32_t mask = _range_prefix_mask(filter_list->range_list[i].id_low, filter_list->range_list[i].id_high);
+        items[filter_list->id_num + i].base = filter_list->range_list[i].id_low & mask;
+        items[filter_list->id_num + i].mask = mask;
+    }
+    qsort(items, item_num, sizeof(twai_filter_item_t), _filter_item_cmp);
+
+    // when the hardware has fewer filters than items, merge adjacent items into clusters,
+    // cutting at the largest gaps between sorted IDs to keep the accepted superset small
+    size_t cluster_num = cluster_max;
+    cut_idx[0] = 0;
+    for (size_t n = 1; n < cluster_num; n++) {
+        size_t best = 0;
+        uint32_t best_gap = 0;
+        for (size_t i = 1; i < item_num; i++) {
+            uint32_t gap = items[i].base - items[i - 1].base;
+            bool used = false;
+            for (size_t j = 1; j < n; j++) {
+                used |= (cut_idx[j] == i);
+            }
+            if (!used && gap >= best_gap) {
+                best_gap = gap;
+                best = i;
+            }
+        }
+        cut_idx[n] = best;
+    }
+    // sort the few cut points so clusters are contiguous item spans
+    for (size_t n = 2; n < cluster_num; n++) {
+        size_t cut = cut_idx[n];
+        size_t j = n;
+        for (; j > 1 && cut_idx[j - 1] > cut; j--) {
+            cut_idx[j] = cut_idx[j - 1];
+        }
+        cut_idx[j] = cut;
+    }
+
+    uint32_t id_width_mask = filter_list->is_ext ? TWAI_EXT_ID_MASK : TWAI_STD_ID_MASK;
+    for (size_t n = 0; n < cluster_num; n++) {
+        size_t first = cut_idx[n];
+        size_t last = (n + 1 < cluster_num) ? cut_idx[n + 1] : item_num;
+        // the cluster filter may only check bits that every member checks and agrees on
+        uint32_t mask = UINT32_MAX;
+        uint32_t diff = 0;
+        for (size_t i = first; i < last; i++) {
+            mask &= items[i].mask;
+            diff |= items[i].base ^ items[first].base;
+        }
+        mask &= ~diff;
+        out_cfg[n] = (twai_mask_filter_config_t) {
+            .id = items[first].base & mask & id_width_mask,
+            .mask = mask & id_width_mask,
+            .is_ext = filter_list->is_ext,
+        };
+    }
+    free(items);
+    return cluster_num;
+}
+
 esp_err_t twai_node_enable(twai_node_handle_t node)
 {
     ESP_RETURN_ON_FALSE(node, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null handle");
@@ -101,6 +197,16 @@ esp_err_t twai_node_config_range_filter(twai_node_handle_t node, uint8_t filter_
     return node->config_range_filter(node, filter_id, range_cfg);
 }
 
+esp_err_t twai_node_config_id_filter(twai_node_handle_t node, const twai_id_filter_list_t *filter_list)
+{
+    ESP_RETURN_ON_FALSE(node && filter_list, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null");
+    ESP_RETURN_ON_FALSE(!filter_list->id_num || filter_list->id_list, ESP_ERR_INVALID_ARG, TAG, "id_list is null while id_num is not 0");
+    ESP_RETURN_ON_FALSE(!filter_list->range_num || filter_list->range_list, ESP_ERR_INVALID_ARG, TAG, "range_list is null while range_num is not 0");
+    ESP_RETURN_ON_FALSE(node->config_id_filter, ESP_ERR_NOT_SUPPORTED, TAG, "config_id_filter is not supported");
+
+    return node->config_id_filter(node, filter_list);
+}
+
 esp_err_t twai_node_reconfig_timing(twai_node_handle_t node, const twai_timing_advanced_config_t *bit_timing, const twai_timing_advanced_config_t *data_timing)
 {
     ESP_RETURN_ON_FALSE(node && (bit_timing || data_timing), ESP_ERR_INVALID_ARG, TAG, "invalid argument: null");
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <sys/param.h>
 #include "esp_twai.h"
 #include "esp_twai_onchip.h"
 #include "esp_private/twai_interface.h"
@@ -46,6 +47,20 @@ static void _twai_rcc_clock_sel(uint8_t ctrlr_id, twai_clock_source_t clock)
 
 #define TWAI_IDLE_EVENT_BIT BIT0    //event used for tx_wait_all_done
 
+/**
+ * @brief Residual software filter compiled from an ID filter list
+ *
+ * Holds the exact accepted set, checked in the RX ISR for frames the (possibly wider) hardware
+ * filters let through. Tables are sorted for binary search, storage follows the struct.
+ */
+typedef struct {
+    uint32_t *ids;              // sorted ascending
+    twai_id_range_t *ranges;    // merged to non-overlapping, sorted by id_low
+    uint16_t id_num;
+    uint16_t range_num;
+    bool is_ext;
+} twai_soft_filter_t;
+
 typedef struct {
     struct twai_node_base api_base;
     int ctrlr_id;
@@ -62,6 +77,7 @@ typedef struct {
     esp_pm_lock_handle_t pm_lock;
 #endif
 
+    twai_soft_filter_t *soft_filter;    //exact ID filtering for frames passing the hardware filters, NULL if not configured
     _Atomic twai_error_state_t state;
     twai_node_record_t history;
 
@@ -179,6 +195,43 @@ static void _node_start_trans(twai_onchip_ctx_t *node)
     twai_hal_set_tx_buffer_and_transmit(hal, &hal_buf, 0);
 }
 
+static bool _soft_filter_check(const twai_soft_filter_t *flt, const twai_hal_frame_t *frame)
+{
+    twai_frame_header_t header;
+    twai_hal_parse_frame(frame, &header, NULL, 0);  //header only, data stays in the hal frame
+    if (header.ide != flt->is_ext) {
+        return false;
+    }
+    // binary search the sorted single ID table
+    int lo = 0;
+    int hi = (int)flt->id_num - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (flt->ids[mid] == header.id) {
+            return true;
+        }
+        if (flt->ids[mid] < header.id) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    // find the last range starting at or below the ID, ranges are merged so only it can contain the ID
+    int candidate = -1;
+    lo = 0;
+    hi = (int)flt->range_num - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (flt->ranges[mid].id_low <= header.id) {
+            candidate = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return (candidate >= 0) && (header.id <= flt->ranges[candidate].id_high);
+}
+
 static void _node_isr_main(void *arg)
 {
     BaseType_t do_yield = pdFALSE;
@@ -244,6 +297,9 @@ static void _node_isr_main(void *arg)
                     continue;   // soft filter to check if id type match the filter config
                 }
 #endif
+                if (twai_ctx->soft_filter && !_soft_filter_check(twai_ctx->soft_filter, &twai_ctx->rcv_buff)) {
+                    continue;   // residual of the compiled ID filter, drop before notifying the app
+                }
                 if (twai_ctx->cbs.on_rx_done) {
                     atomic_store(&twai_ctx->rx_isr, true);  //todo: using compare_exchange to avoid intr from 2nd core
                     twai_rx_done_event_data_t rx_ev = {};
@@ -306,6 +362,7 @@ static void _node_destroy(twai_onchip_ctx_t *twai_ctx)
     if (twai_ctx->ctrlr_id != -1) {
         _ctrlr_release(twai_ctx->ctrlr_id);
     }
+    free(twai_ctx->soft_filter);
     free(twai_ctx);
 }
 
@@ -536,6 +593,122 @@ static esp_err_t _node_config_range_filter(twai_node_handle_t node, uint8_t filt
 }
 #endif
 
+static int _filter_id_cmp(const void *a, const void *b)
+{
+    uint32_t id_a = *(const uint32_t *)a;
+    uint32_t id_b = *(const uint32_t *)b;
+    return (id_a > id_b) - (id_a < id_b);
+}
+
+static int _filter_range_cmp(const void *a, const void *b)
+{
+    uint32_t low_a = ((const twai_id_range_t *)a)->id_low;
+    uint32_t low_b = ((const twai_id_range_t *)b)->id_low;
+    return (low_a > low_b) - (low_a < low_b);
+}
+
+static esp_err_t _node_config_id_filter(twai_node_handle_t node, const twai_id_filter_list_t *filter_list)
+{
+    esp_err_t ret = ESP_OK;
+    twai_onchip_ctx_t *twai_ctx = __containerof(node, twai_onchip_ctx_t, api_base);
+    ESP_RETURN_ON_FALSE(atomic_load(&twai_ctx->state) == TWAI_ERROR_BUS_OFF, ESP_ERR_INVALID_STATE, TAG, "filter config must do when node stopped");
+    uint32_t id_width_mask = filter_list->is_ext ? TWAI_EXT_ID_MASK : TWAI_STD_ID_MASK;
+    for (size_t i = 0; i < filter_list->id_num; i++) {
+        ESP_RETURN_ON_FALSE(!(filter_list->id_list[i] & ~id_width_mask), ESP_ERR_INVALID_ARG, TAG, "id %d wider than configured id type", (int)i);
+    }
+    for (size_t i = 0; i < filter_list->range_num; i++) {
+        ESP_RETURN_ON_FALSE((filter_list->range_list[i].id_low <= filter_list->range_list[i].id_high) && \
+                            !(filter_list->range_list[i].id_high & ~id_width_mask), ESP_ERR_INVALID_ARG, TAG, "range %d invalid or wider than configured id type", (int)i);
+    }
+
+    if (!filter_list->id_num && !filter_list->range_num) {
+        // empty list: drop the software filter and open the hardware again
+        twai_mask_filter_config_t open_cfg = {};    // mask 0 matches every ID
+        twai_hal_configure_mask_filter(twai_ctx->hal, 0, &open_cfg);
+        free(twai_ctx->soft_filter);
+        twai_ctx->soft_filter = NULL;
+        return ESP_OK;
+    }
+
+    // build the residual software filter: sorted single IDs plus sorted, merged ranges
+    twai_soft_filter_t *soft = heap_caps_calloc(1, sizeof(twai_soft_filter_t) + filter_list->id_num * sizeof(uint32_t) + \
+                                                filter_list->range_num * sizeof(twai_id_range_t), TWAI_MALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(soft, ESP_ERR_NO_MEM, TAG, "no mem for soft filter table");
+    soft->ids = (uint32_t *)(soft + 1);
+    soft->ranges = (twai_id_range_t *)(soft->ids + filter_list->id_num);
+    soft->is_ext = filter_list->is_ext;
+    soft->id_num = filter_list->id_num;
+    memcpy(soft->ids, filter_list->id_list, filter_list->id_num * sizeof(uint32_t));
+    qsort(soft->ids, soft->id_num, sizeof(uint32_t), _filter_id_cmp);
+    if (filter_list->range_num) {
+        memcpy(soft->ranges, filter_list->range_list, filter_list->range_num * sizeof(twai_id_range_t));
+        qsort(soft->ranges, filter_list->range_num, sizeof(twai_id_range_t), _filter_range_cmp);
+        size_t merged = 0;
+        for (size_t i = 1; i < filter_list->range_num; i++) {
+            if (soft->ranges[i].id_low <= soft->ranges[merged].id_high + 1) {
+                soft->ranges[merged].id_high = MAX(soft->ranges[merged].id_high, soft->ranges[i].id_high);
+            } else {
+                soft->ranges[++merged] = soft->ranges[i];
+            }
+        }
+        soft->range_num = merged + 1;
+    }
+
+    // hardware: exact ranges go to the hardware range filters first, the rest is compiled to mask filters
+    twai_id_filter_list_t residual = *filter_list;
+#if SOC_TWAI_RANGE_FILTER_NUM
+    size_t hw_range_num = MIN(residual.range_num, SOC_TWAI_RANGE_FILTER_NUM);
+    for (size_t i = 0; i < SOC_TWAI_RANGE_FILTER_NUM; i++) {
+        twai_range_filter_config_t range_cfg = (i < hw_range_num) ? (twai_range_filter_config_t) {
+            .range_low = residual.range_list[i].id_low,
+            .range_high = residual.range_list[i].id_high,
+            .is_ext = residual.is_ext,
+        } : (twai_range_filter_config_t) {
+            .range_low = 1,     // low above high closes the unused filter
+            .range_high = 0,
+        };
+        twai_hal_configure_range_filter(twai_ctx->hal, i, &range_cfg);
+    }
+    residual.range_list += hw_range_num;
+    residual.range_num -= hw_range_num;
+#endif
+
+    const twai_mask_filter_config_t closed_cfg = {
+        .id = UINT32_MAX,
+        .mask = UINT32_MAX,
+    };
+#if SOC_HAS(TWAI_FD)
+    twai_mask_filter_config_t mask_cfgs[SOC_TWAI_MASK_FILTER_NUM];
+    size_t used = twai_filter_compile_masks(&residual, mask_cfgs, SOC_TWAI_MASK_FILTER_NUM);
+    ESP_GOTO_ON_FALSE(used || !(residual.id_num + residual.range_num), ESP_ERR_NO_MEM, err, TAG, "no mem to compile filter");
+    for (size_t i = 0; i < SOC_TWAI_MASK_FILTER_NUM; i++) {
+        twai_hal_configure_mask_filter(twai_ctx->hal, i, (i < used) ? &mask_cfgs[i] : &closed_cfg);
+    }
+#else
+    // the classic IP has one mask filter, but its dual mode provides two half-width filters,
+    // compile for two and fall back to the precise single filter when one mask is enough
+    twai_mask_filter_config_t mask_cfgs[2];
+    size_t used = twai_filter_compile_masks(&residual, mask_cfgs, 2);
+    ESP_GOTO_ON_FALSE(used || !(residual.id_num + residual.range_num), ESP_ERR_NO_MEM, err, TAG, "no mem to compile filter");
+    twai_mask_filter_config_t single_cfg = closed_cfg;
+    if (used == 2) {
+        // for extended IDs dual mode only compares the high 16 bits, the accepted superset is caught by the soft filter
+        single_cfg = twai_make_dual_filter(mask_cfgs[0].id, mask_cfgs[0].mask, mask_cfgs[1].id, mask_cfgs[1].mask, residual.is_ext);
+    } else if (used == 1) {
+        single_cfg = mask_cfgs[0];
+    }
+    twai_hal_configure_mask_filter(twai_ctx->hal, 0, &single_cfg);
+#endif
+
+    free(twai_ctx->soft_filter);
+    twai_ctx->soft_filter = soft;
+    return ESP_OK;
+
+err:
+    free(soft);
+    return ret;
+}
+
 static esp_err_t _node_recover(twai_node_handle_t node)
 {
     twai_onchip_ctx_t *twai_ctx = __containerof(node, twai_onchip_ctx_t, api_base);
@@ -716,6 +889,7 @@ esp_err_t twai_new_node_onchip(const twai_onchip_node_config_t *node_config, twa
 #if SOC_TWAI_RANGE_FILTER_NUM
     node->api_base.config_range_filter = _node_config_range_filter;
 #endif
+    node->api_base.config_id_filter = _node_config_id_filter;
     node->api_base.reconfig_timing = _node_set_bit_timing;
     node->api_base.register_cbs = _node_register_callbacks;
     node->api_base.transmit = _node_queue_tx;
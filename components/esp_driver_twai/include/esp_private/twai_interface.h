@@ -67,6 +67,15 @@ struct twai_node_base {
      */
     esp_err_t (*config_range_filter)(struct twai_node_base *node, uint8_t filter_id, const twai_range_filter_config_t *range_cfg);
 
+    /**
+     * @brief Configure the acceptance filtering of the TWAI node from a list of IDs and ID ranges
+     *
+     * @param node Pointer to the TWAI node base
+     * @param filter_list Pointer to the list of accepted IDs and ID ranges
+     * @return ESP_OK on success, error code otherwise
+     */
+    esp_err_t (*config_id_filter)(struct twai_node_base *node, const twai_id_filter_list_t *filter_list);
+
     /**
      * @brief Reconfigure the timing parameters for the TWAI node
      *
@@ -41,6 +41,21 @@ typedef struct {
  */
 uint32_t twai_node_timing_calc_param(const uint32_t source_freq, const twai_timing_basic_config_t *in_param, const twai_timing_constraint_t *hw_limit, twai_timing_advanced_config_t *out_param);
 
+/**
+ * @brief Compile a list of accepted IDs and ID ranges into acceptance mask filter configurations.
+ *
+ * Each single ID becomes an exact match and each range becomes its common bit prefix. When the list holds more
+ * entries than `num_filters`, the entries are clustered by ID distance and each filter gets the tightest mask
+ * covering its cluster. The accepted set of the produced filters is always a superset of the input list, the
+ * caller is expected to filter the residual in software.
+ *
+ * @param filter_list Pointer to the list of accepted IDs and ID ranges.
+ * @param out_cfg Output array of at least `num_filters` mask filter configurations.
+ * @param num_filters Number of hardware mask filters available.
+ * @return the number of filter configurations written to `out_cfg`, 0 if the list is empty or on allocation failure.
+ */
+size_t twai_filter_compile_masks(const twai_id_filter_list_t *filter_list, twai_mask_filter_config_t *out_cfg, size_t num_filters);
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,6 +97,27 @@ esp_err_t twai_node_config_mask_filter(twai_node_handle_t node, uint8_t filter_i
  */
 esp_err_t twai_node_config_range_filter(twai_node_handle_t node, uint8_t filter_id, const twai_range_filter_config_t *range_cfg);
 
+/**
+ * @brief Configure the acceptance filtering of the TWAI node from a list of IDs and ID ranges
+ *
+ * This is a higher level alternative to `twai_node_config_mask_filter()` and `twai_node_config_range_filter()`:
+ * the driver compiles the list into the tightest configuration the hardware filters can express, and installs
+ * a software filter for the residual set, so that only the listed IDs ever reach the `on_rx_done` callback.
+ * Frames the hardware lets through but that are not in the list are dropped in the RX interrupt before any
+ * callback is invoked.
+ *
+ * @note Passing a list with both `id_num` and `range_num` equal to 0 removes the software filter and opens the
+ *       hardware filters again, i.e. all frames are received.
+ *
+ * @param node Handle to the TWAI node
+ * @param filter_list Pointer to the list of accepted IDs and ID ranges, copied by the driver
+ * @return  - ESP_OK: Success
+ *          - ESP_ERR_INVALID_ARG: Invalid argument, e.g. an ID wider than the configured ID type
+ *          - ESP_ERR_INVALID_STATE: Node not in disabled state
+ *          - ESP_ERR_NO_MEM: No memory for the software filter table
+ */
+esp_err_t twai_node_config_id_filter(twai_node_handle_t node, const twai_id_filter_list_t *filter_list);
+
 /**
  * @brief Get information about the TWAI node
  *
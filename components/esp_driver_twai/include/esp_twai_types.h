@@ -35,6 +35,30 @@ typedef struct {
     size_t buffer_len;              /**< buffer length of provided data buffer pointer, in bytes.*/
 } twai_frame_t;
 
+/**
+ * @brief Inclusive range of TWAI message IDs
+ */
+typedef struct {
+    uint32_t id_low;                /**< Lowest ID of the range, included */
+    uint32_t id_high;               /**< Highest ID of the range, included */
+} twai_id_range_t;
+
+/**
+ * @brief List of accepted TWAI message IDs and ID ranges
+ *
+ * Describes the exact set of IDs an application wants to receive, the driver compiles it into
+ * the hardware acceptance filters plus a residual software filter, see `twai_node_config_id_filter()`
+ */
+typedef struct {
+    const uint32_t *id_list;        /**< Array of accepted single IDs, can be NULL if id_num is 0 */
+    size_t id_num;                  /**< Number of IDs in id_list */
+    const twai_id_range_t *range_list;  /**< Array of accepted ID ranges, can be NULL if range_num is 0 */
+    size_t range_num;               /**< Number of ranges in range_list */
+    struct {
+        uint32_t is_ext: 1;         /**< True if the listed IDs are extended (29-bit), false for standard (11-bit) */
+    };
+} twai_id_filter_list_t;
+
 /**
  * @brief TWAI node's status
  */
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "driver/uhci_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief UART DMA driver handle type
+ */
+typedef struct uart_dma_t *uart_dma_handle_t;
+
+/**
+ * @brief UART DMA driver configuration
+ *
+ * The UART DMA driver is a blocking convenience layer over the UHCI controller: received
+ * data is written by the DMA directly into a caller supplied buffer and delivered as whole
+ * frames delimited by an idle line, without passing through the interrupt driven UART
+ * driver's FIFO threshold ISR and ringbuffer. The UART communication parameters (baud rate,
+ * pins, ...) must be configured through the standard UART APIs (`uart_param_config`,
+ * `uart_set_pin`) before installing this driver; do not install the regular UART driver
+ * (`uart_driver_install`) on the same port.
+ */
+typedef struct {
+    uart_port_t uart_port;            /*!< UART port that connects to the UHCI controller */
+    size_t tx_trans_queue_depth;      /*!< Depth of the internal transfer queue, 0 means a default is used */
+    size_t max_transmit_size;         /*!< Maximum transfer size of one transmission, in bytes, 0 means a default is used */
+    size_t max_receive_internal_mem;  /*!< Internal DMA usage memory for reception, in bytes, 0 means a default is used.
+                                           See `uhci_controller_config_t::max_receive_internal_mem` for sizing guidance. */
+    size_t dma_burst_size;            /*!< DMA burst size, in bytes. Set to 0 to disable data burst, otherwise use a power of 2 */
+} uart_dma_config_t;
+
+/**
+ * @brief Install the UART DMA driver on a UART port
+ *
+ * Internally this creates a UHCI controller bound to the given UART port, with the idle
+ * line as the receive frame boundary.
+ *
+ * @param[in] config Driver configuration
+ * @param[out] ret_handle Returned driver handle
+ * @return
+ *      - ESP_OK: Driver installed successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_NO_MEM: Out of memory
+ *      - Others: Creating the underlying UHCI controller failed
+ */
+esp_err_t uart_dma_driver_install(const uart_dma_config_t *config, uart_dma_handle_t *ret_handle);
+
+/**
+ * @brief Transmit data through the DMA and block until it is sent out
+ *
+ * @note The data is sent from `src` directly by the DMA, no copy is made. On
+ *       ESP_ERR_TIMEOUT the transmission keeps running in the background and `src`
+ *       must stay valid until it completes.
+ *
+ * @param[in] handle Driver handle allocated by `uart_dma_driver_install`
+ * @param[in] src Data to send
+ * @param[in] size Number of bytes to send
+ * @param[in] timeout_ms Timeout in milliseconds, `-1` means to wait forever
+ * @return
+ *      - ESP_OK: Data sent out completely
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_TIMEOUT: Transmission didn't finish within the timeout
+ */
+esp_err_t uart_dma_write_bytes(uart_dma_handle_t handle, const void *src, size_t size, int timeout_ms);
+
+/**
+ * @brief Receive one idle-line delimited frame into a caller supplied buffer
+ *
+ * The buffer is mounted to the receive DMA and the call blocks until the line goes idle
+ * after reception, so one call returns one frame regardless of its size. The frame is
+ * returned by reference: `*ret_data` points into `buf` (possibly offset to satisfy DMA
+ * alignment requirements) and no copy is made.
+ *
+ * @note On ESP_ERR_TIMEOUT the buffer stays mounted on the DMA and must remain valid;
+ *       call this function again with the same buffer to continue waiting for the frame.
+ *
+ * @param[in] handle Driver handle allocated by `uart_dma_driver_install`
+ * @param[in] buf Buffer the DMA writes into, sized for the largest expected frame
+ * @param[in] buf_size Size of `buf`, in bytes
+ * @param[out] ret_data Points to the start of the received frame inside `buf`
+ * @param[out] ret_size Number of bytes in the received frame
+ * @param[in] timeout_ms Timeout in milliseconds, `-1` means to wait forever
+ * @return
+ *      - ESP_OK: One frame received
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_INVALID_STATE: A receive is already in flight on a different buffer
+ *      - ESP_ERR_TIMEOUT: No frame completed within the timeout
+ */
+esp_err_t uart_dma_read_frame(uart_dma_handle_t handle, uint8_t *buf, size_t buf_size, uint8_t **ret_data, size_t *ret_size, int timeout_ms);
+
+/**
+ * @brief Delete the UART DMA driver and release its resources
+ *
+ * @param[in] handle Driver handle allocated by `uart_dma_driver_install`
+ * @return
+ *      - ESP_OK: Driver deleted successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_INVALID_STATE: A receive is still in flight
+ */
+esp_err_t uart_dma_driver_delete(uart_dma_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "driver/uhci.h"
+#include "driver/uart_dma.h"
+
+#define UART_DMA_DEFAULT_TRANS_QUEUE_DEPTH  4
+#define UART_DMA_DEFAULT_MAX_TRANSMIT_SIZE  4096
+#define UART_DMA_DEFAULT_RX_INTERNAL_MEM    4096
+
+static const char *TAG = "uart_dma";
+
+typedef struct uart_dma_t {
+    uhci_controller_handle_t uhci_ctrl; // underlying UHCI controller
+    SemaphoreHandle_t tx_mutex;         // serializes writers
+    SemaphoreHandle_t rx_mutex;         // serializes readers
+    SemaphoreHandle_t rx_done_sem;      // posted from the receive event callback when a frame completes
+    uint8_t *rx_frame_start;            // start of the frame inside the mounted buffer, alignment may offset it
+    size_t rx_accum;                    // bytes accumulated in the ongoing receive transaction
+    uint8_t *rx_pending_buf;            // buffer mounted on the receive DMA, NULL when no receive is in flight
+} uart_dma_t;
+
+static bool uart_dma_on_rx_event(uhci_controller_handle_t uhci_ctrl, const uhci_rx_event_data_t *edata, void *user_ctx)
+{
+    uart_dma_t *dma_uart = (uart_dma_t *)user_ctx;
+    BaseType_t task_woken = pdFALSE;
+    if (dma_uart->rx_accum == 0) {
+        dma_uart->rx_frame_start = edata->data;
+    }
+    dma_uart->rx_accum += edata->recv_size;
+    if (edata->flags.totally_received) {
+        xSemaphoreGiveFromISR(dma_uart->rx_done_sem, &task_woken);
+    }
+    return task_woken == pdTRUE;
+}
+
+esp_err_t uart_dma_driver_install(const uart_dma_config_t *config, uart_dma_handle_t *ret_handle)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && ret_handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    uart_dma_t *dma_uart = heap_caps_calloc(1, sizeof(uart_dma_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(dma_uart, ESP_ERR_NO_MEM, TAG, "no mem for uart_dma context");
+    dma_uart->tx_mutex = xSemaphoreCreateMutex();
+    dma_uart->rx_mutex = xSemaphoreCreateMutex();
+    dma_uart->rx_done_sem = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(dma_uart->tx_mutex && dma_uart->rx_mutex && dma_uart->rx_done_sem, ESP_ERR_NO_MEM, err, TAG, "no mem for synchronization primitives");
+
+    uhci_controller_config_t uhci_config = {
+        .uart_port = config->uart_port,
+        .tx_trans_queue_depth = config->tx_trans_queue_depth ? config->tx_trans_queue_depth : UART_DMA_DEFAULT_TRANS_QUEUE_DEPTH,
+        .max_transmit_size = config->max_transmit_size ? config->max_transmit_size : UART_DMA_DEFAULT_MAX_TRANSMIT_SIZE,
+        .max_receive_internal_mem = config->max_receive_internal_mem ? config->max_receive_internal_mem : UART_DMA_DEFAULT_RX_INTERNAL_MEM,
+        .dma_burst_size = config->dma_burst_size,
+        // the idle line is the frame boundary, so one receive transaction is one frame
+        .rx_eof_flags.idle_eof = 1,
+    };
+    ESP_GOTO_ON_ERROR(uhci_new_controller(&uhci_config, &dma_uart->uhci_ctrl), err, TAG, "create UHCI controller failed");
+
+    uhci_event_callbacks_t cbs = {
+        .on_rx_trans_event = uart_dma_on_rx_event,
+    };
+    ESP_GOTO_ON_ERROR(uhci_register_event_callbacks(dma_uart->uhci_ctrl, &cbs, dma_uart), err, TAG, "register UHCI callbacks failed");
+
+    *ret_handle = dma_uart;
+    return ESP_OK;
+err:
+    if (dma_uart->uhci_ctrl) {
+        uhci_del_controller(dma_uart->uhci_ctrl);
+    }
+    if (dma_uart->tx_mutex) {
+        vSemaphoreDelete(dma_uart->tx_mutex);
+    }
+    if (dma_uart->rx_mutex) {
+        vSemaphoreDelete(dma_uart->rx_mutex);
+    }
+    if (dma_uart->rx_done_sem) {
+        vSemaphoreDelete(dma_uart->rx_done_sem);
+    }
+    free(dma_uart);
+    return ret;
+}
+
+esp_err_t uart_dma_write_bytes(uart_dma_handle_t handle, const void *src, size_t size, int timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(handle && src && size, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    TickType_t ticks = timeout_ms < 0 ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTake(handle->tx_mutex, ticks) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    esp_err_t ret = uhci_transmit(handle->uhci_ctrl, (uint8_t *)src, size);
+    if (ret == ESP_OK) {
+        ret = uhci_wait_all_tx_transaction_done(handle->uhci_ctrl, timeout_ms);
+    }
+    xSemaphoreGive(handle->tx_mutex);
+    return ret;
+}
+
+esp_err_t uart_dma_read_frame(uart_dma_handle_t handle, uint8_t *buf, size_t buf_size, uint8_t **ret_data, size_t *ret_size, int timeout_ms)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(handle && buf && buf_size && ret_data && ret_size, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    TickType_t ticks = timeout_ms < 0 ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTake(handle->rx_mutex, ticks) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    if (handle->rx_pending_buf) {
+        // a previous read timed out with the DMA still owning the buffer; the wait can only
+        // be resumed with the same buffer, it can't be remounted while the receive is in flight
+        ESP_GOTO_ON_FALSE(buf == handle->rx_pending_buf, ESP_ERR_INVALID_STATE, err, TAG, "a receive is in flight on a different buffer");
+    } else {
+        handle->rx_accum = 0;
+        handle->rx_frame_start = NULL;
+        ESP_GOTO_ON_ERROR(uhci_receive(handle->uhci_ctrl, buf, buf_size), err, TAG, "mount receive buffer failed");
+        handle->rx_pending_buf = buf;
+    }
+
+    if (xSemaphoreTake(handle->rx_done_sem, ticks) != pdTRUE) {
+        // keep rx_pending_buf set, the DMA still owns the buffer
+        ret = ESP_ERR_TIMEOUT;
+        goto err;
+    }
+
+    *ret_data = handle->rx_frame_start;
+    *ret_size = handle->rx_accum;
+    handle->rx_pending_buf = NULL;
+err:
+    xSemaphoreGive(handle->rx_mutex);
+    return ret;
+}
+
+esp_err_t uart_dma_driver_delete(uart_dma_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!handle->rx_pending_buf, ESP_ERR_INVALID_STATE, TAG, "a receive is still in flight");
+    ESP_RETURN_ON_ERROR(uhci_del_controller(handle->uhci_ctrl), TAG, "delete UHCI controller failed");
+    vSemaphoreDelete(handle->tx_mutex);
+    vSemaphoreDelete(handle->rx_mutex);
+    vSemaphoreDelete(handle->rx_done_sem);
+    free(handle);
+    return ESP_OK;
+}
@@ -11,6 +11,7 @@
 #include <sys/lock.h>
 #include <sys/fcntl.h>
 #include <sys/param.h>
+#include <sys/uio.h>
 #include "sdkconfig.h"
 #include "esp_attr.h"
 #include "driver/uart_vfs.h"
@@ -223,17 +224,11 @@ static int uart_rx_char_via_driver(int fd)
     return c;
 }
 
-static ssize_t uart_write(int fd, const void * data, size_t size)
+/* Transmit one buffer with line ending translation; write_lock must be held */
+static void uart_tx_buffer(int fd, const char *data_c, size_t size)
 {
-    assert(fd >= 0 && fd < 3);
     tx_func_t tx_func = s_ctx[fd]->tx_func;
     esp_line_endings_t tx_mode = s_ctx[fd]->tx_mode;
-    const char *data_c = (const char *)data;
-    /*  Even though libc does stream locking on each individual stream, we need
-     *  a dedicated UART lock if two streams (stdout and stderr) point to the
-     *  same UART.
-     */
-    _lock_acquire_recursive(&s_ctx[fd]->write_lock);
     for (size_t i = 0; i < size; i++) {
         int c = data_c[i];
         if (c == '\n' && tx_mode != ESP_LINE_ENDINGS_LF) {
@@ -244,10 +239,37 @@ static ssize_t uart_write(int fd, const void * data, size_t size)
         }
         tx_func(fd, c);
     }
+}
+
+static ssize_t uart_write(int fd, const void * data, size_t size)
+{
+    assert(fd >= 0 && fd < 3);
+    /*  Even though libc does stream locking on each individual stream, we need
+     *  a dedicated UART lock if two streams (stdout and stderr) point to the
+     *  same UART.
+     */
+    _lock_acquire_recursive(&s_ctx[fd]->write_lock);
+    uart_tx_buffer(fd, (const char *)data, size);
     _lock_release_recursive(&s_ctx[fd]->write_lock);
     return size;
 }
 
+static ssize_t uart_writev(int fd, const struct iovec *iov, int iovcnt)
+{
+    assert(fd >= 0 && fd < 3);
+    ssize_t total = 0;
+    /* Take the UART lock once so that the whole vector is transmitted without
+     * interleaving with other streams pointing to the same UART.
+     */
+    _lock_acquire_recursive(&s_ctx[fd]->write_lock);
+    for (int i = 0; i < iovcnt; i++) {
+        uart_tx_buffer(fd, (const char *)iov[i].iov_base, iov[i].iov_len);
+        total += iov[i].iov_len;
+    }
+    _lock_release_recursive(&s_ctx[fd]->write_lock);
+    return total;
+}
+
 /* Helper function which returns a previous character or reads a new one from
  * UART. Previous character can be returned ("pushed back") using
  * uart_return_char function.
@@ -1077,6 +1099,7 @@ static const esp_vfs_termios_ops_t s_vfs_uart_termios = {
 
 static const esp_vfs_fs_ops_t s_vfs_uart = {
     .write = &uart_write,
+    .writev = &uart_writev,
     .open = &uart_open,
     .fstat = &uart_fstat,
     .close = &uart_close,
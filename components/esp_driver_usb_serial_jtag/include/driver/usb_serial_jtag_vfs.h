@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <stdint.h>
 #include "esp_err.h"
 #include "esp_vfs.h"
 #include "esp_vfs_common.h"
+#include "sdkconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -67,6 +69,28 @@ void usb_serial_jtag_vfs_use_driver(void);
  */
 void usb_serial_jtag_vfs_use_nonblocking(void);
 
+#if CONFIG_USJ_CONSOLE_LOSSY_RING
+/**
+ * @brief set VFS to buffer written data in a bounded lossy ring
+ * Read is non-blocking. Writes always complete at constant cost: data is queued in a
+ * RAM ring and flushed to the host opportunistically; when the ring is full the oldest
+ * bytes are dropped. This is the default when CONFIG_USJ_CONSOLE_LOSSY_RING is enabled;
+ * use this function to switch back after usb_serial_jtag_vfs_use_driver() or
+ * usb_serial_jtag_vfs_use_nonblocking().
+ */
+void usb_serial_jtag_vfs_use_lossy_ring(void);
+
+/**
+ * @brief get the number of bytes dropped by the lossy ring so far
+ *
+ * A non-zero delta between two reads means the host was not draining fast enough (or was
+ * detached long enough) for the backlog to exceed CONFIG_USJ_CONSOLE_LOSSY_RING_SIZE.
+ *
+ * @return total number of dropped bytes since boot
+ */
+uint32_t usb_serial_jtag_vfs_get_dropped_byte_count(void);
+#endif // CONFIG_USJ_CONSOLE_LOSSY_RING
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,18 @@ static void usb_serial_jtag_tx_char_no_driver(int fd, int c);
 static int usb_serial_jtag_rx_char_no_driver(int fd);
 static int usb_serial_jtag_wait_tx_done_no_driver(int fd);
 
+#if CONFIG_USJ_CONSOLE_LOSSY_RING
+// Lossy ring functions: writers never wait on the host, see usb_serial_jtag_tx_char_lossy()
+static void usb_serial_jtag_tx_char_lossy(int fd, int c);
+static int usb_serial_jtag_wait_tx_done_lossy(int fd);
+static bool usb_serial_jtag_tx_is_lossy(void);
+#else
+static inline bool usb_serial_jtag_tx_is_lossy(void)
+{
+    return false;
+}
+#endif
+
 //If no host is listening to the CDCACM port, the TX buffer
 //will never be able to flush to the host. Instead of the Tx
 //routines waiting forever, if the buffer hasn't been flushed
@@ -113,9 +125,14 @@ static usb_serial_jtag_vfs_context_t s_ctx = {
     .peek_char = NONE,
     .tx_mode = DEFAULT_TX_MODE,
     .rx_mode = DEFAULT_RX_MODE,
+#if CONFIG_USJ_CONSOLE_LOSSY_RING
+    .tx_func = usb_serial_jtag_tx_char_lossy,
+    .fsync_func = usb_serial_jtag_wait_tx_done_lossy,
+#else
     .tx_func = usb_serial_jtag_tx_char_no_driver,
+    .fsync_func = usb_serial_jtag_wait_tx_done_no_driver,
+#endif
     .rx_func = usb_serial_jtag_rx_char_no_driver,
-    .fsync_func = usb_serial_jtag_wait_tx_done_no_driver
 };
 
 #ifdef CONFIG_VFS_SUPPORT_SELECT
@@ -181,7 +198,9 @@ static int usb_serial_jtag_rx_char_no_driver(int fd)
 
 static ssize_t usb_serial_jtag_write(int fd, const void * data, size_t size)
 {
-    if (!usb_serial_jtag_is_connected()) {
+    // In lossy ring mode writes always succeed: output is buffered (or dropped)
+    // locally and flushed once a host attaches.
+    if (!usb_serial_jtag_is_connected() && !usb_serial_jtag_tx_is_lossy()) {
         // TODO: IDF-14303
         return -1;
     }
@@ -354,9 +373,103 @@ static int usb_serial_jtag_wait_tx_done_no_driver(int fd)
     return EIO;
 }
 
+#if CONFIG_USJ_CONSOLE_LOSSY_RING
+
+//Bounded ring holding pending console output. Writers always complete at constant
+//cost: bytes are queued here and only moved to the TX FIFO when it has room, so a
+//host that stopped draining (or was never attached) cannot stall logging tasks.
+//Head and tail are free-running counters; head is the write position, tail the
+//drain position.
+static uint8_t s_lossy_ring_buf[CONFIG_USJ_CONSOLE_LOSSY_RING_SIZE];
+static uint32_t s_lossy_ring_head;
+static uint32_t s_lossy_ring_tail;
+static uint32_t s_lossy_dropped_bytes;
+static portMUX_TYPE s_lossy_ring_lock = portMUX_INITIALIZER_UNLOCKED;
+
+//Move as much of the ring as the TX FIFO accepts. Called with s_lossy_ring_lock held.
+static void lossy_ring_drain(void)
+{
+    while (s_lossy_ring_tail != s_lossy_ring_head && usb_serial_jtag_ll_txfifo_writable()) {
+        uint8_t c = s_lossy_ring_buf[s_lossy_ring_tail % CONFIG_USJ_CONSOLE_LOSSY_RING_SIZE];
+        usb_serial_jtag_ll_write_txfifo(&c, 1);
+        s_lossy_ring_tail++;
+    }
+}
+
+static void usb_serial_jtag_tx_char_lossy(int fd, int c)
+{
+    uint8_t cc = (uint8_t)c;
+    portENTER_CRITICAL(&s_lossy_ring_lock);
+    if (s_lossy_ring_head - s_lossy_ring_tail >= CONFIG_USJ_CONSOLE_LOSSY_RING_SIZE) {
+        //Ring full: sacrifice the oldest byte so the most recent output survives.
+        s_lossy_ring_tail++;
+        s_lossy_dropped_bytes++;
+    }
+    s_lossy_ring_buf[s_lossy_ring_head % CONFIG_USJ_CONSOLE_LOSSY_RING_SIZE] = cc;
+    s_lossy_ring_head++;
+    //The connection monitor flips the status within a few ticks of the host
+    //(re)attaching, so the backlog accumulated while disconnected is flushed by
+    //the first write after reconnection.
+    if (usb_serial_jtag_is_connected()) {
+        lossy_ring_drain();
+        if (cc == '\n') {
+            //Make sure line doesn't linger in fifo
+            usb_serial_jtag_ll_txfifo_flush();
+        }
+    }
+    portEXIT_CRITICAL(&s_lossy_ring_lock);
+}
+
+static int usb_serial_jtag_wait_tx_done_lossy(int fd)
+{
+    //Best effort: drain for as long as the host keeps emptying the FIFO, but never
+    //wait on a host that stopped listening; leftover bytes simply stay in the ring.
+    int64_t last_progress_ts = esp_timer_get_time();
+    while (true) {
+        portENTER_CRITICAL(&s_lossy_ring_lock);
+        uint32_t pending_before = s_lossy_ring_head - s_lossy_ring_tail;
+        lossy_ring_drain();
+        uint32_t pending = s_lossy_ring_head - s_lossy_ring_tail;
+        portEXIT_CRITICAL(&s_lossy_ring_lock);
+        if (pending == 0) {
+            usb_serial_jtag_ll_txfifo_flush();
+            return 0;
+        }
+        if (pending != pending_before) {
+            last_progress_ts = esp_timer_get_time();
+        } else if (esp_timer_get_time() - last_progress_ts >= TX_FLUSH_TIMEOUT_US) {
+            //Host isn't draining; report success anyway since lossy mode never blocks on it.
+            return 0;
+        }
+    }
+}
+
+static bool usb_serial_jtag_tx_is_lossy(void)
+{
+    return s_ctx.tx_func == usb_serial_jtag_tx_char_lossy;
+}
+
+uint32_t usb_serial_jtag_vfs_get_dropped_byte_count(void)
+{
+    return s_lossy_dropped_bytes;
+}
+
+void usb_serial_jtag_vfs_use_lossy_ring(void)
+{
+    _lock_acquire_recursive(&s_ctx.read_lock);
+    _lock_acquire_recursive(&s_ctx.write_lock);
+    s_ctx.tx_func = usb_serial_jtag_tx_char_lossy;
+    s_ctx.rx_func = usb_serial_jtag_rx_char_no_driver;
+    s_ctx.fsync_func = usb_serial_jtag_wait_tx_done_lossy;
+    _lock_release_recursive(&s_ctx.write_lock);
+    _lock_release_recursive(&s_ctx.read_lock);
+}
+
+#endif // CONFIG_USJ_CONSOLE_LOSSY_RING
+
 static int usb_serial_jtag_fsync(int fd)
 {
-    if (!usb_serial_jtag_is_connected()) {
+    if (!usb_serial_jtag_is_connected() && !usb_serial_jtag_tx_is_lossy()) {
         // TODO: IDF-14303
         return -1;
     }
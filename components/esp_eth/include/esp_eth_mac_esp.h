@@ -141,6 +141,7 @@ typedef enum {
     ETH_MAC_ESP_CMD_G_PTP_TIME,                                             /*!< Get PTP time from the module */
     ETH_MAC_ESP_CMD_ADJ_PTP_FREQ,                                           /*!< Adjust current PTP time frequency increment by scale factor */
     ETH_MAC_ESP_CMD_ADJ_PTP_TIME,                                           /*!< Adjust base PTP time frequency increment by PPS */
+    ETH_MAC_ESP_CMD_ADJ_PTP_TIME_OFFSET,                                    /*!< Add signed offset to current PTP time atomically in hardware */
     ETH_MAC_ESP_CMD_S_TARGET_TIME,                                          /*!< Set Target Time at which interrupt is invoked when PTP time exceeds this value*/
     ETH_MAC_ESP_CMD_S_TARGET_CB,                                            /*!< Set pointer to a callback function invoked when PTP time exceeds Target Time */
     ETH_MAC_ESP_CMD_ENABLE_TS4ALL,                                          /*!< Enable timestamp for all received frames */
@@ -161,6 +162,20 @@ typedef enum {
  *          - FALSE no high priority task was woken by this function
  */
 typedef bool (*ts_target_exceed_cb_from_isr_t)(esp_eth_mediator_t *eth, void *user_args);
+
+/**
+ * @brief Signed PTP time offset used with `ETH_MAC_ESP_CMD_ADJ_PTP_TIME_OFFSET`
+ *
+ * The offset is added to (or subtracted from) the running PTP system time by the
+ * EMAC time stamp update logic, so a servo loop can apply a step correction
+ * without the read-modify window of a get/set time sequence.
+ *
+ * @warning Time stamping is currently Experimental Feature! Be aware that API may change.
+ */
+typedef struct {
+    bool negative;              /*!< true to subtract the offset from PTP time, false to add it */
+    eth_mac_time_t offset;      /*!< Magnitude of the time offset */
+} eth_mac_ptp_time_offset_t;
 #endif // SOC_EMAC_IEEE1588V2_SUPPORTED
 
 /**
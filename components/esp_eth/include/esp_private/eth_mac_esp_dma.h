@@ -12,6 +12,7 @@ extern "C" {
 #include <stdbool.h>
 #include "esp_err.h"
 #include "esp_eth_mac.h"
+#include "sdkconfig.h"
 
 /**
  * @brief Indicate to ::emac_esp_dma_receive_frame that receive frame buffer was allocated by ::emac_esp_dma_alloc_recv_buf
@@ -117,6 +118,28 @@ uint8_t *emac_esp_dma_alloc_recv_buf(emac_esp_dma_handle_t emac_esp_dma, uint32_
  */
 uint32_t emac_esp_dma_receive_frame(emac_esp_dma_handle_t emac_esp_dma, uint8_t *buf, uint32_t size, eth_mac_time_t *ts);
 
+#if CONFIG_ETH_DMA_RX_ZERO_COPY
+/**
+ * @brief Take the DMA buffer holding the next received Ethernet frame and replenish the descriptor.
+ *
+ * The returned buffer is detached from the Rx descriptor chain and a newly allocated DMA capable
+ * buffer is installed in its place, so no frame data is copied. The caller owns the returned
+ * buffer and releases it with free().
+ *
+ * @param[in] emac_esp_dma EMAC DMA handle
+ * @param[out] size size of the received Ethernet frame (FCS excluded)
+ * @param[out] ts time stamp at which the frame was received by EMAC. Only available on supported targets. Can be NULL
+ *                when time stamp is not required.
+ *
+ * @return - buffer holding the received Ethernet frame when success
+ *         - NULL with @p size set to 0 when there is no waiting Ethernet frame, on frame error, or when no
+ *         replacement buffer could be allocated (the frame is dropped in the latter two cases)
+ *         - NULL with @p size set to the frame length when the frame spans multiple descriptors and hence
+ *         cannot be detached; receive it with ::emac_esp_dma_receive_frame instead
+ */
+uint8_t *emac_esp_dma_take_recv_frame(emac_esp_dma_handle_t emac_esp_dma, uint32_t *size, eth_mac_time_t *ts);
+#endif // CONFIG_ETH_DMA_RX_ZERO_COPY
+
 /**
  * @brief Flush frame stored in Rx DMA
  *
@@ -409,6 +409,13 @@ esp_err_t emac_esp_custom_ioctl(esp_eth_mac_t *mac, int cmd, void *data)
         ESP_RETURN_ON_ERROR(emac_hal_ptp_adj_inc(&emac->hal, adj_ppb), TAG, "failed to adjust PTP time base");
         break;
     }
+    case ETH_MAC_ESP_CMD_ADJ_PTP_TIME_OFFSET: {
+        ESP_RETURN_ON_FALSE(data, ESP_ERR_INVALID_ARG, TAG, "PTP adjust time offset invalid argument, cant' be NULL");
+        eth_mac_ptp_time_offset_t *time_offset = (eth_mac_ptp_time_offset_t *)data;
+        ESP_RETURN_ON_ERROR(emac_hal_ptp_time_add(&emac->hal, time_offset->offset.seconds, time_offset->offset.nanoseconds,
+                                                  !time_offset->negative), TAG, "failed to adjust PTP time by offset");
+        break;
+    }
     case ETH_MAC_ESP_CMD_ADJ_PTP_FREQ: {
         ESP_RETURN_ON_FALSE(data, ESP_ERR_INVALID_ARG, TAG, "PTP adjust frequency invalid argument, cant' be NULL");
         double scale_factor = *((double *)data);
@@ -437,6 +444,7 @@ esp_err_t emac_esp_custom_ioctl(esp_eth_mac_t *mac, int cmd, void *data)
     case ETH_MAC_ESP_CMD_S_PTP_TIME:
     case ETH_MAC_ESP_CMD_G_PTP_TIME:
     case ETH_MAC_ESP_CMD_ADJ_PTP_TIME:
+    case ETH_MAC_ESP_CMD_ADJ_PTP_TIME_OFFSET:
     case ETH_MAC_ESP_CMD_ADJ_PTP_FREQ:
     case ETH_MAC_ESP_CMD_S_TARGET_CB:
     case ETH_MAC_ESP_CMD_S_TARGET_TIME:
@@ -520,17 +528,31 @@ static void emac_esp32_rx_task(void *arg)
         // block indefinitely until got notification from underlay event
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
         do {
+#ifdef SOC_EMAC_IEEE1588V2_SUPPORTED
+            eth_mac_time_t ts;
+            eth_mac_time_t *p_ts = &ts;
+#else
+            eth_mac_time_t *p_ts = NULL;
+#endif
+#if CONFIG_ETH_DMA_RX_ZERO_COPY
+            uint32_t frame_len = 0;
+            buffer = emac_esp_dma_take_recv_frame(emac->emac_dma_hndl, &frame_len, p_ts);
+            if (buffer != NULL) {
+                ESP_LOGD(TAG, "receive len= %" PRIu32, frame_len);
+                emac->eth->stack_input_info(emac->eth, buffer, frame_len, (void *)p_ts);
+            } else if (frame_len) {
+                /* cannot happen for valid frames since ETH_DMA_RX_ZERO_COPY requires the DMA buffer
+                   size to cover a full Ethernet frame */
+                ESP_LOGE(TAG, "received frame spans multiple DMA buffers, dropped");
+                /* ensures that interface to EMAC does not get stuck with unprocessed frames */
+                emac_esp_dma_flush_recv_frame(emac->emac_dma_hndl);
+            }
+#else
             /* set max expected frame len */
             uint32_t frame_len = ETH_MAX_PACKET_SIZE;
             buffer = emac_esp_dma_alloc_recv_buf(emac->emac_dma_hndl, &frame_len);
             /* we have memory to receive the frame of maximal size previously defined */
             if (buffer != NULL) {
-#ifdef SOC_EMAC_IEEE1588V2_SUPPORTED
-                eth_mac_time_t ts;
-                eth_mac_time_t *p_ts = &ts;
-#else
-                eth_mac_time_t *p_ts = NULL;
-#endif
                 uint32_t recv_len = emac_esp_dma_receive_frame(emac->emac_dma_hndl, buffer, EMAC_DMA_BUF_SIZE_AUTO, p_ts);
                 if (recv_len == 0) {
                     ESP_LOGE(TAG, "frame copy error");
@@ -550,6 +572,7 @@ static void emac_esp32_rx_task(void *arg)
                 /* ensures that interface to EMAC does not get stuck with unprocessed frames */
                 emac_esp_dma_flush_recv_frame(emac->emac_dma_hndl);
             }
+#endif // CONFIG_ETH_DMA_RX_ZERO_COPY
             emac_esp_dma_get_remain_frames(emac->emac_dma_hndl, &emac->frames_remain, &emac->free_rx_descriptor);
 #if CONFIG_ETH_SOFT_FLOW_CONTROL
             // we need to do extra checking of remained frames in case there are no unhandled frames left, but pause frame is still undergoing
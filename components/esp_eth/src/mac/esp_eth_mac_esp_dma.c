@@ -460,6 +460,61 @@ uint32_t emac_esp_dma_receive_frame(emac_esp_dma_handle_t emac_esp_dma, uint8_t
     return ret_len;
 }
 
+#if CONFIG_ETH_DMA_RX_ZERO_COPY
+uint8_t *emac_esp_dma_take_recv_frame(emac_esp_dma_handle_t emac_esp_dma, uint32_t *size, eth_mac_time_t *ts)
+{
+    uint32_t ret_len = 0;
+    *size = 0;
+
+    if (emac_esp_dma_get_valid_recv_len(emac_esp_dma, &ret_len) != ESP_OK) {
+        /* erroneous frame, it was flushed by emac_esp_dma_get_valid_recv_len already */
+        return NULL;
+    }
+    if (ret_len == 0) {
+        return NULL;
+    }
+    eth_dma_rx_descriptor_t *desc = emac_esp_dma->rx_desc;
+    DMA_CACHE_INVALIDATE(desc, EMAC_HAL_DMA_DESC_SIZE);
+    if (!(desc->RDES0.FirstDescriptor && desc->RDES0.LastDescriptor)) {
+        /* frame did not fit a single DMA buffer, it cannot be detached from the chain */
+        *size = ret_len;
+        return NULL;
+    }
+    uint8_t *new_buf = heap_caps_aligned_calloc(4, 1, CONFIG_ETH_DMA_BUFFER_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (new_buf == NULL) {
+        /* without a replacement buffer the descriptor cannot be given back to DMA, drop the frame */
+        ESP_LOGE(TAG, "no mem for replacement RX DMA buffer");
+        emac_esp_dma_flush_recv_frame(emac_esp_dma);
+        return NULL;
+    }
+    uint8_t *frame = (uint8_t *)desc->Buffer1Addr;
+    DMA_CACHE_INVALIDATE(frame, CONFIG_ETH_DMA_BUFFER_SIZE);
+#if SOC_EMAC_IEEE1588V2_SUPPORTED
+    if (ts != NULL) {
+        if (emac_hal_get_rxdesc_timestamp(&emac_esp_dma->hal, desc, &ts->seconds, &ts->nanoseconds) != ESP_OK) {
+            /* zeros indicate invalid time stamp since it is not possible to ever get "zero time" under normal conditions */
+            ts->seconds = 0;
+            ts->nanoseconds = 0;
+        }
+    }
+#endif
+    /* install the replacement buffer and return the descriptor to DMA. Rx descriptors start at the
+       base of the descriptors block, so the descriptor index also indexes the bookkeeping array */
+    uint32_t desc_idx = desc - (eth_dma_rx_descriptor_t *)emac_esp_dma->descriptors;
+    emac_esp_dma->rx_buf[desc_idx] = new_buf;
+    desc->Buffer1Addr = (uint32_t)new_buf;
+    desc->RDES0.Own = EMAC_LL_DMADESC_OWNER_DMA;
+    DMA_CACHE_WB(desc, EMAC_HAL_DMA_DESC_SIZE);
+    /* update rxdesc */
+    emac_esp_dma->rx_desc = (eth_dma_rx_descriptor_t *)(desc->Buffer2NextDescAddr);
+    /* poll rx demand */
+    emac_hal_receive_poll_demand(&emac_esp_dma->hal);
+
+    *size = ret_len;
+    return frame;
+}
+#endif // CONFIG_ETH_DMA_RX_ZERO_COPY
+
 void emac_esp_dma_flush_recv_frame(emac_esp_dma_handle_t emac_esp_dma)
 {
     eth_dma_rx_descriptor_t *desc_iter = emac_esp_dma->rx_desc;
@@ -43,6 +43,26 @@ esp_err_t esp_event_handler_instance_register(esp_event_base_t event_base,
                                                     context);
 }
 
+esp_err_t esp_event_handler_instance_register_affinity(esp_event_base_t event_base,
+                                                       int32_t event_id,
+                                                       esp_event_handler_t event_handler,
+                                                       void *event_handler_arg,
+                                                       int core_id,
+                                                       esp_event_handler_instance_t *context)
+{
+    if (s_default_loop == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    return esp_event_handler_instance_register_with_affinity(s_default_loop,
+                                                             event_base,
+                                                             event_id,
+                                                             event_handler,
+                                                             event_handler_arg,
+                                                             core_id,
+                                                             context);
+}
+
 esp_err_t esp_event_handler_unregister(esp_event_base_t event_base, int32_t event_id,
                                        esp_event_handler_t event_handler)
 {
@@ -89,6 +109,33 @@ esp_err_t esp_event_isr_post(esp_event_base_t event_base, int32_t event_id,
 }
 #endif
 
+esp_err_t esp_event_get_metrics(esp_event_loop_metrics_t* metrics)
+{
+    if (s_default_loop == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    return esp_event_loop_get_metrics(s_default_loop, metrics);
+}
+
+esp_err_t esp_event_get_handler_metrics(esp_event_handler_metrics_t* metrics, size_t num_entries, size_t* num_filled)
+{
+    if (s_default_loop == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    return esp_event_loop_get_handler_metrics(s_default_loop, metrics, num_entries, num_filled);
+}
+
+esp_err_t esp_event_reset_metrics(void)
+{
+    if (s_default_loop == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    return esp_event_loop_reset_metrics(s_default_loop);
+}
+
 esp_err_t esp_event_loop_create_default(void)
 {
     if (s_default_loop) {
@@ -14,11 +14,16 @@
 #include "esp_event.h"
 #include "esp_event_internal.h"
 #include "esp_event_private.h"
+#include "esp_task.h"
 
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
 #include "esp_timer.h"
 #endif
 
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+#include "esp_cpu.h"
+#endif
+
 /* ---------------------------- Definitions --------------------------------- */
 
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
@@ -34,6 +39,18 @@
                                         } while(0);
 #endif
 
+// Depth of a per-core worker queue. The dispatching task waits for the workers to drain
+// before finishing a post, so the queue only has to hold the affine handlers of one post.
+#define CORE_WORKER_QUEUE_LEN         8
+#define CORE_WORKER_TASK_STACK_SIZE   ESP_TASKD_EVENT_STACK
+
+/// Handler execution request sent to a per-core worker
+typedef struct {
+    esp_event_loop_instance_t* loop;                                /**< loop the post was fetched from */
+    esp_event_handler_node_t* handler;                              /**< handler to execute, stable while the post is dispatched */
+    esp_event_post_instance_t post;                                 /**< the post being dispatched */
+} esp_event_deferred_exec_t;
+
 /* ------------------------- Static Variables ------------------------------- */
 
 static const char* TAG = "event";
@@ -95,6 +112,117 @@ static int esp_event_dump_prepare(void)
 }
 #endif
 
+/* ------------------- Lock-free MPSC post ring ------------------------------
+ * Backs loops created with ESP_EVENT_LOOP_FLAG_LOCK_FREE_QUEUE. The ring is a
+ * bounded MPSC queue in the style of Vyukov's bounded queue: every slot carries
+ * a sequence number, producers claim a slot with a single CAS on the head
+ * cursor and the dedicated loop task consumes without any synchronization
+ * beyond an acquire load of the slot sequence.
+ */
+
+static esp_event_mpsc_ring_t* mpsc_ring_create(int32_t queue_size)
+{
+    size_t size = 2;
+    while (size < (size_t) queue_size) {
+        size <<= 1;
+    }
+
+    esp_event_mpsc_ring_t* ring = calloc(1, sizeof(*ring));
+    if (ring == NULL) {
+        return NULL;
+    }
+
+    ring->slots = calloc(size, sizeof(esp_event_mpsc_slot_t));
+    if (ring->slots == NULL) {
+        free(ring);
+        return NULL;
+    }
+
+    ring->size = size;
+    for (size_t i = 0; i < size; i++) {
+        atomic_init(&ring->slots[i].seq, i);
+    }
+    atomic_init(&ring->head, 0);
+    ring->tail = 0;
+
+    return ring;
+}
+
+static void mpsc_ring_delete(esp_event_mpsc_ring_t* ring)
+{
+    free(ring->slots);
+    free(ring);
+}
+
+// Multi-producer enqueue; lock-free, safe from tasks on both cores and from ISRs
+static bool mpsc_ring_send(esp_event_mpsc_ring_t* ring, const esp_event_post_instance_t* post)
+{
+    size_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    for (;;) {
+        esp_event_mpsc_slot_t* slot = &ring->slots[pos & (ring->size - 1)];
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t) seq - (intptr_t) pos;
+
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                slot->post = *post;
+                atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+                return true;
+            }
+        } else if (dif < 0) {
+            // The slot has not been consumed since the last lap: ring is full
+            return false;
+        } else {
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        }
+    }
+}
+
+// Single-consumer dequeue, must only be called from the dedicated loop task
+static bool mpsc_ring_recv(esp_event_mpsc_ring_t* ring, esp_event_post_instance_t* post)
+{
+    esp_event_mpsc_slot_t* slot = &ring->slots[ring->tail & (ring->size - 1)];
+    size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+
+    if ((intptr_t) seq - (intptr_t)(ring->tail + 1) < 0) {
+        // No producer has published to this slot yet: ring is empty
+        return false;
+    }
+
+    *post = slot->post;
+    atomic_store_explicit(&slot->seq, ring->tail + ring->size, memory_order_release);
+    ring->tail++;
+    return true;
+}
+
+// Fetch the next post of the loop from whichever backend it uses, blocking up to ticks_to_wait
+static BaseType_t loop_fetch_post(esp_event_loop_instance_t* loop, esp_event_post_instance_t* post, TickType_t ticks_to_wait)
+{
+    if (loop->mpsc == NULL) {
+        return xQueueReceive(loop->queue, post, ticks_to_wait);
+    }
+
+    TickType_t start = xTaskGetTickCount();
+
+    for (;;) {
+        if (mpsc_ring_recv(loop->mpsc, post)) {
+            return pdTRUE;
+        }
+
+        if (ticks_to_wait == portMAX_DELAY) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        } else {
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            if (elapsed >= ticks_to_wait) {
+                return pdFALSE;
+            }
+            ulTaskNotifyTake(pdTRUE, ticks_to_wait - elapsed);
+        }
+    }
+}
+
 static void esp_event_loop_run_task(void* args)
 {
     esp_err_t err;
@@ -120,6 +248,9 @@ static void handler_execute(esp_event_loop_instance_t* loop, esp_event_handler_n
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
     int64_t start, diff;
     start = esp_timer_get_time();
+#endif
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    uint32_t start_cycles = esp_cpu_get_cycle_count();
 #endif
     // Execute the handler
 #if CONFIG_ESP_EVENT_POST_FROM_ISR
@@ -144,9 +275,96 @@ static void handler_execute(esp_event_loop_instance_t* loop, esp_event_handler_n
     handler->invoked++;
     handler->time += diff;
 #endif
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    // unsigned subtraction stays correct across a cycle counter wrap-around
+    uint32_t delta_cycles = esp_cpu_get_cycle_count() - start_cycles;
+    handler->metrics_invoked++;
+    handler->metrics_cycles += delta_cycles;
+    if (delta_cycles > handler->metrics_cycles_max) {
+        handler->metrics_cycles_max = delta_cycles;
+    }
+#endif
+}
+
+static void esp_event_core_worker_task(void* args)
+{
+    QueueHandle_t queue = (QueueHandle_t) args;
+    esp_event_deferred_exec_t exec;
+
+    while (xQueueReceive(queue, &exec, portMAX_DELAY) == pdTRUE) {
+        handler_execute(exec.loop, exec.handler, exec.post);
+
+        if (atomic_fetch_sub(&exec.loop->deferred_pending, 1) == 1) {
+            xSemaphoreGive(exec.loop->deferred_done);
+        }
+    }
+}
+
+// Create the worker task and queue for the given core, if not created yet. Called with the loop mutex taken.
+static esp_err_t loop_core_worker_ensure(esp_event_loop_instance_t* loop, int core_id)
+{
+    esp_event_core_worker_t* worker = &loop->core_workers[core_id];
+
+    if (worker->task != NULL) {
+        return ESP_OK;
+    }
+
+    if (loop->deferred_done == NULL) {
+        loop->deferred_done = xSemaphoreCreateBinary();
+
+        if (loop->deferred_done == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    worker->queue = xQueueCreate(CORE_WORKER_QUEUE_LEN, sizeof(esp_event_deferred_exec_t));
+
+    if (worker->queue == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Match the priority of the task consuming the loop, so deferring a handler to the other
+    // core doesn't change its precedence relative to the rest of the loop's handlers.
+    UBaseType_t priority = uxTaskPriorityGet(loop->task != NULL ? loop->task : NULL);
+
+    char task_name[configMAX_TASK_NAME_LEN];
+    snprintf(task_name, sizeof(task_name), "evt_core%d", core_id);
+
+    BaseType_t task_created = xTaskCreatePinnedToCore(esp_event_core_worker_task, task_name, CORE_WORKER_TASK_STACK_SIZE,
+                                                      worker->queue, priority, &worker->task, core_id);
+
+    if (task_created != pdPASS) {
+        vQueueDelete(worker->queue);
+        worker->queue = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
 }
 
-static esp_err_t handler_instances_add(esp_event_handler_nodes_t* handlers, esp_event_handler_t event_handler, void* event_handler_arg, esp_event_handler_instance_context_t **handler_ctx, bool legacy)
+// Execute the handler in place, or forward it to the worker pinned to the handler's core.
+// Deferred executions are drained before the dispatching task finishes the post, so the
+// handler node and the post data stay valid for the worker.
+static void handler_dispatch(esp_event_loop_instance_t* loop, esp_event_handler_node_t *handler, esp_event_post_instance_t post)
+{
+    int core_id = handler->core_id;
+
+    if (core_id < 0 || core_id == xPortGetCoreID() || loop->core_workers[core_id].queue == NULL) {
+        handler_execute(loop, handler, post);
+        return;
+    }
+
+    esp_event_deferred_exec_t exec = {
+        .loop = loop,
+        .handler = handler,
+        .post = post
+    };
+
+    atomic_fetch_add(&loop->deferred_pending, 1);
+    xQueueSend(loop->core_workers[core_id].queue, &exec, portMAX_DELAY);
+}
+
+static esp_err_t handler_instances_add(esp_event_handler_nodes_t* handlers, esp_event_handler_t event_handler, void* event_handler_arg, int core_id, esp_event_handler_instance_context_t **handler_ctx, bool legacy)
 {
     esp_event_handler_node_t *handler_instance = calloc(1, sizeof(*handler_instance));
 
@@ -154,6 +372,8 @@ static esp_err_t handler_instances_add(esp_event_handler_nodes_t* handlers, esp_
         return ESP_ERR_NO_MEM;
     }
 
+    handler_instance->core_id = core_id;
+
     esp_event_handler_instance_context_t *context = calloc(1, sizeof(*context));
 
     if (!context) {
@@ -199,11 +419,12 @@ static esp_err_t base_node_add_handler(esp_event_base_node_t* base_node,
                                        int32_t id,
                                        esp_event_handler_t event_handler,
                                        void *event_handler_arg,
+                                       int core_id,
                                        esp_event_handler_instance_context_t **handler_ctx,
                                        bool legacy)
 {
     if (id == ESP_EVENT_ANY_ID) {
-        return handler_instances_add(&(base_node->handlers), event_handler, event_handler_arg, handler_ctx, legacy);
+        return handler_instances_add(&(base_node->handlers), event_handler, event_handler_arg, core_id, handler_ctx, legacy);
     } else {
         esp_err_t err = ESP_OK;
         esp_event_id_node_t *it = NULL, *id_node = NULL, *last_id_node = NULL;
@@ -227,7 +448,7 @@ static esp_err_t base_node_add_handler(esp_event_base_node_t* base_node,
 
             SLIST_INIT(&(id_node->handlers));
 
-            err = handler_instances_add(&(id_node->handlers), event_handler, event_handler_arg, handler_ctx, legacy);
+            err = handler_instances_add(&(id_node->handlers), event_handler, event_handler_arg, core_id, handler_ctx, legacy);
 
             if (err == ESP_OK) {
                 if (!last_id_node) {
@@ -241,7 +462,7 @@ static esp_err_t base_node_add_handler(esp_event_base_node_t* base_node,
 
             return err;
         } else {
-            return handler_instances_add(&(id_node->handlers), event_handler, event_handler_arg, handler_ctx, legacy);
+            return handler_instances_add(&(id_node->handlers), event_handler, event_handler_arg, core_id, handler_ctx, legacy);
         }
     }
 }
@@ -251,11 +472,12 @@ static esp_err_t loop_node_add_handler(esp_event_loop_node_t* loop_node,
                                        int32_t id,
                                        esp_event_handler_t event_handler,
                                        void *event_handler_arg,
+                                       int core_id,
                                        esp_event_handler_instance_context_t **handler_ctx,
                                        bool legacy)
 {
     if (base == esp_event_any_base && id == ESP_EVENT_ANY_ID) {
-        return handler_instances_add(&(loop_node->handlers), event_handler, event_handler_arg, handler_ctx, legacy);
+        return handler_instances_add(&(loop_node->handlers), event_handler, event_handler_arg, core_id, handler_ctx, legacy);
     } else {
         esp_err_t err = ESP_OK;
         esp_event_base_node_t *it = NULL, *base_node = NULL, *last_base_node = NULL;
@@ -283,7 +505,7 @@ static esp_err_t loop_node_add_handler(esp_event_loop_node_t* loop_node,
             SLIST_INIT(&(base_node->handlers));
             SLIST_INIT(&(base_node->id_nodes));
 
-            err = base_node_add_handler(base_node, id, event_handler, event_handler_arg, handler_ctx, legacy);
+            err = base_node_add_handler(base_node, id, event_handler, event_handler_arg, core_id, handler_ctx, legacy);
 
             if (err == ESP_OK) {
                 if (!last_base_node) {
@@ -297,7 +519,7 @@ static esp_err_t loop_node_add_handler(esp_event_loop_node_t* loop_node,
 
             return err;
         } else {
-            return base_node_add_handler(base_node, id, event_handler, event_handler_arg, handler_ctx, legacy);
+            return base_node_add_handler(base_node, id, event_handler, event_handler_arg, core_id, handler_ctx, legacy);
         }
     }
 }
@@ -558,10 +780,23 @@ esp_err_t esp_event_loop_create(const esp_event_loop_args_t* event_loop_args, es
         return err;
     }
 
-    loop->queue = xQueueCreate(event_loop_args->queue_size, sizeof(esp_event_post_instance_t));
-    if (loop->queue == NULL) {
-        ESP_LOGE(TAG, "create event loop queue failed");
-        goto on_err;
+    if (event_loop_args->flags & ESP_EVENT_LOOP_FLAG_LOCK_FREE_QUEUE) {
+        if (event_loop_args->task_name == NULL) {
+            ESP_LOGE(TAG, "lock-free queue requires a dedicated task for the loop");
+            err = ESP_ERR_INVALID_ARG;
+            goto on_err;
+        }
+        loop->mpsc = mpsc_ring_create(event_loop_args->queue_size);
+        if (loop->mpsc == NULL) {
+            ESP_LOGE(TAG, "create event loop post ring failed");
+            goto on_err;
+        }
+    } else {
+        loop->queue = xQueueCreate(event_loop_args->queue_size, sizeof(esp_event_post_instance_t));
+        if (loop->queue == NULL) {
+            ESP_LOGE(TAG, "create event loop queue failed");
+            goto on_err;
+        }
     }
 
     loop->mutex = xSemaphoreCreateRecursiveMutex();
@@ -611,6 +846,10 @@ on_err:
         vQueueDelete(loop->queue);
     }
 
+    if (loop->mpsc != NULL) {
+        mpsc_ring_delete(loop->mpsc);
+    }
+
     if (loop->mutex != NULL) {
         vSemaphoreDelete(loop->mutex);
     }
@@ -641,7 +880,7 @@ esp_err_t esp_event_loop_run(esp_event_loop_handle_t event_loop, TickType_t tick
     int64_t remaining_ticks = ticks_to_run;
 #endif
 
-    while (xQueueReceive(loop->queue, &post, remaining_ticks) == pdTRUE) {
+    while (loop_fetch_post(loop, &post, remaining_ticks) == pdTRUE) {
         // The event has already been unqueued, so ensure it gets executed.
         xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
 
@@ -673,7 +912,7 @@ esp_err_t esp_event_loop_run(esp_event_loop_handle_t event_loop, TickType_t tick
             // Execute loop level handlers
             SLIST_FOREACH_SAFE(handler, &(loop_node->handlers), next, temp_handler) {
                 if (!handler->unregistered) {
-                    handler_execute(loop, handler, post);
+                    handler_dispatch(loop, handler, post);
                     exec |= true;
                 }
             }
@@ -683,7 +922,7 @@ esp_err_t esp_event_loop_run(esp_event_loop_handle_t event_loop, TickType_t tick
                     // Execute base level handlers
                     SLIST_FOREACH_SAFE(handler, &(base_node->handlers), next, temp_handler) {
                         if (!handler->unregistered) {
-                            handler_execute(loop, handler, post);
+                            handler_dispatch(loop, handler, post);
                             exec |= true;
                         }
                     }
@@ -693,7 +932,7 @@ esp_err_t esp_event_loop_run(esp_event_loop_handle_t event_loop, TickType_t tick
                             // Execute id level handlers
                             SLIST_FOREACH_SAFE(handler, &(id_node->handlers), next, temp_handler) {
                                 if (!handler->unregistered) {
-                                    handler_execute(loop, handler, post);
+                                    handler_dispatch(loop, handler, post);
                                     exec |= true;
                                 }
                             }
@@ -705,6 +944,12 @@ esp_err_t esp_event_loop_run(esp_event_loop_handle_t event_loop, TickType_t tick
             }
         }
 
+        // Let the per-core workers finish the handlers deferred for this post before the
+        // post data is released and the handler nodes can be touched again
+        while (atomic_load(&loop->deferred_pending) != 0) {
+            xSemaphoreTake(loop->deferred_done, portMAX_DELAY);
+        }
+
         esp_event_base_t base = post.base;
         int32_t id = post.id;
 
@@ -756,6 +1001,19 @@ esp_err_t esp_event_loop_delete(esp_event_loop_handle_t event_loop)
         vTaskDelete(loop->task);
     }
 
+    // Delete the per-core workers; their queues are drained at the end of every post,
+    // so no handler execution can still be pending here
+    for (int core_id = 0; core_id < CONFIG_FREERTOS_NUMBER_OF_CORES; core_id++) {
+        if (loop->core_workers[core_id].task != NULL) {
+            vTaskDelete(loop->core_workers[core_id].task);
+            vQueueDelete(loop->core_workers[core_id].queue);
+        }
+    }
+
+    if (loop->deferred_done != NULL) {
+        vSemaphoreDelete(loop->deferred_done);
+    }
+
     // Remove all registered events and handlers in the loop
     esp_event_loop_node_t *it, *temp;
     SLIST_FOREACH_SAFE(it, &(loop->loop_nodes), next, temp) {
@@ -766,12 +1024,17 @@ esp_err_t esp_event_loop_delete(esp_event_loop_handle_t event_loop)
 
     // Drop existing posts on the queue
     esp_event_post_instance_t post;
-    while (xQueueReceive(loop->queue, &post, 0) == pdTRUE) {
-        post_instance_delete(&post);
+    if (loop->mpsc != NULL) {
+        while (mpsc_ring_recv(loop->mpsc, &post)) {
+            post_instance_delete(&post);
+        }
+        mpsc_ring_delete(loop->mpsc);
+    } else {
+        while (xQueueReceive(loop->queue, &post, 0) == pdTRUE) {
+            post_instance_delete(&post);
+        }
+        vQueueDelete(loop->queue);
     }
-
-    // Cleanup loop
-    vQueueDelete(loop->queue);
     free(loop);
     // Free loop mutex before deleting
     xSemaphoreGiveRecursive(loop_mutex);
@@ -782,7 +1045,7 @@ esp_err_t esp_event_loop_delete(esp_event_loop_handle_t event_loop)
 
 esp_err_t esp_event_handler_register_with_internal(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
                                                    int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg,
-                                                   esp_event_handler_instance_context_t** handler_ctx_arg, bool legacy)
+                                                   int core_id, esp_event_handler_instance_context_t** handler_ctx_arg, bool legacy)
 {
     assert(event_loop);
     assert(event_handler);
@@ -792,6 +1055,11 @@ esp_err_t esp_event_handler_register_with_internal(esp_event_loop_handle_t event
         return ESP_ERR_INVALID_ARG;
     }
 
+    if (core_id >= CONFIG_FREERTOS_NUMBER_OF_CORES) {
+        ESP_LOGE(TAG, "invalid handler core affinity %d", core_id);
+        return ESP_ERR_INVALID_ARG;
+    }
+
     esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
 
     if (event_base == ESP_EVENT_ANY_BASE) {
@@ -802,6 +1070,15 @@ esp_err_t esp_event_handler_register_with_internal(esp_event_loop_handle_t event
 
     xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
 
+    if (core_id >= 0) {
+        err = loop_core_worker_ensure(loop, core_id);
+
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "create worker for core %d failed", core_id);
+            goto on_err;
+        }
+    }
+
     esp_event_loop_node_t *loop_node = NULL, *last_loop_node = NULL;
 
     SLIST_FOREACH(loop_node, &(loop->loop_nodes), next) {
@@ -823,7 +1100,7 @@ esp_err_t esp_event_handler_register_with_internal(esp_event_loop_handle_t event
         SLIST_INIT(&(loop_node->handlers));
         SLIST_INIT(&(loop_node->base_nodes));
 
-        err = loop_node_add_handler(loop_node, event_base, event_id, event_handler, event_handler_arg, handler_ctx_arg, legacy);
+        err = loop_node_add_handler(loop_node, event_base, event_id, event_handler, event_handler_arg, core_id, handler_ctx_arg, legacy);
 
         if (err == ESP_OK) {
             if (!last_loop_node) {
@@ -835,7 +1112,7 @@ esp_err_t esp_event_handler_register_with_internal(esp_event_loop_handle_t event
             free(loop_node);
         }
     } else {
-        err = loop_node_add_handler(last_loop_node, event_base, event_id, event_handler, event_handler_arg, handler_ctx_arg, legacy);
+        err = loop_node_add_handler(last_loop_node, event_base, event_id, event_handler, event_handler_arg, core_id, handler_ctx_arg, legacy);
     }
 
 on_err:
@@ -846,14 +1123,21 @@ on_err:
 esp_err_t esp_event_handler_register_with(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
                                           int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg)
 {
-    return esp_event_handler_register_with_internal(event_loop, event_base, event_id, event_handler, event_handler_arg, NULL, true);
+    return esp_event_handler_register_with_internal(event_loop, event_base, event_id, event_handler, event_handler_arg, -1, NULL, true);
 }
 
 esp_err_t esp_event_handler_instance_register_with(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
                                                    int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg,
                                                    esp_event_handler_instance_t* handler_ctx_arg)
 {
-    return esp_event_handler_register_with_internal(event_loop, event_base, event_id, event_handler, event_handler_arg, (esp_event_handler_instance_context_t**) handler_ctx_arg, false);
+    return esp_event_handler_register_with_internal(event_loop, event_base, event_id, event_handler, event_handler_arg, -1, (esp_event_handler_instance_context_t**) handler_ctx_arg, false);
+}
+
+esp_err_t esp_event_handler_instance_register_with_affinity(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
+                                                            int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg,
+                                                            int core_id, esp_event_handler_instance_t* handler_ctx_arg)
+{
+    return esp_event_handler_register_with_internal(event_loop, event_base, event_id, event_handler, event_handler_arg, core_id, (esp_event_handler_instance_context_t**) handler_ctx_arg, false);
 }
 
 esp_err_t esp_event_handler_unregister_with_internal(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
@@ -909,6 +1193,27 @@ esp_err_t esp_event_handler_instance_unregister_with(esp_event_loop_handle_t eve
     return esp_event_handler_unregister_with_internal(event_loop, event_base, event_id, (esp_event_handler_instance_context_t*) handler_ctx_arg, false);
 }
 
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+// Track the deepest the loop's queue has ever been. The unlocked read-modify-write
+// is a benign race: a lost update can only under-report the mark by one sample.
+static void loop_metrics_update_queue_hwm(esp_event_loop_instance_t* loop, bool from_isr)
+{
+    uint32_t depth;
+
+    if (loop->mpsc != NULL) {
+        depth = (uint32_t)(atomic_load(&loop->mpsc->head) - loop->mpsc->tail);
+    } else if (from_isr) {
+        depth = uxQueueMessagesWaitingFromISR(loop->queue);
+    } else {
+        depth = uxQueueMessagesWaiting(loop->queue);
+    }
+
+    if (depth > loop->queue_high_watermark) {
+        loop->queue_high_watermark = depth;
+    }
+}
+#endif
+
 esp_err_t esp_event_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t event_base, int32_t event_id,
                             const void* event_data, size_t event_data_size, TickType_t ticks_to_wait)
 {
@@ -955,7 +1260,26 @@ esp_err_t esp_event_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t
 
     // Find the task that currently executes the loop. It is safe to query loop->task since it is
     // not mutated since loop creation. ENSURE THIS REMAINS TRUE.
-    if (loop->task == NULL) {
+    if (loop->mpsc != NULL) {
+        // Lock-free loop, always has a dedicated task. Publish with a CAS and notify the consumer;
+        // when the ring is full, retry until the timeout expires unless posting from the loop task
+        // itself (waiting there would deadlock the consumer).
+        TickType_t start = xTaskGetTickCount();
+
+        while ((result = mpsc_ring_send(loop->mpsc, &post) ? pdTRUE : pdFALSE) != pdTRUE) {
+            if (ticks_to_wait == 0 || loop->task == xTaskGetCurrentTaskHandle()) {
+                break;
+            }
+            if (ticks_to_wait != portMAX_DELAY && (xTaskGetTickCount() - start) >= ticks_to_wait) {
+                break;
+            }
+            vTaskDelay(1);
+        }
+
+        if (result == pdTRUE) {
+            xTaskNotifyGive(loop->task);
+        }
+    } else if (loop->task == NULL) {
         // The loop has no dedicated task. Find out what task is currently running it.
         result = xSemaphoreTakeRecursive(loop->mutex, ticks_to_wait);
 
@@ -982,6 +1306,9 @@ esp_err_t esp_event_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t
 
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
         atomic_fetch_add(&loop->events_dropped, 1);
+#endif
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+        atomic_fetch_add(&loop->posts_dropped, 1);
 #endif
         return ESP_ERR_TIMEOUT;
     }
@@ -989,6 +1316,9 @@ esp_err_t esp_event_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
     atomic_fetch_add(&loop->events_received, 1);
 #endif
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    loop_metrics_update_queue_hwm(loop, false);
+#endif
 
     return ESP_OK;
 }
@@ -1023,13 +1353,23 @@ esp_err_t esp_event_isr_post_to(esp_event_loop_handle_t event_loop, esp_event_ba
     BaseType_t result = pdFALSE;
 
     // Post the event from an ISR,
-    result = xQueueSendToBackFromISR(loop->queue, &post, task_unblocked);
+    if (loop->mpsc != NULL) {
+        result = mpsc_ring_send(loop->mpsc, &post) ? pdTRUE : pdFALSE;
+        if (result == pdTRUE) {
+            vTaskNotifyGiveFromISR(loop->task, task_unblocked);
+        }
+    } else {
+        result = xQueueSendToBackFromISR(loop->queue, &post, task_unblocked);
+    }
 
     if (result != pdTRUE) {
         post_instance_delete(&post);
 
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
         atomic_fetch_add(&loop->events_dropped, 1);
+#endif
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+        atomic_fetch_add(&loop->posts_dropped, 1);
 #endif
         return ESP_FAIL;
     }
@@ -1037,11 +1377,136 @@ esp_err_t esp_event_isr_post_to(esp_event_loop_handle_t event_loop, esp_event_ba
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
     atomic_fetch_add(&loop->events_received, 1);
 #endif
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    loop_metrics_update_queue_hwm(loop, true);
+#endif
 
     return ESP_OK;
 }
 #endif
 
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+// Walk every handler registration of the loop in registration list order,
+// reporting the base/id the handler was registered for. Called with the
+// loop mutex taken.
+typedef void (*loop_metrics_visit_fn_t)(esp_event_handler_node_t* handler, esp_event_base_t base, int32_t id, void* arg);
+
+static void loop_metrics_visit(esp_event_loop_instance_t* loop, loop_metrics_visit_fn_t fn, void* arg)
+{
+    esp_event_loop_node_t* loop_node_it;
+    esp_event_base_node_t* base_node_it;
+    esp_event_id_node_t* id_node_it;
+    esp_event_handler_node_t* handler_it;
+
+    SLIST_FOREACH(loop_node_it, &(loop->loop_nodes), next) {
+        SLIST_FOREACH(handler_it, &(loop_node_it->handlers), next) {
+            fn(handler_it, ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, arg);
+        }
+        SLIST_FOREACH(base_node_it, &(loop_node_it->base_nodes), next) {
+            SLIST_FOREACH(handler_it, &(base_node_it->handlers), next) {
+                fn(handler_it, base_node_it->base, ESP_EVENT_ANY_ID, arg);
+            }
+            SLIST_FOREACH(id_node_it, &(base_node_it->id_nodes), next) {
+                SLIST_FOREACH(handler_it, &(id_node_it->handlers), next) {
+                    fn(handler_it, base_node_it->base, id_node_it->id, arg);
+                }
+            }
+        }
+    }
+}
+
+typedef struct {
+    esp_event_handler_metrics_t* out;
+    size_t capacity;
+    size_t count;
+} loop_metrics_collect_ctx_t;
+
+static void loop_metrics_collect(esp_event_handler_node_t* handler, esp_event_base_t base, int32_t id, void* arg)
+{
+    loop_metrics_collect_ctx_t* ctx = (loop_metrics_collect_ctx_t*) arg;
+
+    if (ctx->count < ctx->capacity) {
+        esp_event_handler_metrics_t* entry = &ctx->out[ctx->count];
+        entry->handler = handler->handler_ctx->handler;
+        entry->event_base = base;
+        entry->event_id = id;
+        entry->invoked = handler->metrics_invoked;
+        entry->cycles = handler->metrics_cycles;
+        entry->cycles_max = handler->metrics_cycles_max;
+    }
+    ctx->count++;
+}
+
+static void loop_metrics_clear(esp_event_handler_node_t* handler, esp_event_base_t base, int32_t id, void* arg)
+{
+    handler->metrics_invoked = 0;
+    handler->metrics_cycles = 0;
+    handler->metrics_cycles_max = 0;
+}
+#endif // CONFIG_ESP_EVENT_LOOP_METRICS
+
+esp_err_t esp_event_loop_get_metrics(esp_event_loop_handle_t event_loop, esp_event_loop_metrics_t* metrics)
+{
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    if (event_loop == NULL || metrics == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
+    metrics->queue_high_watermark = loop->queue_high_watermark;
+    metrics->posts_dropped = atomic_load(&loop->posts_dropped);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t esp_event_loop_get_handler_metrics(esp_event_loop_handle_t event_loop, esp_event_handler_metrics_t* metrics,
+                                             size_t num_entries, size_t* num_filled)
+{
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    if (event_loop == NULL || num_filled == NULL || (metrics == NULL && num_entries != 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
+    loop_metrics_collect_ctx_t ctx = {
+        .out = metrics,
+        .capacity = num_entries,
+    };
+
+    xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
+    loop_metrics_visit(loop, loop_metrics_collect, &ctx);
+    xSemaphoreGiveRecursive(loop->mutex);
+
+    *num_filled = ctx.count;
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t esp_event_loop_reset_metrics(esp_event_loop_handle_t event_loop)
+{
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    if (event_loop == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
+
+    xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
+    loop_metrics_visit(loop, loop_metrics_clear, NULL);
+    loop->queue_high_watermark = 0;
+    atomic_store(&loop->posts_dropped, 0);
+    xSemaphoreGiveRecursive(loop->mutex);
+
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
 esp_err_t esp_event_dump(FILE* file)
 {
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
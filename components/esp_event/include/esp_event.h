@@ -18,6 +18,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Back the event loop with a lock-free MPSC ring instead of a FreeRTOS queue.
+ *
+ * Posting from tasks becomes a single atomic CAS plus a task notification, which removes
+ * the queue/mutex contention when many producers post to one loop at a high rate.
+ * Only valid for loops with a dedicated task (task_name != NULL); the ring size is
+ * rounded up to the next power of two.
+ */
+#define ESP_EVENT_LOOP_FLAG_LOCK_FREE_QUEUE     (1 << 0)
+
 /// Configuration for creating event loops
 typedef struct {
     int32_t queue_size;                         /**< size of the event loop queue */
@@ -27,6 +37,7 @@ typedef struct {
     uint32_t task_stack_size;                   /**< stack size of the event loop task, ignored if task name is NULL */
     BaseType_t task_core_id;                    /**< core to which the event loop task is pinned to,
                                                         ignored if task name is NULL */
+    uint32_t flags;                             /**< combination of ESP_EVENT_LOOP_FLAG_* options, 0 for default behavior */
 } esp_event_loop_args_t;
 
 /**
@@ -214,6 +225,41 @@ esp_err_t esp_event_handler_instance_register_with(esp_event_loop_handle_t event
                                                    void *event_handler_arg,
                                                    esp_event_handler_instance_t *instance);
 
+/**
+ * @brief Register an instance of event handler to a specific loop, with a core affinity.
+ *
+ * This function does the same as esp_event_handler_instance_register_with, except that the handler is
+ * executed on the given core instead of the core the loop is consumed on. The first registration with
+ * an affinity creates a worker task pinned to that core; the loop forwards matching events to the worker
+ * and waits for it before finishing the event, so the ordering guarantees of the loop are kept. This
+ * allows heavy handlers to be moved off the core running latency sensitive code (e.g. the core serving
+ * the network stack) while handlers without an affinity keep executing in place.
+ *
+ * @param[in] event_loop the event loop to register this handler function to, must not be NULL
+ * @param[in] event_base the base ID of the event to register the handler for
+ * @param[in] event_id the ID of the event to register the handler for
+ * @param[in] event_handler the handler function which gets called when the event is dispatched
+ * @param[in] event_handler_arg data, aside from event data, that is passed to the handler when it is called
+ * @param[in] core_id core the handler must execute on, or -1 to execute on the dispatching task's core
+ * @param[out] instance An event handler instance object related to the registered event handler and data, can be NULL
+ *
+ * @note the worker task is created with the priority of the task consuming the loop at the time of the
+ * first affine registration, and is deleted together with the loop
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_NO_MEM: Cannot allocate memory for the handler or the worker task
+ *  - ESP_ERR_INVALID_ARG: Invalid combination of event base and event ID, or core_id out of range
+ *  - Others: Fail
+ */
+esp_err_t esp_event_handler_instance_register_with_affinity(esp_event_loop_handle_t event_loop,
+                                                            esp_event_base_t event_base,
+                                                            int32_t event_id,
+                                                            esp_event_handler_t event_handler,
+                                                            void *event_handler_arg,
+                                                            int core_id,
+                                                            esp_event_handler_instance_t *instance);
+
 /**
  * @brief Register an instance of event handler to the default loop.
  *
@@ -248,6 +294,33 @@ esp_err_t esp_event_handler_instance_register(esp_event_base_t event_base,
                                               void *event_handler_arg,
                                               esp_event_handler_instance_t *instance);
 
+/**
+ * @brief Register an instance of event handler to the default loop, with a core affinity.
+ *
+ * This function does the same as esp_event_handler_instance_register_with_affinity, except that it
+ * registers the handler to the default event loop.
+ *
+ * @param[in] event_base the base ID of the event to register the handler for
+ * @param[in] event_id the ID of the event to register the handler for
+ * @param[in] event_handler the handler function which gets called when the event is dispatched
+ * @param[in] event_handler_arg data, aside from event data, that is passed to the handler when it is called
+ * @param[in] core_id core the handler must execute on, or -1 to execute on the dispatching task's core
+ * @param[out] instance An event handler instance object related to the registered event handler and data, can be NULL
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_NO_MEM: Cannot allocate memory for the handler or the worker task
+ *  - ESP_ERR_INVALID_ARG: Invalid combination of event base and event ID, or core_id out of range
+ *  - ESP_ERR_INVALID_STATE: The default event loop is not created
+ *  - Others: Fail
+ */
+esp_err_t esp_event_handler_instance_register_affinity(esp_event_base_t event_base,
+                                                       int32_t event_id,
+                                                       esp_event_handler_t event_handler,
+                                                       void *event_handler_arg,
+                                                       int core_id,
+                                                       esp_event_handler_instance_t *instance);
+
 /**
  * @brief Unregister a handler with the system event loop (legacy).
  *
@@ -455,6 +528,112 @@ esp_err_t esp_event_isr_post_to(esp_event_loop_handle_t event_loop,
                                 BaseType_t *task_unblocked);
 #endif
 
+/**
+ * @brief Aggregate metrics of one event loop
+ */
+typedef struct {
+    uint32_t queue_high_watermark; /**< Most events ever pending in the loop's queue at once */
+    uint32_t posts_dropped;        /**< Number of posts rejected because the queue was full */
+} esp_event_loop_metrics_t;
+
+/**
+ * @brief Metrics of one handler registration
+ */
+typedef struct {
+    esp_event_handler_t handler;   /**< The registered handler function */
+    esp_event_base_t event_base;   /**< Base the handler is registered for, ESP_EVENT_ANY_BASE for loop-level handlers */
+    int32_t event_id;              /**< ID the handler is registered for, ESP_EVENT_ANY_ID for base-level handlers */
+    uint32_t invoked;              /**< Number of times the handler has been invoked */
+    uint64_t cycles;               /**< Total CPU cycles spent in the handler */
+    uint32_t cycles_max;           /**< Longest single invocation, in CPU cycles */
+} esp_event_handler_metrics_t;
+
+/**
+ * @brief Read the aggregate metrics of an event loop
+ *
+ * @param[in] event_loop the event loop to query
+ * @param[out] metrics filled with the loop's metrics
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_INVALID_ARG: event_loop or metrics is NULL
+ *  - ESP_ERR_NOT_SUPPORTED: CONFIG_ESP_EVENT_LOOP_METRICS is disabled
+ */
+esp_err_t esp_event_loop_get_metrics(esp_event_loop_handle_t event_loop, esp_event_loop_metrics_t *metrics);
+
+/**
+ * @brief Read the per-registration metrics of an event loop
+ *
+ * Fills up to num_entries entries with the invocation count and cycle
+ * accounting of each handler registered to the loop, in registration list
+ * order. When the loop has more registrations than num_entries, the
+ * remaining ones are skipped but still counted in num_filled, so a caller
+ * can size a second query from the first one's result.
+ *
+ * @param[in] event_loop the event loop to query
+ * @param[out] metrics array of num_entries entries to fill, can be NULL when num_entries is 0
+ * @param[in] num_entries capacity of the metrics array
+ * @param[out] num_filled set to the total number of registrations on the loop
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_INVALID_ARG: event_loop or num_filled is NULL, or metrics is NULL while num_entries is not 0
+ *  - ESP_ERR_NOT_SUPPORTED: CONFIG_ESP_EVENT_LOOP_METRICS is disabled
+ */
+esp_err_t esp_event_loop_get_handler_metrics(esp_event_loop_handle_t event_loop, esp_event_handler_metrics_t *metrics,
+                                             size_t num_entries, size_t *num_filled);
+
+/**
+ * @brief Reset the metrics of an event loop
+ *
+ * Clears the loop's queue high-water mark and dropped-post counter together
+ * with every registration's invocation and cycle counters.
+ *
+ * @param[in] event_loop the event loop to reset
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_INVALID_ARG: event_loop is NULL
+ *  - ESP_ERR_NOT_SUPPORTED: CONFIG_ESP_EVENT_LOOP_METRICS is disabled
+ */
+esp_err_t esp_event_loop_reset_metrics(esp_event_loop_handle_t event_loop);
+
+/**
+ * @brief Read the aggregate metrics of the default event loop
+ *
+ * @param[out] metrics filled with the loop's metrics
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_INVALID_STATE: default event loop was not created
+ *  - Others: see esp_event_loop_get_metrics()
+ */
+esp_err_t esp_event_get_metrics(esp_event_loop_metrics_t *metrics);
+
+/**
+ * @brief Read the per-registration metrics of the default event loop
+ *
+ * @param[out] metrics array of num_entries entries to fill, can be NULL when num_entries is 0
+ * @param[in] num_entries capacity of the metrics array
+ * @param[out] num_filled set to the total number of registrations on the loop
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_INVALID_STATE: default event loop was not created
+ *  - Others: see esp_event_loop_get_handler_metrics()
+ */
+esp_err_t esp_event_get_handler_metrics(esp_event_handler_metrics_t *metrics, size_t num_entries, size_t *num_filled);
+
+/**
+ * @brief Reset the metrics of the default event loop
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_INVALID_STATE: default event loop was not created
+ *  - Others: see esp_event_loop_reset_metrics()
+ */
+esp_err_t esp_event_reset_metrics(void);
+
 /**
  * @brief Dumps statistics of all event loops.
  *
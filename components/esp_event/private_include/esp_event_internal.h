@@ -26,9 +26,16 @@ typedef struct esp_event_handler_context {
 /// Event handler
 typedef struct esp_event_handler_node {
     esp_event_handler_instance_context_t* handler_ctx;              /**< event handler context*/
+    int core_id;                                                    /**< core the handler must execute on,
+                                                                            -1 means the dispatching task's core */
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
     uint32_t invoked;                                               /**< number of times this handler has been invoked */
     int64_t time;                                                   /**< total runtime of this handler across all calls */
+#endif
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    uint32_t metrics_invoked;                                       /**< number of times this handler has been invoked */
+    uint64_t metrics_cycles;                                        /**< total CPU cycles spent in this handler */
+    uint32_t metrics_cycles_max;                                    /**< longest single invocation, in CPU cycles */
 #endif
     SLIST_ENTRY(esp_event_handler_node) next;                   /**< next event handler in the list */
     bool unregistered;
@@ -66,21 +73,36 @@ typedef struct esp_event_loop_node {
 
 typedef SLIST_HEAD(esp_event_loop_nodes, esp_event_loop_node) esp_event_loop_nodes_t;
 
+/// Per-core worker that executes handlers registered with a core affinity
+typedef struct esp_event_core_worker {
+    TaskHandle_t task;                                              /**< worker task pinned to the core */
+    QueueHandle_t queue;                                            /**< handler execution requests for this core */
+} esp_event_core_worker_t;
+
 /// Event loop
 typedef struct esp_event_loop_instance {
     const char* name;                                               /**< name of this event loop */
     QueueHandle_t queue;                                            /**< event queue */
+    struct esp_event_mpsc_ring* mpsc;                               /**< lock-free post ring, replaces queue when non-NULL */
     TaskHandle_t task;                                              /**< task that consumes the event queue */
     TaskHandle_t running_task;                                      /**< for loops with no dedicated task, the
                                                                             task that consumes the queue */
     SemaphoreHandle_t mutex;                                        /**< mutex for updating the events linked list */
     esp_event_loop_nodes_t loop_nodes;                              /**< set of linked lists containing the
                                                                             registered handlers for the loop */
+    esp_event_core_worker_t core_workers[CONFIG_FREERTOS_NUMBER_OF_CORES];  /**< lazily created workers for
+                                                                            handlers with a core affinity */
+    atomic_uint_least32_t deferred_pending;                         /**< handler executions currently queued on the workers */
+    SemaphoreHandle_t deferred_done;                                /**< signalled when deferred_pending drops to zero */
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
     atomic_uint_least32_t events_received;                          /**< number of events successfully posted to the loop */
     atomic_uint_least32_t events_dropped;                           /**< number of events dropped due to queue being full */
     SLIST_ENTRY(esp_event_loop_instance) next;                      /**< next event loop in the list */
 #endif
+#ifdef CONFIG_ESP_EVENT_LOOP_METRICS
+    uint32_t queue_high_watermark;                                  /**< most events ever pending in the queue at once */
+    atomic_uint_least32_t posts_dropped;                            /**< number of posts rejected because the queue was full */
+#endif
 } esp_event_loop_instance_t;
 
 typedef struct esp_event_remove_handler_context_t {
@@ -111,6 +133,20 @@ typedef struct esp_event_post_instance {
     esp_event_post_data_t data;                                      /**< data associated with the event */
 } esp_event_post_instance_t;
 
+/// Slot of the lock-free MPSC post ring, sequence numbers follow Vyukov's bounded queue scheme
+typedef struct esp_event_mpsc_slot {
+    atomic_size_t seq;                                               /**< slot sequence number, used to detect full/empty */
+    esp_event_post_instance_t post;                                  /**< posted event stored in this slot */
+} esp_event_mpsc_slot_t;
+
+/// Lock-free MPSC ring backing loops created with ESP_EVENT_LOOP_FLAG_LOCK_FREE_QUEUE
+typedef struct esp_event_mpsc_ring {
+    esp_event_mpsc_slot_t* slots;                                    /**< slot array, size entries */
+    size_t size;                                                     /**< number of slots, power of two */
+    atomic_size_t head;                                              /**< producer cursor, advanced with CAS */
+    size_t tail;                                                     /**< consumer cursor, only touched by the loop task */
+} esp_event_mpsc_ring_t;
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
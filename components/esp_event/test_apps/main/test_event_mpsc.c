@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+
+/* Tests for the lock-free MPSC ring backend of event loops
+ * (ESP_EVENT_LOOP_FLAG_LOCK_FREE_QUEUE), target-only like the other
+ * concurrency tests */
+
+#include <string.h>
+
+#include "esp_event.h"
+#include "esp_event_internal.h"
+#include "sdkconfig.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/gptimer.h"
+
+#include "unity.h"
+#include "unity_test_utils_memory.h"
+
+#define TEST_MPSC_QUEUE_SIZE        4       // already a power of two, so also the exact ring capacity
+#define TEST_MPSC_PRODUCER_TASKS    4
+#define TEST_MPSC_POSTS_PER_TASK    200
+
+/* Time used to wait for cleaning up memory in background tasks, matches test_event_target.c */
+#define TEST_CONFIG_TEARDOWN_WAIT   30
+
+static const char* s_mpsc_base = "mpsc_test_base";
+
+typedef struct {
+    int received;
+    int expected;
+    int next_value;
+    bool in_order;
+    SemaphoreHandle_t done;
+} mpsc_counter_arg_t;
+
+static esp_event_loop_args_t test_mpsc_loop_args(void)
+{
+    esp_event_loop_args_t loop_args = {
+        .queue_size = TEST_MPSC_QUEUE_SIZE,
+        .task_name = "mpsc_loop",
+        .task_priority = uxTaskPriorityGet(NULL),
+        .task_stack_size = 2560,
+        .task_core_id = 0,
+        .flags = ESP_EVENT_LOOP_FLAG_LOCK_FREE_QUEUE,
+    };
+    return loop_args;
+}
+
+static void test_mpsc_counting_handler(void* event_handler_arg, esp_event_base_t event_base, int32_t event_id, void* event_data)
+{
+    // Runs only in the loop's dedicated task, no locking needed
+    mpsc_counter_arg_t* arg = (mpsc_counter_arg_t*) event_handler_arg;
+    if (event_data != NULL) {
+        arg->in_order = arg->in_order && (*(int*) event_data == arg->next_value);
+        arg->next_value++;
+    }
+    arg->received++;
+    if (arg->received == arg->expected) {
+        xSemaphoreGive(arg->done);
+    }
+}
+
+TEST_CASE("lock-free loop requires a dedicated task", "[event][mpsc]")
+{
+    esp_event_loop_handle_t loop;
+    esp_event_loop_args_t loop_args = test_mpsc_loop_args();
+    loop_args.task_name = NULL;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, esp_event_loop_create(&loop_args, &loop));
+}
+
+TEST_CASE("lock-free loop delivers posts in order", "[event][mpsc]")
+{
+    esp_event_loop_handle_t loop;
+    esp_event_loop_args_t loop_args = test_mpsc_loop_args();
+    TEST_ESP_OK(esp_event_loop_create(&loop_args, &loop));
+
+    mpsc_counter_arg_t arg = {
+        .expected = 32,
+        .in_order = true,
+        .done = xSemaphoreCreateBinary(),
+    };
+    TEST_ESP_OK(esp_event_handler_register_with(loop, s_mpsc_base, 0, test_mpsc_counting_handler, &arg));
+
+    // A single producer's posts must come out in posting order
+    for (int i = 0; i < arg.expected; i++) {
+        TEST_ESP_OK(esp_event_post_to(loop, s_mpsc_base, 0, &i, sizeof(i), portMAX_DELAY));
+    }
+
+    TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(arg.done, pdMS_TO_TICKS(5000)));
+    TEST_ASSERT_EQUAL(arg.expected, arg.received);
+    TEST_ASSERT_TRUE(arg.in_order);
+
+    TEST_ESP_OK(esp_event_loop_delete(loop));
+    vSemaphoreDelete(arg.done);
+
+    vTaskDelay(pdMS_TO_TICKS(TEST_CONFIG_TEARDOWN_WAIT));
+}
+
+typedef struct {
+    esp_event_loop_handle_t loop;
+    SemaphoreHandle_t done;
+} mpsc_producer_arg_t;
+
+static void test_mpsc_producer_task(void* varg)
+{
+    mpsc_producer_arg_t* arg = (mpsc_producer_arg_t*) varg;
+    for (int i = 0; i < TEST_MPSC_POSTS_PER_TASK; i++) {
+        TEST_ESP_OK(esp_event_post_to(arg->loop, s_mpsc_base, 0, NULL, 0, portMAX_DELAY));
+    }
+    xSemaphoreGive(arg->done);
+    vTaskDelete(NULL);
+}
+
+TEST_CASE("lock-free loop loses no posts with producers on both cores", "[event][mpsc]")
+{
+    esp_event_loop_handle_t loop;
+    esp_event_loop_args_t loop_args = test_mpsc_loop_args();
+    TEST_ESP_OK(esp_event_loop_create(&loop_args, &loop));
+
+    mpsc_counter_arg_t arg = {
+        .expected = TEST_MPSC_PRODUCER_TASKS * TEST_MPSC_POSTS_PER_TASK,
+        .done = xSemaphoreCreateBinary(),
+    };
+    TEST_ESP_OK(esp_event_handler_register_with(loop, s_mpsc_base, 0, test_mpsc_counting_handler, &arg));
+
+    mpsc_producer_arg_t producer_arg = {
+        .loop = loop,
+        .done = xSemaphoreCreateCounting(TEST_MPSC_PRODUCER_TASKS, 0),
+    };
+    for (int i = 0; i < TEST_MPSC_PRODUCER_TASKS; i++) {
+        TEST_ASSERT_EQUAL(pdTRUE, xTaskCreatePinnedToCore(test_mpsc_producer_task, "mpsc_prod", 2560,
+                                                          &producer_arg, uxTaskPriorityGet(NULL),
+                                                          NULL, i % CONFIG_FREERTOS_NUMBER_OF_CORES));
+    }
+
+    for (int i = 0; i < TEST_MPSC_PRODUCER_TASKS; i++) {
+        TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(producer_arg.done, pdMS_TO_TICKS(10000)));
+    }
+    TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(arg.done, pdMS_TO_TICKS(10000)));
+    TEST_ASSERT_EQUAL(arg.expected, arg.received);
+
+    TEST_ESP_OK(esp_event_loop_delete(loop));
+    vSemaphoreDelete(arg.done);
+    vSemaphoreDelete(producer_arg.done);
+
+    vTaskDelay(pdMS_TO_TICKS(TEST_CONFIG_TEARDOWN_WAIT));
+}
+
+TEST_CASE("lock-free loop post times out when the ring is full", "[event][mpsc]")
+{
+    esp_event_loop_handle_t loop;
+    esp_event_loop_args_t loop_args = test_mpsc_loop_args();
+    TEST_ESP_OK(esp_event_loop_create(&loop_args, &loop));
+
+    // Keep the consumer off the ring so it fills deterministically
+    esp_event_loop_instance_t* loop_def = (esp_event_loop_instance_t*) loop;
+    vTaskSuspend(loop_def->task);
+
+    mpsc_counter_arg_t arg = {
+        .expected = TEST_MPSC_QUEUE_SIZE,
+        .done = xSemaphoreCreateBinary(),
+    };
+    TEST_ESP_OK(esp_event_handler_register_with(loop, s_mpsc_base, 0, test_mpsc_counting_handler, &arg));
+
+    for (int i = 0; i < TEST_MPSC_QUEUE_SIZE; i++) {
+        TEST_ESP_OK(esp_event_post_to(loop, s_mpsc_base, 0, NULL, 0, 0));
+    }
+
+    // Full: an immediate post fails right away, a timed post backs off
+    // retrying until the timeout expires
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, esp_event_post_to(loop, s_mpsc_base, 0, NULL, 0, 0));
+
+    const TickType_t timeout_ticks = pdMS_TO_TICKS(100);
+    TickType_t start = xTaskGetTickCount();
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, esp_event_post_to(loop, s_mpsc_base, 0, NULL, 0, timeout_ticks));
+    TEST_ASSERT_GREATER_OR_EQUAL(timeout_ticks, xTaskGetTickCount() - start);
+
+    // Resuming the consumer drains the ring completely
+    vTaskResume(loop_def->task);
+    TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(arg.done, pdMS_TO_TICKS(5000)));
+    TEST_ASSERT_EQUAL(TEST_MPSC_QUEUE_SIZE, arg.received);
+
+    TEST_ESP_OK(esp_event_loop_delete(loop));
+    vSemaphoreDelete(arg.done);
+
+    vTaskDelay(pdMS_TO_TICKS(TEST_CONFIG_TEARDOWN_WAIT));
+}
+
+TEST_CASE("deleting a lock-free loop drains undelivered posts", "[event][mpsc]")
+{
+    esp_event_loop_handle_t loop;
+    esp_event_loop_args_t loop_args = test_mpsc_loop_args();
+    TEST_ESP_OK(esp_event_loop_create(&loop_args, &loop));
+
+    // Park the consumer, then leave allocated event data in the ring: the
+    // delete path has to free it (checked by the leak check in tearDown)
+    esp_event_loop_instance_t* loop_def = (esp_event_loop_instance_t*) loop;
+    vTaskSuspend(loop_def->task);
+
+    uint8_t big_payload[16] = {0};
+    for (int i = 0; i < 3; i++) {
+        TEST_ESP_OK(esp_event_post_to(loop, s_mpsc_base, 0, big_payload, sizeof(big_payload), 0));
+    }
+
+    TEST_ESP_OK(esp_event_loop_delete(loop));
+
+    vTaskDelay(pdMS_TO_TICKS(TEST_CONFIG_TEARDOWN_WAIT));
+}
+
+#if CONFIG_ESP_EVENT_POST_FROM_ISR
+static bool test_mpsc_on_timer_alarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_ctx)
+{
+    mpsc_producer_arg_t* arg = (mpsc_producer_arg_t*) user_ctx;
+    gptimer_stop(timer);
+    BaseType_t task_unblocked = pdFALSE;
+    TEST_ESP_OK(esp_event_isr_post_to(arg->loop, s_mpsc_base, 0, NULL, 0, &task_unblocked));
+    return task_unblocked == pdTRUE;
+}
+
+TEST_CASE("lock-free loop accepts posts from an interrupt handler", "[event][mpsc][intr]")
+{
+    /* Lazy allocated resources in gptimer/intr_alloc */
+    unity_utils_set_leak_level(160);
+
+    esp_event_loop_handle_t loop;
+    esp_event_loop_args_t loop_args = test_mpsc_loop_args();
+    TEST_ESP_OK(esp_event_loop_create(&loop_args, &loop));
+
+    mpsc_counter_arg_t arg = {
+        .expected = 1,
+        .done = xSemaphoreCreateBinary(),
+    };
+    TEST_ESP_OK(esp_event_handler_register_with(loop, s_mpsc_base, 0, test_mpsc_counting_handler, &arg));
+
+    mpsc_producer_arg_t isr_arg = {
+        .loop = loop,
+    };
+    gptimer_handle_t gptimer = NULL;
+    gptimer_config_t config = {
+        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = 1000000, // 1MHz, 1 tick = 1us
+    };
+    TEST_ESP_OK(gptimer_new_timer(&config, &gptimer));
+
+    gptimer_alarm_config_t alarm_config = {
+        .reload_count = 0,
+        .alarm_count = 100000,
+    };
+    gptimer_event_callbacks_t cbs = {
+        .on_alarm = test_mpsc_on_timer_alarm
+    };
+    TEST_ESP_OK(gptimer_register_event_callbacks(gptimer, &cbs, &isr_arg));
+    TEST_ESP_OK(gptimer_set_alarm_action(gptimer, &alarm_config));
+    TEST_ESP_OK(gptimer_enable(gptimer));
+    TEST_ESP_OK(gptimer_start(gptimer));
+
+    TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(arg.done, pdMS_TO_TICKS(5000)));
+    TEST_ASSERT_EQUAL(1, arg.received);
+
+    TEST_ESP_OK(gptimer_disable(gptimer));
+    TEST_ESP_OK(gptimer_del_timer(gptimer));
+    TEST_ESP_OK(esp_event_loop_delete(loop));
+    vSemaphoreDelete(arg.done);
+
+    vTaskDelay(pdMS_TO_TICKS(TEST_CONFIG_TEARDOWN_WAIT));
+}
+#endif // CONFIG_ESP_EVENT_POST_FROM_ISR
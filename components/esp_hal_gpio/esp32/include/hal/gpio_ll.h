@@ -505,6 +505,38 @@ static inline void gpio_ll_set_level(gpio_dev_t *hw, uint32_t gpio_num, uint32_t
     }
 }
 
+/**
+ * @brief  Set the output level of multiple GPIOs in the same bank with one register write
+ *
+ * @param  hw Peripheral GPIO hardware instance address.
+ * @param  bank_id Bank id of the GPIOs, each bank covers 32 GPIOs (bank 0: GPIO0 ~ GPIO31, bank 1: GPIO32 and above)
+ * @param  mask Bit mask of the GPIOs inside the bank to drive high
+ */
+static inline void gpio_ll_set_output_bits(gpio_dev_t *hw, uint32_t bank_id, uint32_t mask)
+{
+    if (bank_id == 0) {
+        hw->out_w1ts = mask;
+    } else {
+        hw->out1_w1ts.val = mask;
+    }
+}
+
+/**
+ * @brief  Clear the output level of multiple GPIOs in the same bank with one register write
+ *
+ * @param  hw Peripheral GPIO hardware instance address.
+ * @param  bank_id Bank id of the GPIOs, each bank covers 32 GPIOs (bank 0: GPIO0 ~ GPIO31, bank 1: GPIO32 and above)
+ * @param  mask Bit mask of the GPIOs inside the bank to drive low
+ */
+static inline void gpio_ll_clear_output_bits(gpio_dev_t *hw, uint32_t bank_id, uint32_t mask)
+{
+    if (bank_id == 0) {
+        hw->out_w1tc = mask;
+    } else {
+        hw->out1_w1tc.val = mask;
+    }
+}
+
 /**
  * @brief  GPIO get input level
  *
@@ -319,6 +319,32 @@ static inline void gpio_ll_set_level(gpio_dev_t *hw, uint32_t gpio_num, uint32_t
     }
 }
 
+/**
+ * @brief  Set the output level of multiple GPIOs in the same bank with one register write
+ *
+ * @param  hw Peripheral GPIO hardware instance address.
+ * @param  bank_id Bank id of the GPIOs, must be 0 on this target
+ * @param  mask Bit mask of the GPIOs inside the bank to drive high
+ */
+static inline void gpio_ll_set_output_bits(gpio_dev_t *hw, uint32_t bank_id, uint32_t mask)
+{
+    (void)bank_id; // only one GPIO bank on this target
+    hw->out_w1ts.val = mask;
+}
+
+/**
+ * @brief  Clear the output level of multiple GPIOs in the same bank with one register write
+ *
+ * @param  hw Peripheral GPIO hardware instance address.
+ * @param  bank_id Bank id of the GPIOs, must be 0 on this target
+ * @param  mask Bit mask of the GPIOs inside the bank to drive low
+ */
+static inline void gpio_ll_clear_output_bits(gpio_dev_t *hw, uint32_t bank_id, uint32_t mask)
+{
+    (void)bank_id; // only one GPIO bank on this target
+    hw->out_w1tc.val = mask;
+}
+
 /**
  * @brief  GPIO get input level
  *
@@ -93,6 +93,19 @@ extern "C" {
         },                                                                              \
     }[group][event]
 
+// MCPWM ETM operator task table
+#define MCPWM_LL_ETM_OPERATOR_TASK_TABLE(group, oper_id, task)              \
+    (uint32_t[2][MCPWM_OPER_ETM_TASK_MAX]){                                 \
+        {                                                                   \
+            [MCPWM_OPER_ETM_TASK_TZ_OST] = MCPWM0_TASK_TZ0_OST + oper_id,   \
+            [MCPWM_OPER_ETM_TASK_CLR_OST] = MCPWM0_TASK_CLR0_OST + oper_id, \
+        },                                                                  \
+        {                                                                   \
+            [MCPWM_OPER_ETM_TASK_TZ_OST] = MCPWM1_TASK_TZ0_OST + oper_id,   \
+            [MCPWM_OPER_ETM_TASK_CLR_OST] = MCPWM1_TASK_CLR0_OST + oper_id, \
+        },                                                                  \
+    }[group][task]
+
 /**
  * @brief The dead time module's clock source
  */
@@ -1758,6 +1771,31 @@ static inline void mcpwm_ll_etm_enable_evt_comparator_event(mcpwm_dev_t *mcpwm,
     }
 }
 
+/**
+ * @brief Enable operator ETM task
+ *
+ * @param mcpwm Peripheral instance address
+ * @param operator_id Operator ID, index from 0 to 2
+ * @param task Operator ETM task type
+ * @param en True: enable ETM module, False: disable ETM module
+ */
+static inline void mcpwm_ll_etm_enable_operator_task(mcpwm_dev_t *mcpwm, int operator_id, mcpwm_operator_etm_task_type_t task, bool en)
+{
+    if (en) {
+        if (task == MCPWM_OPER_ETM_TASK_TZ_OST) {
+            mcpwm->task_en.val |= 1 << (operator_id + 13);
+        } else {
+            mcpwm->task_en.val |= 1 << (operator_id + 16);
+        }
+    } else {
+        if (task == MCPWM_OPER_ETM_TASK_TZ_OST) {
+            mcpwm->task_en.val &= ~(1 << (operator_id + 13));
+        } else {
+            mcpwm->task_en.val &= ~(1 << (operator_id + 16));
+        }
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif
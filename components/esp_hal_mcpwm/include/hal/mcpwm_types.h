@@ -113,6 +113,15 @@ typedef enum {
     MCPWM_CMPR_ETM_EVENT_MAX,   /*!< Maximum number of comparator events */
 } mcpwm_comparator_etm_event_type_t;
 
+/**
+ * @brief MCPWM operator specific tasks that supported by the ETM module
+ */
+typedef enum {
+    MCPWM_OPER_ETM_TASK_TZ_OST,  /*!< Trigger the one-shot trip of the operator's brake */
+    MCPWM_OPER_ETM_TASK_CLR_OST, /*!< Clear the one-shot trip of the operator's brake */
+    MCPWM_OPER_ETM_TASK_MAX,     /*!< Maximum number of operator tasks */
+} mcpwm_operator_etm_task_type_t;
+
 #ifdef __cplusplus
 }
 #endif
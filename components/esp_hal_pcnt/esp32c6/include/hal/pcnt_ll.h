@@ -20,6 +20,7 @@
 #include "soc/pcnt_struct.h"
 #include "soc/pcr_struct.h"
 #include "hal/pcnt_types.h"
+#include "soc/soc_etm_source.h"
 #include "hal/assert.h"
 
 #ifdef __cplusplus
@@ -52,6 +53,14 @@ typedef enum {
 
 #define PCNT_LL_WATCH_EVENT_MASK          ((1 << PCNT_LL_WATCH_EVENT_MAX) - 1)
 #define PCNT_LL_UNIT_WATCH_EVENT(unit_id) (1 << (unit_id))
+
+// The ETM module exposes a single set of PCNT event sources, they reflect unit 0
+#define PCNT_LL_ETM_EVENT_TABLE(event)                            \
+    (uint32_t [PCNT_ETM_EVENT_MAX]){                              \
+        [PCNT_ETM_EVENT_REACH_THRESH] = PCNT_EVT_CNT_EQ_THRESH,   \
+        [PCNT_ETM_EVENT_REACH_LIMIT] = PCNT_EVT_CNT_EQ_LMT,       \
+        [PCNT_ETM_EVENT_REACH_ZERO] = PCNT_EVT_CNT_EQ_ZERO,       \
+    }[event]
 #define PCNT_LL_CLOCK_SUPPORT_APB         1
 
 /**
@@ -63,6 +63,18 @@ typedef enum {
     PCNT_STEP_BACKWARD, /*!< step backward, e.g., [N]->[N-1]->[N-2]->... */
 } pcnt_step_direction_t;
 
+#if SOC_PCNT_SUPPORT_ETM
+/**
+ * @brief PCNT specific events that supported by the ETM module
+ */
+typedef enum {
+    PCNT_ETM_EVENT_REACH_THRESH, /*!< Count value equals the threshold value */
+    PCNT_ETM_EVENT_REACH_LIMIT,  /*!< Count value equals the high or low limit value */
+    PCNT_ETM_EVENT_REACH_ZERO,   /*!< Count value crosses zero */
+    PCNT_ETM_EVENT_MAX,          /*!< Maximum number of events */
+} pcnt_etm_event_type_t;
+#endif // SOC_PCNT_SUPPORT_ETM
+
 #ifdef __cplusplus
 }
 #endif
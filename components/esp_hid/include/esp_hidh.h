@@ -395,6 +395,98 @@ esp_err_t esp_hidh_dev_reports_get(esp_hidh_dev_t *dev, size_t *num_reports, esp
  */
 esp_err_t esp_hidh_dev_report_maps_get(esp_hidh_dev_t *dev, size_t *num_maps, esp_hid_raw_report_map_t **maps);
 
+/**
+ * @brief Timestamped INPUT report read from the low-latency input queue
+ */
+typedef struct {
+    int64_t timestamp_us;                       /*!< esp_timer time at which the transport received the report */
+    esp_hid_usage_t usage;                      /*!< HID report usage */
+    uint16_t report_id;                         /*!< HID report index */
+    uint16_t length;                            /*!< HID data length */
+    uint8_t map_index;                          /*!< HID report map index */
+} esp_hidh_input_report_t;
+
+/**
+ * @brief Low-latency input queue configuration
+ */
+typedef struct {
+    size_t depth;                                   /*!< number of report slots, 0 for the default of 16 */
+    size_t max_report_len;                          /*!< bytes reserved per slot, longer reports are truncated, 0 for the default of 64 */
+    bool batch;                                     /*!< notify only when the queue turns non-empty, so one wakeup drains all reports of a connection event */
+    void (*notify)(esp_hidh_dev_t *dev, void *arg); /*!< optional, called from the transport task after a report was queued */
+    void *notify_arg;                               /*!< argument passed to notify */
+} esp_hidh_input_queue_config_t;
+
+/**
+ * @brief Low-latency input queue counters
+ */
+typedef struct {
+    uint32_t delivered;                         /*!< reports written into the queue by the transport */
+    uint32_t consumed;                          /*!< reports read by the application */
+    uint32_t dropped;                           /*!< reports discarded because the queue was full */
+    int64_t last_latency_us;                    /*!< queue-to-read delay of the last consumed report */
+    int64_t max_latency_us;                     /*!< largest queue-to-read delay since the last reset */
+    int64_t avg_latency_us;                     /*!< average queue-to-read delay since the last reset */
+} esp_hidh_input_stats_t;
+
+/**
+ * @brief Enable the low-latency input queue of a device
+ *        While enabled, INPUT reports are timestamped and written into a lock-free
+ *        ring read by esp_hidh_dev_input_queue_recv(), instead of being posted as
+ *        ESP_HIDH_INPUT_EVENT through the event loop. All other events are not affected.
+ * @param dev    : pointer to the device
+ * @param config : pointer to esp_hidh_input_queue_config_t structure
+ *
+ * @return: ESP_OK on success
+ */
+esp_err_t esp_hidh_dev_input_queue_enable(esp_hidh_dev_t *dev, const esp_hidh_input_queue_config_t *config);
+
+/**
+ * @brief Disable the low-latency input queue of a device
+ *        MUST NOT be called while the device can still deliver reports;
+ *        call it after ESP_HIDH_CLOSE_EVENT or before connecting.
+ * @param dev : pointer to the device
+ *
+ * @return: ESP_OK on success
+ */
+esp_err_t esp_hidh_dev_input_queue_disable(esp_hidh_dev_t *dev);
+
+/**
+ * @brief Read the oldest queued INPUT report
+ * @param dev      : pointer to the device
+ * @param report   : pointer to the structure that will hold the report metadata
+ * @param data     : buffer for the report data, should hold max_report_len bytes
+ * @param data_len : size of the data buffer
+ *
+ * @return: ESP_OK on success, ESP_ERR_NOT_FOUND if the queue is empty
+ */
+esp_err_t esp_hidh_dev_input_queue_recv(esp_hidh_dev_t *dev, esp_hidh_input_report_t *report, uint8_t *data, size_t data_len);
+
+/**
+ * @brief Get the number of INPUT reports currently queued
+ * @param dev : pointer to the device
+ *
+ * @return: number of queued reports
+ */
+size_t esp_hidh_dev_input_queue_count(esp_hidh_dev_t *dev);
+
+/**
+ * @brief Get the input queue counters of a device
+ * @param dev   : pointer to the device
+ * @param stats : pointer to the structure that will hold the counters
+ *
+ * @return: ESP_OK on success
+ */
+esp_err_t esp_hidh_dev_input_stats_get(esp_hidh_dev_t *dev, esp_hidh_input_stats_t *stats);
+
+/**
+ * @brief Reset the input queue counters of a device
+ * @param dev : pointer to the device
+ *
+ * @return: ESP_OK on success
+ */
+esp_err_t esp_hidh_dev_input_stats_reset(esp_hidh_dev_t *dev);
+
 #include "esp_hidh_transport.h"
 
 #ifdef __cplusplus
@@ -66,6 +66,8 @@ struct esp_hidh_dev_s {
     void                    *tmp;
     size_t                  tmp_len;
 
+    struct esp_hidh_input_queue_s *input_queue; //optional low-latency INPUT report path, NULL unless enabled
+
     SemaphoreHandle_t       semaphore;
     SemaphoreHandle_t       mutex;
 
@@ -158,6 +160,15 @@ void esp_hidh_preprocess_event_handler(void *event_handler_arg, esp_event_base_t
                                        void *event_data);
 void esp_hidh_postprocess_event_handler(void *event_handler_arg, esp_event_base_t event_base, int32_t event_id,
                                         void *event_data);
+/**
+ * @brief Deliver an INPUT report through the low-latency input queue
+ *
+ * Transport layers call this before posting ESP_HIDH_INPUT_EVENT
+ *
+ * @return true if the report was consumed and the event must not be posted
+ */
+bool esp_hidh_dev_input_queue_deliver(esp_hidh_dev_t *dev, esp_hid_usage_t usage, uint16_t report_id,
+                                      uint8_t map_index, const uint8_t *data, uint16_t length);
 void esp_hidh_dev_lock(esp_hidh_dev_t *dev);
 void esp_hidh_dev_unlock(esp_hidh_dev_t *dev);
 void esp_hidh_dev_wait(esp_hidh_dev_t *dev);
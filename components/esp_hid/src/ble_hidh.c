@@ -471,6 +471,12 @@ void esp_hidh_gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gatt
                     esp_hidh_event_data_t *p_param = NULL;
                     size_t event_data_size = sizeof(esp_hidh_event_data_t);
 
+                    if (report->report_type != ESP_HID_REPORT_TYPE_FEATURE &&
+                            esp_hidh_dev_input_queue_deliver(dev, report->usage, report->report_id, report->map_index,
+                                                             p_data->notify.value, p_data->notify.value_len)) {
+                        break;
+                    }
+
                     if (p_data->notify.value_len && p_data->notify.value) {
                         event_data_size += p_data->notify.value_len;
                     }
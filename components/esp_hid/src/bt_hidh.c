@@ -689,6 +689,23 @@ static void esp_hh_cb(esp_hidh_cb_event_t event, esp_hidh_cb_param_t *param)
                 _usage = report->usage;
             }
 
+            uint16_t report_id;
+            if (has_report_id) {
+                data_len = param->data_ind.len - 1;
+                p_data = (uint8_t *)param->data_ind.data + 1;
+                report_id = *(uint8_t *)param->data_ind.data;
+            } else {
+                data_len = param->data_ind.len;
+                p_data = (uint8_t *)param->data_ind.data;
+                report_id = report->report_id;
+            }
+
+            if (esp_hidh_dev_input_queue_deliver(dev, _usage, report_id, report ? report->map_index : 0,
+                                                 p_data, data_len)) {
+                esp_hidh_dev_unlock(dev);
+                break;
+            }
+
             if ((p_param = (esp_hidh_event_data_t *)malloc(event_data_size)) == NULL) {
                 esp_hidh_dev_unlock(dev);
                 ESP_LOGE(TAG, "DATA_IND ERROR: malloc event data failed!");
@@ -697,15 +714,7 @@ static void esp_hh_cb(esp_hidh_cb_event_t event, esp_hidh_cb_param_t *param)
             memset(p_param, 0, event_data_size);
             p_param->input.dev = dev;
             p_param->input.usage = _usage;
-            if (has_report_id) {
-                data_len = param->data_ind.len - 1;
-                p_data = (uint8_t *)param->data_ind.data + 1;
-                p_param->input.report_id = *(uint8_t *)param->data_ind.data;
-            } else {
-                data_len = param->data_ind.len;
-                p_data = (uint8_t *)param->data_ind.data;
-                p_param->input.report_id = report->report_id;
-            }
+            p_param->input.report_id = report_id;
             memcpy(((uint8_t *)p_param) + sizeof(esp_hidh_event_data_t), p_data, data_len);
             p_param->input.length = data_len;
             p_param->input.data = p_data;
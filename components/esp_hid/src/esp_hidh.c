@@ -10,6 +10,7 @@
 #include "ble_hidh.h"
 #include <string.h>
 #include <stdbool.h>
+#include <stdatomic.h>
 #include "esp_event.h"
 #include "esp_check.h"
 #if CONFIG_BT_HID_HOST_ENABLED
@@ -21,6 +22,32 @@ ESP_EVENT_DEFINE_BASE(ESP_HIDH_EVENTS);
 
 static const char *TAG = "ESP_HIDH";
 
+#define ESP_HIDH_INPUT_QUEUE_DEF_DEPTH   16
+#define ESP_HIDH_INPUT_QUEUE_DEF_MAX_LEN 64
+
+/**
+ * Single-producer (transport task) / single-consumer (application) ring of
+ * INPUT report slots. head and tail are free-running counters; a slot holds
+ * the report metadata followed by up to max_report_len bytes of data.
+ */
+typedef struct esp_hidh_input_queue_s {
+    size_t depth;
+    size_t max_report_len;
+    size_t slot_size;
+    bool batch;
+    void (*notify)(esp_hidh_dev_t *dev, void *arg);
+    void *notify_arg;
+    atomic_uint_least32_t head;     //written by the transport task only
+    atomic_uint_least32_t tail;     //written by the consumer only
+    uint32_t delivered;             //producer side counters
+    uint32_t dropped;
+    uint32_t consumed;              //consumer side counters
+    int64_t last_latency_us;
+    int64_t max_latency_us;
+    int64_t total_latency_us;
+    uint8_t slots[];
+} esp_hidh_input_queue_t;
+
 static TAILQ_HEAD(esp_hidh_dev_head_s, esp_hidh_dev_s) s_esp_hidh_devices;
 static SemaphoreHandle_t s_esp_hidh_devices_semaphore = NULL;
 static esp_event_loop_handle_t s_esp_hidh_event_loop_h;
@@ -531,6 +558,128 @@ esp_err_t esp_hidh_dev_report_maps_get(esp_hidh_dev_t *dev, size_t *num_maps, es
     return ESP_OK;
 }
 
+esp_err_t esp_hidh_dev_input_queue_enable(esp_hidh_dev_t *dev, const esp_hidh_input_queue_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(config, ESP_ERR_INVALID_ARG, TAG, "Config is NULL");
+    if (!esp_hidh_dev_exists(dev)) {
+        return ESP_FAIL;
+    }
+    size_t depth = config->depth ? config->depth : ESP_HIDH_INPUT_QUEUE_DEF_DEPTH;
+    size_t max_report_len = config->max_report_len ? config->max_report_len : ESP_HIDH_INPUT_QUEUE_DEF_MAX_LEN;
+    /* keep the metadata of the next slot aligned */
+    size_t slot_size = (sizeof(esp_hidh_input_report_t) + max_report_len + 3) & ~(size_t)3;
+
+    esp_hidh_input_queue_t *queue = (esp_hidh_input_queue_t *)calloc(1, sizeof(esp_hidh_input_queue_t) + depth * slot_size);
+    if (queue == NULL) {
+        ESP_LOGE(TAG, "malloc input queue failed");
+        return ESP_ERR_NO_MEM;
+    }
+    queue->depth = depth;
+    queue->max_report_len = max_report_len;
+    queue->slot_size = slot_size;
+    queue->batch = config->batch;
+    queue->notify = config->notify;
+    queue->notify_arg = config->notify_arg;
+
+    esp_err_t ret = ESP_OK;
+    esp_hidh_dev_lock(dev);
+    if (dev->input_queue) {
+        ret = ESP_ERR_INVALID_STATE;
+        free(queue);
+    } else {
+        dev->input_queue = queue;
+    }
+    esp_hidh_dev_unlock(dev);
+    return ret;
+}
+
+esp_err_t esp_hidh_dev_input_queue_disable(esp_hidh_dev_t *dev)
+{
+    if (!esp_hidh_dev_exists(dev)) {
+        return ESP_FAIL;
+    }
+    esp_hidh_dev_lock(dev);
+    esp_hidh_input_queue_t *queue = dev->input_queue;
+    dev->input_queue = NULL;
+    esp_hidh_dev_unlock(dev);
+    free(queue);
+    return ESP_OK;
+}
+
+esp_err_t esp_hidh_dev_input_queue_recv(esp_hidh_dev_t *dev, esp_hidh_input_report_t *report, uint8_t *data, size_t data_len)
+{
+    if (dev == NULL || report == NULL || data == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_hidh_input_queue_t *queue = dev->input_queue;
+    if (queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    if (head == tail) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    esp_hidh_input_report_t *slot = (esp_hidh_input_report_t *)(queue->slots + (tail % queue->depth) * queue->slot_size);
+    *report = *slot;
+    memcpy(data, (uint8_t *)(slot + 1), report->length < data_len ? report->length : data_len);
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    int64_t latency = esp_timer_get_time() - report->timestamp_us;
+    queue->consumed++;
+    queue->last_latency_us = latency;
+    if (latency > queue->max_latency_us) {
+        queue->max_latency_us = latency;
+    }
+    queue->total_latency_us += latency;
+    return ESP_OK;
+}
+
+size_t esp_hidh_dev_input_queue_count(esp_hidh_dev_t *dev)
+{
+    if (dev == NULL || dev->input_queue == NULL) {
+        return 0;
+    }
+    esp_hidh_input_queue_t *queue = dev->input_queue;
+    return atomic_load_explicit(&queue->head, memory_order_acquire) - atomic_load_explicit(&queue->tail, memory_order_relaxed);
+}
+
+esp_err_t esp_hidh_dev_input_stats_get(esp_hidh_dev_t *dev, esp_hidh_input_stats_t *stats)
+{
+    if (dev == NULL || stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_hidh_input_queue_t *queue = dev->input_queue;
+    if (queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    stats->delivered = queue->delivered;
+    stats->consumed = queue->consumed;
+    stats->dropped = queue->dropped;
+    stats->last_latency_us = queue->last_latency_us;
+    stats->max_latency_us = queue->max_latency_us;
+    stats->avg_latency_us = queue->consumed ? queue->total_latency_us / queue->consumed : 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_hidh_dev_input_stats_reset(esp_hidh_dev_t *dev)
+{
+    if (dev == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_hidh_input_queue_t *queue = dev->input_queue;
+    if (queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    queue->delivered = 0;
+    queue->dropped = 0;
+    queue->consumed = 0;
+    queue->last_latency_us = 0;
+    queue->max_latency_us = 0;
+    queue->total_latency_us = 0;
+    return ESP_OK;
+}
+
 /*
  * Private Functions
  * */
@@ -566,6 +715,36 @@ inline void esp_hidh_dev_send(esp_hidh_dev_t *dev)
     }
 }
 
+bool esp_hidh_dev_input_queue_deliver(esp_hidh_dev_t *dev, esp_hid_usage_t usage, uint16_t report_id,
+                                      uint8_t map_index, const uint8_t *data, uint16_t length)
+{
+    esp_hidh_input_queue_t *queue = dev->input_queue;
+    if (queue == NULL) {
+        return false;
+    }
+    uint32_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    if (head - tail >= queue->depth) {
+        /* the queue is enabled but the consumer fell behind; dropping keeps the
+         * remaining reports in order, falling back to the event loop would not */
+        queue->dropped++;
+        return true;
+    }
+    esp_hidh_input_report_t *slot = (esp_hidh_input_report_t *)(queue->slots + (head % queue->depth) * queue->slot_size);
+    slot->timestamp_us = esp_timer_get_time();
+    slot->usage = usage;
+    slot->report_id = report_id;
+    slot->map_index = map_index;
+    slot->length = length < queue->max_report_len ? length : queue->max_report_len;
+    memcpy((uint8_t *)(slot + 1), data, slot->length);
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    queue->delivered++;
+    if (queue->notify && (!queue->batch || head == tail)) {
+        queue->notify(dev, queue->notify_arg);
+    }
+    return true;
+}
+
 esp_hidh_dev_report_t *esp_hidh_dev_get_report_by_handle(esp_hidh_dev_t *dev, uint16_t handle)
 {
     esp_hidh_dev_report_t *r = dev->reports;
@@ -698,6 +877,8 @@ static void esp_hidh_dev_resources_free(esp_hidh_dev_t *dev)
         dev->reports = dev->reports->next;
         free(r);
     }
+    free(dev->input_queue);
+    dev->input_queue = NULL;
     esp_hidh_dev_unlock(dev);
     if (dev->mutex) {
         vSemaphoreDelete(dev->mutex);
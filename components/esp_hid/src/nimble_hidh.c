@@ -772,6 +772,10 @@ esp_hidh_gattc_event_handler(struct ble_gap_event *event, void *arg)
                         p_param->feature.length = OS_MBUF_PKTLEN(event->notify_rx.om);
                         p_param->feature.data = ((uint8_t *)p_param) + sizeof(esp_hidh_event_data_t);
                         esp_event_post_to(event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_FEATURE_EVENT, p_param, event_data_size, portMAX_DELAY);
+                    } else if (esp_hidh_dev_input_queue_deliver(dev, report->usage, report->report_id, report->map_index,
+                                                                ((uint8_t *)p_param) + sizeof(esp_hidh_event_data_t),
+                                                                OS_MBUF_PKTLEN(event->notify_rx.om))) {
+                        /* consumed by the low-latency input queue */
                     } else {
                         p_param->input.dev = dev;
                         p_param->input.map_index = report->map_index;
@@ -28,6 +28,10 @@
 #include "esp_transport_ssl.h"
 #endif
 
+#ifdef CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL
+#include "http_conn_pool.h"
+#endif
+
 ESP_EVENT_DEFINE_BASE(ESP_HTTP_CLIENT_EVENT);
 
 static const char *TAG = "HTTP_CLIENT";
@@ -53,6 +57,9 @@ typedef struct {
     char *orig_raw_data;/*!< The Original pointer to HTTP data after decoding */
     int raw_len;        /*!< The HTTP data len after decoding */
     char *output_ptr;   /*!< The destination address of the data to be copied to after decoding */
+    char *borrow_data;  /*!< In-place body slice handed out by esp_http_client_read_borrow */
+    int borrow_len;     /*!< Length of the borrowed slice */
+    bool borrow_active; /*!< Body bytes of the current parser pass are compacted in place instead of copied out */
 } esp_http_buffer_t;
 
 /**
@@ -139,6 +146,9 @@ struct esp_http_client {
 #ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
     session_ticket_state_t      session_ticket_state;
 #endif
+#ifdef CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL
+    esp_transport_list_handle_t pooled_transport_list;  /*!< transport list borrowed from the connection pool, owns `transport` */
+#endif
 };
 
 typedef struct esp_http_client esp_http_client_t;
@@ -339,6 +349,17 @@ static int http_on_body(http_parser *parser, const char *at, size_t length)
     if (client->response->buffer->output_ptr) {
         memcpy(client->response->buffer->output_ptr, (char *)at, length);
         client->response->buffer->output_ptr += length;
+    } else if (client->response->buffer->borrow_active) {
+        /* Keep the body inside the rx buffer: the first slice is referenced where
+           the parser found it, later slices (separated by chunk framing) are
+           packed against it in place, so the caller gets one contiguous view */
+        esp_http_buffer_t *res_buffer = client->response->buffer;
+        if (res_buffer->borrow_len == 0) {
+            res_buffer->borrow_data = (char *)at;
+        } else if (res_buffer->borrow_data + res_buffer->borrow_len != at) {
+            memmove(res_buffer->borrow_data + res_buffer->borrow_len, at, length);
+        }
+        res_buffer->borrow_len += length;
     } else {
         /* Do not cache body when http_on_body is called from esp_http_client_perform */
         if (client->state < HTTP_STATE_RES_ON_DATA_START && client->cache_data_in_fetch_hdr) {
@@ -1055,6 +1076,35 @@ esp_err_t esp_http_client_cleanup(esp_http_client_handle_t client)
     if (client == NULL) {
         return ESP_FAIL;
     }
+#ifdef CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL
+    if (client->state == HTTP_STATE_CONNECTED && client->transport != NULL && !client->is_async) {
+        // The connection survived the last response (keep-alive), park it in the pool
+        // together with the transport list that owns it instead of tearing it down
+        bool borrowed = (client->pooled_transport_list != NULL);
+        esp_transport_list_handle_t donated_list = borrowed ? client->pooled_transport_list : client->transport_list;
+        if (http_conn_pool_donate(client->connection_info.scheme, client->connection_info.host,
+                                  client->connection_info.port, donated_list, client->transport)) {
+            if (borrowed) {
+                client->pooled_transport_list = NULL;
+            } else {
+                client->transport_list = NULL;
+            }
+            client->transport = NULL;
+            client->state = HTTP_STATE_INIT;
+        }
+    }
+    if (client->pooled_transport_list != NULL) {
+        // The borrowed connection is not reusable (or the pool is full): close and free
+        // it here, it does not belong to the client's own transport list
+        if (client->transport != NULL) {
+            esp_transport_close(client->transport);
+            client->transport = NULL;
+        }
+        esp_transport_list_destroy(client->pooled_transport_list);
+        client->pooled_transport_list = NULL;
+        client->state = HTTP_STATE_INIT;
+    }
+#endif
     esp_http_client_close(client);
     if (client->transport_list) {
         esp_transport_list_destroy(client->transport_list);
@@ -1418,6 +1468,95 @@ int esp_http_client_read(esp_http_client_handle_t client, char *buffer, int len)
     return ridx;
 }
 
+int esp_http_client_read_borrow(esp_http_client_handle_t client, const char **data_ptr)
+{
+    if (client == NULL || data_ptr == NULL) {
+        return ESP_FAIL;
+    }
+    esp_http_buffer_t *res_buffer = client->response->buffer;
+
+    /* Remainder of a previously borrowed slice that was not fully released */
+    if (res_buffer->borrow_len > 0) {
+        *data_ptr = res_buffer->borrow_data;
+        return res_buffer->borrow_len;
+    }
+
+    /* Body bytes cached while fetching the headers are handed out first */
+    if (res_buffer->raw_len > 0) {
+        res_buffer->borrow_data = res_buffer->raw_data;
+        res_buffer->borrow_len = res_buffer->raw_len;
+        res_buffer->raw_data += res_buffer->raw_len;
+        res_buffer->raw_len = 0;
+        *data_ptr = res_buffer->borrow_data;
+        return res_buffer->borrow_len;
+    }
+
+    while (true) {
+        bool is_data_remain;
+        if (client->response->is_chunked) {
+            is_data_remain = !client->is_chunk_complete;
+        } else {
+            is_data_remain = client->response->data_process < client->response->content_length;
+        }
+        if (!is_data_remain) {
+            return 0;
+        }
+        errno = 0;
+        int rlen = esp_transport_read(client->transport, res_buffer->data, client->buffer_size_rx, client->timeout_ms);
+        if (rlen <= 0) {
+            if (rlen == ERR_TCP_TRANSPORT_CONNECTION_CLOSED_BY_FIN && client->response->is_chunked) {
+                /* Explicit call to parser for invoking `message_complete` callback */
+                http_parser_execute(client->parser, client->parser_settings, res_buffer->data, 0);
+                return 0;
+            }
+            if (rlen == ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT) {
+                ESP_LOGD(TAG, "Connection timed out before data was ready!");
+                return -ESP_ERR_HTTP_EAGAIN;
+            }
+            if (rlen != ERR_TCP_TRANSPORT_CONNECTION_CLOSED_BY_FIN) {
+                esp_err_t err = esp_transport_translate_error(rlen);
+                ESP_LOGE(TAG, "transport_read: error - %d | %s", err, esp_err_to_name(err));
+            }
+            if (rlen < 0 && !esp_http_client_is_complete_data_received(client)) {
+                http_dispatch_event(client, HTTP_EVENT_ERROR, esp_transport_get_error_handle(client->transport), 0);
+                http_dispatch_event_to_event_loop(HTTP_EVENT_ERROR, &client, sizeof(esp_http_client_handle_t));
+                return ESP_FAIL;
+            }
+            return 0;
+        }
+        res_buffer->borrow_active = true;
+        res_buffer->borrow_data = NULL;
+        http_parser_execute(client->parser, client->parser_settings, res_buffer->data, rlen);
+        res_buffer->borrow_active = false;
+        res_buffer->raw_len = 0; /* body length is tracked via borrow_len in this mode */
+        if (res_buffer->borrow_len > 0) {
+            *data_ptr = res_buffer->borrow_data;
+            return res_buffer->borrow_len;
+        }
+        /* The read contained only chunk framing, fetch more data */
+    }
+}
+
+void esp_http_client_read_release(esp_http_client_handle_t client, int consumed)
+{
+    if (client == NULL) {
+        return;
+    }
+    esp_http_buffer_t *res_buffer = client->response->buffer;
+    if (consumed < 0 || consumed > res_buffer->borrow_len) {
+        consumed = res_buffer->borrow_len;
+    }
+    res_buffer->borrow_data += consumed;
+    res_buffer->borrow_len -= consumed;
+    if (res_buffer->borrow_len == 0) {
+        res_buffer->borrow_data = NULL;
+        /* If the slice lived in the header-stage cache, it can be freed now */
+        if (res_buffer->orig_raw_data != NULL && res_buffer->raw_len == 0) {
+            esp_http_client_cached_buf_cleanup(res_buffer);
+        }
+    }
+}
+
 esp_err_t esp_http_client_perform(esp_http_client_handle_t client)
 {
     esp_err_t err = ESP_FAIL;
@@ -1614,6 +1753,31 @@ static esp_err_t esp_http_client_connect(esp_http_client_handle_t client)
     client->state = HTTP_STATE_CONNECTING;
 
     if (client->state < HTTP_STATE_CONNECTED) {
+#ifdef CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL
+        // Borrow an already established connection to the endpoint from the pool, if one
+        // is parked there. Not applicable to async mode, which needs to drive the connect
+        // state machine itself.
+        if (!client->is_async) {
+            if (client->pooled_transport_list != NULL) {
+                // A previously borrowed connection was closed (e.g. on a redirect or an
+                // error), release it before setting up a fresh one
+                esp_transport_list_destroy(client->pooled_transport_list);
+                client->pooled_transport_list = NULL;
+                client->transport = NULL;
+            }
+            esp_transport_list_handle_t pooled_list = NULL;
+            esp_transport_handle_t pooled_transport = NULL;
+            if (http_conn_pool_acquire(client->connection_info.scheme, client->connection_info.host,
+                                       client->connection_info.port, &pooled_list, &pooled_transport)) {
+                client->pooled_transport_list = pooled_list;
+                client->transport = pooled_transport;
+                client->state = HTTP_STATE_CONNECTED;
+                http_dispatch_event(client, HTTP_EVENT_ON_CONNECTED, NULL, 0);
+                http_dispatch_event_to_event_loop(HTTP_EVENT_ON_CONNECTED, &client, sizeof(esp_http_client_handle_t));
+                return ESP_OK;
+            }
+        }
+#endif
 #ifdef CONFIG_ESP_HTTP_CLIENT_ENABLE_CUSTOM_TRANSPORT
         // If the custom transport is enabled and defined, we skip the selection of appropriate transport from the list
         // based on the scheme, since we already have the transport
@@ -2085,3 +2249,10 @@ bool esp_http_client_is_persistent_connection(esp_http_client_handle_t client)
     }
     return false;
 }
+
+#ifdef CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL
+void esp_http_client_flush_connection_pool(void)
+{
+    http_conn_pool_flush();
+}
+#endif
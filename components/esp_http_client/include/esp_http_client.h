@@ -684,6 +684,44 @@ bool esp_http_client_is_chunked_response(esp_http_client_handle_t client);
  */
 int esp_http_client_read(esp_http_client_handle_t client, char *buffer, int len);
 
+/**
+ * @brief      Borrow a slice of the response body directly from the client's receive buffer
+ *
+ * Zero-copy alternative to esp_http_client_read(): instead of copying into a
+ * caller-provided buffer, a pointer into the client's internal buffer is handed
+ * out, so parsers can consume the body in place without intermediate copies or
+ * allocations. Chunked transfer encoding is decoded in place, the returned
+ * slice never contains chunk framing.
+ *
+ * The slice stays valid until the next call that touches the response stream
+ * (esp_http_client_read_borrow, esp_http_client_read, esp_http_client_close, ...).
+ * Every successful borrow must be matched with esp_http_client_read_release()
+ * before other read APIs are used; unreleased bytes are handed out again by the
+ * next borrow.
+ *
+ * @param[in]  client    The esp_http_client handle
+ * @param[out] data_ptr  Set to the start of the borrowed slice
+ *
+ * @return
+ *     - Length of the borrowed slice
+ *     - 0 if the complete body has been consumed
+ *     - (-1) if any errors
+ *     - (-ESP_ERR_HTTP_EAGAIN = -0x7007) when the call timed out before any data was ready
+ */
+int esp_http_client_read_borrow(esp_http_client_handle_t client, const char **data_ptr);
+
+/**
+ * @brief      Release (part of) a slice obtained with esp_http_client_read_borrow()
+ *
+ * Releasing fewer bytes than were borrowed keeps the remainder for the next
+ * esp_http_client_read_borrow() call, which is convenient for parsers that
+ * stop at token boundaries.
+ *
+ * @param[in]  client    The esp_http_client handle
+ * @param[in]  consumed  Number of bytes consumed from the borrowed slice, a negative
+ *                       value releases the whole slice
+ */
+void esp_http_client_read_release(esp_http_client_handle_t client, int consumed);
 
 /**
  * @brief      Get http response status code, the valid value if this function invoke after `esp_http_client_perform`
@@ -902,6 +940,19 @@ esp_http_state_t esp_http_client_get_state(esp_http_client_handle_t client);
  */
 bool esp_http_client_is_persistent_connection(esp_http_client_handle_t client);
 
+#ifdef CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL
+/**
+ * @brief      Close and free every connection parked in the process-wide connection pool
+ *
+ * When CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL is enabled, connections that are still
+ * alive when a client is cleaned up are kept warm in a pool and reused by later clients
+ * targeting the same scheme, host and port. Call this function to drop all parked
+ * connections, e.g. before disconnecting the network interface or entering a
+ * low-power mode.
+ */
+void esp_http_client_flush_connection_pool(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
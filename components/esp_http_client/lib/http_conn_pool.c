@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_transport.h"
+#include "http_conn_pool.h"
+
+static const char *TAG = "HTTP_CONN_POOL";
+
+typedef struct {
+    char *scheme;
+    char *host;
+    int port;
+    esp_transport_list_handle_t transport_list;
+    esp_transport_handle_t transport;
+    int64_t parked_at_us;
+} http_conn_pool_entry_t;
+
+static http_conn_pool_entry_t s_pool[CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_SIZE];
+static SemaphoreHandle_t s_pool_lock = NULL;
+static portMUX_TYPE s_pool_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+#define POOL_IDLE_TIMEOUT_US ((int64_t)CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_IDLE_TIMEOUT * 1000000)
+
+static SemaphoreHandle_t pool_lock(void)
+{
+    if (s_pool_lock == NULL) {
+        SemaphoreHandle_t new_lock = xSemaphoreCreateMutex();
+        if (new_lock == NULL) {
+            return NULL;
+        }
+        portENTER_CRITICAL(&s_pool_spinlock);
+        if (s_pool_lock == NULL) {
+            s_pool_lock = new_lock;
+            new_lock = NULL;
+        }
+        portEXIT_CRITICAL(&s_pool_spinlock);
+        if (new_lock != NULL) {
+            // another task won the race, use its mutex
+            vSemaphoreDelete(new_lock);
+        }
+    }
+    return s_pool_lock;
+}
+
+// Detach the entry from the pool; the caller becomes the owner of the handles
+static void pool_entry_detach(http_conn_pool_entry_t *entry)
+{
+    free(entry->scheme);
+    free(entry->host);
+    memset(entry, 0, sizeof(*entry));
+}
+
+// Close and free a connection that is no longer wanted. Must be called without
+// holding the pool lock since closing a TLS connection can block.
+static void conn_destroy(esp_transport_list_handle_t transport_list, esp_transport_handle_t transport)
+{
+    esp_transport_close(transport);
+    esp_transport_list_destroy(transport_list);
+}
+
+static bool pool_entry_matches(const http_conn_pool_entry_t *entry, const char *scheme, const char *host, int port)
+{
+    return entry->transport != NULL
+           && entry->port == port
+           && strcasecmp(entry->scheme, scheme) == 0
+           && strcasecmp(entry->host, host) == 0;
+}
+
+// An idle pooled socket must have nothing to read: pending bytes mean stray data
+// or an EOF from the peer, both of which make the connection unusable
+static bool conn_is_healthy(esp_transport_handle_t transport)
+{
+    return esp_transport_poll_read(transport, 0) == 0;
+}
+
+bool http_conn_pool_acquire(const char *scheme, const char *host, int port,
+                            esp_transport_list_handle_t *transport_list,
+                            esp_transport_handle_t *transport)
+{
+    if (scheme == NULL || host == NULL || transport_list == NULL || transport == NULL) {
+        return false;
+    }
+    SemaphoreHandle_t lock = pool_lock();
+    if (lock == NULL) {
+        return false;
+    }
+
+    // connections evicted under the lock are torn down after it is released
+    esp_transport_list_handle_t stale_lists[CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_SIZE];
+    esp_transport_handle_t stale_transports[CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_SIZE];
+    int num_stale = 0;
+    bool hit = false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    for (int i = 0; i < CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_SIZE; i++) {
+        http_conn_pool_entry_t *entry = &s_pool[i];
+        if (entry->transport == NULL) {
+            continue;
+        }
+        if (now - entry->parked_at_us > POOL_IDLE_TIMEOUT_US) {
+            ESP_LOGD(TAG, "Expiring idle connection to %s://%s:%d", entry->scheme, entry->host, entry->port);
+            stale_lists[num_stale] = entry->transport_list;
+            stale_transports[num_stale] = entry->transport;
+            num_stale++;
+            pool_entry_detach(entry);
+            continue;
+        }
+        if (!hit && pool_entry_matches(entry, scheme, host, port)) {
+            if (conn_is_healthy(entry->transport)) {
+                *transport_list = entry->transport_list;
+                *transport = entry->transport;
+                hit = true;
+            } else {
+                ESP_LOGD(TAG, "Pooled connection to %s://%s:%d is dead", entry->scheme, entry->host, entry->port);
+                stale_lists[num_stale] = entry->transport_list;
+                stale_transports[num_stale] = entry->transport;
+                num_stale++;
+            }
+            pool_entry_detach(entry);
+        }
+    }
+    xSemaphoreGive(lock);
+
+    for (int i = 0; i < num_stale; i++) {
+        conn_destroy(stale_lists[i], stale_transports[i]);
+    }
+    if (hit) {
+        ESP_LOGD(TAG, "Reusing pooled connection to %s://%s:%d", scheme, host, port);
+    }
+    return hit;
+}
+
+bool http_conn_pool_donate(const char *scheme, const char *host, int port,
+                           esp_transport_list_handle_t transport_list,
+                           esp_transport_handle_t transport)
+{
+    if (scheme == NULL || host == NULL || transport_list == NULL || transport == NULL) {
+        return false;
+    }
+    SemaphoreHandle_t lock = pool_lock();
+    if (lock == NULL) {
+        return false;
+    }
+    char *scheme_copy = strdup(scheme);
+    char *host_copy = strdup(host);
+    if (scheme_copy == NULL || host_copy == NULL) {
+        free(scheme_copy);
+        free(host_copy);
+        return false;
+    }
+
+    bool parked = false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (int i = 0; i < CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_SIZE; i++) {
+        http_conn_pool_entry_t *entry = &s_pool[i];
+        if (entry->transport == NULL) {
+            entry->scheme = scheme_copy;
+            entry->host = host_copy;
+            entry->port = port;
+            entry->transport_list = transport_list;
+            entry->transport = transport;
+            entry->parked_at_us = esp_timer_get_time();
+            parked = true;
+            break;
+        }
+    }
+    xSemaphoreGive(lock);
+
+    if (!parked) {
+        ESP_LOGD(TAG, "Pool full, not parking connection to %s://%s:%d", scheme, host, port);
+        free(scheme_copy);
+        free(host_copy);
+    }
+    return parked;
+}
+
+void http_conn_pool_flush(void)
+{
+    SemaphoreHandle_t lock = pool_lock();
+    if (lock == NULL) {
+        return;
+    }
+    esp_transport_list_handle_t lists[CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_SIZE];
+    esp_transport_handle_t transports[CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_SIZE];
+    int num = 0;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (int i = 0; i < CONFIG_ESP_HTTP_CLIENT_CONNECTION_POOL_SIZE; i++) {
+        http_conn_pool_entry_t *entry = &s_pool[i];
+        if (entry->transport == NULL) {
+            continue;
+        }
+        lists[num] = entry->transport_list;
+        transports[num] = entry->transport;
+        num++;
+        pool_entry_detach(entry);
+    }
+    xSemaphoreGive(lock);
+
+    for (int i = 0; i < num; i++) {
+        conn_destroy(lists[i], transports[i]);
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include "esp_transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Borrow an open connection to the given endpoint from the process-wide pool
+ *
+ * Looks up a parked connection matching the scheme, host and port. Entries that
+ * exceeded the idle timeout are torn down during the lookup, and a matching entry
+ * is only handed out after a health check (the socket must be writable and must
+ * not have pending data or an EOF from the peer). On a hit the caller takes
+ * ownership of both the transport list and the open transport.
+ *
+ * @param[in]  scheme         Scheme of the endpoint, e.g. "http" or "https"
+ * @param[in]  host           Hostname of the endpoint
+ * @param[in]  port           Port of the endpoint
+ * @param[out] transport_list Transport list owning the returned transport
+ * @param[out] transport      Open transport connected to the endpoint
+ *
+ * @return true on a pool hit, false if no healthy matching connection is parked
+ */
+bool http_conn_pool_acquire(const char *scheme, const char *host, int port,
+                            esp_transport_list_handle_t *transport_list,
+                            esp_transport_handle_t *transport);
+
+/**
+ * @brief Park an open connection in the process-wide pool
+ *
+ * On success the pool takes ownership of the transport list and the open
+ * transport, keeping the connection (including a TLS session) warm for the next
+ * client that requests the same endpoint. The caller must not touch the handles
+ * afterwards.
+ *
+ * @param[in] scheme         Scheme of the endpoint, e.g. "http" or "https"
+ * @param[in] host           Hostname of the endpoint
+ * @param[in] port           Port of the endpoint
+ * @param[in] transport_list Transport list owning the transport
+ * @param[in] transport      Open transport connected to the endpoint
+ *
+ * @return true if the connection was parked, false if the pool is full or out of
+ *         memory (the caller keeps ownership and should tear the connection down)
+ */
+bool http_conn_pool_donate(const char *scheme, const char *host, int port,
+                           esp_transport_list_handle_t transport_list,
+                           esp_transport_handle_t transport);
+
+/**
+ * @brief Close and free every connection parked in the pool
+ *
+ * Useful before entering low-power modes or when the network interface goes down,
+ * since parked sockets keep their protocol control blocks alive.
+ */
+void http_conn_pool_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
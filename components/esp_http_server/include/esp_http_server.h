@@ -9,6 +9,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <sys/uio.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <http_parser.h>
@@ -866,6 +867,60 @@ esp_err_t httpd_req_async_handler_begin(httpd_req_t *r, httpd_req_t **out);
  */
 esp_err_t httpd_req_async_handler_complete(httpd_req_t *r);
 
+#ifdef CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT
+/**
+ * @brief   Prototype of a handler run on the shared async worker pool
+ *
+ * @param[in] req   Async copy of the request, valid until the handler returns
+ *
+ * @return
+ *  - ESP_OK : on success, the session stays open
+ *  - Any other value closes the underlying session, like a failing URI handler
+ */
+typedef esp_err_t (*httpd_async_req_handler_t)(httpd_req_t *req);
+
+/**
+ * @brief   Hand a request off to the shared async worker pool
+ *
+ * Must be called from a URI handler. On success the request is copied
+ * (httpd_req_async_handler_begin()), the session is parked and the handler
+ * runs on the next free worker task; the calling URI handler should return
+ * ESP_OK immediately without touching the request further. The worker
+ * completes the request automatically, so the pool handler must not call
+ * httpd_req_async_handler_complete() itself.
+ *
+ * @note When all workers are busy and the job queue is full, this fails with
+ * ESP_ERR_NO_MEM without blocking, so the URI handler can respond with
+ * 503 Service Unavailable instead of stalling the server task.
+ *
+ * @param[in] r        The request to hand off
+ * @param[in] handler  Handler to run on a worker task
+ *
+ * @return
+ *  - ESP_OK : request queued for a worker
+ *  - ESP_ERR_INVALID_ARG : null arguments
+ *  - ESP_ERR_INVALID_STATE : worker pool not running
+ *  - ESP_ERR_NO_MEM : pool saturated, or request copy allocation failed
+ */
+esp_err_t httpd_req_async_submit(httpd_req_t *r, httpd_async_req_handler_t handler);
+
+/**
+ * @brief   Number of requests currently owned by the async worker pool
+ *
+ * Counts jobs waiting in the queue plus handlers running on workers. Can be
+ * used by endpoints to shed load before the queue fills up.
+ *
+ * @param[in]  handle  Handle to server instance
+ * @param[out] count   Number of queued plus in-flight async requests
+ *
+ * @return
+ *  - ESP_OK : on success
+ *  - ESP_ERR_INVALID_ARG : null arguments
+ *  - ESP_ERR_INVALID_STATE : worker pool not running
+ */
+esp_err_t httpd_async_pending_count(httpd_handle_t handle, size_t *count);
+#endif /* CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT */
+
 /**
  * @brief   Get the Socket Descriptor from the HTTP request
  *
@@ -1119,6 +1174,38 @@ bool httpd_uri_match_wildcard(const char *uri_template, const char *uri_to_match
  */
 esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len);
 
+/**
+ * @brief   API to send a complete HTTP response from a scatter-gather list
+ *
+ * Behaves like httpd_resp_send(), except that the body is described by an iovec
+ * array and the whole response - status line, all headers and every body fragment -
+ * is handed to the transport as one scatter-gather submission. All parts except the
+ * last are sent with MSG_MORE, so lwIP coalesces them into full sized TCP segments
+ * instead of one small segment per header or fragment.
+ *
+ * Use this when the body is already split across several buffers (e.g. assembled
+ * JSON fragments) to avoid copying them into one contiguous buffer first.
+ *
+ * @note
+ *  - This API is supposed to be called only from the context of
+ *    a URI handler where httpd_req_t* request pointer is valid.
+ *  - Once this API is called, the request has been responded to.
+ *  - No additional data can then be sent for the request.
+ *
+ * @param[in] r         The request being responded to
+ * @param[in] body_iov  Array of buffers forming the response body (NULL for no body)
+ * @param[in] body_iov_cnt Number of elements in body_iov
+ *
+ * @return
+ *  - ESP_OK : On successfully sending the response packet
+ *  - ESP_ERR_INVALID_ARG : Null request pointer or iov array inconsistent with count
+ *  - ESP_ERR_HTTPD_RESP_HDR    : Essential headers are too large for internal buffer
+ *  - ESP_ERR_HTTPD_ALLOC_MEM   : Failed to dynamically allocate memory
+ *  - ESP_ERR_HTTPD_RESP_SEND   : Error in raw send
+ *  - ESP_ERR_HTTPD_INVALID_REQ : Invalid request
+ */
+esp_err_t httpd_resp_sendv(httpd_req_t *r, const struct iovec *body_iov, size_t body_iov_cnt);
+
 /**
  * @brief   API to send one HTTP chunk
  *
@@ -1445,6 +1532,30 @@ static inline esp_err_t httpd_resp_send_500(httpd_req_t *r) {
  */
 int httpd_send(httpd_req_t *r, const char *buf, size_t buf_len);
 
+/**
+ * @brief   Raw scatter-gather HTTP send
+ *
+ * Sends every buffer of the iovec array in order over the session. All buffers
+ * except the last one are submitted with the MSG_MORE flag, which lwIP maps to
+ * TCP_WRITE_FLAG_MORE, so consecutive fragments are coalesced into full sized
+ * TCP segments instead of being flushed individually.
+ *
+ * Like httpd_send(), the caller is responsible for the HTTP structure of the
+ * data. If a send override function is registered for the session, it receives
+ * the fragments one by one together with the flag.
+ *
+ * @param[in] r         The request being responded to
+ * @param[in] iov       Array of buffers to send
+ * @param[in] iov_cnt   Number of elements in the iov array
+ *
+ * @return
+ *  - Bytes : Number of bytes that were sent successfully
+ *  - HTTPD_SOCK_ERR_INVALID  : Invalid arguments
+ *  - HTTPD_SOCK_ERR_TIMEOUT  : Timeout/interrupted while calling socket send()
+ *  - HTTPD_SOCK_ERR_FAIL     : Unrecoverable error while calling socket send()
+ */
+int httpd_sendv(httpd_req_t *r, const struct iovec *iov, size_t iov_cnt);
+
 /**
  * A low level API to send data on a given socket
  *
@@ -1556,6 +1667,31 @@ void *httpd_sess_get_transport_ctx(httpd_handle_t handle, int sockfd);
  */
 void httpd_sess_set_transport_ctx(httpd_handle_t handle, int sockfd, void *ctx, httpd_free_ctx_fn_t free_fn);
 
+/**
+ * @brief   Park a session, or return a parked session to the server's main loop
+ *
+ * While a session is parked the server task neither polls its socket for
+ * incoming data nor considers it for LRU purge; another task is expected to
+ * own the socket I/O for that time. This is used e.g. by transport layers
+ * that complete a handshake on a separate task before the session starts
+ * serving requests.
+ *
+ * @note    Must only be called from the server task context, i.e. from a URI
+ *          handler, the open/close functions, or work queued through
+ *          httpd_queue_work()
+ *
+ * @param[in] handle    Handle to server returned by httpd_start
+ * @param[in] sockfd    The socket descriptor of the session
+ * @param[in] parked    True to detach the session from the main loop,
+ *                      false to re-attach it
+ *
+ * @return
+ *  - ESP_OK : Socket found and parked state updated
+ *  - ESP_ERR_NOT_FOUND   : Socket not found
+ *  - ESP_ERR_INVALID_ARG : Null arguments
+ */
+esp_err_t httpd_sess_set_parked(httpd_handle_t handle, int sockfd, bool parked);
+
 /**
  * @brief   Get HTTPD global user context (it was set in the server config struct)
  *
@@ -1776,6 +1912,42 @@ esp_err_t httpd_ws_send_frame(httpd_req_t *req, httpd_ws_frame_t *pkt);
  */
 esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame);
 
+/**
+ * @brief Construct and send multiple WebSocket frames coalesced into a single socket write
+ *
+ * The headers and payloads of all frames are gathered into one buffer and flushed with one
+ * send call, which avoids a TCP segment per frame when streaming many small messages.
+ * If the coalescing buffer cannot be allocated, the frames are sent one by one instead.
+ *
+ * @param[in]   req         Current request
+ * @param[in]   frames      Array of WebSocket frames
+ * @param[in]   frame_count Number of frames in the array
+ * @return
+ *  - ESP_OK                    : On successful
+ *  - ESP_FAIL                  : When socket errors occurs
+ *  - ESP_ERR_INVALID_STATE     : Handshake was already done beforehand
+ *  - ESP_ERR_INVALID_ARG       : Argument is invalid (null or non-WebSocket)
+ */
+esp_err_t httpd_ws_send_frame_batch(httpd_req_t *req, httpd_ws_frame_t *frames, size_t frame_count);
+
+/**
+ * @brief Low level send of a batch of WebSocket frames out of the scope of current request
+ * using internally configured httpd send function
+ *
+ * The frames are coalesced into a single socket write, see `httpd_ws_send_frame_batch`.
+ *
+ * @param[in] hd          Server instance data
+ * @param[in] fd          Socket descriptor for sending data
+ * @param[in] frames      Array of WebSocket frames
+ * @param[in] frame_count Number of frames in the array
+ * @return
+ *  - ESP_OK                    : On successful
+ *  - ESP_FAIL                  : When socket errors occurs
+ *  - ESP_ERR_INVALID_STATE     : Handshake was already done beforehand
+ *  - ESP_ERR_INVALID_ARG       : Argument is invalid (null or non-WebSocket)
+ */
+esp_err_t httpd_ws_send_frame_batch_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frames, size_t frame_count);
+
 /**
  * @brief Checks the supplied socket descriptor if it belongs to any active client
  * of this server instance and if the websoket protocol is active
@@ -1861,6 +2033,74 @@ esp_err_t httpd_get_raw_req_data(httpd_req_t *req, char *buf, size_t buf_len);
  */
 esp_http_server_event_id_t httpd_get_server_state(httpd_handle_t handle);
 
+/* ************** Group: Static Assets ************** */
+/** @name Static Assets
+ * Serving of immutable in-memory assets (embedded files or mapped flash)
+ * @{
+ */
+
+#if CONFIG_HTTPD_STATIC_SERVE_SUPPORT || __DOXYGEN__
+/**
+ * @brief One entry of a static asset table
+ *
+ * The data pointers must stay valid while the assets are registered. Assets
+ * embedded with EMBED_FILES/EMBED_TXTFILES already live in mapped flash, and
+ * assets stored in a raw partition can be mapped once with
+ * esp_partition_mmap(); in both cases responses are sent straight from the
+ * mapped region without a read or copy per chunk.
+ */
+typedef struct {
+    const char *uri;          /*!< Absolute URI path the asset is served under */
+    const char *content_type; /*!< Content-Type header value, NULL for the server default */
+    const uint8_t *data;      /*!< Identity (uncompressed) representation */
+    size_t data_len;          /*!< Length of the identity representation */
+    const uint8_t *data_gz;   /*!< Optional pre-gzipped representation, NULL if none */
+    size_t data_gz_len;       /*!< Length of the gzipped representation */
+    uint32_t max_age;         /*!< Cache-Control max-age in seconds, 0 sends no-cache */
+} httpd_static_asset_t;
+
+/**
+ * @brief Register a table of static assets with the server
+ *
+ * Each asset is registered as one GET URI handler, so max_uri_handlers in the
+ * server configuration must leave room for the whole table. The handler
+ * computes an ETag over the content at registration time and then serves:
+ *  - 304 Not Modified when If-None-Match carries the current ETag
+ *  - the gzipped representation (Content-Encoding: gzip) when the client
+ *    accepts it and the asset provides one
+ *  - single byte ranges (206 Partial Content / 416 on an unsatisfiable range)
+ *
+ * @param[in] handle     Handle to server returned by httpd_start
+ * @param[in] assets     Asset table; must stay valid while registered
+ * @param[in] num_assets Number of entries in the table
+ *
+ * @return
+ *  - ESP_OK : On success
+ *  - ESP_ERR_INVALID_ARG : Null handle or table, or an entry without uri/data
+ *  - ESP_ERR_NO_MEM : Failed to allocate the runtime state
+ *  - ESP_ERR_HTTPD_HANDLERS_FULL : No slot left for a URI handler
+ */
+esp_err_t httpd_register_static_assets(httpd_handle_t handle,
+                                       const httpd_static_asset_t *assets, size_t num_assets);
+
+/**
+ * @brief Unregister a previously registered static asset table
+ *
+ * @param[in] handle Handle to server returned by httpd_start
+ * @param[in] assets Asset table passed to httpd_register_static_assets()
+ *
+ * @return
+ *  - ESP_OK : On success
+ *  - ESP_ERR_INVALID_ARG : Null arguments
+ *  - ESP_ERR_NOT_FOUND : Table was not registered on this server
+ */
+esp_err_t httpd_unregister_static_assets(httpd_handle_t handle,
+                                         const httpd_static_asset_t *assets);
+#endif /* CONFIG_HTTPD_STATIC_SERVE_SUPPORT || __DOXYGEN__ */
+/** End of Static Assets
+ * @}
+ */
+
 #ifdef __cplusplus
 }
 #endif
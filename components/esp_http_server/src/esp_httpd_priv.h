@@ -11,6 +11,7 @@
 #include <stdbool.h>
 #include <sys/socket.h>
 #include <sys/param.h>
+#include <sys/poll.h>
 #include <netinet/in.h>
 #include <esp_log.h>
 #include <esp_err.h>
@@ -18,6 +19,10 @@
 #include <esp_http_server.h>
 #include "osal.h"
 #include "sdkconfig.h"
+#if CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -89,6 +94,9 @@ struct sock_db {
     esp_err_t (*ws_handler)(httpd_req_t *r);   /*!< WebSocket handler, leave to null if it's not WebSocket */
     bool ws_control_frames;                         /*!< WebSocket flag indicating that control frames should be passed to user handlers */
     void *ws_user_ctx;                         /*!< Pointer to user context data which will be available to handler for websocket*/
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    bool ws_deflate_enabled;                   /*!< True if permessage-deflate was negotiated during the handshake */
+#endif
 #endif
 };
 
@@ -119,6 +127,9 @@ struct httpd_req_aux {
     httpd_ws_type_t ws_type;                        /*!< WebSocket frame type */
     bool ws_final;                                  /*!< WebSocket FIN bit (final frame or not) */
     uint8_t mask_key[4];                            /*!< WebSocket mask key for this payload */
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    bool ws_compressed;                             /*!< WebSocket RSV1 bit of the current frame (permessage-deflate) */
+#endif
 #endif
 };
 
@@ -145,6 +156,17 @@ struct httpd_data {
 
     /* Array of registered error handler functions */
     httpd_err_handler_func_t *err_handler_fns;
+
+#if CONFIG_HTTPD_SESS_USE_POLL
+    struct pollfd *hd_poll_fds;             /*!< Persistent pollfd array: [0] ctrl, [1] listen, then sessions */
+    int hd_poll_cnt;                        /*!< Number of valid entries in hd_poll_fds */
+#endif
+
+#if CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT
+    QueueHandle_t async_job_queue;          /*!< Requests handed off to the worker pool, waiting for a free worker */
+    SemaphoreHandle_t async_workers_exited; /*!< Given once by each worker task on exit, for join during stop */
+    volatile int async_busy_workers;        /*!< Number of workers currently executing a handler */
+#endif
 };
 
 /**
@@ -209,6 +231,61 @@ void httpd_sess_delete_invalid(struct httpd_data *hd);
  */
 void httpd_sess_init(struct httpd_data *hd);
 
+#if CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT
+/**
+ * @brief   Creates the async job queue and spawns the worker tasks.
+ *          Called during httpd_start().
+ *
+ * @param[in] hd    Server instance data
+ *
+ * @return
+ *  - ESP_OK                  : on success
+ *  - ESP_ERR_HTTPD_ALLOC_MEM : if the queue, the join semaphore or a
+ *                              worker task could not be created
+ */
+esp_err_t httpd_async_workers_start(struct httpd_data *hd);
+
+/**
+ * @brief   Signals all worker tasks to exit, waits for them and releases
+ *          the pool resources. Called during httpd_stop() after the main
+ *          server thread has stopped.
+ *
+ * @param[in] hd    Server instance data
+ */
+void httpd_async_workers_stop(struct httpd_data *hd);
+#endif /* CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT */
+
+#if CONFIG_HTTPD_SESS_USE_POLL
+/**
+ * @brief   Allocates the persistent pollfd array and seeds it with the
+ *          control and listen sockets. Must be called after the server
+ *          sockets have been created.
+ *
+ * @param[in] hd    Server instance data
+ *
+ * @return
+ *  - ESP_OK                  : on success
+ *  - ESP_ERR_HTTPD_ALLOC_MEM : if the array could not be allocated
+ */
+esp_err_t httpd_sess_poll_init(struct httpd_data *hd);
+
+/**
+ * @brief   Appends a session socket to the persistent pollfd array
+ *
+ * @param[in] hd    Server instance data
+ * @param[in] fd    Socket FD of the new session
+ */
+void httpd_sess_poll_add(struct httpd_data *hd, int fd);
+
+/**
+ * @brief   Removes a session socket from the persistent pollfd array
+ *
+ * @param[in] hd    Server instance data
+ * @param[in] fd    Socket FD of the closed session
+ */
+void httpd_sess_poll_remove(struct httpd_data *hd, int fd);
+#endif /* CONFIG_HTTPD_SESS_USE_POLL */
+
 /**
  * @brief   Starts a new session for client requesting connection and adds
  *          it's descriptor to the socket database.
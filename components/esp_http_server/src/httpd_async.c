@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <esp_log.h>
+#include <esp_err.h>
+
+#include <esp_http_server.h>
+#include "esp_httpd_priv.h"
+
+static const char *TAG = "httpd_async";
+
+/* A request handed off to the worker pool. A NULL req is the shutdown
+ * signal which makes a worker task exit. */
+typedef struct {
+    httpd_req_t *req;                   /*!< Async copy of the request (httpd_req_async_handler_begin) */
+    httpd_async_req_handler_t handler;  /*!< Handler to run on the worker task */
+} httpd_async_job_t;
+
+static void httpd_async_worker(void *arg)
+{
+    struct httpd_data *hd = (struct httpd_data *) arg;
+    httpd_async_job_t job;
+
+    while (1) {
+        if (xQueueReceive(hd->async_job_queue, &job, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (job.req == NULL) {
+            break;
+        }
+        hd->async_busy_workers++;
+        int sockfd = httpd_req_to_sockfd(job.req);
+        esp_err_t ret = job.handler(job.req);
+        /* Completing the request un-parks the session and notifies the
+         * main server task, matching the manual begin/complete flow */
+        httpd_req_async_handler_complete(job.req);
+        if (ret != ESP_OK) {
+            /* Mirror the synchronous dispatch path: a failed handler
+             * closes the underlying session */
+            ESP_LOGW(TAG, LOG_FMT("async handler failed on socket %d, closing session"), sockfd);
+            httpd_sess_trigger_close((httpd_handle_t) hd, sockfd);
+        }
+        hd->async_busy_workers--;
+    }
+
+    xSemaphoreGive(hd->async_workers_exited);
+    httpd_os_thread_delete();
+}
+
+esp_err_t httpd_async_workers_start(struct httpd_data *hd)
+{
+    hd->async_busy_workers = 0;
+    hd->async_job_queue = xQueueCreate(CONFIG_HTTPD_ASYNC_WORKERS_QUEUE_LEN, sizeof(httpd_async_job_t));
+    if (hd->async_job_queue == NULL) {
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    hd->async_workers_exited = xSemaphoreCreateCounting(CONFIG_HTTPD_ASYNC_WORKERS_COUNT, 0);
+    if (hd->async_workers_exited == NULL) {
+        vQueueDelete(hd->async_job_queue);
+        hd->async_job_queue = NULL;
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+
+    for (int i = 0; i < CONFIG_HTTPD_ASYNC_WORKERS_COUNT; i++) {
+        othread_t worker;
+        if (httpd_os_thread_create(&worker, "httpd_worker",
+                                   CONFIG_HTTPD_ASYNC_WORKERS_STACK_SIZE,
+                                   CONFIG_HTTPD_ASYNC_WORKERS_PRIORITY,
+                                   httpd_async_worker, hd,
+                                   hd->config.core_id,
+                                   hd->config.task_caps) != OS_SUCCESS) {
+            ESP_LOGE(TAG, LOG_FMT("failed to create async worker %d"), i);
+            /* Shut down the workers already running */
+            httpd_async_job_t quit = { .req = NULL };
+            for (int j = 0; j < i; j++) {
+                xQueueSend(hd->async_job_queue, &quit, portMAX_DELAY);
+            }
+            for (int j = 0; j < i; j++) {
+                xSemaphoreTake(hd->async_workers_exited, portMAX_DELAY);
+            }
+            vSemaphoreDelete(hd->async_workers_exited);
+            hd->async_workers_exited = NULL;
+            vQueueDelete(hd->async_job_queue);
+            hd->async_job_queue = NULL;
+            return ESP_ERR_HTTPD_ALLOC_MEM;
+        }
+    }
+    return ESP_OK;
+}
+
+void httpd_async_workers_stop(struct httpd_data *hd)
+{
+    if (hd->async_job_queue == NULL) {
+        return;
+    }
+    /* By this point the main server thread has stopped, so no new jobs
+     * can be submitted. Workers drain any queued jobs before they pick
+     * up the shutdown signals appended behind them. */
+    httpd_async_job_t quit = { .req = NULL };
+    for (int i = 0; i < CONFIG_HTTPD_ASYNC_WORKERS_COUNT; i++) {
+        xQueueSend(hd->async_job_queue, &quit, portMAX_DELAY);
+    }
+    for (int i = 0; i < CONFIG_HTTPD_ASYNC_WORKERS_COUNT; i++) {
+        xSemaphoreTake(hd->async_workers_exited, portMAX_DELAY);
+    }
+    vSemaphoreDelete(hd->async_workers_exited);
+    hd->async_workers_exited = NULL;
+    vQueueDelete(hd->async_job_queue);
+    hd->async_job_queue = NULL;
+}
+
+esp_err_t httpd_req_async_submit(httpd_req_t *r, httpd_async_req_handler_t handler)
+{
+    if (r == NULL || handler == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct httpd_data *hd = (struct httpd_data *) r->handle;
+    if (hd->async_job_queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* Backpressure check up front: don't bother copying the request if
+     * the pool can't accept it anyway */
+    if (uxQueueSpacesAvailable(hd->async_job_queue) == 0) {
+        ESP_LOGD(TAG, LOG_FMT("async job queue full, rejecting handoff"));
+        return ESP_ERR_NO_MEM;
+    }
+
+    httpd_async_job_t job = { .handler = handler };
+    esp_err_t ret = httpd_req_async_handler_begin(r, &job.req);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    /* Only the server task submits, so the space checked above is still
+     * free; the 0 timeout is just belt and braces */
+    if (xQueueSend(hd->async_job_queue, &job, 0) != pdTRUE) {
+        httpd_req_async_handler_complete(job.req);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_async_pending_count(httpd_handle_t handle, size_t *count)
+{
+    if (handle == NULL || count == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct httpd_data *hd = (struct httpd_data *) handle;
+    if (hd->async_job_queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *count = uxQueueMessagesWaiting(hd->async_job_queue) + hd->async_busy_workers;
+    return ESP_OK;
+}
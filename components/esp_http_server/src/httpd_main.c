@@ -31,10 +31,12 @@ static const int DEFAULT_KEEP_ALIVE_IDLE = 5;
 static const int DEFAULT_KEEP_ALIVE_INTERVAL= 5;
 static const int DEFAULT_KEEP_ALIVE_COUNT= 3;
 
+#if !CONFIG_HTTPD_SESS_USE_POLL
 typedef struct {
     fd_set *fdset;
     struct httpd_data *hd;
 } process_session_context_t;
+#endif
 
 static const char *TAG = "httpd";
 
@@ -237,6 +239,79 @@ static void httpd_process_ctrl_msg(struct httpd_data *hd)
 #endif
 }
 
+#if CONFIG_HTTPD_SESS_USE_POLL
+
+/* Manage in-coming connection or data requests using the persistent
+ * pollfd array maintained by httpd_sess.c */
+static esp_err_t httpd_server(struct httpd_data *hd)
+{
+    struct pollfd *pfds = hd->hd_poll_fds;
+
+    /* The array membership is maintained incrementally on session open/close;
+     * only the per-iteration event masks need refreshing here */
+    pfds[0].events = POLLIN;
+    /* Only listen for new connections if server has capacity to
+     * handle more (or when LRU purge is enabled, in which case
+     * older connections will be closed) */
+    pfds[1].events = (hd->config.lru_purge_enable || httpd_is_sess_available(hd)) ? POLLIN : 0;
+    for (int i = 2; i < hd->hd_poll_cnt; i++) {
+        struct sock_db *session = httpd_sess_get(hd, pfds[i].fd);
+        /* Sessions busy in an async task are not polled here */
+        pfds[i].events = (session && !session->for_async_req) ? POLLIN : 0;
+        pfds[i].revents = 0;
+    }
+
+    ESP_LOGD(TAG, LOG_FMT("doing poll nfds = %d"), hd->hd_poll_cnt);
+    int active_cnt = poll(pfds, hd->hd_poll_cnt, -1);
+    if (active_cnt < 0) {
+        ESP_LOGE(TAG, LOG_FMT("error in poll (%d)"), errno);
+        httpd_sess_delete_invalid(hd);
+        return ESP_OK;
+    }
+
+    /* Case0: Do we have a control message? */
+    if (pfds[0].revents & (POLLIN | POLLERR | POLLHUP)) {
+        ESP_LOGD(TAG, LOG_FMT("processing ctrl message"));
+        httpd_process_ctrl_msg(hd);
+        if (hd->hd_td.status == THREAD_STOPPING) {
+            ESP_LOGD(TAG, LOG_FMT("stopping thread"));
+            return ESP_FAIL;
+        }
+    }
+
+    /* Case1: Drain every ready data session in this wakeup. Closing a session
+     * swap-removes its pollfd entry (together with its revents), so the index
+     * is only advanced when the current entry is kept */
+    for (int i = 2; i < hd->hd_poll_cnt; ) {
+        struct sock_db *session = httpd_sess_get(hd, pfds[i].fd);
+        if (!session || session->for_async_req) {
+            i++;
+            continue;
+        }
+        bool ready = (pfds[i].revents & (POLLIN | POLLERR | POLLHUP)) != 0;
+        if (ready || httpd_sess_pending(hd, session)) {
+            ESP_LOGD(TAG, LOG_FMT("processing socket %d"), session->fd);
+            if (httpd_sess_process(hd, session) != ESP_OK) {
+                httpd_sess_delete(hd, session); // Delete session
+                continue;
+            }
+        }
+        i++;
+    }
+
+    /* Case2: Do we have any incoming connection requests to
+     * process? */
+    if (pfds[1].revents & POLLIN) {
+        ESP_LOGD(TAG, LOG_FMT("processing listen socket %d"), hd->listen_fd);
+        if (httpd_accept_conn(hd, hd->listen_fd) != ESP_OK) {
+            ESP_LOGW(TAG, LOG_FMT("error accepting new connection"));
+        }
+    }
+    return ESP_OK;
+}
+
+#else /* !CONFIG_HTTPD_SESS_USE_POLL */
+
 // Called for each session from httpd_server
 static int httpd_process_session(struct sock_db *session, void *context)
 {
@@ -321,6 +396,8 @@ static esp_err_t httpd_server(struct httpd_data *hd)
     return ESP_OK;
 }
 
+#endif /* !CONFIG_HTTPD_SESS_USE_POLL */
+
 /* The main HTTPD thread */
 static void httpd_thread(void *arg)
 {
@@ -464,6 +541,9 @@ static void httpd_delete(struct httpd_data *hd)
 {
     struct httpd_req_aux *ra = &hd->hd_req_aux;
     /* Free memory of httpd instance data */
+#if CONFIG_HTTPD_SESS_USE_POLL
+    free(hd->hd_poll_fds);
+#endif
     free(hd->err_handler_fns);
     free(ra->resp_hdrs);
     free(hd->hd_sd);
@@ -520,6 +600,26 @@ esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
         return ESP_FAIL;
     }
 
+#if CONFIG_HTTPD_SESS_USE_POLL
+    if (httpd_sess_poll_init(hd) != ESP_OK) {
+        close(hd->msg_fd);
+        cs_free_ctrl_sock(hd->ctrl_fd);
+        close(hd->listen_fd);
+        httpd_delete(hd);
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+#endif
+
+#if CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT
+    if (httpd_async_workers_start(hd) != ESP_OK) {
+        close(hd->msg_fd);
+        cs_free_ctrl_sock(hd->ctrl_fd);
+        close(hd->listen_fd);
+        httpd_delete(hd);
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+#endif
+
     httpd_sess_init(hd);
     if (httpd_os_thread_create(&hd->hd_td.handle, "httpd",
                                hd->config.stack_size,
@@ -528,6 +628,9 @@ esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
                                hd->config.core_id,
                                hd->config.task_caps) != ESP_OK) {
         /* Failed to launch task */
+#if CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT
+        httpd_async_workers_stop(hd);
+#endif
         httpd_delete(hd);
         return ESP_ERR_HTTPD_TASK;
     }
@@ -560,6 +663,12 @@ esp_err_t httpd_stop(httpd_handle_t handle)
         httpd_os_thread_sleep(100);
     }
 
+#if CONFIG_HTTPD_ASYNC_WORKERS_SUPPORT
+    /* Join the worker pool after the server thread has stopped, so no new
+     * jobs can arrive while the workers drain */
+    httpd_async_workers_stop(hd);
+#endif
+
     /* Release global user context, if not NULL */
     if (hd->config.global_user_ctx) {
         if (hd->config.global_user_ctx_free_fn) {
@@ -213,6 +213,10 @@ esp_err_t httpd_sess_new(struct httpd_data *hd, int newfd)
     // increment number of sessions
     hd->hd_sd_active_count++;
 
+#if CONFIG_HTTPD_SESS_USE_POLL
+    httpd_sess_poll_add(hd, newfd);
+#endif
+
     // Call user-defined session opening function
     if (hd->config.open_fn) {
         esp_err_t ret = hd->config.open_fn(hd, session->fd);
@@ -228,6 +232,56 @@ esp_err_t httpd_sess_new(struct httpd_data *hd, int newfd)
     return ESP_OK;
 }
 
+#if CONFIG_HTTPD_SESS_USE_POLL
+esp_err_t httpd_sess_poll_init(struct httpd_data *hd)
+{
+    /* Two extra slots for the control and listen sockets */
+    hd->hd_poll_fds = calloc(hd->config.max_open_sockets + 2, sizeof(struct pollfd));
+    if (!hd->hd_poll_fds) {
+        ESP_LOGE(TAG, LOG_FMT("Failed to allocate memory for pollfd array"));
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    hd->hd_poll_fds[0].fd = hd->ctrl_fd;
+    hd->hd_poll_fds[0].events = POLLIN;
+    hd->hd_poll_fds[1].fd = hd->listen_fd;
+    hd->hd_poll_fds[1].events = POLLIN;
+    hd->hd_poll_cnt = 2;
+    return ESP_OK;
+}
+
+void httpd_sess_poll_add(struct httpd_data *hd, int fd)
+{
+    if (!hd->hd_poll_fds) {
+        return;
+    }
+    if (hd->hd_poll_cnt >= hd->config.max_open_sockets + 2) {
+        /* Cannot happen while the array tracks the socket database */
+        ESP_LOGE(TAG, LOG_FMT("pollfd array full"));
+        return;
+    }
+    struct pollfd *entry = &hd->hd_poll_fds[hd->hd_poll_cnt++];
+    entry->fd = fd;
+    entry->events = POLLIN;
+    entry->revents = 0;
+}
+
+void httpd_sess_poll_remove(struct httpd_data *hd, int fd)
+{
+    if (!hd->hd_poll_fds) {
+        return;
+    }
+    /* Session entries start after the control and listen sockets */
+    for (int i = 2; i < hd->hd_poll_cnt; i++) {
+        if (hd->hd_poll_fds[i].fd == fd) {
+            /* Keep the array compact: move the last entry into the hole */
+            hd->hd_poll_fds[i] = hd->hd_poll_fds[hd->hd_poll_cnt - 1];
+            hd->hd_poll_cnt--;
+            return;
+        }
+    }
+}
+#endif /* CONFIG_HTTPD_SESS_USE_POLL */
+
 void httpd_sess_free_ctx(void **ctx, httpd_free_ctx_fn_t free_fn)
 {
     if ((!ctx) || (!*ctx)) {
@@ -331,6 +385,21 @@ void httpd_sess_set_transport_ctx(httpd_handle_t handle, int sockfd, void *ctx,
     session->free_transport_ctx = free_fn;
 }
 
+esp_err_t httpd_sess_set_parked(httpd_handle_t handle, int sockfd, bool parked)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct sock_db *session = httpd_sess_get(handle, sockfd);
+    if (!session) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    session->for_async_req = parked;
+    return ESP_OK;
+}
+
 void httpd_sess_set_descriptors(struct httpd_data *hd, fd_set *fdset, int *maxfd)
 {
     enum_context_t context = {
@@ -382,6 +451,10 @@ void httpd_sess_delete(struct httpd_data *hd, struct sock_db *session)
     // clear all contexts
     httpd_sess_clear_ctx(session);
 
+#if CONFIG_HTTPD_SESS_USE_POLL
+    httpd_sess_poll_remove(hd, session->fd);
+#endif
+
     // mark session slot as available
     session->fd = -1;
 
@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <esp_log.h>
+#include <esp_rom_crc.h>
+#include <esp_http_server.h>
+
+static const char *TAG = "httpd_static";
+
+/* "crc32-length" in hex, quoted: "xxxxxxxx-xxxxxxxx" */
+#define STATIC_ETAG_LEN 20
+
+typedef struct {
+    const httpd_static_asset_t *asset;
+    char etag[STATIC_ETAG_LEN];
+} static_asset_rt_t;
+
+typedef struct static_table {
+    struct static_table *next;
+    httpd_handle_t handle;
+    const httpd_static_asset_t *assets;
+    size_t num_assets;
+    static_asset_rt_t rt[];
+} static_table_t;
+
+/* All registered tables across server instances; only touched from the
+ * contexts that also call httpd_register_uri_handler(), which the server
+ * requires to be serialized anyway */
+static static_table_t *s_tables;
+
+static bool accepts_gzip(httpd_req_t *req)
+{
+    char buf[64];
+    if (httpd_req_get_hdr_value_str(req, "Accept-Encoding", buf, sizeof(buf)) != ESP_OK) {
+        return false;
+    }
+    return strstr(buf, "gzip") != NULL;
+}
+
+/* Parses a single "bytes=" range against a body of body_len bytes.
+ * Returns 1 with *out_start/*out_len set for a satisfiable range, -1 for a
+ * syntactically valid but unsatisfiable one, and 0 when the header cannot be
+ * parsed (per RFC 9110 such a header is ignored and the full body served). */
+static int parse_range(const char *val, size_t body_len, size_t *out_start, size_t *out_len)
+{
+    if (strncmp(val, "bytes=", 6) != 0) {
+        return 0;
+    }
+    val += 6;
+    char *end;
+    if (*val == '-') {
+        /* suffix form: last N bytes */
+        unsigned long suffix = strtoul(val + 1, &end, 10);
+        if ((end == val + 1) || (*end != '\0') || (suffix == 0)) {
+            return 0;
+        }
+        if (suffix > body_len) {
+            suffix = body_len;
+        }
+        *out_start = body_len - suffix;
+        *out_len = suffix;
+        return 1;
+    }
+    unsigned long start = strtoul(val, &end, 10);
+    if ((end == val) || (*end != '-')) {
+        return 0;
+    }
+    if (start >= body_len) {
+        return -1;
+    }
+    const char *last_str = end + 1;
+    if (*last_str == '\0') {
+        /* open-ended: from start to the end of the body */
+        *out_start = start;
+        *out_len = body_len - start;
+        return 1;
+    }
+    unsigned long last = strtoul(last_str, &end, 10);
+    if ((end == last_str) || (*end != '\0') || (last < start)) {
+        return 0;
+    }
+    if (last >= body_len) {
+        last = body_len - 1;
+    }
+    *out_start = start;
+    *out_len = last - start + 1;
+    return 1;
+}
+
+static esp_err_t static_asset_handler(httpd_req_t *req)
+{
+    const static_asset_rt_t *rt = (const static_asset_rt_t *)req->user_ctx;
+    const httpd_static_asset_t *asset = rt->asset;
+
+    bool use_gz = (asset->data_gz != NULL) && accepts_gzip(req);
+    const uint8_t *body = use_gz ? asset->data_gz : asset->data;
+    size_t body_len = use_gz ? asset->data_gz_len : asset->data_len;
+
+    if (asset->content_type != NULL) {
+        httpd_resp_set_type(req, asset->content_type);
+    }
+    httpd_resp_set_hdr(req, "ETag", rt->etag);
+    httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+    char cache_ctrl[32];
+    if (asset->max_age > 0) {
+        snprintf(cache_ctrl, sizeof(cache_ctrl), "max-age=%" PRIu32, asset->max_age);
+        httpd_resp_set_hdr(req, "Cache-Control", cache_ctrl);
+    } else {
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    }
+    if (asset->data_gz != NULL) {
+        httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+    }
+    if (use_gz) {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    }
+
+    char hdr[64];
+    if ((httpd_req_get_hdr_value_str(req, "If-None-Match", hdr, sizeof(hdr)) == ESP_OK) &&
+        (strstr(hdr, rt->etag) != NULL)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    size_t start = 0;
+    size_t part_len = body_len;
+    char content_range[48];
+    if (httpd_req_get_hdr_value_str(req, "Range", hdr, sizeof(hdr)) == ESP_OK) {
+        int ret = parse_range(hdr, body_len, &start, &part_len);
+        if (ret < 0) {
+            snprintf(content_range, sizeof(content_range), "bytes */%u", (unsigned)body_len);
+            httpd_resp_set_hdr(req, "Content-Range", content_range);
+            httpd_resp_set_status(req, "416 Requested Range Not Satisfiable");
+            return httpd_resp_send(req, NULL, 0);
+        }
+        if (ret > 0) {
+            snprintf(content_range, sizeof(content_range), "bytes %u-%u/%u",
+                     (unsigned)start, (unsigned)(start + part_len - 1), (unsigned)body_len);
+            httpd_resp_set_hdr(req, "Content-Range", content_range);
+            httpd_resp_set_status(req, "206 Partial Content");
+        }
+    }
+
+    /* The response is sent straight from the asset memory: no staging copy */
+    return httpd_resp_send(req, (const char *)body + start, part_len);
+}
+
+esp_err_t httpd_register_static_assets(httpd_handle_t handle,
+                                       const httpd_static_asset_t *assets, size_t num_assets)
+{
+    if ((handle == NULL) || (assets == NULL) || (num_assets == 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < num_assets; i++) {
+        if ((assets[i].uri == NULL) || (assets[i].data == NULL)) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    static_table_t *tab = calloc(1, sizeof(static_table_t) + num_assets * sizeof(static_asset_rt_t));
+    if (tab == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    tab->handle = handle;
+    tab->assets = assets;
+    tab->num_assets = num_assets;
+
+    for (size_t i = 0; i < num_assets; i++) {
+        tab->rt[i].asset = &assets[i];
+        uint32_t crc = esp_rom_crc32_le(0, assets[i].data, assets[i].data_len);
+        snprintf(tab->rt[i].etag, sizeof(tab->rt[i].etag), "\"%08" PRIx32 "-%x\"",
+                 crc, (unsigned)assets[i].data_len);
+
+        httpd_uri_t uri_handler = {
+            .uri = assets[i].uri,
+            .method = HTTP_GET,
+            .handler = static_asset_handler,
+            .user_ctx = &tab->rt[i],
+        };
+        esp_err_t err = httpd_register_uri_handler(handle, &uri_handler);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "failed to register %s (0x%x)", assets[i].uri, err);
+            while (i-- > 0) {
+                httpd_unregister_uri_handler(handle, assets[i].uri, HTTP_GET);
+            }
+            free(tab);
+            return err;
+        }
+    }
+
+    tab->next = s_tables;
+    s_tables = tab;
+    return ESP_OK;
+}
+
+esp_err_t httpd_unregister_static_assets(httpd_handle_t handle,
+                                         const httpd_static_asset_t *assets)
+{
+    if ((handle == NULL) || (assets == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    static_table_t **prev = &s_tables;
+    while (*prev != NULL) {
+        static_table_t *tab = *prev;
+        if ((tab->handle == handle) && (tab->assets == assets)) {
+            for (size_t i = 0; i < tab->num_assets; i++) {
+                httpd_unregister_uri_handler(handle, tab->assets[i].uri, HTTP_GET);
+            }
+            *prev = tab->next;
+            free(tab);
+            return ESP_OK;
+        }
+        prev = &tab->next;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
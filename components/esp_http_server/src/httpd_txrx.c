@@ -65,13 +65,13 @@ int httpd_send(httpd_req_t *r, const char *buf, size_t buf_len)
     return ret;
 }
 
-static esp_err_t httpd_send_all(httpd_req_t *r, const char *buf, size_t buf_len)
+static esp_err_t httpd_send_all_flags(httpd_req_t *r, const char *buf, size_t buf_len, int flags)
 {
     struct httpd_req_aux *ra = r->aux;
     int ret;
 
     while (buf_len > 0) {
-        ret = ra->sd->send_fn(ra->sd->handle, ra->sd->fd, buf, buf_len, 0);
+        ret = ra->sd->send_fn(ra->sd->handle, ra->sd->fd, buf, buf_len, flags);
         if (ret < 0) {
             ESP_LOGD(TAG, LOG_FMT("error in send_fn"));
             return ESP_FAIL;
@@ -83,6 +83,54 @@ static esp_err_t httpd_send_all(httpd_req_t *r, const char *buf, size_t buf_len)
     return ESP_OK;
 }
 
+static esp_err_t httpd_send_all(httpd_req_t *r, const char *buf, size_t buf_len)
+{
+    return httpd_send_all_flags(r, buf, buf_len, 0);
+}
+
+/* Send all fragments of an iovec array, flagging every fragment except the
+ * last with MSG_MORE so that lwIP coalesces them into full sized segments */
+static esp_err_t httpd_sendv_all(httpd_req_t *r, const struct iovec *iov, size_t iov_cnt)
+{
+    for (size_t i = 0; i < iov_cnt; i++) {
+        int flags = (i + 1 < iov_cnt) ? MSG_MORE : 0;
+        if (httpd_send_all_flags(r, iov[i].iov_base, iov[i].iov_len, flags) != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+int httpd_sendv(httpd_req_t *r, const struct iovec *iov, size_t iov_cnt)
+{
+    if (r == NULL || iov == NULL || iov_cnt == 0) {
+        return HTTPD_SOCK_ERR_INVALID;
+    }
+
+    if (!httpd_valid_req(r)) {
+        return HTTPD_SOCK_ERR_INVALID;
+    }
+
+    struct httpd_req_aux *ra = r->aux;
+    int total = 0;
+    for (size_t i = 0; i < iov_cnt; i++) {
+        const char *buf = iov[i].iov_base;
+        size_t buf_len = iov[i].iov_len;
+        int flags = (i + 1 < iov_cnt) ? MSG_MORE : 0;
+        while (buf_len > 0) {
+            int ret = ra->sd->send_fn(ra->sd->handle, ra->sd->fd, buf, buf_len, flags);
+            if (ret < 0) {
+                ESP_LOGD(TAG, LOG_FMT("error in send_fn"));
+                return ret;
+            }
+            buf     += ret;
+            buf_len -= ret;
+            total   += ret;
+        }
+    }
+    return total;
+}
+
 static size_t httpd_recv_pending(httpd_req_t *r, char *buf, size_t buf_len)
 {
     struct httpd_req_aux *ra = r->aux;
@@ -321,6 +369,103 @@ esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
     return ESP_OK;
 }
 
+esp_err_t httpd_resp_sendv(httpd_req_t *r, const struct iovec *body_iov, size_t body_iov_cnt)
+{
+    if (r == NULL || (body_iov == NULL && body_iov_cnt > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (!httpd_valid_req(r)) {
+        return ESP_ERR_HTTPD_INVALID_REQ;
+    }
+
+    struct httpd_req_aux *ra = r->aux;
+    const char *httpd_hdr_str = "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %d\r\n";
+
+    ssize_t buf_len = 0;
+    for (size_t i = 0; i < body_iov_cnt; i++) {
+        buf_len += body_iov[i].iov_len;
+    }
+
+    /* Request headers are no longer available */
+    ra->req_hdrs_count = 0;
+
+    /* Calculate the size of the essential headers. +1 for the null terminator */
+    size_t required_size = snprintf(NULL, 0, httpd_hdr_str, ra->status, ra->content_type, buf_len) + 1;
+    if (required_size > ra->max_req_hdr_len) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+
+    /* Assemble the whole header block in one buffer, so that headers and body
+     * leave as one scatter-gather submission instead of many small segments */
+    size_t total_size = required_size + strlen("\r\n");
+    for (unsigned i = 0; i < ra->resp_hdrs_count; i++) {
+        total_size += strlen(ra->resp_hdrs[i].field) + strlen(": ") +
+                      strlen(ra->resp_hdrs[i].value) + strlen("\r\n");
+    }
+    char *res_buf = malloc(total_size);
+    if (res_buf == NULL) {
+        ESP_LOGE(TAG, "Unable to allocate httpd send buffer");
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+
+    int hdr_len = snprintf(res_buf, total_size, httpd_hdr_str, ra->status, ra->content_type, buf_len);
+    if (hdr_len < 0 || hdr_len >= total_size) {
+        free(res_buf);
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+
+    /* Append additional headers based on set_header */
+    for (unsigned i = 0; i < ra->resp_hdrs_count; i++) {
+        int ret = snprintf(res_buf + hdr_len, total_size - hdr_len, "%s: %s\r\n",
+                           ra->resp_hdrs[i].field, ra->resp_hdrs[i].value);
+        if (ret < 0 || ret >= total_size - hdr_len) {
+            free(res_buf);
+            return ESP_ERR_HTTPD_RESP_HDR;
+        }
+        hdr_len += ret;
+    }
+
+    /* End header section */
+    int ret = snprintf(res_buf + hdr_len, total_size - hdr_len, "\r\n");
+    if (ret < 0 || ret >= total_size - hdr_len) {
+        free(res_buf);
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    hdr_len += ret;
+
+    struct iovec *iov = malloc((body_iov_cnt + 1) * sizeof(struct iovec));
+    if (iov == NULL) {
+        free(res_buf);
+        ESP_LOGE(TAG, "Unable to allocate httpd iovec array");
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    iov[0].iov_base = res_buf;
+    iov[0].iov_len = hdr_len;
+    for (size_t i = 0; i < body_iov_cnt; i++) {
+        iov[i + 1] = body_iov[i];
+    }
+
+    esp_err_t send_err = httpd_sendv_all(r, iov, body_iov_cnt + 1);
+    free(iov);
+    free(res_buf);
+    if (send_err != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+
+    struct httpd_data *hd = (struct httpd_data *) r->handle;
+    hd->http_server_state = HTTP_SERVER_EVENT_HEADERS_SENT;
+    esp_http_server_dispatch_event(HTTP_SERVER_EVENT_HEADERS_SENT, &(ra->sd->fd), sizeof(int));
+
+    esp_http_server_event_data evt_data = {
+        .fd = ra->sd->fd,
+        .data_len = buf_len,
+    };
+    hd->http_server_state = HTTP_SERVER_EVENT_SENT_DATA;
+    esp_http_server_dispatch_event(HTTP_SERVER_EVENT_SENT_DATA, &evt_data, sizeof(esp_http_server_event_data));
+    return ESP_OK;
+}
+
 esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len)
 {
     if (r == NULL) {
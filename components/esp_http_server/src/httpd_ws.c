@@ -43,10 +43,53 @@ static const char *TAG="httpd_ws";
  */
 #define HTTPD_WS_CONTINUE       0x00U
 #define HTTPD_WS_FIN_BIT        0x80U
+#define HTTPD_WS_RSV1_BIT       0x40U
 #define HTTPD_WS_OPCODE_BITS    0x0fU
 #define HTTPD_WS_MASK_BIT       0x80U
 #define HTTPD_WS_LENGTH_BITS    0x7fU
 
+/* Maximum WS header length the server generates: 2 bytes header + 8 bytes extended length
+ * (the server does not mask its frames, so no mask key is appended) */
+#define HTTPD_WS_HEADER_LEN_MAX 10U
+
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+#include "miniz.h"
+
+/* Payloads shorter than this are cheaper to send as-is than to deflate */
+#define HTTPD_WS_DEFLATE_MIN_LEN 64U
+
+/* Scratch buffer shared by all sessions for deflating outgoing and inflating incoming
+ * messages. Both directions are negotiated without context takeover, so no compression
+ * state survives between messages. WS handlers are not confined to the server task —
+ * httpd_req_async_handler_begin() moves them to user tasks, the async worker pool
+ * dispatches them to workers, and httpd_ws_send_frame_async() is callable from
+ * anywhere — so the buffer is serialized with a mutex, held until the frame pointing
+ * into it has been handed to send_fn(). */
+static uint8_t s_ws_deflate_buf[CONFIG_HTTPD_WS_DEFLATE_BUFFER_SIZE];
+static SemaphoreHandle_t s_ws_deflate_lock;
+static StaticSemaphore_t s_ws_deflate_lock_buf;
+static portMUX_TYPE s_ws_deflate_lock_init_mux = portMUX_INITIALIZER_UNLOCKED;
+
+/* The lock is created on first use; sessions of every server instance share it,
+ * matching the buffer's lifetime */
+static void httpd_ws_deflate_lock_take(void)
+{
+    if (!s_ws_deflate_lock) {
+        portENTER_CRITICAL(&s_ws_deflate_lock_init_mux);
+        if (!s_ws_deflate_lock) {
+            s_ws_deflate_lock = xSemaphoreCreateMutexStatic(&s_ws_deflate_lock_buf);
+        }
+        portEXIT_CRITICAL(&s_ws_deflate_lock_init_mux);
+    }
+    xSemaphoreTake(s_ws_deflate_lock, portMAX_DELAY);
+}
+
+static void httpd_ws_deflate_lock_give(void)
+{
+    xSemaphoreGive(s_ws_deflate_lock);
+}
+#endif
+
 /*
  * The magic GUID string used for handshake
  * Please refer to RFC6455 Section 1.3 for more details.
@@ -178,8 +221,24 @@ esp_err_t httpd_ws_respond_server_handshake(httpd_req_t *req, const char *suppor
     }
 
 
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    /* Detect the permessage-deflate offer (RFC 7692). The response is negotiated without
+     * context takeover in either direction, so every message is a self-contained deflate
+     * stream and no per-session compression state has to be kept. */
+    bool ws_deflate = false;
+    char extensions[128] = { '\0' };
+    esp_err_t ext_ret = httpd_req_get_hdr_value_str(req, "Sec-WebSocket-Extensions", extensions, sizeof(extensions) - 1);
+    if (ext_ret == ESP_OK || ext_ret == ESP_ERR_HTTPD_RESULT_TRUNC) {
+        ws_deflate = (strstr(extensions, "permessage-deflate") != NULL);
+    }
+#endif
+
     /* Prepare the Switching Protocol response */
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    char tx_buf[320] = { '\0' };
+#else
     char tx_buf[192] = { '\0' };
+#endif
     int fmt_len = snprintf(tx_buf, sizeof(tx_buf),
                            "HTTP/1.1 101 Switching Protocols\r\n"
                            "Upgrade: websocket\r\n"
@@ -209,6 +268,20 @@ esp_err_t httpd_ws_respond_server_handshake(httpd_req_t *req, const char *suppor
         }
     }
 
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    if (ws_deflate) {
+        int ext_len = snprintf(tx_buf + fmt_len, sizeof(tx_buf) - fmt_len,
+                               "Sec-WebSocket-Extensions: permessage-deflate; "
+                               "server_no_context_takeover; client_no_context_takeover\r\n");
+        if (ext_len <= 0 || ext_len >= sizeof(tx_buf) - fmt_len) {
+            ESP_LOGE(TAG, "Error in response generation"
+                          "(snprintf of extensions returned %d, buffer size: %"NEWLIB_NANO_COMPAT_FORMAT, ext_len, NEWLIB_NANO_COMPAT_CAST(sizeof(tx_buf)));
+            return ESP_FAIL;
+        }
+        fmt_len += ext_len;
+    }
+#endif
+
     int r = snprintf(tx_buf + fmt_len, sizeof(tx_buf) - fmt_len, "\r\n");
     if (r <= 0) {
         ESP_LOGE(TAG, "Error in response generation"
@@ -228,6 +301,13 @@ esp_err_t httpd_ws_respond_server_handshake(httpd_req_t *req, const char *suppor
         return ESP_FAIL;
     }
 
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    req_aux->sd->ws_deflate_enabled = ws_deflate;
+    if (ws_deflate) {
+        ESP_LOGD(TAG, LOG_FMT("permessage-deflate negotiated"));
+    }
+#endif
+
     return ESP_OK;
 }
 
@@ -381,6 +461,30 @@ esp_err_t httpd_ws_recv_frame(httpd_req_t *req, httpd_ws_frame_t *frame, size_t
     /* Unmask payload */
     httpd_ws_unmask_payload(frame->payload, frame->len, aux->mask_key);
 
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    if (aux->ws_compressed && frame->len > 0) {
+        /* Stage the compressed payload in the scratch buffer and terminate it with the
+         * 0x00 0x00 0xff 0xff tail the sender removed (RFC 7692 Section 7.2.2), then
+         * inflate straight into the caller's buffer */
+        if (frame->len + 4 > sizeof(s_ws_deflate_buf)) {
+            ESP_LOGW(TAG, LOG_FMT("Compressed WS message does not fit the deflate buffer"));
+            return ESP_ERR_INVALID_SIZE;
+        }
+        httpd_ws_deflate_lock_take();
+        memcpy(s_ws_deflate_buf, frame->payload, frame->len);
+        memcpy(s_ws_deflate_buf + frame->len, "\x00\x00\xff\xff", 4);
+        size_t inflated_len = tinfl_decompress_mem_to_mem(frame->payload, max_len,
+                                                          s_ws_deflate_buf, frame->len + 4, 0);
+        httpd_ws_deflate_lock_give();
+        if (inflated_len == TINFL_DECOMPRESS_MEM_TO_MEM_FAILED) {
+            ESP_LOGW(TAG, LOG_FMT("Failed to inflate WS message (payload buffer too small or malformed data)"));
+            return ESP_FAIL;
+        }
+        frame->len = inflated_len;
+        aux->ws_compressed = false;
+    }
+#endif
+
     return ESP_OK;
 }
 
@@ -393,19 +497,18 @@ esp_err_t httpd_ws_send_frame(httpd_req_t *req, httpd_ws_frame_t *frame)
     return httpd_ws_send_frame_async(req->handle, httpd_req_to_sockfd(req), frame);
 }
 
-esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame)
+/* Build a WS frame header into header_buf (at least HTTPD_WS_HEADER_LEN_MAX bytes long),
+ * returns the header length */
+static uint8_t httpd_ws_build_header(const httpd_ws_frame_t *frame, bool compressed, uint8_t *header_buf)
 {
-    if (!frame) {
-        ESP_LOGW(TAG, LOG_FMT("Argument is invalid"));
-        return ESP_ERR_INVALID_ARG;
-    }
-
-    /* Prepare Tx buffer - maximum length is 14, which includes 2 bytes header, 8 bytes length, 4 bytes mask key */
     uint8_t tx_len = 0;
-    uint8_t header_buf[10] = {0 };
+    header_buf[0] = 0;
     /* Set the `FIN` bit by default if message is not fragmented. Else, set it as per the `final` field */
     header_buf[0] |= (!frame->fragmented) ? HTTPD_WS_FIN_BIT : (frame->final? HTTPD_WS_FIN_BIT: HTTPD_WS_CONTINUE);
     header_buf[0] |= frame->type; /* Type (opcode): 4 bits */
+    if (compressed) {
+        header_buf[0] |= HTTPD_WS_RSV1_BIT; /* RSV1 marks a permessage-deflate compressed message */
+    }
 
     if (frame->len <= 125) {
         header_buf[1] = frame->len & 0x7fU; /* Length for 7 bits */
@@ -430,11 +533,39 @@ esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t
 
     /* WebSocket server does not required to mask response payload, so leave the MASK bit as 0. */
     header_buf[1] &= (~HTTPD_WS_MASK_BIT);
+    return tx_len;
+}
 
-    struct sock_db *sess = httpd_sess_get(hd, fd);
-    if (!sess) {
-        return ESP_ERR_INVALID_ARG;
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+/* Try to deflate the payload of an outgoing data frame into the shared scratch buffer.
+ * On success the frame is rewritten to point at the compressed payload and true is
+ * returned; frames that are too small, don't shrink or don't fit are left untouched. */
+static bool httpd_ws_try_deflate(struct sock_db *sess, httpd_ws_frame_t *frame)
+{
+    if (!sess->ws_deflate_enabled || frame->fragmented || frame->payload == NULL ||
+            frame->len < HTTPD_WS_DEFLATE_MIN_LEN ||
+            (frame->type != HTTPD_WS_TYPE_TEXT && frame->type != HTTPD_WS_TYPE_BINARY)) {
+        return false;
+    }
+    /* Whole message in one raw deflate stream. The receiver appends the 0x00 0x00 0xff 0xff
+     * tail per RFC 7692, which lands behind the final block and is ignored by the inflater. */
+    size_t deflated_len = tdefl_compress_mem_to_mem(s_ws_deflate_buf, sizeof(s_ws_deflate_buf),
+                                                    frame->payload, frame->len, TDEFL_DEFAULT_MAX_PROBES);
+    if (deflated_len == 0 || deflated_len >= frame->len) {
+        return false;
     }
+    frame->payload = s_ws_deflate_buf;
+    frame->len = deflated_len;
+    return true;
+}
+#endif
+
+/* Send header and payload of a single prepared frame */
+static esp_err_t httpd_ws_send_frame_now(httpd_handle_t hd, int fd, struct sock_db *sess,
+                                         const httpd_ws_frame_t *tx_frame, bool compressed)
+{
+    uint8_t header_buf[HTTPD_WS_HEADER_LEN_MAX] = { 0 };
+    uint8_t tx_len = httpd_ws_build_header(tx_frame, compressed, header_buf);
 
     /* Send off header */
     if (sess->send_fn(hd, fd, (const char *)header_buf, tx_len, 0) < 0) {
@@ -443,8 +574,8 @@ esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t
     }
 
     /* Send off payload */
-    if(frame->len > 0 && frame->payload != NULL) {
-        if (sess->send_fn(hd, fd, (const char *)frame->payload, frame->len, 0) < 0) {
+    if(tx_frame->len > 0 && tx_frame->payload != NULL) {
+        if (sess->send_fn(hd, fd, (const char *)tx_frame->payload, tx_frame->len, 0) < 0) {
             ESP_LOGW(TAG, LOG_FMT("Failed to send WS payload"));
             return ESP_FAIL;
         }
@@ -453,6 +584,112 @@ esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t
     return ESP_OK;
 }
 
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame)
+{
+    if (!frame) {
+        ESP_LOGW(TAG, LOG_FMT("Argument is invalid"));
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct sock_db *sess = httpd_sess_get(hd, fd);
+    if (!sess) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    httpd_ws_frame_t tx_frame = *frame;
+
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    if (sess->ws_deflate_enabled) {
+        /* The compressed frame points into the shared scratch buffer, so the
+         * lock is held until the payload has been handed to send_fn() */
+        httpd_ws_deflate_lock_take();
+        bool compressed = httpd_ws_try_deflate(sess, &tx_frame);
+        esp_err_t ret = httpd_ws_send_frame_now(hd, fd, sess, &tx_frame, compressed);
+        httpd_ws_deflate_lock_give();
+        return ret;
+    }
+#endif
+
+    return httpd_ws_send_frame_now(hd, fd, sess, &tx_frame, false);
+}
+
+esp_err_t httpd_ws_send_frame_batch_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frames, size_t frame_count)
+{
+    if (!frames || frame_count == 0) {
+        ESP_LOGW(TAG, LOG_FMT("Argument is invalid"));
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct sock_db *sess = httpd_sess_get(hd, fd);
+    if (!sess) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* Worst case size: full header plus the uncompressed payload for every frame
+     * (compression is only kept when it shrinks the payload) */
+    size_t total_len = 0;
+    for (size_t i = 0; i < frame_count; i++) {
+        total_len += HTTPD_WS_HEADER_LEN_MAX + frames[i].len;
+    }
+
+    uint8_t *batch_buf = malloc(total_len);
+    if (!batch_buf) {
+        /* Not enough memory to coalesce, fall back to sending the frames one by one */
+        ESP_LOGD(TAG, LOG_FMT("No memory for batch buffer, sending frames separately"));
+        for (size_t i = 0; i < frame_count; i++) {
+            esp_err_t ret = httpd_ws_send_frame_async(hd, fd, &frames[i]);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+        return ESP_OK;
+    }
+
+    size_t used_len = 0;
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    /* Each compressed payload is copied out of the shared scratch buffer right
+     * away, so the lock only needs to span the coalescing loop */
+    if (sess->ws_deflate_enabled) {
+        httpd_ws_deflate_lock_take();
+    }
+#endif
+    for (size_t i = 0; i < frame_count; i++) {
+        httpd_ws_frame_t tx_frame = frames[i];
+        bool compressed = false;
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+        compressed = httpd_ws_try_deflate(sess, &tx_frame);
+#endif
+        used_len += httpd_ws_build_header(&tx_frame, compressed, batch_buf + used_len);
+        if (tx_frame.len > 0 && tx_frame.payload != NULL) {
+            memcpy(batch_buf + used_len, tx_frame.payload, tx_frame.len);
+            used_len += tx_frame.len;
+        }
+    }
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    if (sess->ws_deflate_enabled) {
+        httpd_ws_deflate_lock_give();
+    }
+#endif
+
+    /* Flush all coalesced frames with a single send */
+    esp_err_t ret = ESP_OK;
+    if (sess->send_fn(hd, fd, (const char *)batch_buf, used_len, 0) < 0) {
+        ESP_LOGW(TAG, LOG_FMT("Failed to send WS frame batch"));
+        ret = ESP_FAIL;
+    }
+    free(batch_buf);
+    return ret;
+}
+
+esp_err_t httpd_ws_send_frame_batch(httpd_req_t *req, httpd_ws_frame_t *frames, size_t frame_count)
+{
+    esp_err_t ret = httpd_ws_check_req(req);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return httpd_ws_send_frame_batch_async(req->handle, httpd_req_to_sockfd(req), frames, frame_count);
+}
+
 esp_err_t httpd_ws_get_frame_type(httpd_req_t *req)
 {
     esp_err_t ret = httpd_ws_check_req(req);
@@ -489,6 +726,10 @@ esp_err_t httpd_ws_get_frame_type(httpd_req_t *req)
     /* Decode the FIN flag and Opcode from the byte */
     aux->ws_final = (first_byte & HTTPD_WS_FIN_BIT) != 0;
     aux->ws_type = (first_byte & HTTPD_WS_OPCODE_BITS);
+#ifdef CONFIG_HTTPD_WS_DEFLATE_SUPPORT
+    /* RSV1 flags a compressed message when permessage-deflate was negotiated */
+    aux->ws_compressed = sd->ws_deflate_enabled && ((first_byte & HTTPD_WS_RSV1_BIT) != 0);
+#endif
 
     /* If userspace requests control frames, do not deal with the control frames */
     if (!sd->ws_control_frames) {
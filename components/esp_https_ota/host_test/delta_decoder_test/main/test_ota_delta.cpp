@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "esp_partition.h"
+#include "esp_https_ota_delta.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+constexpr size_t BASE_SIZE = 0x10000;
+
+void append_le32(std::vector<uint8_t> &out, uint32_t value)
+{
+    out.push_back(value & 0xff);
+    out.push_back((value >> 8) & 0xff);
+    out.push_back((value >> 16) & 0xff);
+    out.push_back((value >> 24) & 0xff);
+}
+
+std::vector<uint8_t> delta_header(uint32_t image_size)
+{
+    std::vector<uint8_t> out = {'E', 'D', 'T', '1'};
+    append_le32(out, image_size);
+    return out;
+}
+
+void append_copy(std::vector<uint8_t> &out, uint32_t length, uint32_t src_offset)
+{
+    out.push_back(0x00);
+    append_le32(out, length);
+    append_le32(out, src_offset);
+}
+
+void append_add(std::vector<uint8_t> &out, const std::vector<uint8_t> &payload)
+{
+    out.push_back(0x01);
+    append_le32(out, payload.size());
+    out.insert(out.end(), payload.begin(), payload.end());
+}
+
+// Deterministic base partition content the COPY records pull from
+std::vector<uint8_t> base_content()
+{
+    std::vector<uint8_t> content(BASE_SIZE);
+    for (size_t i = 0; i < BASE_SIZE; i++) {
+        content[i] = (uint8_t)(i * 7 + (i >> 8));
+    }
+    return content;
+}
+
+std::vector<uint8_t> base_slice(size_t offset, size_t len)
+{
+    static const std::vector<uint8_t> content = base_content();
+    return std::vector<uint8_t>(content.begin() + offset, content.begin() + offset + len);
+}
+
+struct delta_fixture {
+    const esp_partition_t *base;
+    esp_https_ota_delta_ctx_t *ctx = nullptr;
+    std::vector<uint8_t> output;
+
+    delta_fixture()
+    {
+        base = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "base");
+        REQUIRE(base != nullptr);
+        REQUIRE(base->size == BASE_SIZE);
+
+        const std::vector<uint8_t> content = base_content();
+        REQUIRE(esp_partition_erase_range(base, 0, BASE_SIZE) == ESP_OK);
+        REQUIRE(esp_partition_write(base, 0, content.data(), BASE_SIZE) == ESP_OK);
+
+        REQUIRE(esp_https_ota_delta_init(base, write_cb, this, &ctx) == ESP_OK);
+    }
+
+    ~delta_fixture()
+    {
+        esp_https_ota_delta_free(ctx);
+    }
+
+    static esp_err_t write_cb(void *arg, const void *data, size_t len)
+    {
+        auto *self = static_cast<delta_fixture *>(arg);
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        self->output.insert(self->output.end(), bytes, bytes + len);
+        return ESP_OK;
+    }
+
+    // Feed the stream in slices of feed_size bytes (0 = everything at once)
+    esp_err_t feed(const std::vector<uint8_t> &stream, size_t feed_size = 0)
+    {
+        if (feed_size == 0) {
+            feed_size = stream.size();
+        }
+        for (size_t off = 0; off < stream.size(); off += feed_size) {
+            size_t chunk = std::min(feed_size, stream.size() - off);
+            esp_err_t err = esp_https_ota_delta_feed(ctx, stream.data() + off, chunk);
+            if (err != ESP_OK) {
+                return err;
+            }
+        }
+        return ESP_OK;
+    }
+};
+
+} // namespace
+
+TEST_CASE("delta: reconstruction is independent of feed boundaries", "[ota_delta]")
+{
+    const std::vector<uint8_t> literal = {0xde, 0xad, 0xbe, 0xef, 0x42};
+
+    // COPY + ADD + COPY, including a COPY larger than the decoder's 4 KB
+    // bounce buffer so the chunked base read path runs too
+    std::vector<uint8_t> expected;
+    auto slice1 = base_slice(0x100, 0x20);
+    auto slice2 = base_slice(0x8000, 0x1800);
+    expected.insert(expected.end(), slice1.begin(), slice1.end());
+    expected.insert(expected.end(), literal.begin(), literal.end());
+    expected.insert(expected.end(), slice2.begin(), slice2.end());
+
+    std::vector<uint8_t> stream = delta_header(expected.size());
+    append_copy(stream, 0x20, 0x100);
+    append_add(stream, literal);
+    append_copy(stream, 0x1800, 0x8000);
+
+    // 1-byte feeds cross every header/payload boundary; 7 and whole-stream
+    // cover the partial-header and fast paths
+    for (size_t feed_size : {(size_t)1, (size_t)7, (size_t)0}) {
+        delta_fixture f;
+        REQUIRE(f.feed(stream, feed_size) == ESP_OK);
+        REQUIRE(esp_https_ota_delta_finish(f.ctx) == ESP_OK);
+        REQUIRE(f.output == expected);
+    }
+}
+
+TEST_CASE("delta: zero-length records are accepted", "[ota_delta]")
+{
+    delta_fixture f;
+    std::vector<uint8_t> stream = delta_header(0);
+    append_add(stream, {});
+    append_copy(stream, 0, 0);
+
+    REQUIRE(f.feed(stream) == ESP_OK);
+    REQUIRE(esp_https_ota_delta_finish(f.ctx) == ESP_OK);
+    REQUIRE(f.output.empty());
+}
+
+TEST_CASE("delta: COPY records beyond the base partition are rejected", "[ota_delta]")
+{
+    // source range sticking out past the end of the base partition
+    {
+        delta_fixture f;
+        std::vector<uint8_t> stream = delta_header(8);
+        append_copy(stream, 8, BASE_SIZE - 4);
+        REQUIRE(f.feed(stream) == ESP_ERR_INVALID_SIZE);
+    }
+    // source offset past the end, length small: the subtraction must not wrap
+    {
+        delta_fixture f;
+        std::vector<uint8_t> stream = delta_header(4);
+        append_copy(stream, 4, 0xfffffff0);
+        REQUIRE(f.feed(stream) == ESP_ERR_INVALID_SIZE);
+    }
+}
+
+TEST_CASE("delta: records producing more than the announced size are rejected", "[ota_delta]")
+{
+    delta_fixture f;
+    std::vector<uint8_t> stream = delta_header(4);
+    append_add(stream, {1, 2, 3, 4, 5});
+    REQUIRE(f.feed(stream) == ESP_ERR_INVALID_SIZE);
+}
+
+TEST_CASE("delta: truncated streams fail at finish", "[ota_delta]")
+{
+    // mid record header
+    {
+        delta_fixture f;
+        std::vector<uint8_t> stream = delta_header(16);
+        stream.push_back(0x01); // lone ADD opcode, length missing
+        REQUIRE(f.feed(stream) == ESP_OK);
+        REQUIRE(esp_https_ota_delta_finish(f.ctx) == ESP_FAIL);
+    }
+    // mid ADD payload
+    {
+        delta_fixture f;
+        std::vector<uint8_t> stream = delta_header(8);
+        stream.push_back(0x01);
+        append_le32(stream, 8);
+        stream.insert(stream.end(), {1, 2, 3}); // 5 bytes short
+        REQUIRE(f.feed(stream) == ESP_OK);
+        REQUIRE(esp_https_ota_delta_finish(f.ctx) == ESP_FAIL);
+    }
+    // complete records but less data than announced
+    {
+        delta_fixture f;
+        std::vector<uint8_t> stream = delta_header(100);
+        append_add(stream, {1, 2, 3, 4});
+        REQUIRE(f.feed(stream) == ESP_OK);
+        REQUIRE(esp_https_ota_delta_finish(f.ctx) == ESP_ERR_INVALID_SIZE);
+    }
+}
+
+TEST_CASE("delta: bad magic and unknown opcodes abort the stream", "[ota_delta]")
+{
+    {
+        delta_fixture f;
+        std::vector<uint8_t> stream = {'E', 'D', 'T', '9', 0, 0, 0, 0};
+        REQUIRE(f.feed(stream) == ESP_ERR_INVALID_VERSION);
+    }
+    {
+        delta_fixture f;
+        std::vector<uint8_t> stream = delta_header(4);
+        stream.push_back(0x7f); // no such opcode
+        append_le32(stream, 4);
+        REQUIRE(f.feed(stream) == ESP_FAIL);
+    }
+}
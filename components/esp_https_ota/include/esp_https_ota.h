@@ -73,6 +73,9 @@ typedef struct {
     decrypt_cb_t decrypt_cb;                       /*!< Callback for external decryption layer */
     void *decrypt_user_ctx;                        /*!< User context for external decryption layer */
     uint16_t enc_img_header_size;                  /*!< Header size of pre-encrypted ota image header */
+#endif
+#if CONFIG_ESP_HTTPS_OTA_DELTA || __DOXYGEN__
+    bool delta_update;                             /*!< The server provides a binary diff against the currently running image instead of a full image. The new image is reconstructed by copying unchanged blocks from the running partition. See src/esp_https_ota_delta.h for the stream format. */
 #endif
     struct {                                        /*!< Details of staging and final partitions for OTA update */
         const esp_partition_t *staging;             /*!< New image will be downloaded in this staging partition. If NULL then a free app partition (passive app partition) is selected as the staging partition. */
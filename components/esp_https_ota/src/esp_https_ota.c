@@ -16,6 +16,9 @@
 #include "esp_check.h"
 #include "esp_flash_encrypt.h"
 #include "hal/efuse_hal.h"
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+#include "esp_https_ota_delta.h"
+#endif
 
 ESP_EVENT_DEFINE_BASE(ESP_HTTPS_OTA_EVENT);
 
@@ -65,10 +68,17 @@ struct esp_https_ota_handle {
     void *decrypt_user_ctx;
     uint16_t enc_img_header_size;
 #endif
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    esp_https_ota_delta_ctx_t *delta;
+#endif
 };
 
 typedef struct esp_https_ota_handle esp_https_ota_t;
 
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+static esp_err_t _ota_delta_write(void *arg, const void *data, size_t len);
+#endif
+
 static bool redirection_required(int status_code)
 {
     switch (status_code) {
@@ -327,6 +337,21 @@ esp_err_t esp_https_ota_begin(const esp_https_ota_config_t *ota_config, esp_http
     }
 #endif
 
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    if (ota_config->delta_update) {
+        if (ota_config->ota_resumption) {
+            // The decoder state cannot be restored from a partially written image
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+#if CONFIG_ESP_HTTPS_OTA_ENABLE_PARTIAL_DOWNLOAD
+        if (ota_config->partial_http_download) {
+            // Range bookkeeping counts downloaded delta bytes, binary_file_len counts reconstructed bytes
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+#endif
+    }
+#endif
+
     esp_https_ota_t *https_ota_handle = calloc(1, sizeof(esp_https_ota_t));
     if (!https_ota_handle) {
         ESP_LOGE(TAG, "Couldn't allocate memory to upgrade data buffer");
@@ -544,6 +569,21 @@ esp_err_t esp_https_ota_begin(const esp_https_ota_config_t *ota_config, esp_http
         }
     }
 
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    if (ota_config->delta_update) {
+        const esp_partition_t *running = esp_ota_get_running_partition();
+        if (running == NULL) {
+            ESP_LOGE(TAG, "Running partition not found, cannot apply delta update");
+            err = ESP_FAIL;
+            goto http_cleanup;
+        }
+        err = esp_https_ota_delta_init(running, _ota_delta_write, https_ota_handle, &https_ota_handle->delta);
+        if (err != ESP_OK) {
+            goto http_cleanup;
+        }
+    }
+#endif
+
     const int alloc_size = MAX(ota_config->http_config->buffer_size, DEFAULT_OTA_BUF_SIZE);
     if (ota_config->buffer_caps != 0) {
         https_ota_handle->ota_upgrade_buf = (char *)heap_caps_malloc(alloc_size, ota_config->buffer_caps);
@@ -567,6 +607,9 @@ esp_err_t esp_https_ota_begin(const esp_https_ota_config_t *ota_config, esp_http
     return ESP_OK;
 
 http_cleanup:
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    esp_https_ota_delta_free(https_ota_handle->delta);
+#endif
     _http_cleanup(https_ota_handle->http_client);
 failure:
     free(https_ota_handle);
@@ -628,6 +671,12 @@ static esp_err_t get_description_from_image(esp_https_ota_handle_t https_ota_han
         ESP_LOGE(TAG, "esp_https_ota_get_img_desc: Invalid state");
         return ESP_ERR_INVALID_STATE;
     }
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    if (handle->delta) {
+        // The downloaded stream is a delta, the descriptor only exists after reconstruction
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
 
     unsigned img_info_len = 0;
     if (handle->partition.final->type == ESP_PARTITION_TYPE_APP) {
@@ -704,6 +753,28 @@ static esp_err_t esp_ota_verify_chip_revision(const void *arg)
     return ESP_OK;
 }
 
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+static esp_err_t _ota_delta_write(void *arg, const void *data, size_t len)
+{
+    esp_https_ota_t *handle = (esp_https_ota_t *)arg;
+    /* The first reconstructed bytes carry the image header, run the same
+       pre-flight checks as the full-image download path */
+    if (handle->binary_file_len == 0 && len >= sizeof(esp_image_header_t)
+            && (handle->partition.final->type == ESP_PARTITION_TYPE_APP || handle->partition.final->type == ESP_PARTITION_TYPE_BOOTLOADER)) {
+        esp_err_t err = esp_ota_verify_chip_id(data);
+        if (err != ESP_OK) {
+            return err;
+        }
+        err = esp_ota_verify_chip_revision(data);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+    esp_err_t err = _ota_write(handle, data, len);
+    return (err == ESP_ERR_HTTPS_OTA_IN_PROGRESS) ? ESP_OK : err;
+}
+#endif // CONFIG_ESP_HTTPS_OTA_DELTA
+
 esp_err_t esp_https_ota_perform(esp_https_ota_handle_t https_ota_handle)
 {
     esp_https_ota_t *handle = (esp_https_ota_t *)https_ota_handle;
@@ -728,6 +799,13 @@ esp_err_t esp_https_ota_perform(esp_https_ota_handle_t https_ota_handle)
             }
             esp_ota_set_final_partition(handle->update_handle, handle->partition.final, handle->partition.finalize_with_copy);
             handle->state = ESP_HTTPS_OTA_IN_PROGRESS;
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+            if (handle->delta) {
+                /* The stream carries a delta, not a raw image: the header checks
+                   run on the reconstructed data once the decoder produces it */
+                return ESP_ERR_HTTPS_OTA_IN_PROGRESS;
+            }
+#endif
             /* In case `esp_https_ota_get_img_desc` was invoked first,
                then the image data read there should be written to OTA partition
                */
@@ -796,9 +874,27 @@ esp_err_t esp_https_ota_perform(esp_https_ota_handle_t https_ota_handle)
                     return ESP_FAIL;
                 }
                 ESP_LOGD(TAG, "Connection closed");
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+                if (handle->delta) {
+                    err = esp_https_ota_delta_finish(handle->delta);
+                    if (err != ESP_OK) {
+                        ESP_LOGE(TAG, "Delta stream ended in an inconsistent state");
+                        return err;
+                    }
+                }
+#endif
             } else if (data_read > 0) {
                 const void *data_buf = (const void *) handle->ota_upgrade_buf;
                 int data_len = data_read;
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+                if (handle->delta) {
+                    err = esp_https_ota_delta_feed(handle->delta, data_buf, data_len);
+                    if (err != ESP_OK) {
+                        return err;
+                    }
+                    return ESP_ERR_HTTPS_OTA_IN_PROGRESS;
+                }
+#endif
 #if CONFIG_ESP_HTTPS_OTA_DECRYPT_CB
                 decrypt_cb_arg_t args = {};
                 args.data_in = handle->ota_upgrade_buf;
@@ -907,6 +1003,9 @@ esp_err_t esp_https_ota_finish(esp_https_ota_handle_t https_ota_handle)
             if (handle->http_client) {
                 _http_cleanup(handle->http_client);
             }
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+            esp_https_ota_delta_free(handle->delta);
+#endif
             break;
         default:
             ESP_LOGE(TAG, "Invalid ESP HTTPS OTA State");
@@ -958,6 +1057,9 @@ esp_err_t esp_https_ota_abort(esp_https_ota_handle_t https_ota_handle)
             if (handle->http_client) {
                 _http_cleanup(handle->http_client);
             }
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+            esp_https_ota_delta_free(handle->delta);
+#endif
             break;
         default:
             err = ESP_ERR_INVALID_STATE;
@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <sys/param.h>
+#include <esp_log.h>
+#include "esp_https_ota_delta.h"
+
+#define DELTA_MAGIC             "EDT1"
+#define DELTA_MAGIC_LEN         (4)
+#define DELTA_HEADER_LEN        (DELTA_MAGIC_LEN + sizeof(uint32_t))
+/* opcode + length */
+#define DELTA_RECORD_MIN_LEN    (1 + sizeof(uint32_t))
+/* opcode + length + source offset */
+#define DELTA_RECORD_COPY_LEN   (1 + 2 * sizeof(uint32_t))
+
+#define DELTA_OP_COPY           (0x00)
+#define DELTA_OP_ADD            (0x01)
+
+#define DELTA_COPY_BUF_SIZE     (4096)
+
+static const char *TAG = "esp_https_ota_delta";
+
+typedef enum {
+    DELTA_STATE_HEADER,         /* collecting the stream header */
+    DELTA_STATE_RECORD,         /* collecting a record header */
+    DELTA_STATE_ADD_PAYLOAD,    /* passing through literal bytes of an ADD record */
+} delta_state_t;
+
+struct esp_https_ota_delta_ctx {
+    const esp_partition_t *base;
+    esp_https_ota_delta_write_cb_t write_cb;
+    void *write_arg;
+    delta_state_t state;
+    uint8_t hdr[DELTA_RECORD_COPY_LEN]; /* staging area for stream/record headers */
+    size_t hdr_len;
+    size_t hdr_need;
+    uint32_t image_size;
+    uint32_t image_written;
+    uint32_t add_remaining;
+    char *copy_buf;
+};
+
+static uint32_t delta_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+esp_err_t esp_https_ota_delta_init(const esp_partition_t *base_partition, esp_https_ota_delta_write_cb_t write_cb, void *write_arg, esp_https_ota_delta_ctx_t **out_ctx)
+{
+    if (base_partition == NULL || write_cb == NULL || out_ctx == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_https_ota_delta_ctx_t *ctx = calloc(1, sizeof(esp_https_ota_delta_ctx_t));
+    if (ctx == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->copy_buf = malloc(DELTA_COPY_BUF_SIZE);
+    if (ctx->copy_buf == NULL) {
+        free(ctx);
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->base = base_partition;
+    ctx->write_cb = write_cb;
+    ctx->write_arg = write_arg;
+    ctx->state = DELTA_STATE_HEADER;
+    ctx->hdr_need = DELTA_HEADER_LEN;
+    *out_ctx = ctx;
+    return ESP_OK;
+}
+
+static esp_err_t delta_apply_copy(esp_https_ota_delta_ctx_t *ctx, uint32_t src_offset, uint32_t length)
+{
+    if (src_offset > ctx->base->size || length > ctx->base->size - src_offset) {
+        ESP_LOGE(TAG, "COPY record exceeds base partition (offset 0x%"PRIx32", len %"PRIu32")", src_offset, length);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    while (length > 0) {
+        size_t chunk = MIN(length, DELTA_COPY_BUF_SIZE);
+        esp_err_t err = esp_partition_read(ctx->base, src_offset, ctx->copy_buf, chunk);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Base partition read failed (%s)", esp_err_to_name(err));
+            return err;
+        }
+        err = ctx->write_cb(ctx->write_arg, ctx->copy_buf, chunk);
+        if (err != ESP_OK) {
+            return err;
+        }
+        src_offset += chunk;
+        length -= chunk;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_https_ota_delta_feed(esp_https_ota_delta_ctx_t *ctx, const void *data, size_t len)
+{
+    if (ctx == NULL || (data == NULL && len > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const uint8_t *in = (const uint8_t *)data;
+    esp_err_t err;
+
+    while (len > 0) {
+        switch (ctx->state) {
+        case DELTA_STATE_HEADER:
+        case DELTA_STATE_RECORD: {
+            size_t take = MIN(len, ctx->hdr_need - ctx->hdr_len);
+            memcpy(ctx->hdr + ctx->hdr_len, in, take);
+            ctx->hdr_len += take;
+            in += take;
+            len -= take;
+            if (ctx->hdr_len < ctx->hdr_need) {
+                break;
+            }
+            if (ctx->state == DELTA_STATE_HEADER) {
+                if (memcmp(ctx->hdr, DELTA_MAGIC, DELTA_MAGIC_LEN) != 0) {
+                    ESP_LOGE(TAG, "Invalid delta stream magic");
+                    return ESP_ERR_INVALID_VERSION;
+                }
+                ctx->image_size = delta_le32(ctx->hdr + DELTA_MAGIC_LEN);
+                ctx->state = DELTA_STATE_RECORD;
+                ctx->hdr_len = 0;
+                ctx->hdr_need = DELTA_RECORD_MIN_LEN;
+                break;
+            }
+            uint8_t opcode = ctx->hdr[0];
+            if (opcode == DELTA_OP_COPY && ctx->hdr_need == DELTA_RECORD_MIN_LEN) {
+                /* a COPY record additionally carries the source offset */
+                ctx->hdr_need = DELTA_RECORD_COPY_LEN;
+                break;
+            }
+            uint32_t rec_len = delta_le32(ctx->hdr + 1);
+            if (rec_len > ctx->image_size - ctx->image_written) {
+                ESP_LOGE(TAG, "Record produces more data than the announced image size");
+                return ESP_ERR_INVALID_SIZE;
+            }
+            if (opcode == DELTA_OP_COPY) {
+                err = delta_apply_copy(ctx, delta_le32(ctx->hdr + DELTA_RECORD_MIN_LEN), rec_len);
+                if (err != ESP_OK) {
+                    return err;
+                }
+                ctx->image_written += rec_len;
+            } else if (opcode == DELTA_OP_ADD) {
+                ctx->add_remaining = rec_len;
+                if (rec_len > 0) {
+                    ctx->state = DELTA_STATE_ADD_PAYLOAD;
+                }
+            } else {
+                ESP_LOGE(TAG, "Unknown delta opcode 0x%02x", opcode);
+                return ESP_FAIL;
+            }
+            ctx->hdr_len = 0;
+            ctx->hdr_need = DELTA_RECORD_MIN_LEN;
+            break;
+        }
+        case DELTA_STATE_ADD_PAYLOAD: {
+            size_t chunk = MIN(len, ctx->add_remaining);
+            err = ctx->write_cb(ctx->write_arg, in, chunk);
+            if (err != ESP_OK) {
+                return err;
+            }
+            ctx->image_written += chunk;
+            ctx->add_remaining -= chunk;
+            in += chunk;
+            len -= chunk;
+            if (ctx->add_remaining == 0) {
+                ctx->state = DELTA_STATE_RECORD;
+            }
+            break;
+        }
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_https_ota_delta_finish(esp_https_ota_delta_ctx_t *ctx)
+{
+    if (ctx == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (ctx->state != DELTA_STATE_RECORD || ctx->hdr_len != 0) {
+        ESP_LOGE(TAG, "Delta stream truncated mid-record");
+        return ESP_FAIL;
+    }
+    if (ctx->image_written != ctx->image_size) {
+        ESP_LOGE(TAG, "Reconstructed %"PRIu32" bytes, expected %"PRIu32, ctx->image_written, ctx->image_size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return ESP_OK;
+}
+
+void esp_https_ota_delta_free(esp_https_ota_delta_ctx_t *ctx)
+{
+    if (ctx) {
+        free(ctx->copy_buf);
+        free(ctx);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Streaming decoder for the delta update format consumed by esp_https_ota.
+ *
+ * Delta stream layout (all multi-byte integers little-endian):
+ *
+ *   offset 0: magic "EDT1" (4 bytes)
+ *   offset 4: uint32 size of the reconstructed image, in bytes
+ *   offset 8: records, back to back, until the stream ends:
+ *       uint8  opcode        0x00 = COPY, 0x01 = ADD
+ *       uint32 length        number of image bytes this record produces
+ *       COPY:  uint32 source offset within the base (running) partition
+ *       ADD:   `length` literal image bytes follow
+ *
+ * The decoder reconstructs the image strictly in order and pushes it to the
+ * write callback, so the regular esp_ota_write()/esp_ota_end() pipeline (and
+ * with it image validation and rollback) stays unchanged.
+ */
+
+/**
+ * @brief Sink for reconstructed image bytes
+ */
+typedef esp_err_t (*esp_https_ota_delta_write_cb_t)(void *arg, const void *data, size_t len);
+
+typedef struct esp_https_ota_delta_ctx esp_https_ota_delta_ctx_t;
+
+/**
+ * @brief Create a delta decoder reading COPY records from base_partition
+ */
+esp_err_t esp_https_ota_delta_init(const esp_partition_t *base_partition, esp_https_ota_delta_write_cb_t write_cb, void *write_arg, esp_https_ota_delta_ctx_t **out_ctx);
+
+/**
+ * @brief Feed downloaded delta bytes; reconstructed data is pushed to the write callback
+ */
+esp_err_t esp_https_ota_delta_feed(esp_https_ota_delta_ctx_t *ctx, const void *data, size_t len);
+
+/**
+ * @brief Check that the stream ended on a record boundary and produced the announced image size
+ */
+esp_err_t esp_https_ota_delta_finish(esp_https_ota_delta_ctx_t *ctx);
+
+void esp_https_ota_delta_free(esp_https_ota_delta_ctx_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif
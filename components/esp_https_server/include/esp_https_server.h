@@ -128,6 +128,11 @@ struct httpd_ssl_config {
     /** Enable tls session tickets */
     bool session_tickets;
 
+    /** Enable the server-side tls session cache, so returning clients resume
+     *  their session instead of running a full handshake
+     *  (requires CONFIG_ESP_TLS_SERVER_SESSION_CACHE) */
+    bool session_cache;
+
     /** Enable secure element for server session */
     bool use_secure_element;
 
@@ -225,6 +230,7 @@ typedef struct httpd_ssl_config httpd_ssl_config_t;
     .port_secure = 443,                           \
     .port_insecure = 80,                          \
     .session_tickets = false,                     \
+    .session_cache = false,                       \
     .use_secure_element = false,                  \
     .user_cb = NULL,                              \
     .ssl_userdata = NULL,                         \
@@ -9,6 +9,14 @@
 #include "esp_log.h"
 #include "sdkconfig.h"
 #include "esp_tls.h"
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+#include <fcntl.h>
+#include <sys/socket.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#endif
 
 const static char *TAG = "esp_https_server";
 
@@ -16,11 +24,22 @@ typedef struct httpd_ssl_ctx {
     esp_tls_cfg_server_t *tls_cfg;
     httpd_open_func_t open_fn;
     esp_https_server_user_cb *user_cb;
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+    QueueHandle_t handshake_queue;
+    TaskHandle_t handshake_task;
+    SemaphoreHandle_t handshake_stopped;
+    volatile bool handshake_running;
+#endif
 } httpd_ssl_ctx_t;
 
 typedef struct httpd_ssl_transport_ctx {
     esp_tls_t *tls;
     httpd_ssl_ctx_t *global_ctx;
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+    httpd_handle_t server;
+    int sockfd;
+    int handshake_ret;
+#endif
 } httpd_ssl_transport_ctx_t;
 
 #ifdef CONFIG_ESP_HTTPS_SERVER_EVENTS
@@ -160,6 +179,168 @@ static int httpd_ssl_send(httpd_handle_t server, int sockfd, const char *buf, si
     return ret;
 }
 
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+
+#define HTTPD_SSL_HANDSHAKE_DEF_TIMEOUT_MS 10000
+#define HTTPD_SSL_HANDSHAKE_POLL_MS        250
+
+/**
+ * Completion of an offloaded handshake, queued to run on the server task.
+ *
+ * Re-attaches the session to the server's main loop and runs the callbacks
+ * that httpd_ssl_open defers while the handshake is in flight.
+ *
+ * @param[in] arg - session transport context
+ */
+static void httpd_ssl_handshake_done(void *arg)
+{
+    httpd_ssl_transport_ctx_t *transport_ctx = arg;
+    httpd_ssl_ctx_t *global_ctx = transport_ctx->global_ctx;
+    httpd_handle_t server = transport_ctx->server;
+    int sockfd = transport_ctx->sockfd;
+
+    httpd_sess_set_parked(server, sockfd, false);
+
+    if (transport_ctx->handshake_ret != 0) {
+        ESP_LOGE(TAG, "session handshake failed, 0x%04x", -transport_ctx->handshake_ret);
+        esp_tls_error_handle_t error_handle;
+        if (esp_tls_get_error_handle(transport_ctx->tls, &error_handle) == ESP_OK) {
+            esp_https_server_last_error_t last_error = {0};
+            last_error.last_error = esp_tls_get_and_clear_last_error(error_handle, &last_error.esp_tls_error_code, &last_error.esp_tls_flags);
+            http_dispatch_event_to_event_loop(HTTPS_SERVER_EVENT_ERROR, &last_error, sizeof(last_error));
+        }
+        // A fresh session can still carry a zero LRU counter, which makes the
+        // close handler treat the close request as a stale race and skip it -
+        // bump the counter so the session is actually torn down
+        httpd_sess_update_lru_counter(server, sockfd);
+        httpd_sess_trigger_close(server, sockfd); // the close path frees the TLS context
+        return;
+    }
+
+    // the session loop expects a blocking socket again
+    fcntl(sockfd, F_SETFL, fcntl(sockfd, F_GETFL, 0) & ~O_NONBLOCK);
+
+    ESP_LOGD(TAG, "Secure socket open");
+
+    if (global_ctx->open_fn) {
+        (global_ctx->open_fn)(server, sockfd);
+    }
+
+    if (global_ctx->user_cb) {
+        esp_https_server_user_cb_arg_t user_cb_data = {0};
+        user_cb_data.user_cb_state = HTTPD_SSL_USER_CB_SESS_CREATE;
+        user_cb_data.tls = transport_ctx->tls;
+        (global_ctx->user_cb)((void *)&user_cb_data);
+    }
+    http_dispatch_event_to_event_loop(HTTPS_SERVER_EVENT_ON_CONNECTED, NULL, 0);
+}
+
+/**
+ * Drive one handshake to completion on the handshake task.
+ *
+ * @return 0 on success, esp-tls error code otherwise
+ */
+static int httpd_ssl_handshake_run(httpd_ssl_ctx_t *global_ctx, httpd_ssl_transport_ctx_t *transport_ctx)
+{
+    uint32_t timeout_ms = global_ctx->tls_cfg->tls_handshake_timeout_ms;
+    if (timeout_ms == 0) {
+        timeout_ms = HTTPD_SSL_HANDSHAKE_DEF_TIMEOUT_MS;
+    }
+    TickType_t start = xTaskGetTickCount();
+
+    int ret;
+    while ((ret = esp_tls_server_session_continue_async(transport_ctx->tls)) != 0) {
+        if (ret != ESP_TLS_ERR_SSL_WANT_READ && ret != ESP_TLS_ERR_SSL_WANT_WRITE) {
+            return ret;
+        }
+        if (!global_ctx->handshake_running) {
+            // server is stopping, the session close path cleans up
+            return ret;
+        }
+        if ((xTaskGetTickCount() - start) > pdMS_TO_TICKS(timeout_ms)) {
+            ESP_LOGD(TAG, "Server handshake timed out");
+            return ESP_ERR_ESP_TLS_SERVER_HANDSHAKE_TIMEOUT;
+        }
+        // wait (bounded, so a stop request is noticed) until the socket is ready
+        fd_set readset, writeset;
+        FD_ZERO(&readset);
+        FD_ZERO(&writeset);
+        FD_SET(transport_ctx->sockfd, (ret == ESP_TLS_ERR_SSL_WANT_WRITE) ? &writeset : &readset);
+        struct timeval tv = {
+            .tv_usec = HTTPD_SSL_HANDSHAKE_POLL_MS * 1000,
+        };
+        select(transport_ctx->sockfd + 1, &readset, &writeset, NULL, &tv);
+    }
+    return 0;
+}
+
+static void httpd_ssl_handshake_task(void *arg)
+{
+    httpd_ssl_ctx_t *global_ctx = arg;
+
+    while (global_ctx->handshake_running) {
+        httpd_ssl_transport_ctx_t *transport_ctx;
+        if (xQueueReceive(global_ctx->handshake_queue, &transport_ctx, pdMS_TO_TICKS(HTTPD_SSL_HANDSHAKE_POLL_MS)) != pdTRUE) {
+            continue;
+        }
+        transport_ctx->handshake_ret = httpd_ssl_handshake_run(global_ctx, transport_ctx);
+        if (!global_ctx->handshake_running) {
+            // server is stopping; closing the remaining sessions frees their TLS contexts
+            break;
+        }
+        if (httpd_queue_work(transport_ctx->server, httpd_ssl_handshake_done, transport_ctx) != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to queue handshake completion for fd %d", transport_ctx->sockfd);
+        }
+    }
+    xSemaphoreGive(global_ctx->handshake_stopped);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t httpd_ssl_handshake_worker_start(httpd_ssl_ctx_t *ssl_ctx, const httpd_config_t *httpd_cfg)
+{
+    ssl_ctx->handshake_queue = xQueueCreate(httpd_cfg->max_open_sockets, sizeof(httpd_ssl_transport_ctx_t *));
+    ssl_ctx->handshake_stopped = xSemaphoreCreateBinary();
+    if (!ssl_ctx->handshake_queue || !ssl_ctx->handshake_stopped) {
+        goto fail;
+    }
+    ssl_ctx->handshake_running = true;
+    // One below the server task, so established sessions take precedence
+    // over handshakes of new connections
+    UBaseType_t priority = (httpd_cfg->task_priority > tskIDLE_PRIORITY + 1) ?
+                           (httpd_cfg->task_priority - 1) : (tskIDLE_PRIORITY + 1);
+    if (xTaskCreate(httpd_ssl_handshake_task, "httpd_ssl_hs", CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD_STACK_SIZE,
+                    ssl_ctx, priority, &ssl_ctx->handshake_task) != pdPASS) {
+        goto fail;
+    }
+    return ESP_OK;
+fail:
+    if (ssl_ctx->handshake_queue) {
+        vQueueDelete(ssl_ctx->handshake_queue);
+        ssl_ctx->handshake_queue = NULL;
+    }
+    if (ssl_ctx->handshake_stopped) {
+        vSemaphoreDelete(ssl_ctx->handshake_stopped);
+        ssl_ctx->handshake_stopped = NULL;
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+static void httpd_ssl_handshake_worker_stop(httpd_ssl_ctx_t *ssl_ctx)
+{
+    if (!ssl_ctx->handshake_task) {
+        return;
+    }
+    ssl_ctx->handshake_running = false;
+    xSemaphoreTake(ssl_ctx->handshake_stopped, portMAX_DELAY);
+    ssl_ctx->handshake_task = NULL;
+    vSemaphoreDelete(ssl_ctx->handshake_stopped);
+    ssl_ctx->handshake_stopped = NULL;
+    vQueueDelete(ssl_ctx->handshake_queue);
+    ssl_ctx->handshake_queue = NULL;
+}
+
+#endif // CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+
 /**
  * Open a SSL socket for the server.
  * The fd is already open and ready to read / write raw data.
@@ -183,12 +364,22 @@ static esp_err_t httpd_ssl_open(httpd_handle_t server, int sockfd)
         http_dispatch_event_to_event_loop(HTTPS_SERVER_EVENT_ERROR, &last_error, sizeof(last_error));
         return ESP_ERR_NO_MEM;
     }
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+    ESP_LOGD(TAG, "deferring session handshake to the handshake task");
+    if (esp_tls_server_session_init(global_ctx->tls_cfg, sockfd, tls) != ESP_OK) {
+        ESP_LOGE(TAG, "esp_tls_server_session_init failed");
+        goto fail;
+    }
+    // the handshake task waits for socket readiness instead of blocking in reads
+    fcntl(sockfd, F_SETFL, fcntl(sockfd, F_GETFL, 0) | O_NONBLOCK);
+#else
     ESP_LOGI(TAG, "performing session handshake");
     int ret = esp_tls_server_session_create(global_ctx->tls_cfg, sockfd, tls);
     if (ret != 0) {
         ESP_LOGE(TAG, "esp_tls_create_server_session failed, 0x%04x", -ret);
         goto fail;
     }
+#endif
 
     // Pass a new structure containing the global context and the tls pointer to httpd_ssl_close
     // Store it in the context field of the HTTPD session object
@@ -211,6 +402,21 @@ static esp_err_t httpd_ssl_open(httpd_handle_t server, int sockfd)
     httpd_sess_set_recv_override(server, sockfd, httpd_ssl_recv);
     httpd_sess_set_pending_override(server, sockfd, httpd_ssl_pending);
 
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+    transport_ctx->server = server;
+    transport_ctx->sockfd = sockfd;
+
+    // Detach the session from the main loop until the handshake task reports
+    // back; open_fn, user_cb and the connected event run on completion
+    httpd_sess_set_parked(server, sockfd, true);
+    if (xQueueSend(global_ctx->handshake_queue, &transport_ctx, 0) != pdTRUE) {
+        // the queue is sized to max_open_sockets, so this should never happen
+        ESP_LOGE(TAG, "handshake queue full");
+        httpd_sess_set_parked(server, sockfd, false);
+        return ESP_FAIL; // the close path frees the TLS context
+    }
+    return ESP_OK;
+#else
     // all access should now go through SSL
     ESP_LOGD(TAG, "Secure socket open");
 
@@ -226,6 +432,7 @@ static esp_err_t httpd_ssl_open(httpd_handle_t server, int sockfd)
     }
     http_dispatch_event_to_event_loop(HTTPS_SERVER_EVENT_ON_CONNECTED, NULL, 0);
     return ESP_OK;
+#endif
 fail:
     {
         esp_tls_error_handle_t error_handle;
@@ -250,6 +457,11 @@ static void free_secure_context(void *ctx)
     httpd_ssl_ctx_t *ssl_ctx = ctx;
     esp_tls_cfg_server_t *cfg = ssl_ctx->tls_cfg;
     ESP_LOGI(TAG, "Server shuts down, releasing SSL context");
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+    // Normally already stopped by httpd_ssl_stop; this covers servers that
+    // were torn down with httpd_stop directly
+    httpd_ssl_handshake_worker_stop(ssl_ctx);
+#endif
     if (cfg->cacert_buf) {
         free((void *)cfg->cacert_buf);
     }
@@ -260,6 +472,7 @@ static void free_secure_context(void *ctx)
         free((void *)cfg->serverkey_buf);
     }
     esp_tls_cfg_server_session_tickets_free(cfg);
+    esp_tls_cfg_server_session_cache_free(cfg);
     free(cfg);
     free(ssl_ctx);
 }
@@ -284,6 +497,14 @@ static esp_err_t create_secure_context(const struct httpd_ssl_config *config, ht
         }
     }
 
+    if (config->session_cache) {
+        ret = esp_tls_cfg_server_session_cache_init(cfg);
+        if ( ret != ESP_OK ) {
+            ESP_LOGE(TAG, "Failed to init session cache support. error: %s", esp_err_to_name(ret));
+            goto exit;
+        }
+    }
+
     cfg->userdata = config->ssl_userdata;
     cfg->alpn_protos = config->alpn_protos;
     cfg->tls_handshake_timeout_ms = config->tls_handshake_timeout_ms;
@@ -421,6 +642,14 @@ esp_err_t httpd_ssl_start(httpd_handle_t *pHandle, struct httpd_ssl_config *conf
 
         ESP_LOGD(TAG, "SSL context ready");
 
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+        ret = httpd_ssl_handshake_worker_start(ssl_ctx, &config->httpd);
+        if (ret != ESP_OK) {
+            free_secure_context(ssl_ctx);
+            return ret;
+        }
+#endif
+
         // set SSL specific config
         config->httpd.global_transport_ctx = ssl_ctx;
         config->httpd.global_transport_ctx_free_fn = free_secure_context;
@@ -441,6 +670,11 @@ esp_err_t httpd_ssl_start(httpd_handle_t *pHandle, struct httpd_ssl_config *conf
 
     ret = httpd_start(&handle, &config->httpd);
     if (ret != ESP_OK) {
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+        if (ssl_ctx) {
+            httpd_ssl_handshake_worker_stop(ssl_ctx);
+        }
+#endif
         free(ssl_ctx);
         ssl_ctx = NULL;
         return ret;
@@ -456,6 +690,14 @@ esp_err_t httpd_ssl_start(httpd_handle_t *pHandle, struct httpd_ssl_config *conf
 /** Stop the server */
 esp_err_t httpd_ssl_stop(httpd_handle_t handle)
 {
+#if CONFIG_ESP_HTTPS_SERVER_HANDSHAKE_OFFLOAD
+    // Stop the handshake task first, so no handshake is in flight while
+    // httpd_stop() tears down the remaining sessions
+    httpd_ssl_ctx_t *ssl_ctx = handle ? httpd_get_global_transport_ctx(handle) : NULL;
+    if (ssl_ctx) {
+        httpd_ssl_handshake_worker_stop(ssl_ctx);
+    }
+#endif
     esp_err_t ret = httpd_stop(handle);
     if (ret == ESP_OK) {
         http_dispatch_event_to_event_loop(HTTPS_SERVER_EVENT_STOP, NULL, 0);
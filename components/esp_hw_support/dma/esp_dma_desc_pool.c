@@ -0,0 +1,227 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include <sys/queue.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_private/dma_desc_pool.h"
+#include "hal/cache_hal.h"
+#include "hal/cache_ll.h"
+
+ESP_LOG_ATTR_TAG(TAG, "dma-desc-pool");
+
+#define ALIGN_UP(num, align)    (((num) + ((align) - 1)) & ~((align) - 1))
+
+#define DMA_DESC_POOL_SLAB_SIZE CONFIG_DMA_DESC_POOL_SLAB_SIZE
+// minimum allocation granularity inside a slab; raised to the cache line
+// size at runtime so that cached zero-fill/writeback of one allocation can
+// never touch a neighbouring one
+#define DMA_DESC_POOL_MIN_CELL  8
+#define DMA_DESC_POOL_MAX_CELLS (DMA_DESC_POOL_SLAB_SIZE / DMA_DESC_POOL_MIN_CELL)
+
+typedef struct dma_desc_pool_slab_t dma_desc_pool_slab_t;
+struct dma_desc_pool_slab_t {
+    SLIST_ENTRY(dma_desc_pool_slab_t) next;
+    uint8_t *base;                                   // slab memory, cache-line aligned
+    uint32_t num_cells;                              // number of cells in the slab
+    uint32_t used_cells;                             // number of cells currently in use
+    uint32_t bitmap[DMA_DESC_POOL_MAX_CELLS / 32];   // one bit per cell, set = in use
+    uint16_t run_cells[DMA_DESC_POOL_MAX_CELLS];     // run length (in cells) recorded at the first cell of each allocation
+};
+
+static SLIST_HEAD(dma_desc_pool_slab_list_t, dma_desc_pool_slab_t) s_slabs = SLIST_HEAD_INITIALIZER(s_slabs);
+static portMUX_TYPE s_pool_lock = portMUX_INITIALIZER_UNLOCKED;
+static size_t s_cell_size;      // lazily initialized, see desc_pool_cell_size()
+static size_t s_used_bytes;
+static size_t s_peak_used_bytes;
+static uint32_t s_num_slabs;
+static uint32_t s_num_allocs;
+
+static size_t desc_pool_cell_size(void)
+{
+    if (s_cell_size == 0) {
+        size_t cell = DMA_DESC_POOL_MIN_CELL;
+        size_t line = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_INT_MEM, CACHE_TYPE_DATA);
+        if (line > cell) {
+            cell = line;
+        }
+        s_cell_size = cell;
+    }
+    return s_cell_size;
+}
+
+static inline bool slab_cell_used(const dma_desc_pool_slab_t *slab, uint32_t cell)
+{
+    return slab->bitmap[cell / 32] & (1UL << (cell % 32));
+}
+
+static inline void slab_mark_cells(dma_desc_pool_slab_t *slab, uint32_t start, uint32_t count, bool used)
+{
+    for (uint32_t i = start; i < start + count; i++) {
+        if (used) {
+            slab->bitmap[i / 32] |= (1UL << (i % 32));
+        } else {
+            slab->bitmap[i / 32] &= ~(1UL << (i % 32));
+        }
+    }
+}
+
+// find a run of free cells whose start address satisfies the alignment, -1 if none
+static int slab_find_run(const dma_desc_pool_slab_t *slab, uint32_t count, size_t alignment, size_t cell_size)
+{
+    uint32_t cell_step = alignment > cell_size ? alignment / cell_size : 1;
+    for (uint32_t start = 0; start + count <= slab->num_cells; start += cell_step) {
+        uint32_t i = 0;
+        while (i < count && !slab_cell_used(slab, start + i)) {
+            i++;
+        }
+        if (i == count) {
+            return (int)start;
+        }
+    }
+    return -1;
+}
+
+static dma_desc_pool_slab_t *slab_create(size_t cell_size)
+{
+    dma_desc_pool_slab_t *slab = heap_caps_calloc(1, sizeof(dma_desc_pool_slab_t),
+                                                  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (slab == NULL) {
+        return NULL;
+    }
+    // the slab is dedicated to descriptors and aligned to the cache line,
+    // so descriptor traffic cannot false-share a line with other CPU data
+    slab->base = heap_caps_aligned_calloc(cell_size, 1, DMA_DESC_POOL_SLAB_SIZE,
+                                          MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+    if (slab->base == NULL) {
+        free(slab);
+        return NULL;
+    }
+    slab->num_cells = DMA_DESC_POOL_SLAB_SIZE / cell_size;
+    return slab;
+}
+
+esp_err_t esp_dma_desc_pool_alloc(uint32_t mem_caps, size_t alignment, size_t size, void **ret_addr)
+{
+    ESP_RETURN_ON_FALSE(size && ret_addr, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    if (alignment == 0) {
+        alignment = 1;
+    }
+    ESP_RETURN_ON_FALSE((alignment & (alignment - 1)) == 0, ESP_ERR_INVALID_ARG, TAG, "alignment not power of 2");
+
+    size_t cell_size = desc_pool_cell_size();
+    uint32_t count = ALIGN_UP(size, cell_size) / cell_size;
+
+    // requests the pool cannot serve (external memory, oversize, alignment
+    // beyond the slab's own) fall back to a dedicated heap allocation
+    if ((mem_caps & MALLOC_CAP_SPIRAM) || (count > DMA_DESC_POOL_SLAB_SIZE / cell_size) ||
+        (alignment > cell_size)) {
+        void *addr = heap_caps_aligned_calloc(alignment, 1, size, mem_caps);
+        ESP_RETURN_ON_FALSE(addr, ESP_ERR_NO_MEM, TAG, "no mem for descriptors");
+        *ret_addr = addr;
+        return ESP_OK;
+    }
+
+    uint8_t *addr = NULL;
+    dma_desc_pool_slab_t *slab = NULL;
+    int start = -1;
+
+    portENTER_CRITICAL(&s_pool_lock);
+    SLIST_FOREACH(slab, &s_slabs, next) {
+        start = slab_find_run(slab, count, alignment, cell_size);
+        if (start >= 0) {
+            break;
+        }
+    }
+    if (start >= 0) {
+        slab_mark_cells(slab, start, count, true);
+        slab->run_cells[start] = count;
+        slab->used_cells += count;
+        addr = slab->base + (size_t)start * cell_size;
+        s_used_bytes += (size_t)count * cell_size;
+        if (s_used_bytes > s_peak_used_bytes) {
+            s_peak_used_bytes = s_used_bytes;
+        }
+        s_num_allocs++;
+    }
+    portEXIT_CRITICAL(&s_pool_lock);
+
+    if (addr == NULL) {
+        // all slabs full (or none yet), grow the pool by one slab
+        slab = slab_create(cell_size);
+        ESP_RETURN_ON_FALSE(slab, ESP_ERR_NO_MEM, TAG, "no mem for descriptor slab");
+        portENTER_CRITICAL(&s_pool_lock);
+        slab_mark_cells(slab, 0, count, true);
+        slab->run_cells[0] = count;
+        slab->used_cells = count;
+        SLIST_INSERT_HEAD(&s_slabs, slab, next);
+        addr = slab->base;
+        s_num_slabs++;
+        s_used_bytes += (size_t)count * cell_size;
+        if (s_used_bytes > s_peak_used_bytes) {
+            s_peak_used_bytes = s_used_bytes;
+        }
+        s_num_allocs++;
+        portEXIT_CRITICAL(&s_pool_lock);
+        ESP_LOGD(TAG, "new slab @%p (%d bytes, %d-byte cells)",
+                 slab->base, DMA_DESC_POOL_SLAB_SIZE, (int)cell_size);
+    }
+
+    memset(addr, 0, size);
+    *ret_addr = addr;
+    return ESP_OK;
+}
+
+esp_err_t esp_dma_desc_pool_free(void *addr)
+{
+    if (addr == NULL) {
+        return ESP_OK;
+    }
+
+    size_t cell_size = desc_pool_cell_size();
+    bool found = false;
+
+    portENTER_CRITICAL(&s_pool_lock);
+    dma_desc_pool_slab_t *slab;
+    SLIST_FOREACH(slab, &s_slabs, next) {
+        if ((uint8_t *)addr >= slab->base && (uint8_t *)addr < slab->base + DMA_DESC_POOL_SLAB_SIZE) {
+            uint32_t start = ((uint8_t *)addr - slab->base) / cell_size;
+            uint32_t count = slab->run_cells[start];
+            slab_mark_cells(slab, start, count, false);
+            slab->run_cells[start] = 0;
+            slab->used_cells -= count;
+            s_used_bytes -= (size_t)count * cell_size;
+            s_num_allocs--;
+            found = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_pool_lock);
+
+    if (!found) {
+        // fallback allocation, owned by the heap
+        free(addr);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_dma_desc_pool_get_stats(esp_dma_desc_pool_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    portENTER_CRITICAL(&s_pool_lock);
+    stats->total_bytes = (size_t)s_num_slabs * DMA_DESC_POOL_SLAB_SIZE;
+    stats->used_bytes = s_used_bytes;
+    stats->peak_used_bytes = s_peak_used_bytes;
+    stats->num_slabs = s_num_slabs;
+    stats->num_allocs = s_num_allocs;
+    portEXIT_CRITICAL(&s_pool_lock);
+    return ESP_OK;
+}
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sys/queue.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "soc/soc_caps.h"
+#include "sdkconfig.h"
+#include "esp_private/gdma.h"
+#include "esp_private/gdma_arbiter.h"
+
+static const char *TAG = "gdma-arbiter";
+
+#define GDMA_ARBITER_NAME_MAX    32
+// Budget percentages are mapped onto the 4-bit token weight of the hardware
+// arbiter; gdma_set_weight() rejects values the target cannot take.
+#define GDMA_ARBITER_MAX_WEIGHT  15
+
+typedef struct gdma_arbiter_entry_t {
+    SLIST_ENTRY(gdma_arbiter_entry_t) next;
+    char name[GDMA_ARBITER_NAME_MAX];
+    gdma_channel_handle_t chan;
+    gdma_arbiter_stats_t stats;
+} gdma_arbiter_entry_t;
+
+static SLIST_HEAD(gdma_arbiter_list_, gdma_arbiter_entry_t) s_arbiter_list = SLIST_HEAD_INITIALIZER(s_arbiter_list);
+static portMUX_TYPE s_arbiter_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// must be called with s_arbiter_lock held
+static gdma_arbiter_entry_t *gdma_arbiter_find(const char *name)
+{
+    gdma_arbiter_entry_t *entry;
+    SLIST_FOREACH(entry, &s_arbiter_list, next) {
+        if (strcmp(entry->name, name) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+esp_err_t gdma_arbiter_reserve(const gdma_arbiter_reservation_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(config && config->name, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(strlen(config->name) < GDMA_ARBITER_NAME_MAX, ESP_ERR_INVALID_ARG, TAG, "name too long");
+
+    gdma_arbiter_entry_t *entry = heap_caps_calloc(1, sizeof(gdma_arbiter_entry_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(entry, ESP_ERR_NO_MEM, TAG, "no memory for reservation");
+    strcpy(entry->name, config->name);
+
+    // Grab the channel up front: this is the whole point of a reservation,
+    // a later claim must not compete with bulk consumers for free channels
+    esp_err_t ret = ESP_OK;
+    gdma_channel_alloc_config_t alloc_config = {
+        .direction = config->direction,
+    };
+    ESP_GOTO_ON_ERROR(gdma_new_ahb_channel(&alloc_config, &entry->chan), err, TAG, "no free channel for \"%s\"", config->name);
+    ESP_GOTO_ON_ERROR(gdma_set_priority(entry->chan, config->priority), err, TAG, "set priority failed");
+
+    portENTER_CRITICAL(&s_arbiter_lock);
+    bool duplicate = (gdma_arbiter_find(config->name) != NULL);
+    if (!duplicate) {
+        SLIST_INSERT_HEAD(&s_arbiter_list, entry, next);
+    }
+    portEXIT_CRITICAL(&s_arbiter_lock);
+    ESP_GOTO_ON_FALSE(!duplicate, ESP_ERR_INVALID_STATE, err, TAG, "reservation \"%s\" already exists", config->name);
+    return ESP_OK;
+
+err:
+    if (entry->chan) {
+        gdma_del_channel(entry->chan);
+    }
+    free(entry);
+    return ret;
+}
+
+esp_err_t gdma_arbiter_unreserve(const char *name)
+{
+    ESP_RETURN_ON_FALSE(name, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    portENTER_CRITICAL(&s_arbiter_lock);
+    gdma_arbiter_entry_t *entry = gdma_arbiter_find(name);
+    if (entry && !entry->stats.claimed) {
+        SLIST_REMOVE(&s_arbiter_list, entry, gdma_arbiter_entry_t, next);
+    }
+    bool claimed = entry && entry->stats.claimed;
+    portEXIT_CRITICAL(&s_arbiter_lock);
+
+    ESP_RETURN_ON_FALSE(entry, ESP_ERR_NOT_FOUND, TAG, "no reservation \"%s\"", name);
+    ESP_RETURN_ON_FALSE(!claimed, ESP_ERR_INVALID_STATE, TAG, "\"%s\" is still claimed", name);
+
+    gdma_del_channel(entry->chan);
+    free(entry);
+    return ESP_OK;
+}
+
+esp_err_t gdma_arbiter_claim(const char *name, gdma_channel_handle_t *ret_chan)
+{
+    ESP_RETURN_ON_FALSE(name && ret_chan, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL(&s_arbiter_lock);
+    gdma_arbiter_entry_t *entry = gdma_arbiter_find(name);
+    if (entry) {
+        if (entry->stats.claimed) {
+            entry->stats.denied_claims++;
+            ret = ESP_ERR_INVALID_STATE;
+        } else {
+            entry->stats.claimed = true;
+            entry->stats.claims++;
+            *ret_chan = entry->chan;
+            ret = ESP_OK;
+        }
+    }
+    portEXIT_CRITICAL(&s_arbiter_lock);
+    return ret;
+}
+
+esp_err_t gdma_arbiter_release(const char *name)
+{
+    ESP_RETURN_ON_FALSE(name, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL(&s_arbiter_lock);
+    gdma_arbiter_entry_t *entry = gdma_arbiter_find(name);
+    if (entry) {
+        if (entry->stats.claimed) {
+            entry->stats.claimed = false;
+            ret = ESP_OK;
+        } else {
+            ret = ESP_ERR_INVALID_STATE;
+        }
+    }
+    portEXIT_CRITICAL(&s_arbiter_lock);
+    return ret;
+}
+
+esp_err_t gdma_arbiter_set_budget(const char *name, uint32_t percent)
+{
+    ESP_RETURN_ON_FALSE(name, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(percent >= 1 && percent <= 100, ESP_ERR_INVALID_ARG, TAG, "percent out of range [1,100]");
+
+#if SOC_GDMA_SUPPORT_WEIGHTED_ARBITRATION && CONFIG_GDMA_ENABLE_WEIGHTED_ARBITRATION
+    portENTER_CRITICAL(&s_arbiter_lock);
+    gdma_arbiter_entry_t *entry = gdma_arbiter_find(name);
+    gdma_channel_handle_t chan = entry ? entry->chan : NULL;
+    portEXIT_CRITICAL(&s_arbiter_lock);
+    ESP_RETURN_ON_FALSE(entry, ESP_ERR_NOT_FOUND, TAG, "no reservation \"%s\"", name);
+
+    uint32_t weight = (percent * GDMA_ARBITER_MAX_WEIGHT + 99) / 100;
+    ESP_RETURN_ON_ERROR(gdma_set_weight(chan, weight), TAG, "set weight failed");
+
+    portENTER_CRITICAL(&s_arbiter_lock);
+    // re-check: the reservation may have been dropped while the weight was applied
+    entry = gdma_arbiter_find(name);
+    if (entry) {
+        entry->stats.budget_percent = percent;
+    }
+    portEXIT_CRITICAL(&s_arbiter_lock);
+    return entry ? ESP_OK : ESP_ERR_NOT_FOUND;
+#else
+    // Without token-based arbitration a share cannot be enforced; use the
+    // reservation priority instead of silently pretending to budget
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t gdma_arbiter_get_stats(const char *name, gdma_arbiter_stats_t *out_stats)
+{
+    ESP_RETURN_ON_FALSE(name && out_stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL(&s_arbiter_lock);
+    gdma_arbiter_entry_t *entry = gdma_arbiter_find(name);
+    if (entry) {
+        *out_stats = entry->stats;
+        ret = ESP_OK;
+    }
+    portEXIT_CRITICAL(&s_arbiter_lock);
+    return ret;
+}
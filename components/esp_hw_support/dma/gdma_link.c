@@ -15,6 +15,9 @@
 #include "esp_memory_utils.h"
 #include "esp_heap_caps.h"
 #include "esp_private/gdma_link.h"
+#if CONFIG_DMA_DESC_POOL_ENABLE
+#include "esp_private/dma_desc_pool.h"
+#endif
 #include "hal/cache_hal.h"
 #include "hal/efuse_hal.h"
 #include "hal/cache_ll.h"
@@ -51,6 +54,15 @@ struct gdma_link_list_item_t {
 ///< Maximum size of the buffer that can be carried by a DMA link list item
 #define GDMA_MAX_BUFFER_SIZE_PER_LINK_ITEM 4095
 
+static void gdma_link_free_items(uint8_t *items)
+{
+#if CONFIG_DMA_DESC_POOL_ENABLE
+    esp_dma_desc_pool_free(items);
+#else
+    free(items);
+#endif
+}
+
 typedef struct gdma_link_list_t {
     uint32_t num_items; // number of items in the link list
     size_t item_size;   // size of each item
@@ -93,8 +105,15 @@ esp_err_t gdma_new_link_list(const gdma_link_list_config_t *config, gdma_link_li
     } else {
         list_items_mem_caps |= MALLOC_CAP_INTERNAL;
     }
+#if CONFIG_DMA_DESC_POOL_ENABLE
+    // descriptors are packed into the shared pool, which falls back to a
+    // plain heap allocation for external memory or oversize requests
+    ESP_GOTO_ON_ERROR(esp_dma_desc_pool_alloc(list_items_mem_caps, item_alignment, num_items * item_size, (void **)&items),
+                      err, TAG, "no mem for link list items");
+#else
     items = heap_caps_aligned_calloc(item_alignment, num_items, item_size, list_items_mem_caps);
     ESP_GOTO_ON_FALSE(items, ESP_ERR_NO_MEM, err, TAG, "no mem for link list items");
+#endif
 
     // do memory sync if the list items are in the cache
     uint32_t data_cache_line_size = 0;
@@ -126,7 +145,7 @@ err:
         free(list);
     }
     if (items) {
-        free(items);
+        gdma_link_free_items(items);
     }
     return ret;
 }
@@ -135,7 +154,7 @@ esp_err_t gdma_del_link_list(gdma_link_list_handle_t list)
 {
     ESP_RETURN_ON_FALSE(list, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
     ESP_LOGD(TAG, "del link list at %p", list);
-    free(list->items);
+    gdma_link_free_items(list->items);
     free(list);
     return ESP_OK;
 }
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Occupancy statistics of the DMA descriptor pool
+ */
+typedef struct {
+    size_t total_bytes;     /*!< Total capacity of all slabs */
+    size_t used_bytes;      /*!< Bytes currently handed out to descriptor allocations */
+    size_t peak_used_bytes; /*!< High-water mark of used_bytes */
+    uint32_t num_slabs;     /*!< Number of slabs currently allocated */
+    uint32_t num_allocs;    /*!< Number of live allocations served from the pool */
+} esp_dma_desc_pool_stats_t;
+
+/**
+ * @brief Allocate a zero-initialized block of DMA descriptor memory
+ *
+ * Small internal-memory requests are packed into cache-line-aligned slabs
+ * that are dedicated to DMA descriptors, so descriptors from different
+ * drivers neither waste a full heap allocation each nor share cache lines
+ * with unrelated CPU data. Requests that do not fit the pool (external
+ * memory caps, or larger than a slab) fall back to a regular heap
+ * allocation transparently.
+ *
+ * @param mem_caps Heap capabilities the memory must satisfy (MALLOC_CAP_*)
+ * @param alignment Required alignment of the returned address, power of 2
+ * @param size Size of the block in bytes
+ * @param[out] ret_addr Returned address of the allocated block
+ * @return
+ *      - ESP_OK: Allocation succeeded
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t esp_dma_desc_pool_alloc(uint32_t mem_caps, size_t alignment, size_t size, void **ret_addr);
+
+/**
+ * @brief Free a block previously allocated by esp_dma_desc_pool_alloc
+ *
+ * Accepts both pool-backed and fallback allocations. Freeing NULL is a no-op.
+ *
+ * @param addr Address returned by esp_dma_desc_pool_alloc
+ * @return
+ *      - ESP_OK: Block freed
+ */
+esp_err_t esp_dma_desc_pool_free(void *addr);
+
+/**
+ * @brief Read the current occupancy statistics of the descriptor pool
+ *
+ * @param[out] stats Returned statistics
+ * @return
+ *      - ESP_OK: Statistics returned
+ *      - ESP_ERR_INVALID_ARG: stats is NULL
+ */
+esp_err_t esp_dma_desc_pool_get_stats(esp_dma_desc_pool_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
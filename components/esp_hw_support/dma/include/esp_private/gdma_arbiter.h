@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_private/gdma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of a named GDMA channel reservation
+ */
+typedef struct {
+    const char *name;                   /*!< Unique consumer name, e.g. "lcd_flush". Copied by the arbiter. */
+    gdma_channel_direction_t direction; /*!< Transfer direction of the reserved channel */
+    uint32_t priority;                  /*!< Arbitration priority pushed to hardware, see gdma_set_priority() */
+} gdma_arbiter_reservation_config_t;
+
+/**
+ * @brief Per-reservation statistics
+ */
+typedef struct {
+    uint32_t claims;          /*!< Number of successful claims since the reservation was made */
+    uint32_t denied_claims;   /*!< Claim attempts that found the channel already claimed (contention) */
+    uint32_t budget_percent;  /*!< Last bandwidth budget applied via gdma_arbiter_set_budget(), 0 if none */
+    bool claimed;             /*!< Whether the channel is currently handed out */
+} gdma_arbiter_stats_t;
+
+/**
+ * @brief Reserve a named GDMA channel for a latency-critical consumer
+ *
+ * The channel is allocated from the AHB pool immediately and parked, so a later
+ * gdma_arbiter_claim() cannot fail because bulk consumers exhausted the free
+ * channels. The configured priority is pushed to the hardware arbiter right away.
+ *
+ * @param[in] config Reservation configuration
+ * @return
+ *      - ESP_OK: Channel reserved successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument (NULL config or name)
+ *      - ESP_ERR_INVALID_STATE: A reservation with the same name already exists
+ *      - ESP_ERR_NO_MEM: No free channel or no memory for bookkeeping
+ */
+esp_err_t gdma_arbiter_reserve(const gdma_arbiter_reservation_config_t *config);
+
+/**
+ * @brief Drop a reservation and return its channel to the free pool
+ *
+ * @param[in] name Name used in gdma_arbiter_reserve()
+ * @return
+ *      - ESP_OK: Reservation removed and channel deleted
+ *      - ESP_ERR_INVALID_ARG: name is NULL
+ *      - ESP_ERR_NOT_FOUND: No reservation with this name
+ *      - ESP_ERR_INVALID_STATE: The channel is still claimed
+ */
+esp_err_t gdma_arbiter_unreserve(const char *name);
+
+/**
+ * @brief Claim the reserved channel for use
+ *
+ * The returned handle can be used with all regular GDMA channel APIs (connect,
+ * register callbacks, start, ...), but must not be deleted by the caller; hand
+ * it back with gdma_arbiter_release() instead.
+ *
+ * @param[in] name Name used in gdma_arbiter_reserve()
+ * @param[out] ret_chan Returned channel handle
+ * @return
+ *      - ESP_OK: Channel claimed successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_NOT_FOUND: No reservation with this name
+ *      - ESP_ERR_INVALID_STATE: Channel already claimed (counted as contention)
+ */
+esp_err_t gdma_arbiter_claim(const char *name, gdma_channel_handle_t *ret_chan);
+
+/**
+ * @brief Hand a claimed channel back to its reservation
+ *
+ * The channel stays allocated and keeps its priority and weight settings; only
+ * the claim is cleared so the next consumer of this name can take it.
+ *
+ * @param[in] name Name used in gdma_arbiter_reserve()
+ * @return
+ *      - ESP_OK: Channel released successfully
+ *      - ESP_ERR_INVALID_ARG: name is NULL
+ *      - ESP_ERR_NOT_FOUND: No reservation with this name
+ *      - ESP_ERR_INVALID_STATE: Channel was not claimed
+ */
+esp_err_t gdma_arbiter_release(const char *name);
+
+/**
+ * @brief Assign a bandwidth budget to a reserved channel
+ *
+ * On targets with weighted arbitration the percentage is mapped onto the
+ * hardware token weight, so the channel gets roughly this share of the bus
+ * when all contenders are saturating it. Budgets of all reservations do not
+ * need to add up to 100; weights are relative.
+ *
+ * @param[in] name Name used in gdma_arbiter_reserve()
+ * @param[in] percent Desired bandwidth share in percent, 1 ~ 100
+ * @return
+ *      - ESP_OK: Budget applied successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_NOT_FOUND: No reservation with this name
+ *      - ESP_ERR_NOT_SUPPORTED: Target has no weighted arbitration hardware
+ */
+esp_err_t gdma_arbiter_set_budget(const char *name, uint32_t percent);
+
+/**
+ * @brief Read the statistics of a reservation
+ *
+ * @param[in] name Name used in gdma_arbiter_reserve()
+ * @param[out] out_stats Filled with the current statistics
+ * @return
+ *      - ESP_OK: Statistics returned successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_NOT_FOUND: No reservation with this name
+ */
+esp_err_t gdma_arbiter_get_stats(const char *name, gdma_arbiter_stats_t *out_stats);
+
+#ifdef __cplusplus
+}
+#endif
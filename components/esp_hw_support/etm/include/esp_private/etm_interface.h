@@ -31,6 +31,7 @@ typedef enum {
     ETM_TRIG_PERIPH_LP_CORE,  /*!< ETM trigger source: Low-Power Core */
     ETM_TRIG_PERIPH_MODEM,    /*!< ETM trigger source: Modem */
     ETM_TRIG_PERIPH_LEDC,     /*!< ETM trigger source: LEDC */
+    ETM_TRIG_PERIPH_PCNT,     /*!< ETM trigger source: Pulse Counter */
 } etm_trigger_peripheral_t;
 
 /**
@@ -395,11 +395,52 @@ static inline int esp_intr_level_to_flags(int level)
 
 /**
  * @brief Dump the status of allocated interrupts
+ *
+ * With CONFIG_ESP_INTR_PROFILING enabled, each allocated handler line also
+ * shows the dispatch count, accumulated and worst-case CPU cycles, and the
+ * CPU share over the last completed duty window.
+ *
  * @param stream  The stream to dump to, if NULL then stdout is used
  * @return ESP_OK on success
  */
 esp_err_t esp_intr_dump(FILE *stream);
 
+#if CONFIG_ESP_INTR_PROFILING || __DOXYGEN__
+
+/**
+ * @brief Callback invoked when a handler's CPU share exceeds the watch threshold
+ *
+ * Runs in ISR context, directly from the interrupt dispatcher; it must be
+ * IRAM-safe and must not block.
+ *
+ * @param source        Interrupt source of the handler (ETS_*_INTR_SOURCE)
+ * @param cpu           Core the handler ran on
+ * @param duty_permille CPU share of the handler over the last window, in 1/1000
+ * @param arg           User argument passed to esp_intr_duty_watch()
+ */
+typedef void (*esp_intr_duty_watch_cb_t)(int source, int cpu, uint32_t duty_permille, void *arg);
+
+/**
+ * @brief Watch for interrupt handlers exceeding a CPU share threshold
+ *
+ * The CPU share of every profiled handler is evaluated over windows of
+ * CONFIG_ESP_INTR_PROFILING_WINDOW_CYCLES cycles; whenever a completed window
+ * reaches the threshold, the callback fires from the dispatcher. This is the
+ * production counterpart of esp_intr_dump(): it catches a misbehaving ISR the
+ * moment it starts eating a core, without polling.
+ *
+ * Only one watch can be active; a new call replaces the previous one.
+ *
+ * @param threshold_permille CPU share threshold in 1/1000 (e.g. 300 = 30 %)
+ * @param cb                 Callback to invoke, or NULL to disable the watch
+ * @param arg                User argument passed to the callback
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the threshold is above 1000
+ */
+esp_err_t esp_intr_duty_watch(uint32_t threshold_permille, esp_intr_duty_watch_cb_t cb, void *arg);
+
+#endif // CONFIG_ESP_INTR_PROFILING || __DOXYGEN__
+
 
 /**
  * @brief Check if the given pointer is in the safe ISR area.
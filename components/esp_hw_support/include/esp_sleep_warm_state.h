@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file esp_sleep_warm_state.h
+ *
+ * Warm-resume state store: subsystems register small state blobs that are
+ * serialized into RTC memory right before deep sleep entry and can be read
+ * back after wake, instead of rebuilding the state from flash. Intended for
+ * small, cheap-to-serialize metadata (caches, directories, static configs),
+ * not for bulk data: the backing pool lives in RTC memory and is limited to
+ * CONFIG_ESP_SLEEP_WARM_STATE_POOL_SIZE bytes total.
+ *
+ * Typical usage from a subsystem:
+ *  - during init, call esp_sleep_warm_state_restore(); on ESP_OK use the
+ *    blob and skip the expensive rebuild, on any error rebuild as usual
+ *  - also during init, call esp_sleep_warm_state_register() so the current
+ *    state is captured before the next deep sleep entry
+ *
+ * Each blob is identified by a string key and protected by a CRC; a blob
+ * whose size or checksum does not match what was saved is not restored.
+ */
+
+/**
+ * @brief Callback serializing a subsystem's state before deep sleep entry
+ *
+ * Called from the deep sleep entry path with interrupts disabled; it must not
+ * block or call APIs that may block. It should only fill the provided buffer.
+ *
+ * @param buf  Destination buffer in RTC memory, of the size passed to
+ *             esp_sleep_warm_state_register()
+ * @param size Size of the destination buffer in bytes
+ * @param arg  User argument passed to esp_sleep_warm_state_register()
+ *
+ * @return ESP_OK if the buffer was filled and should be restorable after
+ *         wake; any other value marks the blob as invalid for this cycle
+ */
+typedef esp_err_t (*esp_sleep_warm_state_save_cb_t)(void *buf, size_t size, void *arg);
+
+/**
+ * @brief Register a state blob to be captured before each deep sleep entry
+ *
+ * Reserves @p size bytes in the RTC state pool for the given key and arranges
+ * for @p save_cb to run on every subsequent deep sleep entry. Registration
+ * does not persist across reboots; subsystems register again during each
+ * boot, typically right after attempting a restore.
+ *
+ * @param key     Key identifying the blob, unique among all users
+ * @param size    Size of the blob in bytes
+ * @param save_cb Callback filling the blob before deep sleep entry
+ * @param arg     User argument passed to the callback
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if key or save_cb is NULL, or size is 0
+ *      - ESP_ERR_INVALID_STATE if the key is already registered
+ *      - ESP_ERR_NO_MEM if the pool or the slot table is full
+ */
+esp_err_t esp_sleep_warm_state_register(const char *key, size_t size,
+                                        esp_sleep_warm_state_save_cb_t save_cb, void *arg);
+
+/**
+ * @brief Read back a state blob saved before the last deep sleep entry
+ *
+ * Succeeds only when the chip woke from deep sleep, a blob with the given key
+ * and exactly @p size bytes was saved before entry, and its checksum matches.
+ *
+ * @param key  Key the blob was registered with
+ * @param buf  Destination buffer, at least @p size bytes
+ * @param size Expected size of the blob in bytes
+ *
+ * @return
+ *      - ESP_OK if the blob was copied to @p buf
+ *      - ESP_ERR_INVALID_ARG if key or buf is NULL, or size is 0
+ *      - ESP_ERR_INVALID_STATE if the last reset was not a deep sleep wake
+ *      - ESP_ERR_NOT_FOUND if no blob with this key and size was saved
+ *      - ESP_ERR_INVALID_CRC if the blob was corrupted
+ */
+esp_err_t esp_sleep_warm_state_restore(const char *key, void *buf, size_t size);
+
+/**
+ * @brief Drop a saved state blob
+ *
+ * Use when the saved state is known to be stale (e.g. the underlying flash
+ * content changed). A later esp_sleep_warm_state_restore() with this key
+ * returns ESP_ERR_NOT_FOUND. The registration, if any, stays in effect and
+ * the blob is captured again on the next deep sleep entry.
+ *
+ * @param key Key the blob was registered with
+ *
+ * @return
+ *      - ESP_OK on success (also when no blob with this key was saved)
+ *      - ESP_ERR_INVALID_ARG if key is NULL
+ */
+esp_err_t esp_sleep_warm_state_invalidate(const char *key);
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
@@ -65,6 +66,18 @@ being triggered, that is why it is separate from the normal LOG* scheme.
 typedef struct shared_vector_desc_t shared_vector_desc_t;
 typedef struct vector_desc_t vector_desc_t;
 
+#if CONFIG_ESP_INTR_PROFILING
+/** Per-handler dispatch statistics, updated by the dispatchers */
+typedef struct {
+    uint32_t count;                 //number of dispatches
+    uint64_t cycles;                //accumulated cycles spent in the handler
+    uint32_t max_cycles;            //worst-case cycles of a single dispatch
+    uint32_t window_start;          //cycle count at the start of the current duty window
+    uint32_t window_cycles;         //cycles spent in the handler during the current window
+    uint32_t last_duty_permille;    //CPU share over the last completed window
+} intr_prof_t;
+#endif
+
 struct shared_vector_desc_t {
     int disabled: 1;
     int source: 16;
@@ -72,6 +85,9 @@ struct shared_vector_desc_t {
     uint32_t statusmask;
     intr_handler_t isr;
     void *arg;
+#if CONFIG_ESP_INTR_PROFILING
+    intr_prof_t prof;
+#endif
     shared_vector_desc_t *next;
 };
 
@@ -97,6 +113,9 @@ struct vector_desc_t {
     unsigned int intno: 5;
     int source: 16;                 //Interrupt mux flags, used when not shared
     shared_vector_desc_t *shared_vec_info;  //used when VECDESC_FL_SHARED
+#if CONFIG_ESP_INTR_PROFILING
+    intr_prof_t prof;               //used when VECDESC_FL_NONSHARED
+#endif
     vector_desc_t *next;
 };
 
@@ -112,6 +131,9 @@ struct non_shared_isr_arg_t {
     intr_handler_t isr;
     void *isr_arg;
     int source;
+#if CONFIG_ESP_INTR_PROFILING
+    intr_prof_t *prof;  //points into the vector_desc_t so esp_intr_dump can reach the stats
+#endif
 };
 
 static esp_err_t intr_free_for_current_cpu(intr_handle_t handle);
@@ -459,6 +481,51 @@ static int get_available_int(int flags, int cpu, int force, int source)
     return best;
 }
 
+#if CONFIG_ESP_INTR_PROFILING
+//Duty watch state; the callback fires from the dispatcher (ISR context) when
+//a handler's CPU share over a completed window reaches the threshold.
+static volatile esp_intr_duty_watch_cb_t s_duty_watch_cb;
+static void *s_duty_watch_arg;
+static uint32_t s_duty_watch_threshold_permille;
+
+//Account one dispatch of a handler. Runs in the dispatcher, in ISR context.
+static void ESP_INTR_IRAM_ATTR intr_prof_update(intr_prof_t *prof, int source, uint32_t start, uint32_t end)
+{
+    uint32_t delta = end - start;
+    prof->count++;
+    prof->cycles += delta;
+    if (delta > prof->max_cycles) {
+        prof->max_cycles = delta;
+    }
+    prof->window_cycles += delta;
+    uint32_t window = end - prof->window_start;
+    if (window >= CONFIG_ESP_INTR_PROFILING_WINDOW_CYCLES) {
+        uint32_t duty = (uint32_t)(((uint64_t)prof->window_cycles * 1000) / window);
+        prof->last_duty_permille = duty;
+        prof->window_start = end;
+        prof->window_cycles = 0;
+        esp_intr_duty_watch_cb_t cb = s_duty_watch_cb;
+        if (cb != NULL && duty >= s_duty_watch_threshold_permille) {
+            cb(source, esp_cpu_get_core_id(), duty, s_duty_watch_arg);
+        }
+    }
+}
+
+esp_err_t esp_intr_duty_watch(uint32_t threshold_permille, esp_intr_duty_watch_cb_t cb, void *arg)
+{
+    if (cb != NULL && threshold_permille > 1000) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_os_enter_critical(&spinlock);
+    s_duty_watch_cb = NULL;  //disable while the other fields change
+    s_duty_watch_threshold_permille = threshold_permille;
+    s_duty_watch_arg = arg;
+    s_duty_watch_cb = cb;
+    esp_os_exit_critical(&spinlock);
+    return ESP_OK;
+}
+#endif // CONFIG_ESP_INTR_PROFILING
+
 //Common shared isr handler. Chain-call all ISRs.
 static void ESP_INTR_IRAM_ATTR shared_intr_isr(void *arg)
 {
@@ -469,7 +536,13 @@ static void ESP_INTR_IRAM_ATTR shared_intr_isr(void *arg)
         if (!sh_vec->disabled) {
             if ((sh_vec->statusreg == NULL) || (*sh_vec->statusreg & sh_vec->statusmask)) {
                 traceISR_ENTER(sh_vec->source + ETS_INTERNAL_INTR_SOURCE_OFF);
+#if CONFIG_ESP_INTR_PROFILING
+                uint32_t prof_start = esp_cpu_get_cycle_count();
+#endif
                 sh_vec->isr(sh_vec->arg);
+#if CONFIG_ESP_INTR_PROFILING
+                intr_prof_update(&sh_vec->prof, sh_vec->source, prof_start, esp_cpu_get_cycle_count());
+#endif
                 // check if we will return to scheduler or to interrupted task after ISR
                 if (!os_task_switch_is_pended(esp_cpu_get_core_id())) {
                     traceISR_EXIT();
@@ -481,21 +554,31 @@ static void ESP_INTR_IRAM_ATTR shared_intr_isr(void *arg)
     esp_os_exit_critical_isr(&spinlock);
 }
 
-#if CONFIG_ESP_TRACE_ENABLE
+#if CONFIG_ESP_TRACE_ENABLE || CONFIG_ESP_INTR_PROFILING
 //Common non-shared isr handler wrapper.
 static void ESP_INTR_IRAM_ATTR non_shared_intr_isr(void *arg)
 {
     non_shared_isr_arg_t *ns_isr_arg = (non_shared_isr_arg_t*)arg;
+#if CONFIG_ESP_TRACE_ENABLE
     esp_os_enter_critical_isr(&spinlock);
     traceISR_ENTER(ns_isr_arg->source + ETS_INTERNAL_INTR_SOURCE_OFF);
     // FIXME: can we call ISR and check os_task_switch_is_pended() after releasing spinlock?
     // when CONFIG_ESP_TRACE_LIB_NONE is set ISRs for non-shared IRQs are called without spinlock
+#endif
+#if CONFIG_ESP_INTR_PROFILING
+    uint32_t prof_start = esp_cpu_get_cycle_count();
+#endif
     ns_isr_arg->isr(ns_isr_arg->isr_arg);
+#if CONFIG_ESP_INTR_PROFILING
+    intr_prof_update(ns_isr_arg->prof, ns_isr_arg->source, prof_start, esp_cpu_get_cycle_count());
+#endif
+#if CONFIG_ESP_TRACE_ENABLE
     // check if we will return to scheduler or to interrupted task after ISR
     if (!os_task_switch_is_pended(esp_cpu_get_core_id())) {
         traceISR_EXIT();
     }
     esp_os_exit_critical_isr(&spinlock);
+#endif
 }
 #endif
 
@@ -623,6 +706,9 @@ esp_err_t esp_intr_alloc_intrstatus_bind(int source, int flags, uint32_t intrsta
         sh_vec->next = vd->shared_vec_info;
         sh_vec->source = source;
         sh_vec->disabled = 0;
+#if CONFIG_ESP_INTR_PROFILING
+        sh_vec->prof.window_start = esp_cpu_get_cycle_count();
+#endif
         vd->shared_vec_info = sh_vec;
         vd->flags |= VECDESC_FL_SHARED;
         //(Re-)set shared isr handler to new value.
@@ -631,7 +717,7 @@ esp_err_t esp_intr_alloc_intrstatus_bind(int source, int flags, uint32_t intrsta
         //Mark as unusable for other interrupt sources. This is ours now!
         vd->flags = VECDESC_FL_NONSHARED;
         if (handler) {
-#if CONFIG_ESP_TRACE_ENABLE
+#if CONFIG_ESP_TRACE_ENABLE || CONFIG_ESP_INTR_PROFILING
             non_shared_isr_arg_t *ns_isr_arg = heap_caps_malloc(sizeof(non_shared_isr_arg_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
             if (!ns_isr_arg) {
                 esp_os_exit_critical(&spinlock);
@@ -641,6 +727,12 @@ esp_err_t esp_intr_alloc_intrstatus_bind(int source, int flags, uint32_t intrsta
             ns_isr_arg->isr = handler;
             ns_isr_arg->isr_arg = arg;
             ns_isr_arg->source = source;
+#if CONFIG_ESP_INTR_PROFILING
+            //the vector may have been used before, start with clean stats
+            memset(&vd->prof, 0, sizeof(vd->prof));
+            vd->prof.window_start = esp_cpu_get_cycle_count();
+            ns_isr_arg->prof = &vd->prof;
+#endif
             esp_cpu_intr_set_handler(intr, (esp_cpu_intr_handler_t)non_shared_intr_isr, ns_isr_arg);
 #else
             esp_cpu_intr_set_handler(intr, (esp_cpu_intr_handler_t)handler, arg);
@@ -831,7 +923,7 @@ static esp_err_t intr_free_for_current_cpu(intr_handle_t handle)
 
     if ((handle->vector_desc->flags & VECDESC_FL_NONSHARED) || free_shared_vector) {
         ESP_EARLY_LOGV(TAG, "esp_intr_free: Disabling int, killing handler");
-#if CONFIG_ESP_TRACE_ENABLE
+#if CONFIG_ESP_TRACE_ENABLE || CONFIG_ESP_INTR_PROFILING
         if (!free_shared_vector) {
             void *isr_arg = esp_cpu_intr_get_handler_arg(handle->vector_desc->intno);
             if (isr_arg) {
@@ -1013,6 +1105,17 @@ void ESP_INTR_IRAM_ATTR esp_intr_disable_source(int inum)
     esp_cpu_intr_disable(1 << inum);
 }
 
+#if CONFIG_ESP_INTR_PROFILING
+//Append the profiling stats of one handler to an esp_intr_dump line.
+//"load" is the CPU share over the last completed duty window.
+static void intr_prof_print(FILE *stream, const intr_prof_t *prof)
+{
+    fprintf(stream, " [cnt=%" PRIu32 " cycles=%" PRIu64 " max=%" PRIu32 " load=%" PRIu32 ".%" PRIu32 "%%]",
+            prof->count, prof->cycles, prof->max_cycles,
+            prof->last_duty_permille / 10, prof->last_duty_permille % 10);
+}
+#endif
+
 esp_err_t esp_intr_dump(FILE *stream)
 {
     if (stream == NULL) {
@@ -1076,10 +1179,16 @@ esp_err_t esp_intr_dump(FILE *stream)
                     fprintf(stream, "Reserved (run-time)");
                 } else if (vd->flags & VECDESC_FL_NONSHARED) {
                     fprintf(stream, "Used: %s", esp_isr_names[vd->source]);
+#if CONFIG_ESP_INTR_PROFILING
+                    intr_prof_print(stream, &vd->prof);
+#endif
                 } else if (vd->flags & VECDESC_FL_SHARED) {
                     fprintf(stream, "Shared: ");
                     for (shared_vector_desc_t *svd = vd->shared_vec_info; svd != NULL; svd = svd->next) {
                         fprintf(stream, "%s ", esp_isr_names[svd->source]);
+#if CONFIG_ESP_INTR_PROFILING
+                        intr_prof_print(stream, &svd->prof);
+#endif
                     }
                     ++shared_ints;
                 } else {
@@ -89,7 +89,9 @@ int16_t temp_sensor_get_raw_value(bool *range_changed)
 {
     int16_t result;
 
-    esp_os_enter_critical(&rtc_spinlock);
+    // The safe variant keeps this readable from ISR context as well, matching
+    // how the oneshot ADC shares the same spinlock for its ISR read path
+    esp_os_enter_critical_safe(&rtc_spinlock);
 
     // When this is the first time reading a value, check whether the time here minus the
     // initialization time is greater than 200 microseconds (the time for linear regression).
@@ -107,7 +109,7 @@ int16_t temp_sensor_get_raw_value(bool *range_changed)
     result = temperature_sensor_hal_get_degree(range_changed);
     adc_reset_lock_release();
 
-    esp_os_exit_critical(&rtc_spinlock);
+    esp_os_exit_critical_safe(&rtc_spinlock);
 
     return result;
 }
@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <sys/lock.h>
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_sleep_warm_state.h"
+#include "esp_system.h"
+#include "esp_rom_crc.h"
+
+#define WARM_STATE_MAX_SLOTS    CONFIG_ESP_SLEEP_WARM_STATE_MAX_SLOTS
+#define WARM_STATE_POOL_SIZE    CONFIG_ESP_SLEEP_WARM_STATE_POOL_SIZE
+#define WARM_STATE_MAGIC        0x57524d53  // "WRMS"
+
+static const char *TAG = "sleep_warm";
+
+// Saved slot table and blob pool. Offsets in the slot table refer to the pool
+// as it was written before the last deep sleep entry, which may differ from
+// the offsets assigned to registrations in the current boot.
+typedef struct {
+    uint32_t key_hash;
+    uint16_t offset;
+    uint16_t size;      // 0 means the slot is unused or invalidated
+    uint32_t crc;
+} warm_state_slot_t;
+
+typedef struct {
+    uint32_t magic;
+    warm_state_slot_t slots[WARM_STATE_MAX_SLOTS];
+    uint8_t pool[WARM_STATE_POOL_SIZE];
+} warm_state_store_t;
+
+static RTC_NOINIT_ATTR warm_state_store_t s_store;
+
+// Registrations made during the current boot, captured on deep sleep entry
+typedef struct {
+    uint32_t key_hash;  // 0 means the entry is unused
+    uint16_t offset;
+    uint16_t size;
+    esp_sleep_warm_state_save_cb_t save_cb;
+    void *arg;
+} warm_state_reg_t;
+
+static warm_state_reg_t s_regs[WARM_STATE_MAX_SLOTS];
+static size_t s_pool_used;
+static bool s_hook_installed;
+static _lock_t s_lock;
+
+static uint32_t warm_state_key_hash(const char *key)
+{
+    // FNV-1a; never returns 0 so 0 can mark unused registration entries
+    uint32_t hash = 2166136261UL;
+    while (*key != '\0') {
+        hash ^= (uint8_t) *key++;
+        hash *= 16777619UL;
+    }
+    return (hash != 0) ? hash : 1;
+}
+
+// Deep sleep entry hook: runs all save callbacks and rewrites the slot table.
+// Interrupts are disabled at this point, the callbacks must not block.
+static void warm_state_save(void)
+{
+    memset(s_store.slots, 0, sizeof(s_store.slots));
+    size_t slot = 0;
+    for (size_t i = 0; i < WARM_STATE_MAX_SLOTS; i++) {
+        const warm_state_reg_t *reg = &s_regs[i];
+        if (reg->key_hash == 0) {
+            continue;
+        }
+        void *buf = &s_store.pool[reg->offset];
+        if (reg->save_cb(buf, reg->size, reg->arg) != ESP_OK) {
+            continue;
+        }
+        s_store.slots[slot].key_hash = reg->key_hash;
+        s_store.slots[slot].offset = reg->offset;
+        s_store.slots[slot].size = reg->size;
+        s_store.slots[slot].crc = esp_rom_crc32_le(UINT32_MAX, buf, reg->size);
+        slot++;
+    }
+    s_store.magic = WARM_STATE_MAGIC;
+}
+
+esp_err_t esp_sleep_warm_state_register(const char *key, size_t size,
+                                        esp_sleep_warm_state_save_cb_t save_cb, void *arg)
+{
+    if (key == NULL || save_cb == NULL || size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (size > WARM_STATE_POOL_SIZE) {
+        return ESP_ERR_NO_MEM;
+    }
+    uint32_t hash = warm_state_key_hash(key);
+
+    esp_err_t err = ESP_OK;
+    _lock_acquire(&s_lock);
+    warm_state_reg_t *free_reg = NULL;
+    for (size_t i = 0; i < WARM_STATE_MAX_SLOTS; i++) {
+        if (s_regs[i].key_hash == hash) {
+            err = ESP_ERR_INVALID_STATE;
+            break;
+        }
+        if (s_regs[i].key_hash == 0 && free_reg == NULL) {
+            free_reg = &s_regs[i];
+        }
+    }
+    if (err == ESP_OK && (free_reg == NULL || s_pool_used + size > WARM_STATE_POOL_SIZE)) {
+        err = ESP_ERR_NO_MEM;
+    }
+    if (err == ESP_OK) {
+        free_reg->key_hash = hash;
+        free_reg->offset = s_pool_used;
+        free_reg->size = size;
+        free_reg->save_cb = save_cb;
+        free_reg->arg = arg;
+        s_pool_used += size;
+        if (!s_hook_installed) {
+            err = esp_deep_sleep_register_hook(&warm_state_save);
+            if (err == ESP_OK) {
+                s_hook_installed = true;
+            } else {
+                ESP_LOGE(TAG, "Failed to install deep sleep hook (0x%x)", err);
+                free_reg->key_hash = 0;
+                s_pool_used -= size;
+            }
+        }
+    }
+    _lock_release(&s_lock);
+    return err;
+}
+
+esp_err_t esp_sleep_warm_state_restore(const char *key, void *buf, size_t size)
+{
+    if (key == NULL || buf == NULL || size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (esp_reset_reason() != ESP_RST_DEEPSLEEP || s_store.magic != WARM_STATE_MAGIC) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    uint32_t hash = warm_state_key_hash(key);
+
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    _lock_acquire(&s_lock);
+    for (size_t i = 0; i < WARM_STATE_MAX_SLOTS; i++) {
+        const warm_state_slot_t *slot = &s_store.slots[i];
+        if (slot->size == 0 || slot->key_hash != hash) {
+            continue;
+        }
+        if (slot->size != size || slot->offset + slot->size > WARM_STATE_POOL_SIZE) {
+            err = ESP_ERR_NOT_FOUND;
+            break;
+        }
+        const void *blob = &s_store.pool[slot->offset];
+        if (esp_rom_crc32_le(UINT32_MAX, blob, slot->size) != slot->crc) {
+            err = ESP_ERR_INVALID_CRC;
+            break;
+        }
+        memcpy(buf, blob, size);
+        err = ESP_OK;
+        break;
+    }
+    _lock_release(&s_lock);
+    return err;
+}
+
+esp_err_t esp_sleep_warm_state_invalidate(const char *key)
+{
+    if (key == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint32_t hash = warm_state_key_hash(key);
+
+    _lock_acquire(&s_lock);
+    if (s_store.magic == WARM_STATE_MAGIC) {
+        for (size_t i = 0; i < WARM_STATE_MAX_SLOTS; i++) {
+            if (s_store.slots[i].key_hash == hash) {
+                s_store.slots[i].size = 0;
+            }
+        }
+    }
+    _lock_release(&s_lock);
+    return ESP_OK;
+}
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_io.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Type of LCD bounce flush engine handle
+ */
+typedef struct esp_lcd_bounce_flush_t *esp_lcd_bounce_flush_handle_t;
+
+/**
+ * @brief Prototype of the callback invoked when a complete frame has been handed to the panel
+ *
+ * @note The callback runs in the context of the panel IO transfer-done interrupt,
+ *       so it must only do ISR-safe work (e.g. signal the GUI task that the
+ *       framebuffer can be redrawn / swapped).
+ *
+ * @param[in] handle LCD bounce flush engine handle
+ * @param[in] user_ctx User data, passed from `esp_lcd_bounce_flush_config_t`
+ * @return Whether a high priority task has been woken up by this callback
+ */
+typedef bool (*esp_lcd_bounce_flush_frame_done_cb_t)(esp_lcd_bounce_flush_handle_t handle, void *user_ctx);
+
+/**
+ * @brief LCD bounce flush engine configuration
+ */
+typedef struct {
+    esp_lcd_panel_handle_t panel;       /*!< Panel the pixel data is sent to */
+    esp_lcd_panel_io_handle_t io;       /*!< Panel IO underlying the panel, used to track transfer completion */
+    size_t bounce_buffer_size;          /*!< Size of each of the two internal bounce buffers, in bytes.
+                                             Must hold at least one line of the widest flush area */
+    size_t bytes_per_pixel;             /*!< Size of one pixel of the color data, in bytes */
+    esp_lcd_bounce_flush_frame_done_cb_t on_frame_done; /*!< Called when the last chunk of a frame has been transferred, optional */
+    void *user_ctx;                     /*!< User data passed to on_frame_done */
+} esp_lcd_bounce_flush_config_t;
+
+/**
+ * @brief Create a double-buffered bounce flush engine on top of an LCD panel
+ *
+ * The engine allocates two DMA-capable bounce buffers in internal RAM. A flush
+ * of a (typically PSRAM resident) framebuffer is split into chunks: while one
+ * bounce buffer is being transmitted by the panel IO, the next chunk is copied
+ * and cache-synchronized into the other one, keeping the interface busy without
+ * ever making the DMA read from external memory.
+ *
+ * @note The engine registers its own `on_color_trans_done` IO callback; use the
+ *       `on_frame_done` callback of this engine instead of registering one on
+ *       the IO directly. On interfaces without a vertical sync signal, frame
+ *       completion is the closest point to align buffer swaps to; panels with a
+ *       hardware vsync (e.g. RGB) have their own bounce buffer support.
+ *
+ * @param[in] config LCD bounce flush engine configuration
+ * @param[out] ret_handle Returned engine handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_NO_MEM        if out of (internal DMA-capable) memory
+ *          - ESP_OK                on success
+ */
+esp_err_t esp_lcd_new_bounce_flush(const esp_lcd_bounce_flush_config_t *config, esp_lcd_bounce_flush_handle_t *ret_handle);
+
+/**
+ * @brief Flush a rectangular area of a framebuffer through the bounce buffers
+ *
+ * The call blocks until the whole area has been copied into bounce buffers (the
+ * framebuffer may be modified again once it returns), but not until it has been
+ * transmitted; completion is reported through `on_frame_done`.
+ *
+ * @param[in] handle LCD bounce flush engine handle
+ * @param[in] x_start Start index on x-axis (included)
+ * @param[in] y_start Start index on y-axis (included)
+ * @param[in] x_end End index on x-axis (excluded)
+ * @param[in] y_end End index on y-axis (excluded)
+ * @param[in] color_data RGB color data that will be dumped to the specific area, line by line
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_ERR_INVALID_STATE if the previous frame is not fully transferred yet
+ *          - ESP_OK                on success
+ */
+esp_err_t esp_lcd_bounce_flush_draw_bitmap(esp_lcd_bounce_flush_handle_t handle, int x_start, int y_start, int x_end, int y_end, const void *color_data);
+
+/**
+ * @brief Delete the bounce flush engine and free the bounce buffers
+ *
+ * @note Must not be called while a frame is still being transferred.
+ *
+ * @param[in] handle LCD bounce flush engine handle
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t esp_lcd_bounce_flush_del(esp_lcd_bounce_flush_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
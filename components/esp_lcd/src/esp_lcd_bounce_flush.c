@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_cache.h"
+#include "hal/cache_hal.h"
+#include "hal/cache_ll.h"
+#include "esp_lcd_bounce_flush.h"
+
+static const char *TAG = "lcd_bounce";
+
+#define BOUNCE_BUF_NUM 2
+
+struct esp_lcd_bounce_flush_t {
+    esp_lcd_panel_handle_t panel;   // panel receiving the pixel data
+    esp_lcd_panel_io_handle_t io;   // panel IO, delivers the transfer-done events
+    uint8_t *bounce[BOUNCE_BUF_NUM]; // internal DMA-capable chunk buffers
+    size_t bb_size;                 // size of each bounce buffer, in bytes
+    size_t bytes_per_pixel;
+    int next_buf;                   // bounce buffer the next chunk is copied into
+    SemaphoreHandle_t free_bufs;    // counting semaphore, one count per idle bounce buffer
+    portMUX_TYPE spinlock;
+    uint32_t chunks_pending;        // chunks queued to the panel IO but not transferred yet
+    bool last_chunk_queued;         // whole frame handed to the IO, next completion with no pending chunks ends the frame
+    bool int_mem_behind_cache;      // internal RAM accesses go through a data cache
+    esp_lcd_bounce_flush_frame_done_cb_t on_frame_done;
+    void *user_ctx;
+};
+
+static bool bounce_flush_on_color_trans_done(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    esp_lcd_bounce_flush_handle_t flush = (esp_lcd_bounce_flush_handle_t)user_ctx;
+    BaseType_t high_task_woken = pdFALSE;
+    bool frame_done = false;
+
+    portENTER_CRITICAL_ISR(&flush->spinlock);
+    flush->chunks_pending--;
+    if (flush->last_chunk_queued && flush->chunks_pending == 0) {
+        flush->last_chunk_queued = false;
+        frame_done = true;
+    }
+    portEXIT_CRITICAL_ISR(&flush->spinlock);
+
+    xSemaphoreGiveFromISR(flush->free_bufs, &high_task_woken);
+
+    bool user_woken = false;
+    if (frame_done && flush->on_frame_done) {
+        user_woken = flush->on_frame_done(flush, flush->user_ctx);
+    }
+    return (high_task_woken == pdTRUE) || user_woken;
+}
+
+esp_err_t esp_lcd_new_bounce_flush(const esp_lcd_bounce_flush_config_t *config, esp_lcd_bounce_flush_handle_t *ret_handle)
+{
+    esp_err_t ret = ESP_OK;
+    esp_lcd_bounce_flush_handle_t flush = NULL;
+    ESP_RETURN_ON_FALSE(config && ret_handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->panel && config->io, ESP_ERR_INVALID_ARG, TAG, "invalid panel or io handle");
+    ESP_RETURN_ON_FALSE(config->bounce_buffer_size && config->bytes_per_pixel, ESP_ERR_INVALID_ARG, TAG, "invalid buffer or pixel size");
+
+    flush = heap_caps_calloc(1, sizeof(struct esp_lcd_bounce_flush_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(flush, ESP_ERR_NO_MEM, TAG, "no mem for bounce flush engine");
+
+    uint32_t int_mem_cache_line_size = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_INT_MEM, CACHE_TYPE_DATA);
+    flush->int_mem_behind_cache = int_mem_cache_line_size > 0;
+    size_t alignment = MAX(int_mem_cache_line_size, 4);
+
+    for (int i = 0; i < BOUNCE_BUF_NUM; i++) {
+        flush->bounce[i] = heap_caps_aligned_calloc(alignment, 1, config->bounce_buffer_size,
+                                                    MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+        ESP_GOTO_ON_FALSE(flush->bounce[i], ESP_ERR_NO_MEM, err, TAG, "no mem for bounce buffer");
+    }
+    flush->free_bufs = xSemaphoreCreateCounting(BOUNCE_BUF_NUM, BOUNCE_BUF_NUM);
+    ESP_GOTO_ON_FALSE(flush->free_bufs, ESP_ERR_NO_MEM, err, TAG, "no mem for semaphore");
+
+    flush->panel = config->panel;
+    flush->io = config->io;
+    flush->bb_size = config->bounce_buffer_size;
+    flush->bytes_per_pixel = config->bytes_per_pixel;
+    flush->on_frame_done = config->on_frame_done;
+    flush->user_ctx = config->user_ctx;
+    portMUX_INITIALIZE(&flush->spinlock);
+
+    esp_lcd_panel_io_callbacks_t cbs = {
+        .on_color_trans_done = bounce_flush_on_color_trans_done,
+    };
+    ESP_GOTO_ON_ERROR(esp_lcd_panel_io_register_event_callbacks(flush->io, &cbs, flush), err, TAG, "register io callbacks failed");
+
+    *ret_handle = flush;
+    return ESP_OK;
+
+err:
+    if (flush) {
+        for (int i = 0; i < BOUNCE_BUF_NUM; i++) {
+            if (flush->bounce[i]) {
+                free(flush->bounce[i]);
+            }
+        }
+        if (flush->free_bufs) {
+            vSemaphoreDelete(flush->free_bufs);
+        }
+        free(flush);
+    }
+    return ret;
+}
+
+esp_err_t esp_lcd_bounce_flush_draw_bitmap(esp_lcd_bounce_flush_handle_t flush, int x_start, int y_start, int x_end, int y_end, const void *color_data)
+{
+    ESP_RETURN_ON_FALSE(flush && color_data, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE((x_start < x_end) && (y_start < y_end), ESP_ERR_INVALID_ARG, TAG, "start position must be smaller than end position");
+    ESP_RETURN_ON_FALSE(!flush->last_chunk_queued, ESP_ERR_INVALID_STATE, TAG, "previous frame not finished yet");
+
+    size_t bytes_per_line = (x_end - x_start) * flush->bytes_per_pixel;
+    ESP_RETURN_ON_FALSE(bytes_per_line <= flush->bb_size, ESP_ERR_INVALID_ARG, TAG, "bounce buffer can't hold one line");
+    int lines_per_chunk = flush->bb_size / bytes_per_line;
+
+    const uint8_t *src = color_data;
+    for (int y = y_start; y < y_end;) {
+        int lines = MIN(lines_per_chunk, y_end - y);
+        size_t chunk_size = lines * bytes_per_line;
+
+        // wait until one of the two bounce buffers has finished transmitting,
+        // the copy below then overlaps with the transfer of the other one
+        xSemaphoreTake(flush->free_bufs, portMAX_DELAY);
+        uint8_t *dst = flush->bounce[flush->next_buf];
+        flush->next_buf = (flush->next_buf + 1) % BOUNCE_BUF_NUM;
+
+        memcpy(dst, src, chunk_size);
+        if (flush->int_mem_behind_cache) {
+            // write back so the DMA of the panel IO sees the chunk
+            esp_cache_msync(dst, chunk_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+        }
+
+        bool is_last_chunk = (y + lines >= y_end);
+        portENTER_CRITICAL(&flush->spinlock);
+        flush->chunks_pending++;
+        // set before queuing, the completion interrupt may run right away
+        flush->last_chunk_queued = is_last_chunk;
+        portEXIT_CRITICAL(&flush->spinlock);
+
+        esp_err_t ret = esp_lcd_panel_draw_bitmap(flush->panel, x_start, y, x_end, y + lines, dst);
+        if (ret != ESP_OK) {
+            portENTER_CRITICAL(&flush->spinlock);
+            flush->chunks_pending--;
+            flush->last_chunk_queued = false;
+            portEXIT_CRITICAL(&flush->spinlock);
+            xSemaphoreGive(flush->free_bufs);
+            return ret;
+        }
+
+        src += chunk_size;
+        y += lines;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_bounce_flush_del(esp_lcd_bounce_flush_handle_t flush)
+{
+    ESP_RETURN_ON_FALSE(flush, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(flush->chunks_pending == 0, ESP_ERR_INVALID_STATE, TAG, "frame still in flight");
+
+    esp_lcd_panel_io_callbacks_t cbs = {
+        .on_color_trans_done = NULL,
+    };
+    esp_lcd_panel_io_register_event_callbacks(flush->io, &cbs, NULL);
+
+    for (int i = 0; i < BOUNCE_BUF_NUM; i++) {
+        free(flush->bounce[i]);
+    }
+    vSemaphoreDelete(flush->free_bufs);
+    free(flush);
+    return ESP_OK;
+}
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Small formatted-output engine for the logging and console hot path
+ *
+ * Supports the integer, character, string and pointer conversions (d, i, u, x,
+ * X, o, c, s, p, %%) with the usual flags, field width, precision and length
+ * modifiers, including 64-bit integers. A format string containing any other
+ * conversion -- notably floating point -- is delegated as a whole to the full
+ * libc vfprintf. The delegation uses a weak reference, so the large formatter
+ * is only part of the image when something else in the application references
+ * it; without it the format string is emitted verbatim.
+ *
+ * Available when CONFIG_LIBC_FAST_PRINTF is enabled; esp_log then uses
+ * esp_fast_vprintf() as its default output function.
+ *
+ * @param stream Output stream
+ * @param format printf-style format string
+ * @param ap Argument list
+ *
+ * @return Number of characters written, or -1 on output error
+ */
+int esp_fast_vfprintf(FILE *stream, const char *format, va_list ap);
+
+/**
+ * @brief esp_fast_vfprintf() writing to stdout
+ *
+ * Matches the vprintf_like_t signature used by esp_log_set_vprintf().
+ *
+ * @param format printf-style format string
+ * @param ap Argument list
+ *
+ * @return Number of characters written, or -1 on output error
+ */
+int esp_fast_vprintf(const char *format, va_list ap);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,37 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROT_NONE   0x0
+#define PROT_READ   0x1
+#define PROT_WRITE  0x2
+#define PROT_EXEC   0x4
+
+#define MAP_SHARED  0x01
+#define MAP_PRIVATE 0x02
+
+#define MAP_FAILED  ((void *) -1)
+
+/* Only file-backed read-only mappings are supported: the VFS forwards the
+ * call to the filesystem driver, which typically hands out a pointer into
+ * the flash cache mapping of the underlying partition. MAP_ANONYMOUS and
+ * writable mappings are not available.
+ */
+void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset);
+
+int munmap(void *addr, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
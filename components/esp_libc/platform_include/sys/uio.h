@@ -13,9 +13,19 @@
 extern "C" {
 #endif
 
-struct iovec;
+/* lwIP's sockets.h provides its own definition of struct iovec unless the
+ * "iovec" macro is defined; define it here so that both headers agree on a
+ * single definition.
+ */
+#if !defined(iovec)
+#define iovec iovec
+struct iovec {
+    void   *iov_base;
+    size_t  iov_len;
+};
+#endif
 
-int writev(int s, const struct iovec *iov, int iovcnt);
+ssize_t writev(int s, const struct iovec *iov, int iovcnt);
 
 ssize_t readv(int fd, const struct iovec *iov, int iovcnt);
 
@@ -0,0 +1,338 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdarg.h>
+#include "esp_fast_printf.h"
+#include "sdkconfig.h"
+
+/*
+ * Small table-driven formatter for the conversions which make up virtually all
+ * log and console traffic. Formats outside of that set are delegated as a whole
+ * to the real vfprintf; the reference is weak so this file never pulls the
+ * large newlib formatter into the image on its own.
+ */
+int vfprintf(FILE *stream, const char *format, va_list ap) __attribute__((weak));
+
+#define FAST_PRINTF_CHUNK 64 // stack buffer, flushed with fwrite() when full
+
+typedef struct {
+    FILE *stream;
+    int written;
+    bool error;
+    size_t fill;
+    char buf[FAST_PRINTF_CHUNK];
+} out_state_t;
+
+typedef struct {
+    bool left;      // '-' flag
+    bool zero;      // '0' flag
+    bool alt;       // '#' flag
+    char sign;      // '+', ' ' or 0
+    int width;
+    int precision;  // -1 when not given
+} fmt_spec_t;
+
+static const char s_digits_lower[] = "0123456789abcdef";
+static const char s_digits_upper[] = "0123456789ABCDEF";
+
+static void out_flush(out_state_t *out)
+{
+    if (out->fill > 0 && !out->error) {
+        if (fwrite(out->buf, 1, out->fill, out->stream) != out->fill) {
+            out->error = true;
+        } else {
+            out->written += out->fill;
+        }
+    }
+    out->fill = 0;
+}
+
+static void out_char(out_state_t *out, char c)
+{
+    if (out->fill == FAST_PRINTF_CHUNK) {
+        out_flush(out);
+    }
+    out->buf[out->fill++] = c;
+}
+
+static void out_repeat(out_state_t *out, char c, int n)
+{
+    while (n-- > 0) {
+        out_char(out, c);
+    }
+}
+
+static void out_mem(out_state_t *out, const char *s, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        out_char(out, s[i]);
+    }
+}
+
+static void emit_integer(out_state_t *out, uint64_t value, bool negative,
+                         unsigned base, const char *digits, const fmt_spec_t *spec)
+{
+    char tmp[22]; // enough for a 64-bit value in octal
+    const bool nonzero = value != 0;
+    int ndigits = 0;
+    if (nonzero || spec->precision != 0) { // zero with explicit zero precision prints nothing
+        do {
+            tmp[ndigits++] = digits[value % base];
+            value /= base;
+        } while (value != 0);
+    }
+
+    char prefix[3];
+    int prefix_len = 0;
+    if (negative) {
+        prefix[prefix_len++] = '-';
+    } else if (spec->sign != 0 && base == 10) {
+        prefix[prefix_len++] = spec->sign;
+    }
+    if (spec->alt && base == 16 && nonzero) {
+        prefix[prefix_len++] = '0';
+        prefix[prefix_len++] = (digits == s_digits_upper) ? 'X' : 'x';
+    }
+
+    int zeros = (spec->precision > ndigits) ? spec->precision - ndigits : 0;
+    if (spec->alt && base == 8 && zeros == 0 && (ndigits == 0 || tmp[ndigits - 1] != '0')) {
+        zeros = 1; // '#' with octal guarantees a leading zero
+    }
+
+    const int body = prefix_len + zeros + ndigits;
+    int pad = (spec->width > body) ? spec->width - body : 0;
+
+    if (!spec->left && pad > 0) {
+        if (spec->zero && spec->precision < 0) {
+            zeros += pad; // zero padding goes between the prefix and the digits
+        } else {
+            out_repeat(out, ' ', pad);
+        }
+        pad = 0;
+    }
+    out_mem(out, prefix, prefix_len);
+    out_repeat(out, '0', zeros);
+    while (ndigits > 0) {
+        out_char(out, tmp[--ndigits]);
+    }
+    if (spec->left) {
+        out_repeat(out, ' ', pad);
+    }
+}
+
+// Returns true when every conversion in the format is handled by the fast path,
+// so an unsupported format can be delegated before any output is produced.
+static bool format_is_supported(const char *format)
+{
+    for (const char *p = format; *p != '\0'; ++p) {
+        if (*p != '%') {
+            continue;
+        }
+        ++p;
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+            ++p;
+        }
+        while (*p == '*' || (*p >= '0' && *p <= '9')) {
+            ++p;
+        }
+        if (*p == '.') {
+            ++p;
+            while (*p == '*' || (*p >= '0' && *p <= '9')) {
+                ++p;
+            }
+        }
+        while (*p == 'h' || *p == 'l' || *p == 'z' || *p == 't' || *p == 'j') {
+            ++p;
+        }
+        switch (*p) {
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'o':
+        case 'c': case 's': case 'p': case '%':
+            break;
+        default: // unknown conversion, floating point, or a trailing lone '%'
+            return false;
+        }
+    }
+    return true;
+}
+
+int esp_fast_vfprintf(FILE *stream, const char *format, va_list ap)
+{
+    if (!format_is_supported(format)) {
+        if (&vfprintf != NULL) {
+            return vfprintf(stream, format, ap);
+        }
+        // The full formatter is not in the image: emit the raw format string
+        // so that the record is not lost entirely.
+        const size_t len = strlen(format);
+        return (fwrite(format, 1, len, stream) == len) ? (int)len : -1;
+    }
+
+    out_state_t out = {
+        .stream = stream,
+    };
+
+    for (const char *p = format; *p != '\0'; ++p) {
+        if (*p != '%') {
+            out_char(&out, *p);
+            continue;
+        }
+        ++p;
+
+        fmt_spec_t spec = {
+            .precision = -1,
+        };
+        for (;; ++p) {
+            if (*p == '-') {
+                spec.left = true;
+            } else if (*p == '0') {
+                spec.zero = true;
+            } else if (*p == '#') {
+                spec.alt = true;
+            } else if (*p == '+') {
+                spec.sign = '+';
+            } else if (*p == ' ') {
+                if (spec.sign == 0) {
+                    spec.sign = ' ';
+                }
+            } else {
+                break;
+            }
+        }
+        if (*p == '*') {
+            spec.width = va_arg(ap, int);
+            if (spec.width < 0) {
+                spec.left = true;
+                spec.width = -spec.width;
+            }
+            ++p;
+        } else {
+            while (*p >= '0' && *p <= '9') {
+                spec.width = spec.width * 10 + (*p++ - '0');
+            }
+        }
+        if (*p == '.') {
+            ++p;
+            if (*p == '*') {
+                spec.precision = va_arg(ap, int); // negative acts as if omitted
+                ++p;
+            } else {
+                spec.precision = 0;
+                while (*p >= '0' && *p <= '9') {
+                    spec.precision = spec.precision * 10 + (*p++ - '0');
+                }
+            }
+        }
+
+        // number of 'l's, negative for 'h's; 'z', 't' and 'j' map onto the same scale
+        int length = 0;
+        for (;; ++p) {
+            if (*p == 'l') {
+                ++length;
+            } else if (*p == 'h') {
+                --length;
+            } else if (*p == 'z' || *p == 't') {
+                length = (sizeof(size_t) > sizeof(long)) ? 2 : 1;
+            } else if (*p == 'j') {
+                length = 2;
+            } else {
+                break;
+            }
+        }
+
+        switch (*p) {
+        case 'd':
+        case 'i': {
+            int64_t value;
+            if (length >= 2) {
+                value = va_arg(ap, long long);
+            } else if (length == 1) {
+                value = va_arg(ap, long);
+            } else {
+                value = va_arg(ap, int);
+                if (length == -1) {
+                    value = (short)value;
+                } else if (length <= -2) {
+                    value = (signed char)value;
+                }
+            }
+            const bool negative = value < 0;
+            emit_integer(&out, negative ? -(uint64_t)value : (uint64_t)value,
+                         negative, 10, s_digits_lower, &spec);
+            break;
+        }
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o': {
+            uint64_t value;
+            if (length >= 2) {
+                value = va_arg(ap, unsigned long long);
+            } else if (length == 1) {
+                value = va_arg(ap, unsigned long);
+            } else {
+                value = va_arg(ap, unsigned int);
+                if (length == -1) {
+                    value = (unsigned short)value;
+                } else if (length <= -2) {
+                    value = (unsigned char)value;
+                }
+            }
+            const unsigned base = (*p == 'u') ? 10 : (*p == 'o') ? 8 : 16;
+            emit_integer(&out, value, false, base,
+                         (*p == 'X') ? s_digits_upper : s_digits_lower, &spec);
+            break;
+        }
+        case 'p': {
+            fmt_spec_t pointer_spec = spec;
+            pointer_spec.alt = true;
+            emit_integer(&out, (uintptr_t)va_arg(ap, void *), false, 16,
+                         s_digits_lower, &pointer_spec);
+            break;
+        }
+        case 'c': {
+            const char c = (char)va_arg(ap, int);
+            if (!spec.left) {
+                out_repeat(&out, ' ', spec.width - 1);
+            }
+            out_char(&out, c);
+            if (spec.left) {
+                out_repeat(&out, ' ', spec.width - 1);
+            }
+            break;
+        }
+        case 's': {
+            const char *s = va_arg(ap, const char *);
+            if (s == NULL) {
+                s = "(null)";
+            }
+            size_t len = (spec.precision >= 0) ? strnlen(s, spec.precision) : strlen(s);
+            if (!spec.left) {
+                out_repeat(&out, ' ', spec.width - (int)len);
+            }
+            out_mem(&out, s, len);
+            if (spec.left) {
+                out_repeat(&out, ' ', spec.width - (int)len);
+            }
+            break;
+        }
+        case '%':
+        default:
+            out_char(&out, '%');
+            break;
+        }
+    }
+
+    out_flush(&out);
+    return out.error ? -1 : out.written;
+}
+
+int esp_fast_vprintf(const char *format, va_list ap)
+{
+    return esp_fast_vfprintf(stdout, format, ap);
+}
@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: 1994-2009 Red Hat, Inc.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause-FreeBSD AND Apache-2.0
+ *
+ * SPDX-FileContributor: 2025 Espressif Systems (Shanghai) CO LTD
+ */
+
+/*
+ * Speed-optimized memcpy/memset/memcmp selected via
+ * CONFIG_LIBC_OPTIMIZED_MEM_FUNCS_IN_IRAM. The default implementations
+ * linked from ROM are compiled for size; these word-wise unrolled variants
+ * are linked in via --wrap so that each function can be replaced
+ * individually while the others keep their ROM fallback. Placement in IRAM
+ * is handled by esp_libc.lf.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "string/local.h"
+
+#if CONFIG_LIBC_OPTIMIZED_MEMCPY
+
+void *
+__inhibit_loop_to_libcall
+__wrap_memcpy(void *__restrict dst0, const void *__restrict src0, size_t len0)
+{
+    char *dst = dst0;
+    const char *src = src0;
+    long *aligned_dst;
+    const long *aligned_src;
+
+    /* If the size is small, or either SRC or DST is unaligned,
+       then punt into the byte copy loop.  This should be rare.  */
+    if (!TOO_SMALL_BIG_BLOCK(len0) && !UNALIGNED_X_Y(src, dst)) {
+        aligned_dst = (long *)dst;
+        aligned_src = (long *)src;
+
+        /* Copy 4X long words at a time if possible.  */
+        while (!TOO_SMALL_BIG_BLOCK(len0)) {
+            *aligned_dst++ = *aligned_src++;
+            *aligned_dst++ = *aligned_src++;
+            *aligned_dst++ = *aligned_src++;
+            *aligned_dst++ = *aligned_src++;
+            len0 -= BIG_BLOCK_SIZE;
+        }
+
+        /* Copy one long word at a time if possible.  */
+        while (!TOO_SMALL_LITTLE_BLOCK(len0)) {
+            *aligned_dst++ = *aligned_src++;
+            len0 -= LITTLE_BLOCK_SIZE;
+        }
+
+        /* Pick up any residual with a byte copier.  */
+        dst = (char *)aligned_dst;
+        src = (char *)aligned_src;
+    }
+
+    while (len0--) {
+        *dst++ = *src++;
+    }
+
+    return dst0;
+}
+
+#endif /* CONFIG_LIBC_OPTIMIZED_MEMCPY */
+
+#if CONFIG_LIBC_OPTIMIZED_MEMSET
+
+void *
+__inhibit_loop_to_libcall
+__wrap_memset(void *m, int c, size_t n)
+{
+    char *s = (char *)m;
+    unsigned long buffer;
+    unsigned long *aligned_addr;
+    unsigned int d = c & 0xff;  /* To avoid sign extension, copy C to an
+                                   unsigned variable.  */
+
+    while (UNALIGNED_X(s)) {
+        if (n--) {
+            *s++ = (char)c;
+        } else {
+            return m;
+        }
+    }
+
+    if (!TOO_SMALL_LITTLE_BLOCK(n)) {
+        /* If we get this far, we know that n is large and s is word-aligned. */
+        aligned_addr = (unsigned long *)s;
+
+        /* Store d into each char sized location in buffer so that
+           we can set large blocks quickly.  */
+        buffer = (d << 8) | d;
+        buffer |= (buffer << 16);
+        for (unsigned int i = 32; i < LITTLE_BLOCK_SIZE * 8; i <<= 1) {
+            buffer = (buffer << i) | buffer;
+        }
+
+        /* Unroll the loop.  */
+        while (n >= LITTLE_BLOCK_SIZE * 4) {
+            *aligned_addr++ = buffer;
+            *aligned_addr++ = buffer;
+            *aligned_addr++ = buffer;
+            *aligned_addr++ = buffer;
+            n -= 4 * LITTLE_BLOCK_SIZE;
+        }
+
+        while (n >= LITTLE_BLOCK_SIZE) {
+            *aligned_addr++ = buffer;
+            n -= LITTLE_BLOCK_SIZE;
+        }
+        /* Pick up the remainder with a bytewise loop.  */
+        s = (char *)aligned_addr;
+    }
+
+    while (n--) {
+        *s++ = (char)c;
+    }
+
+    return m;
+}
+
+#endif /* CONFIG_LIBC_OPTIMIZED_MEMSET */
+
+#if CONFIG_LIBC_OPTIMIZED_MEMCMP
+
+int
+__wrap_memcmp(const void *m1, const void *m2, size_t n)
+{
+    unsigned char *s1 = (unsigned char *)m1;
+    unsigned char *s2 = (unsigned char *)m2;
+    unsigned long *a1;
+    unsigned long *a2;
+
+    /* If the size is too small, or either pointer is unaligned,
+       then we punt to the byte compare loop.  Hopefully this will
+       not turn up in inner loops.  */
+    if (!TOO_SMALL_LITTLE_BLOCK(n) && !UNALIGNED_X_Y(s1, s2)) {
+        /* Otherwise, load and compare the blocks of memory one
+           word at a time.  */
+        a1 = (unsigned long *)s1;
+        a2 = (unsigned long *)s2;
+        while (!TOO_SMALL_LITTLE_BLOCK(n)) {
+            if (*a1 != *a2) {
+                break;
+            }
+            a1++;
+            a2++;
+            n -= LITTLE_BLOCK_SIZE;
+        }
+
+        /* check remaining characters */
+        s1 = (unsigned char *)a1;
+        s2 = (unsigned char *)a2;
+    }
+
+    while (n--) {
+        if (*s1 != *s2) {
+            return *s1 - *s2;
+        }
+        s1++;
+        s2++;
+    }
+
+    return 0;
+}
+
+#endif /* CONFIG_LIBC_OPTIMIZED_MEMCMP */
@@ -359,6 +359,23 @@ esp_err_t esp_local_ctrl_remove_property(const char *name);
  */
 const esp_local_ctrl_prop_t *esp_local_ctrl_get_property(const char *name);
 
+/**
+ * @brief   Mark a property as changed
+ *
+ * Properties updated through the `set_prop_values` handler are tracked
+ * automatically, but if the application changes a property value on its
+ * own (e.g. a sensor reading), it must call this API so that clients
+ * performing incremental synchronization receive the new value on their
+ * next fetch.
+ *
+ * @param[in] name    Name of the property that changed
+ *
+ * @return
+ *  - ESP_OK      : Success
+ *  - ESP_ERR_NOT_FOUND : Failure
+ */
+esp_err_t esp_local_ctrl_property_set_dirty(const char *name);
+
 /**
  * @brief   Register protocomm handler for a custom endpoint
  *
@@ -367,6 +367,96 @@ void   resp_set_property_values__free_unpacked
   assert(message->base.descriptor == &resp_set_property_values__descriptor);
   protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
 }
+void   cmd_get_all_property_values__init
+                     (CmdGetAllPropertyValues         *message)
+{
+  static const CmdGetAllPropertyValues init_value = CMD_GET_ALL_PROPERTY_VALUES__INIT;
+  *message = init_value;
+}
+size_t cmd_get_all_property_values__get_packed_size
+                     (const CmdGetAllPropertyValues *message)
+{
+  assert(message->base.descriptor == &cmd_get_all_property_values__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t cmd_get_all_property_values__pack
+                     (const CmdGetAllPropertyValues *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &cmd_get_all_property_values__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t cmd_get_all_property_values__pack_to_buffer
+                     (const CmdGetAllPropertyValues *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &cmd_get_all_property_values__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+CmdGetAllPropertyValues *
+       cmd_get_all_property_values__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (CmdGetAllPropertyValues *)
+     protobuf_c_message_unpack (&cmd_get_all_property_values__descriptor,
+                                allocator, len, data);
+}
+void   cmd_get_all_property_values__free_unpacked
+                     (CmdGetAllPropertyValues *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &cmd_get_all_property_values__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
+void   resp_get_all_property_values__init
+                     (RespGetAllPropertyValues         *message)
+{
+  static const RespGetAllPropertyValues init_value = RESP_GET_ALL_PROPERTY_VALUES__INIT;
+  *message = init_value;
+}
+size_t resp_get_all_property_values__get_packed_size
+                     (const RespGetAllPropertyValues *message)
+{
+  assert(message->base.descriptor == &resp_get_all_property_values__descriptor);
+  return protobuf_c_message_get_packed_size ((const ProtobufCMessage*)(message));
+}
+size_t resp_get_all_property_values__pack
+                     (const RespGetAllPropertyValues *message,
+                      uint8_t       *out)
+{
+  assert(message->base.descriptor == &resp_get_all_property_values__descriptor);
+  return protobuf_c_message_pack ((const ProtobufCMessage*)message, out);
+}
+size_t resp_get_all_property_values__pack_to_buffer
+                     (const RespGetAllPropertyValues *message,
+                      ProtobufCBuffer *buffer)
+{
+  assert(message->base.descriptor == &resp_get_all_property_values__descriptor);
+  return protobuf_c_message_pack_to_buffer ((const ProtobufCMessage*)message, buffer);
+}
+RespGetAllPropertyValues *
+       resp_get_all_property_values__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data)
+{
+  return (RespGetAllPropertyValues *)
+     protobuf_c_message_unpack (&resp_get_all_property_values__descriptor,
+                                allocator, len, data);
+}
+void   resp_get_all_property_values__free_unpacked
+                     (RespGetAllPropertyValues *message,
+                      ProtobufCAllocator *allocator)
+{
+  if(!message)
+    return;
+  assert(message->base.descriptor == &resp_get_all_property_values__descriptor);
+  protobuf_c_message_free_unpacked ((ProtobufCMessage*)message, allocator);
+}
 void   local_ctrl_message__init
                      (LocalCtrlMessage         *message)
 {
@@ -787,7 +877,122 @@ const ProtobufCMessageDescriptor resp_set_property_values__descriptor =
   (ProtobufCMessageInit) resp_set_property_values__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor local_ctrl_message__field_descriptors[7] =
+static const ProtobufCFieldDescriptor cmd_get_all_property_values__field_descriptors[1] =
+{
+  {
+    "checkpoint",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT64,
+    0,   /* quantifier_offset */
+    offsetof(CmdGetAllPropertyValues, checkpoint),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned cmd_get_all_property_values__field_indices_by_name[] = {
+  0,   /* field[0] = checkpoint */
+};
+static const ProtobufCIntRange cmd_get_all_property_values__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 1 }
+};
+const ProtobufCMessageDescriptor cmd_get_all_property_values__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "CmdGetAllPropertyValues",
+  "CmdGetAllPropertyValues",
+  "CmdGetAllPropertyValues",
+  "",
+  sizeof(CmdGetAllPropertyValues),
+  1,
+  cmd_get_all_property_values__field_descriptors,
+  cmd_get_all_property_values__field_indices_by_name,
+  1,  cmd_get_all_property_values__number_ranges,
+  (ProtobufCMessageInit) cmd_get_all_property_values__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor resp_get_all_property_values__field_descriptors[4] =
+{
+  {
+    "status",
+    1,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_ENUM,
+    0,   /* quantifier_offset */
+    offsetof(RespGetAllPropertyValues, status),
+    &status__descriptor,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "props",
+    2,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_MESSAGE,
+    offsetof(RespGetAllPropertyValues, n_props),
+    offsetof(RespGetAllPropertyValues, props),
+    &property_info__descriptor,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "indices",
+    3,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(RespGetAllPropertyValues, n_indices),
+    offsetof(RespGetAllPropertyValues, indices),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_PACKED,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "checkpoint",
+    4,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_UINT64,
+    0,   /* quantifier_offset */
+    offsetof(RespGetAllPropertyValues, checkpoint),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned resp_get_all_property_values__field_indices_by_name[] = {
+  3,   /* field[3] = checkpoint */
+  2,   /* field[2] = indices */
+  1,   /* field[1] = props */
+  0,   /* field[0] = status */
+};
+static const ProtobufCIntRange resp_get_all_property_values__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 4 }
+};
+const ProtobufCMessageDescriptor resp_get_all_property_values__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "RespGetAllPropertyValues",
+  "RespGetAllPropertyValues",
+  "RespGetAllPropertyValues",
+  "",
+  sizeof(RespGetAllPropertyValues),
+  4,
+  resp_get_all_property_values__field_descriptors,
+  resp_get_all_property_values__field_indices_by_name,
+  1,  resp_get_all_property_values__number_ranges,
+  (ProtobufCMessageInit) resp_get_all_property_values__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor local_ctrl_message__field_descriptors[9] =
 {
   {
     "msg",
@@ -873,12 +1078,38 @@ static const ProtobufCFieldDescriptor local_ctrl_message__field_descriptors[7] =
     0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+  {
+    "cmd_get_all_prop_vals",
+    16,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_MESSAGE,
+    offsetof(LocalCtrlMessage, payload_case),
+    offsetof(LocalCtrlMessage, cmd_get_all_prop_vals),
+    &cmd_get_all_property_values__descriptor,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "resp_get_all_prop_vals",
+    17,
+    PROTOBUF_C_LABEL_NONE,
+    PROTOBUF_C_TYPE_MESSAGE,
+    offsetof(LocalCtrlMessage, payload_case),
+    offsetof(LocalCtrlMessage, resp_get_all_prop_vals),
+    &resp_get_all_property_values__descriptor,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_ONEOF,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
 };
 static const unsigned local_ctrl_message__field_indices_by_name[] = {
+  7,   /* field[7] = cmd_get_all_prop_vals */
   1,   /* field[1] = cmd_get_prop_count */
   3,   /* field[3] = cmd_get_prop_vals */
   5,   /* field[5] = cmd_set_prop_vals */
   0,   /* field[0] = msg */
+  8,   /* field[8] = resp_get_all_prop_vals */
   2,   /* field[2] = resp_get_prop_count */
   4,   /* field[4] = resp_get_prop_vals */
   6,   /* field[6] = resp_set_prop_vals */
@@ -887,7 +1118,7 @@ static const ProtobufCIntRange local_ctrl_message__number_ranges[2 + 1] =
 {
   { 1, 0 },
   { 10, 1 },
-  { 0, 7 }
+  { 0, 9 }
 };
 const ProtobufCMessageDescriptor local_ctrl_message__descriptor =
 {
@@ -897,14 +1128,14 @@ const ProtobufCMessageDescriptor local_ctrl_message__descriptor =
   "LocalCtrlMessage",
   "",
   sizeof(LocalCtrlMessage),
-  7,
+  9,
   local_ctrl_message__field_descriptors,
   local_ctrl_message__field_indices_by_name,
   2,  local_ctrl_message__number_ranges,
   (ProtobufCMessageInit) local_ctrl_message__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCEnumValue local_ctrl_msg_type__enum_values_by_number[6] =
+static const ProtobufCEnumValue local_ctrl_msg_type__enum_values_by_number[8] =
 {
   { "TypeCmdGetPropertyCount", "LOCAL_CTRL_MSG_TYPE__TypeCmdGetPropertyCount", 0 },
   { "TypeRespGetPropertyCount", "LOCAL_CTRL_MSG_TYPE__TypeRespGetPropertyCount", 1 },
@@ -912,15 +1143,19 @@ static const ProtobufCEnumValue local_ctrl_msg_type__enum_values_by_number[6] =
   { "TypeRespGetPropertyValues", "LOCAL_CTRL_MSG_TYPE__TypeRespGetPropertyValues", 5 },
   { "TypeCmdSetPropertyValues", "LOCAL_CTRL_MSG_TYPE__TypeCmdSetPropertyValues", 6 },
   { "TypeRespSetPropertyValues", "LOCAL_CTRL_MSG_TYPE__TypeRespSetPropertyValues", 7 },
+  { "TypeCmdGetAllPropertyValues", "LOCAL_CTRL_MSG_TYPE__TypeCmdGetAllPropertyValues", 8 },
+  { "TypeRespGetAllPropertyValues", "LOCAL_CTRL_MSG_TYPE__TypeRespGetAllPropertyValues", 9 },
 };
 static const ProtobufCIntRange local_ctrl_msg_type__value_ranges[] = {
-{0, 0},{4, 2},{0, 6}
+{0, 0},{4, 2},{0, 8}
 };
-static const ProtobufCEnumValueIndex local_ctrl_msg_type__enum_values_by_name[6] =
+static const ProtobufCEnumValueIndex local_ctrl_msg_type__enum_values_by_name[8] =
 {
+  { "TypeCmdGetAllPropertyValues", 6 },
   { "TypeCmdGetPropertyCount", 0 },
   { "TypeCmdGetPropertyValues", 2 },
   { "TypeCmdSetPropertyValues", 4 },
+  { "TypeRespGetAllPropertyValues", 7 },
   { "TypeRespGetPropertyCount", 1 },
   { "TypeRespGetPropertyValues", 3 },
   { "TypeRespSetPropertyValues", 5 },
@@ -932,9 +1167,9 @@ const ProtobufCEnumDescriptor local_ctrl_msg_type__descriptor =
   "LocalCtrlMsgType",
   "LocalCtrlMsgType",
   "",
-  6,
+  8,
   local_ctrl_msg_type__enum_values_by_number,
-  6,
+  8,
   local_ctrl_msg_type__enum_values_by_name,
   2,
   local_ctrl_msg_type__value_ranges,
@@ -24,6 +24,8 @@ typedef struct RespGetPropertyValues RespGetPropertyValues;
 typedef struct PropertyValue PropertyValue;
 typedef struct CmdSetPropertyValues CmdSetPropertyValues;
 typedef struct RespSetPropertyValues RespSetPropertyValues;
+typedef struct CmdGetAllPropertyValues CmdGetAllPropertyValues;
+typedef struct RespGetAllPropertyValues RespGetAllPropertyValues;
 typedef struct LocalCtrlMessage LocalCtrlMessage;
 
 
@@ -35,7 +37,9 @@ typedef enum _LocalCtrlMsgType {
   LOCAL_CTRL_MSG_TYPE__TypeCmdGetPropertyValues = 4,
   LOCAL_CTRL_MSG_TYPE__TypeRespGetPropertyValues = 5,
   LOCAL_CTRL_MSG_TYPE__TypeCmdSetPropertyValues = 6,
-  LOCAL_CTRL_MSG_TYPE__TypeRespSetPropertyValues = 7
+  LOCAL_CTRL_MSG_TYPE__TypeRespSetPropertyValues = 7,
+  LOCAL_CTRL_MSG_TYPE__TypeCmdGetAllPropertyValues = 8,
+  LOCAL_CTRL_MSG_TYPE__TypeRespGetAllPropertyValues = 9
     PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(LOCAL_CTRL_MSG_TYPE)
 } LocalCtrlMsgType;
 
@@ -130,6 +134,31 @@ struct  RespSetPropertyValues
     , STATUS__Success }
 
 
+struct  CmdGetAllPropertyValues
+{
+  ProtobufCMessage base;
+  uint64_t checkpoint;
+};
+#define CMD_GET_ALL_PROPERTY_VALUES__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&cmd_get_all_property_values__descriptor) \
+    , 0 }
+
+
+struct  RespGetAllPropertyValues
+{
+  ProtobufCMessage base;
+  Status status;
+  size_t n_props;
+  PropertyInfo **props;
+  size_t n_indices;
+  uint32_t *indices;
+  uint64_t checkpoint;
+};
+#define RESP_GET_ALL_PROPERTY_VALUES__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&resp_get_all_property_values__descriptor) \
+    , STATUS__Success, 0,NULL, 0,NULL, 0 }
+
+
 typedef enum {
   LOCAL_CTRL_MESSAGE__PAYLOAD__NOT_SET = 0,
   LOCAL_CTRL_MESSAGE__PAYLOAD_CMD_GET_PROP_COUNT = 10,
@@ -137,7 +166,9 @@ typedef enum {
   LOCAL_CTRL_MESSAGE__PAYLOAD_CMD_GET_PROP_VALS = 12,
   LOCAL_CTRL_MESSAGE__PAYLOAD_RESP_GET_PROP_VALS = 13,
   LOCAL_CTRL_MESSAGE__PAYLOAD_CMD_SET_PROP_VALS = 14,
-  LOCAL_CTRL_MESSAGE__PAYLOAD_RESP_SET_PROP_VALS = 15
+  LOCAL_CTRL_MESSAGE__PAYLOAD_RESP_SET_PROP_VALS = 15,
+  LOCAL_CTRL_MESSAGE__PAYLOAD_CMD_GET_ALL_PROP_VALS = 16,
+  LOCAL_CTRL_MESSAGE__PAYLOAD_RESP_GET_ALL_PROP_VALS = 17
     PROTOBUF_C__FORCE_ENUM_TO_BE_INT_SIZE(LOCAL_CTRL_MESSAGE__PAYLOAD__CASE)
 } LocalCtrlMessage__PayloadCase;
 
@@ -153,6 +184,8 @@ struct  LocalCtrlMessage
     RespGetPropertyValues *resp_get_prop_vals;
     CmdSetPropertyValues *cmd_set_prop_vals;
     RespSetPropertyValues *resp_set_prop_vals;
+    CmdGetAllPropertyValues *cmd_get_all_prop_vals;
+    RespGetAllPropertyValues *resp_get_all_prop_vals;
   };
 };
 #define LOCAL_CTRL_MESSAGE__INIT \
@@ -312,6 +345,44 @@ RespSetPropertyValues *
 void   resp_set_property_values__free_unpacked
                      (RespSetPropertyValues *message,
                       ProtobufCAllocator *allocator);
+/* CmdGetAllPropertyValues methods */
+void   cmd_get_all_property_values__init
+                     (CmdGetAllPropertyValues         *message);
+size_t cmd_get_all_property_values__get_packed_size
+                     (const CmdGetAllPropertyValues   *message);
+size_t cmd_get_all_property_values__pack
+                     (const CmdGetAllPropertyValues   *message,
+                      uint8_t             *out);
+size_t cmd_get_all_property_values__pack_to_buffer
+                     (const CmdGetAllPropertyValues   *message,
+                      ProtobufCBuffer     *buffer);
+CmdGetAllPropertyValues *
+       cmd_get_all_property_values__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   cmd_get_all_property_values__free_unpacked
+                     (CmdGetAllPropertyValues *message,
+                      ProtobufCAllocator *allocator);
+/* RespGetAllPropertyValues methods */
+void   resp_get_all_property_values__init
+                     (RespGetAllPropertyValues         *message);
+size_t resp_get_all_property_values__get_packed_size
+                     (const RespGetAllPropertyValues   *message);
+size_t resp_get_all_property_values__pack
+                     (const RespGetAllPropertyValues   *message,
+                      uint8_t             *out);
+size_t resp_get_all_property_values__pack_to_buffer
+                     (const RespGetAllPropertyValues   *message,
+                      ProtobufCBuffer     *buffer);
+RespGetAllPropertyValues *
+       resp_get_all_property_values__unpack
+                     (ProtobufCAllocator  *allocator,
+                      size_t               len,
+                      const uint8_t       *data);
+void   resp_get_all_property_values__free_unpacked
+                     (RespGetAllPropertyValues *message,
+                      ProtobufCAllocator *allocator);
 /* LocalCtrlMessage methods */
 void   local_ctrl_message__init
                      (LocalCtrlMessage         *message);
@@ -357,6 +428,12 @@ typedef void (*CmdSetPropertyValues_Closure)
 typedef void (*RespSetPropertyValues_Closure)
                  (const RespSetPropertyValues *message,
                   void *closure_data);
+typedef void (*CmdGetAllPropertyValues_Closure)
+                 (const CmdGetAllPropertyValues *message,
+                  void *closure_data);
+typedef void (*RespGetAllPropertyValues_Closure)
+                 (const RespGetAllPropertyValues *message,
+                  void *closure_data);
 typedef void (*LocalCtrlMessage_Closure)
                  (const LocalCtrlMessage *message,
                   void *closure_data);
@@ -375,6 +452,8 @@ extern const ProtobufCMessageDescriptor resp_get_property_values__descriptor;
 extern const ProtobufCMessageDescriptor property_value__descriptor;
 extern const ProtobufCMessageDescriptor cmd_set_property_values__descriptor;
 extern const ProtobufCMessageDescriptor resp_set_property_values__descriptor;
+extern const ProtobufCMessageDescriptor cmd_get_all_property_values__descriptor;
+extern const ProtobufCMessageDescriptor resp_get_all_property_values__descriptor;
 extern const ProtobufCMessageDescriptor local_ctrl_message__descriptor;
 
 PROTOBUF_C__END_DECLS
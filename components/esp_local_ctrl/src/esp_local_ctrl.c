@@ -28,6 +28,8 @@ struct inst_ctx {
     esp_local_ctrl_config_t config;
     esp_local_ctrl_prop_t **props;
     size_t props_count;
+    uint64_t *prop_versions;
+    uint64_t checkpoint;
 };
 
 struct inst_ctx *local_ctrl_inst_ctx;
@@ -80,6 +82,16 @@ esp_err_t esp_local_ctrl_start(const esp_local_ctrl_config_t *config)
         return ESP_ERR_NO_MEM;
     }
 
+    local_ctrl_inst_ctx->prop_versions = calloc(local_ctrl_inst_ctx->config.max_properties,
+                                                sizeof(uint64_t));
+    if (!local_ctrl_inst_ctx->prop_versions) {
+        ESP_LOGE(TAG, "Failed to allocate memory for property versions");
+        free(local_ctrl_inst_ctx->props);
+        free(local_ctrl_inst_ctx);
+        local_ctrl_inst_ctx = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
     /* Since the config structure will be different for different transport modes, each transport may
      * implement a `copy_config()` function, which accepts a configuration structure as input and
      * creates a copy of that, which can be kept in the context structure of the `esp_local_ctrl` instance.
@@ -240,6 +252,7 @@ esp_err_t esp_local_ctrl_stop(void)
             free(local_ctrl_inst_ctx->props[i]);
         }
         free(local_ctrl_inst_ctx->props);
+        free(local_ctrl_inst_ctx->prop_versions);
         free(local_ctrl_inst_ctx);
         local_ctrl_inst_ctx = NULL;
     }
@@ -300,6 +313,9 @@ esp_err_t esp_local_ctrl_add_property(const esp_local_ctrl_prop_t *prop)
     local_ctrl_inst_ctx->props[i]->flags = prop->flags;
     local_ctrl_inst_ctx->props[i]->ctx   = prop->ctx;
     local_ctrl_inst_ctx->props[i]->ctx_free_fn = prop->ctx_free_fn;
+    /* Newly added properties are considered changed, so that clients
+     * doing an incremental sync pick them up on their next fetch */
+    local_ctrl_inst_ctx->prop_versions[i] = ++local_ctrl_inst_ctx->checkpoint;
     local_ctrl_inst_ctx->props_count++;
     return ESP_OK;
 }
@@ -329,6 +345,9 @@ esp_err_t esp_local_ctrl_remove_property(const char *name)
             break;
         }
         local_ctrl_inst_ctx->props[i-1] = local_ctrl_inst_ctx->props[i];
+        /* Shifted properties get new versions since their indices,
+         * as seen by clients, have changed */
+        local_ctrl_inst_ctx->prop_versions[i-1] = ++local_ctrl_inst_ctx->checkpoint;
     }
     local_ctrl_inst_ctx->props_count--;
     return ESP_OK;
@@ -438,10 +457,55 @@ esp_err_t esp_local_ctrl_set_prop_values(size_t total_indices, uint32_t *indices
     esp_local_ctrl_handlers_t *h = &local_ctrl_inst_ctx->config.handlers;
     esp_err_t ret = h->set_prop_values(total_indices, props, values, h->usr_ctx);
 
+    if (ret == ESP_OK) {
+        /* Mark the updated properties as changed, so that incremental
+         * syncs from other clients pick up the new values */
+        for (size_t i = 0; i < total_indices; i++) {
+            local_ctrl_inst_ctx->prop_versions[indices[i]] = ++local_ctrl_inst_ctx->checkpoint;
+        }
+    }
+
     free(props);
     return ret;
 }
 
+esp_err_t esp_local_ctrl_property_set_dirty(const char *name)
+{
+    int idx = esp_local_ctrl_get_property_index(name);
+    if (idx < 0) {
+        ESP_LOGE(TAG, "Property %s not found", name);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    local_ctrl_inst_ctx->prop_versions[idx] = ++local_ctrl_inst_ctx->checkpoint;
+    return ESP_OK;
+}
+
+esp_err_t esp_local_ctrl_get_changed_prop_indices(uint64_t since, uint32_t *indices,
+                                                  size_t *count, uint64_t *checkpoint)
+{
+    if (!local_ctrl_inst_ctx) {
+        ESP_LOGE(TAG, "Service not running");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!count || !checkpoint) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t changed = 0;
+    for (uint32_t i = 0; i < local_ctrl_inst_ctx->props_count; i++) {
+        if (local_ctrl_inst_ctx->prop_versions[i] > since) {
+            if (indices) {
+                indices[changed] = i;
+            }
+            changed++;
+        }
+    }
+    *count = changed;
+    *checkpoint = local_ctrl_inst_ctx->checkpoint;
+    return ESP_OK;
+}
+
 esp_err_t esp_local_ctrl_set_handler(const char *ep_name,
                                      protocomm_req_handler_t handler,
                                      void *priv_data)
@@ -13,6 +13,7 @@
 #include "esp_local_ctrl.h"
 #include "esp_local_ctrl_priv.h"
 #include "esp_local_ctrl.pb-c.h"
+#include "esp_protobuf_arena.h"
 
 #define SAFE_ALLOCATION(type, var)                  \
     type *var = (type *) malloc(sizeof(type));      \
@@ -38,6 +39,9 @@ static esp_err_t cmd_get_prop_vals_handler(LocalCtrlMessage *req,
 static esp_err_t cmd_set_prop_vals_handler(LocalCtrlMessage *req,
                                            LocalCtrlMessage *resp, void **ctx);
 
+static esp_err_t cmd_get_all_prop_vals_handler(LocalCtrlMessage *req,
+                                               LocalCtrlMessage *resp, void **ctx);
+
 static esp_local_ctrl_cmd_t cmd_table[] = {
     {
         .cmd_num = LOCAL_CTRL_MSG_TYPE__TypeCmdGetPropertyCount,
@@ -50,6 +54,10 @@ static esp_local_ctrl_cmd_t cmd_table[] = {
     {
         .cmd_num = LOCAL_CTRL_MSG_TYPE__TypeCmdSetPropertyValues,
         .command_handler = cmd_set_prop_vals_handler
+    },
+    {
+        .cmd_num = LOCAL_CTRL_MSG_TYPE__TypeCmdGetAllPropertyValues,
+        .command_handler = cmd_get_all_prop_vals_handler
     }
 };
 
@@ -183,6 +191,92 @@ static esp_err_t cmd_set_prop_vals_handler(LocalCtrlMessage *req,
     return ESP_OK;
 }
 
+static esp_err_t cmd_get_all_prop_vals_handler(LocalCtrlMessage *req,
+                                               LocalCtrlMessage *resp, void **ctx)
+{
+    SAFE_ALLOCATION(RespGetAllPropertyValues, resp_payload);
+    resp_get_all_property_values__init(resp_payload);
+
+    size_t prop_count = 0;
+    esp_err_t ret = esp_local_ctrl_get_prop_count(&prop_count);
+    if (ret != ESP_OK) {
+        resp_payload->status = err_to_status(ret);
+        resp->payload_case = LOCAL_CTRL_MESSAGE__PAYLOAD_RESP_GET_ALL_PROP_VALS;
+        resp->resp_get_all_prop_vals = resp_payload;
+        return ESP_OK;
+    }
+
+    uint32_t *indices = calloc(prop_count ? prop_count : 1, sizeof(uint32_t));
+    if (!indices) {
+        ESP_LOGE(TAG, "Failed to allocate memory for property indices");
+        free(resp_payload);
+        return ESP_ERR_NO_MEM;
+    }
+
+    size_t n_changed = 0;
+    uint64_t checkpoint = 0;
+    ret = esp_local_ctrl_get_changed_prop_indices(req->cmd_get_all_prop_vals->checkpoint,
+                                                  indices, &n_changed, &checkpoint);
+    resp_payload->status = err_to_status(ret);
+    resp_payload->checkpoint = checkpoint;
+
+    if (ret == ESP_OK && n_changed > 0) {
+        esp_local_ctrl_prop_val_t *vals = calloc(n_changed,
+                                                 sizeof(esp_local_ctrl_prop_val_t));
+        esp_local_ctrl_prop_t *descs = calloc(n_changed,
+                                              sizeof(esp_local_ctrl_prop_t));
+        prop_val_free_fn_t *free_fns = calloc(n_changed,
+                                              sizeof(prop_val_free_fn_t));
+        resp_payload->props = calloc(n_changed, sizeof(PropertyInfo *));
+        if (!vals || !descs || !free_fns || !resp_payload->props) {
+            ESP_LOGE(TAG, "Failed to allocate memory for getting values");
+            free(vals);
+            free(descs);
+            free(free_fns);
+            free(resp_payload->props);
+            free(resp_payload);
+            free(indices);
+            return ESP_ERR_NO_MEM;
+        }
+
+        ret = esp_local_ctrl_get_prop_values(n_changed, indices, descs, vals);
+        resp_payload->status = err_to_status(ret);
+        if (ret == ESP_OK) {
+            resp_payload->n_props = 0;
+            for (size_t i = 0; i < n_changed; i++) {
+                resp_payload->props[i] = malloc(sizeof(PropertyInfo));
+                if (!resp_payload->props[i]) {
+                    resp_payload->status = STATUS__InternalError;
+                    break;
+                }
+                resp_payload->n_props++;
+                property_info__init(resp_payload->props[i]);
+                resp_payload->props[i]->name  = descs[i].name;
+                resp_payload->props[i]->type  = descs[i].type;
+                resp_payload->props[i]->flags = descs[i].flags;
+                resp_payload->props[i]->value.data = vals[i].data;
+                resp_payload->props[i]->value.len  = vals[i].size;
+                free_fns[i] = vals[i].free_fn;
+            }
+            resp_payload->indices = indices;
+            resp_payload->n_indices = n_changed;
+            indices = NULL;
+        }
+        (*ctx) = (void *)free_fns;
+        free(vals);
+        free(descs);
+    }
+    free(indices);
+    resp->payload_case = LOCAL_CTRL_MESSAGE__PAYLOAD_RESP_GET_ALL_PROP_VALS;
+    resp->resp_get_all_prop_vals = resp_payload;
+    ESP_LOGD(TAG, "Got %d changed properties since checkpoint %llu",
+             resp_payload->n_props, (unsigned long long) req->cmd_get_all_prop_vals->checkpoint);
+
+    /* Unless it's a fatal error, always return ESP_OK, otherwise
+     * the underlying connection will be closed by protocomm */
+    return ESP_OK;
+}
+
 static int lookup_cmd_handler(int cmd_id)
 {
     for (size_t i = 0; i < sizeof(cmd_table)/sizeof(esp_local_ctrl_cmd_t); i++) {
@@ -222,6 +316,22 @@ static void esp_local_ctrl_command_cleanup(LocalCtrlMessage *resp, void **ctx)
         case LOCAL_CTRL_MSG_TYPE__TypeRespSetPropertyValues:
             free(resp->resp_set_prop_vals);
             break;
+        case LOCAL_CTRL_MSG_TYPE__TypeRespGetAllPropertyValues: {
+                if (resp->resp_get_all_prop_vals) {
+                    prop_val_free_fn_t *free_fns = (prop_val_free_fn_t *)(*ctx);
+                    for (size_t i = 0; i < resp->resp_get_all_prop_vals->n_props; i++) {
+                        if (free_fns && free_fns[i]) {
+                            free_fns[i](resp->resp_get_all_prop_vals->props[i]->value.data);
+                        }
+                        free(resp->resp_get_all_prop_vals->props[i]);
+                    }
+                    free(free_fns);
+                    free(resp->resp_get_all_prop_vals->props);
+                    free(resp->resp_get_all_prop_vals->indices);
+                    free(resp->resp_get_all_prop_vals);
+                }
+            }
+            break;
         default:
             ESP_LOGE(TAG, "Unsupported response type in cleanup_handler");
     }
@@ -251,9 +361,15 @@ esp_err_t esp_local_ctrl_data_handler(uint32_t session_id, const uint8_t *inbuf,
                                       uint8_t **outbuf, ssize_t *outlen, void *priv_data)
 {
     void *temp_ctx = NULL;
-    LocalCtrlMessage *req = local_ctrl_message__unpack(NULL, inlen, inbuf);
+
+    /* The request is transient, so unpack it into an arena which is
+     * released in one go instead of walking the message tree */
+    esp_protobuf_arena_t arena;
+    esp_protobuf_arena_init(&arena, 0, 0);
+    LocalCtrlMessage *req = local_ctrl_message__unpack(&arena.allocator, inlen, inbuf);
     if (!req) {
         ESP_LOGE(TAG, "Unable to unpack payload data");
+        esp_protobuf_arena_free(&arena);
         return ESP_ERR_INVALID_ARG;
     }
 
@@ -265,11 +381,11 @@ esp_err_t esp_local_ctrl_data_handler(uint32_t session_id, const uint8_t *inbuf,
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "command dispatcher failed");
         esp_local_ctrl_command_cleanup(&resp, &temp_ctx);
-        local_ctrl_message__free_unpacked(req, NULL);
+        esp_protobuf_arena_free(&arena);
         return ESP_FAIL;
     }
 
-    local_ctrl_message__free_unpacked(req, NULL);
+    esp_protobuf_arena_free(&arena);
 
     *outlen = local_ctrl_message__get_packed_size(&resp);
     if (*outlen <= 0) {
@@ -148,6 +148,32 @@ esp_err_t esp_local_ctrl_get_prop_values(size_t total_indices, uint32_t *indices
 esp_err_t esp_local_ctrl_set_prop_values(size_t total_indices, uint32_t *indices,
                                          const esp_local_ctrl_prop_val_t *values);
 
+/**
+ * @brief   Get indices of all properties that have changed since a given
+ *          checkpoint. Every property carries a version number which is
+ *          bumped whenever its value is set or it is explicitly marked
+ *          dirty, and the service wide checkpoint counter tracks the
+ *          highest version handed out so far. Passing `since` as 0 selects
+ *          all registered properties (full sync).
+ *
+ * @param[in]  since        Checkpoint value from a previous call, or 0 for
+ *                          selecting all properties
+ * @param[out] indices      A pre-allocated array (at least as large as the
+ *                          property count) to be populated with indices of
+ *                          the changed properties. May be NULL if only the
+ *                          count is of interest
+ * @param[out] count        Pointer to variable where the number of changed
+ *                          properties is to be stored
+ * @param[out] checkpoint   Pointer to variable where the current checkpoint
+ *                          value is to be stored
+ *
+ * @return
+ *  - ESP_OK      : Success
+ *  - ESP_FAIL    : Failure
+ */
+esp_err_t esp_local_ctrl_get_changed_prop_indices(uint64_t since, uint32_t *indices,
+                                                  size_t *count, uint64_t *checkpoint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -161,6 +161,130 @@ esp_err_t esp_cache_msync(void *addr, size_t size, int flags)
     return ESP_OK;
 }
 
+typedef struct {
+    uint32_t vaddr;
+    uint32_t size;
+} msync_region_t;
+
+esp_err_t esp_cache_msync_v(const struct iovec *iov, size_t iovcnt, int flags)
+{
+    ESP_RETURN_ON_FALSE_ISR(iov && iovcnt, ESP_ERR_INVALID_ARG, TAG, "null pointer or zero count");
+    ESP_RETURN_ON_FALSE_ISR(iovcnt <= ESP_CACHE_MSYNC_V_MAX_REGIONS, ESP_ERR_INVALID_ARG, TAG, "too many regions, see ESP_CACHE_MSYNC_V_MAX_REGIONS");
+
+    bool both_dir = (flags & ESP_CACHE_MSYNC_FLAG_DIR_C2M) && (flags & ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+    bool both_type = (flags & ESP_CACHE_MSYNC_FLAG_TYPE_DATA) && (flags & ESP_CACHE_MSYNC_FLAG_TYPE_INST);
+    ESP_RETURN_ON_FALSE_ISR(!both_dir && !both_type, ESP_ERR_INVALID_ARG, TAG, "both C2M and M2C directions, or both data and instruction type are selected, you should only select one direction or one type");
+    bool is_m2c = flags & ESP_CACHE_MSYNC_FLAG_DIR_M2C;
+    if (is_m2c) {
+        ESP_RETURN_ON_FALSE_ISR((flags & ESP_CACHE_MSYNC_FLAG_UNALIGNED) == 0, ESP_ERR_INVALID_ARG, TAG, "M2C direction doesn't allow ESP_CACHE_MSYNC_FLAG_UNALIGNED");
+    } else {
+        ESP_RETURN_ON_FALSE_ISR((flags & ESP_CACHE_MSYNC_FLAG_TYPE_INST) == 0, ESP_ERR_INVALID_ARG, TAG, "C2M direction doesn't support instruction type");
+    }
+    cache_type_t cache_type = CACHE_TYPE_DATA;
+    if (flags & ESP_CACHE_MSYNC_FLAG_TYPE_INST) {
+        cache_type = CACHE_TYPE_INSTRUCTION;
+    }
+
+    // validate every region before touching the cache, so that the call
+    // either syncs all regions or none of them
+    msync_region_t regions[ESP_CACHE_MSYNC_V_MAX_REGIONS];
+    uint32_t num_regions = 0;
+    for (size_t i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        ESP_RETURN_ON_FALSE_ISR(iov[i].iov_base, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+        uint32_t vaddr = (uint32_t)iov[i].iov_base;
+        uint32_t size = iov[i].iov_len;
+        uint32_t addr_end = 0;
+        ESP_RETURN_ON_FALSE_ISR(!__builtin_add_overflow(vaddr, size, &addr_end), ESP_ERR_INVALID_ARG, TAG, "wrong size, total size overflow");
+
+        uint32_t cache_level = 0;
+        uint32_t cache_id = 0;
+        if (!cache_hal_vaddr_to_cache_level_id(vaddr, size, &cache_level, &cache_id)) {
+            ESP_EARLY_LOGV(TAG, "vaddr is not in cacheable range, do nothing");
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+        if ((flags & ESP_CACHE_MSYNC_FLAG_UNALIGNED) == 0) {
+            uint32_t cache_line_size = cache_hal_get_cache_line_size(cache_level, cache_type);
+            bool aligned_addr = ((vaddr % cache_line_size) == 0) && ((size % cache_line_size) == 0);
+            ESP_RETURN_ON_FALSE_ISR(aligned_addr, ESP_ERR_INVALID_ARG, TAG, "start address: 0x%" PRIx32 ", or the size: 0x%" PRIx32 " is(are) not aligned with cache line size (0x%" PRIx32 ")B", vaddr, size, cache_line_size);
+        }
+        regions[num_regions].vaddr = vaddr;
+        regions[num_regions].size = size;
+        num_regions++;
+    }
+    if (num_regions == 0) {
+        return ESP_OK;
+    }
+
+    // sort by start address (insertion sort, the region count is small) ...
+    for (uint32_t i = 1; i < num_regions; i++) {
+        msync_region_t key = regions[i];
+        uint32_t j = i;
+        while (j > 0 && regions[j - 1].vaddr > key.vaddr) {
+            regions[j] = regions[j - 1];
+            j--;
+        }
+        regions[j] = key;
+    }
+    // ... then merge adjacent and overlapping regions, so the hardware walks
+    // each affected cache line exactly once
+    uint32_t merged = 0;
+    for (uint32_t i = 1; i < num_regions; i++) {
+        msync_region_t *last = &regions[merged];
+        if (regions[i].vaddr <= last->vaddr + last->size) {
+            uint32_t end = MAX(last->vaddr + last->size, regions[i].vaddr + regions[i].size);
+            last->size = end - last->vaddr;
+        } else {
+            regions[++merged] = regions[i];
+        }
+    }
+    num_regions = merged + 1;
+
+    // Value unused if asserts are disabled
+    bool __attribute__((unused)) valid = true;
+    if (is_m2c) {
+        esp_os_enter_critical_safe(&s_spinlock);
+        for (uint32_t i = 0; i < num_regions; i++) {
+            valid &= cache_hal_invalidate_addr(regions[i].vaddr, regions[i].size);
+        }
+        esp_os_exit_critical_safe(&s_spinlock);
+        assert(valid);
+    } else {
+#if SOC_CACHE_WRITEBACK_SUPPORTED
+        s_acquire_mutex_from_task_context();
+#if CONFIG_ESP_MM_CACHE_MSYNC_C2M_CHUNKED_OPS
+        if (!xPortInIsrContext()) {
+            // keep the chunked behavior (bounded critical sections) in task context
+            for (uint32_t i = 0; i < num_regions; i++) {
+                s_c2m_ops(regions[i].vaddr, regions[i].size);
+            }
+        } else
+#endif
+        {
+            esp_os_enter_critical_safe(&s_spinlock);
+            for (uint32_t i = 0; i < num_regions; i++) {
+                valid &= cache_hal_writeback_addr(regions[i].vaddr, regions[i].size);
+            }
+            esp_os_exit_critical_safe(&s_spinlock);
+            assert(valid);
+        }
+        if (flags & ESP_CACHE_MSYNC_FLAG_INVALIDATE) {
+            esp_os_enter_critical_safe(&s_spinlock);
+            for (uint32_t i = 0; i < num_regions; i++) {
+                valid &= cache_hal_invalidate_addr(regions[i].vaddr, regions[i].size);
+            }
+            esp_os_exit_critical_safe(&s_spinlock);
+            assert(valid);
+        }
+        s_release_mutex_from_task_context();
+#endif  //#if SOC_CACHE_WRITEBACK_SUPPORTED
+    }
+
+    return ESP_OK;
+}
+
 esp_err_t esp_cache_get_alignment(uint32_t heap_caps, size_t *out_alignment)
 {
     ESP_RETURN_ON_FALSE(out_alignment, ESP_ERR_INVALID_ARG, TAG, "null pointer");
@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <sys/lock.h>
+#include "sdkconfig.h"
+#include "soc/soc_caps.h"
+#include "esp_memcpy.h"
+
+#if SOC_ASYNC_MEMCPY_SUPPORTED
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_async_memcpy.h"
+#endif
+
+/*
+Bandwidth-aware memcpy/memset kernels.
+
+Generic libc memcpy moves bytes or single words, which leaves a lot of the
+cache-line bandwidth to external RAM unused. The wide-word kernels below move
+four 32-bit words per iteration so consecutive accesses hit the same cache
+line, and large copies are handed to the async memcpy DMA engine where the
+target has one, with the calling task sleeping instead of spinning.
+*/
+
+#if SOC_ASYNC_MEMCPY_SUPPORTED
+
+static async_memcpy_handle_t s_mcp;          // lazily installed engine, shared by all callers
+static bool s_mcp_install_attempted;
+static _lock_t s_mcp_lock;
+
+static bool mcp_sync_done_cb(async_memcpy_handle_t mcp, async_memcpy_event_t *event, void *cb_args)
+{
+    BaseType_t task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR((TaskHandle_t)cb_args, &task_woken);
+    return task_woken == pdTRUE;
+}
+
+static bool mcp_ensure_installed(void)
+{
+    if (s_mcp != NULL) {
+        return true;
+    }
+    if (s_mcp_install_attempted) {
+        return false;
+    }
+
+    _lock_acquire(&s_mcp_lock);
+    if (!s_mcp_install_attempted) {
+        async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+        if (esp_async_memcpy_install(&config, &s_mcp) != ESP_OK) {
+            // don't retry on every call, the CPU kernel serves as the permanent fallback
+            s_mcp = NULL;
+        }
+        s_mcp_install_attempted = true;
+    }
+    _lock_release(&s_mcp_lock);
+    return s_mcp != NULL;
+}
+
+#endif // SOC_ASYNC_MEMCPY_SUPPORTED
+
+// Four words per iteration; mutual 4-byte alignment is established by the caller
+static void cpu_wide_copy(uint32_t *dst, const uint32_t *src, size_t words)
+{
+    while (words >= 4) {
+        uint32_t w0 = src[0];
+        uint32_t w1 = src[1];
+        uint32_t w2 = src[2];
+        uint32_t w3 = src[3];
+        dst[0] = w0;
+        dst[1] = w1;
+        dst[2] = w2;
+        dst[3] = w3;
+        src += 4;
+        dst += 4;
+        words -= 4;
+    }
+    while (words-- > 0) {
+        *dst++ = *src++;
+    }
+}
+
+static void *cpu_wide_memcpy(void *dst, const void *src, size_t n)
+{
+    uint8_t *d = (uint8_t *)dst;
+    const uint8_t *s = (const uint8_t *)src;
+
+    // The word loop needs both pointers on the same offset within a word
+    if (((uintptr_t)d & 3) != ((uintptr_t)s & 3)) {
+        return memcpy(dst, src, n);
+    }
+
+    size_t head = (4 - ((uintptr_t)d & 3)) & 3;
+    if (head > 0) {
+        memcpy(d, s, head);
+        d += head;
+        s += head;
+        n -= head;
+    }
+
+    size_t words = n / 4;
+    cpu_wide_copy((uint32_t *)d, (const uint32_t *)s, words);
+
+    size_t tail = n & 3;
+    if (tail > 0) {
+        memcpy(d + words * 4, s + words * 4, tail);
+    }
+    return dst;
+}
+
+void *esp_memcpy_best(void *dst, const void *src, size_t n)
+{
+    if (n < ESP_MEMCPY_WIDE_THRESHOLD) {
+        return memcpy(dst, src, n);
+    }
+
+#if SOC_ASYNC_MEMCPY_SUPPORTED
+    if (n >= ESP_MEMCPY_DMA_THRESHOLD &&
+            !xPortInIsrContext() &&
+            xTaskGetSchedulerState() == taskSCHEDULER_RUNNING &&
+            mcp_ensure_installed()) {
+        if (esp_async_memcpy(s_mcp, dst, (void *)src, n, mcp_sync_done_cb, xTaskGetCurrentTaskHandle()) == ESP_OK) {
+            while (ulTaskNotifyTake(pdTRUE, portMAX_DELAY) == 0) {
+            }
+            return dst;
+        }
+        // the engine rejected the transfer (e.g. address range or alignment), copy with the CPU
+    }
+#endif
+
+    return cpu_wide_memcpy(dst, src, n);
+}
+
+void *esp_memset_best(void *dst, int c, size_t n)
+{
+    if (n < ESP_MEMCPY_WIDE_THRESHOLD) {
+        return memset(dst, c, n);
+    }
+
+    uint8_t *d = (uint8_t *)dst;
+    size_t head = (4 - ((uintptr_t)d & 3)) & 3;
+    if (head > 0) {
+        memset(d, c, head);
+        d += head;
+        n -= head;
+    }
+
+    uint32_t pattern = (uint8_t)c;
+    pattern |= pattern << 8;
+    pattern |= pattern << 16;
+
+    uint32_t *dw = (uint32_t *)d;
+    size_t words = n / 4;
+    while (words >= 4) {
+        dw[0] = pattern;
+        dw[1] = pattern;
+        dw[2] = pattern;
+        dw[3] = pattern;
+        dw += 4;
+        words -= 4;
+    }
+    while (words-- > 0) {
+        *dw++ = pattern;
+    }
+
+    size_t tail = n & 3;
+    if (tail > 0) {
+        memset((uint8_t *)dw, c, tail);
+    }
+    return dst;
+}
@@ -79,9 +79,21 @@ typedef struct mem_block_ {
     uint32_t paddr_start;  //physical address start of this block
     uint32_t paddr_end;    //physical address end of this block
     mmu_target_t target;   //physical target that this block is mapped to
+    bool is_reserved;      //true if the block is a named reserved region, it then lives as long as the process and can't be unmapped via `esp_mmu_unmap`
     TAILQ_ENTRY(mem_block_) entries;  //link entry
 } mem_block_t;
 
+/**
+ * Struct for a named reserved region, see `esp_mmu_map_region_reserve`.
+ * The struct tag is the opaque type behind `esp_mmu_region_handle_t`.
+ */
+typedef struct esp_mmu_reserved_region_ {
+    char name[ESP_MMU_REGION_NAME_LEN];  //region name, zero terminated
+    mem_block_t *block;                  //the block pinning the vaddr range of this region
+    mem_region_t *region;                //the memory region the block was carved from
+    TAILQ_ENTRY(esp_mmu_reserved_region_) entries;  //link entry
+} reserved_region_t;
+
 /**
  * Struct for a memory region
  */
@@ -108,6 +120,10 @@ typedef struct {
      * Only the first `num_regions` items are valid
      */
     mem_region_t mem_regions[SOC_MMU_LINEAR_ADDRESS_REGION_NUM];
+    /**
+     * named reserved regions, see `esp_mmu_map_region_reserve`
+     */
+    TAILQ_HEAD(reserved_region_head_, esp_mmu_reserved_region_) reserved_region_head;
     /**
      * driver layer mutex lock
      */
@@ -257,6 +273,7 @@ void esp_mmu_map_init(void)
     for (int i = 0; i < available_region_idx; i++) {
         TAILQ_INIT(&s_mmu_ctx.mem_regions[i].mem_block_head);
     }
+    TAILQ_INIT(&s_mmu_ctx.reserved_region_head);
 
     assert(available_region_idx == region_num);
 }
@@ -308,6 +325,87 @@ static int32_t s_find_available_region(mem_region_t *mem_regions, uint32_t regio
     return found_region_id;
 }
 
+/**
+ * Create the dummy head and tail blocks delimiting the block list of `region`,
+ * if the list is still empty
+ */
+static esp_err_t s_ensure_block_list(mem_region_t *region, mmu_mem_caps_t caps)
+{
+    if (!TAILQ_EMPTY(&region->mem_block_head)) {
+        return ESP_OK;
+    }
+
+    mem_block_t *dummy_head = (mem_block_t *)heap_caps_calloc(1, sizeof(mem_block_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(dummy_head, ESP_ERR_NO_MEM, TAG, "no mem");
+
+    dummy_head->laddr_start = region->free_head;
+    dummy_head->laddr_end = region->free_head;
+    //We don't care vaddr or paddr address for dummy head
+    dummy_head->size = 0;
+    dummy_head->caps = caps;
+
+    mem_block_t *dummy_tail = (mem_block_t *)heap_caps_calloc(1, sizeof(mem_block_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!dummy_tail) {
+        free(dummy_head);
+        ESP_RETURN_ON_FALSE(false, ESP_ERR_NO_MEM, TAG, "no mem");
+    }
+
+    dummy_tail->laddr_start = region->end;
+    dummy_tail->laddr_end = region->end;
+    //We don't care vaddr or paddr address for dummy tail
+    dummy_tail->size = 0;
+    dummy_tail->caps = caps;
+
+    TAILQ_INSERT_HEAD(&region->mem_block_head, dummy_head, entries);
+    TAILQ_INSERT_TAIL(&region->mem_block_head, dummy_tail, entries);
+    return ESP_OK;
+}
+
+/**
+ * Link `new_block` of `aligned_size` into the best fitting free slot of `region`.
+ *
+ * Using the smallest slot that still fits keeps the large slots intact, so a
+ * long-running system can still serve large mappings after many map/unmap
+ * cycles have fragmented the pool. `new_block->laddr_start/laddr_end/size` are
+ * filled in and the region's `max_slot_size` is recomputed. The caller must
+ * make sure a fitting slot exists (see `s_find_available_region`).
+ */
+static void s_insert_block_best_fit(mem_region_t *region, mem_block_t *new_block, size_t aligned_size)
+{
+    mem_block_t *mem_block = NULL;
+    mem_block_t *found_block = NULL;  //The block we found, whose slot between its prior block is where we will insert the new block to
+    uint32_t last_end = TAILQ_FIRST(&region->mem_block_head)->laddr_end;
+    size_t best_slot_len = 0;
+    bool found = false;
+
+    TAILQ_FOREACH(mem_block, &region->mem_block_head, entries) {
+        size_t slot_len = mem_block->laddr_start - last_end;
+        if ((slot_len >= aligned_size) && (!found || (slot_len < best_slot_len))) {
+            found = true;
+            found_block = mem_block;
+            best_slot_len = slot_len;
+            new_block->laddr_start = last_end;
+        }
+        last_end = mem_block->laddr_end;
+    }
+
+    assert(found);
+    new_block->laddr_end = new_block->laddr_start + aligned_size;
+    new_block->size = aligned_size;
+    //insert the to-be-mapped new block to the list
+    TAILQ_INSERT_BEFORE(found_block, new_block, entries);
+
+    //Finally, we update the max_slot_size
+    size_t max_slot_len = 0;
+    last_end = TAILQ_FIRST(&region->mem_block_head)->laddr_end;
+    TAILQ_FOREACH(mem_block, &region->mem_block_head, entries) {
+        size_t slot_len = mem_block->laddr_start - last_end;
+        max_slot_len = (slot_len > max_slot_len) ? slot_len : max_slot_len;
+        last_end = mem_block->laddr_end;
+    }
+    region->max_slot_size = max_slot_len;
+}
+
 esp_err_t esp_mmu_map_reserve_block_with_caps(size_t size, mmu_mem_caps_t caps, mmu_target_t target, const void **out_ptr)
 {
     ESP_RETURN_ON_FALSE(out_ptr, ESP_ERR_INVALID_ARG, TAG, "null pointer");
@@ -470,8 +568,6 @@ esp_err_t esp_mmu_map(esp_paddr_t paddr_start, size_t size, mmu_target_t target,
     ESP_RETURN_ON_ERROR(s_mem_caps_check(caps), TAG, "invalid caps");
 
     _lock_acquire(&s_mmu_ctx.mutex);
-    mem_block_t *dummy_head = NULL;
-    mem_block_t *dummy_tail = NULL;
     size_t aligned_size = ALIGN_UP_BY(size, CONFIG_MMU_PAGE_SIZE);
     int32_t found_region_id = s_find_available_region(s_mmu_ctx.mem_regions, s_mmu_ctx.num_regions, aligned_size, caps, target);
     ESP_GOTO_ON_FALSE(found_region_id != -1, ESP_ERR_NOT_FOUND, err, TAG, "no such vaddr range");
@@ -480,27 +576,7 @@ esp_err_t esp_mmu_map(esp_paddr_t paddr_start, size_t size, mmu_target_t target,
     mem_region_t *found_region = &s_mmu_ctx.mem_regions[found_region_id];
     mem_block_t *new_block = NULL;
 
-    if (TAILQ_EMPTY(&found_region->mem_block_head)) {
-        dummy_head = (mem_block_t *)heap_caps_calloc(1, sizeof(mem_block_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-        ESP_GOTO_ON_FALSE(dummy_head, ESP_ERR_NO_MEM, err, TAG, "no mem");
-
-        dummy_head->laddr_start = found_region->free_head;
-        dummy_head->laddr_end = found_region->free_head;
-        //We don't care vaddr or paddr address for dummy head
-        dummy_head->size = 0;
-        dummy_head->caps = caps;
-        TAILQ_INSERT_HEAD(&found_region->mem_block_head, dummy_head, entries);
-
-        dummy_tail = (mem_block_t *)heap_caps_calloc(1, sizeof(mem_block_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-        ESP_GOTO_ON_FALSE(dummy_tail, ESP_ERR_NO_MEM, err, TAG, "no mem");
-
-        dummy_tail->laddr_start = found_region->end;
-        dummy_tail->laddr_end = found_region->end;
-        //We don't care vaddr or paddr address for dummy tail
-        dummy_tail->size = 0;
-        dummy_tail->caps = caps;
-        TAILQ_INSERT_TAIL(&found_region->mem_block_head, dummy_tail, entries);
-    }
+    ESP_GOTO_ON_ERROR(s_ensure_block_list(found_region, caps), err, TAG, "no mem");
 
     //Check if paddr is overlapped
     mem_block_t *mem_block = NULL;
@@ -549,39 +625,9 @@ esp_err_t esp_mmu_map(esp_paddr_t paddr_start, size_t size, mmu_target_t target,
     ESP_GOTO_ON_FALSE(new_block, ESP_ERR_NO_MEM, err, TAG, "no mem");
 
     //Reserve this block as it'll be mapped
-    bool found = false;
-    // Get the end address of the dummy_head block, which is always first block on the list
-    uint32_t last_end = TAILQ_FIRST(&found_region->mem_block_head)->laddr_end;
-    size_t slot_len = 0;
-    size_t max_slot_len = 0;
-    mem_block_t *found_block = NULL;  //This stands for the block we found, whose slot between its prior block is where we will insert the new block to
-
-    TAILQ_FOREACH(mem_block, &found_region->mem_block_head, entries) {
-        slot_len = mem_block->laddr_start - last_end;
-
-        if (!found) {
-            if (slot_len >= aligned_size) {
-                //Found it
-                found = true;
-                found_block = mem_block;
-                slot_len -= aligned_size;
-                new_block->laddr_start = last_end;
-            }
-        }
-
-        max_slot_len = (slot_len > max_slot_len) ? slot_len : max_slot_len;
-        last_end = mem_block->laddr_end;
-    }
-
-    assert(found);
-    //insert the to-be-mapped new block to the list
-    TAILQ_INSERT_BEFORE(found_block, new_block, entries);
-    //Finally, we update the max_slot_size
-    found_region->max_slot_size = max_slot_len;
+    s_insert_block_best_fit(found_region, new_block, aligned_size);
 
     //Now we fill others according to the found `new_block->laddr_start`
-    new_block->laddr_end = new_block->laddr_start + aligned_size;
-    new_block->size = aligned_size;
     new_block->caps = caps;
     new_block->paddr_start = paddr_start;
     new_block->paddr_end = paddr_start + aligned_size;
@@ -602,12 +648,6 @@ esp_err_t esp_mmu_map(esp_paddr_t paddr_start, size_t size, mmu_target_t target,
     return ESP_OK;
 
 err:
-    if (dummy_tail) {
-        free(dummy_tail);
-    }
-    if (dummy_head) {
-        free(dummy_head);
-    }
     _lock_release(&s_mmu_ctx.mutex);
 
     return ret;
@@ -675,6 +715,8 @@ esp_err_t esp_mmu_unmap(void *ptr)
 
         //now we are only traversing the actual dynamically allocated blocks, dummy_head and dummy_tail are excluded already
         if (mem_block->laddr_start == ptr_laddr) {
+            //named reserved regions are pinned for the lifetime of the process
+            ESP_GOTO_ON_FALSE(!mem_block->is_reserved, ESP_ERR_INVALID_ARG, err, TAG, "vaddr belongs to a reserved region");
             slot_len = TAILQ_NEXT(mem_block, entries)->laddr_start - TAILQ_PREV(mem_block, mem_block_head_, entries)->laddr_end;
             region->max_slot_size = (slot_len > region->max_slot_size) ? slot_len : region->max_slot_size;
 
@@ -703,6 +745,109 @@ err:
     return ret;
 }
 
+esp_err_t esp_mmu_map_region_reserve(const char *name, size_t size, mmu_mem_caps_t caps, mmu_target_t target, esp_mmu_region_handle_t *out_handle)
+{
+    ESP_RETURN_ON_FALSE(name && out_handle, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+    ESP_RETURN_ON_FALSE(strlen(name) < ESP_MMU_REGION_NAME_LEN, ESP_ERR_INVALID_ARG, TAG, "region name too long");
+    ESP_RETURN_ON_FALSE(size, ESP_ERR_INVALID_ARG, TAG, "invalid size");
+    ESP_RETURN_ON_ERROR(s_mem_caps_check(caps), TAG, "invalid caps");
+
+    esp_err_t ret = ESP_FAIL;
+    reserved_region_t *reservation = NULL;
+    mem_block_t *new_block = NULL;
+
+    _lock_acquire(&s_mmu_ctx.mutex);
+    TAILQ_FOREACH(reservation, &s_mmu_ctx.reserved_region_head, entries) {
+        ESP_GOTO_ON_FALSE(strcmp(reservation->name, name) != 0, ESP_ERR_INVALID_STATE, err, TAG, "region name is reserved already");
+    }
+
+    size_t aligned_size = ALIGN_UP_BY(size, CONFIG_MMU_PAGE_SIZE);
+    int32_t found_region_id = s_find_available_region(s_mmu_ctx.mem_regions, s_mmu_ctx.num_regions, aligned_size, caps, target);
+    ESP_GOTO_ON_FALSE(found_region_id != -1, ESP_ERR_NOT_FOUND, err, TAG, "no such vaddr range");
+
+    mem_region_t *found_region = &s_mmu_ctx.mem_regions[found_region_id];
+    ESP_GOTO_ON_ERROR(s_ensure_block_list(found_region, caps), err, TAG, "no mem");
+
+    reservation = (reserved_region_t *)heap_caps_calloc(1, sizeof(reserved_region_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_GOTO_ON_FALSE(reservation, ESP_ERR_NO_MEM, err, TAG, "no mem");
+
+    new_block = (mem_block_t *)heap_caps_calloc(1, sizeof(mem_block_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!new_block) {
+        free(reservation);
+        ESP_GOTO_ON_FALSE(false, ESP_ERR_NO_MEM, err, TAG, "no mem");
+    }
+
+    //Pin the vaddr range; dynamic mappings will allocate around it from now on
+    s_insert_block_best_fit(found_region, new_block, aligned_size);
+    new_block->caps = caps;
+    new_block->target = target;
+    new_block->is_reserved = true;
+    if (caps & MMU_MEM_CAP_EXEC) {
+        new_block->vaddr_start = mmu_ll_laddr_to_vaddr(new_block->laddr_start, MMU_VADDR_INSTRUCTION, target);
+        new_block->vaddr_end = mmu_ll_laddr_to_vaddr(new_block->laddr_end, MMU_VADDR_INSTRUCTION, target);
+    } else {
+        new_block->vaddr_start = mmu_ll_laddr_to_vaddr(new_block->laddr_start, MMU_VADDR_DATA, target);
+        new_block->vaddr_end = mmu_ll_laddr_to_vaddr(new_block->laddr_end, MMU_VADDR_DATA, target);
+    }
+
+    strlcpy(reservation->name, name, sizeof(reservation->name));
+    reservation->block = new_block;
+    reservation->region = found_region;
+    TAILQ_INSERT_TAIL(&s_mmu_ctx.reserved_region_head, reservation, entries);
+
+    *out_handle = reservation;
+    _lock_release(&s_mmu_ctx.mutex);
+
+    return ESP_OK;
+
+err:
+    _lock_release(&s_mmu_ctx.mutex);
+    return ret;
+}
+
+esp_err_t esp_mmu_map_region_find(const char *name, esp_mmu_region_handle_t *out_handle)
+{
+    ESP_RETURN_ON_FALSE(name && out_handle, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+
+    reserved_region_t *reservation = NULL;
+
+    _lock_acquire(&s_mmu_ctx.mutex);
+    TAILQ_FOREACH(reservation, &s_mmu_ctx.reserved_region_head, entries) {
+        if (strcmp(reservation->name, name) == 0) {
+            *out_handle = reservation;
+            _lock_release(&s_mmu_ctx.mutex);
+            return ESP_OK;
+        }
+    }
+    _lock_release(&s_mmu_ctx.mutex);
+
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_mmu_map_region_map(esp_mmu_region_handle_t handle, esp_paddr_t paddr_start, size_t size, size_t region_offset, void **out_ptr)
+{
+    ESP_RETURN_ON_FALSE(handle && out_ptr, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+    ESP_RETURN_ON_FALSE((paddr_start % CONFIG_MMU_PAGE_SIZE == 0), ESP_ERR_INVALID_ARG, TAG, "paddr must be rounded up to the nearest multiple of CONFIG_MMU_PAGE_SIZE");
+    ESP_RETURN_ON_FALSE((region_offset % CONFIG_MMU_PAGE_SIZE == 0), ESP_ERR_INVALID_ARG, TAG, "region_offset must be rounded up to the nearest multiple of CONFIG_MMU_PAGE_SIZE");
+
+    size_t aligned_size = ALIGN_UP_BY(size, CONFIG_MMU_PAGE_SIZE);
+    mem_block_t *block = handle->block;
+    ESP_RETURN_ON_FALSE(aligned_size && (region_offset + aligned_size <= block->size), ESP_ERR_INVALID_SIZE, TAG, "range exceeds the reserved region");
+
+    _lock_acquire(&s_mmu_ctx.mutex);
+    s_do_mapping(block->target, block->vaddr_start + region_offset, paddr_start, aligned_size);
+    /**
+     * Remember the linear paddr relation of the latest mapping, so reverse
+     * lookups (e.g. the flash cache flush on write) keep covering the region
+     */
+    block->paddr_start = paddr_start - region_offset;
+    block->paddr_end = block->paddr_start + block->size;
+    *out_ptr = (void *)(block->vaddr_start + region_offset);
+    _lock_release(&s_mmu_ctx.mutex);
+
+    return ESP_OK;
+}
+
 esp_err_t esp_mmu_map_dump_mapped_blocks(FILE* stream)
 {
     char line[100];
@@ -7,6 +7,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <sys/uio.h>
 #include "esp_err.h"
 #include "esp_bit_defs.h"
 
@@ -80,6 +81,37 @@ extern "C" {
  */
 esp_err_t esp_cache_msync(void *addr, size_t size, int flags);
 
+/**
+ * @brief Maximum number of regions accepted by a single esp_cache_msync_v() call
+ */
+#define ESP_CACHE_MSYNC_V_MAX_REGIONS  64
+
+/**
+ * @brief Memory sync between Cache and storage memory, for a list of regions
+ *
+ * Behaves like calling esp_cache_msync() once per region with the same flags,
+ * but validates all regions up front, sorts and merges adjacent regions, and
+ * walks the cache operations back-to-back so that the per-call overhead
+ * (argument checks, critical section entry/exit) is paid once instead of per
+ * region. Intended for scatter-gather style transfers that touch many small
+ * buffers per operation.
+ *
+ * Either all regions are synced or, if validation fails, none are. Regions
+ * with a zero iov_len are skipped.
+ *
+ * This API is cache-safe and thread-safe
+ *
+ * @param[in] iov     Array of regions (iov_base / iov_len) to do the msync
+ * @param[in] iovcnt  Number of regions, at most ESP_CACHE_MSYNC_V_MAX_REGIONS
+ * @param[in] flags   Flags, see `ESP_CACHE_MSYNC_FLAG_x`, applied to all regions
+ *
+ * @return
+ *        - ESP_OK:                Successful msync of all regions
+ *        - ESP_ERR_INVALID_ARG:   Invalid argument, see printed logs
+ *        - ESP_ERR_NOT_SUPPORTED: A region is not in cacheable range, API will do nothing
+ */
+esp_err_t esp_cache_msync_v(const struct iovec *iov, size_t iovcnt, int flags);
+
 /**
  * @brief Get the cache line size by address
  *
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Transfers at or above this size use the wide-word CPU kernel instead of libc memcpy/memset
+ */
+#define ESP_MEMCPY_WIDE_THRESHOLD  64
+
+/**
+ * @brief Transfers at or above this size are offloaded to the async memcpy DMA engine
+ *        (configurable via CONFIG_ESP_MM_MEMCPY_DMA_THRESHOLD, only on targets with the engine)
+ */
+#ifdef CONFIG_ESP_MM_MEMCPY_DMA_THRESHOLD
+#define ESP_MEMCPY_DMA_THRESHOLD   CONFIG_ESP_MM_MEMCPY_DMA_THRESHOLD
+#endif
+
+/**
+ * @brief Copy memory, picking the fastest engine available for the transfer size
+ *
+ * Small transfers go through libc memcpy. Transfers of ESP_MEMCPY_WIDE_THRESHOLD bytes
+ * and more use an unrolled wide-word loop, which makes a visible difference when one of
+ * the buffers lives in external RAM. On targets with the async memcpy engine, transfers
+ * of ESP_MEMCPY_DMA_THRESHOLD bytes and more are offloaded to the DMA and the calling
+ * task sleeps until the copy finished, freeing the CPU for other work; when the engine
+ * can't take the job (driver not installable, ISR context, scheduler not running, or
+ * buffers the DMA can't reach) the call transparently falls back to the CPU kernel.
+ *
+ * @note The DMA path blocks on the calling task's notification (index 0), like other
+ *       synchronous-over-async waits in ESP-IDF. Do not rely on notification index 0
+ *       staying untouched across this call.
+ *
+ * @param[out] dst Destination buffer
+ * @param[in] src Source buffer, must not overlap with dst
+ * @param[in] n Number of bytes to copy
+ *
+ * @return dst
+ */
+void *esp_memcpy_best(void *dst, const void *src, size_t n);
+
+/**
+ * @brief Fill memory, using an unrolled wide-word loop for large fills
+ *
+ * Behaves like libc memset; fills of ESP_MEMCPY_WIDE_THRESHOLD bytes and more use a
+ * wide-word kernel, which speeds up clearing buffers in external RAM.
+ *
+ * @param[out] dst Buffer to fill
+ * @param[in] c Fill value, converted to unsigned char
+ * @param[in] n Number of bytes to fill
+ *
+ * @return dst
+ */
+void *esp_memset_best(void *dst, int c, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
@@ -57,6 +57,16 @@ extern "C" {
  */
 typedef uint32_t esp_paddr_t;
 
+/**
+ * @brief Maximum length of a reserved region name, including the terminating zero
+ */
+#define ESP_MMU_REGION_NAME_LEN    16
+
+/**
+ * @brief Handle of a named reserved region, see `esp_mmu_map_region_reserve`
+ */
+typedef struct esp_mmu_reserved_region_ *esp_mmu_region_handle_t;
+
 /**
  * @brief Map a physical memory block to external virtual address block, with given capabilities.
  *
@@ -95,6 +105,65 @@ esp_err_t esp_mmu_map(esp_paddr_t paddr_start, size_t size, mmu_target_t target,
  */
 esp_err_t esp_mmu_unmap(void *ptr);
 
+/**
+ * @brief Reserve a named virtual address window for the lifetime of the process
+ *
+ * The window is pinned: dynamic mappings created by `esp_mmu_map` allocate
+ * around it, so its virtual range stays available no matter how fragmented the
+ * rest of the pool becomes. Physical memory can be (re)mapped into the window
+ * with `esp_mmu_map_region_map` at any time. Reserve windows early, before the
+ * pool fragments.
+ *
+ * @param[in]  name        Name identifying the window, up to ESP_MMU_REGION_NAME_LEN - 1 characters. Copied internally.
+ * @param[in]  size        Size to reserve. Size will be rounded up by to the nearest multiple of MMU page size
+ * @param[in]  caps        Memory capabilities, see `mmu_mem_caps_t`
+ * @param[in]  target      Physical memory target you're going to map to, see `mmu_target_t`
+ * @param[out] out_handle  Handle of the reserved region
+ *
+ * @return
+ *        - ESP_OK
+ *        - ESP_ERR_INVALID_ARG:   Invalid argument, see printed logs
+ *        - ESP_ERR_INVALID_STATE: A region with this name is reserved already
+ *        - ESP_ERR_NOT_FOUND:     No enough size free block to use
+ *        - ESP_ERR_NO_MEM:        Out of memory, this API will allocate some heap memory for internal usage
+ */
+esp_err_t esp_mmu_map_region_reserve(const char *name, size_t size, mmu_mem_caps_t caps, mmu_target_t target, esp_mmu_region_handle_t *out_handle);
+
+/**
+ * @brief Find a previously reserved region by its name
+ *
+ * @param[in]  name        Name passed to `esp_mmu_map_region_reserve`
+ * @param[out] out_handle  Handle of the reserved region
+ *
+ * @return
+ *        - ESP_OK
+ *        - ESP_ERR_INVALID_ARG:  Null pointer
+ *        - ESP_ERR_NOT_FOUND:    No region with this name is reserved
+ */
+esp_err_t esp_mmu_map_region_find(const char *name, esp_mmu_region_handle_t *out_handle);
+
+/**
+ * @brief Map a physical memory block into a reserved region
+ *
+ * Mapping is done in place: virtual addresses inside the window stay stable
+ * across remaps, and mapping a new physical block over an already mapped part
+ * of the window simply replaces the old mapping. No unmap call is needed in
+ * between, which makes the window suitable for streaming through a physical
+ * range larger than the window itself.
+ *
+ * @param[in]  handle         Handle from `esp_mmu_map_region_reserve` or `esp_mmu_map_region_find`
+ * @param[in]  paddr_start    Start address of the physical memory block
+ * @param[in]  size           Size to be mapped. Size will be rounded up by to the nearest multiple of MMU page size
+ * @param[in]  region_offset  Offset inside the reserved region at which the block is mapped, in bytes. Must be a multiple of the MMU page size
+ * @param[out] out_ptr        Start address of the mapped virtual memory, i.e. the region start plus `region_offset`
+ *
+ * @return
+ *        - ESP_OK
+ *        - ESP_ERR_INVALID_ARG:   Invalid argument, see printed logs
+ *        - ESP_ERR_INVALID_SIZE:  The mapped range would not fit into the reserved region
+ */
+esp_err_t esp_mmu_map_region_map(esp_mmu_region_handle_t handle, esp_paddr_t paddr_start, size_t size, size_t region_offset, void **out_ptr);
+
 /**
  * @brief Get largest consecutive free external virtual memory block size, with given capabilities and given physical target
  *
@@ -215,3 +215,22 @@ TEST_CASE("test cache msync unaligned flag not work with M2C direction", "[cache
 {
     TEST_ASSERT(esp_cache_msync((void *)TEST_SYNC_START, 0x8000, ESP_CACHE_MSYNC_FLAG_UNALIGNED | ESP_CACHE_MSYNC_FLAG_DIR_M2C) == ESP_ERR_INVALID_ARG);
 }
+
+TEST_CASE("test cache msync_v syncs a region list", "[cache]")
+{
+    //two disjoint regions plus one adjacent to the first, which gets merged
+    struct iovec iov[3] = {
+        { .iov_base = (void *)TEST_SYNC_START,            .iov_len = 0x1000 },
+        { .iov_base = (void *)(TEST_SYNC_START + 0x4000), .iov_len = 0x1000 },
+        { .iov_base = (void *)(TEST_SYNC_START + 0x1000), .iov_len = 0x1000 },
+    };
+    TEST_ESP_OK(esp_cache_msync_v(iov, 3, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE));
+    TEST_ESP_OK(esp_cache_msync_v(iov, 3, ESP_CACHE_MSYNC_FLAG_DIR_M2C));
+
+    //zero-length regions are skipped
+    iov[1].iov_len = 0;
+    TEST_ESP_OK(esp_cache_msync_v(iov, 3, ESP_CACHE_MSYNC_FLAG_DIR_C2M));
+
+    //flag validation mirrors esp_cache_msync
+    TEST_ASSERT(esp_cache_msync_v(iov, 3, ESP_CACHE_MSYNC_FLAG_UNALIGNED | ESP_CACHE_MSYNC_FLAG_DIR_M2C) == ESP_ERR_INVALID_ARG);
+}
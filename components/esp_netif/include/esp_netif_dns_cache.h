@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "esp_err.h"
+#include "esp_netif_ip_addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ESP_NETIF_DNS_CACHE ESP-NETIF DNS cache API
+ * @brief DNS cache with background A/AAAA resolution (CONFIG_ESP_NETIF_DNS_CACHE)
+ *
+ * The cache is consulted transparently from lwip's netconn resolve hook, so
+ * getaddrinfo() and everything built on top of it (tcp_transport, esp-tls,
+ * MQTT, HTTP clients) hit it without code changes. The functions below are
+ * only needed to warm or inspect the cache explicitly.
+ */
+
+/** @addtogroup ESP_NETIF_DNS_CACHE
+ * @{
+ */
+
+/**
+ * @brief Resolve a hostname in the background and store the result in the cache
+ *
+ * Queues parallel A and AAAA queries on the lwip core thread and returns
+ * immediately; the results are inserted into the cache (and NVS, if
+ * persistence is enabled) as they arrive. Call this ahead of connect - e.g.
+ * when a broker URI is configured - so the later blocking resolution inside
+ * the connect path becomes a cache hit.
+ *
+ * @param[in] hostname  Hostname to resolve (not an IP literal)
+ *
+ * @return
+ *   - ESP_OK on success (queries queued, or hostname already cached)
+ *   - ESP_ERR_INVALID_ARG on null/overlong hostname
+ *   - ESP_ERR_NO_MEM if the query context could not be allocated or queued
+ */
+esp_err_t esp_netif_dns_prefetch(const char *hostname);
+
+/**
+ * @brief Look up a hostname in the cache without triggering resolution
+ *
+ * @param[in]  hostname  Hostname to look up
+ * @param[out] addr      Cached address (IPv4 preferred when both are cached)
+ *
+ * @return
+ *   - ESP_OK on a fresh cache hit
+ *   - ESP_ERR_NOT_FOUND if the hostname is not cached or the entry expired
+ *   - ESP_ERR_INVALID_ARG on null arguments
+ */
+esp_err_t esp_netif_dns_cache_lookup(const char *hostname, esp_ip_addr_t *addr);
+
+/**
+ * @brief Drop all cache entries, including the copies persisted in NVS
+ *
+ * @return
+ *   - ESP_OK on success
+ */
+esp_err_t esp_netif_dns_cache_clear(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
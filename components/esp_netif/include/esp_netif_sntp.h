@@ -131,6 +131,24 @@ esp_err_t esp_netif_sntp_sync_wait(TickType_t tout);
  */
 esp_err_t esp_netif_sntp_reachability(unsigned int index, unsigned int *reachability);
 
+/**
+ * @brief Start a burst of rapid SNTP exchanges and apply the best-RTT sample
+ *
+ * Use esp_netif_sntp_sync_wait() to wait for the burst result; the sync
+ * callback and NETIF_SNTP_TIME_SYNC event fire once, for the applied sample.
+ * Designed for sleep-cycle nodes that keep the radio up just for time sync:
+ * a burst reaches a tighter result than a single exchange in a fraction of
+ * the default poll window, and the skew estimate it maintains (see
+ * esp_sntp_get_clock_skew()) survives deep sleep.
+ *
+ * @param exchanges Number of exchanges to run (must be non-zero)
+ * @return ESP_OK on success,
+ *         ESP_ERR_INVALID_STATE if SNTP not initialized, not in immediate
+ *         sync mode, or a burst is already running
+ *         ESP_ERR_INVALID_ARG if exchanges is zero
+ */
+esp_err_t esp_netif_sntp_start_burst(size_t exchanges);
+
 #ifdef __cplusplus
 }
 #endif
@@ -218,6 +218,10 @@ typedef enum esp_netif_flags {
     ESP_NETIF_FLAG_IS_BRIDGE = 1 << 6,
     ESP_NETIF_FLAG_MLDV6_REPORT = 1 << 7,
     ESP_NETIF_FLAG_IPV6_AUTOCONFIG_ENABLED = 1 << 8,
+    ESP_NETIF_FLAG_ZERO_COPY_RX = 1 << 9, /*!< Wrap driver RX buffers in reference pbufs instead of copying
+                                               them into the TCP/IP stack, even if CONFIG_LWIP_L2_TO_L3_COPY
+                                               is enabled globally. The driver buffer is returned via
+                                               esp_netif_free_rx_buffer() once lwip releases the pbuf */
 } esp_netif_flags_t;
 
 typedef enum esp_netif_ip_event_type {
@@ -0,0 +1,473 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <inttypes.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_netif.h"
+#include "esp_netif_dns_cache.h"
+
+#include "lwip/api.h"
+#include "lwip/dns.h"
+#include "lwip/tcpip.h"
+#include "lwip/ip_addr.h"
+
+#if CONFIG_ESP_NETIF_DNS_CACHE_NVS
+#include "nvs.h"
+#endif
+
+static const char *TAG = "esp_netif_dns_cache";
+
+#define DNS_CACHE_HOSTNAME_MAX  64
+#define DNS_CACHE_TTL_S         CONFIG_ESP_NETIF_DNS_CACHE_TTL
+
+/* Rough "is the wall clock synchronized" check: anything before this epoch
+ * (Sep 2020) means SNTP has not run yet and absolute expiries are unusable */
+#define DNS_CACHE_TIME_SYNCED(t) ((t) > 1600000000LL)
+
+typedef enum {
+    DNS_CACHE_FAMILY_V4 = 0,
+#if LWIP_IPV6
+    DNS_CACHE_FAMILY_V6,
+#endif
+    DNS_CACHE_FAMILY_MAX,
+} dns_cache_family_t;
+
+typedef struct {
+    char name[DNS_CACHE_HOSTNAME_MAX];
+    ip_addr_t addr[DNS_CACHE_FAMILY_MAX];
+    bool valid[DNS_CACHE_FAMILY_MAX];
+    int64_t expiry;             // unix time, via time(NULL)
+    bool used;
+#if CONFIG_ESP_NETIF_DNS_CACHE_NVS
+    bool dirty;                 // needs to be flushed to NVS from a task context
+#endif
+} dns_cache_entry_t;
+
+/* Context of one parallel A/AAAA resolution. Allocated by the requesting
+ * task; `outstanding` and the results are only touched from the lwip core
+ * thread until the concluding semaphore give (or free, for detached
+ * prefetch contexts), so no extra locking is needed. */
+typedef struct {
+    char name[DNS_CACHE_HOSTNAME_MAX];
+    SemaphoreHandle_t done;     // NULL for detached (prefetch) queries
+    int outstanding;            // queries still waiting for their callback
+} dns_query_ctx_t;
+
+static dns_cache_entry_t s_cache[CONFIG_ESP_NETIF_DNS_CACHE_SIZE];
+static SemaphoreHandle_t s_lock;
+static StaticSemaphore_t s_lock_buf;
+
+#if CONFIG_ESP_NETIF_DNS_CACHE_NVS
+#define DNS_CACHE_NVS_NAMESPACE "esp_dns_cache"
+
+/* Layout of one persisted entry. Keys are derived from a hostname hash
+ * because NVS keys are limited to 15 characters. */
+typedef struct {
+    char name[DNS_CACHE_HOSTNAME_MAX];
+    ip_addr_t addr[DNS_CACHE_FAMILY_MAX];
+    uint8_t valid[DNS_CACHE_FAMILY_MAX];
+    int64_t expiry;
+} dns_cache_nvs_blob_t;
+
+static bool s_nvs_loaded;
+#endif
+
+/* The mutex must exist before the first resolve, which can happen from any
+ * task as soon as lwip is up; constructors run before the scheduler starts */
+__attribute__((constructor))
+static void dns_cache_module_init(void)
+{
+    s_lock = xSemaphoreCreateMutexStatic(&s_lock_buf);
+}
+
+#if CONFIG_ESP_NETIF_DNS_CACHE_NVS
+static uint32_t dns_cache_name_hash(const char *name)
+{
+    uint32_t hash = 2166136261U;    // FNV-1a
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static void dns_cache_nvs_key(const char *name, char *key, size_t key_size)
+{
+    snprintf(key, key_size, "h%08" PRIx32, dns_cache_name_hash(name));
+}
+
+/* Write back entries resolved on the lwip core thread. Called with s_lock
+ * held, always from a task context so the flash wait never stalls lwip */
+static void dns_cache_nvs_flush(void)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(DNS_CACHE_NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+        return;
+    }
+    for (int i = 0; i < CONFIG_ESP_NETIF_DNS_CACHE_SIZE; i++) {
+        if (!s_cache[i].used || !s_cache[i].dirty) {
+            continue;
+        }
+        dns_cache_nvs_blob_t blob = { .expiry = s_cache[i].expiry };
+        strlcpy(blob.name, s_cache[i].name, sizeof(blob.name));
+        for (int f = 0; f < DNS_CACHE_FAMILY_MAX; f++) {
+            blob.addr[f] = s_cache[i].addr[f];
+            blob.valid[f] = s_cache[i].valid[f];
+        }
+        char key[16];
+        dns_cache_nvs_key(s_cache[i].name, key, sizeof(key));
+        if (nvs_set_blob(nvs, key, &blob, sizeof(blob)) == ESP_OK) {
+            s_cache[i].dirty = false;
+        }
+    }
+    nvs_commit(nvs);
+    nvs_close(nvs);
+}
+
+/* One-shot restore of persisted entries, attempted until NVS is available.
+ * Called with s_lock held from a task context */
+static void dns_cache_nvs_load(void)
+{
+    if (s_nvs_loaded) {
+        return;
+    }
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(DNS_CACHE_NVS_NAMESPACE, NVS_READONLY, &nvs);
+    if (err == ESP_ERR_NVS_NOT_INITIALIZED) {
+        return;     // try again on the next resolve
+    }
+    s_nvs_loaded = true;
+    if (err != ESP_OK) {
+        return;     // namespace does not exist yet - nothing persisted
+    }
+
+    int64_t now = (int64_t)time(NULL);
+    int slot = 0;
+    nvs_iterator_t it = NULL;
+    err = nvs_entry_find(NVS_DEFAULT_PART_NAME, DNS_CACHE_NVS_NAMESPACE, NVS_TYPE_BLOB, &it);
+    while (err == ESP_OK && slot < CONFIG_ESP_NETIF_DNS_CACHE_SIZE) {
+        nvs_entry_info_t info;
+        nvs_entry_info(it, &info);
+        dns_cache_nvs_blob_t blob;
+        size_t len = sizeof(blob);
+        if (nvs_get_blob(nvs, info.key, &blob, &len) == ESP_OK && len == sizeof(blob)) {
+            blob.name[sizeof(blob.name) - 1] = '\0';
+            if (DNS_CACHE_TIME_SYNCED(now) && blob.expiry <= now) {
+                err = nvs_entry_next(&it);
+                continue;   // stale, skip (cleaned up on next flush/clear)
+            }
+            dns_cache_entry_t *entry = &s_cache[slot++];
+            strlcpy(entry->name, blob.name, sizeof(entry->name));
+            for (int f = 0; f < DNS_CACHE_FAMILY_MAX; f++) {
+                entry->addr[f] = blob.addr[f];
+                entry->valid[f] = blob.valid[f];
+            }
+            /* Without a synchronized clock the stored expiry can't be
+             * honored - grant one lifetime to cover the first connect */
+            entry->expiry = DNS_CACHE_TIME_SYNCED(now) ? blob.expiry : now + DNS_CACHE_TTL_S;
+            entry->used = true;
+            ESP_LOGD(TAG, "restored \"%s\" from NVS", entry->name);
+        }
+        err = nvs_entry_next(&it);
+    }
+    nvs_release_iterator(it);
+    nvs_close(nvs);
+}
+#endif // CONFIG_ESP_NETIF_DNS_CACHE_NVS
+
+/* Find a fresh entry by name. Called with s_lock held */
+static dns_cache_entry_t *dns_cache_find(const char *name)
+{
+    int64_t now = (int64_t)time(NULL);
+    for (int i = 0; i < CONFIG_ESP_NETIF_DNS_CACHE_SIZE; i++) {
+        if (s_cache[i].used && strcmp(s_cache[i].name, name) == 0) {
+            if (s_cache[i].expiry <= now) {
+                s_cache[i].used = false;
+                return NULL;
+            }
+            return &s_cache[i];
+        }
+    }
+    return NULL;
+}
+
+/* Insert or refresh an address. Runs on the lwip core thread (resolver
+ * callbacks), so it only updates RAM; persistence happens via the dirty
+ * flag from the requesting task */
+static void dns_cache_insert(const char *name, const ip_addr_t *addr)
+{
+    dns_cache_family_t family = DNS_CACHE_FAMILY_V4;
+#if LWIP_IPV6
+    if (IP_IS_V6(addr)) {
+        family = DNS_CACHE_FAMILY_V6;
+    }
+#endif
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    dns_cache_entry_t *entry = dns_cache_find(name);
+    if (entry == NULL) {
+        /* Take a free slot, or evict the entry closest to expiry */
+        dns_cache_entry_t *victim = &s_cache[0];
+        for (int i = 0; i < CONFIG_ESP_NETIF_DNS_CACHE_SIZE; i++) {
+            if (!s_cache[i].used) {
+                victim = &s_cache[i];
+                break;
+            }
+            if (s_cache[i].expiry < victim->expiry) {
+                victim = &s_cache[i];
+            }
+        }
+        memset(victim, 0, sizeof(*victim));
+        strlcpy(victim->name, name, sizeof(victim->name));
+        victim->used = true;
+        entry = victim;
+    }
+    entry->addr[family] = *addr;
+    entry->valid[family] = true;
+    entry->expiry = (int64_t)time(NULL) + DNS_CACHE_TTL_S;
+#if CONFIG_ESP_NETIF_DNS_CACHE_NVS
+    entry->dirty = true;
+#endif
+    xSemaphoreGive(s_lock);
+}
+
+/* Resolver callback, runs on the lwip core thread for both the A and the
+ * AAAA query of one context */
+static void dns_query_found_cb(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+    dns_query_ctx_t *ctx = (dns_query_ctx_t *)arg;
+    if (ipaddr != NULL) {
+        dns_cache_insert(name, ipaddr);
+    }
+    if (--ctx->outstanding == 0) {
+        if (ctx->done) {
+            xSemaphoreGive(ctx->done);
+        } else {
+            free(ctx);      // detached prefetch, nobody is waiting
+        }
+    }
+}
+
+/* Issues the A and AAAA queries back to back; runs on the lwip core thread
+ * so both are in flight before the first response can arrive */
+static void dns_query_start(void *arg)
+{
+    dns_query_ctx_t *ctx = (dns_query_ctx_t *)arg;
+    ip_addr_t addr;
+    int started = 0;
+
+    err_t err = dns_gethostbyname_addrtype(ctx->name, &addr, dns_query_found_cb, ctx,
+                                           LWIP_DNS_ADDRTYPE_IPV4);
+    if (err == ERR_OK) {
+        dns_cache_insert(ctx->name, &addr);
+    } else if (err == ERR_INPROGRESS) {
+        started++;
+    }
+#if LWIP_IPV6
+    err = dns_gethostbyname_addrtype(ctx->name, &addr, dns_query_found_cb, ctx,
+                                     LWIP_DNS_ADDRTYPE_IPV6);
+    if (err == ERR_OK) {
+        dns_cache_insert(ctx->name, &addr);
+    } else if (err == ERR_INPROGRESS) {
+        started++;
+    }
+#endif
+    ctx->outstanding = started;
+    if (started == 0) {
+        if (ctx->done) {
+            xSemaphoreGive(ctx->done);
+        } else {
+            free(ctx);
+        }
+    }
+}
+
+/* Resolve via parallel A/AAAA queries and fill the cache. When `wait` is
+ * set, blocks until both queries have concluded (lwip's resolver always
+ * calls back, worst case after its own retry timeout) */
+static esp_err_t dns_cache_resolve(const char *name, bool wait)
+{
+    dns_query_ctx_t *ctx = calloc(1, sizeof(dns_query_ctx_t));
+    if (ctx == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    strlcpy(ctx->name, name, sizeof(ctx->name));
+    if (wait) {
+        ctx->done = xSemaphoreCreateBinary();
+        if (ctx->done == NULL) {
+            free(ctx);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (tcpip_callback(dns_query_start, ctx) != ERR_OK) {
+        if (ctx->done) {
+            vSemaphoreDelete(ctx->done);
+        }
+        free(ctx);
+        return ESP_ERR_NO_MEM;
+    }
+    if (wait) {
+        xSemaphoreTake(ctx->done, portMAX_DELAY);
+        vSemaphoreDelete(ctx->done);
+        free(ctx);
+    }
+    return ESP_OK;
+}
+
+/* Common task-context entry: restore persisted entries once NVS is up and
+ * write back entries resolved since the last call */
+static void dns_cache_task_maintenance(void)
+{
+#if CONFIG_ESP_NETIF_DNS_CACHE_NVS
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    dns_cache_nvs_load();
+    dns_cache_nvs_flush();
+    xSemaphoreGive(s_lock);
+#endif
+}
+
+/* Copy a cached address matching the netconn address type preference.
+ * Called with s_lock held */
+static bool dns_cache_pick_addr(const dns_cache_entry_t *entry, u8_t addrtype, ip_addr_t *addr)
+{
+#if LWIP_IPV6
+    bool prefer_v6 = (addrtype == NETCONN_DNS_IPV6) || (addrtype == NETCONN_DNS_IPV6_IPV4);
+    bool allow_v4 = (addrtype != NETCONN_DNS_IPV6);
+    bool allow_v6 = (addrtype != NETCONN_DNS_IPV4);
+    if (prefer_v6 && allow_v6 && entry->valid[DNS_CACHE_FAMILY_V6]) {
+        *addr = entry->addr[DNS_CACHE_FAMILY_V6];
+        return true;
+    }
+    if (allow_v4 && entry->valid[DNS_CACHE_FAMILY_V4]) {
+        *addr = entry->addr[DNS_CACHE_FAMILY_V4];
+        return true;
+    }
+    if (allow_v6 && entry->valid[DNS_CACHE_FAMILY_V6]) {
+        *addr = entry->addr[DNS_CACHE_FAMILY_V6];
+        return true;
+    }
+#else
+    (void)addrtype;
+    if (entry->valid[DNS_CACHE_FAMILY_V4]) {
+        *addr = entry->addr[DNS_CACHE_FAMILY_V4];
+        return true;
+    }
+#endif
+    return false;
+}
+
+/* lwip calls this at the start of netconn_gethostbyname_addrtype(), in the
+ * context of the resolving task. Returning non-zero short-circuits lwip's
+ * own (sequential, per-family) resolution */
+int lwip_hook_netconn_external_resolve(const char *name, ip_addr_t *addr, u8_t addrtype, err_t *err)
+{
+    if (name == NULL || addr == NULL || err == NULL) {
+        return 0;
+    }
+    if (strlen(name) >= DNS_CACHE_HOSTNAME_MAX) {
+        return 0;   // too long to cache, let lwip handle it
+    }
+    if (ipaddr_aton(name, addr)) {
+        return 0;   // IP literal, lwip handles the addrtype checks
+    }
+
+    dns_cache_task_maintenance();
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    dns_cache_entry_t *entry = dns_cache_find(name);
+    bool hit = entry && dns_cache_pick_addr(entry, addrtype, addr);
+    xSemaphoreGive(s_lock);
+    if (hit) {
+        ESP_LOGD(TAG, "cache hit for \"%s\"", name);
+        *err = ERR_OK;
+        return 1;
+    }
+
+    /* Miss: do the real resolution here, with A and AAAA in parallel, so
+     * the answer (both families) lands in the cache for the next connect */
+    if (dns_cache_resolve(name, true) != ESP_OK) {
+        return 0;   // out of memory - fall back to lwip's resolver
+    }
+#if CONFIG_ESP_NETIF_DNS_CACHE_NVS
+    dns_cache_task_maintenance();
+#endif
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    entry = dns_cache_find(name);
+    hit = entry && dns_cache_pick_addr(entry, addrtype, addr);
+    xSemaphoreGive(s_lock);
+    if (hit) {
+        *err = ERR_OK;
+    } else {
+        *err = ERR_VAL;     // resolver concluded without an answer
+    }
+    return 1;
+}
+
+esp_err_t esp_netif_dns_prefetch(const char *hostname)
+{
+    if (hostname == NULL || strlen(hostname) >= DNS_CACHE_HOSTNAME_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    dns_cache_task_maintenance();
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool fresh = dns_cache_find(hostname) != NULL;
+    xSemaphoreGive(s_lock);
+    if (fresh) {
+        return ESP_OK;
+    }
+    return dns_cache_resolve(hostname, false);
+}
+
+esp_err_t esp_netif_dns_cache_lookup(const char *hostname, esp_ip_addr_t *addr)
+{
+    if (hostname == NULL || addr == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    ip_addr_t lwip_addr;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    dns_cache_entry_t *entry = dns_cache_find(hostname);
+#if LWIP_IPV6
+    bool hit = entry && dns_cache_pick_addr(entry, NETCONN_DNS_IPV4_IPV6, &lwip_addr);
+#else
+    bool hit = entry && dns_cache_pick_addr(entry, NETCONN_DNS_IPV4, &lwip_addr);
+#endif
+    xSemaphoreGive(s_lock);
+    if (!hit) {
+        return ESP_ERR_NOT_FOUND;
+    }
+#if LWIP_IPV6
+    if (IP_IS_V6(&lwip_addr)) {
+        memcpy(addr->u_addr.ip6.addr, ip_2_ip6(&lwip_addr)->addr, sizeof(addr->u_addr.ip6.addr));
+        addr->type = ESP_IPADDR_TYPE_V6;
+        return ESP_OK;
+    }
+#endif
+    addr->u_addr.ip4.addr = ip_2_ip4(&lwip_addr)->addr;
+    addr->type = ESP_IPADDR_TYPE_V4;
+    return ESP_OK;
+}
+
+esp_err_t esp_netif_dns_cache_clear(void)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    memset(s_cache, 0, sizeof(s_cache));
+#if CONFIG_ESP_NETIF_DNS_CACHE_NVS
+    nvs_handle_t nvs;
+    if (nvs_open(DNS_CACHE_NVS_NAMESPACE, NVS_READWRITE, &nvs) == ESP_OK) {
+        nvs_erase_all(nvs);
+        nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+#endif
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
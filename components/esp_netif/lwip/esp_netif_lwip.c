@@ -58,6 +58,12 @@
 #if IP_NAPT
 #include "lwip/lwip_napt.h"
 #endif
+#if CONFIG_ESP_NETIF_RX_STEERING
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "lwip/prot/ethernet.h"
+#include "lwip/prot/iana.h"
+#endif
 
 
 //
@@ -66,6 +72,10 @@
 
 #define ESP_NETIF_HOSTNAME_MAX_SIZE    32
 
+#if CONFIG_ESP_NETIF_RX_STEERING
+static esp_err_t esp_netif_rx_steering_init(void);
+#endif
+
 #define DHCP_CB_CHANGE (LWIP_NSC_IPV4_SETTINGS_CHANGED | LWIP_NSC_IPV4_ADDRESS_CHANGED | LWIP_NSC_IPV4_GATEWAY_CHANGED | LWIP_NSC_IPV4_NETMASK_CHANGED)
 
 /**
@@ -603,6 +613,14 @@ esp_err_t esp_netif_init(void)
     }
 #endif
 
+#if CONFIG_ESP_NETIF_RX_STEERING
+    esp_err_t steering_err = esp_netif_rx_steering_init();
+    if (steering_err != ESP_OK) {
+        ESP_LOGE(TAG, "esp netif rx steering init fail");
+        return steering_err;
+    }
+#endif
+
     ESP_LOGD(TAG, "esp-netif has been successfully initialized");
     return ESP_OK;
 }
@@ -1070,6 +1088,20 @@ static esp_err_t esp_netif_destroy_api(esp_netif_api_msg_t *msg)
         netif_remove_ext_callback(&netif_callback);
         netif_callback.callback_fn = NULL;
     }
+#ifdef CONFIG_ESP_NETIF_TX_BATCHING
+    if (esp_netif->tx_batch_lock) {
+        esp_timer_stop(esp_netif->tx_batch_timer);
+        esp_timer_delete(esp_netif->tx_batch_timer);
+        // the interface is going away, discard held frames instead of sending them
+        xSemaphoreTake(esp_netif->tx_batch_lock, portMAX_DELAY);
+        for (size_t i = 0; i < esp_netif->tx_batch_count; i++) {
+            pbuf_free((struct pbuf *)esp_netif->tx_batch[i].pbuf);
+        }
+        esp_netif->tx_batch_count = 0;
+        xSemaphoreGive(esp_netif->tx_batch_lock);
+        vSemaphoreDelete(esp_netif->tx_batch_lock);
+    }
+#endif
     free(esp_netif->ip_info);
     free(esp_netif->ip_info_old);
     free(esp_netif->if_key);
@@ -1433,6 +1465,68 @@ esp_err_t esp_netif_transmit(esp_netif_t *esp_netif, void* data, size_t len)
     return (esp_netif->driver_transmit)(esp_netif->driver_handle, data, len);
 }
 
+#ifdef CONFIG_ESP_NETIF_TX_BATCHING
+
+// Submits all held frames to the driver and drops the pbuf references taken on
+// enqueue. Called with tx_batch_lock held. Returns the first driver error, if any.
+static esp_err_t esp_netif_tx_batch_flush(esp_netif_t *esp_netif)
+{
+    esp_err_t ret = ESP_OK;
+    for (size_t i = 0; i < esp_netif->tx_batch_count; i++) {
+        esp_err_t err = (esp_netif->driver_transmit_wrap)(esp_netif->driver_handle,
+                                                          esp_netif->tx_batch[i].data,
+                                                          esp_netif->tx_batch[i].len,
+                                                          esp_netif->tx_batch[i].pbuf);
+        if (err != ESP_OK) {
+            ESP_LOGD(TAG, "Batched transmit failed with %d", err);
+            if (ret == ESP_OK) {
+                ret = err;
+            }
+        }
+        pbuf_free((struct pbuf *)esp_netif->tx_batch[i].pbuf);
+    }
+    esp_netif->tx_batch_count = 0;
+    return ret;
+}
+
+static void esp_netif_tx_batch_timeout(void *arg)
+{
+    esp_netif_t *esp_netif = arg;
+    xSemaphoreTake(esp_netif->tx_batch_lock, portMAX_DELAY);
+    esp_netif_tx_batch_flush(esp_netif);
+    xSemaphoreGive(esp_netif->tx_batch_lock);
+}
+
+// Lazily creates the batch lock and hold timer; only netifs that actually
+// transmit over the pbuf-aware path pay for them. Runs in tcpip context, so
+// concurrent first calls cannot happen. Returns false if creation failed,
+// in which case the caller transmits directly.
+static bool esp_netif_tx_batch_ready(esp_netif_t *esp_netif)
+{
+    if (esp_netif->tx_batch_lock != NULL) {
+        return true;
+    }
+    esp_netif->tx_batch_lock = xSemaphoreCreateMutex();
+    if (esp_netif->tx_batch_lock == NULL) {
+        return false;
+    }
+    const esp_timer_create_args_t timer_args = {
+        .callback = esp_netif_tx_batch_timeout,
+        .arg = esp_netif,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "netif_tx_batch",
+        .skip_unhandled_events = true,
+    };
+    if (esp_timer_create(&timer_args, &esp_netif->tx_batch_timer) != ESP_OK) {
+        vSemaphoreDelete(esp_netif->tx_batch_lock);
+        esp_netif->tx_batch_lock = NULL;
+        return false;
+    }
+    return true;
+}
+
+#endif // CONFIG_ESP_NETIF_TX_BATCHING
+
 esp_err_t esp_netif_transmit_wrap(esp_netif_t *esp_netif, void *data, size_t len, void *pbuf)
 {
 #ifdef CONFIG_ESP_NETIF_REPORT_DATA_TRAFFIC
@@ -1444,10 +1538,114 @@ esp_err_t esp_netif_transmit_wrap(esp_netif_t *esp_netif, void *data, size_t len
         };
         esp_event_post(IP_EVENT, IP_EVENT_TX_RX, &evt, sizeof(evt), 0);
     }
+#endif
+#ifdef CONFIG_ESP_NETIF_TX_BATCHING
+    if (pbuf != NULL && esp_netif_tx_batch_ready(esp_netif)) {
+        esp_err_t ret = ESP_OK;
+        xSemaphoreTake(esp_netif->tx_batch_lock, portMAX_DELAY);
+        // keep the frame data alive while it sits in the batch
+        pbuf_ref((struct pbuf *)pbuf);
+        esp_netif->tx_batch[esp_netif->tx_batch_count].data = data;
+        esp_netif->tx_batch[esp_netif->tx_batch_count].len = len;
+        esp_netif->tx_batch[esp_netif->tx_batch_count].pbuf = pbuf;
+        esp_netif->tx_batch_count++;
+        if (esp_netif->tx_batch_count == CONFIG_ESP_NETIF_TX_BATCH_SIZE) {
+            esp_timer_stop(esp_netif->tx_batch_timer);
+            ret = esp_netif_tx_batch_flush(esp_netif);
+        } else if (esp_netif->tx_batch_count == 1) {
+            esp_timer_start_once(esp_netif->tx_batch_timer, CONFIG_ESP_NETIF_TX_BATCH_HOLD_US);
+        }
+        xSemaphoreGive(esp_netif->tx_batch_lock);
+        return ret;
+    }
 #endif
     return (esp_netif->driver_transmit_wrap)(esp_netif->driver_handle, data, len, pbuf);
 }
 
+#if CONFIG_ESP_NETIF_RX_STEERING
+typedef struct {
+    esp_netif_t *esp_netif;
+    void *buffer;
+    size_t len;
+    void *eb;
+} esp_netif_rx_steering_item_t;
+
+static QueueHandle_t s_rx_steering_queues[CONFIG_ESP_NETIF_RX_STEERING_WORKERS];
+
+static void esp_netif_rx_steering_task(void *arg)
+{
+    QueueHandle_t queue = (QueueHandle_t)arg;
+    esp_netif_rx_steering_item_t item;
+    while (true) {
+        if (xQueueReceive(queue, &item, portMAX_DELAY) == pdTRUE) {
+            item.esp_netif->lwip_input_fn(item.esp_netif->netif_handle, item.buffer, item.len, item.eb);
+        }
+    }
+}
+
+// Returns the worker index for frames eligible for steering (UDP and raw IP
+// flows), or -1 for frames which have to take the direct path: TCP, since lwIP
+// keeps its connection state on the tcpip thread only, and non-IP control
+// traffic such as ARP.
+static int esp_netif_rx_steering_classify(const uint8_t *frame, size_t len)
+{
+    if (len < 34) { // Ethernet header plus minimal IPv4 header
+        return -1;
+    }
+    uint32_t hash;
+    uint16_t ethertype = (frame[12] << 8) | frame[13];
+    if (ethertype == ETHTYPE_IP) {
+        uint8_t proto = frame[23];
+        if (proto == IP_PROTO_TCP) {
+            return -1;
+        }
+        size_t l4 = 14 + (frame[14] & 0x0f) * 4;
+        hash = proto ^ ((frame[26] ^ frame[30]) << 8) ^ frame[29] ^ frame[33];
+        if (proto == IP_PROTO_UDP && len >= l4 + 4) {
+            hash ^= ((frame[l4] ^ frame[l4 + 2]) << 8) | (frame[l4 + 1] ^ frame[l4 + 3]);
+        }
+    } else if (ethertype == ETHTYPE_IPV6) {
+        if (len < 54) { // Ethernet header plus IPv6 header
+            return -1;
+        }
+        uint8_t proto = frame[20];
+        if (proto == IP_PROTO_TCP) {
+            return -1;
+        }
+        // fold in the low bytes of source and destination address
+        hash = proto ^ (frame[37] << 8) ^ frame[53];
+        if (proto == IP_PROTO_UDP && len >= 58) {
+            hash ^= ((frame[54] ^ frame[56]) << 8) | (frame[55] ^ frame[57]);
+        }
+    } else {
+        return -1;
+    }
+    return hash % CONFIG_ESP_NETIF_RX_STEERING_WORKERS;
+}
+
+static esp_err_t esp_netif_rx_steering_init(void)
+{
+    for (int i = 0; i < CONFIG_ESP_NETIF_RX_STEERING_WORKERS; i++) {
+        if (s_rx_steering_queues[i] != NULL) {
+            continue;
+        }
+        QueueHandle_t queue = xQueueCreate(CONFIG_ESP_NETIF_RX_STEERING_QUEUE_SIZE,
+                                           sizeof(esp_netif_rx_steering_item_t));
+        if (queue == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        BaseType_t core = (i + 1) % CONFIG_FREERTOS_NUMBER_OF_CORES;
+        if (xTaskCreatePinnedToCore(esp_netif_rx_steering_task, "netif_rx_steer", 3072, queue,
+                                    CONFIG_ESP_NETIF_RX_STEERING_TASK_PRIORITY, NULL, core) != pdPASS) {
+            vQueueDelete(queue);
+            return ESP_ERR_NO_MEM;
+        }
+        s_rx_steering_queues[i] = queue;
+    }
+    return ESP_OK;
+}
+#endif // CONFIG_ESP_NETIF_RX_STEERING
+
 esp_err_t esp_netif_receive(esp_netif_t *esp_netif, void *buffer, size_t len, void *eb)
 {
 #ifdef CONFIG_ESP_NETIF_REPORT_DATA_TRAFFIC
@@ -1459,6 +1657,24 @@ esp_err_t esp_netif_receive(esp_netif_t *esp_netif, void *buffer, size_t len, vo
         };
         esp_event_post(IP_EVENT, IP_EVENT_TX_RX, &evt, sizeof(evt), 0);
     }
+#endif
+#if CONFIG_ESP_NETIF_RX_STEERING
+    struct netif *netif = esp_netif->netif_handle;
+    if (netif != NULL && (netif->flags & NETIF_FLAG_ETHARP)) {
+        int worker = esp_netif_rx_steering_classify(buffer, len);
+        if (worker >= 0 && s_rx_steering_queues[worker] != NULL) {
+            esp_netif_rx_steering_item_t item = {
+                .esp_netif = esp_netif,
+                .buffer = buffer,
+                .len = len,
+                .eb = eb,
+            };
+            if (xQueueSend(s_rx_steering_queues[worker], &item, 0) == pdTRUE) {
+                return ESP_OK;
+            }
+            // queue full: handle the frame in place, as without steering
+        }
+    }
 #endif
     return esp_netif->lwip_input_fn(esp_netif->netif_handle, buffer, len, eb);
 }
@@ -13,6 +13,11 @@
 #ifdef CONFIG_LWIP_DHCPS
 #include "dhcpserver/dhcpserver.h"
 #endif
+#ifdef CONFIG_ESP_NETIF_TX_BATCHING
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#endif
 
 struct esp_netif_api_msg_s;
 
@@ -103,6 +108,17 @@ struct esp_netif_obj {
 #ifdef CONFIG_ESP_NETIF_REPORT_DATA_TRAFFIC
     bool tx_rx_events_enabled;
 #endif
+#ifdef CONFIG_ESP_NETIF_TX_BATCHING
+    // TX micro-batching over the pbuf-aware driver path (esp_netif_transmit_wrap)
+    struct {
+        void *data;
+        size_t len;
+        void *pbuf;     // referenced while held, freed after submission
+    } tx_batch[CONFIG_ESP_NETIF_TX_BATCH_SIZE];
+    size_t tx_batch_count;
+    SemaphoreHandle_t tx_batch_lock;
+    esp_timer_handle_t tx_batch_timer;
+#endif
 
     // misc flags, types, keys, priority
     esp_netif_flags_t flags;
@@ -137,6 +137,7 @@ err:
 
 static esp_err_t sntp_stop_api(void *ctx)
 {
+    esp_sntp_stop_burst();
     sntp_stop();
     return ESP_OK;
 }
@@ -189,6 +190,17 @@ esp_err_t esp_netif_sntp_start(void)
     return esp_netif_tcpip_exec(sntp_start_api, NULL);
 }
 
+esp_err_t esp_netif_sntp_start_burst(size_t exchanges)
+{
+    if (s_storage == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (exchanges == 0 || exchanges > UINT8_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return esp_sntp_start_burst((uint8_t)exchanges);
+}
+
 esp_err_t esp_netif_sntp_reachability(unsigned int index, unsigned int *reachability)
 {
     if (index >= SNTP_MAX_SERVERS || reachability == NULL) {
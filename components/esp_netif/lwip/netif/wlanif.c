@@ -157,13 +157,24 @@ esp_err_t wlanif_input(void *h, void *buffer, size_t len, void* l2_buff)
     }
 
 #ifdef CONFIG_LWIP_L2_TO_L3_COPY
-    p = pbuf_alloc(PBUF_RAW, len, PBUF_RAM);
-    if (p == NULL) {
+    if (esp_netif_get_flags(esp_netif) & ESP_NETIF_FLAG_ZERO_COPY_RX) {
+        /* This interface opted out of the L2 to L3 copy: hand the driver
+         * buffer to lwip wrapped in a reference pbuf, it's freed back to
+         * the driver from the pbuf's custom free function */
+        p = esp_pbuf_allocate(esp_netif, buffer, len, l2_buff);
+        if (p == NULL) {
+            esp_netif_free_rx_buffer(esp_netif, l2_buff);
+            return ESP_ERR_NO_MEM;
+        }
+    } else {
+        p = pbuf_alloc(PBUF_RAW, len, PBUF_RAM);
+        if (p == NULL) {
+            esp_netif_free_rx_buffer(esp_netif, l2_buff);
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(p->payload, buffer, len);
         esp_netif_free_rx_buffer(esp_netif, l2_buff);
-        return ESP_ERR_NO_MEM;
     }
-    memcpy(p->payload, buffer, len);
-    esp_netif_free_rx_buffer(esp_netif, l2_buff);
 #else
     p = esp_pbuf_allocate(esp_netif, buffer, len, l2_buff);
     if (p == NULL) {
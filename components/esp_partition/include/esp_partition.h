@@ -243,6 +243,24 @@ const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_p
  */
 esp_err_t esp_partition_find_first_err(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label, const esp_partition_t** partition);
 
+/**
+ * @brief Load and verify the partition table eagerly
+ *
+ * The partition table is normally read from flash and verified on the first
+ * lookup. Calling this function early in the boot sequence (before NVS or OTA
+ * initialization) moves that one-time cost to a point of the application's
+ * choosing, so the first component to look up a partition does not pay it.
+ *
+ * Calling this function is optional; it is also safe to call it when the
+ * partition table has already been loaded.
+ *
+ * @return
+ *         - ESP_OK: partition table is loaded and verified
+ *         - ESP_ERR_NO_MEM: if memory allocation failed
+ *         - Other error codes from partition loading functions
+ */
+esp_err_t esp_partition_preload(void);
+
 /**
  * @brief Get esp_partition_t structure for given partition
  *
@@ -38,6 +38,12 @@
 #include "esp_private/partition_linux.h"
 #endif
 
+#if CONFIG_ESP_PARTITION_RTC_CACHE
+#include <stddef.h>
+#include "esp_rom_crc.h"
+#include "esp_system.h"
+#endif
+
 #ifndef CONFIG_IDF_TARGET_LINUX
 #define MMU_PAGE_SIZE CONFIG_MMU_PAGE_SIZE
 #else
@@ -71,6 +77,73 @@ static _lock_t s_partition_list_lock;
 
 ESP_LOG_ATTR_TAG(TAG, "partition");
 
+#if CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES > 0
+
+// Small round-robin cache of successful esp_partition_find_first() results,
+// keyed by the query. Partitions are looked up repeatedly with the same few
+// queries during boot (NVS, OTA data, VFS mounts), so repeated lookups are
+// served without walking the partition list.
+typedef struct {
+    const esp_partition_t *part;    // NULL means the slot is empty
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    bool any_label;                 // query had label == NULL
+    char label[sizeof(((esp_partition_t *) 0)->label)];
+} partition_lookup_cache_entry_t;
+
+static partition_lookup_cache_entry_t s_lookup_cache[CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES];
+static size_t s_lookup_cache_next;
+
+// Called with s_partition_list_lock taken, whenever a list item may go away
+static void lookup_cache_flush(void)
+{
+    memset(s_lookup_cache, 0, sizeof(s_lookup_cache));
+    s_lookup_cache_next = 0;
+}
+
+static const esp_partition_t *lookup_cache_get(esp_partition_type_t type,
+        esp_partition_subtype_t subtype, const char *label)
+{
+    const esp_partition_t *part = NULL;
+    _lock_acquire(&s_partition_list_lock);
+    for (size_t i = 0; i < CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES; i++) {
+        const partition_lookup_cache_entry_t *e = &s_lookup_cache[i];
+        if (e->part != NULL && e->type == type && e->subtype == subtype
+                && e->any_label == (label == NULL)
+                && (label == NULL || strcmp(e->label, label) == 0)) {
+            part = e->part;
+            break;
+        }
+    }
+    _lock_release(&s_partition_list_lock);
+    return part;
+}
+
+static void lookup_cache_put(esp_partition_type_t type,
+        esp_partition_subtype_t subtype, const char *label, const esp_partition_t *part)
+{
+    partition_lookup_cache_entry_t *e;
+    if (label != NULL && strlen(label) >= sizeof(e->label)) {
+        // over-long labels would be truncated and could alias a later query
+        return;
+    }
+    _lock_acquire(&s_partition_list_lock);
+    e = &s_lookup_cache[s_lookup_cache_next];
+    s_lookup_cache_next = (s_lookup_cache_next + 1) % CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES;
+    e->type = type;
+    e->subtype = subtype;
+    e->any_label = (label == NULL);
+    if (label != NULL) {
+        strlcpy(e->label, label, sizeof(e->label));
+    } else {
+        e->label[0] = '\0';
+    }
+    e->part = part;
+    _lock_release(&s_partition_list_lock);
+}
+
+#endif // CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES > 0
+
 static bool is_partition_encrypted(bool encryption_config, esp_partition_type_t type, esp_partition_subtype_t subtype)
 {
 #if CONFIG_IDF_TARGET_LINUX
@@ -101,6 +174,98 @@ static bool is_partition_encrypted(bool encryption_config, esp_partition_type_t
 #endif
 }
 
+// Allocate a list item and populate it from a partition table entry.
+static partition_list_item_t *partition_item_create(const esp_partition_info_t *entry)
+{
+    partition_list_item_t *item = (partition_list_item_t *) calloc(1, sizeof(partition_list_item_t));
+    if (item == NULL) {
+        return NULL;
+    }
+#if CONFIG_IDF_TARGET_LINUX
+    item->info.flash_chip = NULL;
+    item->info.erase_size = ESP_PARTITION_EMULATED_SECTOR_SIZE;
+#else
+    item->info.flash_chip = esp_flash_default_chip;
+    item->info.erase_size = SPI_FLASH_SEC_SIZE;
+#endif
+    item->info.address = entry->pos.offset;
+    item->info.size = entry->pos.size;
+    item->info.type = entry->type;
+    item->info.subtype = entry->subtype;
+    item->info.encrypted = is_partition_encrypted(entry->flags & PART_FLAG_ENCRYPTED, entry->type, entry->subtype);
+    item->info.readonly = entry->flags & PART_FLAG_READONLY;
+    item->user_registered = false;
+
+#if CONFIG_NVS_COMPATIBLE_PRE_V4_3_ENCRYPTION_FLAG
+    if (entry->type == ESP_PARTITION_TYPE_DATA &&
+            entry->subtype == ESP_PARTITION_SUBTYPE_DATA_NVS &&
+            (entry->flags & PART_FLAG_ENCRYPTED)) {
+        ESP_LOGI(TAG, "Ignoring encrypted flag for \"%s\" partition", entry->label);
+        item->info.encrypted = false;
+    }
+#endif
+    // item->info.label is initialized by calloc, so resulting string will be null terminated
+    strncpy(item->info.label, (const char *) entry->label, sizeof(item->info.label) - 1);
+    return item;
+}
+
+#if CONFIG_ESP_PARTITION_RTC_CACHE
+
+// Checksummed copy of the partition table kept across deep sleep so the wake
+// path can skip the table sector read and MD5 verification.
+typedef struct {
+    uint32_t count;
+    esp_partition_info_t entries[CONFIG_ESP_PARTITION_RTC_CACHE_MAX_ENTRIES];
+    uint32_t crc;   // CRC32 of count and entries, must stay the last field
+} partition_rtc_cache_t;
+
+static RTC_NOINIT_ATTR partition_rtc_cache_t s_rtc_cache;
+
+static uint32_t rtc_cache_crc(const partition_rtc_cache_t *cache)
+{
+    return esp_rom_crc32_le(UINT32_MAX, (const uint8_t *) cache, offsetof(partition_rtc_cache_t, crc));
+}
+
+// Try to rebuild the partition list from the RTC copy saved by the previous
+// boot. Called with s_partition_list_lock taken. Any failure means the caller
+// falls back to reading the table from flash.
+static esp_err_t load_partitions_from_rtc(void)
+{
+    if (esp_reset_reason() != ESP_RST_DEEPSLEEP) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_rtc_cache.count == 0 || s_rtc_cache.count > CONFIG_ESP_PARTITION_RTC_CACHE_MAX_ENTRIES
+            || s_rtc_cache.crc != rtc_cache_crc(&s_rtc_cache)) {
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    typeof(s_partition_list) new_partitions_list = SLIST_HEAD_INITIALIZER(s_partition_list);
+    partition_list_item_t *last = NULL;
+    for (uint32_t i = 0; i < s_rtc_cache.count; i++) {
+        partition_list_item_t *item = partition_item_create(&s_rtc_cache.entries[i]);
+        if (item == NULL) {
+            partition_list_item_t *it = new_partitions_list.slh_first;
+            while (it) {
+                partition_list_item_t *next = it->next.sle_next;
+                free(it);
+                it = next;
+            }
+            return ESP_ERR_NO_MEM;
+        }
+        if (last == NULL) {
+            SLIST_INSERT_HEAD(&new_partitions_list, item, next);
+        } else {
+            SLIST_INSERT_AFTER(last, item, next);
+        }
+        last = item;
+    }
+    ESP_LOGV(TAG, "Partition table restored from RTC memory (%" PRIu32 " entries)", s_rtc_cache.count);
+    s_partition_list = new_partitions_list;
+    return ESP_OK;
+}
+
+#endif // CONFIG_ESP_PARTITION_RTC_CACHE
+
 // Create linked list of partition_list_item_t structures.
 // This function is called only once, with s_partition_list_lock taken.
 static esp_err_t load_partitions(void)
@@ -124,6 +289,11 @@ static esp_err_t load_partitions(void)
     esp_rom_md5_init(&context);
 #endif
 
+#if CONFIG_ESP_PARTITION_RTC_CACHE
+    uint32_t rtc_entry_count = 0;
+    bool rtc_overflow = false;
+#endif
+
     uint32_t partition_align_pg_size = (ESP_PARTITION_TABLE_OFFSET) & ~(MMU_PAGE_SIZE - 1);
     uint32_t partition_pad = ESP_PARTITION_TABLE_OFFSET - partition_align_pg_size;
 
@@ -165,39 +335,19 @@ static esp_err_t load_partitions(void)
 #endif
 
         // allocate new linked list item and populate it with data from partition table
-        partition_list_item_t *item = (partition_list_item_t *) calloc(1, sizeof(partition_list_item_t));
+        partition_list_item_t *item = partition_item_create(&entry);
         if (item == NULL) {
             err = ESP_ERR_NO_MEM;
             break;
         }
-#if CONFIG_IDF_TARGET_LINUX
-        item->info.flash_chip = NULL;
-#else
-        item->info.flash_chip = esp_flash_default_chip;
-#endif
-        item->info.address = entry.pos.offset;
-        item->info.size = entry.pos.size;
-#if CONFIG_IDF_TARGET_LINUX
-        item->info.erase_size = ESP_PARTITION_EMULATED_SECTOR_SIZE;
-#else
-        item->info.erase_size = SPI_FLASH_SEC_SIZE;
-#endif
-        item->info.type = entry.type;
-        item->info.subtype = entry.subtype;
-        item->info.encrypted = is_partition_encrypted(entry.flags & PART_FLAG_ENCRYPTED, entry.type, entry.subtype);
-        item->info.readonly = entry.flags & PART_FLAG_READONLY;
-        item->user_registered = false;
 
-#if CONFIG_NVS_COMPATIBLE_PRE_V4_3_ENCRYPTION_FLAG
-        if (entry.type == ESP_PARTITION_TYPE_DATA &&
-                entry.subtype == ESP_PARTITION_SUBTYPE_DATA_NVS &&
-                (entry.flags & PART_FLAG_ENCRYPTED)) {
-            ESP_LOGI(TAG, "Ignoring encrypted flag for \"%s\" partition", entry.label);
-            item->info.encrypted = false;
+#if CONFIG_ESP_PARTITION_RTC_CACHE
+        if (rtc_entry_count < CONFIG_ESP_PARTITION_RTC_CACHE_MAX_ENTRIES) {
+            s_rtc_cache.entries[rtc_entry_count++] = entry;
+        } else {
+            rtc_overflow = true;
         }
 #endif
-        // item->info.label is initialized by calloc, so resulting string will be null terminated
-        strncpy(item->info.label, (const char *) entry.label, sizeof(item->info.label) - 1);
 
         // add it to the list
         if (last == NULL) {
@@ -233,6 +383,15 @@ static esp_err_t load_partitions(void)
     if (err == ESP_OK) {
         /* Don't copy the list to the static variable unless it's verified */
         s_partition_list = new_partitions_list;
+#if CONFIG_ESP_PARTITION_RTC_CACHE
+        if (!rtc_overflow && rtc_entry_count > 0) {
+            s_rtc_cache.count = rtc_entry_count;
+            s_rtc_cache.crc = rtc_cache_crc(&s_rtc_cache);
+        } else {
+            // table doesn't fit, make sure a stale copy is never restored
+            s_rtc_cache.count = 0;
+        }
+#endif
     } else {
         /* Otherwise, free all the memory we just allocated */
         partition_list_item_t *it = new_partitions_list.slh_first;
@@ -253,6 +412,9 @@ static esp_err_t load_partitions(void)
 void esp_partition_unload_all(void)
 {
     _lock_acquire(&s_partition_list_lock);
+#if CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES > 0
+    lookup_cache_flush();
+#endif
     partition_list_item_t *it;
     partition_list_item_t *tmp;
     SLIST_FOREACH_SAFE(it, &s_partition_list, next, tmp) {
@@ -273,7 +435,14 @@ static esp_err_t ensure_partitions_loaded(void)
         _lock_acquire(&s_partition_list_lock);
         if (SLIST_EMPTY(&s_partition_list)) {
             ESP_LOGV(TAG, "Loading the partition table");
+#if CONFIG_ESP_PARTITION_RTC_CACHE
+            err = load_partitions_from_rtc();
+            if (err != ESP_OK) {
+                err = load_partitions();
+            }
+#else
             err = load_partitions();
+#endif
             if (err != ESP_OK) {
                 ESP_LOGE(TAG, "load_partitions returned 0x%x", err);
             }
@@ -283,6 +452,11 @@ static esp_err_t ensure_partitions_loaded(void)
     return err;
 }
 
+esp_err_t esp_partition_preload(void)
+{
+    return ensure_partitions_loaded();
+}
+
 static esp_partition_iterator_opaque_t *iterator_create(esp_partition_type_t type,
         esp_partition_subtype_t subtype, const char *label)
 {
@@ -383,6 +557,13 @@ esp_err_t esp_partition_find_first_err(esp_partition_type_t type,
         return ESP_ERR_INVALID_ARG;
     }
 
+#if CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES > 0
+    *partition = lookup_cache_get(type, subtype, label);
+    if (*partition != NULL) {
+        return ESP_OK;
+    }
+#endif
+
     esp_partition_iterator_t it = NULL;
     esp_err_t err = esp_partition_find_err(type, subtype, label, &it);
     if (err != ESP_OK || it == NULL) {
@@ -394,6 +575,9 @@ esp_err_t esp_partition_find_first_err(esp_partition_type_t type,
     if (*partition == NULL) {
         return ESP_ERR_NOT_FOUND;
     }
+#if CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES > 0
+    lookup_cache_put(type, subtype, label, *partition);
+#endif
     return ESP_OK;
 }
 
@@ -547,6 +731,9 @@ esp_err_t esp_partition_deregister_external(const esp_partition_t *partition)
             }
             //remove the external partition record
             SLIST_REMOVE(&s_partition_list, it, partition_list_item_, next);
+#if CONFIG_ESP_PARTITION_LOOKUP_CACHE_ENTRIES > 0
+            lookup_cache_flush();
+#endif
             free(it);
             result = ESP_OK;
             break;
@@ -33,6 +33,11 @@
 #include "esp_rom_crc.h"
 #include "esp_rom_sys.h"
 
+#if CONFIG_ESP_PHY_RTC_CAL_CACHE
+#include "esp_attr.h"
+#include "esp_rtc_time.h"
+#endif
+
 #include "soc/rtc_periph.h"
 
 #if CONFIG_ESP_PHY_INIT_DATA_IN_PARTITION
@@ -841,6 +846,61 @@ static esp_err_t store_cal_data_to_nvs_handle(nvs_handle_t handle,
     return err;
 }
 
+#if CONFIG_ESP_PHY_RTC_CAL_CACHE
+/* Checksummed copy of the calibration data in RTC slow memory. Warm wakes
+ * validate it and skip the NVS read entirely; any mismatch (lost RTC power,
+ * different MAC, PHY version change, cache too old) falls back to the
+ * regular NVS path.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t crc;         // CRC32 over cal_data
+    uint64_t timestamp_us; // RTC time when the cache was filled
+    esp_phy_calibration_data_t cal_data;
+} phy_rtc_cal_cache_t;
+
+#define PHY_RTC_CAL_CACHE_MAGIC 0x50484343 // 'PHCC'
+
+static RTC_NOINIT_ATTR phy_rtc_cal_cache_t s_rtc_cal_cache;
+
+static bool phy_rtc_cal_cache_load(esp_phy_calibration_data_t* out_cal_data, const uint8_t* sta_mac)
+{
+    if (s_rtc_cal_cache.magic != PHY_RTC_CAL_CACHE_MAGIC) {
+        return false;
+    }
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*) &s_rtc_cal_cache.cal_data,
+                                    sizeof(s_rtc_cal_cache.cal_data));
+    if (crc != s_rtc_cal_cache.crc) {
+        ESP_LOGD(TAG, "RTC calibration cache checksum mismatch");
+        return false;
+    }
+    if (memcmp(s_rtc_cal_cache.cal_data.mac, sta_mac, 6) != 0) {
+        ESP_LOGD(TAG, "RTC calibration cache MAC mismatch");
+        return false;
+    }
+#if CONFIG_ESP_PHY_RTC_CAL_CACHE_MAX_AGE > 0
+    uint64_t now_us = esp_rtc_get_time_us();
+    if (now_us < s_rtc_cal_cache.timestamp_us ||
+            (now_us - s_rtc_cal_cache.timestamp_us) / 1000000 > CONFIG_ESP_PHY_RTC_CAL_CACHE_MAX_AGE) {
+        ESP_LOGD(TAG, "RTC calibration cache expired");
+        return false;
+    }
+#endif
+    memcpy(out_cal_data, &s_rtc_cal_cache.cal_data, sizeof(*out_cal_data));
+    return true;
+}
+
+static void phy_rtc_cal_cache_store(const esp_phy_calibration_data_t* cal_data)
+{
+    s_rtc_cal_cache.magic = 0; // invalidate while the contents are inconsistent
+    memcpy(&s_rtc_cal_cache.cal_data, cal_data, sizeof(s_rtc_cal_cache.cal_data));
+    s_rtc_cal_cache.timestamp_us = esp_rtc_get_time_us();
+    s_rtc_cal_cache.crc = esp_rom_crc32_le(0, (const uint8_t*) &s_rtc_cal_cache.cal_data,
+                                           sizeof(s_rtc_cal_cache.cal_data));
+    s_rtc_cal_cache.magic = PHY_RTC_CAL_CACHE_MAGIC;
+}
+#endif // CONFIG_ESP_PHY_RTC_CAL_CACHE
+
 #if CONFIG_ESP_PHY_REDUCE_TX_POWER
 static void __attribute((unused)) esp_phy_reduce_tx_power(esp_phy_init_data_t* init_data)
 {
@@ -910,13 +970,24 @@ void esp_phy_load_cal_and_init(void)
     if (esp_rom_get_reset_reason(0) == RESET_REASON_CORE_DEEP_SLEEP) {
         calibration_mode = PHY_RF_CAL_NONE;
     }
-    esp_err_t err = esp_phy_load_cal_data_from_nvs(cal_data);
-    if (err != ESP_OK) {
-        ESP_LOGW(TAG, "failed to load RF calibration data (0x%x), falling back to full calibration", err);
-        calibration_mode = PHY_RF_CAL_FULL;
+    ESP_ERROR_CHECK(esp_efuse_mac_get_default(sta_mac));
+
+    esp_err_t err = ESP_OK;
+    bool from_rtc_cache = false;
+#if CONFIG_ESP_PHY_RTC_CAL_CACHE
+    from_rtc_cache = phy_rtc_cal_cache_load(cal_data, sta_mac);
+#endif
+    if (from_rtc_cache) {
+        // validated warm-wake data, no NVS read and no calibration needed
+        calibration_mode = PHY_RF_CAL_NONE;
+    } else {
+        err = esp_phy_load_cal_data_from_nvs(cal_data);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "failed to load RF calibration data (0x%x), falling back to full calibration", err);
+            calibration_mode = PHY_RF_CAL_FULL;
+        }
     }
 
-    ESP_ERROR_CHECK(esp_efuse_mac_get_default(sta_mac));
     memcpy(cal_data->mac, sta_mac, 6);
     esp_err_t ret = register_chipv7_phy(init_data, cal_data, calibration_mode);
     if (ret == ESP_CAL_DATA_CHECK_FAIL) {
@@ -928,6 +999,12 @@ void esp_phy_load_cal_and_init(void)
     } else {
         err = ESP_OK;
     }
+#if CONFIG_ESP_PHY_RTC_CAL_CACHE
+    if (!from_rtc_cache || ret == ESP_CAL_DATA_CHECK_FAIL) {
+        // refresh the cache with the (possibly recalibrated) data
+        phy_rtc_cal_cache_store(cal_data);
+    }
+#endif
 #else
     register_chipv7_phy(init_data, cal_data, PHY_RF_CAL_FULL);
 #endif
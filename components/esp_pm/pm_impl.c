@@ -203,8 +203,30 @@ static const char* s_mode_names[] = {
         "CPU_MAX"
 };
 static uint32_t s_light_sleep_counts, s_light_sleep_reject_counts;
+/* Number of completed switches into each mode */
+static uint32_t s_mode_switch_counts[PM_MODE_COUNT];
+/* Number of actual CPU frequency changes, and total time, in microseconds,
+ * both cores were stalled performing them */
+static uint32_t s_freq_switch_counts;
+static pm_time_t s_freq_switch_stall_time;
 #endif // WITH_PROFILING
 
+#if CONFIG_PM_GOVERNOR
+/* Governor state, protected by s_switch_lock.
+ * Down-switches out of an eligible mode are counted within a sliding window;
+ * when the count reaches the threshold, the mode is held and further
+ * down-switches are suppressed until the hold period elapses or a higher
+ * mode is requested.
+ */
+static pm_time_t s_governor_window_start;
+static uint32_t s_governor_window_down_switches;
+static pm_time_t s_governor_hold_until;
+static bool s_governor_holding;
+#ifdef WITH_PROFILING
+static uint32_t s_governor_hold_counts;
+#endif
+#endif // CONFIG_PM_GOVERNOR
+
 #ifdef CONFIG_FREERTOS_SYSTICK_USES_CCOUNT
 /* Indicates to the ISR hook that CCOMPARE needs to be updated on the given CPU.
  * Used in conjunction with cross-core interrupt to update CCOMPARE on the other CPU.
@@ -564,6 +586,65 @@ static pm_mode_t IRAM_ATTR get_lowest_allowed_mode(void)
     }
 }
 
+#if CONFIG_PM_GOVERNOR
+static inline bool IRAM_ATTR governor_mode_eligible(pm_mode_t mode)
+{
+    switch (mode) {
+#if CONFIG_PM_GOVERNOR_HOLD_CPU_FREQ_MAX
+    case PM_MODE_CPU_MAX:
+        return true;
+#endif
+#if CONFIG_PM_GOVERNOR_HOLD_APB_FREQ_MAX
+    case PM_MODE_APB_MAX:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+/* Decide whether a requested mode switch should be applied now.
+ * Returns the mode to actually switch to; returning s_mode suppresses the
+ * switch. Must be called with s_switch_lock held.
+ */
+static pm_mode_t IRAM_ATTR governor_filter_mode(pm_mode_t new_mode)
+{
+    if (new_mode >= s_mode) {
+        /* Up-switches are never delayed; demand for a higher mode ends the hold */
+        s_governor_holding = false;
+        return new_mode;
+    }
+    if (!governor_mode_eligible(s_mode)) {
+        return new_mode;
+    }
+    pm_time_t now = pm_get_time();
+    if (s_governor_holding) {
+        if (now < s_governor_hold_until) {
+            return s_mode;
+        }
+        /* Hold expired: let this down-switch through and start a fresh window */
+        s_governor_holding = false;
+        s_governor_window_start = now;
+        s_governor_window_down_switches = 0;
+        return new_mode;
+    }
+    if (now - s_governor_window_start > CONFIG_PM_GOVERNOR_WINDOW_US) {
+        s_governor_window_start = now;
+        s_governor_window_down_switches = 0;
+    }
+    if (++s_governor_window_down_switches >= CONFIG_PM_GOVERNOR_THRESHOLD) {
+        s_governor_holding = true;
+        s_governor_hold_until = now + CONFIG_PM_GOVERNOR_HOLD_US;
+        s_governor_window_down_switches = 0;
+#ifdef WITH_PROFILING
+        s_governor_hold_counts++;
+#endif
+        return s_mode;
+    }
+    return new_mode;
+}
+#endif // CONFIG_PM_GOVERNOR
+
 void IRAM_ATTR esp_pm_impl_switch_mode(pm_mode_t mode,
         pm_mode_switch_t lock_or_unlock, pm_time_t now)
 {
@@ -588,6 +669,14 @@ void IRAM_ATTR esp_pm_impl_switch_mode(pm_mode_t mode,
     pm_mode_t new_mode = s_mode;
     if (need_switch) {
         new_mode = get_lowest_allowed_mode();
+#if CONFIG_PM_GOVERNOR
+        new_mode = governor_filter_mode(new_mode);
+        if (new_mode == s_mode) {
+            need_switch = false;
+        }
+#endif
+    }
+    if (need_switch) {
 #ifdef WITH_PROFILING
         if (s_last_mode_change_time != 0) {
             pm_time_t diff = now - s_last_mode_change_time;
@@ -699,6 +788,9 @@ static void IRAM_ATTR do_switch(pm_mode_t new_mode)
 
         bool switch_down = new_ticks_per_us < old_ticks_per_us;
 
+#ifdef WITH_PROFILING
+        pm_time_t switch_start = pm_get_time();
+#endif
         ESP_PM_TRACE_ENTER(FREQ_SWITCH, core_id);
         if (switch_down) {
             on_freq_update(old_ticks_per_us, new_ticks_per_us);
@@ -717,10 +809,18 @@ static void IRAM_ATTR do_switch(pm_mode_t new_mode)
             on_freq_update(old_ticks_per_us, new_ticks_per_us);
         }
         ESP_PM_TRACE_EXIT(FREQ_SWITCH, core_id);
+#ifdef WITH_PROFILING
+        /* Both cores are stalled for the duration of the frequency change */
+        s_freq_switch_stall_time += pm_get_time() - switch_start;
+        s_freq_switch_counts++;
+#endif
     }
 
     portENTER_CRITICAL_ISR(&s_switch_lock);
     portEXIT_CRITICAL_ISR(&s_cpu_freq_switch_lock[core_id]);
+#ifdef WITH_PROFILING
+    s_mode_switch_counts[new_mode]++;
+#endif
     s_mode = new_mode;
     s_is_switching = false;
     portEXIT_CRITICAL_ISR(&s_switch_lock);
@@ -917,15 +1017,22 @@ void esp_pm_impl_dump_stats(FILE* out)
 {
     pm_time_t time_in_mode[PM_MODE_COUNT];
     uint32_t freq_mhz_by_mode[PM_MODE_COUNT];
+    uint32_t mode_switch_counts[PM_MODE_COUNT];
 
     portENTER_CRITICAL_ISR(&s_switch_lock);
     memcpy(time_in_mode, s_time_in_mode, sizeof(time_in_mode));
+    memcpy(mode_switch_counts, s_mode_switch_counts, sizeof(mode_switch_counts));
     pm_time_t last_mode_change_time = s_last_mode_change_time;
     pm_mode_t cur_mode = s_mode;
     pm_time_t now = pm_get_time();
     bool light_sleep_en = s_light_sleep_en;
     uint32_t light_sleep_counts = s_light_sleep_counts;
     uint32_t light_sleep_reject_counts = s_light_sleep_reject_counts;
+    uint32_t freq_switch_counts = s_freq_switch_counts;
+    pm_time_t freq_switch_stall_time = s_freq_switch_stall_time;
+#if CONFIG_PM_GOVERNOR
+    uint32_t governor_hold_counts = s_governor_hold_counts;
+#endif
     // Read all frequency configs while holding s_switch_lock
     for (int i = 0; i < PM_MODE_COUNT; ++i) {
         freq_mhz_by_mode[i] = get_cpu_freq_config_by_mode(i)->freq_mhz;
@@ -935,19 +1042,27 @@ void esp_pm_impl_dump_stats(FILE* out)
     time_in_mode[cur_mode] += now - last_mode_change_time;
 
     fprintf(out, "\nMode stats:\n");
-    fprintf(out, "%-8s  %-10s  %-10s  %-10s\n", "Mode", "CPU_freq", "Time(us)", "Time(%)");
+    fprintf(out, "%-8s  %-10s  %-10s  %-10s  %-10s\n", "Mode", "CPU_freq", "Time(us)", "Time(%)", "Switches");
     for (int i = 0; i < PM_MODE_COUNT; ++i) {
         if (i == PM_MODE_LIGHT_SLEEP && !light_sleep_en) {
             /* don't display light sleep mode if it's not enabled */
             continue;
         }
-        fprintf(out, "%-8s  %-3"PRIu32"M%-7s %-10lld  %-2d%%\n",
+        fprintf(out, "%-8s  %-3"PRIu32"M%-7s %-10lld  %-2d%%%-7s %-10"PRIu32"\n",
                 s_mode_names[i],
                 freq_mhz_by_mode[i],
                 "",                                     //Empty space to align columns
                 time_in_mode[i],
-                (int) (time_in_mode[i] * 100 / now));
+                (int) (time_in_mode[i] * 100 / now),
+                "",                                     //Empty space to align columns
+                mode_switch_counts[i]);
     }
+    fprintf(out, "\nFrequency switch stats:\n");
+    fprintf(out, "freq_switch_counts:%"PRIu32"  freq_switch_stall_time:%lld us\n",
+            freq_switch_counts, freq_switch_stall_time);
+#if CONFIG_PM_GOVERNOR
+    fprintf(out, "governor_hold_counts:%"PRIu32"\n", governor_hold_counts);
+#endif
     if (light_sleep_en){
         fprintf(out, "\nSleep stats:\n");
         fprintf(out, "light_sleep_counts:%ld  light_sleep_reject_counts:%ld\n", light_sleep_counts, light_sleep_reject_counts);
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_SPIRAM_XIP_PROFILER || __DOXYGEN__
+
+/**
+ * @brief XIP working-set profiler configuration
+ *
+ * Any field left 0 falls back to its default value.
+ */
+typedef struct {
+    uint32_t counter_interval_us;   /*!< Period of the external memory cache counter sampling, in microseconds.
+                                         Default: 100000 (100 ms) */
+    uint32_t events_per_sample;     /*!< Number of trigger events between two program counter samples.
+                                         Smaller values give finer histograms at higher interrupt cost.
+                                         Default: 10000 */
+    uint32_t bucket_bytes;          /*!< Histogram bucket size in bytes, a power of two not smaller than 256.
+                                         The histogram covers the whole external instruction address range,
+                                         so smaller buckets need more internal RAM. Default: 4096 (32 KB of RAM) */
+    uint16_t trigger_select;        /*!< Xtensa performance counter select value used as the sample trigger,
+                                         see xtensa/xt_perf_consts.h. Default: XTPERF_CNT_I_STALL */
+    uint16_t trigger_mask;          /*!< Mask for the trigger counter. Default: XTPERF_MASK_I_STALL_ALL */
+} esp_psram_xip_profiler_config_t;
+
+/**
+ * @brief Start the XIP working-set profiler
+ *
+ * Program counter samples are taken on the core this function is called from;
+ * call it from a task pinned to the core of interest. Starting the profiler
+ * discards the data collected by a previous run.
+ *
+ * @param config Profiler configuration, or NULL to use the defaults
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Invalid bucket size
+ *        - ESP_ERR_INVALID_STATE: Profiler is already running
+ *        - ESP_ERR_NO_MEM:        Not enough internal RAM for the histogram
+ */
+esp_err_t esp_psram_xip_profiler_start(const esp_psram_xip_profiler_config_t *config);
+
+/**
+ * @brief Stop the XIP working-set profiler
+ *
+ * The collected histogram and counter totals are kept and can still be dumped
+ * after the profiler has been stopped.
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_STATE: Profiler is not running
+ */
+esp_err_t esp_psram_xip_profiler_stop(void);
+
+/**
+ * @brief Dump profiler results
+ *
+ * Prints the accumulated external memory cache access/miss counters, followed by
+ * the hottest address buckets ranked by sample count. Each bucket is resolved
+ * through the MMU to the physical flash or PSRAM region backing it. Map the
+ * listed addresses to functions with addr2line, then pin the hot functions into
+ * internal RAM with a `(noflash)` entry in a linker fragment file.
+ *
+ * @param stream Stream to print to (e.g. stdout)
+ * @param top_n  Number of hottest buckets to list
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Stream is NULL
+ *        - ESP_ERR_INVALID_STATE: Profiler has never been started
+ *        - ESP_ERR_NO_MEM:        Not enough memory for the ranking scratch buffer
+ */
+esp_err_t esp_psram_xip_profiler_dump(FILE *stream, uint32_t top_n);
+
+#endif // CONFIG_SPIRAM_XIP_PROFILER || __DOXYGEN__
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,270 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*----------------------------------------------------------------------------
+ * XIP working-set profiler
+ *
+ * Two data sources are combined:
+ *
+ * 1. The external memory cache access/miss counters in the EXTMEM peripheral
+ *    are sampled periodically from an esp_timer callback and accumulated to
+ *    64 bits, giving the overall miss pressure on the instruction and data
+ *    buses.
+ *
+ * 2. A Xtensa performance counter is programmed to assert the profiling
+ *    interrupt every N occurrences of a trigger event (instruction-related
+ *    stall cycles by default). The interrupt handler reads the program
+ *    counter latched by the performance monitor and increments a histogram
+ *    bucket, attributing the stalls back to code addresses. Since XIP code
+ *    runs from the external instruction address range, the hottest buckets
+ *    are the flash/PSRAM regions worth pinning into internal RAM.
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_check.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_intr_alloc.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
+#include "esp_mmu_map.h"
+#include "soc/soc.h"
+#include "soc/extmem_reg.h"
+#include "eri.h"
+#include "xtensa-debug-module.h"
+#include "xtensa/xt_perf_consts.h"
+#include "xtensa_perfmon_access.h"
+#include "esp_psram_xip_profiler.h"
+
+#define PROFILER_DEFAULT_COUNTER_INTERVAL_US    100000
+#define PROFILER_DEFAULT_EVENTS_PER_SAMPLE      10000
+#define PROFILER_DEFAULT_BUCKET_BYTES           4096
+#define PROFILER_MIN_BUCKET_BYTES               256
+
+/* Performance counter used as the sample trigger */
+#define PROFILER_PM_ID                          0
+/* Count only code running below the profiling interrupt's own level */
+#define PROFILER_TRACELEVEL                     2
+
+static const char *TAG = "xip_prof";
+
+static struct {
+    intr_handle_t intr;
+    esp_timer_handle_t counter_timer;
+    uint32_t *hist;
+    uint32_t bucket_count;
+    int bucket_shift;
+    uint32_t events_per_sample;
+    volatile uint32_t iram_samples;
+    volatile uint32_t other_samples;
+    volatile uint32_t total_samples;
+    /* EXTMEM counters accumulated to 64 bits; last_* hold the raw 32-bit
+     * register values from the previous sampling period */
+    uint64_t ibus_acs, ibus_miss, dbus_acs, dbus_flash_miss, dbus_spiram_miss;
+    uint32_t last_ibus_acs, last_ibus_miss, last_dbus_acs, last_dbus_flash_miss, last_dbus_spiram_miss;
+    bool running;
+} s_prof;
+
+static void IRAM_ATTR profiler_pm_isr(void *arg)
+{
+    /* INTPC holds the PC latched when the performance monitor asserted the
+     * interrupt, so the sample is exact even though the handler runs later */
+    uint32_t pc = eri_read(ERI_PERFMON_INTPC);
+    eri_write(ERI_PERFMON_PMSTAT0 + PROFILER_PM_ID * sizeof(int32_t), PMSTAT_OVFL | PMSTAT_INTSTART);
+    /* Re-arm: the interrupt fires when bit 31 of the counter gets set */
+    eri_write(ERI_PERFMON_PM0 + PROFILER_PM_ID * sizeof(int32_t), 0x80000000U - s_prof.events_per_sample);
+
+    if (pc >= SOC_IROM_LOW && pc < SOC_IROM_HIGH) {
+        s_prof.hist[(pc - SOC_IROM_LOW) >> s_prof.bucket_shift]++;
+    } else if (esp_ptr_in_iram((void *)pc)) {
+        s_prof.iram_samples++;
+    } else {
+        s_prof.other_samples++;
+    }
+    s_prof.total_samples++;
+}
+
+static void profiler_counter_timer_cb(void *arg)
+{
+    /* The EXTMEM counters are free-running 32-bit registers; unsigned delta
+     * arithmetic keeps the totals correct across wrap-around as long as no
+     * counter advances by more than 2^32 between two samples */
+    uint32_t v;
+    v = REG_READ(EXTMEM_IBUS_ACS_CNT_REG);
+    s_prof.ibus_acs += v - s_prof.last_ibus_acs;
+    s_prof.last_ibus_acs = v;
+    v = REG_READ(EXTMEM_IBUS_ACS_MISS_CNT_REG);
+    s_prof.ibus_miss += v - s_prof.last_ibus_miss;
+    s_prof.last_ibus_miss = v;
+    v = REG_READ(EXTMEM_DBUS_ACS_CNT_REG);
+    s_prof.dbus_acs += v - s_prof.last_dbus_acs;
+    s_prof.last_dbus_acs = v;
+    v = REG_READ(EXTMEM_DBUS_ACS_FLASH_MISS_CNT_REG);
+    s_prof.dbus_flash_miss += v - s_prof.last_dbus_flash_miss;
+    s_prof.last_dbus_flash_miss = v;
+    v = REG_READ(EXTMEM_DBUS_ACS_SPIRAM_MISS_CNT_REG);
+    s_prof.dbus_spiram_miss += v - s_prof.last_dbus_spiram_miss;
+    s_prof.last_dbus_spiram_miss = v;
+}
+
+esp_err_t esp_psram_xip_profiler_start(const esp_psram_xip_profiler_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(!s_prof.running, ESP_ERR_INVALID_STATE, TAG, "profiler is already running");
+
+    uint32_t counter_interval_us = PROFILER_DEFAULT_COUNTER_INTERVAL_US;
+    uint32_t events_per_sample = PROFILER_DEFAULT_EVENTS_PER_SAMPLE;
+    uint32_t bucket_bytes = PROFILER_DEFAULT_BUCKET_BYTES;
+    uint16_t trigger_select = XTPERF_CNT_I_STALL;
+    uint16_t trigger_mask = XTPERF_MASK_I_STALL_ALL;
+    if (config) {
+        counter_interval_us = config->counter_interval_us ? config->counter_interval_us : counter_interval_us;
+        events_per_sample = config->events_per_sample ? config->events_per_sample : events_per_sample;
+        bucket_bytes = config->bucket_bytes ? config->bucket_bytes : bucket_bytes;
+        trigger_select = config->trigger_select ? config->trigger_select : trigger_select;
+        trigger_mask = config->trigger_mask ? config->trigger_mask : trigger_mask;
+    }
+    ESP_RETURN_ON_FALSE((bucket_bytes >= PROFILER_MIN_BUCKET_BYTES) && ((bucket_bytes & (bucket_bytes - 1)) == 0),
+                        ESP_ERR_INVALID_ARG, TAG, "bucket_bytes must be a power of two >= %d", PROFILER_MIN_BUCKET_BYTES);
+
+    esp_err_t ret = ESP_OK;
+    free(s_prof.hist);
+    memset(&s_prof, 0, sizeof(s_prof));
+    s_prof.bucket_shift = __builtin_ctz(bucket_bytes);
+    s_prof.bucket_count = (SOC_IROM_HIGH - SOC_IROM_LOW) >> s_prof.bucket_shift;
+    s_prof.events_per_sample = events_per_sample;
+    /* The histogram is written from the profiling interrupt, keep it in internal RAM */
+    s_prof.hist = heap_caps_calloc(s_prof.bucket_count, sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+    ESP_RETURN_ON_FALSE(s_prof.hist, ESP_ERR_NO_MEM, TAG, "no memory for the histogram");
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = profiler_counter_timer_cb,
+        .name = "xip_prof",
+    };
+    ESP_GOTO_ON_ERROR(esp_timer_create(&timer_args, &s_prof.counter_timer), err, TAG, "failed to create counter sampling timer");
+
+    /* Start the cache counter totals from zero */
+    REG_WRITE(EXTMEM_CACHE_ACS_CNT_CLR_REG, EXTMEM_ICACHE_ACS_CNT_CLR | EXTMEM_DCACHE_ACS_CNT_CLR);
+    REG_WRITE(EXTMEM_CACHE_ACS_CNT_CLR_REG, 0);
+    ESP_GOTO_ON_ERROR(esp_timer_start_periodic(s_prof.counter_timer, counter_interval_us), err, TAG, "failed to start counter sampling timer");
+
+    ESP_GOTO_ON_ERROR(esp_intr_alloc(ETS_INTERNAL_PROFILING_INTR_SOURCE, ESP_INTR_FLAG_LEVEL3 | ESP_INTR_FLAG_IRAM,
+                                     &profiler_pm_isr, NULL, &s_prof.intr),
+                      err, TAG, "failed to allocate the profiling interrupt");
+
+    uint32_t pmctrl = PMCTRL_INTEN |
+                      ((PROFILER_TRACELEVEL & PMCTRL_TRACELEVEL_MASK) << PMCTRL_TRACELEVEL_SHIFT) |
+                      ((trigger_select & PMCTRL_SELECT_MASK) << PMCTRL_SELECT_SHIFT) |
+                      ((trigger_mask & PMCTRL_MASK_MASK) << PMCTRL_MASK_SHIFT);
+    eri_write(ERI_PERFMON_PMSTAT0 + PROFILER_PM_ID * sizeof(int32_t), PMSTAT_OVFL | PMSTAT_INTSTART);
+    eri_write(ERI_PERFMON_PMCTRL0 + PROFILER_PM_ID * sizeof(int32_t), pmctrl);
+    eri_write(ERI_PERFMON_PM0 + PROFILER_PM_ID * sizeof(int32_t), 0x80000000U - events_per_sample);
+    xtensa_perfmon_start();
+
+    s_prof.running = true;
+    return ESP_OK;
+
+err:
+    if (s_prof.counter_timer) {
+        esp_timer_stop(s_prof.counter_timer);
+        esp_timer_delete(s_prof.counter_timer);
+        s_prof.counter_timer = NULL;
+    }
+    free(s_prof.hist);
+    s_prof.hist = NULL;
+    return ret;
+}
+
+esp_err_t esp_psram_xip_profiler_stop(void)
+{
+    ESP_RETURN_ON_FALSE(s_prof.running, ESP_ERR_INVALID_STATE, TAG, "profiler is not running");
+
+    eri_write(ERI_PERFMON_PMCTRL0 + PROFILER_PM_ID * sizeof(int32_t), 0);
+    xtensa_perfmon_stop();
+    esp_intr_free(s_prof.intr);
+    s_prof.intr = NULL;
+
+    esp_timer_stop(s_prof.counter_timer);
+    /* Fold the last partial sampling period into the totals */
+    profiler_counter_timer_cb(NULL);
+    esp_timer_delete(s_prof.counter_timer);
+    s_prof.counter_timer = NULL;
+
+    s_prof.running = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_psram_xip_profiler_dump(FILE *stream, uint32_t top_n)
+{
+    ESP_RETURN_ON_FALSE(stream, ESP_ERR_INVALID_ARG, TAG, "stream is NULL");
+    ESP_RETURN_ON_FALSE(s_prof.hist, ESP_ERR_INVALID_STATE, TAG, "profiler has never been started");
+
+    fprintf(stream, "External memory cache counters:\n");
+    fprintf(stream, "ibus accesses:      %-12llu misses: %-12llu (%llu%%)\n",
+            s_prof.ibus_acs, s_prof.ibus_miss,
+            s_prof.ibus_acs ? (s_prof.ibus_miss * 100 / s_prof.ibus_acs) : 0);
+    fprintf(stream, "dbus accesses:      %-12llu flash misses: %llu, psram misses: %llu\n",
+            s_prof.dbus_acs, s_prof.dbus_flash_miss, s_prof.dbus_spiram_miss);
+
+    uint32_t total = s_prof.total_samples;
+    fprintf(stream, "\nPC samples: %"PRIu32" total, %"PRIu32" in internal RAM, %"PRIu32" elsewhere\n",
+            total, s_prof.iram_samples, s_prof.other_samples);
+    if (total == 0) {
+        return ESP_OK;
+    }
+
+    uint32_t *top_idx = malloc(top_n * sizeof(uint32_t));
+    ESP_RETURN_ON_FALSE(top_idx, ESP_ERR_NO_MEM, TAG, "no memory for the ranking buffer");
+
+    fprintf(stream, "Hottest external memory regions:\n");
+    fprintf(stream, "%-4s  %-21s  %-6s  %-10s  %-10s  %-8s\n",
+            "Rank", "Vaddr range", "Target", "Paddr", "Samples", "Samples(%)");
+    uint32_t ranked = 0;
+    for (uint32_t rank = 0; rank < top_n; rank++) {
+        uint32_t best = 0;
+        uint32_t best_idx = UINT32_MAX;
+        for (uint32_t i = 0; i < s_prof.bucket_count; i++) {
+            if (s_prof.hist[i] <= best) {
+                continue;
+            }
+            bool used = false;
+            for (uint32_t j = 0; j < ranked; j++) {
+                if (top_idx[j] == i) {
+                    used = true;
+                    break;
+                }
+            }
+            if (!used) {
+                best = s_prof.hist[i];
+                best_idx = i;
+            }
+        }
+        if (best_idx == UINT32_MAX) {
+            break;
+        }
+        top_idx[ranked++] = best_idx;
+
+        uint32_t vaddr = SOC_IROM_LOW + (best_idx << s_prof.bucket_shift);
+        esp_paddr_t paddr = 0;
+        mmu_target_t target = MMU_TARGET_FLASH0;
+        const char *target_name = "?";
+        if (esp_mmu_vaddr_to_paddr((void *)vaddr, &paddr, &target) == ESP_OK) {
+            target_name = (target == MMU_TARGET_FLASH0) ? "Flash" : "PSRAM";
+        }
+        fprintf(stream, "%-4"PRIu32"  0x%08"PRIx32"-0x%08"PRIx32"  %-6s  0x%08"PRIx32"  %-10"PRIu32"  %-3"PRIu32"%%\n",
+                rank + 1, vaddr, vaddr + (1UL << s_prof.bucket_shift), target_name, (uint32_t)paddr,
+                best, best * 100 / total);
+    }
+    free(top_idx);
+    fprintf(stream, "Resolve the sampled addresses to functions with addr2line, then pin the hot\n"
+                    "functions into internal RAM with a `(noflash)` entry in a linker fragment file.\n");
+    return ESP_OK;
+}
@@ -553,6 +553,28 @@ RingbufHandle_t xRingbufferCreateWithCaps(size_t xBufferSize, RingbufferType_t x
  */
 void vRingbufferDeleteWithCaps(RingbufHandle_t xRingbuffer);
 
+/**
+ * @brief Creates a ring buffer whose storage can be used directly by DMA
+ *
+ * The storage area is allocated from DMA-capable memory, aligned to the data
+ * cache line size of that memory (see esp_cache_get_alignment()) and padded to
+ * a whole number of cache lines. This allows drivers to point DMA descriptors
+ * at ring buffer items and perform cache sync operations on them without
+ * staging the data through an intermediate DMA buffer first.
+ *
+ * The control structure itself is allocated separately from internal memory.
+ *
+ * @note A ring buffer created using this function must only be deleted using
+ * vRingbufferDeleteWithCaps()
+ * @note Item payloads keep the ring buffer's native alignment. On targets
+ * where DMA memory is cached, acquire item sizes padded to the cache line
+ * size if an item must not share a cache line with its neighbours.
+ * @param[in] xBufferSize Size of the buffer in bytes
+ * @param[in] xBufferType Type of ring buffer, see documentation.
+ * @return Handle to the created ring buffer or NULL on failure.
+ */
+RingbufHandle_t xRingbufferCreateDMACapable(size_t xBufferSize, RingbufferType_t xBufferType);
+
 #ifdef __cplusplus
 }
 #endif
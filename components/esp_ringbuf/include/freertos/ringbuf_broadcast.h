@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Broadcast ring buffer
+ *
+ * A broadcast ring buffer is a variant of the no-split ring buffer (see
+ * freertos/ringbuf.h) with one producer and multiple registered consumers.
+ * Every sent item is delivered to every consumer that was registered at the
+ * time of the send; each consumer retrieves items through its own independent
+ * read position. The storage occupied by an item is only reclaimed once all
+ * consumers it was delivered to have returned it, i.e. the slowest consumer
+ * determines how quickly the buffer drains.
+ *
+ * Each consumer has a lag counter (number of delivered items it has not yet
+ * retrieved). A consumer that stops retrieving items would eventually stall
+ * the producer, so consumers can be evicted: either explicitly with
+ * uxRingbufferBroadcastEvictStalled(), or automatically by the producer when
+ * a send does not fit and a consumer's lag has reached the stall limit given
+ * at creation time. An evicted consumer stops receiving items; items pending
+ * for it are released on its behalf.
+ */
+
+/**
+ * @brief Maximum number of consumers a broadcast ring buffer can support
+ */
+#define RINGBUF_BROADCAST_MAX_CONSUMERS     32
+
+/**
+ * @brief Type by which broadcast ring buffers are referenced
+ */
+typedef struct BroadcastRingbufferDefinition *RingbufBroadcastHandle_t;
+
+/**
+ * @brief Type by which registered broadcast consumers are referenced
+ */
+typedef struct BroadcastConsumerDefinition *RingbufBroadcastConsumerHandle_t;
+
+/**
+ * @brief Create a broadcast ring buffer
+ *
+ * Items are stored no-split style (each item is contiguous), so the largest
+ * supported item is the same as for a no-split ring buffer of the same size.
+ *
+ * @param[in] xBufferSize Size of the item storage in bytes
+ * @param[in] uxMaxConsumers Maximum number of simultaneously registered
+ *                           consumers, at most RINGBUF_BROADCAST_MAX_CONSUMERS
+ * @param[in] uxStalledLagLimit Automatic eviction threshold. When a send does
+ *                              not fit, consumers whose lag is at least this
+ *                              many items are evicted to make room. Pass 0 to
+ *                              disable automatic eviction.
+ * @return Handle to the created ring buffer, or NULL on failure
+ */
+RingbufBroadcastHandle_t xRingbufferBroadcastCreate(size_t xBufferSize, UBaseType_t uxMaxConsumers, size_t uxStalledLagLimit);
+
+/**
+ * @brief Delete a broadcast ring buffer
+ *
+ * All consumers must have been unregistered and no task may be blocked on the
+ * ring buffer when it is deleted.
+ *
+ * @param[in] xRingbuffer Broadcast ring buffer to delete
+ */
+void vRingbufferBroadcastDelete(RingbufBroadcastHandle_t xRingbuffer);
+
+/**
+ * @brief Register a consumer with a broadcast ring buffer
+ *
+ * The new consumer starts at the current write position, i.e. it only sees
+ * items sent after registration.
+ *
+ * @param[in] xRingbuffer Broadcast ring buffer to register with
+ * @return Consumer handle, or NULL if the maximum number of consumers are
+ *         already registered
+ */
+RingbufBroadcastConsumerHandle_t xRingbufferBroadcastRegister(RingbufBroadcastHandle_t xRingbuffer);
+
+/**
+ * @brief Unregister a consumer
+ *
+ * Items still pending for the consumer (including retrieved but not yet
+ * returned items) are released on its behalf. The consumer handle becomes
+ * invalid.
+ *
+ * @param[in] xConsumer Consumer to unregister
+ */
+void vRingbufferBroadcastUnregister(RingbufBroadcastConsumerHandle_t xConsumer);
+
+/**
+ * @brief Send an item to all currently registered consumers
+ *
+ * The item is copied into the ring buffer once and delivered to every
+ * registered, non-evicted consumer. If the item does not fit and a stall
+ * limit was configured, consumers whose lag has reached the limit are
+ * evicted before the send is retried or blocks.
+ *
+ * @param[in] xRingbuffer Broadcast ring buffer to send to
+ * @param[in] pvItem Pointer to the item to send
+ * @param[in] xItemSize Size of the item
+ * @param[in] xTicksToWait Maximum time to wait for space to become free
+ * @return pdTRUE on success, pdFALSE on timeout or if the item can never fit
+ */
+BaseType_t xRingbufferBroadcastSend(RingbufBroadcastHandle_t xRingbuffer, const void *pvItem, size_t xItemSize, TickType_t xTicksToWait);
+
+/**
+ * @brief Retrieve the next item pending for a consumer
+ *
+ * The returned pointer is valid until the item is returned with
+ * vRingbufferBroadcastReturnItem(). Multiple items may be outstanding at the
+ * same time.
+ *
+ * @param[in] xConsumer Consumer to retrieve for
+ * @param[out] pxItemSize Returned size of the item
+ * @param[in] xTicksToWait Maximum time to wait for an item
+ * @return Pointer to the item, or NULL on timeout or if the consumer has been
+ *         evicted
+ */
+void *xRingbufferBroadcastReceive(RingbufBroadcastConsumerHandle_t xConsumer, size_t *pxItemSize, TickType_t xTicksToWait);
+
+/**
+ * @brief Return a retrieved item on behalf of a consumer
+ *
+ * The item's storage is reclaimed once every consumer it was delivered to has
+ * returned it.
+ *
+ * @param[in] xConsumer Consumer the item was retrieved for
+ * @param[in] pvItem Item to return
+ */
+void vRingbufferBroadcastReturnItem(RingbufBroadcastConsumerHandle_t xConsumer, void *pvItem);
+
+/**
+ * @brief Get a consumer's lag
+ *
+ * @param[in] xConsumer Consumer to query
+ * @return Number of items delivered to the consumer that it has not yet
+ *         retrieved
+ */
+size_t uxRingbufferBroadcastGetLag(RingbufBroadcastConsumerHandle_t xConsumer);
+
+/**
+ * @brief Check whether a consumer has been evicted
+ *
+ * An evicted consumer no longer receives items and should unregister itself
+ * with vRingbufferBroadcastUnregister().
+ *
+ * @param[in] xConsumer Consumer to query
+ * @return pdTRUE if the consumer has been evicted, pdFALSE otherwise
+ */
+BaseType_t xRingbufferBroadcastIsEvicted(RingbufBroadcastConsumerHandle_t xConsumer);
+
+/**
+ * @brief Evict all consumers whose lag has reached a threshold
+ *
+ * Items pending for an evicted consumer are released on its behalf, which may
+ * unblock a producer waiting for space.
+ *
+ * @param[in] xRingbuffer Broadcast ring buffer to operate on
+ * @param[in] xMaxLag Consumers with a lag of at least this many items are evicted
+ * @return Number of consumers that were evicted
+ */
+UBaseType_t uxRingbufferBroadcastEvictStalled(RingbufBroadcastHandle_t xRingbuffer, size_t xMaxLag);
+
+#ifdef __cplusplus
+}
+#endif
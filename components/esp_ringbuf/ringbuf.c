@@ -13,6 +13,7 @@
 #include "freertos/queue.h"
 #include "freertos/ringbuf.h"
 #include "esp_heap_caps.h"
+#include "esp_cache.h"
 
 // ------------------------------------------------- Macros and Types --------------------------------------------------
 
@@ -1522,6 +1523,53 @@ err:
     return NULL;
 }
 
+RingbufHandle_t xRingbufferCreateDMACapable(size_t xBufferSize, RingbufferType_t xBufferType)
+{
+    RingbufHandle_t xRingbuffer;
+    StaticRingbuffer_t *pxStaticRingbuffer;
+    uint8_t *pucRingbufferStorage;
+    size_t xAlignment = 0;
+
+    configASSERT(xBufferSize > 0);
+    configASSERT(xBufferType < RINGBUF_TYPE_MAX);
+
+    if (xBufferType != RINGBUF_TYPE_BYTEBUF) {
+        xBufferSize = rbALIGN_SIZE(xBufferSize);    //xBufferSize is rounded up for no-split/allow-split buffers
+    }
+
+    //Align and pad the storage area to the cache line size of the DMA memory,
+    //so that cache sync operations never touch adjacent allocations
+    if (esp_cache_get_alignment(MALLOC_CAP_DMA, &xAlignment) != ESP_OK) {
+        return NULL;
+    }
+    if (xAlignment < rbALIGN_MASK + 1) {
+        //DMA memory is not cached on this target; keep the native alignment
+        xAlignment = rbALIGN_MASK + 1;
+    }
+    xBufferSize = (xBufferSize + xAlignment - 1) & ~(xAlignment - 1);
+
+    //Only the storage area needs to be DMA capable; the control structure stays in internal memory
+    pxStaticRingbuffer = heap_caps_malloc(sizeof(StaticRingbuffer_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    pucRingbufferStorage = heap_caps_aligned_alloc(xAlignment, xBufferSize, MALLOC_CAP_DMA);
+
+    if (pxStaticRingbuffer == NULL || pucRingbufferStorage == NULL) {
+        goto err;
+    }
+
+    // Create the ring buffer using static creation API
+    xRingbuffer = xRingbufferCreateStatic(xBufferSize, xBufferType, pucRingbufferStorage, pxStaticRingbuffer);
+    if (xRingbuffer == NULL) {
+        goto err;
+    }
+
+    return xRingbuffer;
+
+err:
+    heap_caps_free(pxStaticRingbuffer);
+    heap_caps_free(pucRingbufferStorage);
+    return NULL;
+}
+
 void vRingbufferDeleteWithCaps(RingbufHandle_t xRingbuffer)
 {
     // Return value unused if asserts are disabled
@@ -0,0 +1,570 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/list.h"
+#include "freertos/task.h"
+#include "freertos/ringbuf_broadcast.h"
+#include "esp_heap_caps.h"
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+//32-bit alignment macros (identical to ringbuf.c)
+#define rbcALIGN_MASK (0x03)
+#define rbcALIGN_SIZE( xSize )      ( ( xSize + rbcALIGN_MASK ) & ~rbcALIGN_MASK )
+#define rbcCHECK_ALIGNED( pvPtr )   ( ( ( UBaseType_t ) ( pvPtr ) & rbcALIGN_MASK ) == 0 )
+
+//Ring buffer flags
+#define rbcBUFFER_FULL_FLAG         ( ( UBaseType_t ) 1 )   //The ring buffer is currently full (write pointer == free pointer)
+
+//Item flags
+#define rbcITEM_FREE_FLAG           ( ( UBaseType_t ) 1 )   //Item has been returned by all consumers, free to overwrite
+#define rbcITEM_DUMMY_DATA_FLAG     ( ( UBaseType_t ) 2 )   //Data from here to end of the ring buffer is dummy data. Restart reading at the head of the buffer
+#define rbcITEM_WRITTEN_FLAG        ( ( UBaseType_t ) 4 )   //Item has been written, thus can be read
+
+typedef struct {
+    //This size of this structure must be 32-bit aligned
+    size_t xItemLen;
+    UBaseType_t uxItemFlags;
+    UBaseType_t uxPendingMask;      //Bit per consumer the item was delivered to but not yet returned by
+} BroadcastItemHeader_t;
+
+#define rbcHEADER_SIZE    sizeof(BroadcastItemHeader_t)
+
+typedef struct BroadcastConsumerDefinition {
+    struct BroadcastRingbufferDefinition *pxRingbuffer; //Ring buffer the consumer is registered with
+    uint8_t *pucRead;                           //This consumer's read pointer
+    size_t uxLag;                               //Number of delivered items not yet retrieved by this consumer
+    BaseType_t xInUse;                          //Consumer slot is registered
+    BaseType_t xEvicted;                        //Consumer has been evicted and no longer receives items
+} BroadcastConsumer_t;
+
+typedef struct BroadcastRingbufferDefinition {
+    size_t xSize;                               //Size of the data storage
+    size_t xMaxItemSize;                        //Maximum item size
+    UBaseType_t uxFlags;                        //Status flags of the ring buffer
+    size_t uxStalledLagLimit;                   //Automatic eviction threshold, 0 if disabled
+
+    uint8_t *pucHead;                           //Pointer to the start of the ring buffer storage area
+    uint8_t *pucTail;                           //Pointer to the end of the ring buffer storage area
+    uint8_t *pucWrite;                          //Write Pointer. Points to where the next item should be written
+    uint8_t *pucFree;                           //Free Pointer. Points to the oldest item that has yet to be returned by all consumers
+
+    UBaseType_t uxMaxConsumers;                 //Number of consumer slots
+    BroadcastConsumer_t *pxConsumers;           //Consumer slot array
+
+    List_t xTasksWaitingToSend;                 //List of tasks that are blocked waiting to send onto this ring buffer. Stored in priority order.
+    List_t xTasksWaitingToReceive;              //List of tasks that are blocked waiting to receive from this ring buffer. Stored in priority order.
+
+    portMUX_TYPE mux;                           //Spinlock required for SMP
+} BroadcastRingbuffer_t;
+
+// ------------------------------------------------ Static Functions ---------------------------------------------------
+
+/*
+ * WARNING: All of the following static functions ARE NOT THREAD SAFE.
+ * Therefore they should only be called within a critical section (using spin
+ * locks)
+ */
+
+//Mask of all registered, non-evicted consumers
+static UBaseType_t prvActiveConsumerMask(BroadcastRingbuffer_t *pxRingbuffer)
+{
+    UBaseType_t uxMask = 0;
+    for (UBaseType_t i = 0; i < pxRingbuffer->uxMaxConsumers; i++) {
+        if (pxRingbuffer->pxConsumers[i].xInUse == pdTRUE && pxRingbuffer->pxConsumers[i].xEvicted == pdFALSE) {
+            uxMask |= ((UBaseType_t) 1 << i);
+        }
+    }
+    return uxMask;
+}
+
+//Checks if an item will currently fit (no-split semantics, same as prvCheckItemFitsDefault in ringbuf.c)
+static BaseType_t prvBroadcastCheckItemFits(BroadcastRingbuffer_t *pxRingbuffer, size_t xItemSize)
+{
+    configASSERT(rbcCHECK_ALIGNED(pxRingbuffer->pucWrite));
+    configASSERT(pxRingbuffer->pucWrite >= pxRingbuffer->pucHead && pxRingbuffer->pucWrite < pxRingbuffer->pucTail);
+
+    size_t xTotalItemSize = rbcALIGN_SIZE(xItemSize) + rbcHEADER_SIZE;    //Rounded up aligned item size with header
+    if (pxRingbuffer->pucWrite == pxRingbuffer->pucFree) {
+        //Buffer is either completely empty or completely full
+        return (pxRingbuffer->uxFlags & rbcBUFFER_FULL_FLAG) ? pdFALSE : pdTRUE;
+    }
+    if (pxRingbuffer->pucFree > pxRingbuffer->pucWrite) {
+        //Free space does not wrap around
+        return (xTotalItemSize <= (size_t)(pxRingbuffer->pucFree - pxRingbuffer->pucWrite)) ? pdTRUE : pdFALSE;
+    }
+    //Free space wraps around
+    if (xTotalItemSize <= (size_t)(pxRingbuffer->pucTail - pxRingbuffer->pucWrite)) {
+        return pdTRUE;      //Item fits without wrapping around
+    }
+    //Check if item fits by wrapping
+    return (xTotalItemSize <= (size_t)(pxRingbuffer->pucFree - pxRingbuffer->pucHead)) ? pdTRUE : pdFALSE;
+}
+
+/*
+ * Progress the free pointer past items that have been returned by all
+ * consumers (free flag) and dummy items, reclaiming their storage.
+ */
+static void prvBroadcastRetireFreedItems(BroadcastRingbuffer_t *pxRingbuffer)
+{
+    BroadcastItemHeader_t *pxCurHeader = (BroadcastItemHeader_t *)pxRingbuffer->pucFree;
+
+    //Allow a single advancement when the buffer is full (free pointer == write pointer)
+    BaseType_t xAllowAdvance = (pxRingbuffer->uxFlags & rbcBUFFER_FULL_FLAG) ? pdTRUE : pdFALSE;
+    BaseType_t xFreedAny = pdFALSE;
+
+    while (((pxCurHeader->uxItemFlags & (rbcITEM_FREE_FLAG | rbcITEM_DUMMY_DATA_FLAG)) != 0) &&
+            ((pxRingbuffer->pucFree != pxRingbuffer->pucWrite) || xAllowAdvance)) {
+
+        xAllowAdvance = pdFALSE;
+        xFreedAny = pdTRUE;
+
+        if (pxCurHeader->uxItemFlags & rbcITEM_DUMMY_DATA_FLAG) {
+            pxCurHeader->uxItemFlags |= rbcITEM_FREE_FLAG;      //Mark as freed (adds redundancy)
+            pxRingbuffer->pucFree = pxRingbuffer->pucHead;      //Wrap around due to dummy data
+        } else {
+            //Item that has been returned by all consumers, advance free pointer past it
+            pxRingbuffer->pucFree += rbcHEADER_SIZE + rbcALIGN_SIZE(pxCurHeader->xItemLen);
+            configASSERT(pxRingbuffer->pucFree <= pxRingbuffer->pucHead + pxRingbuffer->xSize);
+        }
+        //Check if pucFree requires wrap around
+        if ((pxRingbuffer->pucTail - pxRingbuffer->pucFree) < rbcHEADER_SIZE) {
+            pxRingbuffer->pucFree = pxRingbuffer->pucHead;
+        }
+        pxCurHeader = (BroadcastItemHeader_t *)pxRingbuffer->pucFree;
+    }
+
+    if ((pxRingbuffer->uxFlags & rbcBUFFER_FULL_FLAG) && xFreedAny) {
+        pxRingbuffer->uxFlags &= ~rbcBUFFER_FULL_FLAG;
+    }
+}
+
+/*
+ * Clear a consumer's pending bit from every item currently in the buffer,
+ * marking items free when no other consumer still holds them. Used when a
+ * consumer is evicted or unregistered.
+ */
+static void prvBroadcastReleaseConsumerItems(BroadcastRingbuffer_t *pxRingbuffer, UBaseType_t uxConsumerBit)
+{
+    if ((pxRingbuffer->pucFree == pxRingbuffer->pucWrite) && ((pxRingbuffer->uxFlags & rbcBUFFER_FULL_FLAG) == 0)) {
+        return;     //Buffer is empty
+    }
+
+    uint8_t *pucCur = pxRingbuffer->pucFree;
+    do {
+        BroadcastItemHeader_t *pxHeader = (BroadcastItemHeader_t *)pucCur;
+        if (pxHeader->uxItemFlags & rbcITEM_DUMMY_DATA_FLAG) {
+            pucCur = pxRingbuffer->pucHead;     //Wrap around due to dummy data
+        } else {
+            if (pxHeader->uxPendingMask & uxConsumerBit) {
+                pxHeader->uxPendingMask &= ~uxConsumerBit;
+                if (pxHeader->uxPendingMask == 0) {
+                    pxHeader->uxItemFlags |= rbcITEM_FREE_FLAG;
+                }
+            }
+            pucCur += rbcHEADER_SIZE + rbcALIGN_SIZE(pxHeader->xItemLen);
+        }
+        //Check if pucCur requires wrap around
+        if ((pxRingbuffer->pucTail - pucCur) < rbcHEADER_SIZE) {
+            pucCur = pxRingbuffer->pucHead;
+        }
+    } while (pucCur != pxRingbuffer->pucWrite);
+
+    prvBroadcastRetireFreedItems(pxRingbuffer);
+}
+
+//Evict a single consumer, releasing the items pending for it
+static void prvBroadcastEvictConsumer(BroadcastRingbuffer_t *pxRingbuffer, UBaseType_t uxIndex)
+{
+    BroadcastConsumer_t *pxConsumer = &pxRingbuffer->pxConsumers[uxIndex];
+    configASSERT(pxConsumer->xInUse == pdTRUE && pxConsumer->xEvicted == pdFALSE);
+
+    pxConsumer->xEvicted = pdTRUE;
+    pxConsumer->uxLag = 0;
+    prvBroadcastReleaseConsumerItems(pxRingbuffer, (UBaseType_t) 1 << uxIndex);
+}
+
+//Evict every consumer whose lag has reached xMaxLag. Returns the number of consumers evicted.
+static UBaseType_t prvBroadcastEvictStalled(BroadcastRingbuffer_t *pxRingbuffer, size_t xMaxLag)
+{
+    UBaseType_t uxEvicted = 0;
+    for (UBaseType_t i = 0; i < pxRingbuffer->uxMaxConsumers; i++) {
+        BroadcastConsumer_t *pxConsumer = &pxRingbuffer->pxConsumers[i];
+        if (pxConsumer->xInUse == pdTRUE && pxConsumer->xEvicted == pdFALSE && pxConsumer->uxLag >= xMaxLag) {
+            prvBroadcastEvictConsumer(pxRingbuffer, i);
+            uxEvicted++;
+        }
+    }
+    return uxEvicted;
+}
+
+/*
+ * Copy an item into the buffer and deliver it to all consumers in uxPendingMask.
+ * Must have already guaranteed the item fits by calling prvBroadcastCheckItemFits().
+ */
+static void prvBroadcastCopyItem(BroadcastRingbuffer_t *pxRingbuffer, const uint8_t *pucItem, size_t xItemSize, UBaseType_t uxPendingMask)
+{
+    size_t xAlignedItemSize = rbcALIGN_SIZE(xItemSize);
+    size_t xRemLen = pxRingbuffer->pucTail - pxRingbuffer->pucWrite;
+    configASSERT(xRemLen >= rbcHEADER_SIZE);
+
+    //If remaining length can't fit item, set as dummy data and wrap around
+    if (xRemLen < xAlignedItemSize + rbcHEADER_SIZE) {
+        BroadcastItemHeader_t *pxDummy = (BroadcastItemHeader_t *)pxRingbuffer->pucWrite;
+        pxDummy->uxItemFlags = rbcITEM_DUMMY_DATA_FLAG;
+        pxDummy->xItemLen = 0;
+        pxDummy->uxPendingMask = 0;
+        pxRingbuffer->pucWrite = pxRingbuffer->pucHead;     //Reset write pointer to wrap around
+    }
+
+    //Item should be guaranteed to fit at this point. Set item header and copy data
+    BroadcastItemHeader_t *pxHeader = (BroadcastItemHeader_t *)pxRingbuffer->pucWrite;
+    pxHeader->xItemLen = xItemSize;
+    pxHeader->uxItemFlags = rbcITEM_WRITTEN_FLAG;
+    pxHeader->uxPendingMask = uxPendingMask;
+    memcpy(pxRingbuffer->pucWrite + rbcHEADER_SIZE, pucItem, xItemSize);
+    pxRingbuffer->pucWrite += rbcHEADER_SIZE + xAlignedItemSize;
+
+    //If current remaining length can't fit a header, wrap around write pointer
+    if ((pxRingbuffer->pucTail - pxRingbuffer->pucWrite) < rbcHEADER_SIZE) {
+        pxRingbuffer->pucWrite = pxRingbuffer->pucHead;
+    }
+    //Check if buffer is full
+    if (pxRingbuffer->pucWrite == pxRingbuffer->pucFree) {
+        pxRingbuffer->uxFlags |= rbcBUFFER_FULL_FLAG;
+    }
+
+    if (uxPendingMask == 0) {
+        //No consumers registered, the item is immediately reclaimable
+        pxHeader->uxItemFlags |= rbcITEM_FREE_FLAG;
+        prvBroadcastRetireFreedItems(pxRingbuffer);
+    } else {
+        //Account the item as delivered to every consumer in the mask
+        for (UBaseType_t i = 0; i < pxRingbuffer->uxMaxConsumers; i++) {
+            if (uxPendingMask & ((UBaseType_t) 1 << i)) {
+                pxRingbuffer->pxConsumers[i].uxLag++;
+            }
+        }
+    }
+}
+
+//Retrieve the next pending item for a consumer. Must have already checked uxLag > 0
+static void *prvBroadcastGetItem(BroadcastRingbuffer_t *pxRingbuffer, BroadcastConsumer_t *pxConsumer, size_t *pxItemSize)
+{
+    BroadcastItemHeader_t *pxHeader = (BroadcastItemHeader_t *)pxConsumer->pucRead;
+    configASSERT(pxConsumer->uxLag > 0);
+
+    //Wrap around if dummy data
+    while (pxHeader->uxItemFlags & rbcITEM_DUMMY_DATA_FLAG) {
+        pxConsumer->pucRead = pxRingbuffer->pucHead;
+        pxHeader = (BroadcastItemHeader_t *)pxConsumer->pucRead;
+    }
+    configASSERT(pxHeader->uxItemFlags & rbcITEM_WRITTEN_FLAG);
+    configASSERT(pxHeader->xItemLen <= pxRingbuffer->xMaxItemSize);
+
+    uint8_t *pucReturn = pxConsumer->pucRead + rbcHEADER_SIZE;
+    *pxItemSize = pxHeader->xItemLen;
+    pxConsumer->uxLag--;
+
+    pxConsumer->pucRead += rbcHEADER_SIZE + rbcALIGN_SIZE(pxHeader->xItemLen);
+    //Check if pucRead requires wrap around
+    if ((pxRingbuffer->pucTail - pxConsumer->pucRead) < rbcHEADER_SIZE) {
+        pxConsumer->pucRead = pxRingbuffer->pucHead;
+    }
+    return (void *)pucReturn;
+}
+
+//Unblock every task on a waiting list. Returns pdTRUE if an unblocked task should preempt us
+static BaseType_t prvBroadcastWakeAllWaiting(List_t *pxList)
+{
+    BaseType_t xHigherPriorityWoken = pdFALSE;
+    while (listLIST_IS_EMPTY(pxList) == pdFALSE) {
+        if (xTaskRemoveFromEventList(pxList) == pdTRUE) {
+            xHigherPriorityWoken = pdTRUE;
+        }
+    }
+    return xHigherPriorityWoken;
+}
+
+// ------------------------------------------------ Public Functions ---------------------------------------------------
+
+RingbufBroadcastHandle_t xRingbufferBroadcastCreate(size_t xBufferSize, UBaseType_t uxMaxConsumers, size_t uxStalledLagLimit)
+{
+    configASSERT(xBufferSize > 0);
+    configASSERT(uxMaxConsumers > 0 && uxMaxConsumers <= RINGBUF_BROADCAST_MAX_CONSUMERS);
+
+    xBufferSize = rbcALIGN_SIZE(xBufferSize);
+    BroadcastRingbuffer_t *pxNewRingbuffer = calloc(1, sizeof(BroadcastRingbuffer_t));
+    BroadcastConsumer_t *pxConsumers = calloc(uxMaxConsumers, sizeof(BroadcastConsumer_t));
+    uint8_t *pucRingbufferStorage = malloc(xBufferSize);
+    if (pxNewRingbuffer == NULL || pxConsumers == NULL || pucRingbufferStorage == NULL) {
+        goto err;
+    }
+
+    pxNewRingbuffer->xSize = xBufferSize;
+    pxNewRingbuffer->pucHead = pucRingbufferStorage;
+    pxNewRingbuffer->pucTail = pucRingbufferStorage + xBufferSize;
+    pxNewRingbuffer->pucWrite = pucRingbufferStorage;
+    pxNewRingbuffer->pucFree = pucRingbufferStorage;
+    pxNewRingbuffer->uxFlags = 0;
+    pxNewRingbuffer->uxStalledLagLimit = uxStalledLagLimit;
+    pxNewRingbuffer->uxMaxConsumers = uxMaxConsumers;
+    pxNewRingbuffer->pxConsumers = pxConsumers;
+    /*
+     * Worst case scenario is when the write/free pointers are both pointing
+     * to the halfway point of the buffer (same as a no-split ring buffer).
+     */
+    pxNewRingbuffer->xMaxItemSize = rbcALIGN_SIZE(pxNewRingbuffer->xSize / 2) - rbcHEADER_SIZE;
+
+    vListInitialise(&pxNewRingbuffer->xTasksWaitingToSend);
+    vListInitialise(&pxNewRingbuffer->xTasksWaitingToReceive);
+    portMUX_INITIALIZE(&pxNewRingbuffer->mux);
+
+    return (RingbufBroadcastHandle_t)pxNewRingbuffer;
+
+err:
+    //An error has occurred, Free memory and return NULL
+    free(pxNewRingbuffer);
+    free(pxConsumers);
+    free(pucRingbufferStorage);
+    return NULL;
+}
+
+void vRingbufferBroadcastDelete(RingbufBroadcastHandle_t xRingbuffer)
+{
+    BroadcastRingbuffer_t *pxRingbuffer = (BroadcastRingbuffer_t *)xRingbuffer;
+    configASSERT(pxRingbuffer);
+    for (UBaseType_t i = 0; i < pxRingbuffer->uxMaxConsumers; i++) {
+        configASSERT(pxRingbuffer->pxConsumers[i].xInUse == pdFALSE);
+    }
+
+    free(pxRingbuffer->pucHead);
+    free(pxRingbuffer->pxConsumers);
+    free(pxRingbuffer);
+}
+
+RingbufBroadcastConsumerHandle_t xRingbufferBroadcastRegister(RingbufBroadcastHandle_t xRingbuffer)
+{
+    BroadcastRingbuffer_t *pxRingbuffer = (BroadcastRingbuffer_t *)xRingbuffer;
+    configASSERT(pxRingbuffer);
+
+    BroadcastConsumer_t *pxConsumer = NULL;
+    portENTER_CRITICAL(&pxRingbuffer->mux);
+    for (UBaseType_t i = 0; i < pxRingbuffer->uxMaxConsumers; i++) {
+        if (pxRingbuffer->pxConsumers[i].xInUse == pdFALSE) {
+            pxConsumer = &pxRingbuffer->pxConsumers[i];
+            pxConsumer->pxRingbuffer = pxRingbuffer;
+            pxConsumer->pucRead = pxRingbuffer->pucWrite;   //Only items sent after registration are delivered
+            pxConsumer->uxLag = 0;
+            pxConsumer->xEvicted = pdFALSE;
+            pxConsumer->xInUse = pdTRUE;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&pxRingbuffer->mux);
+
+    return (RingbufBroadcastConsumerHandle_t)pxConsumer;
+}
+
+void vRingbufferBroadcastUnregister(RingbufBroadcastConsumerHandle_t xConsumer)
+{
+    BroadcastConsumer_t *pxConsumer = (BroadcastConsumer_t *)xConsumer;
+    configASSERT(pxConsumer && pxConsumer->xInUse == pdTRUE);
+    BroadcastRingbuffer_t *pxRingbuffer = pxConsumer->pxRingbuffer;
+
+    portENTER_CRITICAL(&pxRingbuffer->mux);
+    if (pxConsumer->xEvicted == pdFALSE) {
+        //Release the items still pending for this consumer
+        UBaseType_t uxIndex = (UBaseType_t)(pxConsumer - pxRingbuffer->pxConsumers);
+        prvBroadcastReleaseConsumerItems(pxRingbuffer, (UBaseType_t) 1 << uxIndex);
+    }
+    pxConsumer->xInUse = pdFALSE;
+    pxConsumer->xEvicted = pdFALSE;
+    pxConsumer->uxLag = 0;
+    //Releasing items may have freed space for a blocked producer
+    if (prvBroadcastWakeAllWaiting(&pxRingbuffer->xTasksWaitingToSend) == pdTRUE) {
+        portYIELD_WITHIN_API();
+    }
+    portEXIT_CRITICAL(&pxRingbuffer->mux);
+}
+
+BaseType_t xRingbufferBroadcastSend(RingbufBroadcastHandle_t xRingbuffer, const void *pvItem, size_t xItemSize, TickType_t xTicksToWait)
+{
+    BroadcastRingbuffer_t *pxRingbuffer = (BroadcastRingbuffer_t *)xRingbuffer;
+    configASSERT(pxRingbuffer && pvItem);
+
+    if (xItemSize > pxRingbuffer->xMaxItemSize) {
+        return pdFALSE;     //Data will never ever fit in the queue.
+    }
+
+    BaseType_t xReturn = pdFALSE;
+    BaseType_t xExitLoop = pdFALSE;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+
+    while (xExitLoop == pdFALSE) {
+        portENTER_CRITICAL(&pxRingbuffer->mux);
+        if (prvBroadcastCheckItemFits(pxRingbuffer, xItemSize) == pdFALSE && pxRingbuffer->uxStalledLagLimit > 0) {
+            //Try to make room by evicting consumers that have stalled
+            prvBroadcastEvictStalled(pxRingbuffer, pxRingbuffer->uxStalledLagLimit);
+        }
+        if (prvBroadcastCheckItemFits(pxRingbuffer, xItemSize) == pdTRUE) {
+            prvBroadcastCopyItem(pxRingbuffer, pvItem, xItemSize, prvActiveConsumerMask(pxRingbuffer));
+            //Unblock all consumers waiting for an item, each has its own copy to retrieve
+            if (prvBroadcastWakeAllWaiting(&pxRingbuffer->xTasksWaitingToReceive) == pdTRUE) {
+                //An unblocked task will preempt us. Trigger a yield here.
+                portYIELD_WITHIN_API();
+            }
+            xReturn = pdTRUE;
+            xExitLoop = pdTRUE;
+            goto loop_end;
+        } else if (xTicksToWait == (TickType_t) 0) {
+            //No block time. Return immediately.
+            xExitLoop = pdTRUE;
+            goto loop_end;
+        } else if (xEntryTimeSet == pdFALSE) {
+            //This is our first block. Set entry time
+            vTaskInternalSetTimeOutState(&xTimeOut);
+            xEntryTimeSet = pdTRUE;
+        }
+
+        if (xTaskCheckForTimeOut(&xTimeOut, &xTicksToWait) == pdFALSE) {
+            //Not timed out yet. Block the current task
+            vTaskPlaceOnEventList(&pxRingbuffer->xTasksWaitingToSend, xTicksToWait);
+            portYIELD_WITHIN_API();
+        } else {
+            //We have timed out
+            xExitLoop = pdTRUE;
+        }
+loop_end:
+        portEXIT_CRITICAL(&pxRingbuffer->mux);
+    }
+
+    return xReturn;
+}
+
+void *xRingbufferBroadcastReceive(RingbufBroadcastConsumerHandle_t xConsumer, size_t *pxItemSize, TickType_t xTicksToWait)
+{
+    BroadcastConsumer_t *pxConsumer = (BroadcastConsumer_t *)xConsumer;
+    configASSERT(pxConsumer && pxConsumer->xInUse == pdTRUE && pxItemSize);
+    BroadcastRingbuffer_t *pxRingbuffer = pxConsumer->pxRingbuffer;
+
+    void *pvReturn = NULL;
+    BaseType_t xExitLoop = pdFALSE;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+
+    while (xExitLoop == pdFALSE) {
+        portENTER_CRITICAL(&pxRingbuffer->mux);
+        if (pxConsumer->xEvicted == pdTRUE) {
+            //Evicted consumers no longer receive items
+            xExitLoop = pdTRUE;
+            goto loop_end;
+        }
+        if (pxConsumer->uxLag > 0) {
+            pvReturn = prvBroadcastGetItem(pxRingbuffer, pxConsumer, pxItemSize);
+            xExitLoop = pdTRUE;
+            goto loop_end;
+        } else if (xTicksToWait == (TickType_t) 0) {
+            //No block time. Return immediately.
+            xExitLoop = pdTRUE;
+            goto loop_end;
+        } else if (xEntryTimeSet == pdFALSE) {
+            //This is our first block. Set entry time
+            vTaskInternalSetTimeOutState(&xTimeOut);
+            xEntryTimeSet = pdTRUE;
+        }
+
+        if (xTaskCheckForTimeOut(&xTimeOut, &xTicksToWait) == pdFALSE) {
+            //Not timed out yet. Block the current task
+            vTaskPlaceOnEventList(&pxRingbuffer->xTasksWaitingToReceive, xTicksToWait);
+            portYIELD_WITHIN_API();
+        } else {
+            //We have timed out.
+            xExitLoop = pdTRUE;
+        }
+loop_end:
+        portEXIT_CRITICAL(&pxRingbuffer->mux);
+    }
+
+    return pvReturn;
+}
+
+void vRingbufferBroadcastReturnItem(RingbufBroadcastConsumerHandle_t xConsumer, void *pvItem)
+{
+    BroadcastConsumer_t *pxConsumer = (BroadcastConsumer_t *)xConsumer;
+    configASSERT(pxConsumer && pxConsumer->xInUse == pdTRUE && pvItem);
+    BroadcastRingbuffer_t *pxRingbuffer = pxConsumer->pxRingbuffer;
+    configASSERT(rbcCHECK_ALIGNED(pvItem));
+    configASSERT((uint8_t *)pvItem >= pxRingbuffer->pucHead && (uint8_t *)pvItem < pxRingbuffer->pucTail);
+
+    UBaseType_t uxConsumerBit = (UBaseType_t) 1 << (pxConsumer - pxRingbuffer->pxConsumers);
+
+    portENTER_CRITICAL(&pxRingbuffer->mux);
+    BroadcastItemHeader_t *pxHeader = (BroadcastItemHeader_t *)((uint8_t *)pvItem - rbcHEADER_SIZE);
+    configASSERT(pxHeader->xItemLen <= pxRingbuffer->xMaxItemSize);
+    configASSERT((pxHeader->uxItemFlags & rbcITEM_DUMMY_DATA_FLAG) == 0);   //Dummy items should never have been read
+    /*
+     * If the consumer was evicted between retrieving and returning the item,
+     * its pending bit has already been cleared on its behalf. Ignore the
+     * return in that case.
+     */
+    if (pxHeader->uxPendingMask & uxConsumerBit) {
+        pxHeader->uxPendingMask &= ~uxConsumerBit;
+        if (pxHeader->uxPendingMask == 0) {
+            pxHeader->uxItemFlags |= rbcITEM_FREE_FLAG;     //All consumers have returned the item
+            prvBroadcastRetireFreedItems(pxRingbuffer);
+            //If a task was waiting for space to send, unblock it immediately
+            if (prvBroadcastWakeAllWaiting(&pxRingbuffer->xTasksWaitingToSend) == pdTRUE) {
+                portYIELD_WITHIN_API();
+            }
+        }
+    }
+    portEXIT_CRITICAL(&pxRingbuffer->mux);
+}
+
+size_t uxRingbufferBroadcastGetLag(RingbufBroadcastConsumerHandle_t xConsumer)
+{
+    BroadcastConsumer_t *pxConsumer = (BroadcastConsumer_t *)xConsumer;
+    configASSERT(pxConsumer && pxConsumer->xInUse == pdTRUE);
+
+    portENTER_CRITICAL(&pxConsumer->pxRingbuffer->mux);
+    size_t uxLag = pxConsumer->uxLag;
+    portEXIT_CRITICAL(&pxConsumer->pxRingbuffer->mux);
+    return uxLag;
+}
+
+BaseType_t xRingbufferBroadcastIsEvicted(RingbufBroadcastConsumerHandle_t xConsumer)
+{
+    BroadcastConsumer_t *pxConsumer = (BroadcastConsumer_t *)xConsumer;
+    configASSERT(pxConsumer && pxConsumer->xInUse == pdTRUE);
+
+    portENTER_CRITICAL(&pxConsumer->pxRingbuffer->mux);
+    BaseType_t xEvicted = pxConsumer->xEvicted;
+    portEXIT_CRITICAL(&pxConsumer->pxRingbuffer->mux);
+    return xEvicted;
+}
+
+UBaseType_t uxRingbufferBroadcastEvictStalled(RingbufBroadcastHandle_t xRingbuffer, size_t xMaxLag)
+{
+    BroadcastRingbuffer_t *pxRingbuffer = (BroadcastRingbuffer_t *)xRingbuffer;
+    configASSERT(pxRingbuffer);
+
+    portENTER_CRITICAL(&pxRingbuffer->mux);
+    UBaseType_t uxEvicted = prvBroadcastEvictStalled(pxRingbuffer, xMaxLag);
+    if (uxEvicted > 0) {
+        //Releasing items may have freed space for a blocked producer
+        if (prvBroadcastWakeAllWaiting(&pxRingbuffer->xTasksWaitingToSend) == pdTRUE) {
+            portYIELD_WITHIN_API();
+        }
+    }
+    portEXIT_CRITICAL(&pxRingbuffer->mux);
+    return uxEvicted;
+}
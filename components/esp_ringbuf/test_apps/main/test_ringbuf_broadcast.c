@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Unit tests for the broadcast (multi-consumer) ring buffer. These run on
+ * both the chip target as well as on the Linux target.
+ */
+
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/ringbuf_broadcast.h"
+#include "unity.h"
+
+#include "test_functions.h"
+
+#define BCAST_TIMEOUT_TICKS         10
+#define BCAST_BUFFER_SIZE           160
+
+static void receive_check_and_return_all(RingbufBroadcastConsumerHandle_t consumer, const uint8_t *expected_data, size_t expected_size, size_t expected_count)
+{
+    for (size_t i = 0; i < expected_count; i++) {
+        size_t item_size;
+        void *item = xRingbufferBroadcastReceive(consumer, &item_size, BCAST_TIMEOUT_TICKS);
+        TEST_ASSERT_NOT_NULL_MESSAGE(item, "Failed to receive item");
+        TEST_ASSERT_EQUAL(expected_size, item_size);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_data, item, item_size);
+        vRingbufferBroadcastReturnItem(consumer, item);
+    }
+}
+
+TEST_CASE("Broadcast ring buffer delivers every item to every consumer", "[esp_ringbuf][linux]")
+{
+    RingbufBroadcastHandle_t buffer = xRingbufferBroadcastCreate(BCAST_BUFFER_SIZE, 3, 0);
+    TEST_ASSERT_NOT_NULL(buffer);
+    RingbufBroadcastConsumerHandle_t consumer_a = xRingbufferBroadcastRegister(buffer);
+    RingbufBroadcastConsumerHandle_t consumer_b = xRingbufferBroadcastRegister(buffer);
+    TEST_ASSERT_NOT_NULL(consumer_a);
+    TEST_ASSERT_NOT_NULL(consumer_b);
+
+    //Each sent item must be delivered to both consumers
+    const size_t no_of_items = 3;
+    for (size_t i = 0; i < no_of_items; i++) {
+        TEST_ASSERT_EQUAL(pdTRUE, xRingbufferBroadcastSend(buffer, small_item, SMALL_ITEM_SIZE, BCAST_TIMEOUT_TICKS));
+    }
+    TEST_ASSERT_EQUAL(no_of_items, uxRingbufferBroadcastGetLag(consumer_a));
+    TEST_ASSERT_EQUAL(no_of_items, uxRingbufferBroadcastGetLag(consumer_b));
+
+    //Consumer A drains, consumer B still holds the items back
+    receive_check_and_return_all(consumer_a, small_item, SMALL_ITEM_SIZE, no_of_items);
+    TEST_ASSERT_EQUAL(0, uxRingbufferBroadcastGetLag(consumer_a));
+    TEST_ASSERT_EQUAL(no_of_items, uxRingbufferBroadcastGetLag(consumer_b));
+
+    //Once the slowest consumer drains too, both are caught up
+    receive_check_and_return_all(consumer_b, small_item, SMALL_ITEM_SIZE, no_of_items);
+    TEST_ASSERT_EQUAL(0, uxRingbufferBroadcastGetLag(consumer_b));
+
+    //A consumer registered mid-stream only sees items sent after registration
+    RingbufBroadcastConsumerHandle_t consumer_c = xRingbufferBroadcastRegister(buffer);
+    TEST_ASSERT_NOT_NULL(consumer_c);
+    TEST_ASSERT_EQUAL(pdTRUE, xRingbufferBroadcastSend(buffer, small_item, SMALL_ITEM_SIZE, BCAST_TIMEOUT_TICKS));
+    TEST_ASSERT_EQUAL(1, uxRingbufferBroadcastGetLag(consumer_c));
+    receive_check_and_return_all(consumer_a, small_item, SMALL_ITEM_SIZE, 1);
+    receive_check_and_return_all(consumer_b, small_item, SMALL_ITEM_SIZE, 1);
+    receive_check_and_return_all(consumer_c, small_item, SMALL_ITEM_SIZE, 1);
+
+    vRingbufferBroadcastUnregister(consumer_a);
+    vRingbufferBroadcastUnregister(consumer_b);
+    vRingbufferBroadcastUnregister(consumer_c);
+    vRingbufferBroadcastDelete(buffer);
+}
+
+TEST_CASE("Broadcast ring buffer retires items with the slowest consumer", "[esp_ringbuf][linux]")
+{
+    RingbufBroadcastHandle_t buffer = xRingbufferBroadcastCreate(BCAST_BUFFER_SIZE, 2, 0);
+    TEST_ASSERT_NOT_NULL(buffer);
+    RingbufBroadcastConsumerHandle_t consumer_fast = xRingbufferBroadcastRegister(buffer);
+    RingbufBroadcastConsumerHandle_t consumer_slow = xRingbufferBroadcastRegister(buffer);
+    TEST_ASSERT_NOT_NULL(consumer_fast);
+    TEST_ASSERT_NOT_NULL(consumer_slow);
+
+    //Fill the buffer. The fast consumer returns every item, the slow one never retrieves
+    size_t no_of_items = 0;
+    while (xRingbufferBroadcastSend(buffer, small_item, SMALL_ITEM_SIZE, 0) == pdTRUE) {
+        receive_check_and_return_all(consumer_fast, small_item, SMALL_ITEM_SIZE, 1);
+        no_of_items++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, no_of_items);
+    //Storage is only reclaimed once the slow consumer returns items, so sends keep failing
+    TEST_ASSERT_EQUAL(pdFALSE, xRingbufferBroadcastSend(buffer, small_item, SMALL_ITEM_SIZE, 0));
+    TEST_ASSERT_EQUAL(no_of_items, uxRingbufferBroadcastGetLag(consumer_slow));
+
+    //Evicting the stalled consumer releases its items and unblocks the producer
+    TEST_ASSERT_EQUAL(1, uxRingbufferBroadcastEvictStalled(buffer, 1));
+    TEST_ASSERT_EQUAL(pdTRUE, xRingbufferBroadcastIsEvicted(consumer_slow));
+    size_t item_size;
+    TEST_ASSERT_NULL(xRingbufferBroadcastReceive(consumer_slow, &item_size, 0));
+    TEST_ASSERT_EQUAL(pdTRUE, xRingbufferBroadcastSend(buffer, small_item, SMALL_ITEM_SIZE, 0));
+    receive_check_and_return_all(consumer_fast, small_item, SMALL_ITEM_SIZE, 1);
+
+    vRingbufferBroadcastUnregister(consumer_fast);
+    vRingbufferBroadcastUnregister(consumer_slow);
+    vRingbufferBroadcastDelete(buffer);
+}
+
+TEST_CASE("Broadcast ring buffer auto-evicts stalled consumers", "[esp_ringbuf][linux]")
+{
+    //Stall limit of 2: a send that does not fit evicts consumers lagging by 2 or more items
+    RingbufBroadcastHandle_t buffer = xRingbufferBroadcastCreate(BCAST_BUFFER_SIZE, 2, 2);
+    TEST_ASSERT_NOT_NULL(buffer);
+    RingbufBroadcastConsumerHandle_t consumer_fast = xRingbufferBroadcastRegister(buffer);
+    RingbufBroadcastConsumerHandle_t consumer_slow = xRingbufferBroadcastRegister(buffer);
+    TEST_ASSERT_NOT_NULL(consumer_fast);
+    TEST_ASSERT_NOT_NULL(consumer_slow);
+
+    //Keep sending with the slow consumer stalled. The producer must never block:
+    //once the buffer fills up, the stalled consumer is evicted to make room
+    const size_t no_of_items = (2 * BCAST_BUFFER_SIZE) / SMALL_ITEM_SIZE;
+    for (size_t i = 0; i < no_of_items; i++) {
+        TEST_ASSERT_EQUAL(pdTRUE, xRingbufferBroadcastSend(buffer, small_item, SMALL_ITEM_SIZE, 0));
+        receive_check_and_return_all(consumer_fast, small_item, SMALL_ITEM_SIZE, 1);
+    }
+    TEST_ASSERT_EQUAL(pdTRUE, xRingbufferBroadcastIsEvicted(consumer_slow));
+    TEST_ASSERT_EQUAL(pdFALSE, xRingbufferBroadcastIsEvicted(consumer_fast));
+
+    vRingbufferBroadcastUnregister(consumer_fast);
+    vRingbufferBroadcastUnregister(consumer_slow);
+    vRingbufferBroadcastDelete(buffer);
+}
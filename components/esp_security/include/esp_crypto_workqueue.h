@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Crypto peripherals work can be queued for
+ *
+ * Each entry maps to one of the locks in esp_crypto_lock.h; peripherals not
+ * present on the target are rejected at submission time.
+ */
+typedef enum {
+    ESP_CRYPTO_WORK_PERIPH_SHA_AES = 0, /**< SHA/AES, sharing one lock and DMA channel */
+    ESP_CRYPTO_WORK_PERIPH_MPI,         /**< MPI/RSA */
+    ESP_CRYPTO_WORK_PERIPH_ECC,         /**< ECC */
+    ESP_CRYPTO_WORK_PERIPH_HMAC,        /**< HMAC (also takes the SHA/AES lock) */
+    ESP_CRYPTO_WORK_PERIPH_DS,          /**< Digital Signature (takes HMAC and MPI locks) */
+    ESP_CRYPTO_WORK_PERIPH_ECDSA,       /**< ECDSA */
+    ESP_CRYPTO_WORK_PERIPH_KEY_MGR,     /**< Key Manager */
+    ESP_CRYPTO_WORK_PERIPH_MAX,
+} esp_crypto_work_periph_t;
+
+/**
+ * @brief Work function, runs in the dispatcher task with the peripheral lock held
+ */
+typedef void (*esp_crypto_work_func_t)(void *arg);
+
+/**
+ * @brief Completion callback, runs in the dispatcher task after the work function returned
+ */
+typedef void (*esp_crypto_work_done_cb_t)(void *arg);
+
+/**
+ * @brief Per-peripheral work queue statistics
+ */
+typedef struct {
+    uint32_t submitted;     /*!< Work items accepted for this peripheral */
+    uint32_t completed;     /*!< Work items executed */
+    uint32_t queued_max;    /*!< Maximum number of items waiting at once */
+    uint64_t total_wait_us; /*!< Summed time between submission and execution start */
+    uint64_t max_wait_us;   /*!< Longest time an item waited for the peripheral */
+    uint64_t total_run_us;  /*!< Summed execution time of the work functions */
+} esp_crypto_workqueue_stats_t;
+
+/**
+ * @brief Submit a work item for a crypto peripheral
+ *
+ * The item is queued and the call returns immediately. The dispatcher task
+ * acquires the peripheral lock once per burst and runs queued items
+ * back-to-back, so submitters neither block on the lock nor pay one
+ * acquire/release per operation. The completion callback, if given, fires in
+ * the dispatcher task right after the work function returns.
+ *
+ * @param periph Peripheral the work needs
+ * @param work Function doing the peripheral access, must not block indefinitely
+ * @param work_arg Argument passed to work
+ * @param done_cb Completion callback, can be NULL
+ * @param done_arg Argument passed to done_cb
+ *
+ * @return
+ *      - ESP_OK: work item queued
+ *      - ESP_ERR_INVALID_ARG: work is NULL or periph out of range
+ *      - ESP_ERR_NOT_SUPPORTED: peripheral not present on this target
+ *      - ESP_ERR_NO_MEM: queue full or dispatcher could not be created
+ */
+esp_err_t esp_crypto_workqueue_submit(esp_crypto_work_periph_t periph,
+                                      esp_crypto_work_func_t work, void *work_arg,
+                                      esp_crypto_work_done_cb_t done_cb, void *done_arg);
+
+/**
+ * @brief Get the wait-time statistics of one peripheral's queue
+ *
+ * @param periph Peripheral to query
+ * @param[out] stats Filled with the counters collected since boot
+ *
+ * @return
+ *      - ESP_OK: on success
+ *      - ESP_ERR_INVALID_ARG: stats is NULL or periph out of range
+ */
+esp_err_t esp_crypto_workqueue_get_stats(esp_crypto_work_periph_t periph,
+                                         esp_crypto_workqueue_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,302 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/lock.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "soc/soc_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "esp_crypto_lock.h"
+#include "esp_crypto_workqueue.h"
+
+/*
+ * Queued asynchronous grants for the crypto peripheral locks. Submitters
+ * enqueue work descriptors instead of blocking on the locks in
+ * esp_crypto_lock.c; a dispatcher task takes each peripheral lock once per
+ * burst and runs the queued items back-to-back, then fires the completion
+ * callbacks. The blocking lock API stays usable in parallel - the dispatcher
+ * is just another contender for the same locks.
+ */
+
+static const char *TAG = "crypto_workq";
+
+typedef struct {
+    esp_crypto_work_func_t work;
+    void *work_arg;
+    esp_crypto_work_done_cb_t done_cb;
+    void *done_arg;
+    int64_t submit_us;
+} crypto_work_item_t;
+
+static QueueHandle_t s_queues[ESP_CRYPTO_WORK_PERIPH_MAX];
+static esp_crypto_workqueue_stats_t s_stats[ESP_CRYPTO_WORK_PERIPH_MAX];
+static SemaphoreHandle_t s_pending;
+static TaskHandle_t s_dispatcher;
+static _lock_t s_init_lock;
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static bool periph_supported(esp_crypto_work_periph_t periph)
+{
+    switch (periph) {
+#if defined(SOC_SHA_SUPPORTED) || defined(SOC_AES_SUPPORTED)
+    case ESP_CRYPTO_WORK_PERIPH_SHA_AES:
+        return true;
+#endif
+#ifdef SOC_MPI_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_MPI:
+        return true;
+#endif
+#ifdef SOC_ECC_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_ECC:
+        return true;
+#endif
+#ifdef SOC_HMAC_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_HMAC:
+        return true;
+#endif
+#ifdef SOC_DIG_SIGN_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_DS:
+        return true;
+#endif
+#ifdef SOC_ECDSA_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_ECDSA:
+        return true;
+#endif
+#ifdef SOC_KEY_MANAGER_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_KEY_MGR:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+static void periph_lock_acquire(esp_crypto_work_periph_t periph)
+{
+    switch (periph) {
+#if defined(SOC_SHA_SUPPORTED) || defined(SOC_AES_SUPPORTED)
+    case ESP_CRYPTO_WORK_PERIPH_SHA_AES:
+        esp_crypto_sha_aes_lock_acquire();
+        break;
+#endif
+#ifdef SOC_MPI_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_MPI:
+        esp_crypto_mpi_lock_acquire();
+        break;
+#endif
+#ifdef SOC_ECC_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_ECC:
+        esp_crypto_ecc_lock_acquire();
+        break;
+#endif
+#ifdef SOC_HMAC_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_HMAC:
+        esp_crypto_hmac_lock_acquire();
+        break;
+#endif
+#ifdef SOC_DIG_SIGN_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_DS:
+        esp_crypto_ds_lock_acquire();
+        break;
+#endif
+#ifdef SOC_ECDSA_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_ECDSA:
+        esp_crypto_ecdsa_lock_acquire();
+        break;
+#endif
+#ifdef SOC_KEY_MANAGER_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_KEY_MGR:
+        esp_crypto_key_manager_lock_acquire();
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+static void periph_lock_release(esp_crypto_work_periph_t periph)
+{
+    switch (periph) {
+#if defined(SOC_SHA_SUPPORTED) || defined(SOC_AES_SUPPORTED)
+    case ESP_CRYPTO_WORK_PERIPH_SHA_AES:
+        esp_crypto_sha_aes_lock_release();
+        break;
+#endif
+#ifdef SOC_MPI_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_MPI:
+        esp_crypto_mpi_lock_release();
+        break;
+#endif
+#ifdef SOC_ECC_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_ECC:
+        esp_crypto_ecc_lock_release();
+        break;
+#endif
+#ifdef SOC_HMAC_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_HMAC:
+        esp_crypto_hmac_lock_release();
+        break;
+#endif
+#ifdef SOC_DIG_SIGN_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_DS:
+        esp_crypto_ds_lock_release();
+        break;
+#endif
+#ifdef SOC_ECDSA_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_ECDSA:
+        esp_crypto_ecdsa_lock_release();
+        break;
+#endif
+#ifdef SOC_KEY_MANAGER_SUPPORTED
+    case ESP_CRYPTO_WORK_PERIPH_KEY_MGR:
+        esp_crypto_key_manager_lock_release();
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+static void run_item(esp_crypto_work_periph_t periph, crypto_work_item_t *item)
+{
+    int64_t start_us = esp_timer_get_time();
+    uint64_t wait_us = (uint64_t)(start_us - item->submit_us);
+
+    item->work(item->work_arg);
+    int64_t end_us = esp_timer_get_time();
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats[periph].completed++;
+    s_stats[periph].total_wait_us += wait_us;
+    if (wait_us > s_stats[periph].max_wait_us) {
+        s_stats[periph].max_wait_us = wait_us;
+    }
+    s_stats[periph].total_run_us += (uint64_t)(end_us - start_us);
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    if (item->done_cb != NULL) {
+        item->done_cb(item->done_arg);
+    }
+}
+
+static void dispatcher_task(void *arg)
+{
+    crypto_work_item_t item;
+
+    while (true) {
+        xSemaphoreTake(s_pending, portMAX_DELAY);
+        for (int periph = 0; periph < ESP_CRYPTO_WORK_PERIPH_MAX; periph++) {
+            if (s_queues[periph] == NULL || xQueueReceive(s_queues[periph], &item, 0) != pdTRUE) {
+                continue;
+            }
+            /* take the lock once and run everything queued for this
+             * peripheral back-to-back */
+            periph_lock_acquire(periph);
+            run_item(periph, &item);
+            while (xQueueReceive(s_queues[periph], &item, 0) == pdTRUE) {
+                /* consume the pending count of the extra item */
+                xSemaphoreTake(s_pending, 0);
+                run_item(periph, &item);
+            }
+            periph_lock_release(periph);
+            break;
+        }
+    }
+}
+
+static esp_err_t workqueue_init(void)
+{
+    esp_err_t err = ESP_OK;
+
+    _lock_acquire(&s_init_lock);
+    if (s_dispatcher != NULL) {
+        goto out;
+    }
+    s_pending = xSemaphoreCreateCounting(
+        ESP_CRYPTO_WORK_PERIPH_MAX * CONFIG_ESP_CRYPTO_WORKQUEUE_DEPTH, 0);
+    if (s_pending == NULL) {
+        err = ESP_ERR_NO_MEM;
+        goto out;
+    }
+    for (int periph = 0; periph < ESP_CRYPTO_WORK_PERIPH_MAX; periph++) {
+        if (!periph_supported(periph)) {
+            continue;
+        }
+        s_queues[periph] = xQueueCreate(CONFIG_ESP_CRYPTO_WORKQUEUE_DEPTH,
+                                        sizeof(crypto_work_item_t));
+        if (s_queues[periph] == NULL) {
+            err = ESP_ERR_NO_MEM;
+            goto out;
+        }
+    }
+    if (xTaskCreate(dispatcher_task, "crypto_workq",
+                    CONFIG_ESP_CRYPTO_WORKQUEUE_TASK_STACK_SIZE, NULL,
+                    CONFIG_ESP_CRYPTO_WORKQUEUE_TASK_PRIORITY, &s_dispatcher) != pdTRUE) {
+        ESP_LOGE(TAG, "failed to create dispatcher task");
+        err = ESP_ERR_NO_MEM;
+    }
+out:
+    _lock_release(&s_init_lock);
+    return err;
+}
+
+esp_err_t esp_crypto_workqueue_submit(esp_crypto_work_periph_t periph,
+                                      esp_crypto_work_func_t work, void *work_arg,
+                                      esp_crypto_work_done_cb_t done_cb, void *done_arg)
+{
+    if (work == NULL || periph < 0 || periph >= ESP_CRYPTO_WORK_PERIPH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!periph_supported(periph)) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (s_dispatcher == NULL) {
+        esp_err_t err = workqueue_init();
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    crypto_work_item_t item = {
+        .work = work,
+        .work_arg = work_arg,
+        .done_cb = done_cb,
+        .done_arg = done_arg,
+        .submit_us = esp_timer_get_time(),
+    };
+    if (xQueueSend(s_queues[periph], &item, 0) != pdTRUE) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats[periph].submitted++;
+    uint32_t queued = (uint32_t)uxQueueMessagesWaiting(s_queues[periph]);
+    if (queued > s_stats[periph].queued_max) {
+        s_stats[periph].queued_max = queued;
+    }
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    xSemaphoreGive(s_pending);
+    return ESP_OK;
+}
+
+esp_err_t esp_crypto_workqueue_get_stats(esp_crypto_work_periph_t periph,
+                                         esp_crypto_workqueue_stats_t *stats)
+{
+    if (stats == NULL || periph < 0 || periph >= ESP_CRYPTO_WORK_PERIPH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_stats_lock);
+    *stats = s_stats[periph];
+    portEXIT_CRITICAL(&s_stats_lock);
+    return ESP_OK;
+}
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Private interface between the console VFS glue (stdio_vfs.c) and the
+ * optional write-behind staging buffer (stdio_buffered.c). Console writes
+ * are copied into a RAM ring and drained to the underlying driver by a
+ * low priority task, so printf callers don't block on UART drain time.
+ */
+
+/**
+ * @brief Create the staging ring and the drain task
+ *
+ * Called once from esp_stdio_register(). Until this has run (or if it
+ * fails), console writes fall back to the direct synchronous path.
+ */
+void esp_stdio_buffered_init(void);
+
+/**
+ * @brief Stage console output for background draining
+ *
+ * Safe to call from any context: returns false (caller must write
+ * synchronously) when called from an ISR, before the drain task exists,
+ * or while the scheduler is suspended.
+ *
+ * @param data Bytes to stage
+ * @param size Number of bytes
+ * @return true if the bytes were accepted (possibly partially dropped,
+ *         depending on the configured full-buffer policy), false if the
+ *         caller must fall back to the direct write path
+ */
+bool esp_stdio_buffered_write(const void *data, size_t size);
+
+/**
+ * @brief Synchronously drain everything staged so far
+ *
+ * Used by fsync() on the console fd and on the final close. No-op when
+ * the staging buffer is not running or when called from an ISR.
+ */
+void esp_stdio_buffered_flush(void);
+
+/**
+ * @brief Number of bytes dropped because the staging buffer was full
+ *
+ * Only counts when CONFIG_ESP_CONSOLE_WRITE_BUFFER_DROP_ON_FULL is set;
+ * without the drop policy, writers block until space frees up.
+ */
+uint32_t esp_stdio_buffered_get_dropped_bytes(void);
+
+/**
+ * @brief Write console output directly to the underlying driver(s)
+ *
+ * Implemented by stdio_vfs.c; the drain task uses it to push staged
+ * bytes out without going through the staging buffer again.
+ */
+ssize_t esp_stdio_write_direct(const void *data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
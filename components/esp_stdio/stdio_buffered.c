@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_private/stdio_buffered.h"
+
+#if CONFIG_ESP_CONSOLE_WRITE_BUFFERED
+
+/*
+ * Write-behind staging buffer for console output. console_write() copies
+ * the bytes into a static ring and returns immediately; a task just above
+ * idle priority drains contiguous runs of the ring to the underlying
+ * driver. Draining is also reachable synchronously through
+ * esp_stdio_buffered_flush() (fsync on the console fd), serialized with
+ * the drain task by a mutex.
+ */
+
+#define STAGING_SIZE CONFIG_ESP_CONSOLE_WRITE_BUFFER_SIZE
+
+static const char *TAG = "stdio_buffered";
+
+static uint8_t s_staging[STAGING_SIZE];
+static size_t s_head; // next byte to fill
+static size_t s_tail; // next byte to drain
+static size_t s_used; // bytes currently staged
+static portMUX_TYPE s_ring_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static SemaphoreHandle_t s_data_sem;   // signals the drain task that bytes are staged
+static SemaphoreHandle_t s_space_sem;  // signals blocked writers that space freed up
+static SemaphoreHandle_t s_drain_mutex; // serializes the drain task and synchronous flushes
+static TaskHandle_t s_drain_task;
+static uint32_t s_dropped_bytes;
+
+static void drain_pending(void)
+{
+    xSemaphoreTake(s_drain_mutex, portMAX_DELAY);
+    while (true) {
+        portENTER_CRITICAL(&s_ring_lock);
+        size_t chunk = MIN(s_used, STAGING_SIZE - s_tail); // contiguous run up to the wrap point
+        size_t tail = s_tail;
+        portEXIT_CRITICAL(&s_ring_lock);
+        if (chunk == 0) {
+            break;
+        }
+        // the drain owner is the only consumer, so the run is stable while we write it out
+        esp_stdio_write_direct(s_staging + tail, chunk);
+        portENTER_CRITICAL(&s_ring_lock);
+        s_tail = (s_tail + chunk) % STAGING_SIZE;
+        s_used -= chunk;
+        portEXIT_CRITICAL(&s_ring_lock);
+        xSemaphoreGive(s_space_sem);
+    }
+    xSemaphoreGive(s_drain_mutex);
+}
+
+static void drain_task(void *arg)
+{
+    while (true) {
+        xSemaphoreTake(s_data_sem, portMAX_DELAY);
+        drain_pending();
+    }
+}
+
+static size_t stage_bytes(const uint8_t *data, size_t size)
+{
+    portENTER_CRITICAL(&s_ring_lock);
+    size_t space = STAGING_SIZE - s_used;
+    size_t copy_size = MIN(size, space);
+    size_t first = MIN(copy_size, STAGING_SIZE - s_head);
+    memcpy(s_staging + s_head, data, first);
+    memcpy(s_staging, data + first, copy_size - first);
+    s_head = (s_head + copy_size) % STAGING_SIZE;
+    s_used += copy_size;
+    portEXIT_CRITICAL(&s_ring_lock);
+    return copy_size;
+}
+
+bool esp_stdio_buffered_write(const void *data, size_t size)
+{
+    if (s_drain_task == NULL || xPortInIsrContext() ||
+            xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+        return false;
+    }
+    const uint8_t *bytes = (const uint8_t *)data;
+    size_t staged = stage_bytes(bytes, size);
+#if CONFIG_ESP_CONSOLE_WRITE_BUFFER_DROP_ON_FULL
+    if (staged < size) {
+        portENTER_CRITICAL(&s_ring_lock);
+        s_dropped_bytes += size - staged;
+        portEXIT_CRITICAL(&s_ring_lock);
+    }
+#else
+    while (staged < size) {
+        // buffer full: wait for the drain task to free up space
+        xSemaphoreGive(s_data_sem);
+        xSemaphoreTake(s_space_sem, portMAX_DELAY);
+        staged += stage_bytes(bytes + staged, size - staged);
+    }
+#endif
+    xSemaphoreGive(s_data_sem);
+    return true;
+}
+
+void esp_stdio_buffered_flush(void)
+{
+    if (s_drain_task == NULL || xPortInIsrContext() ||
+            xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+        return;
+    }
+    drain_pending();
+}
+
+uint32_t esp_stdio_buffered_get_dropped_bytes(void)
+{
+    return s_dropped_bytes;
+}
+
+void esp_stdio_buffered_init(void)
+{
+    s_data_sem = xSemaphoreCreateBinary();
+    s_space_sem = xSemaphoreCreateBinary();
+    s_drain_mutex = xSemaphoreCreateMutex();
+    if (!s_data_sem || !s_space_sem || !s_drain_mutex) {
+        ESP_LOGE(TAG, "no mem for staging buffer, console writes stay synchronous");
+        return;
+    }
+    // just above idle: console output only drains when nothing more urgent runs,
+    // which is exactly the point of decoupling printf from UART drain time
+    if (xTaskCreate(drain_task, "stdio_drain", 2560, NULL, tskIDLE_PRIORITY + 1, &s_drain_task) != pdTRUE) {
+        ESP_LOGE(TAG, "no mem for drain task, console writes stay synchronous");
+        s_drain_task = NULL;
+    }
+}
+
+#endif // CONFIG_ESP_CONSOLE_WRITE_BUFFERED
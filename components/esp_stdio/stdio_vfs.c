@@ -10,6 +10,7 @@
 #include "esp_rom_sys.h"
 #include "esp_stdio.h"
 #include <sys/errno.h>
+#include <sys/uio.h>
 #if CONFIG_VFS_SUPPORT_IO
 
 #if CONFIG_ESP_CONSOLE_USB_CDC
@@ -29,6 +30,9 @@
 
 #include "esp_private/startup_internal.h"
 #include "esp_private/nullfs.h"
+#if CONFIG_ESP_CONSOLE_WRITE_BUFFERED
+#include "esp_private/stdio_buffered.h"
+#endif
 #endif
 
 #define STRINGIFY(s) STRINGIFY2(s)
@@ -90,7 +94,7 @@ int console_open(const char * path, int flags, int mode)
     return 0;
 }
 
-ssize_t console_write(int fd, const void *data, size_t size)
+ssize_t esp_stdio_write_direct(const void *data, size_t size)
 {
     write(vfs_console.fd_primary, data, size);
 #if CONFIG_ESP_CONSOLE_SECONDARY_USB_SERIAL_JTAG
@@ -99,6 +103,41 @@ ssize_t console_write(int fd, const void *data, size_t size)
     return size;
 }
 
+ssize_t console_write(int fd, const void *data, size_t size)
+{
+#if CONFIG_ESP_CONSOLE_WRITE_BUFFERED
+    if (esp_stdio_buffered_write(data, size)) {
+        return size;
+    }
+    // staging not available (ISR, scheduler suspended, or init failed): fall through
+#endif
+    return esp_stdio_write_direct(data, size);
+}
+
+ssize_t console_writev(int fd, const struct iovec *iov, int iovcnt)
+{
+#if CONFIG_ESP_CONSOLE_WRITE_BUFFERED
+    // stage the segments one by one, so buffered and direct output can't interleave
+    ssize_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        if (!esp_stdio_buffered_write(iov[i].iov_base, iov[i].iov_len)) {
+            esp_stdio_write_direct(iov[i].iov_base, iov[i].iov_len);
+        }
+        total += iov[i].iov_len;
+    }
+    return total;
+#else
+    ssize_t ret = writev(vfs_console.fd_primary, iov, iovcnt);
+#if CONFIG_ESP_CONSOLE_SECONDARY_USB_SERIAL_JTAG
+    writev(vfs_console.fd_secondary, iov, iovcnt);
+#endif
+    return ret;
+#endif // CONFIG_ESP_CONSOLE_WRITE_BUFFERED
+}
+
 int console_fstat(int fd, struct stat * st)
 {
     return fstat(vfs_console.fd_primary, st);
@@ -118,6 +157,11 @@ int console_close(int fd)
         return 0;
     }
 
+#if CONFIG_ESP_CONSOLE_WRITE_BUFFERED
+    // push out whatever is still staged before the underlying fds go away
+    esp_stdio_buffered_flush();
+#endif
+
     // All function calls are to primary, except from write and close, which will be forwarded to both primary and secondary.
     close(vfs_console.fd_primary);
 #if CONFIG_ESP_CONSOLE_SECONDARY_USB_SERIAL_JTAG
@@ -131,6 +175,11 @@ ssize_t console_read(int fd, void * dst, size_t size)
     return read(vfs_console.fd_primary, dst, size);
 }
 
+ssize_t console_readv(int fd, const struct iovec *iov, int iovcnt)
+{
+    return readv(vfs_console.fd_primary, iov, iovcnt);
+}
+
 int console_fcntl(int fd, int cmd, int arg)
 {
     return fcntl(vfs_console.fd_primary, cmd, arg);
@@ -138,6 +187,10 @@ int console_fcntl(int fd, int cmd, int arg)
 
 int console_fsync(int fd)
 {
+#if CONFIG_ESP_CONSOLE_WRITE_BUFFERED
+    // fsync is the synchronous drain point: everything staged goes out before the driver-level sync
+    esp_stdio_buffered_flush();
+#endif
     const int ret_val = fsync(vfs_console.fd_primary);
 #if CONFIG_ESP_CONSOLE_SECONDARY_USB_SERIAL_JTAG
     (void)fsync(vfs_console.fd_secondary);
@@ -224,10 +277,12 @@ static const esp_vfs_termios_ops_t s_vfs_console_termios = {
 
 static const esp_vfs_fs_ops_t s_vfs_console = {
     .write = &console_write,
+    .writev = &console_writev,
     .open = &console_open,
     .fstat = &console_fstat,
     .close = &console_close,
     .read = &console_read,
+    .readv = &console_readv,
     .fcntl = &console_fcntl,
     .fsync = &console_fsync,
 
@@ -268,6 +323,11 @@ esp_err_t esp_stdio_register(void)
     secondary_vfs = esp_vfs_usb_serial_jtag_get_vfs();
 #endif
     err = esp_vfs_dev_console_register();
+#if CONFIG_ESP_CONSOLE_WRITE_BUFFERED
+    if (err == ESP_OK) {
+        esp_stdio_buffered_init();
+    }
+#endif
     return err;
 }
 
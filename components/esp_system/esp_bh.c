@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdkconfig.h"
+#include <assert.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_attr.h"
+#include "esp_private/esp_bh.h"
+#include "esp_private/esp_system_attr.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#if CONFIG_ESP_SYSTEM_BH_ENABLE
+
+#if CONFIG_COMPILER_OPTIMIZATION_NONE
+#define BH_STACK_SIZE (CONFIG_ESP_SYSTEM_BH_TASK_STACK_SIZE + 0x100)
+#else
+#define BH_STACK_SIZE (CONFIG_ESP_SYSTEM_BH_TASK_STACK_SIZE)
+#endif //CONFIG_COMPILER_OPTIMIZATION_NONE
+
+#define BH_QUEUE_LEN CONFIG_ESP_SYSTEM_BH_QUEUE_LEN
+
+typedef struct {
+    esp_bh_fn_t fn;   // work function, NULL while the slot is free
+    void *arg;        // argument for the work function
+} bh_work_item_t;
+
+typedef struct {
+    bh_work_item_t items[BH_QUEUE_LEN];
+    uint32_t head;    // next slot to fill, monotonically increasing
+    uint32_t tail;    // next slot to drain, monotonically increasing
+    TaskHandle_t task;
+    portMUX_TYPE lock;
+} bh_ring_t;
+
+/* One work ring per core; each ring is only pushed to from its own core
+ * (tasks and ISRs), and only drained by its own dispatch task. */
+static DRAM_ATTR bh_ring_t s_bh_ring[CONFIG_FREERTOS_NUMBER_OF_CORES];
+
+static void ESP_SYSTEM_IRAM_ATTR bh_task(void *arg)
+{
+    bh_ring_t *const ring = (bh_ring_t *)arg;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        while (true) {
+            bh_work_item_t item;
+            portENTER_CRITICAL(&ring->lock);
+            if (ring->tail == ring->head) {
+                portEXIT_CRITICAL(&ring->lock);
+                break;
+            }
+            item = ring->items[ring->tail % BH_QUEUE_LEN];
+            ring->tail++;
+            portEXIT_CRITICAL(&ring->lock);
+
+            (*item.fn)(item.arg);
+        }
+    }
+}
+
+esp_err_t esp_bh_schedule(esp_bh_fn_t fn, void *arg)
+{
+    if (fn == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    bh_ring_t *const ring = &s_bh_ring[xPortGetCoreID()];
+
+    portENTER_CRITICAL(&ring->lock);
+    if ((ring->head - ring->tail) >= BH_QUEUE_LEN) {
+        portEXIT_CRITICAL(&ring->lock);
+        return ESP_ERR_NO_MEM;
+    }
+    ring->items[ring->head % BH_QUEUE_LEN] = (bh_work_item_t) {
+        .fn = fn,
+        .arg = arg,
+    };
+    ring->head++;
+    portEXIT_CRITICAL(&ring->lock);
+
+    xTaskNotifyGive(ring->task);
+    return ESP_OK;
+}
+
+esp_err_t ESP_SYSTEM_IRAM_ATTR esp_bh_schedule_from_isr(esp_bh_fn_t fn, void *arg, bool *need_yield)
+{
+    if (fn == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    bh_ring_t *const ring = &s_bh_ring[xPortGetCoreID()];
+
+    portENTER_CRITICAL_ISR(&ring->lock);
+    if ((ring->head - ring->tail) >= BH_QUEUE_LEN) {
+        portEXIT_CRITICAL_ISR(&ring->lock);
+        return ESP_ERR_NO_MEM;
+    }
+    ring->items[ring->head % BH_QUEUE_LEN] = (bh_work_item_t) {
+        .fn = fn,
+        .arg = arg,
+    };
+    ring->head++;
+    portEXIT_CRITICAL_ISR(&ring->lock);
+
+    BaseType_t higher_prio_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(ring->task, &higher_prio_task_woken);
+    if (higher_prio_task_woken == pdTRUE && need_yield != NULL) {
+        *need_yield = true;
+    }
+    return ESP_OK;
+}
+
+/*
+ * Start one dispatch task per core. These tasks are normally blocked and
+ * only run when work has been scheduled on their core's ring.
+ */
+static void esp_bh_init(void) __attribute__((constructor));
+
+static void esp_bh_init(void)
+{
+    char task_name[] = "bhX"; // up to 10 bottom-half tasks/cores (0-9)
+
+    for (int i = 0; i < CONFIG_FREERTOS_NUMBER_OF_CORES; ++i) {
+        task_name[2] = i + (char)'0';
+        s_bh_ring[i].lock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+        BaseType_t res = xTaskCreatePinnedToCore(bh_task, task_name, BH_STACK_SIZE, &s_bh_ring[i],
+                                                 CONFIG_ESP_SYSTEM_BH_TASK_PRIORITY, &s_bh_ring[i].task, i);
+        assert(res == pdTRUE);
+        (void)res;
+    }
+}
+
+#endif // CONFIG_ESP_SYSTEM_BH_ENABLE
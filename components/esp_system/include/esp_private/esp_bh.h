@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Bottom-half work function
+ *
+ * Runs in the context of the scheduling core's dispatch task, with
+ * interrupts enabled. Must not block for long: all work items scheduled on
+ * the same core share one dispatch task.
+ */
+typedef void (*esp_bh_fn_t)(void *arg);
+
+/**
+ * @brief Schedule a work item on the current core's dispatch task
+ *
+ * The work item is placed into the core's work ring and executed by the
+ * per-core dispatch task in scheduling order.
+ *
+ * @param fn  function to execute in the dispatch task
+ * @param arg argument passed to fn
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if fn is NULL
+ *      - ESP_ERR_NO_MEM if the core's work ring is full
+ */
+esp_err_t esp_bh_schedule(esp_bh_fn_t fn, void *arg);
+
+/**
+ * @brief Schedule a work item from an ISR on the current core
+ *
+ * Safe to call from any interrupt whose priority allows FreeRTOS API use.
+ *
+ * @param fn         function to execute in the dispatch task
+ * @param arg        argument passed to fn
+ * @param need_yield set to true if a context switch should be requested
+ *                   before the ISR returns (may be NULL); never cleared,
+ *                   so the flag can be shared across several calls
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if fn is NULL
+ *      - ESP_ERR_NO_MEM if the core's work ring is full
+ */
+esp_err_t esp_bh_schedule_from_isr(esp_bh_fn_t fn, void *arg, bool *need_yield);
+
+#ifdef __cplusplus
+}
+#endif
@@ -44,10 +44,19 @@ void startup_resume_other_cores(void);
  */
 typedef struct {
     esp_err_t (*fn)(void);   /*!< Pointer to the startup function */
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER || CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT
+    const char *name;        /*!< Name of the startup function, used by the startup profiler and deferred init */
+#endif
     uint16_t cores;          /*!< Bit mask of cores where the function has to be called */
     uint16_t stage;          /*!< Init stage number (0 or 1) */
 } esp_system_init_fn_t;
 
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER || CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT
+#define ESP_SYSTEM_INIT_FN_NAME(f) .name = #f,
+#else
+#define ESP_SYSTEM_INIT_FN_NAME(f)
+#endif
+
 #define ESP_SYSTEM_INIT_STAGE_CORE          0
 #define ESP_SYSTEM_INIT_STAGE_SECONDARY     1
 
@@ -76,6 +85,7 @@ typedef struct {
     static __attribute__((used)) _SECTION_ATTR_IMPL(".esp_system_init_fn", priority) \
         esp_system_init_fn_t esp_system_init_fn_##f = { \
             .fn = ( __esp_system_init_fn_##f), \
+            ESP_SYSTEM_INIT_FN_NAME(f) \
             .cores = (c), \
             .stage = ESP_SYSTEM_INIT_STAGE_##stage_ \
         }; \
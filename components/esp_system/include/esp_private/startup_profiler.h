@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER || __DOXYGEN__
+
+/**
+ * Stage value recorded for global constructors, which run between the CORE
+ * and SECONDARY init stages and have no ESP_SYSTEM_INIT_STAGE_* number.
+ */
+#define ESP_STARTUP_PROFILER_STAGE_CTOR 0xff
+
+/**
+ * One recorded startup timeline entry
+ */
+typedef struct {
+    const char *name;          /*!< Name of the init function, or "ctor" for a global constructor */
+    const void *fn;            /*!< Address of the function */
+    uint8_t stage;             /*!< ESP_SYSTEM_INIT_STAGE_* value, or ESP_STARTUP_PROFILER_STAGE_CTOR */
+    uint8_t core;              /*!< Core the function was executed on */
+    uint32_t start_cycles;     /*!< CPU cycle count when the function was entered */
+    uint32_t duration_cycles;  /*!< CPU cycles spent inside the function */
+} esp_startup_profiler_entry_t;
+
+/**
+ * @brief Get the recorded startup timeline
+ *
+ * Entries are in recording order per core; entries recorded by different cores
+ * during the SECONDARY stage may interleave. Cycle counts are taken with
+ * esp_cpu_get_cycle_count() and therefore use the CPU frequency that was active
+ * at the time of recording.
+ *
+ * @param[out] count Set to the number of valid entries, may be NULL
+ * @return Pointer to the static entry table
+ */
+const esp_startup_profiler_entry_t *esp_startup_profiler_get_entries(size_t *count);
+
+/**
+ * @brief Print the recorded startup timeline to the console
+ *
+ * Called automatically before app_main when ESP_SYSTEM_STARTUP_PROFILER_LOG
+ * is enabled; can also be called again later from the application.
+ */
+void esp_startup_profiler_dump(void);
+
+/**
+ * @brief Add an entry to the startup timeline, used by the startup code
+ */
+void esp_startup_profiler_record(const char *name, const void *fn, uint32_t stage,
+                                 uint32_t start_cycles, uint32_t duration_cycles);
+
+#endif // CONFIG_ESP_SYSTEM_STARTUP_PROFILER || __DOXYGEN__
+
+#ifdef __cplusplus
+}
+#endif
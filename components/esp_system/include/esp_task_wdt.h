@@ -89,6 +89,24 @@ esp_err_t esp_task_wdt_deinit(void);
  */
 esp_err_t esp_task_wdt_add(TaskHandle_t task_handle);
 
+/**
+ * @brief Subscribe a task to the Task Watchdog Timer (TWDT) in passive mode
+ *
+ * A passively watched task does not need to call esp_task_wdt_reset(). Instead, the TWDT samples the task's run time
+ * counter (maintained by the scheduler's run time statistics) once per timeout period: as long as the task has been
+ * scheduled since the last sample, it is considered alive. This removes the reset call from the task's hot loop at
+ * the cost of coarser detection, i.e. a task that is scheduled but stuck in a loop that keeps running will not be
+ * detected, whereas a task that is never scheduled (e.g., blocked or starved) will still trigger a timeout.
+ *
+ * @note This function requires CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS to be enabled.
+ * @param task_handle Handle of the task. Input NULL to subscribe the current running task to the TWDT
+ * @return
+ *  - ESP_OK: Successfully subscribed the task to the TWDT
+ *  - ESP_ERR_NOT_SUPPORTED: Run time statistics are disabled
+ *  - Other: Failed to subscribe task
+ */
+esp_err_t esp_task_wdt_add_passive(TaskHandle_t task_handle);
+
 /**
  * @brief Subscribe a user to the Task Watchdog Timer (TWDT)
  *
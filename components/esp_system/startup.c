@@ -21,6 +21,12 @@
 #include "esp_cpu.h"
 
 #include "esp_private/startup_internal.h"
+#include "esp_private/startup_profiler.h"
+
+#if CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
 
 // Ensure that system configuration matches the underlying number of cores.
 // This should enable us to avoid checking for both every time.
@@ -79,6 +85,82 @@ static void __do_global_ctors_1(void)
 }
 #endif // CONFIG_COMPILER_CXX_EXCEPTIONS
 
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER
+/**
+ * @brief Equivalent of newlib's __libc_init_array(), unrolled so that each
+ * global constructor gets its own entry in the startup timeline.
+ */
+static void do_global_ctors(void)
+{
+    extern void (*__preinit_array_start[])(void);
+    extern void (*__preinit_array_end[])(void);
+    extern void (*__init_array_start[])(void);
+    extern void (*__init_array_end[])(void);
+    extern void _init(void) __attribute__((weak));
+
+    size_t count = __preinit_array_end - __preinit_array_start;
+    for (size_t i = 0; i < count; ++i) {
+        __preinit_array_start[i]();
+    }
+    if (_init) {
+        _init();
+    }
+    count = __init_array_end - __init_array_start;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t start_cycles = esp_cpu_get_cycle_count();
+        __init_array_start[i]();
+        esp_startup_profiler_record("ctor", __init_array_start[i], ESP_STARTUP_PROFILER_STAGE_CTOR,
+                                    start_cycles, esp_cpu_get_cycle_count() - start_cycles);
+    }
+}
+#endif // CONFIG_ESP_SYSTEM_STARTUP_PROFILER
+
+#if CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT
+#define DEFERRED_INIT_MAX_ENTRIES 16
+
+static const esp_system_init_fn_t *s_deferred_init_fns[DEFERRED_INIT_MAX_ENTRIES];
+static size_t s_deferred_init_count;
+
+/* Return true if the entry name appears in ESP_SYSTEM_STARTUP_DEFER_INIT_LIST,
+   delimited by commas, spaces, or the ends of the list. */
+static bool init_fn_is_deferred(const esp_system_init_fn_t *p)
+{
+    const char *list = CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT_LIST;
+    size_t name_len = strlen(p->name);
+    const char *pos = list;
+    while ((pos = strstr(pos, p->name)) != NULL) {
+        bool starts = (pos == list) || (pos[-1] == ',') || (pos[-1] == ' ');
+        char next = pos[name_len];
+        if (starts && (next == '\0' || next == ',' || next == ' ')) {
+            return true;
+        }
+        pos += name_len;
+    }
+    return false;
+}
+
+static void deferred_init_task(void *arg)
+{
+    for (size_t i = 0; i < s_deferred_init_count; i++) {
+        const esp_system_init_fn_t *p = s_deferred_init_fns[i];
+        ESP_LOGD(TAG, "calling deferred init function: %s", p->name);
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER
+        uint32_t start_cycles = esp_cpu_get_cycle_count();
+#endif
+        esp_err_t err = (*(p->fn))();
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER
+        esp_startup_profiler_record(p->name, p->fn, p->stage, start_cycles,
+                                    esp_cpu_get_cycle_count() - start_cycles);
+#endif
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "deferred init function %s has failed (0x%x), aborting", p->name, err);
+            abort();
+        }
+    }
+    vTaskDelete(NULL);
+}
+#endif // CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT
+
 /**
  * @brief Call component init functions defined using ESP_SYSTEM_INIT_Fn macros.
  * The esp_system_init_fn_t structures describing these functions are collected into
@@ -99,9 +181,28 @@ static void do_system_init_fn(uint32_t stage_num)
     int core_id = esp_cpu_get_core_id();
     for (p = &_esp_system_init_fn_array_start; p < &_esp_system_init_fn_array_end; ++p) {
         if (p->stage == stage_num && (p->cores & BIT(core_id)) != 0) {
+#if CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT
+            // Only single-core entries of the SECONDARY stage can be moved to the
+            // deferred init task; the task is pinned to core 0.
+            if (stage_num == ESP_SYSTEM_INIT_STAGE_SECONDARY && core_id == 0
+                    && p->cores == BIT(0) && init_fn_is_deferred(p)) {
+                if (s_deferred_init_count < DEFERRED_INIT_MAX_ENTRIES) {
+                    s_deferred_init_fns[s_deferred_init_count++] = p;
+                    continue;
+                }
+                ESP_EARLY_LOGW(TAG, "deferred init table full, calling %s during startup", p->name);
+            }
+#endif
             // During core init, stdout is not initialized yet, so use early logging.
             ESP_EARLY_LOGD(TAG, "calling init function: %p on core: %d", p->fn, core_id);
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER
+            uint32_t start_cycles = esp_cpu_get_cycle_count();
+#endif
             esp_err_t err = (*(p->fn))();
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER
+            esp_startup_profiler_record(p->name, p->fn, stage_num, start_cycles,
+                                        esp_cpu_get_cycle_count() - start_cycles);
+#endif
             if (err != ESP_OK) {
                 ESP_EARLY_LOGE(TAG, "init function %p has failed (0x%x), aborting", p->fn, err);
                 abort();
@@ -180,7 +281,11 @@ static void start_cpu0_default(void)
 #ifdef CONFIG_COMPILER_CXX_EXCEPTIONS
     __do_global_ctors_1();
 #endif
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER
+    do_global_ctors();
+#else
     __libc_init_array();
+#endif
 
     /* ----------------------------------Separator-----------------------------
      * After this stage, other CPU start running with the cache, however the scheduler (and ipc service) is not available.
@@ -191,6 +296,24 @@ static void start_cpu0_default(void)
     // until all cores finish (when !CONFIG_ESP_SYSTEM_SINGLE_CORE_MODE).
     do_secondary_init();
 
+#if CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT
+    if (s_deferred_init_count > 0) {
+        // The scheduler is not running yet; the task starts once esp_startup_start_app
+        // brings it up, and runs just above idle priority so it yields to app_main.
+        BaseType_t created = xTaskCreatePinnedToCore(deferred_init_task, "deferred_init",
+                                                     CONFIG_ESP_SYSTEM_STARTUP_DEFER_INIT_TASK_STACK_SIZE,
+                                                     NULL, tskIDLE_PRIORITY + 1, NULL, 0);
+        if (created != pdTRUE) {
+            ESP_EARLY_LOGE(TAG, "failed to create deferred init task, aborting");
+            abort();
+        }
+    }
+#endif
+
+#if CONFIG_ESP_SYSTEM_STARTUP_PROFILER_LOG
+    esp_startup_profiler_dump();
+#endif
+
 #if SOC_CPU_CORES_NUM > 1 && !CONFIG_ESP_SYSTEM_SINGLE_CORE_MODE
     s_system_full_inited = true;
 #endif
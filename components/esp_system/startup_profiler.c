@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <inttypes.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "spinlock.h"
+
+#include "esp_private/startup_profiler.h"
+
+ESP_LOG_ATTR_TAG(TAG, "start_prof");
+
+static esp_startup_profiler_entry_t s_entries[CONFIG_ESP_SYSTEM_STARTUP_PROFILER_MAX_ENTRIES];
+static size_t s_entry_count;
+// Init functions of the SECONDARY stage run on all cores in parallel, before
+// the scheduler is up, so protect the table with a bare spinlock.
+static spinlock_t s_entries_lock = SPINLOCK_INITIALIZER;
+
+void esp_startup_profiler_record(const char *name, const void *fn, uint32_t stage,
+                                 uint32_t start_cycles, uint32_t duration_cycles)
+{
+    spinlock_acquire(&s_entries_lock, SPINLOCK_WAIT_FOREVER);
+    if (s_entry_count < CONFIG_ESP_SYSTEM_STARTUP_PROFILER_MAX_ENTRIES) {
+        esp_startup_profiler_entry_t *entry = &s_entries[s_entry_count++];
+        entry->name = name;
+        entry->fn = fn;
+        entry->stage = (uint8_t)stage;
+        entry->core = (uint8_t)esp_cpu_get_core_id();
+        entry->start_cycles = start_cycles;
+        entry->duration_cycles = duration_cycles;
+    }
+    spinlock_release(&s_entries_lock);
+}
+
+const esp_startup_profiler_entry_t *esp_startup_profiler_get_entries(size_t *count)
+{
+    if (count != NULL) {
+        *count = s_entry_count;
+    }
+    return s_entries;
+}
+
+static const char *stage_name(uint8_t stage)
+{
+    switch (stage) {
+    case 0: return "CORE";
+    case 1: return "SEC";
+    case ESP_STARTUP_PROFILER_STAGE_CTOR: return "CTOR";
+    default: return "?";
+    }
+}
+
+void esp_startup_profiler_dump(void)
+{
+    // Durations were recorded in CPU cycles; convert with the current CPU
+    // frequency. Entries recorded before the frequency switch to the
+    // configured value are off by the frequency ratio.
+    uint32_t mhz = ets_get_cpu_frequency();
+    ESP_EARLY_LOGI(TAG, "startup timeline, %u entries, CPU at %"PRIu32" MHz:", (unsigned)s_entry_count, mhz);
+    for (size_t i = 0; i < s_entry_count; i++) {
+        const esp_startup_profiler_entry_t *entry = &s_entries[i];
+        ESP_EARLY_LOGI(TAG, "%-4s core%d at %8"PRIu32" us, %6"PRIu32" us: %s (%p)",
+                       stage_name(entry->stage), entry->core,
+                       entry->start_cycles / mhz, entry->duration_cycles / mhz,
+                       entry->name, entry->fn);
+    }
+    if (s_entry_count == CONFIG_ESP_SYSTEM_STARTUP_PROFILER_MAX_ENTRIES) {
+        ESP_EARLY_LOGW(TAG, "timeline table full, some entries were dropped; "
+                       "increase ESP_SYSTEM_STARTUP_PROFILER_MAX_ENTRIES");
+    }
+}
@@ -13,6 +13,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/freertos_debug.h"
+#include "freertos/idf_additions.h"
 #include "esp_err.h"
 #include "esp_attr.h"
 #include "esp_check.h"
@@ -70,6 +71,10 @@ struct twdt_entry {
     TaskHandle_t task_handle;   // NULL if user entry
     const char *user_name;      // NULL if task entry
     bool has_reset;
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    bool passive;               // Entry is reset implicitly when the task's run time counter advances
+    configRUN_TIME_COUNTER_TYPE run_count_snapshot; // Run time counter value sampled at the last timer feed
+#endif
 };
 
 // Structure used to hold run time configuration of the TWDT
@@ -98,6 +103,31 @@ static char core_user_names[CONFIG_FREERTOS_NUMBER_OF_CORES][CORE_USER_NAME_LEN]
 
 // ----------------------- Helpers -------------------------
 
+/**
+ * @brief Check whether an entry has been reset, sampling passive entries for progress
+ *
+ * Passive entries never call esp_task_wdt_reset(). Instead, the run time counter of the watched task is compared
+ * against the value sampled at the last timer feed: any forward movement means the task has been scheduled since
+ * and counts as an implicit reset.
+ * When entering this function, the spinlock has already been taken, no need to take it back.
+ *
+ * @param[in] entry Entry to check
+ * @return Whether the entry has been reset (explicitly or implicitly) during the current timeout period
+ */
+static TASK_WDT_FN_ATTR bool entry_has_reset(twdt_entry_t *entry)
+{
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    if (!entry->has_reset && entry->passive) {
+        configRUN_TIME_COUNTER_TYPE run_count = ulTaskGetRunTimeCounter(entry->task_handle);
+        if (run_count != entry->run_count_snapshot) {
+            entry->run_count_snapshot = run_count;
+            entry->has_reset = true;
+        }
+    }
+#endif // CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    return entry->has_reset;
+}
+
 /**
  * @brief Reset the timer and reset flags of each entry
  * When entering this function, the spinlock has already been taken, no need to take it back.
@@ -110,6 +140,12 @@ static TASK_WDT_FN_ATTR void task_wdt_timer_feed(void)
     twdt_entry_t *entry;
     SLIST_FOREACH(entry, &p_twdt_obj->entries_slist, slist_entry) {
         entry->has_reset = false;
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        /* Start the new timeout period from a fresh run time counter sample */
+        if (entry->passive) {
+            entry->run_count_snapshot = ulTaskGetRunTimeCounter(entry->task_handle);
+        }
+#endif // CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
     }
 }
 
@@ -129,7 +165,7 @@ static TASK_WDT_FN_ATTR bool find_entry_and_check_all_reset(twdt_entry_t *user_e
     SLIST_FOREACH(entry, &p_twdt_obj->entries_slist, slist_entry) {
         if (entry == user_entry) {
             found_user_entry = true;
-        } else if (entry->has_reset == false) {
+        } else if (entry_has_reset(entry) == false) {
             found_non_reset = true;
         }
     }
@@ -154,7 +190,7 @@ static TASK_WDT_FN_ATTR twdt_entry_t *find_entry_from_task_handle_and_check_all_
     SLIST_FOREACH(entry, &p_twdt_obj->entries_slist, slist_entry) {
         if (entry->task_handle == handle) {
             target = entry;
-        } else if (entry->has_reset == false) {
+        } else if (entry_has_reset(entry) == false) {
             found_non_reset = true;
         }
     }
@@ -167,11 +203,12 @@ static TASK_WDT_FN_ATTR twdt_entry_t *find_entry_from_task_handle_and_check_all_
  * @brief Create a task/user entry and add it to the task WDT
  *
  * @param[in] is_task Whether the entry is a task entry or user entry
+ * @param[in] is_passive Whether the task entry is watched passively (i.e., reset implicitly by being scheduled)
  * @param[in] entry_data Data associated with the entry (either a task handle or user entry name)
  * @param[out] entry_ret Pointer to created entry
  * @return ESP_OK if entry was added, failure otherwise
  */
-static esp_err_t add_entry(bool is_task, void *entry_data, twdt_entry_t **entry_ret)
+static esp_err_t add_entry(bool is_task, bool is_passive, void *entry_data, twdt_entry_t **entry_ret)
 {
     esp_err_t ret;
 
@@ -182,6 +219,12 @@ static esp_err_t add_entry(bool is_task, void *entry_data, twdt_entry_t **entry_
     }
     if (is_task) {
         entry->task_handle = (TaskHandle_t)entry_data;
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        entry->passive = is_passive;
+        if (is_passive) {
+            entry->run_count_snapshot = ulTaskGetRunTimeCounter(entry->task_handle);
+        }
+#endif // CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
     } else {
         entry->user_name = (const char *)entry_data;
     }
@@ -477,6 +520,24 @@ static void task_wdt_isr(void *arg)
     portENTER_CRITICAL_ISR(&spinlock);
     esp_task_wdt_impl_timeout_triggered(p_twdt_obj->impl_ctx);
 
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    /* Passive entries are reset implicitly when their task has run since the last feed, so sample
+     * them now. If that accounts for every entry, the timeout is a false alarm: feed the timer
+     * (which also takes fresh run time counter samples) and let the next period begin. */
+    bool all_reset = !SLIST_EMPTY(&p_twdt_obj->entries_slist);
+    twdt_entry_t *entry;
+    SLIST_FOREACH(entry, &p_twdt_obj->entries_slist, slist_entry) {
+        if (!entry_has_reset(entry)) {
+            all_reset = false;
+        }
+    }
+    if (all_reset) {
+        task_wdt_timer_feed();
+        portEXIT_CRITICAL_ISR(&spinlock);
+        return;
+    }
+#endif // CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+
     /* Keep a bitmap of CPU cores having tasks that have not reset TWDT.
      * Bit 0 represents core 0, bit 1 represents core 1, and so on. */
     int cpus_fail = 0;
@@ -675,9 +736,29 @@ esp_err_t esp_task_wdt_add(TaskHandle_t task_handle)
     }
 
     twdt_entry_t *entry;
-    ret = add_entry(true, (void *)task_handle, &entry);
+    ret = add_entry(true, false, (void *)task_handle, &entry);
+    (void) entry; // Returned entry pointer not used
+    return ret;
+}
+
+esp_err_t esp_task_wdt_add_passive(TaskHandle_t task_handle)
+{
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    ESP_RETURN_ON_FALSE(p_twdt_obj != NULL, ESP_ERR_INVALID_STATE, TAG, "TWDT was never initialized");
+    esp_err_t ret;
+    if (task_handle == NULL) {   // Get handle of current task if none is provided
+        task_handle = xTaskGetCurrentTaskHandle();
+    }
+
+    twdt_entry_t *entry;
+    ret = add_entry(true, true, (void *)task_handle, &entry);
     (void) entry; // Returned entry pointer not used
     return ret;
+#else // CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    (void) task_handle;
+    ESP_LOGE(TAG, "passive watching requires CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif // CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
 }
 
 esp_err_t esp_task_wdt_add_user(const char *user_name, esp_task_wdt_user_handle_t *user_handle_ret)
@@ -686,7 +767,7 @@ esp_err_t esp_task_wdt_add_user(const char *user_name, esp_task_wdt_user_handle_
     ESP_RETURN_ON_FALSE(p_twdt_obj != NULL, ESP_ERR_INVALID_STATE, TAG, "TWDT was never initialized");
     esp_err_t ret;
     twdt_entry_t *entry;
-    ret = add_entry(false, (void *)user_name, &entry);
+    ret = add_entry(false, false, (void *)user_name, &entry);
     if (ret == ESP_OK) {
         *user_handle_ret = (esp_task_wdt_user_handle_t)entry;
     }
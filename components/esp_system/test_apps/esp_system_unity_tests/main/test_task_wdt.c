@@ -197,6 +197,44 @@ TEST_CASE("Task WDT task feed", "[task_wdt]")
     TEST_ASSERT_EQUAL(ESP_OK, esp_task_wdt_deinit());
 }
 
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static void suspended_task_fn(void *arg)
+{
+    vTaskSuspend(NULL);
+    /* Only reached once the test resumes us for cleanup */
+    vTaskDelete(NULL);
+}
+
+TEST_CASE("Task WDT passive watch", "[task_wdt]")
+{
+    timeout_flag = false;
+    esp_task_wdt_config_t twdt_config = {
+        .timeout_ms = TASK_WDT_TIMEOUT_MS,
+        .idle_core_mask = 0,
+        .trigger_panic = false,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_task_wdt_init(&twdt_config));
+    /* The current task busy-waits, so its run time counter keeps advancing and
+     * counts as an implicit reset: no timeout without ever calling esp_task_wdt_reset() */
+    TEST_ASSERT_EQUAL(ESP_OK, esp_task_wdt_add_passive(NULL));
+    esp_rom_delay_us(2 * TASK_WDT_TIMEOUT_MS * 1000);
+    TEST_ASSERT_EQUAL(false, timeout_flag);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_task_wdt_delete(NULL));
+
+    /* A passively watched task that is never scheduled must still trigger a timeout */
+    TaskHandle_t suspended_task;
+    TEST_ASSERT_EQUAL(pdTRUE, xTaskCreate(suspended_task_fn, "suspended", 2048, NULL, uxTaskPriorityGet(NULL), &suspended_task));
+    vTaskDelay(pdMS_TO_TICKS(10));  // Let the task suspend itself
+    TEST_ASSERT_EQUAL(ESP_OK, esp_task_wdt_add_passive(suspended_task));
+    esp_rom_delay_us(2 * TASK_WDT_TIMEOUT_MS * 1000);
+    TEST_ASSERT_EQUAL(true, timeout_flag);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_task_wdt_delete(suspended_task));
+    vTaskResume(suspended_task);
+    vTaskDelay(pdMS_TO_TICKS(10));  // Let the task delete itself
+    TEST_ASSERT_EQUAL(ESP_OK, esp_task_wdt_deinit());
+}
+#endif // CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+
 TEST_CASE("Task WDT user timeout", "[task_wdt]")
 {
     const char *user_name = "test_user";
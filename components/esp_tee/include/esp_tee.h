@@ -57,6 +57,41 @@ typedef struct {
 
 extern esp_tee_config_t esp_tee_app_config;
 
+/** Maximum number of commands in one batched service invocation */
+#define ESP_TEE_BATCH_MAX_CMDS      32
+/** Maximum number of arguments per batched command */
+#define ESP_TEE_BATCH_CMD_MAX_ARGS  8
+
+/**
+ * @brief Single command of a batched secure service invocation
+ *
+ * An array of these forms the command buffer submitted through
+ * esp_tee_service_call_batch(), which processes all commands with a
+ * single REE-TEE world switch.
+ */
+typedef struct {
+    uint32_t service_id;                        /*!< Secure service ID (SS_*) to invoke */
+    uint32_t argc;                              /*!< Number of valid entries in argv */
+    uint32_t argv[ESP_TEE_BATCH_CMD_MAX_ARGS];  /*!< Arguments for the secure service */
+    int32_t status;                             /*!< [out] Value returned by the secure service,
+                                                     or -1 if the command could not be dispatched */
+} esp_tee_batch_cmd_t;
+
+/**
+ * @brief REE-TEE world switch cycle-count statistics
+ *
+ * Cycle counts cover the full round trip of a service call, i.e. the
+ * two world switches plus the execution time of the secure service
+ * itself. Invoking a trivial service thus gives the pure switch overhead.
+ */
+typedef struct {
+    uint32_t count;         /*!< Number of service calls made so far */
+    uint32_t last_cycles;   /*!< Round-trip CPU cycles of the most recent call */
+    uint32_t min_cycles;    /*!< Minimum round-trip CPU cycles observed */
+    uint32_t max_cycles;    /*!< Maximum round-trip CPU cycles observed */
+    uint64_t total_cycles;  /*!< Accumulated round-trip CPU cycles */
+} esp_tee_switch_stats_t;
+
 #endif // !defined(__ASSEMBLER__) && !(__DOXYGEN__)
 
 #if !ESP_TEE_BUILD
@@ -78,6 +113,36 @@ uint32_t esp_tee_service_call(int argc, ...);
  * @return Value returned by the secure service function
  */
 uint32_t esp_tee_service_call_with_noniram_intr_disabled(int argc, ...);
+
+/**
+ * @brief Invoke multiple secure services with a single world switch
+ *
+ * Submits a command buffer to the TEE, which dispatches each command in
+ * sequence and records the per-command return value in-place, amortizing
+ * the REE-TEE context switch cost over all commands.
+ *
+ * @param cmds      Command buffer; the status field of each entry is
+ *                  updated with the corresponding service return value
+ * @param num_cmds  Number of commands in the buffer
+ *                  (at most ESP_TEE_BATCH_MAX_CMDS)
+ *
+ * @return Number of successfully dispatched commands, or UINT32_MAX if
+ *         the buffer itself was rejected by the TEE
+ */
+uint32_t esp_tee_service_call_batch(esp_tee_batch_cmd_t *cmds, size_t num_cmds);
+
+/**
+ * @brief Fetch the REE-TEE world switch cycle-count statistics
+ *
+ * @param stats  Pointer to the structure to be filled with a snapshot
+ *               of the statistics
+ */
+void esp_tee_switch_stats_get(esp_tee_switch_stats_t *stats);
+
+/**
+ * @brief Reset the REE-TEE world switch cycle-count statistics
+ */
+void esp_tee_switch_stats_reset(void);
 #else
 #include "private/esp_tee_binary.h"
 #endif
@@ -5,8 +5,10 @@
  */
 
 #include <stdarg.h>
+#include <string.h>
 
 #include "esp_attr.h"
+#include "esp_cpu.h"
 #include "esp_private/cache_utils.h"
 
 #include "freertos/FreeRTOS.h"
@@ -23,6 +25,32 @@ extern uint32_t _u2m_switch(int argc, va_list ap);
 static DRAM_ATTR SemaphoreHandle_t s_tee_mutex;
 static DRAM_ATTR StaticSemaphore_t s_tee_mutex_buf;
 
+static DRAM_ATTR esp_tee_switch_stats_t s_switch_stats = { .min_cycles = UINT32_MAX };
+static DRAM_ATTR portMUX_TYPE s_switch_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* Wrapper over _u2m_switch() accounting the round-trip cycle cost of
+ * the world switch (including the secure service execution) */
+static IRAM_ATTR uint32_t u2m_switch_timed(int argc, va_list ap)
+{
+    uint32_t start = esp_cpu_get_cycle_count();
+    uint32_t val = _u2m_switch(argc, ap);
+    uint32_t cycles = esp_cpu_get_cycle_count() - start;
+
+    portENTER_CRITICAL_SAFE(&s_switch_stats_lock);
+    s_switch_stats.count++;
+    s_switch_stats.last_cycles = cycles;
+    if (cycles < s_switch_stats.min_cycles) {
+        s_switch_stats.min_cycles = cycles;
+    }
+    if (cycles > s_switch_stats.max_cycles) {
+        s_switch_stats.max_cycles = cycles;
+    }
+    s_switch_stats.total_cycles += cycles;
+    portEXIT_CRITICAL_SAFE(&s_switch_stats_lock);
+
+    return val;
+}
+
 static IRAM_ATTR void init_mutex(void)
 {
     static bool is_first_call = true;
@@ -48,11 +76,11 @@ uint32_t IRAM_ATTR esp_tee_service_call(int argc, ...)
      * service call is requested from a critical section */
     if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING && xPortCanYield()) {
         if (xSemaphoreTake(s_tee_mutex, portMAX_DELAY) == pdTRUE) {
-            val = _u2m_switch(argc, ap);
+            val = u2m_switch_timed(argc, ap);
             xSemaphoreGive(s_tee_mutex);
         }
     } else {
-        val = _u2m_switch(argc, ap);
+        val = u2m_switch_timed(argc, ap);
     }
 
     va_end(ap);
@@ -69,7 +97,7 @@ uint32_t IRAM_ATTR esp_tee_service_call_with_noniram_intr_disabled(int argc, ...
     spi_flash_op_lock();
     esp_intr_noniram_disable();
 
-    val = _u2m_switch(argc, ap);
+    val = u2m_switch_timed(argc, ap);
 
     esp_intr_noniram_enable();
     spi_flash_op_unlock();
@@ -77,3 +105,29 @@ uint32_t IRAM_ATTR esp_tee_service_call_with_noniram_intr_disabled(int argc, ...
     va_end(ap);
     return val;
 }
+
+uint32_t IRAM_ATTR esp_tee_service_call_batch(esp_tee_batch_cmd_t *cmds, size_t num_cmds)
+{
+    if (cmds == NULL || num_cmds == 0 || num_cmds > ESP_TEE_BATCH_MAX_CMDS) {
+        return UINT32_MAX;
+    }
+    return esp_tee_service_call(3, SS_ESP_TEE_SERVICE_BATCH, cmds, num_cmds);
+}
+
+void esp_tee_switch_stats_get(esp_tee_switch_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    portENTER_CRITICAL_SAFE(&s_switch_stats_lock);
+    memcpy(stats, &s_switch_stats, sizeof(esp_tee_switch_stats_t));
+    portEXIT_CRITICAL_SAFE(&s_switch_stats_lock);
+}
+
+void esp_tee_switch_stats_reset(void)
+{
+    portENTER_CRITICAL_SAFE(&s_switch_stats_lock);
+    memset(&s_switch_stats, 0, sizeof(esp_tee_switch_stats_t));
+    s_switch_stats.min_cycles = UINT32_MAX;
+    portEXIT_CRITICAL_SAFE(&s_switch_stats_lock);
+}
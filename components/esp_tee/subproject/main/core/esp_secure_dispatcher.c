@@ -5,8 +5,11 @@
  */
 #include <string.h>
 #include <stdarg.h>
+#include <inttypes.h>
 #include "esp_log.h"
+#include "esp_fault.h"
 #include "esp_tee.h"
+#include "esp_tee_memory_utils.h"
 #include "secure_service_num.h"
 
 #define ESP_TEE_MAX_INPUT_ARG 10
@@ -112,3 +115,58 @@ int esp_tee_service_dispatcher(int argc, va_list ap)
 
     return ret;
 }
+
+/* ---------------------------------------------- Batched Service Invocation ------------------------------------------------- */
+
+typedef uint32_t (*batch_service_fn_t)(uint32_t, uint32_t, uint32_t, uint32_t,
+                                       uint32_t, uint32_t, uint32_t, uint32_t);
+
+/**
+ * @brief Processes a command buffer submitted by the REE, invoking each
+ *        secure service in sequence so that the whole batch costs a
+ *        single world switch. Per-command return values are recorded
+ *        in-place in the buffer.
+ */
+int _ss_esp_tee_service_batch(esp_tee_batch_cmd_t *cmds, uint32_t num_cmds)
+{
+    bool valid_addr = (esp_tee_ptr_in_ree((void *)cmds) &&
+                       esp_tee_ptr_in_ree((void *)((char *)cmds + num_cmds * sizeof(esp_tee_batch_cmd_t))));
+    valid_addr &= (num_cmds > 0 && num_cmds <= ESP_TEE_BATCH_MAX_CMDS);
+
+    if (!valid_addr) {
+        ESP_LOGE(TAG, "Invalid batch command buffer!");
+        return -1;
+    }
+    ESP_FAULT_ASSERT(valid_addr);
+
+    int dispatched = 0;
+    for (uint32_t i = 0; i < num_cmds; i++) {
+        esp_tee_batch_cmd_t *cmd = &cmds[i];
+        cmd->status = -1;
+
+        /* Batches must not nest */
+        if (cmd->service_id == SS_ESP_TEE_SERVICE_BATCH) {
+            ESP_LOGE(TAG, "Nested batch invocation rejected!");
+            continue;
+        }
+
+        const secure_service_entry_t *service = find_service_by_id(cmd->service_id);
+        if (service == NULL) {
+            ESP_LOGE(TAG, "Invalid service ID in batch!");
+            continue;
+        }
+
+        if (cmd->argc != (uint32_t)service->nargs || cmd->argc > ESP_TEE_BATCH_CMD_MAX_ARGS) {
+            ESP_LOGE(TAG, "Invalid number of arguments for service %" PRIu32 "!", cmd->service_id);
+            continue;
+        }
+
+        /* Unused argument registers are simply ignored by the callee */
+        batch_service_fn_t fp_secure_service = (batch_service_fn_t)service->func;
+        cmd->status = (int32_t)fp_secure_service(cmd->argv[0], cmd->argv[1], cmd->argv[2], cmd->argv[3],
+                                                 cmd->argv[4], cmd->argv[5], cmd->argv[6], cmd->argv[7]);
+        dispatched++;
+    }
+
+    return dispatched;
+}
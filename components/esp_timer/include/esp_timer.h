@@ -189,6 +189,27 @@ esp_err_t esp_timer_start_once_at(esp_timer_handle_t timer, uint64_t alarm_us);
  */
 esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period);
 
+#if CONFIG_ESP_TIMER_COALESCING || defined __DOXYGEN__
+/**
+ * @brief Start a periodic timer which tolerates late dispatch
+ *
+ * Timer represented by `timer` should not be running when this function is called.
+ * This function starts the timer which will trigger every `period` microseconds.
+ * The callback may be dispatched up to `tolerance_us` microseconds after each
+ * nominal deadline; the scheduler uses this slack to merge nearby alarms into a
+ * single hardware wakeup. The callback is never dispatched early.
+ *
+ * @param timer timer handle created using esp_timer_create()
+ * @param period timer period, in microseconds
+ * @param tolerance_us maximum allowed dispatch delay, in microseconds
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if the handle is invalid
+ *      - ESP_ERR_INVALID_STATE if the timer is already running
+ */
+esp_err_t esp_timer_start_periodic_with_tolerance(esp_timer_handle_t timer, uint64_t period, uint64_t tolerance_us);
+#endif // CONFIG_ESP_TIMER_COALESCING || defined __DOXYGEN__
+
 /**
  * @brief Start a periodic timer with absolute alarm time
  *
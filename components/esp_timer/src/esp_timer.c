@@ -44,6 +44,9 @@ struct esp_timer {
     uint64_t alarm;
     uint64_t period: 56;
     flags_t flags: 8;
+#if CONFIG_ESP_TIMER_COALESCING
+    uint32_t tolerance;  //!< Allowed dispatch lateness in microseconds, used to coalesce nearby alarms
+#endif
     union {
         esp_timer_cb_t callback;
         uint32_t event_id;
@@ -85,6 +88,15 @@ static LIST_HEAD(esp_inactive_timer_list, esp_timer) s_inactive_timers[ESP_TIMER
     [0 ...(ESP_TIMER_MAX - 1)] = LIST_HEAD_INITIALIZER(s_timers)
 };
 #endif
+#if CONFIG_ESP_TIMER_WHEEL
+// far level of the timer wheel: unsorted lists of timers expiring beyond the near
+// horizon, inserted in O(1) and cascaded into s_timers when the horizon advances
+static LIST_HEAD(esp_far_timer_list, esp_timer) s_far_timers[ESP_TIMER_MAX] = {
+    [0 ...(ESP_TIMER_MAX - 1)] = LIST_HEAD_INITIALIZER(s_far_timers)
+};
+// absolute time up to which timers are guaranteed to be in the sorted list
+static uint64_t s_timer_wheel_horizon[ESP_TIMER_MAX];
+#endif
 // task used to dispatch timer callbacks
 static TaskHandle_t s_timer_task;
 
@@ -193,7 +205,7 @@ static esp_err_t ESP_TIMER_IRAM_ATTR timer_restart(esp_timer_handle_t timer, uin
     return ret;
 }
 
-static esp_err_t ESP_TIMER_IRAM_ATTR timer_init(esp_timer_handle_t timer, uint64_t period_us, uint64_t first_alarm_us)
+static esp_err_t ESP_TIMER_IRAM_ATTR timer_init(esp_timer_handle_t timer, uint64_t period_us, uint64_t first_alarm_us, uint64_t tolerance_us)
 {
     if (timer == NULL) {
         return ESP_ERR_INVALID_ARG;
@@ -217,6 +229,11 @@ static esp_err_t ESP_TIMER_IRAM_ATTR timer_init(esp_timer_handle_t timer, uint64
     } else {
         timer->alarm = first_alarm_us;
         timer->period = period_us;
+#if CONFIG_ESP_TIMER_COALESCING
+        timer->tolerance = MIN(tolerance_us, UINT32_MAX);
+#else
+        (void)tolerance_us;
+#endif
 #if WITH_PROFILING
         timer->times_armed++;
         timer->times_skipped = 0;
@@ -229,7 +246,7 @@ static esp_err_t ESP_TIMER_IRAM_ATTR timer_init(esp_timer_handle_t timer, uint64
 
 esp_err_t ESP_TIMER_IRAM_ATTR esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
 {
-    return timer_init(timer, 0, esp_timer_get_time() + timeout_us);
+    return timer_init(timer, 0, esp_timer_get_time() + timeout_us, 0);
 }
 
 esp_err_t ESP_TIMER_IRAM_ATTR esp_timer_start_once_at(esp_timer_handle_t timer, uint64_t alarm_us)
@@ -238,15 +255,24 @@ esp_err_t ESP_TIMER_IRAM_ATTR esp_timer_start_once_at(esp_timer_handle_t timer,
     if (alarm_us + min_overhead_us < esp_timer_impl_get_time()) {
         return ESP_ERR_INVALID_ARG;
     }
-    return timer_init(timer, 0, alarm_us);
+    return timer_init(timer, 0, alarm_us, 0);
 }
 
 esp_err_t ESP_TIMER_IRAM_ATTR esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us)
 {
     uint64_t min_period = esp_timer_impl_get_min_period_us();
     period_us = MAX(period_us, min_period);
-    return timer_init(timer, period_us, esp_timer_get_time() + period_us);
+    return timer_init(timer, period_us, esp_timer_get_time() + period_us, 0);
+}
+
+#if CONFIG_ESP_TIMER_COALESCING
+esp_err_t ESP_TIMER_IRAM_ATTR esp_timer_start_periodic_with_tolerance(esp_timer_handle_t timer, uint64_t period_us, uint64_t tolerance_us)
+{
+    uint64_t min_period = esp_timer_impl_get_min_period_us();
+    period_us = MAX(period_us, min_period);
+    return timer_init(timer, period_us, esp_timer_get_time() + period_us, tolerance_us);
 }
+#endif // CONFIG_ESP_TIMER_COALESCING
 
 esp_err_t ESP_TIMER_IRAM_ATTR esp_timer_start_periodic_at(esp_timer_handle_t timer, uint64_t period_us, uint64_t first_alarm_us)
 {
@@ -255,7 +281,7 @@ esp_err_t ESP_TIMER_IRAM_ATTR esp_timer_start_periodic_at(esp_timer_handle_t tim
         return ESP_ERR_INVALID_ARG;
     }
     period_us = MAX(period_us, min_overhead_us);
-    return timer_init(timer, period_us, first_alarm_us);
+    return timer_init(timer, period_us, first_alarm_us, 0);
 }
 
 esp_err_t ESP_TIMER_IRAM_ATTR esp_timer_stop(esp_timer_handle_t timer)
@@ -303,12 +329,34 @@ esp_err_t esp_timer_delete(esp_timer_handle_t timer)
         timer->event_id = EVENT_ID_DELETE_TIMER;
         timer->alarm = alarm;
         timer->period = 0;
+#if CONFIG_ESP_TIMER_COALESCING
+        // do not let a leftover tolerance defer the deletion dispatch
+        timer->tolerance = 0;
+#endif
         err = timer_insert(timer, false);
     }
     timer_list_unlock(ESP_TIMER_TASK);
     return err;
 }
 
+#if CONFIG_ESP_TIMER_COALESCING
+/* Earliest latest-allowed deadline over the sorted list: min(alarm + tolerance).
+ * Since the list is ordered by alarm, the scan can stop once an entry's alarm
+ * is at or past the minimum found so far. Called with the list locked. */
+static uint64_t ESP_TIMER_IRAM_ATTR timer_coalesced_alarm(esp_timer_dispatch_t dispatch_method)
+{
+    uint64_t target = UINT64_MAX;
+    esp_timer_handle_t it;
+    LIST_FOREACH(it, &s_timers[dispatch_method], list_entry) {
+        if (it->alarm >= target) {
+            break;
+        }
+        target = MIN(target, it->alarm + it->tolerance);
+    }
+    return target;
+}
+#endif // CONFIG_ESP_TIMER_COALESCING
+
 static ESP_TIMER_IRAM_ATTR esp_err_t timer_insert(esp_timer_handle_t timer, bool without_update_alarm)
 {
 #if WITH_PROFILING
@@ -316,6 +364,29 @@ static ESP_TIMER_IRAM_ATTR esp_err_t timer_insert(esp_timer_handle_t timer, bool
 #endif
     esp_timer_handle_t it, last = NULL;
     esp_timer_dispatch_t dispatch_method = timer->flags & FL_ISR_DISPATCH_METHOD;
+#if CONFIG_ESP_TIMER_WHEEL
+    if (timer->alarm > s_timer_wheel_horizon[dispatch_method]) {
+        // Beyond the near horizon: park the timer on the unsorted far list.
+        // It will be moved into the sorted list by the cascade in
+        // timer_process_alarm() once the horizon catches up with its alarm.
+        LIST_INSERT_HEAD(&s_far_timers[dispatch_method], timer, list_entry);
+        if (without_update_alarm == false) {
+            // Make sure the hardware alarm is not armed past the horizon,
+            // otherwise the cascade would run too late for this timer
+#if CONFIG_ESP_TIMER_COALESCING
+            if (timer_coalesced_alarm(dispatch_method) > s_timer_wheel_horizon[dispatch_method]) {
+                esp_timer_impl_set_alarm_id(s_timer_wheel_horizon[dispatch_method], dispatch_method);
+            }
+#else
+            esp_timer_handle_t first = LIST_FIRST(&s_timers[dispatch_method]);
+            if (first == NULL || first->alarm > s_timer_wheel_horizon[dispatch_method]) {
+                esp_timer_impl_set_alarm_id(s_timer_wheel_horizon[dispatch_method], dispatch_method);
+            }
+#endif
+        }
+        return ESP_OK;
+    }
+#endif
     if (LIST_FIRST(&s_timers[dispatch_method]) == NULL) {
         LIST_INSERT_HEAD(&s_timers[dispatch_method], timer, list_entry);
     } else {
@@ -331,9 +402,18 @@ static ESP_TIMER_IRAM_ATTR esp_err_t timer_insert(esp_timer_handle_t timer, bool
             LIST_INSERT_AFTER(last, timer, list_entry);
         }
     }
+#if CONFIG_ESP_TIMER_COALESCING
+    if (without_update_alarm == false) {
+        // A timer with a later alarm but a smaller tolerance can still lower the
+        // coalesced target, so the hardware alarm is recomputed on every insertion,
+        // not only when the new timer becomes the head of the list.
+        esp_timer_impl_set_alarm_id(timer_coalesced_alarm(dispatch_method), dispatch_method);
+    }
+#else
     if (without_update_alarm == false && timer == LIST_FIRST(&s_timers[dispatch_method])) {
         esp_timer_impl_set_alarm_id(timer->alarm, dispatch_method);
     }
+#endif
     return ESP_OK;
 }
 
@@ -346,11 +426,21 @@ static ESP_TIMER_IRAM_ATTR esp_err_t timer_remove(esp_timer_handle_t timer)
     timer->alarm = 0;
     timer->period = 0;
     if (timer == first_timer) { // if this timer was the first in the list.
+#if CONFIG_ESP_TIMER_COALESCING
+        uint64_t next_timestamp = timer_coalesced_alarm(dispatch_method);
+#else
         uint64_t next_timestamp = UINT64_MAX;
         first_timer = LIST_FIRST(&s_timers[dispatch_method]);
         if (first_timer) { // if after removing the timer from the list, this list is not empty.
             next_timestamp = first_timer->alarm;
         }
+#endif
+#if CONFIG_ESP_TIMER_WHEEL
+        if (!LIST_EMPTY(&s_far_timers[dispatch_method])) {
+            // keep the cascade scheduled for the timers parked on the far list
+            next_timestamp = MIN(next_timestamp, s_timer_wheel_horizon[dispatch_method]);
+        }
+#endif
         esp_timer_impl_set_alarm_id(next_timestamp, dispatch_method);
     }
 #if WITH_PROFILING
@@ -401,6 +491,27 @@ static ESP_TIMER_IRAM_ATTR void timer_list_unlock(esp_timer_dispatch_t timer_typ
     portEXIT_CRITICAL_SAFE(&s_timer_lock[timer_type]);
 }
 
+#if CONFIG_ESP_TIMER_WHEEL
+/* Advance the near horizon and move far-list timers which now fall within it
+ * into the sorted dispatch list. Called with the list locked. */
+static void ESP_TIMER_IRAM_ATTR timer_wheel_cascade(esp_timer_dispatch_t dispatch_method)
+{
+    uint64_t now = esp_timer_impl_get_time();
+    s_timer_wheel_horizon[dispatch_method] = now + CONFIG_ESP_TIMER_WHEEL_HORIZON_US;
+    esp_timer_handle_t it, temp;
+    LIST_FOREACH_SAFE(it, &s_far_timers[dispatch_method], list_entry, temp) {
+        if (it->alarm <= s_timer_wheel_horizon[dispatch_method]) {
+            LIST_REMOVE(it, list_entry);
+#if WITH_PROFILING
+            // timer_insert() starts by unlinking the timer from the inactive list
+            timer_insert_inactive(it);
+#endif
+            timer_insert(it, true);
+        }
+    }
+}
+#endif // CONFIG_ESP_TIMER_WHEEL
+
 #ifdef CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
 static ESP_TIMER_IRAM_ATTR bool timer_process_alarm(esp_timer_dispatch_t dispatch_method)
 #else
@@ -408,6 +519,9 @@ static bool timer_process_alarm(esp_timer_dispatch_t dispatch_method)
 #endif
 {
     timer_list_lock(dispatch_method);
+#if CONFIG_ESP_TIMER_WHEEL
+    timer_wheel_cascade(dispatch_method);
+#endif
     bool processed = false;
     esp_timer_handle_t it;
     while (1) {
@@ -458,13 +572,24 @@ static bool timer_process_alarm(esp_timer_dispatch_t dispatch_method)
 #endif
         }
     } // while(1)
+#if CONFIG_ESP_TIMER_COALESCING
+    uint64_t next_alarm = timer_coalesced_alarm(dispatch_method);
+#else
+    uint64_t next_alarm = (it != NULL) ? it->alarm : UINT64_MAX;
+#endif
+#if CONFIG_ESP_TIMER_WHEEL
+    if (!LIST_EMPTY(&s_far_timers[dispatch_method])) {
+        // wake up at the horizon to cascade the far list even if no sorted timer is due earlier
+        next_alarm = MIN(next_alarm, s_timer_wheel_horizon[dispatch_method]);
+    }
+#endif
     if (it) {
         if (dispatch_method == ESP_TIMER_TASK || (dispatch_method != ESP_TIMER_TASK && processed == true)) {
-            esp_timer_impl_set_alarm_id(it->alarm, dispatch_method);
+            esp_timer_impl_set_alarm_id(next_alarm, dispatch_method);
         }
     } else {
         if (processed) {
-            esp_timer_impl_set_alarm_id(UINT64_MAX, dispatch_method);
+            esp_timer_impl_set_alarm_id(next_alarm, dispatch_method);
         }
     }
     timer_list_unlock(dispatch_method);
@@ -602,6 +727,11 @@ esp_err_t esp_timer_deinit(void)
         if (!LIST_EMPTY(&s_timers[dispatch_method])) {
             return ESP_ERR_INVALID_STATE;
         }
+#if CONFIG_ESP_TIMER_WHEEL
+        if (!LIST_EMPTY(&s_far_timers[dispatch_method])) {
+            return ESP_ERR_INVALID_STATE;
+        }
+#endif
     }
 
     /* We can only check if there are any timers which are not deleted if
@@ -661,6 +791,11 @@ esp_err_t esp_timer_dump(FILE* stream)
         LIST_FOREACH(it, &s_timers[dispatch_method], list_entry) {
             ++timer_count;
         }
+#if CONFIG_ESP_TIMER_WHEEL
+        LIST_FOREACH(it, &s_far_timers[dispatch_method], list_entry) {
+            ++timer_count;
+        }
+#endif
 #if WITH_PROFILING
         LIST_FOREACH(it, &s_inactive_timers[dispatch_method], list_entry) {
             ++timer_count;
@@ -687,6 +822,11 @@ esp_err_t esp_timer_dump(FILE* stream)
         LIST_FOREACH(it, &s_timers[dispatch_method], list_entry) {
             print_timer_info(it, &pos, &buf_size);
         }
+#if CONFIG_ESP_TIMER_WHEEL
+        LIST_FOREACH(it, &s_far_timers[dispatch_method], list_entry) {
+            print_timer_info(it, &pos, &buf_size);
+        }
+#endif
 #if WITH_PROFILING
         LIST_FOREACH(it, &s_inactive_timers[dispatch_method], list_entry) {
             print_timer_info(it, &pos, &buf_size);
@@ -723,6 +863,14 @@ int64_t ESP_TIMER_IRAM_ATTR esp_timer_get_next_alarm(void)
                 next_alarm = it->alarm;
             }
         }
+#if CONFIG_ESP_TIMER_WHEEL
+        // far list is unsorted, check every entry
+        LIST_FOREACH(it, &s_far_timers[dispatch_method], list_entry) {
+            if (next_alarm > it->alarm) {
+                next_alarm = it->alarm;
+            }
+        }
+#endif
         timer_list_unlock(dispatch_method);
     }
     return next_alarm;
@@ -743,6 +891,14 @@ int64_t ESP_TIMER_IRAM_ATTR esp_timer_get_next_alarm_for_wake_up(void)
                 break;
             }
         }
+#if CONFIG_ESP_TIMER_WHEEL
+        // far list is unsorted, no early exit possible
+        LIST_FOREACH(it, &s_far_timers[dispatch_method], list_entry) {
+            if ((it->flags & FL_SKIP_UNHANDLED_EVENTS) == 0 && next_alarm > it->alarm) {
+                next_alarm = it->alarm;
+            }
+        }
+#endif
         timer_list_unlock(dispatch_method);
     }
     return next_alarm;
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "esp_trace.h"
+
+/**
+ * @file
+ * @brief Lightweight compile-time tracepoints
+ *
+ * ESP_TRACEPOINT() provides a cheap, structured instrumentation point that
+ * compiles to nothing when CONFIG_ESP_TRACE_TRACEPOINTS is disabled. When
+ * enabled, each hit writes a fixed-size binary record (site ID, CPU cycle
+ * count, up to four word-sized arguments) into a per-core lock-free ring.
+ * Whether a given site actually records is controlled at runtime through a
+ * per-site bitmask, so individual code paths can be lit up on a production
+ * unit without recompiling.
+ *
+ * Records are binary only; the mapping from site ID and argument slots to
+ * their meaning is a contract between the instrumented code and the host
+ * side tooling that decodes the stream.
+ *
+ * The rings are drained from task context, either into an open trace
+ * session with esp_trace_tracepoint_flush() or through a user callback
+ * with esp_trace_tracepoint_drain().
+ */
+
+/** Maximum number of word-sized arguments per tracepoint record */
+#define ESP_TRACE_TRACEPOINT_MAX_ARGS   4
+
+#if CONFIG_ESP_TRACE_TRACEPOINTS
+
+/**
+ * @brief Fixed-size binary tracepoint record
+ */
+typedef struct {
+    uint16_t site;                                  /*!< Tracepoint site ID */
+    uint8_t core;                                   /*!< CPU core that hit the tracepoint */
+    uint8_t argc;                                   /*!< Number of valid entries in args */
+    uint32_t ccount;                                /*!< CPU cycle count at the time of the hit */
+    uint32_t args[ESP_TRACE_TRACEPOINT_MAX_ARGS];   /*!< Tracepoint arguments */
+} esp_trace_tracepoint_rec_t;
+
+/** Per-site enable bitmask; do not access directly, use the APIs below */
+extern uint32_t esp_trace_tracepoint_site_mask[(CONFIG_ESP_TRACE_TRACEPOINT_MAX_SITES + 31) / 32];
+
+void esp_trace_tracepoint_write(uint16_t site, uint8_t argc, ...);
+
+/**
+ * @brief Check whether a tracepoint site is currently enabled
+ *
+ * Kept inline so that a disabled site costs only a load and a test
+ * on the fast path.
+ *
+ * @param site  Tracepoint site ID
+ *
+ * @return true if the site is enabled, false otherwise
+ */
+static inline bool esp_trace_tracepoint_site_enabled(uint16_t site)
+{
+    if (site >= CONFIG_ESP_TRACE_TRACEPOINT_MAX_SITES) {
+        return false;
+    }
+    return (esp_trace_tracepoint_site_mask[site >> 5] >> (site & 31)) & 1;
+}
+
+/**
+ * @brief Record a tracepoint hit
+ *
+ * @param site  Tracepoint site ID (0 .. CONFIG_ESP_TRACE_TRACEPOINT_MAX_SITES - 1)
+ * @param ...   Up to ESP_TRACE_TRACEPOINT_MAX_ARGS word-sized arguments
+ *
+ * Safe to use from any context, including ISRs. When the site is disabled
+ * or the per-core ring is full, the hit is discarded (full rings increment
+ * a per-core drop counter reported at drain time).
+ */
+#define ESP_TRACEPOINT(site, ...) \
+    do { \
+        if (esp_trace_tracepoint_site_enabled(site)) { \
+            esp_trace_tracepoint_write((site), _ESP_TRACEPOINT_NARGS(__VA_ARGS__), ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+/** @cond */
+#define _ESP_TRACEPOINT_NARGS(...) _ESP_TRACEPOINT_NARGS_(0, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+#define _ESP_TRACEPOINT_NARGS_(_0, _1, _2, _3, _4, N, ...) N
+/** @endcond */
+
+/**
+ * @brief Callback invoked for every drained tracepoint record
+ *
+ * @param rec   Drained record (valid only for the duration of the call)
+ * @param arg   User argument passed to esp_trace_tracepoint_drain()
+ */
+typedef void (*esp_trace_tracepoint_drain_cb_t)(const esp_trace_tracepoint_rec_t *rec, void *arg);
+
+/**
+ * @brief Enable a tracepoint site
+ *
+ * @param site  Tracepoint site ID
+ *
+ * @return
+ *  - ESP_OK : Success
+ *  - ESP_ERR_INVALID_ARG : Site ID out of range
+ */
+esp_err_t esp_trace_tracepoint_enable(uint16_t site);
+
+/**
+ * @brief Disable a tracepoint site
+ *
+ * @param site  Tracepoint site ID
+ *
+ * @return
+ *  - ESP_OK : Success
+ *  - ESP_ERR_INVALID_ARG : Site ID out of range
+ */
+esp_err_t esp_trace_tracepoint_disable(uint16_t site);
+
+/**
+ * @brief Drain all per-core rings through a callback
+ *
+ * Invokes the callback once per pending record, oldest first, and resets
+ * the per-core drop counters.
+ *
+ * @param cb            Callback invoked for every record
+ * @param arg           User argument forwarded to the callback
+ * @param dropped_out   If not NULL, receives the total number of records
+ *                      dropped (rings full) since the previous drain
+ *
+ * @return
+ *  - ESP_OK : Success
+ *  - ESP_ERR_INVALID_ARG : Null callback
+ */
+esp_err_t esp_trace_tracepoint_drain(esp_trace_tracepoint_drain_cb_t cb, void *arg, uint32_t *dropped_out);
+
+/**
+ * @brief Drain all per-core rings into an open trace session
+ *
+ * Writes pending records in their binary form via esp_trace_write(),
+ * so they reach whichever transport the session is using (e.g. apptrace
+ * over JTAG/UART, or a network streamer).
+ *
+ * @param handle  Active trace session handle
+ * @param tmo     Timeout in us for each underlying write
+ *
+ * @return ESP_OK on success, otherwise see esp_err_t
+ */
+esp_err_t esp_trace_tracepoint_flush(esp_trace_handle_t handle, unsigned long tmo);
+
+#else // CONFIG_ESP_TRACE_TRACEPOINTS
+
+#define ESP_TRACEPOINT(site, ...) do {} while (0)
+
+#endif // CONFIG_ESP_TRACE_TRACEPOINTS
+
+#ifdef __cplusplus
+}
+#endif
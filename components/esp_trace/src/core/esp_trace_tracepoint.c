@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "soc/soc_caps.h"
+#include "freertos/FreeRTOS.h"
+
+#include "esp_trace_tracepoint.h"
+
+#define TP_RING_DEPTH  CONFIG_ESP_TRACE_TRACEPOINT_RING_DEPTH
+
+/* One ring per core. Within a core, producers (tasks and ISRs) are
+ * serialized by briefly masking local interrupts around the slot write,
+ * which keeps each ring single-producer. The drain task is the single
+ * consumer, so head/tail only need release/acquire pairing and no locks
+ * are involved on either side. */
+typedef struct {
+    atomic_uint_least32_t head;     /* free-running, written by the owning core */
+    atomic_uint_least32_t tail;     /* free-running, written by the drain task */
+    uint32_t dropped;               /* hits discarded because the ring was full */
+    esp_trace_tracepoint_rec_t slots[TP_RING_DEPTH];
+} tp_ring_t;
+
+static DRAM_ATTR tp_ring_t s_tp_rings[SOC_CPU_CORES_NUM];
+
+uint32_t esp_trace_tracepoint_site_mask[(CONFIG_ESP_TRACE_TRACEPOINT_MAX_SITES + 31) / 32];
+
+void IRAM_ATTR esp_trace_tracepoint_write(uint16_t site, uint8_t argc, ...)
+{
+    if (argc > ESP_TRACE_TRACEPOINT_MAX_ARGS) {
+        argc = ESP_TRACE_TRACEPOINT_MAX_ARGS;
+    }
+
+    uint32_t ccount = esp_cpu_get_cycle_count();
+
+    UBaseType_t int_state = portSET_INTERRUPT_MASK_FROM_ISR();
+
+    tp_ring_t *ring = &s_tp_rings[esp_cpu_get_core_id()];
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    if (head - tail >= TP_RING_DEPTH) {
+        ring->dropped++;
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(int_state);
+        return;
+    }
+
+    esp_trace_tracepoint_rec_t *rec = &ring->slots[head % TP_RING_DEPTH];
+    rec->site = site;
+    rec->core = esp_cpu_get_core_id();
+    rec->argc = argc;
+    rec->ccount = ccount;
+
+    va_list ap;
+    va_start(ap, argc);
+    for (uint8_t i = 0; i < argc; i++) {
+        rec->args[i] = va_arg(ap, uint32_t);
+    }
+    va_end(ap);
+
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(int_state);
+}
+
+esp_err_t esp_trace_tracepoint_enable(uint16_t site)
+{
+    if (site >= CONFIG_ESP_TRACE_TRACEPOINT_MAX_SITES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_trace_tracepoint_site_mask[site >> 5] |= (1UL << (site & 31));
+    return ESP_OK;
+}
+
+esp_err_t esp_trace_tracepoint_disable(uint16_t site)
+{
+    if (site >= CONFIG_ESP_TRACE_TRACEPOINT_MAX_SITES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_trace_tracepoint_site_mask[site >> 5] &= ~(1UL << (site & 31));
+    return ESP_OK;
+}
+
+esp_err_t esp_trace_tracepoint_drain(esp_trace_tracepoint_drain_cb_t cb, void *arg, uint32_t *dropped_out)
+{
+    if (cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t dropped = 0;
+    for (int core = 0; core < SOC_CPU_CORES_NUM; core++) {
+        tp_ring_t *ring = &s_tp_rings[core];
+
+        uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        while (tail != head) {
+            cb(&ring->slots[tail % TP_RING_DEPTH], arg);
+            tail++;
+            atomic_store_explicit(&ring->tail, tail, memory_order_release);
+        }
+
+        /* Imprecise (the producer may race the reset), which is fine
+         * for a diagnostic counter */
+        dropped += ring->dropped;
+        ring->dropped = 0;
+    }
+
+    if (dropped_out != NULL) {
+        *dropped_out = dropped;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_trace_tracepoint_flush(esp_trace_handle_t handle, unsigned long tmo)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+    for (int core = 0; core < SOC_CPU_CORES_NUM; core++) {
+        tp_ring_t *ring = &s_tp_rings[core];
+
+        uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        while (tail != head) {
+            esp_err_t err = esp_trace_write(handle, &ring->slots[tail % TP_RING_DEPTH],
+                                            sizeof(esp_trace_tracepoint_rec_t), tmo);
+            if (err != ESP_OK) {
+                /* Leave the record in place for the next flush attempt */
+                ret = err;
+                break;
+            }
+            tail++;
+            atomic_store_explicit(&ring->tail, tail, memory_order_release);
+        }
+    }
+    return ret;
+}
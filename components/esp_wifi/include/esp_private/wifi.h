@@ -154,6 +154,35 @@ void esp_wifi_internal_free_rx_buffer(void* buffer);
   */
 int esp_wifi_internal_tx(wifi_interface_t wifi_if, void *buffer, uint16_t len);
 
+/**
+  * @brief  Descriptor of one frame submitted via esp_wifi_internal_tx_batch()
+  */
+typedef struct {
+    void *buffer;       /**< the buffer to be transmit */
+    uint16_t len;       /**< the length of buffer */
+    esp_err_t result;   /**< per-frame submission result, filled in by esp_wifi_internal_tx_batch() */
+} wifi_tx_batch_item_t;
+
+/**
+  * @brief  transmit a burst of buffers via wifi driver
+  *
+  * Submits all frames of the batch to the WiFi driver in one pass so that the
+  * per-call queue handoff overhead is amortized over the whole burst. Each
+  * frame is copied to the driver the same way as with esp_wifi_internal_tx().
+  * Submission stops early if the driver TX queue becomes full; the remaining
+  * items are marked with ESP_ERR_NO_MEM.
+  *
+  * @param  wifi_if : wifi interface id
+  * @param  items : array of frames to transmit, each item's result field is updated
+  * @param  count : number of items in the array
+  *
+  * @return
+  *    - ESP_OK  : all frames were accepted by the wifi driver
+  *    - ESP_ERR_INVALID_ARG: invalid argument
+  *    - others : the result of the first frame that was not accepted
+  */
+esp_err_t esp_wifi_internal_tx_batch(wifi_interface_t wifi_if, wifi_tx_batch_item_t *items, uint16_t count);
+
 /**
   * @brief     The net stack buffer reference counter callback function
   *
@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_wifi.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One promiscuous filter match rule
+ *
+ * A frame matches a rule when every enabled predicate holds. A frame is
+ * delivered to the RX callback when it matches at least one rule of the
+ * installed program; rules are evaluated in the order given and evaluation
+ * stops at the first match.
+ */
+typedef struct {
+    uint32_t pkt_type_mask;     /**< OR of WIFI_PROMIS_FILTER_MASK_MGMT/CTRL/DATA/MISC this rule
+                                     applies to, 0 for all packet types */
+    bool match_bssid;           /**< Compare the BSSID (address 3) against bssid. Only frames long
+                                     enough to carry an address 3 field can match such a rule. */
+    uint8_t bssid[6];           /**< BSSID to match when match_bssid is set */
+    bool match_rssi;            /**< Require a minimum RSSI */
+    int8_t rssi_min;            /**< Lowest RSSI (dBm) that still matches when match_rssi is set */
+    uint16_t len_min;           /**< Minimum frame length including FCS, 0 for no lower bound */
+    uint16_t len_max;           /**< Maximum frame length including FCS, 0 for no upper bound */
+} wifi_prom_filter_rule_t;
+
+/**
+ * @brief Per-rule and aggregate filter statistics
+ */
+typedef struct {
+    uint32_t rx;                                              /**< Frames seen by the matcher */
+    uint32_t delivered;                                       /**< Frames that matched a rule and reached the callback */
+    uint32_t rule_hits[CONFIG_ESP_WIFI_PROM_FILTER_MAX_RULES]; /**< First-match count per rule, in program order */
+} wifi_prom_filter_stats_t;
+
+/**
+ * @brief Install a compiled promiscuous filter program
+ *
+ * Compiles the rules into a per-packet-type match program and registers an
+ * internal promiscuous RX callback that runs it before the application
+ * callback. The union of the rules' packet type masks is pushed into the
+ * driver's packet type filter (esp_wifi_set_promiscuous_filter), so frame
+ * types no rule can accept are discarded by the driver and never reach the
+ * matcher; the remaining predicates (BSSID, RSSI, length) are evaluated with
+ * early exit in the Wi-Fi task before the frame is handed to cb.
+ *
+ * The program replaces any callback registered with
+ * esp_wifi_set_promiscuous_rx_cb(). It may be installed before or while
+ * promiscuous mode is enabled and may be replaced by calling this function
+ * again; statistics restart from zero on each install.
+ *
+ * @param rules Match rules, evaluated in order
+ * @param num_rules Number of rules, 1 to CONFIG_ESP_WIFI_PROM_FILTER_MAX_RULES
+ * @param cb Callback invoked for frames matching at least one rule
+ *
+ * @return
+ *    - ESP_OK: program installed
+ *    - ESP_ERR_INVALID_ARG: rules or cb is NULL, num_rules out of range, or a
+ *      rule has len_max below len_min
+ *    - others: error from the underlying esp_wifi promiscuous API
+ */
+esp_err_t esp_wifi_prom_filter_set(const wifi_prom_filter_rule_t *rules, size_t num_rules,
+                                   wifi_promiscuous_cb_t cb);
+
+/**
+ * @brief Remove the installed filter program
+ *
+ * Unregisters the internal RX callback and restores the driver's packet type
+ * filter to WIFI_PROMIS_FILTER_MASK_ALL. Promiscuous mode itself is left in
+ * its current state.
+ *
+ * @return
+ *    - ESP_OK: program removed
+ *    - ESP_ERR_INVALID_STATE: no program installed
+ */
+esp_err_t esp_wifi_prom_filter_clear(void);
+
+/**
+ * @brief Read the filter statistics
+ *
+ * @param[out] stats Filled with the counters accumulated since the program
+ *                   was installed
+ *
+ * @return
+ *    - ESP_OK: success
+ *    - ESP_ERR_INVALID_ARG: stats is NULL
+ *    - ESP_ERR_INVALID_STATE: no program installed
+ */
+esp_err_t esp_wifi_prom_filter_get_stats(wifi_prom_filter_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -8,6 +8,9 @@
 #include "esp_log.h"
 #include "esp_private/wifi.h"
 #include "esp_wifi_netif.h"
+#if CONFIG_ESP_WIFI_ENABLE_ADAPTIVE_PS_APP
+#include "esp_wifi_adaptive_ps.h"
+#endif
 
 //
 //  Purpose of this module is provide object oriented abstraction to wifi interfaces
@@ -36,6 +39,9 @@ static esp_netif_t *s_wifi_netifs[MAX_WIFI_IFS] = { NULL };
  */
 static esp_err_t wifi_sta_receive(void *buffer, uint16_t len, void *eb)
 {
+#if CONFIG_ESP_WIFI_ENABLE_ADAPTIVE_PS_APP
+    wifi_adaptive_ps_note_traffic();
+#endif
     return s_wifi_rxcbs[WIFI_IF_STA](s_wifi_netifs[WIFI_IF_STA], buffer, len, eb);
 }
 
@@ -63,12 +69,22 @@ static void wifi_free(void *h, void* buffer)
 static esp_err_t wifi_transmit(void *h, void *buffer, size_t len)
 {
     wifi_netif_driver_t driver = h;
+#if CONFIG_ESP_WIFI_ENABLE_ADAPTIVE_PS_APP
+    if (driver->wifi_if == WIFI_IF_STA) {
+        wifi_adaptive_ps_note_traffic();
+    }
+#endif
     return esp_wifi_internal_tx(driver->wifi_if, buffer, len);
 }
 
 static esp_err_t wifi_transmit_wrap(void *h, void *buffer, size_t len, void *netstack_buf)
 {
     wifi_netif_driver_t driver = h;
+#if CONFIG_ESP_WIFI_ENABLE_ADAPTIVE_PS_APP
+    if (driver->wifi_if == WIFI_IF_STA) {
+        wifi_adaptive_ps_note_traffic();
+    }
+#endif
 #if CONFIG_SPIRAM_TRY_ALLOCATE_WIFI_LWIP && !CONFIG_SPIRAM_IGNORE_NOTFOUND
     return esp_wifi_internal_tx_by_ref(driver->wifi_if, buffer, len, netstack_buf);
 #else
@@ -76,6 +92,27 @@ static esp_err_t wifi_transmit_wrap(void *h, void *buffer, size_t len, void *net
 #endif
 }
 
+esp_err_t esp_wifi_internal_tx_batch(wifi_interface_t wifi_if, wifi_tx_batch_item_t *items, uint16_t count)
+{
+    if (items == NULL || count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t first_err = ESP_OK;
+    for (uint16_t i = 0; i < count; i++) {
+        if (first_err == ESP_ERR_NO_MEM) {
+            // the driver TX queue filled up earlier in this burst, don't
+            // pay the submission cost for the rest of the batch
+            items[i].result = ESP_ERR_NO_MEM;
+            continue;
+        }
+        items[i].result = esp_wifi_internal_tx(wifi_if, items[i].buffer, items[i].len);
+        if (items[i].result != ESP_OK && first_err == ESP_OK) {
+            first_err = items[i].result;
+        }
+    }
+    return first_err;
+}
+
 static esp_err_t wifi_driver_start(esp_netif_t * esp_netif, void * args)
 {
     wifi_netif_driver_t driver = args;
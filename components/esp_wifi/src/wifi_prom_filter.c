@@ -0,0 +1,207 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <inttypes.h>
+#include "esp_log.h"
+#include "esp_wifi.h"
+#include "esp_wifi_prom_filter.h"
+
+/* Predicate opcodes of a compiled rule. The compiler orders the checks so
+ * the cheapest comparisons run first and a failing frame leaves the rule
+ * after as little work as possible. */
+#define PROM_OP_RSSI    BIT(0)  /* rx_ctrl.rssi >= rssi_min */
+#define PROM_OP_LEN_MIN BIT(1)  /* sig_len >= len_min */
+#define PROM_OP_LEN_MAX BIT(2)  /* sig_len <= len_max */
+#define PROM_OP_BSSID   BIT(3)  /* address 3 == bssid */
+
+/* Offset of address 3 in the MAC header: frame control (2) + duration (2)
+ * + address 1 (6) + address 2 (6). */
+#define PROM_ADDR3_OFFSET  16
+#define PROM_ADDR3_MIN_LEN (PROM_ADDR3_OFFSET + 6)
+
+typedef struct {
+    uint8_t ops;            /* PROM_OP_* checks this rule performs */
+    uint8_t rule_idx;       /* index in the installed rule array, for the hit counter */
+    int8_t rssi_min;
+    uint16_t len_min;
+    uint16_t len_max;
+    uint8_t bssid[6];
+} prom_compiled_rule_t;
+
+typedef struct {
+    /* Rules bucketed by packet type, so a frame only walks the rules that
+     * can accept its type. Entries reference s_prog.rules. */
+    prom_compiled_rule_t rules[CONFIG_ESP_WIFI_PROM_FILTER_MAX_RULES];
+    uint8_t bucket[4][CONFIG_ESP_WIFI_PROM_FILTER_MAX_RULES]; /* WIFI_PKT_MGMT..WIFI_PKT_MISC */
+    uint8_t bucket_len[4];
+    wifi_promiscuous_cb_t cb;
+    wifi_prom_filter_stats_t stats;
+    bool installed;
+} prom_filter_prog_t;
+
+static prom_filter_prog_t s_prog;
+
+static const char *TAG = "wifi_prom_filter";
+
+static uint32_t prom_type_bit(wifi_promiscuous_pkt_type_t type)
+{
+    switch (type) {
+    case WIFI_PKT_MGMT: return WIFI_PROMIS_FILTER_MASK_MGMT;
+    case WIFI_PKT_CTRL: return WIFI_PROMIS_FILTER_MASK_CTRL;
+    case WIFI_PKT_DATA: return WIFI_PROMIS_FILTER_MASK_DATA;
+    default:            return WIFI_PROMIS_FILTER_MASK_MISC;
+    }
+}
+
+static void prom_filter_rx_cb(void *buf, wifi_promiscuous_pkt_type_t type)
+{
+    const wifi_promiscuous_pkt_t *pkt = (const wifi_promiscuous_pkt_t *)buf;
+    prom_filter_prog_t *prog = &s_prog;
+
+    prog->stats.rx++;
+
+    uint32_t bucket = (type <= WIFI_PKT_MISC) ? (uint32_t)type : (uint32_t)WIFI_PKT_MISC;
+    uint32_t len = pkt->rx_ctrl.sig_len;
+    int rssi = pkt->rx_ctrl.rssi;
+
+    const uint8_t *idx = prog->bucket[bucket];
+    for (uint32_t i = 0; i < prog->bucket_len[bucket]; i++) {
+        const prom_compiled_rule_t *rule = &prog->rules[idx[i]];
+        uint8_t ops = rule->ops;
+
+        if ((ops & PROM_OP_RSSI) && rssi < rule->rssi_min) {
+            continue;
+        }
+        if ((ops & PROM_OP_LEN_MIN) && len < rule->len_min) {
+            continue;
+        }
+        if ((ops & PROM_OP_LEN_MAX) && len > rule->len_max) {
+            continue;
+        }
+        if (ops & PROM_OP_BSSID) {
+            if (len < PROM_ADDR3_MIN_LEN ||
+                    memcmp(pkt->payload + PROM_ADDR3_OFFSET, rule->bssid, 6) != 0) {
+                continue;
+            }
+        }
+
+        prog->stats.rule_hits[rule->rule_idx]++;
+        prog->stats.delivered++;
+        prog->cb(buf, type);
+        return;
+    }
+}
+
+esp_err_t esp_wifi_prom_filter_set(const wifi_prom_filter_rule_t *rules, size_t num_rules,
+                                   wifi_promiscuous_cb_t cb)
+{
+    if (rules == NULL || cb == NULL ||
+            num_rules == 0 || num_rules > CONFIG_ESP_WIFI_PROM_FILTER_MAX_RULES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < num_rules; i++) {
+        if (rules[i].len_max != 0 && rules[i].len_max < rules[i].len_min) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    /* Build the program into a scratch copy first so a failing driver call
+     * leaves any installed program untouched. */
+    prom_filter_prog_t prog = { 0 };
+    uint32_t hw_mask = 0;
+
+    for (size_t i = 0; i < num_rules; i++) {
+        const wifi_prom_filter_rule_t *in = &rules[i];
+        prom_compiled_rule_t *out = &prog.rules[i];
+
+        out->rule_idx = i;
+        if (in->match_rssi) {
+            out->ops |= PROM_OP_RSSI;
+            out->rssi_min = in->rssi_min;
+        }
+        if (in->len_min != 0) {
+            out->ops |= PROM_OP_LEN_MIN;
+            out->len_min = in->len_min;
+        }
+        if (in->len_max != 0) {
+            out->ops |= PROM_OP_LEN_MAX;
+            out->len_max = in->len_max;
+        }
+        if (in->match_bssid) {
+            out->ops |= PROM_OP_BSSID;
+            memcpy(out->bssid, in->bssid, 6);
+        }
+
+        uint32_t type_mask = in->pkt_type_mask ? in->pkt_type_mask : WIFI_PROMIS_FILTER_MASK_ALL;
+        hw_mask |= type_mask;
+        /* The MPDU/AMPDU sub-type bits select data frames in the driver
+         * filter, but those frames arrive at the callback as WIFI_PKT_DATA,
+         * so fold them into the DATA bucket for matching. */
+        if (type_mask & (WIFI_PROMIS_FILTER_MASK_DATA_MPDU | WIFI_PROMIS_FILTER_MASK_DATA_AMPDU)) {
+            type_mask |= WIFI_PROMIS_FILTER_MASK_DATA;
+        }
+        for (wifi_promiscuous_pkt_type_t t = WIFI_PKT_MGMT; t <= WIFI_PKT_MISC; t++) {
+            if ((type_mask & prom_type_bit(t)) == 0) {
+                continue;
+            }
+            /* MISC buffers carry no payload, so a BSSID rule can never
+             * match there and must not read past the metadata header. */
+            if (t == WIFI_PKT_MISC && (out->ops & PROM_OP_BSSID)) {
+                continue;
+            }
+            prog.bucket[t][prog.bucket_len[t]++] = i;
+        }
+    }
+    prog.cb = cb;
+    prog.installed = true;
+
+    /* Push the union of the rule type masks into the driver's packet type
+     * filter; frame types no rule accepts are dropped before the callback. */
+    wifi_promiscuous_filter_t hw_filter = { .filter_mask = hw_mask };
+    esp_err_t err = esp_wifi_set_promiscuous_filter(&hw_filter);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    /* Quiesce the matcher while the program is swapped, so the Wi-Fi task
+     * never runs it against a half-copied rule set. */
+    if (s_prog.installed) {
+        esp_wifi_set_promiscuous_rx_cb(NULL);
+    }
+    s_prog = prog;
+    err = esp_wifi_set_promiscuous_rx_cb(prom_filter_rx_cb);
+    if (err != ESP_OK) {
+        s_prog.installed = false;
+        return err;
+    }
+    ESP_LOGD(TAG, "installed %u rules, driver type mask 0x%" PRIx32, (unsigned)num_rules, hw_mask);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_prom_filter_clear(void)
+{
+    if (!s_prog.installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_wifi_set_promiscuous_rx_cb(NULL);
+    wifi_promiscuous_filter_t hw_filter = { .filter_mask = WIFI_PROMIS_FILTER_MASK_ALL };
+    esp_wifi_set_promiscuous_filter(&hw_filter);
+    memset(&s_prog, 0, sizeof(s_prog));
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_prom_filter_get_stats(wifi_prom_filter_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_prog.installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *stats = s_prog.stats;
+    return ESP_OK;
+}
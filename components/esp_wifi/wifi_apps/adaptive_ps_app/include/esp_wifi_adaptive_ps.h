@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_wifi_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Adaptive power save controller configuration
+ */
+typedef struct {
+    wifi_ps_type_t active_ps_type;  /**< Power save mode while traffic is flowing, default WIFI_PS_MIN_MODEM */
+    wifi_ps_type_t idle_ps_type;    /**< Power save mode after the idle timeout, default WIFI_PS_MAX_MODEM */
+    uint32_t poll_interval_ms;      /**< Traffic sampling period, 0 for the default (100 ms) */
+    uint32_t idle_timeout_ms;       /**< Time without traffic before dropping to the idle mode, 0 for the default (3000 ms) */
+    uint32_t active_threshold;      /**< Packets per sampling period that count as activity, 0 for the default (1) */
+    uint16_t idle_listen_interval;  /**< Listen interval (in beacon intervals) to request from the AP,
+                                         0 leaves the station config untouched. Applied to the station
+                                         config on start and negotiated on the next association. */
+} wifi_adaptive_ps_config_t;
+
+/**
+ * @brief Adaptive power save controller statistics
+ */
+typedef struct {
+    uint32_t transitions_to_active; /**< Number of switches to the active power save mode */
+    uint32_t transitions_to_idle;   /**< Number of switches to the idle power save mode */
+    uint32_t hints;                 /**< Number of esp_wifi_adaptive_ps_hint_active() calls */
+    uint64_t time_active_us;        /**< Accumulated time spent in the active mode */
+    uint64_t time_idle_us;          /**< Accumulated time spent in the idle mode */
+    bool active;                    /**< True if the controller is currently in the active mode */
+} wifi_adaptive_ps_stats_t;
+
+/**
+ * @brief Start the adaptive power save controller
+ *
+ * The controller samples the station TX/RX packet flow and switches between
+ * the configured active and idle power save modes with hysteresis: any
+ * sampling period with traffic at or above the activity threshold keeps or
+ * puts the modem in the active mode, and the idle mode is entered only after
+ * idle_timeout_ms without such a period and with no application hint pending.
+ *
+ * @param config Controller configuration, NULL for defaults
+ *
+ * @return
+ *    - ESP_OK: controller started
+ *    - ESP_ERR_INVALID_STATE: controller already running
+ *    - ESP_ERR_NO_MEM: out of memory
+ */
+esp_err_t esp_wifi_adaptive_ps_start(const wifi_adaptive_ps_config_t *config);
+
+/**
+ * @brief Stop the adaptive power save controller
+ *
+ * The power save mode last set by the controller is left in place.
+ *
+ * @return
+ *    - ESP_OK: controller stopped
+ *    - ESP_ERR_INVALID_STATE: controller not running
+ */
+esp_err_t esp_wifi_adaptive_ps_stop(void);
+
+/**
+ * @brief Hint that the application expects traffic soon
+ *
+ * Forces the active power save mode for the given duration, e.g. before
+ * issuing a request whose response latency matters. The controller returns
+ * to traffic-based decisions when the hint expires.
+ *
+ * @param duration_ms How long to force the active mode, 0 for one idle timeout
+ *
+ * @return
+ *    - ESP_OK: hint recorded
+ *    - ESP_ERR_INVALID_STATE: controller not running
+ */
+esp_err_t esp_wifi_adaptive_ps_hint_active(uint32_t duration_ms);
+
+/**
+ * @brief Get transition and residency statistics of the controller
+ *
+ * @param stats Filled with the counters collected since start
+ *
+ * @return
+ *    - ESP_OK: on success
+ *    - ESP_ERR_INVALID_ARG: stats is NULL
+ *    - ESP_ERR_INVALID_STATE: controller not running
+ */
+esp_err_t esp_wifi_adaptive_ps_get_stats(wifi_adaptive_ps_stats_t *stats);
+
+/**
+ * @brief Account one station TX/RX packet, called from the netif glue
+ * @note Internal use
+ */
+void wifi_adaptive_ps_note_traffic(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,235 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+
+#include "esp_wifi_adaptive_ps.h"
+
+#define ADAPTIVE_PS_DEFAULT_POLL_MS     100
+#define ADAPTIVE_PS_DEFAULT_IDLE_MS     3000
+#define ADAPTIVE_PS_DEFAULT_THRESHOLD   1
+
+static const char *TAG = "adaptive_ps";
+
+typedef struct {
+    SemaphoreHandle_t lock;
+    esp_timer_handle_t poll_timer;
+    wifi_adaptive_ps_config_t config;
+    bool running;
+    bool active;
+    uint32_t last_pkt_count;        /* counter snapshot of the previous tick */
+    int64_t last_traffic_us;        /* last tick that met the activity threshold */
+    int64_t hint_until_us;          /* active mode forced until this time */
+    int64_t state_since_us;         /* entry time of the current mode */
+    wifi_adaptive_ps_stats_t stats;
+} adaptive_ps_t;
+
+static adaptive_ps_t s_adaptive_ps;
+
+/* Written from the Wi-Fi and LwIP tasks via wifi_adaptive_ps_note_traffic(),
+ * read by the poll timer; only the packet count crosses task boundaries */
+static atomic_uint_fast32_t s_pkt_count;
+
+void wifi_adaptive_ps_note_traffic(void)
+{
+    atomic_fetch_add_explicit(&s_pkt_count, 1, memory_order_relaxed);
+}
+
+/* called with the lock held */
+static void adaptive_ps_enter(bool active, int64_t now_us)
+{
+    wifi_ps_type_t ps_type = active ? s_adaptive_ps.config.active_ps_type
+                             : s_adaptive_ps.config.idle_ps_type;
+
+    esp_err_t err = esp_wifi_set_ps(ps_type);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "failed to set ps mode %d (0x%x)", ps_type, err);
+        return;
+    }
+    if (s_adaptive_ps.active) {
+        s_adaptive_ps.stats.time_active_us += now_us - s_adaptive_ps.state_since_us;
+    } else {
+        s_adaptive_ps.stats.time_idle_us += now_us - s_adaptive_ps.state_since_us;
+    }
+    if (active) {
+        s_adaptive_ps.stats.transitions_to_active++;
+    } else {
+        s_adaptive_ps.stats.transitions_to_idle++;
+    }
+    s_adaptive_ps.active = active;
+    s_adaptive_ps.state_since_us = now_us;
+    ESP_LOGD(TAG, "switched to %s mode", active ? "active" : "idle");
+}
+
+static void adaptive_ps_poll(void *arg)
+{
+    int64_t now_us = esp_timer_get_time();
+    uint32_t count = (uint32_t)atomic_load_explicit(&s_pkt_count, memory_order_relaxed);
+
+    xSemaphoreTake(s_adaptive_ps.lock, portMAX_DELAY);
+    if (!s_adaptive_ps.running) {
+        goto out;
+    }
+    if (count - s_adaptive_ps.last_pkt_count >= s_adaptive_ps.config.active_threshold) {
+        s_adaptive_ps.last_traffic_us = now_us;
+    }
+    s_adaptive_ps.last_pkt_count = count;
+
+    bool active = (now_us - s_adaptive_ps.last_traffic_us < (int64_t)s_adaptive_ps.config.idle_timeout_ms * 1000) ||
+                  (now_us < s_adaptive_ps.hint_until_us);
+    if (active != s_adaptive_ps.active) {
+        adaptive_ps_enter(active, now_us);
+    }
+out:
+    xSemaphoreGive(s_adaptive_ps.lock);
+}
+
+esp_err_t esp_wifi_adaptive_ps_start(const wifi_adaptive_ps_config_t *config)
+{
+    esp_err_t ret = ESP_OK;
+    wifi_adaptive_ps_config_t default_config = { 0 };
+
+    if (config == NULL) {
+        config = &default_config;
+    }
+    if (s_adaptive_ps.lock == NULL) {
+        SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+        ESP_RETURN_ON_FALSE(lock != NULL, ESP_ERR_NO_MEM, TAG, "no mem for lock");
+        /* the first call may race only with itself, the API is not expected
+         * to be entered concurrently before the first start */
+        s_adaptive_ps.lock = lock;
+    }
+
+    xSemaphoreTake(s_adaptive_ps.lock, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(!s_adaptive_ps.running, ESP_ERR_INVALID_STATE, out, TAG, "controller already running");
+
+    s_adaptive_ps.config = *config;
+    if (s_adaptive_ps.config.active_ps_type == WIFI_PS_NONE && config->idle_ps_type == WIFI_PS_NONE) {
+        s_adaptive_ps.config.active_ps_type = WIFI_PS_MIN_MODEM;
+        s_adaptive_ps.config.idle_ps_type = WIFI_PS_MAX_MODEM;
+    }
+    if (s_adaptive_ps.config.poll_interval_ms == 0) {
+        s_adaptive_ps.config.poll_interval_ms = ADAPTIVE_PS_DEFAULT_POLL_MS;
+    }
+    if (s_adaptive_ps.config.idle_timeout_ms == 0) {
+        s_adaptive_ps.config.idle_timeout_ms = ADAPTIVE_PS_DEFAULT_IDLE_MS;
+    }
+    if (s_adaptive_ps.config.active_threshold == 0) {
+        s_adaptive_ps.config.active_threshold = ADAPTIVE_PS_DEFAULT_THRESHOLD;
+    }
+
+    if (s_adaptive_ps.config.idle_listen_interval != 0) {
+        /* takes effect when the station (re)associates */
+        wifi_config_t wifi_config;
+        if (esp_wifi_get_config(WIFI_IF_STA, &wifi_config) == ESP_OK) {
+            wifi_config.sta.listen_interval = s_adaptive_ps.config.idle_listen_interval;
+            if (esp_wifi_set_config(WIFI_IF_STA, &wifi_config) != ESP_OK) {
+                ESP_LOGW(TAG, "failed to set listen interval, keeping current station config");
+            }
+        }
+    }
+
+    if (s_adaptive_ps.poll_timer == NULL) {
+        const esp_timer_create_args_t timer_args = {
+            .callback = adaptive_ps_poll,
+            .name = "adaptive_ps",
+        };
+        ESP_GOTO_ON_ERROR(esp_timer_create(&timer_args, &s_adaptive_ps.poll_timer),
+                          out, TAG, "failed to create poll timer");
+    }
+
+    memset(&s_adaptive_ps.stats, 0, sizeof(s_adaptive_ps.stats));
+    s_adaptive_ps.last_pkt_count = (uint32_t)atomic_load_explicit(&s_pkt_count, memory_order_relaxed);
+    s_adaptive_ps.last_traffic_us = esp_timer_get_time();
+    s_adaptive_ps.hint_until_us = 0;
+    s_adaptive_ps.state_since_us = esp_timer_get_time();
+    s_adaptive_ps.running = true;
+
+    /* start out responsive, drop to idle only after the timeout */
+    s_adaptive_ps.active = false;
+    adaptive_ps_enter(true, s_adaptive_ps.state_since_us);
+    s_adaptive_ps.stats.transitions_to_active = 0;
+
+    ret = esp_timer_start_periodic(s_adaptive_ps.poll_timer,
+                                   (uint64_t)s_adaptive_ps.config.poll_interval_ms * 1000);
+    if (ret != ESP_OK) {
+        s_adaptive_ps.running = false;
+    }
+out:
+    xSemaphoreGive(s_adaptive_ps.lock);
+    return ret;
+}
+
+esp_err_t esp_wifi_adaptive_ps_stop(void)
+{
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(s_adaptive_ps.lock != NULL, ESP_ERR_INVALID_STATE, TAG, "controller not running");
+    xSemaphoreTake(s_adaptive_ps.lock, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(s_adaptive_ps.running, ESP_ERR_INVALID_STATE, out, TAG, "controller not running");
+    esp_timer_stop(s_adaptive_ps.poll_timer);
+    s_adaptive_ps.running = false;
+out:
+    xSemaphoreGive(s_adaptive_ps.lock);
+    return ret;
+}
+
+esp_err_t esp_wifi_adaptive_ps_hint_active(uint32_t duration_ms)
+{
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(s_adaptive_ps.lock != NULL, ESP_ERR_INVALID_STATE, TAG, "controller not running");
+    xSemaphoreTake(s_adaptive_ps.lock, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(s_adaptive_ps.running, ESP_ERR_INVALID_STATE, out, TAG, "controller not running");
+
+    int64_t now_us = esp_timer_get_time();
+    if (duration_ms == 0) {
+        duration_ms = s_adaptive_ps.config.idle_timeout_ms;
+    }
+    int64_t until_us = now_us + (int64_t)duration_ms * 1000;
+    if (until_us > s_adaptive_ps.hint_until_us) {
+        s_adaptive_ps.hint_until_us = until_us;
+    }
+    s_adaptive_ps.stats.hints++;
+    /* switch right away instead of waiting for the next poll tick */
+    if (!s_adaptive_ps.active) {
+        adaptive_ps_enter(true, now_us);
+    }
+out:
+    xSemaphoreGive(s_adaptive_ps.lock);
+    return ret;
+}
+
+esp_err_t esp_wifi_adaptive_ps_get_stats(wifi_adaptive_ps_stats_t *stats)
+{
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(stats != NULL, ESP_ERR_INVALID_ARG, TAG, "stats can't be NULL");
+    ESP_RETURN_ON_FALSE(s_adaptive_ps.lock != NULL, ESP_ERR_INVALID_STATE, TAG, "controller not running");
+    xSemaphoreTake(s_adaptive_ps.lock, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(s_adaptive_ps.running, ESP_ERR_INVALID_STATE, out, TAG, "controller not running");
+
+    *stats = s_adaptive_ps.stats;
+    /* include the residency of the mode currently in progress */
+    int64_t span = esp_timer_get_time() - s_adaptive_ps.state_since_us;
+    if (s_adaptive_ps.active) {
+        stats->time_active_us += span;
+    } else {
+        stats->time_idle_us += span;
+    }
+    stats->active = s_adaptive_ps.active;
+out:
+    xSemaphoreGive(s_adaptive_ps.lock);
+    return ret;
+}
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_now.h"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration for the ESPNOW batch sender
+ */
+typedef struct {
+    uint16_t queue_len;          /**< Maximum number of batches waiting to be sent */
+    uint16_t default_rate_fps;   /**< Default per-peer rate limit in frames per second, 0 means unlimited */
+    uint32_t rx_ring_size;       /**< Size of the RX ingest ring in bytes (power of two), 0 disables RX buffering */
+    uint32_t task_stack_size;    /**< Stack size of the sender task */
+    uint32_t task_prio;          /**< Priority of the sender task */
+} esp_now_batch_config_t;
+
+#define ESP_NOW_BATCH_CONFIG_DEFAULT() { \
+    .queue_len = 8,                      \
+    .default_rate_fps = 0,               \
+    .rx_ring_size = 4096,                \
+    .task_stack_size = 3072,             \
+    .task_prio = 5,                      \
+}
+
+/**
+ * @brief One frame of a batch
+ */
+typedef struct {
+    const uint8_t *peer_addr;    /**< Destination MAC address */
+    const uint8_t *data;         /**< Payload, not copied: must stay valid until the batch completes */
+    uint16_t data_len;           /**< Payload length, at most ESP_NOW_MAX_DATA_LEN_V2 */
+} esp_now_batch_frame_t;
+
+/**
+ * @brief Aggregated result of a completed batch
+ */
+typedef struct {
+    uint32_t batch_id;           /**< Identifier returned by esp_now_batch_send() */
+    uint16_t total_num;          /**< Number of frames in the batch */
+    uint16_t sent_num;           /**< Frames acknowledged by the peer (or sent, for broadcast) */
+    uint16_t failed_num;         /**< Frames that failed to send */
+} esp_now_batch_result_t;
+
+/**
+ * @brief Callback invoked once per batch when all of its frames have been sent
+ *
+ * Runs in the context of the batch sender task.
+ */
+typedef void (*esp_now_batch_send_cb_t)(const esp_now_batch_result_t *result, void *arg);
+
+/**
+ * @brief Received ESPNOW frame popped from the RX ingest ring
+ */
+typedef struct {
+    uint8_t src_addr[ESP_NOW_ETH_ALEN];  /**< Source MAC address */
+    int8_t rssi;                         /**< RSSI of the received frame */
+    uint16_t data_len;                   /**< Payload length */
+} esp_now_batch_recv_meta_t;
+
+/**
+ * @brief Start the ESPNOW batch sender
+ *
+ * Registers the ESPNOW send and receive callbacks, so the application must not install its
+ * own callbacks via esp_now_register_send_cb()/esp_now_register_recv_cb() while the batch
+ * sender is running. esp_now_init() must have been called before.
+ *
+ * @param config Batch sender configuration
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG on invalid configuration
+ *      - ESP_ERR_INVALID_STATE if already initialized
+ *      - ESP_ERR_NO_MEM on allocation failure
+ */
+esp_err_t esp_now_batch_init(const esp_now_batch_config_t *config);
+
+/**
+ * @brief Stop the ESPNOW batch sender and release its resources
+ *
+ * Pending batches complete with their remaining frames counted as failed.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if not initialized
+ */
+esp_err_t esp_now_batch_deinit(void);
+
+/**
+ * @brief Queue a batch of frames for transmission
+ *
+ * Frames are sent in order, one aggregated callback fires after the last one. The frames
+ * array and all payloads must stay valid until that callback runs; no copies are made.
+ *
+ * @param frames      Array of frames to send
+ * @param frames_num  Number of frames in the array
+ * @param cb          Completion callback, can be NULL
+ * @param cb_arg      Argument passed to the completion callback
+ * @param batch_id    Optional out parameter receiving the batch identifier, can be NULL
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG on invalid frames
+ *      - ESP_ERR_INVALID_STATE if not initialized
+ *      - ESP_ERR_NO_MEM if the batch queue is full
+ */
+esp_err_t esp_now_batch_send(const esp_now_batch_frame_t *frames, uint16_t frames_num,
+                             esp_now_batch_send_cb_t cb, void *cb_arg, uint32_t *batch_id);
+
+/**
+ * @brief Set the transmission rate limit towards one peer
+ *
+ * @param peer_addr           Peer MAC address
+ * @param max_frames_per_sec  Maximum sustained frame rate, 0 removes the limit
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if not initialized
+ *      - ESP_ERR_NO_MEM if the rate table is full
+ */
+esp_err_t esp_now_batch_set_peer_rate(const uint8_t *peer_addr, uint16_t max_frames_per_sec);
+
+/**
+ * @brief Pop one received frame from the RX ingest ring
+ *
+ * The receive callback places frames into a fixed ring without allocations; this function
+ * consumes them from any task. Only a single consumer task is supported.
+ *
+ * @param meta     Receives the frame metadata
+ * @param data     Buffer for the payload
+ * @param data_len On input the buffer size, on output the payload length. Oversized
+ *                 payloads are truncated to the buffer size.
+ * @param wait     Maximum time to wait for a frame
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_TIMEOUT if no frame arrived in time
+ *      - ESP_ERR_INVALID_STATE if not initialized or RX buffering is disabled
+ */
+esp_err_t esp_now_batch_recv(esp_now_batch_recv_meta_t *meta, uint8_t *data, uint16_t *data_len,
+                             TickType_t wait);
+
+/**
+ * @brief Number of received frames dropped because the RX ingest ring was full
+ *
+ * @return Cumulative dropped frame count since esp_now_batch_init()
+ */
+uint32_t esp_now_batch_rx_dropped_count(void);
+
+#ifdef __cplusplus
+}
+#endif
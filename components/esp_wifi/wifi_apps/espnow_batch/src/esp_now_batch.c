@@ -0,0 +1,387 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_now.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_now_batch.h"
+
+static const char *TAG = "espnow_batch";
+
+#define ESP_NOW_BATCH_PEER_RATE_NUM   8     /* per-peer rate limiter slots */
+#define ESP_NOW_BATCH_SEND_TIMEOUT_MS 500   /* give up waiting for a send callback */
+
+/* One queued batch. The frames array and payloads are caller owned. */
+typedef struct {
+    const esp_now_batch_frame_t *frames;
+    uint16_t frames_num;
+    esp_now_batch_send_cb_t cb;
+    void *cb_arg;
+    uint32_t batch_id;
+} esp_now_batch_job_t;
+
+typedef struct {
+    uint8_t peer_addr[ESP_NOW_ETH_ALEN];
+    bool in_use;
+    uint32_t interval_us;       /* minimum gap between frames, 0 = unlimited */
+    int64_t next_send_us;       /* earliest time the next frame may go out */
+} esp_now_batch_peer_rate_t;
+
+/* Fixed-size record in the RX ingest ring. Single producer (Wi-Fi task receive
+ * callback), single consumer (application task), so the free-running head/tail
+ * indices need no lock: the producer publishes head only after the record is
+ * written, the consumer publishes tail only after the record is read. */
+typedef struct {
+    uint8_t src_addr[ESP_NOW_ETH_ALEN];
+    int8_t rssi;
+    uint8_t reserved;
+    uint16_t data_len;
+} esp_now_batch_rx_rec_t;
+
+typedef struct {
+    esp_now_batch_config_t config;
+    QueueHandle_t job_queue;
+    TaskHandle_t task_handle;
+    volatile bool run;
+    esp_now_batch_peer_rate_t peer_rates[ESP_NOW_BATCH_PEER_RATE_NUM];
+    portMUX_TYPE rate_lock;
+    uint32_t next_batch_id;
+    /* result of the frame currently in flight, written by the send callback */
+    volatile esp_now_send_status_t send_status;
+    /* RX ingest ring */
+    uint8_t *rx_ring;
+    volatile uint32_t rx_head;
+    volatile uint32_t rx_tail;
+    volatile uint32_t rx_dropped;
+    SemaphoreHandle_t rx_sem;
+} esp_now_batch_ctx_t;
+
+static esp_now_batch_ctx_t *s_batch_ctx = NULL;
+
+static inline uint32_t rx_ring_mask(const esp_now_batch_ctx_t *ctx)
+{
+    return ctx->config.rx_ring_size - 1;
+}
+
+static void rx_ring_write(esp_now_batch_ctx_t *ctx, uint32_t pos, const void *src, uint32_t len)
+{
+    uint32_t offset = pos & rx_ring_mask(ctx);
+    uint32_t first = ctx->config.rx_ring_size - offset;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(ctx->rx_ring + offset, src, first);
+    memcpy(ctx->rx_ring, (const uint8_t *)src + first, len - first);
+}
+
+static void rx_ring_read(esp_now_batch_ctx_t *ctx, uint32_t pos, void *dst, uint32_t len)
+{
+    uint32_t offset = pos & rx_ring_mask(ctx);
+    uint32_t first = ctx->config.rx_ring_size - offset;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(dst, ctx->rx_ring + offset, first);
+    memcpy((uint8_t *)dst + first, ctx->rx_ring, len - first);
+}
+
+/* Runs in the Wi-Fi task. Copies the frame into the ring and wakes the
+ * consumer; drops the frame when the ring is full rather than blocking. */
+static void esp_now_batch_recv_cb(const esp_now_recv_info_t *info, const uint8_t *data, int data_len)
+{
+    esp_now_batch_ctx_t *ctx = s_batch_ctx;
+    if (ctx == NULL || ctx->rx_ring == NULL) {
+        return;
+    }
+    uint32_t rec_len = sizeof(esp_now_batch_rx_rec_t) + data_len;
+    uint32_t used = ctx->rx_head - ctx->rx_tail;
+    if (rec_len > ctx->config.rx_ring_size - used) {
+        ctx->rx_dropped++;
+        return;
+    }
+    esp_now_batch_rx_rec_t rec = {
+        .rssi = info->rx_ctrl ? info->rx_ctrl->rssi : 0,
+        .data_len = data_len,
+    };
+    memcpy(rec.src_addr, info->src_addr, ESP_NOW_ETH_ALEN);
+    rx_ring_write(ctx, ctx->rx_head, &rec, sizeof(rec));
+    rx_ring_write(ctx, ctx->rx_head + sizeof(rec), data, data_len);
+    ctx->rx_head += rec_len;
+    xSemaphoreGive(ctx->rx_sem);
+}
+
+/* Runs in the Wi-Fi task, once per frame. The sender task keeps at most one
+ * frame in flight, so a plain status field plus a task notification suffices. */
+static void esp_now_batch_send_cb(const esp_now_send_info_t *tx_info, esp_now_send_status_t status)
+{
+    esp_now_batch_ctx_t *ctx = s_batch_ctx;
+    if (ctx == NULL || ctx->task_handle == NULL) {
+        return;
+    }
+    ctx->send_status = status;
+    xTaskNotifyGive(ctx->task_handle);
+}
+
+static esp_now_batch_peer_rate_t *peer_rate_find(esp_now_batch_ctx_t *ctx, const uint8_t *peer_addr, bool allocate)
+{
+    esp_now_batch_peer_rate_t *free_slot = NULL;
+    for (int i = 0; i < ESP_NOW_BATCH_PEER_RATE_NUM; i++) {
+        esp_now_batch_peer_rate_t *slot = &ctx->peer_rates[i];
+        if (slot->in_use && memcmp(slot->peer_addr, peer_addr, ESP_NOW_ETH_ALEN) == 0) {
+            return slot;
+        }
+        if (!slot->in_use && free_slot == NULL) {
+            free_slot = slot;
+        }
+    }
+    if (!allocate || free_slot == NULL) {
+        return NULL;
+    }
+    memcpy(free_slot->peer_addr, peer_addr, ESP_NOW_ETH_ALEN);
+    free_slot->interval_us = ctx->config.default_rate_fps ?
+                             1000000 / ctx->config.default_rate_fps : 0;
+    free_slot->next_send_us = 0;
+    free_slot->in_use = true;
+    return free_slot;
+}
+
+/* Delay until the peer's rate limiter admits the next frame and stamp the
+ * admission time, so back-to-back batches to one peer stay paced. */
+static void peer_rate_admit(esp_now_batch_ctx_t *ctx, const uint8_t *peer_addr)
+{
+    portENTER_CRITICAL(&ctx->rate_lock);
+    esp_now_batch_peer_rate_t *slot = peer_rate_find(ctx, peer_addr, true);
+    uint32_t interval_us = (slot != NULL) ? slot->interval_us : 0;
+    int64_t next_us = (slot != NULL) ? slot->next_send_us : 0;
+    portEXIT_CRITICAL(&ctx->rate_lock);
+
+    if (interval_us == 0) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    if (next_us > now) {
+        vTaskDelay(pdMS_TO_TICKS((next_us - now) / 1000) + 1);
+        now = esp_timer_get_time();
+    }
+    portENTER_CRITICAL(&ctx->rate_lock);
+    if (slot->in_use) {
+        slot->next_send_us = now + interval_us;
+    }
+    portEXIT_CRITICAL(&ctx->rate_lock);
+}
+
+static void esp_now_batch_task(void *arg)
+{
+    esp_now_batch_ctx_t *ctx = (esp_now_batch_ctx_t *)arg;
+    esp_now_batch_job_t job;
+
+    while (ctx->run) {
+        if (xQueueReceive(ctx->job_queue, &job, pdMS_TO_TICKS(100)) != pdTRUE) {
+            continue;
+        }
+        esp_now_batch_result_t result = {
+            .batch_id = job.batch_id,
+            .total_num = job.frames_num,
+        };
+        for (uint16_t i = 0; i < job.frames_num; i++) {
+            const esp_now_batch_frame_t *frame = &job.frames[i];
+            if (!ctx->run) {
+                result.failed_num += job.frames_num - i;
+                break;
+            }
+            peer_rate_admit(ctx, frame->peer_addr);
+            ulTaskNotifyTake(pdTRUE, 0); /* clear a stale notification */
+            if (esp_now_send(frame->peer_addr, frame->data, frame->data_len) != ESP_OK) {
+                result.failed_num++;
+                continue;
+            }
+            if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ESP_NOW_BATCH_SEND_TIMEOUT_MS)) == 0) {
+                result.failed_num++;
+            } else if (ctx->send_status == ESP_NOW_SEND_SUCCESS) {
+                result.sent_num++;
+            } else {
+                result.failed_num++;
+            }
+        }
+        if (job.cb != NULL) {
+            job.cb(&result, job.cb_arg);
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_now_batch_init(const esp_now_batch_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(config != NULL, ESP_ERR_INVALID_ARG, TAG, "config is NULL");
+    ESP_RETURN_ON_FALSE(config->queue_len > 0, ESP_ERR_INVALID_ARG, TAG, "queue_len is 0");
+    ESP_RETURN_ON_FALSE(config->rx_ring_size == 0 || (config->rx_ring_size & (config->rx_ring_size - 1)) == 0,
+                        ESP_ERR_INVALID_ARG, TAG, "rx_ring_size is not a power of two");
+    ESP_RETURN_ON_FALSE(s_batch_ctx == NULL, ESP_ERR_INVALID_STATE, TAG, "already initialized");
+
+    esp_err_t ret = ESP_OK;
+    esp_now_batch_ctx_t *ctx = heap_caps_calloc(1, sizeof(esp_now_batch_ctx_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_NO_MEM, TAG, "no mem for context");
+    ctx->config = *config;
+    portMUX_INITIALIZE(&ctx->rate_lock);
+    ctx->run = true;
+
+    ctx->job_queue = xQueueCreate(config->queue_len, sizeof(esp_now_batch_job_t));
+    ESP_GOTO_ON_FALSE(ctx->job_queue != NULL, ESP_ERR_NO_MEM, fail, TAG, "no mem for job queue");
+
+    if (config->rx_ring_size > 0) {
+        ctx->rx_ring = heap_caps_malloc(config->rx_ring_size, MALLOC_CAP_DEFAULT);
+        ESP_GOTO_ON_FALSE(ctx->rx_ring != NULL, ESP_ERR_NO_MEM, fail, TAG, "no mem for rx ring");
+        ctx->rx_sem = xSemaphoreCreateCounting(UINT16_MAX, 0);
+        ESP_GOTO_ON_FALSE(ctx->rx_sem != NULL, ESP_ERR_NO_MEM, fail, TAG, "no mem for rx semaphore");
+    }
+
+    if (xTaskCreate(esp_now_batch_task, "espnow_batch", config->task_stack_size,
+                    ctx, config->task_prio, &ctx->task_handle) != pdTRUE) {
+        ESP_GOTO_ON_FALSE(false, ESP_ERR_NO_MEM, fail, TAG, "failed to create task");
+    }
+
+    s_batch_ctx = ctx;
+    ESP_GOTO_ON_ERROR(esp_now_register_send_cb(esp_now_batch_send_cb), fail_cb, TAG, "failed to register send cb");
+    if (ctx->rx_ring != NULL) {
+        ESP_GOTO_ON_ERROR(esp_now_register_recv_cb(esp_now_batch_recv_cb), fail_cb, TAG, "failed to register recv cb");
+    }
+    return ESP_OK;
+
+fail_cb:
+    esp_now_unregister_send_cb();
+    s_batch_ctx = NULL;
+fail:
+    ctx->run = false;
+    if (ctx->task_handle != NULL) {
+        vTaskDelete(ctx->task_handle);
+    }
+    if (ctx->rx_sem != NULL) {
+        vSemaphoreDelete(ctx->rx_sem);
+    }
+    if (ctx->rx_ring != NULL) {
+        free(ctx->rx_ring);
+    }
+    if (ctx->job_queue != NULL) {
+        vQueueDelete(ctx->job_queue);
+    }
+    free(ctx);
+    return ret;
+}
+
+esp_err_t esp_now_batch_deinit(void)
+{
+    esp_now_batch_ctx_t *ctx = s_batch_ctx;
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_INVALID_STATE, TAG, "not initialized");
+
+    esp_now_unregister_send_cb();
+    esp_now_unregister_recv_cb();
+    s_batch_ctx = NULL;
+
+    /* Fail out the queued batches, then let the task exit on its own. */
+    esp_now_batch_job_t job;
+    while (xQueueReceive(ctx->job_queue, &job, 0) == pdTRUE) {
+        if (job.cb != NULL) {
+            esp_now_batch_result_t result = {
+                .batch_id = job.batch_id,
+                .total_num = job.frames_num,
+                .failed_num = job.frames_num,
+            };
+            job.cb(&result, job.cb_arg);
+        }
+    }
+    ctx->run = false;
+    xTaskNotifyGive(ctx->task_handle);
+    vTaskDelay(pdMS_TO_TICKS(10));
+
+    vQueueDelete(ctx->job_queue);
+    if (ctx->rx_sem != NULL) {
+        vSemaphoreDelete(ctx->rx_sem);
+    }
+    if (ctx->rx_ring != NULL) {
+        free(ctx->rx_ring);
+    }
+    free(ctx);
+    return ESP_OK;
+}
+
+esp_err_t esp_now_batch_send(const esp_now_batch_frame_t *frames, uint16_t frames_num,
+                             esp_now_batch_send_cb_t cb, void *cb_arg, uint32_t *batch_id)
+{
+    esp_now_batch_ctx_t *ctx = s_batch_ctx;
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_INVALID_STATE, TAG, "not initialized");
+    ESP_RETURN_ON_FALSE(frames != NULL && frames_num > 0, ESP_ERR_INVALID_ARG, TAG, "no frames");
+    for (uint16_t i = 0; i < frames_num; i++) {
+        ESP_RETURN_ON_FALSE(frames[i].peer_addr != NULL && frames[i].data != NULL &&
+                            frames[i].data_len > 0 && frames[i].data_len <= ESP_NOW_MAX_DATA_LEN_V2,
+                            ESP_ERR_INVALID_ARG, TAG, "invalid frame %d", i);
+    }
+
+    esp_now_batch_job_t job = {
+        .frames = frames,
+        .frames_num = frames_num,
+        .cb = cb,
+        .cb_arg = cb_arg,
+        .batch_id = ++ctx->next_batch_id,
+    };
+    ESP_RETURN_ON_FALSE(xQueueSend(ctx->job_queue, &job, 0) == pdTRUE,
+                        ESP_ERR_NO_MEM, TAG, "batch queue is full");
+    if (batch_id != NULL) {
+        *batch_id = job.batch_id;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_now_batch_set_peer_rate(const uint8_t *peer_addr, uint16_t max_frames_per_sec)
+{
+    esp_now_batch_ctx_t *ctx = s_batch_ctx;
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_INVALID_STATE, TAG, "not initialized");
+    ESP_RETURN_ON_FALSE(peer_addr != NULL, ESP_ERR_INVALID_ARG, TAG, "peer_addr is NULL");
+
+    portENTER_CRITICAL(&ctx->rate_lock);
+    esp_now_batch_peer_rate_t *slot = peer_rate_find(ctx, peer_addr, true);
+    if (slot != NULL) {
+        slot->interval_us = max_frames_per_sec ? 1000000 / max_frames_per_sec : 0;
+    }
+    portEXIT_CRITICAL(&ctx->rate_lock);
+    return (slot != NULL) ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+esp_err_t esp_now_batch_recv(esp_now_batch_recv_meta_t *meta, uint8_t *data, uint16_t *data_len,
+                             TickType_t wait)
+{
+    esp_now_batch_ctx_t *ctx = s_batch_ctx;
+    ESP_RETURN_ON_FALSE(ctx != NULL && ctx->rx_ring != NULL, ESP_ERR_INVALID_STATE, TAG, "rx ring not available");
+    ESP_RETURN_ON_FALSE(meta != NULL && data != NULL && data_len != NULL, ESP_ERR_INVALID_ARG, TAG, "invalid args");
+
+    if (xSemaphoreTake(ctx->rx_sem, wait) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    esp_now_batch_rx_rec_t rec;
+    rx_ring_read(ctx, ctx->rx_tail, &rec, sizeof(rec));
+    uint16_t copy_len = (rec.data_len < *data_len) ? rec.data_len : *data_len;
+    rx_ring_read(ctx, ctx->rx_tail + sizeof(rec), data, copy_len);
+    ctx->rx_tail += sizeof(rec) + rec.data_len;
+
+    memcpy(meta->src_addr, rec.src_addr, ESP_NOW_ETH_ALEN);
+    meta->rssi = rec.rssi;
+    meta->data_len = rec.data_len;
+    *data_len = copy_len;
+    return ESP_OK;
+}
+
+uint32_t esp_now_batch_rx_dropped_count(void)
+{
+    esp_now_batch_ctx_t *ctx = s_batch_ctx;
+    return (ctx != NULL) ? ctx->rx_dropped : 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_event_base.h"
+#include "esp_wifi_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Incremental scan event base declaration */
+ESP_EVENT_DECLARE_BASE(WIFI_INC_SCAN_EVENT);
+
+/** Incremental scan events */
+typedef enum {
+    WIFI_INC_SCAN_EVENT_AP_FOUND,     /*!< An AP was found, event data is a wifi_ap_record_t */
+    WIFI_INC_SCAN_EVENT_CHANNEL_DONE, /*!< One channel finished, event data is a wifi_inc_scan_channel_done_t */
+    WIFI_INC_SCAN_EVENT_DONE,         /*!< The whole scan sequence finished, event data is a wifi_inc_scan_done_t */
+} wifi_inc_scan_event_t;
+
+/** Event data of WIFI_INC_SCAN_EVENT_CHANNEL_DONE */
+typedef struct {
+    uint8_t channel;          /*!< Channel that was scanned */
+    uint16_t aps_found;       /*!< Number of APs found on this channel */
+} wifi_inc_scan_channel_done_t;
+
+/** Event data of WIFI_INC_SCAN_EVENT_DONE */
+typedef struct {
+    uint16_t aps_found;       /*!< Total number of APs found in this sequence */
+    uint8_t channels_scanned; /*!< Number of channels that were scanned */
+} wifi_inc_scan_done_t;
+
+/** Entry of the learned AP cache */
+typedef struct {
+    uint8_t bssid[6];         /*!< BSSID of the AP */
+    uint8_t channel;          /*!< Channel the AP was last seen on */
+    int8_t rssi;              /*!< RSSI at which the AP was last seen */
+} wifi_inc_scan_known_ap_t;
+
+/** Incremental scan configuration */
+typedef struct {
+    const uint8_t *ssid;        /*!< SSID filter passed to the driver, NULL to report all APs */
+    bool show_hidden;           /*!< Report APs with hidden SSID */
+    bool use_channel_cache;     /*!< Scan only the channels where APs have been seen before.
+                                     Falls back to a full sweep while the cache is empty */
+    wifi_scan_time_t scan_time; /*!< Per-channel scan time, zero fields select the driver defaults */
+} wifi_inc_scan_config_t;
+
+/**
+ * @brief Start an incremental scan
+ *
+ * The channels are scanned one at a time, so APs are delivered through
+ * WIFI_INC_SCAN_EVENT_AP_FOUND events as soon as their channel finishes
+ * instead of after the whole sweep. Channels where APs have been found are
+ * remembered (persisted to NVS) and, with use_channel_cache set, subsequent
+ * scans visit only those channels, most frequently used first.
+ *
+ * Wi-Fi must be started. The sequence runs asynchronously; it finishes with a
+ * WIFI_INC_SCAN_EVENT_DONE event.
+ *
+ * @param config Scan configuration, or NULL to use the defaults (no SSID
+ *               filter, channel cache enabled)
+ *
+ * @return
+ *    - ESP_OK: Scan sequence started
+ *    - ESP_ERR_INVALID_STATE: A previous sequence is still running
+ *    - other: Error propagated from the Wi-Fi driver
+ */
+esp_err_t esp_wifi_inc_scan_start(const wifi_inc_scan_config_t *config);
+
+/**
+ * @brief Abort a running incremental scan
+ *
+ * No WIFI_INC_SCAN_EVENT_DONE event is posted for an aborted sequence.
+ *
+ * @return
+ *    - ESP_OK: Scan sequence aborted
+ *    - ESP_ERR_INVALID_STATE: No sequence is running
+ */
+esp_err_t esp_wifi_inc_scan_stop(void);
+
+/**
+ * @brief Get the learned channel mask
+ *
+ * @param[out] mask Bit n set means APs have been seen on channel n+1
+ *
+ * @return
+ *    - ESP_OK: On success
+ *    - ESP_ERR_INVALID_ARG: mask is NULL
+ */
+esp_err_t esp_wifi_inc_scan_get_channel_mask(uint16_t *mask);
+
+/**
+ * @brief Get the learned AP cache
+ *
+ * @param[out] aps Array to copy the entries into
+ * @param[in,out] num In: capacity of the array, out: number of entries copied
+ *
+ * @return
+ *    - ESP_OK: On success
+ *    - ESP_ERR_INVALID_ARG: aps or num is NULL
+ */
+esp_err_t esp_wifi_inc_scan_get_known_aps(wifi_inc_scan_known_ap_t *aps, uint16_t *num);
+
+/**
+ * @brief Drop the learned channel/AP cache, both in RAM and in NVS
+ *
+ * @return
+ *    - ESP_OK: On success
+ */
+esp_err_t esp_wifi_inc_scan_clear_cache(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,347 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_bit_defs.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_event.h"
+#include "esp_wifi.h"
+#include "nvs.h"
+
+#include "esp_inc_scan.h"
+
+#define INC_SCAN_MAX_CHANNEL    14
+#define INC_SCAN_KNOWN_AP_NUM   8
+
+#define INC_SCAN_NVS_NAMESPACE  "inc_scan"
+#define INC_SCAN_NVS_KEY        "cache"
+
+static const char *TAG = "inc_scan";
+
+ESP_EVENT_DEFINE_BASE(WIFI_INC_SCAN_EVENT);
+
+/* Learned channel/AP cache, persisted to NVS as one blob */
+typedef struct {
+    uint8_t chan_hits[INC_SCAN_MAX_CHANNEL];         /* per-channel AP sightings, saturating */
+    wifi_inc_scan_known_ap_t aps[INC_SCAN_KNOWN_AP_NUM];
+    uint8_t ap_num;
+} inc_scan_cache_t;
+
+typedef struct {
+    SemaphoreHandle_t lock;
+    esp_event_handler_instance_t scan_done_handler;
+    bool running;
+    bool cache_loaded;
+    bool cache_dirty;
+    inc_scan_cache_t cache;
+    /* current sequence */
+    uint8_t ssid[33];
+    bool has_ssid;
+    bool show_hidden;
+    wifi_scan_time_t scan_time;
+    uint8_t channels[INC_SCAN_MAX_CHANNEL];
+    uint8_t channel_num;
+    uint8_t channel_idx;
+    uint16_t total_aps;
+} inc_scan_t;
+
+static inc_scan_t s_inc_scan;
+
+static void inc_scan_cache_load(void)
+{
+    nvs_handle_t nvs;
+
+    if (s_inc_scan.cache_loaded) {
+        return;
+    }
+    s_inc_scan.cache_loaded = true;
+    if (nvs_open(INC_SCAN_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return;
+    }
+    size_t len = sizeof(s_inc_scan.cache);
+    if (nvs_get_blob(nvs, INC_SCAN_NVS_KEY, &s_inc_scan.cache, &len) != ESP_OK ||
+            len != sizeof(s_inc_scan.cache)) {
+        memset(&s_inc_scan.cache, 0, sizeof(s_inc_scan.cache));
+    }
+    nvs_close(nvs);
+}
+
+static void inc_scan_cache_persist(void)
+{
+    nvs_handle_t nvs;
+
+    if (!s_inc_scan.cache_dirty) {
+        return;
+    }
+    if (nvs_open(INC_SCAN_NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+        ESP_LOGW(TAG, "failed to open NVS, channel cache not persisted");
+        return;
+    }
+    if (nvs_set_blob(nvs, INC_SCAN_NVS_KEY, &s_inc_scan.cache, sizeof(s_inc_scan.cache)) == ESP_OK) {
+        nvs_commit(nvs);
+        s_inc_scan.cache_dirty = false;
+    }
+    nvs_close(nvs);
+}
+
+static void inc_scan_cache_learn(const wifi_ap_record_t *record)
+{
+    inc_scan_cache_t *cache = &s_inc_scan.cache;
+
+    if (record->primary < 1 || record->primary > INC_SCAN_MAX_CHANNEL) {
+        return;
+    }
+    if (cache->chan_hits[record->primary - 1] < UINT8_MAX) {
+        cache->chan_hits[record->primary - 1]++;
+        s_inc_scan.cache_dirty = true;
+    }
+    /* Update the AP entry in place, else take a free slot, else replace the
+     * weakest entry if this one is stronger */
+    wifi_inc_scan_known_ap_t *slot = NULL;
+    for (int i = 0; i < cache->ap_num; i++) {
+        if (memcmp(cache->aps[i].bssid, record->bssid, sizeof(record->bssid)) == 0) {
+            slot = &cache->aps[i];
+            break;
+        }
+    }
+    if (slot == NULL && cache->ap_num < INC_SCAN_KNOWN_AP_NUM) {
+        slot = &cache->aps[cache->ap_num++];
+    }
+    if (slot == NULL) {
+        slot = &cache->aps[0];
+        for (int i = 1; i < cache->ap_num; i++) {
+            if (cache->aps[i].rssi < slot->rssi) {
+                slot = &cache->aps[i];
+            }
+        }
+        if (slot->rssi >= record->rssi) {
+            return;
+        }
+    }
+    memcpy(slot->bssid, record->bssid, sizeof(slot->bssid));
+    slot->channel = record->primary;
+    slot->rssi = record->rssi;
+    s_inc_scan.cache_dirty = true;
+}
+
+static esp_err_t inc_scan_start_channel(void)
+{
+    wifi_scan_config_t config = {
+        .ssid = s_inc_scan.has_ssid ? s_inc_scan.ssid : NULL,
+        .channel = s_inc_scan.channels[s_inc_scan.channel_idx],
+        .show_hidden = s_inc_scan.show_hidden,
+        .scan_time = s_inc_scan.scan_time,
+    };
+    return esp_wifi_scan_start(&config, false);
+}
+
+static void inc_scan_finish(bool post_done)
+{
+    wifi_inc_scan_done_t done = {
+        .aps_found = s_inc_scan.total_aps,
+        .channels_scanned = s_inc_scan.channel_idx,
+    };
+
+    inc_scan_cache_persist();
+    if (s_inc_scan.scan_done_handler != NULL) {
+        esp_event_handler_instance_unregister(WIFI_EVENT, WIFI_EVENT_SCAN_DONE,
+                                              s_inc_scan.scan_done_handler);
+        s_inc_scan.scan_done_handler = NULL;
+    }
+    s_inc_scan.running = false;
+    if (post_done) {
+        esp_event_post(WIFI_INC_SCAN_EVENT, WIFI_INC_SCAN_EVENT_DONE,
+                       &done, sizeof(done), portMAX_DELAY);
+    }
+}
+
+static void inc_scan_done_handler(void *arg, esp_event_base_t event_base,
+                                  int32_t event_id, void *event_data)
+{
+    uint16_t ap_num = 0;
+    wifi_ap_record_t *records = NULL;
+
+    xSemaphoreTake(s_inc_scan.lock, portMAX_DELAY);
+    if (!s_inc_scan.running) {
+        goto out;
+    }
+
+    esp_wifi_scan_get_ap_num(&ap_num);
+    if (ap_num > 0) {
+        records = calloc(ap_num, sizeof(wifi_ap_record_t));
+        if (records != NULL && esp_wifi_scan_get_ap_records(&ap_num, records) == ESP_OK) {
+            for (int i = 0; i < ap_num; i++) {
+                inc_scan_cache_learn(&records[i]);
+                esp_event_post(WIFI_INC_SCAN_EVENT, WIFI_INC_SCAN_EVENT_AP_FOUND,
+                               &records[i], sizeof(records[i]), portMAX_DELAY);
+            }
+        } else {
+            ap_num = 0;
+            /* drop the unread records held by the driver */
+            esp_wifi_clear_ap_list();
+        }
+        free(records);
+    }
+    s_inc_scan.total_aps += ap_num;
+
+    wifi_inc_scan_channel_done_t channel_done = {
+        .channel = s_inc_scan.channels[s_inc_scan.channel_idx],
+        .aps_found = ap_num,
+    };
+    esp_event_post(WIFI_INC_SCAN_EVENT, WIFI_INC_SCAN_EVENT_CHANNEL_DONE,
+                   &channel_done, sizeof(channel_done), portMAX_DELAY);
+
+    s_inc_scan.channel_idx++;
+    if (s_inc_scan.channel_idx < s_inc_scan.channel_num) {
+        esp_err_t err = inc_scan_start_channel();
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "failed to scan channel %d (0x%x), finishing early",
+                     s_inc_scan.channels[s_inc_scan.channel_idx], err);
+            inc_scan_finish(true);
+        }
+    } else {
+        inc_scan_finish(true);
+    }
+out:
+    xSemaphoreGive(s_inc_scan.lock);
+}
+
+/* Build the channel list for one sequence: learned channels ordered by hit
+ * count when requested and available, the country's channel range otherwise */
+static void inc_scan_build_channel_list(bool use_channel_cache)
+{
+    s_inc_scan.channel_num = 0;
+    s_inc_scan.channel_idx = 0;
+
+    if (use_channel_cache) {
+        uint8_t hits[INC_SCAN_MAX_CHANNEL];
+        memcpy(hits, s_inc_scan.cache.chan_hits, sizeof(hits));
+        while (s_inc_scan.channel_num < INC_SCAN_MAX_CHANNEL) {
+            int best = -1;
+            for (int i = 0; i < INC_SCAN_MAX_CHANNEL; i++) {
+                if (hits[i] > 0 && (best < 0 || hits[i] > hits[best])) {
+                    best = i;
+                }
+            }
+            if (best < 0) {
+                break;
+            }
+            hits[best] = 0;
+            s_inc_scan.channels[s_inc_scan.channel_num++] = best + 1;
+        }
+        if (s_inc_scan.channel_num > 0) {
+            return;
+        }
+    }
+
+    wifi_country_t country = { .schan = 1, .nchan = 13 };
+    esp_wifi_get_country(&country);
+    for (int i = 0; i < country.nchan && s_inc_scan.channel_num < INC_SCAN_MAX_CHANNEL; i++) {
+        s_inc_scan.channels[s_inc_scan.channel_num++] = country.schan + i;
+    }
+}
+
+esp_err_t esp_wifi_inc_scan_start(const wifi_inc_scan_config_t *config)
+{
+    esp_err_t ret = ESP_OK;
+    wifi_inc_scan_config_t default_config = {
+        .use_channel_cache = true,
+    };
+
+    if (config == NULL) {
+        config = &default_config;
+    }
+    if (s_inc_scan.lock == NULL) {
+        SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+        ESP_RETURN_ON_FALSE(lock != NULL, ESP_ERR_NO_MEM, TAG, "no mem for lock");
+        /* the first call may race only with itself, the API is not expected
+         * to be entered concurrently before the first start */
+        s_inc_scan.lock = lock;
+    }
+
+    xSemaphoreTake(s_inc_scan.lock, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(!s_inc_scan.running, ESP_ERR_INVALID_STATE, out, TAG, "scan sequence already running");
+
+    inc_scan_cache_load();
+
+    s_inc_scan.has_ssid = (config->ssid != NULL);
+    if (s_inc_scan.has_ssid) {
+        strlcpy((char *)s_inc_scan.ssid, (const char *)config->ssid, sizeof(s_inc_scan.ssid));
+    }
+    s_inc_scan.show_hidden = config->show_hidden;
+    s_inc_scan.scan_time = config->scan_time;
+    s_inc_scan.total_aps = 0;
+    inc_scan_build_channel_list(config->use_channel_cache);
+
+    ESP_GOTO_ON_ERROR(esp_event_handler_instance_register(WIFI_EVENT, WIFI_EVENT_SCAN_DONE,
+                                                          inc_scan_done_handler, NULL,
+                                                          &s_inc_scan.scan_done_handler),
+                      out, TAG, "failed to register scan done handler");
+    s_inc_scan.running = true;
+    ret = inc_scan_start_channel();
+    if (ret != ESP_OK) {
+        inc_scan_finish(false);
+    }
+out:
+    xSemaphoreGive(s_inc_scan.lock);
+    return ret;
+}
+
+esp_err_t esp_wifi_inc_scan_stop(void)
+{
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(s_inc_scan.lock != NULL, ESP_ERR_INVALID_STATE, TAG, "no scan sequence running");
+    xSemaphoreTake(s_inc_scan.lock, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(s_inc_scan.running, ESP_ERR_INVALID_STATE, out, TAG, "no scan sequence running");
+    esp_wifi_scan_stop();
+    inc_scan_finish(false);
+out:
+    xSemaphoreGive(s_inc_scan.lock);
+    return ret;
+}
+
+esp_err_t esp_wifi_inc_scan_get_channel_mask(uint16_t *mask)
+{
+    ESP_RETURN_ON_FALSE(mask != NULL, ESP_ERR_INVALID_ARG, TAG, "mask can't be NULL");
+    inc_scan_cache_load();
+    *mask = 0;
+    for (int i = 0; i < INC_SCAN_MAX_CHANNEL; i++) {
+        if (s_inc_scan.cache.chan_hits[i] > 0) {
+            *mask |= BIT(i);
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_inc_scan_get_known_aps(wifi_inc_scan_known_ap_t *aps, uint16_t *num)
+{
+    ESP_RETURN_ON_FALSE(aps != NULL && num != NULL, ESP_ERR_INVALID_ARG, TAG, "aps and num can't be NULL");
+    inc_scan_cache_load();
+    uint16_t copy_num = s_inc_scan.cache.ap_num < *num ? s_inc_scan.cache.ap_num : *num;
+    memcpy(aps, s_inc_scan.cache.aps, copy_num * sizeof(aps[0]));
+    *num = copy_num;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_inc_scan_clear_cache(void)
+{
+    nvs_handle_t nvs;
+
+    memset(&s_inc_scan.cache, 0, sizeof(s_inc_scan.cache));
+    s_inc_scan.cache_loaded = true;
+    s_inc_scan.cache_dirty = false;
+    if (nvs_open(INC_SCAN_NVS_NAMESPACE, NVS_READWRITE, &nvs) == ESP_OK) {
+        nvs_erase_key(nvs, INC_SCAN_NVS_KEY);
+        nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_mesh.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Root-side uplink aggregation. A dedicated task drains esp_mesh_recv_toDS()
+ * and coalesces consecutive payloads heading to the same DS address into one
+ * contiguous buffer taken from a pool allocated once at init, so the uplink
+ * socket sees one large write instead of one write per mesh packet. A buffer
+ * is handed to the flush callback when it fills up, when its oldest payload
+ * has waited for the configured maximum latency, or when all pool buffers are
+ * occupied and a new destination appears.
+ */
+
+/**
+ * @brief Configuration of the mesh uplink aggregator
+ */
+typedef struct {
+    uint16_t agg_buf_size;    /**< Size of one aggregation buffer in bytes, at least MESH_MPS */
+    uint8_t agg_buf_num;      /**< Number of aggregation buffers (concurrent DS destinations) */
+    uint16_t max_latency_ms;  /**< Longest time a payload may wait in a buffer before flush */
+    uint32_t task_stack_size; /**< Stack size of the aggregator task */
+    uint32_t task_prio;       /**< Priority of the aggregator task */
+} esp_mesh_uplink_config_t;
+
+#define ESP_MESH_UPLINK_CONFIG_DEFAULT() { \
+    .agg_buf_size = 2 * MESH_MPS,          \
+    .agg_buf_num = 4,                      \
+    .max_latency_ms = 20,                  \
+    .task_stack_size = 3584,               \
+    .task_prio = 5,                        \
+}
+
+/**
+ * @brief Statistics of the mesh uplink aggregator
+ */
+typedef struct {
+    uint32_t packets_in;       /**< Mesh packets drained from the toDS queue */
+    uint64_t bytes_in;         /**< Payload bytes drained from the toDS queue */
+    uint32_t flushes;          /**< Flush callback invocations */
+    uint32_t flushes_full;     /**< Flushes because the buffer could not fit the next payload */
+    uint32_t flushes_timer;    /**< Flushes because the maximum latency expired */
+    uint32_t flushes_evict;    /**< Flushes to free a buffer for a new DS destination */
+    uint32_t flush_errors;     /**< Flush callbacks that returned an error (data dropped) */
+} esp_mesh_uplink_stats_t;
+
+/**
+ * @brief Callback delivering one aggregated uplink buffer
+ *
+ * Runs in the context of the aggregator task; the buffer is reused as soon as
+ * the callback returns, so the callback must finish the write (e.g. a blocking
+ * send() on the uplink socket) before returning. All coalesced payloads share
+ * the same DS address and protocol; pkt_num tells how many were coalesced.
+ *
+ * @return ESP_OK if the data was written; any other value counts as a flush
+ *         error and the data is dropped
+ */
+typedef esp_err_t (*esp_mesh_uplink_flush_cb_t)(const mesh_addr_t *ds_addr, mesh_proto_t proto,
+                                                const uint8_t *data, uint16_t len,
+                                                uint16_t pkt_num, void *arg);
+
+/**
+ * @brief Start the mesh uplink aggregator
+ *
+ * Must be called on the root node; the aggregator owns esp_mesh_recv_toDS()
+ * from this point on, so the application must not call it directly.
+ *
+ * @param config  Aggregator configuration
+ * @param cb      Flush callback writing an aggregated buffer to the uplink
+ * @param cb_arg  Argument passed to the flush callback
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG on invalid configuration or NULL callback
+ *      - ESP_ERR_INVALID_STATE if already started
+ *      - ESP_ERR_NO_MEM on allocation failure
+ */
+esp_err_t esp_mesh_uplink_start(const esp_mesh_uplink_config_t *config,
+                                esp_mesh_uplink_flush_cb_t cb, void *cb_arg);
+
+/**
+ * @brief Stop the mesh uplink aggregator and release its buffers
+ *
+ * Buffers still holding data are flushed before the task exits.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if not started
+ */
+esp_err_t esp_mesh_uplink_stop(void);
+
+/**
+ * @brief Get the statistics of the mesh uplink aggregator
+ *
+ * @param[out] out_stats Statistics destination
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if out_stats is NULL
+ *      - ESP_ERR_INVALID_STATE if not started
+ */
+esp_err_t esp_mesh_uplink_get_stats(esp_mesh_uplink_stats_t *out_stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,267 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_mesh_uplink.h"
+
+static const char *TAG = "mesh_uplink";
+
+#define UPLINK_IDLE_TIMEOUT_MS 500
+
+typedef struct {
+    bool in_use;
+    mesh_addr_t ds_addr;
+    mesh_proto_t proto;
+    uint8_t *buf;
+    uint16_t used;
+    uint16_t pkt_num;
+    int64_t deadline_us; /* when the oldest payload in the buffer must be flushed */
+} agg_slot_t;
+
+typedef struct {
+    esp_mesh_uplink_config_t config;
+    esp_mesh_uplink_flush_cb_t cb;
+    void *cb_arg;
+    agg_slot_t *slots;
+    uint8_t *slot_mem;   /* one block backing all aggregation buffers */
+    uint8_t *rx_buf;     /* scratch buffer esp_mesh_recv_toDS() copies into */
+    TaskHandle_t task;
+    SemaphoreHandle_t stopped;
+    volatile bool running;
+    esp_mesh_uplink_stats_t stats;
+} uplink_ctx_t;
+
+static uplink_ctx_t *s_ctx;
+static portMUX_TYPE s_uplink_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static void slot_flush(uplink_ctx_t *ctx, agg_slot_t *slot, uint32_t *reason_counter)
+{
+    if (!slot->in_use || slot->used == 0) {
+        slot->in_use = false;
+        return;
+    }
+    esp_err_t err = ctx->cb(&slot->ds_addr, slot->proto, slot->buf, slot->used,
+                            slot->pkt_num, ctx->cb_arg);
+    portENTER_CRITICAL(&s_uplink_mux);
+    ctx->stats.flushes++;
+    if (reason_counter != NULL) {
+        (*reason_counter)++;
+    }
+    if (err != ESP_OK) {
+        ctx->stats.flush_errors++;
+    }
+    portEXIT_CRITICAL(&s_uplink_mux);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "flush of %u bytes dropped (0x%x)", slot->used, err);
+    }
+    slot->in_use = false;
+    slot->used = 0;
+    slot->pkt_num = 0;
+}
+
+/* Returns the slot for this destination/protocol, evicting the slot with the
+ * nearest deadline when the pool is exhausted. */
+static agg_slot_t *slot_acquire(uplink_ctx_t *ctx, const mesh_addr_t *ds_addr, mesh_proto_t proto)
+{
+    agg_slot_t *free_slot = NULL;
+    agg_slot_t *oldest = NULL;
+    for (int i = 0; i < ctx->config.agg_buf_num; i++) {
+        agg_slot_t *slot = &ctx->slots[i];
+        if (!slot->in_use) {
+            if (free_slot == NULL) {
+                free_slot = slot;
+            }
+            continue;
+        }
+        if (slot->proto == proto &&
+                memcmp(&slot->ds_addr, ds_addr, sizeof(mesh_addr_t)) == 0) {
+            return slot;
+        }
+        if (oldest == NULL || slot->deadline_us < oldest->deadline_us) {
+            oldest = slot;
+        }
+    }
+    if (free_slot == NULL) {
+        slot_flush(ctx, oldest, &ctx->stats.flushes_evict);
+        free_slot = oldest;
+    }
+    free_slot->in_use = true;
+    memcpy(&free_slot->ds_addr, ds_addr, sizeof(mesh_addr_t));
+    free_slot->proto = proto;
+    free_slot->used = 0;
+    free_slot->pkt_num = 0;
+    return free_slot;
+}
+
+/* Shortest time until a pending buffer must be flushed, used as the blocking
+ * time of esp_mesh_recv_toDS() so the latency bound holds without a timer. */
+static int next_timeout_ms(uplink_ctx_t *ctx, int64_t now_us)
+{
+    int64_t nearest = INT64_MAX;
+    for (int i = 0; i < ctx->config.agg_buf_num; i++) {
+        if (ctx->slots[i].in_use && ctx->slots[i].deadline_us < nearest) {
+            nearest = ctx->slots[i].deadline_us;
+        }
+    }
+    if (nearest == INT64_MAX) {
+        return UPLINK_IDLE_TIMEOUT_MS;
+    }
+    if (nearest <= now_us) {
+        return 0;
+    }
+    return (int)((nearest - now_us + 999) / 1000);
+}
+
+static void flush_expired(uplink_ctx_t *ctx, int64_t now_us)
+{
+    for (int i = 0; i < ctx->config.agg_buf_num; i++) {
+        agg_slot_t *slot = &ctx->slots[i];
+        if (slot->in_use && slot->deadline_us <= now_us) {
+            slot_flush(ctx, slot, &ctx->stats.flushes_timer);
+        }
+    }
+}
+
+static void uplink_task(void *arg)
+{
+    uplink_ctx_t *ctx = (uplink_ctx_t *)arg;
+    mesh_addr_t from;
+    mesh_addr_t to;
+    int flag = 0;
+
+    while (ctx->running) {
+        int64_t now = esp_timer_get_time();
+        flush_expired(ctx, now);
+
+        mesh_data_t data = {
+            .data = ctx->rx_buf,
+            .size = MESH_MTU,
+        };
+        esp_err_t err = esp_mesh_recv_toDS(&from, &to, &data, next_timeout_ms(ctx, now),
+                                           &flag, NULL, 0);
+        if (err == ESP_ERR_MESH_TIMEOUT) {
+            continue;
+        }
+        if (err != ESP_OK) {
+            ESP_LOGD(TAG, "recv_toDS failed (0x%x)", err);
+            vTaskDelay(pdMS_TO_TICKS(10));
+            continue;
+        }
+
+        portENTER_CRITICAL(&s_uplink_mux);
+        ctx->stats.packets_in++;
+        ctx->stats.bytes_in += data.size;
+        portEXIT_CRITICAL(&s_uplink_mux);
+
+        agg_slot_t *slot = slot_acquire(ctx, &to, data.proto);
+        if (slot->used + data.size > ctx->config.agg_buf_size) {
+            slot_flush(ctx, slot, &ctx->stats.flushes_full);
+            slot->in_use = true;
+        }
+        if (slot->used == 0) {
+            slot->deadline_us = esp_timer_get_time() +
+                                (int64_t)ctx->config.max_latency_ms * 1000;
+        }
+        memcpy(slot->buf + slot->used, data.data, data.size);
+        slot->used += data.size;
+        slot->pkt_num++;
+    }
+
+    for (int i = 0; i < ctx->config.agg_buf_num; i++) {
+        slot_flush(ctx, &ctx->slots[i], NULL);
+    }
+    xSemaphoreGive(ctx->stopped);
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_mesh_uplink_start(const esp_mesh_uplink_config_t *config,
+                                esp_mesh_uplink_flush_cb_t cb, void *cb_arg)
+{
+    if (config == NULL || cb == NULL || config->agg_buf_num == 0 ||
+            config->agg_buf_size < MESH_MPS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uplink_ctx_t *ctx = calloc(1, sizeof(uplink_ctx_t));
+    if (ctx == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->config = *config;
+    ctx->cb = cb;
+    ctx->cb_arg = cb_arg;
+    ctx->slots = calloc(config->agg_buf_num, sizeof(agg_slot_t));
+    ctx->slot_mem = heap_caps_malloc((size_t)config->agg_buf_num * config->agg_buf_size,
+                                     MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ctx->rx_buf = heap_caps_malloc(MESH_MTU, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ctx->stopped = xSemaphoreCreateBinary();
+    if (ctx->slots == NULL || ctx->slot_mem == NULL || ctx->rx_buf == NULL ||
+            ctx->stopped == NULL) {
+        goto fail;
+    }
+    for (int i = 0; i < config->agg_buf_num; i++) {
+        ctx->slots[i].buf = ctx->slot_mem + (size_t)i * config->agg_buf_size;
+    }
+
+    ctx->running = true;
+    if (xTaskCreate(uplink_task, "mesh_uplink", config->task_stack_size, ctx,
+                    config->task_prio, &ctx->task) != pdTRUE) {
+        goto fail;
+    }
+    s_ctx = ctx;
+    return ESP_OK;
+
+fail:
+    if (ctx->stopped != NULL) {
+        vSemaphoreDelete(ctx->stopped);
+    }
+    free(ctx->rx_buf);
+    free(ctx->slot_mem);
+    free(ctx->slots);
+    free(ctx);
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t esp_mesh_uplink_stop(void)
+{
+    uplink_ctx_t *ctx = s_ctx;
+    if (ctx == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    ctx->running = false;
+    /* The task wakes up at the latest after its recv timeout expires */
+    xSemaphoreTake(ctx->stopped, portMAX_DELAY);
+    s_ctx = NULL;
+    vSemaphoreDelete(ctx->stopped);
+    free(ctx->rx_buf);
+    free(ctx->slot_mem);
+    free(ctx->slots);
+    free(ctx);
+    return ESP_OK;
+}
+
+esp_err_t esp_mesh_uplink_get_stats(esp_mesh_uplink_stats_t *out_stats)
+{
+    if (out_stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uplink_ctx_t *ctx = s_ctx;
+    if (ctx == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    portENTER_CRITICAL(&s_uplink_mux);
+    *out_stats = ctx->stats;
+    portEXIT_CRITICAL(&s_uplink_mux);
+    return ESP_OK;
+}
@@ -69,6 +69,13 @@ extern "C" {
 #define COREDUMP_VERSION_ELF                1
 
 #define COREDUMP_VERSION_ELF_SHA256         COREDUMP_VERSION_MAKE(COREDUMP_VERSION_ELF, 4) // -> 0x0104
+
+/**
+ * @brief Flag OR'ed into the minor version field of the core dump header when
+ * the ELF data following the header is deflate-compressed
+ * (see ESP_COREDUMP_FLASH_COMPRESSION).
+ */
+#define COREDUMP_VERSION_FLAG_COMPRESSED    0x80
 #define COREDUMP_CURR_TASK_MARKER           0xDEADBEEF
 #define COREDUMP_CURR_TASK_NOT_FOUND        -1
 
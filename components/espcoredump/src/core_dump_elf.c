@@ -636,7 +636,12 @@ static int elf_write_core_dump_user_data(core_dump_elf_t *self)
 
 #if CONFIG_ESP_COREDUMP_CAPTURE_DRAM
     heap_block_data_t user_data = {.self = self, .total_sz = &total_sz, .ret = 1};
-    heap_caps_walk(MALLOC_CAP_8BIT, esp_core_dump_write_heap_blocks, &user_data);
+    /* Walk internal heaps before external ones: if the dump is cut short
+     * (e.g. by a watchdog power cycle), the most diagnostic RAM has already
+     * been persisted. */
+    heap_caps_walk(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL, esp_core_dump_write_heap_blocks, &user_data);
+    ELF_CHECK_ERR((user_data.ret > 0), user_data.ret, "Heap memory write failed. Returned (%d).", user_data.ret);
+    heap_caps_walk(MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM, esp_core_dump_write_heap_blocks, &user_data);
     ELF_CHECK_ERR((user_data.ret > 0), user_data.ret, "Heap memory write failed. Returned (%d).", user_data.ret);
 #endif
 
@@ -15,6 +15,9 @@
 #include "esp_rom_crc.h"
 #include "esp_private/spi_flash_os.h"
 #include "spi_flash_mmap.h"
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+#include "miniz.h"
+#endif
 
 #define BLANK_COREDUMP_SIZE 0xFFFFFFFF
 
@@ -43,6 +46,43 @@ typedef struct _core_dump_flash_config_t {
 /* Core dump flash data. */
 static core_dump_flash_config_t s_core_flash_config;
 
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+
+/* Trailer stored in the last 16 bytes of the partition, telling readers how
+ * many bytes of the partition the compressed image actually occupies. The
+ * header cannot carry it: the compressed size is only known once the whole
+ * image has been written, and the header sector cannot be rewritten. */
+typedef struct {
+    uint32_t magic;
+    uint32_t flashed_len;
+    uint32_t reserved[2];
+} core_dump_comp_trailer_t;
+
+_Static_assert(sizeof(core_dump_comp_trailer_t) % 16 == 0, "trailer must be writable to encrypted flash");
+
+#define COREDUMP_COMP_TRAILER_MAGIC 0x70434445  /* "EDCp" */
+
+/* Few dictionary probes and greedy parsing: at panic time compression speed
+ * matters more than ratio. */
+#define COREDUMP_COMP_FLAGS (32 | TDEFL_GREEDY_PARSING_FLAG)
+
+typedef struct {
+    tdefl_compressor comp;          /* deflate state; static so the panic path does not allocate */
+    core_dump_write_data_t *wr_data;
+    uint32_t raw_remaining;         /* head of the stream written uncompressed (core dump header) */
+    uint32_t erased_until;          /* partition offset up to which sectors have been erased */
+    bool active;                    /* a dump is being written; enables on-demand erase */
+    esp_err_t err;                  /* first error seen while flushing compressed data */
+} core_dump_comp_ctx_t;
+
+static core_dump_comp_ctx_t s_comp;
+
+/* The last sector of the partition is reserved for the trailer. */
+#define COREDUMP_FLASH_USABLE_SIZE  (s_core_flash_config.partition.size - SPI_FLASH_SEC_SIZE)
+#else
+#define COREDUMP_FLASH_USABLE_SIZE  (s_core_flash_config.partition.size)
+#endif // CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+
 void esp_core_dump_print_write_start(void) __attribute__((alias("esp_core_dump_flash_print_write_start")));
 void esp_core_dump_print_write_end(void) __attribute__((alias("esp_core_dump_flash_print_write_end")));
 esp_err_t esp_core_dump_write_init(void) __attribute__((alias("esp_core_dump_flash_hw_init")));
@@ -72,6 +112,22 @@ static esp_err_t esp_core_dump_flash_custom_write(uint32_t address, const void *
 {
     esp_err_t err = ESP_OK;
 
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+    /* Sectors are erased on demand: the compressed size is not known up front,
+     * and erasing just what the image needs is where most time is saved. */
+    if (s_comp.active) {
+        const uint32_t end_off = address + length - s_core_flash_config.partition.start;
+        while (s_comp.erased_until < end_off) {
+            err = ESP_COREDUMP_FLASH_ERASE(s_core_flash_config.partition.start + s_comp.erased_until, SPI_FLASH_SEC_SIZE);
+            if (err != ESP_OK) {
+                ESP_COREDUMP_LOGE("Failed to erase flash sector (%d)!", err);
+                return err;
+            }
+            s_comp.erased_until += SPI_FLASH_SEC_SIZE;
+        }
+    }
+#endif
+
     if (esp_flash_encryption_enabled() && s_core_flash_config.partition.encrypted) {
         err = ESP_COREDUMP_FLASH_WRITE_ENCRYPTED(address, buffer, length);
     } else {
@@ -148,14 +204,14 @@ static void esp_core_dump_partition_init(void)
     }
 }
 
-static esp_err_t esp_core_dump_flash_write_data(core_dump_write_data_t* wr_data, uint8_t* data, uint32_t data_size)
+static esp_err_t esp_core_dump_flash_write_buffered(core_dump_write_data_t* wr_data, uint8_t* data, uint32_t data_size)
 {
     esp_err_t err = ESP_OK;
     uint32_t written = 0;
     uint32_t wr_sz = 0;
 
     /* Make sure that the partition is large enough to store both the cached and new data. */
-    ESP_COREDUMP_ASSERT((wr_data->off + wr_data->cached_bytes + data_size) < s_core_flash_config.partition.size);
+    ESP_COREDUMP_ASSERT((wr_data->off + wr_data->cached_bytes + data_size) < COREDUMP_FLASH_USABLE_SIZE);
 
     while (data_size > 0) {
         /* Calculate the maximum amount of bytes we can still fill the cache with. */
@@ -193,6 +249,53 @@ static esp_err_t esp_core_dump_flash_write_data(core_dump_write_data_t* wr_data,
     return ESP_OK;
 }
 
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+static mz_bool esp_core_dump_flash_comp_put_buf(const void *buf, int len, void *user)
+{
+    (void)user;
+    s_comp.err = esp_core_dump_flash_write_buffered(s_comp.wr_data, (uint8_t *)buf, len);
+    return s_comp.err == ESP_OK;
+}
+#endif
+
+static esp_err_t esp_core_dump_flash_write_data(core_dump_write_data_t* wr_data, uint8_t* data, uint32_t data_size)
+{
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+    esp_err_t err = ESP_OK;
+    s_comp.wr_data = wr_data;
+
+    /* The core dump header at the head of the stream stays uncompressed so
+     * that readers can detect the format; everything behind it is deflated. */
+    if (s_comp.raw_remaining > 0) {
+        uint32_t raw_sz = MIN(data_size, s_comp.raw_remaining);
+        if (raw_sz == sizeof(core_dump_header_t)) {
+            core_dump_header_t hdr;
+            memcpy(&hdr, data, sizeof(hdr));
+            hdr.version |= COREDUMP_VERSION_FLAG_COMPRESSED;
+            err = esp_core_dump_flash_write_buffered(wr_data, (uint8_t *)&hdr, sizeof(hdr));
+        } else {
+            err = esp_core_dump_flash_write_buffered(wr_data, data, raw_sz);
+        }
+        if (err != ESP_OK) {
+            return err;
+        }
+        s_comp.raw_remaining -= raw_sz;
+        data += raw_sz;
+        data_size -= raw_sz;
+        if (data_size == 0) {
+            return ESP_OK;
+        }
+    }
+
+    if (tdefl_compress_buffer(&s_comp.comp, data, data_size, TDEFL_NO_FLUSH) != TDEFL_STATUS_OKAY) {
+        return (s_comp.err != ESP_OK) ? s_comp.err : ESP_FAIL;
+    }
+    return ESP_OK;
+#else
+    return esp_core_dump_flash_write_buffered(wr_data, data, data_size);
+#endif
+}
+
 static esp_err_t esp_core_dump_flash_write_prepare(core_dump_write_data_t *wr_data, uint32_t *data_len)
 {
     esp_err_t err = ESP_OK;
@@ -214,7 +317,7 @@ static esp_err_t esp_core_dump_flash_write_prepare(core_dump_write_data_t *wr_da
 
     /* Now we can check whether we have enough space in our core dump partition
      * or not. */
-    if ((*data_len + padding + cs_len) > s_core_flash_config.partition.size) {
+    if ((*data_len + padding + cs_len) > COREDUMP_FLASH_USABLE_SIZE) {
         ESP_COREDUMP_LOGE("Not enough space to save core dump!");
         return ESP_ERR_NO_MEM;
     }
@@ -225,6 +328,11 @@ static esp_err_t esp_core_dump_flash_write_prepare(core_dump_write_data_t *wr_da
 
     memset(wr_data, 0, sizeof(core_dump_write_data_t));
 
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+    /* Sectors are erased on demand while the compressed stream is written,
+     * so only the compressed footprint pays the erase time. */
+    (void)sec_num;
+#else
     /* In order to erase the right amount of data in the flash, we have to
      * calculate how many SPI flash sectors will be needed by the core dump
      * file. */
@@ -240,6 +348,7 @@ static esp_err_t esp_core_dump_flash_write_prepare(core_dump_write_data_t *wr_da
     if (err != ESP_OK) {
         ESP_COREDUMP_LOGE("Failed to erase flash (%d)!", err);
     }
+#endif
 
     return err;
 }
@@ -247,6 +356,16 @@ static esp_err_t esp_core_dump_flash_write_prepare(core_dump_write_data_t *wr_da
 static esp_err_t esp_core_dump_flash_write_start(core_dump_write_data_t *wr_data)
 {
     esp_core_dump_checksum_init(&wr_data->checksum_ctx);
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+    s_comp.wr_data = wr_data;
+    s_comp.raw_remaining = sizeof(core_dump_header_t);
+    s_comp.erased_until = 0;
+    s_comp.err = ESP_OK;
+    s_comp.active = true;
+    if (tdefl_init(&s_comp.comp, esp_core_dump_flash_comp_put_buf, NULL, COREDUMP_COMP_FLAGS) != TDEFL_STATUS_OKAY) {
+        return ESP_FAIL;
+    }
+#endif
     return ESP_OK;
 }
 
@@ -256,6 +375,13 @@ static esp_err_t esp_core_dump_flash_write_end(core_dump_write_data_t *wr_data)
     core_dump_checksum_bytes checksum = NULL;
     uint32_t cs_len = 0;
 
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+    /* Push the tail of the deflate stream out of the compressor. */
+    if (tdefl_compress_buffer(&s_comp.comp, NULL, 0, TDEFL_FINISH) != TDEFL_STATUS_DONE) {
+        return (s_comp.err != ESP_OK) ? s_comp.err : ESP_FAIL;
+    }
+#endif
+
     /* Get the size, in bytes of the checksum. */
     cs_len  = esp_core_dump_checksum_size();
 
@@ -306,6 +432,28 @@ static esp_err_t esp_core_dump_flash_write_end(core_dump_write_data_t *wr_data)
     wr_data->off += cs_len;
     ESP_COREDUMP_LOGI("Write end offset 0x%x, check sum length %d", wr_data->off, cs_len);
 
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+    if (err == ESP_OK) {
+        /* Publish how much of the partition the image occupies; readers cannot
+         * derive this from the header, which carries the uncompressed length. */
+        s_comp.active = false;
+        core_dump_comp_trailer_t trailer = {
+            .magic = COREDUMP_COMP_TRAILER_MAGIC,
+            .flashed_len = wr_data->off,
+        };
+        err = ESP_COREDUMP_FLASH_ERASE(s_core_flash_config.partition.start + COREDUMP_FLASH_USABLE_SIZE, SPI_FLASH_SEC_SIZE);
+        if (err != ESP_OK) {
+            ESP_COREDUMP_LOGE("Failed to erase trailer sector (%d)!", err);
+            return err;
+        }
+        err = esp_core_dump_flash_custom_write(s_core_flash_config.partition.start + s_core_flash_config.partition.size - sizeof(trailer),
+                                               &trailer, sizeof(trailer));
+        if (err != ESP_OK) {
+            ESP_COREDUMP_LOGE("Failed to write trailer (%d)!", err);
+        }
+    }
+#endif
+
     return err;
 }
 
@@ -482,6 +630,32 @@ esp_err_t esp_core_dump_partition_and_size_get(const esp_partition_t **partition
         return ESP_ERR_INVALID_SIZE;
     }
 
+#if CONFIG_ESP_COREDUMP_FLASH_COMPRESSION
+    core_dump_header_t dump_hdr = { 0 };
+    err = esp_partition_read(core_part, 0, &dump_hdr, sizeof(dump_hdr));
+    if (err != ESP_OK) {
+        ESP_COREDUMP_LOGE("Failed to read core dump header (%d)!", err);
+        return err;
+    }
+    if (dump_hdr.version & COREDUMP_VERSION_FLAG_COMPRESSED) {
+        /* The header holds the uncompressed length; the space the image
+         * occupies on the flash is recorded in the trailer. */
+        core_dump_comp_trailer_t trailer = { 0 };
+        err = esp_partition_read(core_part, core_part->size - sizeof(trailer), &trailer, sizeof(trailer));
+        if (err != ESP_OK) {
+            ESP_COREDUMP_LOGE("Failed to read core dump trailer (%d)!", err);
+            return err;
+        }
+        if (trailer.magic != COREDUMP_COMP_TRAILER_MAGIC ||
+                trailer.flashed_len < sizeof(dump_hdr) ||
+                trailer.flashed_len > core_part->size - SPI_FLASH_SEC_SIZE) {
+            ESP_COREDUMP_LOGE("Invalid compressed core dump trailer!");
+            return ESP_ERR_INVALID_SIZE;
+        }
+        core_size = trailer.flashed_len;
+    }
+#endif
+
     /* Return the values if needed. */
     if (partition != NULL) {
         *partition = core_part;
@@ -67,6 +67,11 @@ static DRESULT ff_wl_ioctl (BYTE pdrv, BYTE cmd, void *buff)
     assert(wl_handle != WL_INVALID_HANDLE);
     switch (cmd) {
     case CTRL_SYNC:
+#if CONFIG_WL_WRITE_CACHE
+        if (unlikely(wl_flush(wl_handle) != ESP_OK)) {
+            return RES_ERROR;
+        }
+#endif // CONFIG_WL_WRITE_CACHE
         return RES_OK;
     case GET_SECTOR_COUNT:
         *((DWORD *) buff) = wl_size(wl_handle) / wl_sector_size(wl_handle);
@@ -76,6 +81,19 @@ static DRESULT ff_wl_ioctl (BYTE pdrv, BYTE cmd, void *buff)
         return RES_OK;
     case GET_BLOCK_SIZE:
         return RES_ERROR;
+#if FF_USE_TRIM && CONFIG_WL_PRE_ERASE
+    case CTRL_TRIM: {
+        // buff points to the first and the last sector of the unused range
+        const LBA_t *range = (const LBA_t *) buff;
+        size_t sector_size = wl_sector_size(wl_handle);
+        esp_err_t err = wl_trim(wl_handle, range[0] * sector_size, (range[1] - range[0] + 1) * sector_size);
+        if (unlikely(err != ESP_OK)) {
+            ESP_LOGE(TAG, "wl_trim failed (0x%x)", err);
+            return RES_ERROR;
+        }
+        return RES_OK;
+    }
+#endif // FF_USE_TRIM && CONFIG_WL_PRE_ERASE
     }
     return RES_ERROR;
 }
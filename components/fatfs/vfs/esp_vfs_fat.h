@@ -24,6 +24,17 @@ typedef enum {
 
 typedef PARTITION esp_vfs_fat_pdrv_part_t;
 
+/**
+ * @brief Extra open() flag requesting a fast-seek cluster map for the file
+ *
+ * Only meaningful when FATFS_FAST_SEEK_ON_FLAG is enabled: pass it together
+ * with the regular O_* flags of a read-only open() to have the VFS build the
+ * cluster link map table (CLMT) for this file. Without the option enabled,
+ * cluster maps are built for every read-only file and this flag is ignored.
+ * The bit is outside the range used by the newlib O_* flags.
+ */
+#define ESP_FATFS_FASTSEEK  (1 << 30)
+
 /**
  * @note When the value of item is less than or equal to 100, it specifies the partition size in percentage of the entire drive space.
  *       When it is larger than 100, it specifies number of sectors. The partition map table is terminated by a zero,
@@ -13,6 +13,8 @@
 #include <sys/errno.h>
 #include <sys/fcntl.h>
 #include <sys/lock.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
 #include "esp_vfs_fat.h"
 #include "vfs_fat_internal.h"
 #include "esp_vfs.h"
@@ -23,6 +25,10 @@
 
 #define F_WRITE_MALLOC_ZEROING_BUF_SIZE_LIMIT 512
 
+#if CONFIG_FATFS_USE_MMAP
+#define MMAP_OFF_NONE UINT32_MAX    /* file descriptor cannot be served from the flash mapping */
+#endif
+
 #ifdef CONFIG_VFS_SUPPORT_DIR
 struct cached_data{
 #if FF_USE_LFN
@@ -47,9 +53,23 @@ typedef struct {
     char tmp_path_buf[FILENAME_MAX+3];  /* temporary buffer used to prepend drive name to the path */
     char tmp_path_buf2[FILENAME_MAX+3]; /* as above; used in functions which take two path arguments */
     uint32_t *flags; /* file descriptor flags, array of max_files size */
+#ifdef CONFIG_FATFS_USE_FASTSEEK
+    uint32_t fastseek_counter; /* monotonic stamp source for LRU eviction of cluster maps */
+    uint32_t *fastseek_stamp; /* per-fd stamp of the last fast seek; 0 if the fd holds no cluster map; array of max_files size */
+#endif
+#if CONFIG_FATFS_USE_MMAP
+    const uint8_t* mmap_base;   /* partition contents in the data address space; NULL if mapping not enabled */
+    esp_partition_mmap_handle_t mmap_handle;
+    uint32_t* mmap_off; /* per-fd partition offset of the file start; MMAP_OFF_NONE if not servable from the mapping */
+#endif
 #ifdef CONFIG_VFS_SUPPORT_DIR
     char dir_path[FILENAME_MAX]; /* variable to store path of opened directory*/
     struct cached_data cached_fileinfo;
+#if CONFIG_FATFS_PATH_CACHE
+    struct cached_data *path_cache; /* LRU of resolved path lookups, CONFIG_FATFS_PATH_CACHE_SIZE entries */
+    uint32_t *path_cache_stamp; /* LRU stamps of the path cache entries; 0 marks an empty slot */
+    uint32_t path_cache_counter; /* monotonic stamp source for path cache LRU eviction */
+#endif
 #endif
     FIL files[];   /* array with max_files entries; must be the final member of the structure */
 } vfs_fat_ctx_t;
@@ -83,11 +103,21 @@ typedef union {
 
 static const char* TAG = "vfs_fat";
 
+#if CONFIG_FATFS_PATH_CACHE
+/* Path lookup cache helpers; all of them must be called with fat_ctx->lock
+ * held and take the path as passed to the VFS, without the drive prefix */
+static const FILINFO* fat_path_cache_lookup(vfs_fat_ctx_t* fat_ctx, const char* path);
+static void fat_path_cache_store(vfs_fat_ctx_t* fat_ctx, const char* path, const FILINFO* info);
+static void fat_path_cache_invalidate(vfs_fat_ctx_t* fat_ctx, const char* path);
+#endif
+
 static ssize_t vfs_fat_write(void* p, int fd, const void * data, size_t size);
 static off_t vfs_fat_lseek(void* p, int fd, off_t size, int mode);
 static ssize_t vfs_fat_read(void* ctx, int fd, void * dst, size_t size);
 static ssize_t vfs_fat_pread(void *ctx, int fd, void *dst, size_t size, off_t offset);
 static ssize_t vfs_fat_pwrite(void *ctx, int fd, const void *src, size_t size, off_t offset);
+static ssize_t vfs_fat_writev(void* ctx, int fd, const struct iovec *iov, int iovcnt);
+static ssize_t vfs_fat_readv(void* ctx, int fd, const struct iovec *iov, int iovcnt);
 static int vfs_fat_open(void* ctx, const char * path, int flags, int mode);
 static int vfs_fat_close(void* ctx, int fd);
 static int vfs_fat_fstat(void* ctx, int fd, struct stat * st);
@@ -112,6 +142,11 @@ static int vfs_fat_ftruncate(void* ctx, int fd, off_t length);
 static int vfs_fat_utime(void* ctx, const char *path, const struct utimbuf *times);
 #endif // CONFIG_VFS_SUPPORT_DIR
 static int fresult_to_errno(FRESULT fr);
+#if CONFIG_FATFS_USE_MMAP
+static FRESULT test_contiguous_file(FIL* fp, int* cont);
+static void* vfs_fat_mmap(void* ctx, int fd, void* addr, size_t length, int prot, int flags, off_t offset);
+static int vfs_fat_munmap(void* ctx, void* addr, size_t length);
+#endif
 
 static vfs_fat_ctx_t* s_fat_ctxs[FF_VOLUMES] = { NULL };
 //backwards-compatibility with esp_vfs_fat_unregister()
@@ -175,11 +210,17 @@ static const esp_vfs_fs_ops_t s_vfs_fat = {
     .read_p = &vfs_fat_read,
     .pread_p = &vfs_fat_pread,
     .pwrite_p = &vfs_fat_pwrite,
+    .writev_p = &vfs_fat_writev,
+    .readv_p = &vfs_fat_readv,
     .open_p = &vfs_fat_open,
     .close_p = &vfs_fat_close,
     .fstat_p = &vfs_fat_fstat,
     .fcntl_p = &vfs_fat_fcntl,
     .fsync_p = &vfs_fat_fsync,
+#if CONFIG_FATFS_USE_MMAP
+    .mmap_p = &vfs_fat_mmap,
+    .munmap_p = &vfs_fat_munmap,
+#endif // CONFIG_FATFS_USE_MMAP
 #ifdef CONFIG_VFS_SUPPORT_DIR
     .dir = &s_vfs_fat_dir,
 #endif // CONFIG_VFS_SUPPORT_DIR
@@ -214,12 +255,43 @@ esp_err_t esp_vfs_fat_register_cfg(const esp_vfs_fat_conf_t* conf, FATFS** out_f
         return ESP_ERR_NO_MEM;
     }
     memset(fat_ctx->flags, 0, max_files * sizeof(*fat_ctx->flags));
+#ifdef CONFIG_FATFS_USE_FASTSEEK
+    fat_ctx->fastseek_stamp = ff_memalloc(max_files * sizeof(*fat_ctx->fastseek_stamp));
+    if (fat_ctx->fastseek_stamp == NULL) {
+        free(fat_ctx->flags);
+        free(fat_ctx);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(fat_ctx->fastseek_stamp, 0, max_files * sizeof(*fat_ctx->fastseek_stamp));
+#endif
+#if CONFIG_FATFS_PATH_CACHE
+    fat_ctx->path_cache = ff_memalloc(CONFIG_FATFS_PATH_CACHE_SIZE * sizeof(*fat_ctx->path_cache));
+    fat_ctx->path_cache_stamp = ff_memalloc(CONFIG_FATFS_PATH_CACHE_SIZE * sizeof(*fat_ctx->path_cache_stamp));
+    if (fat_ctx->path_cache == NULL || fat_ctx->path_cache_stamp == NULL) {
+        free(fat_ctx->path_cache_stamp);
+        free(fat_ctx->path_cache);
+#ifdef CONFIG_FATFS_USE_FASTSEEK
+        free(fat_ctx->fastseek_stamp);
+#endif
+        free(fat_ctx->flags);
+        free(fat_ctx);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(fat_ctx->path_cache_stamp, 0, CONFIG_FATFS_PATH_CACHE_SIZE * sizeof(*fat_ctx->path_cache_stamp));
+#endif
     fat_ctx->max_files = max_files;
     strlcpy(fat_ctx->fat_drive, conf->fat_drive, sizeof(fat_ctx->fat_drive) - 1);
     strlcpy(fat_ctx->base_path, conf->base_path, sizeof(fat_ctx->base_path) - 1);
 
     esp_err_t err = esp_vfs_register_fs(conf->base_path, &s_vfs_fat, ESP_VFS_FLAG_CONTEXT_PTR | ESP_VFS_FLAG_STATIC, fat_ctx);
     if (err != ESP_OK) {
+#if CONFIG_FATFS_PATH_CACHE
+        free(fat_ctx->path_cache_stamp);
+        free(fat_ctx->path_cache);
+#endif
+#ifdef CONFIG_FATFS_USE_FASTSEEK
+        free(fat_ctx->fastseek_stamp);
+#endif
         free(fat_ctx->flags);
         free(fat_ctx);
         return err;
@@ -247,13 +319,121 @@ esp_err_t esp_vfs_fat_unregister_path(const char* base_path)
     if (err != ESP_OK) {
         return err;
     }
+#if CONFIG_FATFS_USE_MMAP
+    if (fat_ctx->mmap_base != NULL) {
+        esp_partition_munmap(fat_ctx->mmap_handle);
+        free(fat_ctx->mmap_off);
+    }
+#endif
     _lock_close(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    free(fat_ctx->path_cache_stamp);
+    free(fat_ctx->path_cache);
+#endif
+#ifdef CONFIG_FATFS_USE_FASTSEEK
+    free(fat_ctx->fastseek_stamp);
+#endif
     free(fat_ctx->flags);
     free(fat_ctx);
     s_fat_ctxs[ctx] = NULL;
     return ESP_OK;
 }
 
+#if CONFIG_FATFS_USE_MMAP
+static vfs_fat_ctx_t* find_context_by_fs(FATFS* fs)
+{
+    for (size_t i = 0; i < FF_VOLUMES; i++) {
+        if (s_fat_ctxs[i] && &s_fat_ctxs[i]->fs == fs) {
+            return s_fat_ctxs[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t esp_vfs_fat_mmap_enable(FATFS* fs, const esp_partition_t* partition)
+{
+    if (fs == NULL || partition == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (partition->encrypted) {
+        // the MMU maps flash contents as stored, so reads of an encrypted
+        // partition would return ciphertext
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    vfs_fat_ctx_t* fat_ctx = find_context_by_fs(fs);
+    if (fat_ctx == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    _lock_acquire(&fat_ctx->lock);
+    if (fat_ctx->mmap_base != NULL) {
+        _lock_release(&fat_ctx->lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    fat_ctx->mmap_off = ff_memalloc(fat_ctx->max_files * sizeof(*fat_ctx->mmap_off));
+    if (fat_ctx->mmap_off == NULL) {
+        _lock_release(&fat_ctx->lock);
+        return ESP_ERR_NO_MEM;
+    }
+    for (size_t i = 0; i < fat_ctx->max_files; i++) {
+        fat_ctx->mmap_off[i] = MMAP_OFF_NONE;
+    }
+    const void* base = NULL;
+    esp_err_t err = esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA,
+                                       &base, &fat_ctx->mmap_handle);
+    if (err != ESP_OK) {
+        ESP_LOGD(TAG, "esp_partition_mmap failed (0x%x)", err);
+        free(fat_ctx->mmap_off);
+        fat_ctx->mmap_off = NULL;
+        _lock_release(&fat_ctx->lock);
+        return err;
+    }
+    fat_ctx->mmap_base = base;
+    _lock_release(&fat_ctx->lock);
+    return ESP_OK;
+}
+
+static void* vfs_fat_mmap(void* ctx, int fd, void* addr, size_t length, int prot, int flags, off_t offset)
+{
+    (void) addr;
+    (void) flags;
+    vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
+    if ((prot & ~PROT_READ) != 0) {
+        // the flash cache mapping is read-only
+        errno = EACCES;
+        return MAP_FAILED;
+    }
+    _lock_acquire(&fat_ctx->lock);
+    if (fat_ctx->mmap_off == NULL || fat_ctx->mmap_off[fd] == MMAP_OFF_NONE) {
+        // no partition mapping, writable descriptor, or fragmented file
+        _lock_release(&fat_ctx->lock);
+        errno = ENODEV;
+        return MAP_FAILED;
+    }
+    FIL* file = &fat_ctx->files[fd];
+    FSIZE_t fsize = f_size(file);
+    if ((FSIZE_t) offset > fsize || length > fsize - offset) {
+        _lock_release(&fat_ctx->lock);
+        errno = EINVAL;
+        return MAP_FAILED;
+    }
+    const uint8_t* region = fat_ctx->mmap_base + fat_ctx->mmap_off[fd] + offset;
+    _lock_release(&fat_ctx->lock);
+    // the region stays readable after the descriptor is closed: it is a
+    // window into the partition mapping, which lives until unmount
+    return (void*) region;
+}
+
+static int vfs_fat_munmap(void* ctx, void* addr, size_t length)
+{
+    // nothing to release, the partition mapping is shared by all regions
+    // and is only torn down when the filesystem is unregistered
+    (void) ctx;
+    (void) addr;
+    (void) length;
+    return 0;
+}
+#endif // CONFIG_FATFS_USE_MMAP
+
 esp_err_t esp_vfs_fat_info(const char* base_path,
                            uint64_t* out_total_bytes,
                            uint64_t* out_free_bytes)
@@ -374,11 +554,108 @@ static void prepend_drive_to_path(vfs_fat_ctx_t * ctx, const char ** path, const
     }
 }
 
+#ifdef CONFIG_FATFS_USE_FASTSEEK
+/* Record that this fd just used its cluster map; called with fat_ctx->lock held */
+static void fastseek_touch(vfs_fat_ctx_t* fat_ctx, int fd)
+{
+    if (fat_ctx->files[fd].cltbl != NULL) {
+        fat_ctx->fastseek_stamp[fd] = ++fat_ctx->fastseek_counter;
+    }
+}
+
+/* Keep the number of allocated cluster maps within the configured budget by
+ * evicting the map of the least recently seeked file; that file transparently
+ * falls back to FAT-chain seeks. Called with fat_ctx->lock held. */
+static void fastseek_make_room(vfs_fat_ctx_t* fat_ctx)
+{
+    size_t used = 0;
+    size_t lru_fd = 0;
+    uint32_t lru_stamp = UINT32_MAX;
+    for (size_t i = 0; i < fat_ctx->max_files; ++i) {
+        if (fat_ctx->files[i].cltbl == NULL) {
+            continue;
+        }
+        ++used;
+        if (fat_ctx->fastseek_stamp[i] <= lru_stamp) {
+            lru_stamp = fat_ctx->fastseek_stamp[i];
+            lru_fd = i;
+        }
+    }
+    if (used < CONFIG_FATFS_FAST_SEEK_MAX_FILES) {
+        return;
+    }
+    ff_memfree(fat_ctx->files[lru_fd].cltbl);
+    fat_ctx->files[lru_fd].cltbl = NULL;
+    fat_ctx->fastseek_stamp[lru_fd] = 0;
+}
+#endif // CONFIG_FATFS_USE_FASTSEEK
+
+#if CONFIG_FATFS_PATH_CACHE
+static const FILINFO* fat_path_cache_lookup(vfs_fat_ctx_t* fat_ctx, const char* path)
+{
+    if (fat_ctx->path_cache == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < CONFIG_FATFS_PATH_CACHE_SIZE; i++) {
+        if (fat_ctx->path_cache_stamp[i] != 0
+                && strcmp(fat_ctx->path_cache[i].file_path, path) == 0) {
+            fat_ctx->path_cache_stamp[i] = ++fat_ctx->path_cache_counter;
+            return &fat_ctx->path_cache[i].fileinfo;
+        }
+    }
+    return NULL;
+}
+
+static void fat_path_cache_store(vfs_fat_ctx_t* fat_ctx, const char* path, const FILINFO* info)
+{
+    if (fat_ctx->path_cache == NULL
+            || strlen(path) >= sizeof(fat_ctx->path_cache[0].file_path)) {
+        return;
+    }
+    // reuse the slot already holding this path, otherwise evict the least
+    // recently used one (empty slots carry stamp 0 and therefore win)
+    size_t victim = 0;
+    for (size_t i = 0; i < CONFIG_FATFS_PATH_CACHE_SIZE; i++) {
+        if (fat_ctx->path_cache_stamp[i] != 0
+                && strcmp(fat_ctx->path_cache[i].file_path, path) == 0) {
+            victim = i;
+            break;
+        }
+        if (fat_ctx->path_cache_stamp[i] < fat_ctx->path_cache_stamp[victim]) {
+            victim = i;
+        }
+    }
+    strlcpy(fat_ctx->path_cache[victim].file_path, path, sizeof(fat_ctx->path_cache[victim].file_path));
+    fat_ctx->path_cache[victim].fileinfo = *info;
+    fat_ctx->path_cache_stamp[victim] = ++fat_ctx->path_cache_counter;
+}
+
+static void fat_path_cache_invalidate(vfs_fat_ctx_t* fat_ctx, const char* path)
+{
+    if (fat_ctx->path_cache == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < CONFIG_FATFS_PATH_CACHE_SIZE; i++) {
+        if (path == NULL
+                || (fat_ctx->path_cache_stamp[i] != 0
+                    && strcmp(fat_ctx->path_cache[i].file_path, path) == 0)) {
+            fat_ctx->path_cache_stamp[i] = 0;
+        }
+    }
+}
+#endif // CONFIG_FATFS_PATH_CACHE
+
 static int vfs_fat_open(void* ctx, const char * path, int flags, int mode)
 {
     ESP_LOGV(TAG, "%s: path=\"%s\", flags=%x, mode=%x", __func__, path, flags, mode);
     vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
     _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    // the directory entry is about to change, drop the cached lookup
+    if (flags & (O_WRONLY | O_RDWR | O_CREAT | O_TRUNC)) {
+        fat_path_cache_invalidate(fat_ctx, path);
+    }
+#endif
     prepend_drive_to_path(fat_ctx, &path, NULL);
     int fd = get_next_fd(fat_ctx);
     if (fd < 0) {
@@ -399,9 +676,15 @@ static int vfs_fat_open(void* ctx, const char * path, int flags, int mode)
 
 #ifdef CONFIG_FATFS_USE_FASTSEEK
     FIL* file = &fat_ctx->files[fd];
+#ifdef CONFIG_FATFS_FAST_SEEK_ON_FLAG
+    bool fastseek_wanted = (flags & ESP_FATFS_FASTSEEK) != 0;
+#else
+    bool fastseek_wanted = true;
+#endif
     //fast-seek is only allowed in read mode, since file cannot be expanded
     //to use it.
-    if(!(fat_mode_conv(flags) & (FA_WRITE))) {
+    if(fastseek_wanted && !(fat_mode_conv(flags) & (FA_WRITE))) {
+        fastseek_make_room(fat_ctx);
         DWORD *clmt_mem =  ff_memalloc(sizeof(DWORD) * CONFIG_FATFS_FAST_SEEK_BUFFER_SIZE);
         if (clmt_mem == NULL) {
             f_close(file);
@@ -424,6 +707,8 @@ static int vfs_fat_open(void* ctx, const char * path, int flags, int mode)
             //If linkmap creation fails, fallback to the non fast seek.
             ff_memfree(file->cltbl);
             file->cltbl = NULL;
+        } else {
+            fastseek_touch(fat_ctx, fd);
         }
     } else {
         file->cltbl = NULL;
@@ -437,21 +722,38 @@ static int vfs_fat_open(void* ctx, const char * path, int flags, int mode)
     // therefore this flag is stored here (at this VFS level) in order to save
     // memory.
     fat_ctx->flags[fd] = (flags & (O_APPEND | O_ACCMODE));
+
+#if CONFIG_FATFS_USE_MMAP
+    if (fat_ctx->mmap_base != NULL && (flags & O_ACCMODE) == O_RDONLY) {
+        FIL* mfile = &fat_ctx->files[fd];
+        int cont = 0;
+        // Resolve the cluster chain once: only files stored in one contiguous
+        // run can be served from the mapping, everything else falls back to
+        // the regular f_read path.
+        if (f_size(mfile) > 0 && test_contiguous_file(mfile, &cont) == FR_OK && cont) {
+            FATFS* fs = mfile->obj.fs;
+            DWORD start_sect = fs->database + (DWORD)fs->csize * (mfile->obj.sclust - 2);
+#if FF_MAX_SS == FF_MIN_SS
+            fat_ctx->mmap_off[fd] = start_sect * FF_MAX_SS;
+#else
+            fat_ctx->mmap_off[fd] = start_sect * fs->ssize;
+#endif
+        }
+        f_rewind(mfile);    // the contiguity check leaves the read pointer at EOF
+    }
+#endif
     _lock_release(&fat_ctx->lock);
     return fd;
 }
 
-static ssize_t vfs_fat_write(void* ctx, int fd, const void * data, size_t size)
+static ssize_t vfs_fat_write_unlocked(vfs_fat_ctx_t* fat_ctx, int fd, const void * data, size_t size)
 {
-    vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
     FIL* file = &fat_ctx->files[fd];
     FRESULT res;
-    _lock_acquire(&fat_ctx->lock);
     if (fat_ctx->flags[fd] & O_APPEND) {
         if ((res = f_lseek(file, f_size(file))) != FR_OK) {
             ESP_LOGD(TAG, "%s: fresult=%d", __func__, res);
             errno = fresult_to_errno(res);
-            _lock_release(&fat_ctx->lock);
             return -1;
         }
     }
@@ -459,14 +761,12 @@ static ssize_t vfs_fat_write(void* ctx, int fd, const void * data, size_t size)
     res = f_write(file, data, size, &written);
     if (((written == 0) && (size != 0)) && (res == 0)) {
         errno = ENOSPC;
-        _lock_release(&fat_ctx->lock);
         return -1;
     }
     if (res != FR_OK) {
         ESP_LOGD(TAG, "%s: fresult=%d", __func__, res);
         errno = fresult_to_errno(res);
         if (written == 0) {
-            _lock_release(&fat_ctx->lock);
             return -1;
         }
     }
@@ -477,40 +777,139 @@ static ssize_t vfs_fat_write(void* ctx, int fd, const void * data, size_t size)
         if (res != FR_OK) {
             ESP_LOGD(TAG, "%s: fresult=%d", __func__, res);
             errno = fresult_to_errno(res);
-            _lock_release(&fat_ctx->lock);
             return -1;
         }
      }
 #endif
-    _lock_release(&fat_ctx->lock);
     return written;
 }
 
-static ssize_t vfs_fat_read(void* ctx, int fd, void * dst, size_t size)
+static ssize_t vfs_fat_write(void* ctx, int fd, const void * data, size_t size)
+{
+    vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
+    _lock_acquire(&fat_ctx->lock);
+    ssize_t ret = vfs_fat_write_unlocked(fat_ctx, fd, data, size);
+    _lock_release(&fat_ctx->lock);
+    return ret;
+}
+
+static ssize_t vfs_fat_writev(void* ctx, int fd, const struct iovec *iov, int iovcnt)
 {
     vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
+    ssize_t total = 0;
+    _lock_acquire(&fat_ctx->lock);
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        ssize_t ret = vfs_fat_write_unlocked(fat_ctx, fd, iov[i].iov_base, iov[i].iov_len);
+        if (ret < 0) {
+            if (total == 0) {
+                total = -1;
+            }
+            break;
+        }
+        total += ret;
+        if ((size_t) ret < iov[i].iov_len) {
+            break;
+        }
+    }
+    _lock_release(&fat_ctx->lock);
+    return total;
+}
+
+static ssize_t vfs_fat_read_unlocked(vfs_fat_ctx_t* fat_ctx, int fd, void * dst, size_t size)
+{
     FIL* file = &fat_ctx->files[fd];
     UINT read = 0;
-    _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_USE_MMAP
+    if (fat_ctx->mmap_off != NULL && fat_ctx->mmap_off[fd] != MMAP_OFF_NONE) {
+        FSIZE_t pos = f_tell(file);
+        FSIZE_t fsize = f_size(file);
+        if (pos >= fsize) {
+            return 0;
+        }
+        size_t will_read = size;
+        if (will_read > fsize - pos) {
+            will_read = fsize - pos;
+        }
+        memcpy(dst, fat_ctx->mmap_base + fat_ctx->mmap_off[fd] + pos, will_read);
+        FRESULT mres = f_lseek(file, pos + will_read);  // keep the FatFS read pointer in sync
+        if (mres != FR_OK) {
+            ESP_LOGD(TAG, "%s: fresult=%d", __func__, mres);
+            errno = fresult_to_errno(mres);
+            return -1;
+        }
+        return will_read;
+    }
+#endif
     FRESULT res = f_read(file, dst, size, &read);
     if (res != FR_OK) {
         ESP_LOGD(TAG, "%s: fresult=%d", __func__, res);
         errno = fresult_to_errno(res);
         if (read == 0) {
-            _lock_release(&fat_ctx->lock);
             return -1;
         }
     }
-    _lock_release(&fat_ctx->lock);
     return read;
 }
 
+static ssize_t vfs_fat_read(void* ctx, int fd, void * dst, size_t size)
+{
+    vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
+    _lock_acquire(&fat_ctx->lock);
+    ssize_t ret = vfs_fat_read_unlocked(fat_ctx, fd, dst, size);
+    _lock_release(&fat_ctx->lock);
+    return ret;
+}
+
+static ssize_t vfs_fat_readv(void* ctx, int fd, const struct iovec *iov, int iovcnt)
+{
+    vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
+    ssize_t total = 0;
+    _lock_acquire(&fat_ctx->lock);
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        ssize_t ret = vfs_fat_read_unlocked(fat_ctx, fd, iov[i].iov_base, iov[i].iov_len);
+        if (ret < 0) {
+            if (total == 0) {
+                total = -1;
+            }
+            break;
+        }
+        total += ret;
+        if ((size_t) ret < iov[i].iov_len) {
+            break;
+        }
+    }
+    _lock_release(&fat_ctx->lock);
+    return total;
+}
+
 static ssize_t vfs_fat_pread(void *ctx, int fd, void *dst, size_t size, off_t offset)
 {
     ssize_t ret = -1;
     vfs_fat_ctx_t *fat_ctx = (vfs_fat_ctx_t *) ctx;
     _lock_acquire(&fat_ctx->lock);
     FIL *file = &fat_ctx->files[fd];
+#if CONFIG_FATFS_USE_MMAP
+    if (fat_ctx->mmap_off != NULL && fat_ctx->mmap_off[fd] != MMAP_OFF_NONE) {
+        FSIZE_t fsize = f_size(file);
+        ret = 0;
+        if ((FSIZE_t) offset < fsize) {
+            size_t will_read = size;
+            if (will_read > fsize - offset) {
+                will_read = fsize - offset;
+            }
+            memcpy(dst, fat_ctx->mmap_base + fat_ctx->mmap_off[fd] + offset, will_read);
+            ret = will_read;
+        }
+        _lock_release(&fat_ctx->lock);
+        return ret;
+    }
+#endif
     const off_t prev_pos = f_tell(file);
 
     FRESULT f_res = f_lseek(file, offset);
@@ -626,6 +1025,20 @@ static int vfs_fat_close(void* ctx, int fd)
 #ifdef CONFIG_FATFS_USE_FASTSEEK
     ff_memfree(file->cltbl);
     file->cltbl = NULL;
+    fat_ctx->fastseek_stamp[fd] = 0;
+#endif
+
+#if CONFIG_FATFS_USE_MMAP
+    if (fat_ctx->mmap_off != NULL) {
+        fat_ctx->mmap_off[fd] = MMAP_OFF_NONE;
+    }
+#endif
+
+#if CONFIG_FATFS_PATH_CACHE
+    if (fat_ctx->flags[fd] & (O_WRONLY | O_RDWR)) {
+        // the path of the fd is not tracked, so a written file drops the whole cache
+        fat_path_cache_invalidate(fat_ctx, NULL);
+    }
 #endif
 
     FRESULT res = f_close(file);
@@ -672,6 +1085,9 @@ static off_t vfs_fat_lseek(void* ctx, int fd, off_t offset, int mode)
         _lock_release(&fat_ctx->lock);
         return -1;
     }
+#ifdef CONFIG_FATFS_USE_FASTSEEK
+    fastseek_touch(fat_ctx, fd);
+#endif
     _lock_release(&fat_ctx->lock);
     return new_pos;
 }
@@ -778,9 +1194,24 @@ static int vfs_fat_stat(void* ctx, const char * path, struct stat * st)
 
     memset(&fat_ctx->cached_fileinfo, 0 ,sizeof(fat_ctx->cached_fileinfo));
     _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    const FILINFO* cached = fat_path_cache_lookup(fat_ctx, path);
+    if (cached != NULL) {
+        FILINFO info_copy = *cached;
+        _lock_release(&fat_ctx->lock);
+        update_stat_struct(st, &info_copy);
+        return 0;
+    }
+    const char* orig_path = path;
+#endif
     prepend_drive_to_path(fat_ctx, &path, NULL);
     FILINFO info;
     FRESULT res = f_stat(path, &info);
+#if CONFIG_FATFS_PATH_CACHE
+    if (res == FR_OK) {
+        fat_path_cache_store(fat_ctx, orig_path, &info);
+    }
+#endif
     _lock_release(&fat_ctx->lock);
     if (res != FR_OK) {
         ESP_LOGD(TAG, "%s: fresult=%d", __func__, res);
@@ -796,6 +1227,9 @@ static int vfs_fat_unlink(void* ctx, const char *path)
 {
     vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
     _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    fat_path_cache_invalidate(fat_ctx, path);
+#endif
     prepend_drive_to_path(fat_ctx, &path, NULL);
     FRESULT res = f_unlink(path);
     _lock_release(&fat_ctx->lock);
@@ -811,6 +1245,9 @@ static int vfs_fat_link(void* ctx, const char* n1, const char* n2)
 {
     vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
     _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    fat_path_cache_invalidate(fat_ctx, n2);
+#endif
     prepend_drive_to_path(fat_ctx, &n1, &n2);
 
     FRESULT res = FR_OK;
@@ -897,6 +1334,10 @@ static int vfs_fat_rename(void* ctx, const char *src, const char *dst)
 {
     vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
     _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    fat_path_cache_invalidate(fat_ctx, src);
+    fat_path_cache_invalidate(fat_ctx, dst);
+#endif
     prepend_drive_to_path(fat_ctx, &src, &dst);
     FRESULT res = f_rename(src, dst);
     _lock_release(&fat_ctx->lock);
@@ -978,6 +1419,12 @@ static struct dirent* vfs_fat_readdir(void* ctx, DIR* pdir)
         ff_memfree(temp_file_path);
     }
     fat_ctx->cached_fileinfo.fileinfo = fat_dir->filinfo;
+#if CONFIG_FATFS_PATH_CACHE
+    // enumerating a directory warms the cache for the stats which usually follow
+    _lock_acquire(&fat_ctx->lock);
+    fat_path_cache_store(fat_ctx, fat_ctx->cached_fileinfo.file_path, &fat_dir->filinfo);
+    _lock_release(&fat_ctx->lock);
+#endif
     return out_dirent;
 }
 
@@ -1065,6 +1512,9 @@ static int vfs_fat_rmdir(void* ctx, const char* name)
 {
     vfs_fat_ctx_t* fat_ctx = (vfs_fat_ctx_t*) ctx;
     _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    fat_path_cache_invalidate(fat_ctx, name);
+#endif
     prepend_drive_to_path(fat_ctx, &name, NULL);
     FRESULT res = f_unlink(name);
     _lock_release(&fat_ctx->lock);
@@ -1163,6 +1613,9 @@ static int vfs_fat_truncate(void* ctx, const char *path, off_t length)
     }
 
     _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    fat_path_cache_invalidate(fat_ctx, path);
+#endif
     prepend_drive_to_path(fat_ctx, &path, NULL);
 
     file = (FIL*) ff_memalloc(sizeof(FIL));
@@ -1399,6 +1852,9 @@ static int vfs_fat_utime(void *ctx, const char *path, const struct utimbuf *time
 
     vfs_fat_ctx_t *fat_ctx = (vfs_fat_ctx_t *) ctx;
     _lock_acquire(&fat_ctx->lock);
+#if CONFIG_FATFS_PATH_CACHE
+    fat_path_cache_invalidate(fat_ctx, path);
+#endif
     prepend_drive_to_path(fat_ctx, &path, NULL);
     FRESULT res = f_utime(path, &filinfo_time);
     _lock_release(&fat_ctx->lock);
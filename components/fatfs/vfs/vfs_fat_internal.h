@@ -25,6 +25,28 @@ typedef struct vfs_fat_spiflash_ctx_t {
     vfs_fat_x_ctx_flags_t flags;                //Flags
 } vfs_fat_spiflash_ctx_t;
 
+#if CONFIG_FATFS_USE_MMAP
+/**
+ * @brief Enable the memory-mapped read fast path for a mounted read-only filesystem
+ *
+ * Maps the whole data partition into the data address space with esp_partition_mmap.
+ * Files opened in read-only mode whose cluster chain is contiguous are then read
+ * with a plain memcpy from the mapping instead of per-sector reads through diskio.
+ * The mapping is released when the filesystem is unregistered from VFS.
+ *
+ * @param fs         FATFS structure obtained from esp_vfs_fat_register_cfg
+ * @param partition  unencrypted partition backing the filesystem
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if fs or partition is NULL
+ *      - ESP_ERR_NOT_SUPPORTED if the partition is encrypted
+ *      - ESP_ERR_INVALID_STATE if fs is not registered or already mapped
+ *      - ESP_ERR_NO_MEM if allocation or mapping fails
+ */
+esp_err_t esp_vfs_fat_mmap_enable(FATFS* fs, const esp_partition_t* partition);
+#endif // CONFIG_FATFS_USE_MMAP
+
 static inline size_t esp_vfs_fat_get_allocation_unit_size(
         size_t sector_size, size_t requested_size)
 {
@@ -383,6 +383,15 @@ esp_err_t esp_vfs_fat_spiflash_mount_ro(const char* base_path,
         goto fail;
     }
 
+#if CONFIG_FATFS_USE_MMAP
+    if (!data_partition->encrypted) {
+        esp_err_t mmap_ret = esp_vfs_fat_mmap_enable(fs, data_partition);
+        if (mmap_ret != ESP_OK) {
+            ESP_LOGW(TAG, "mmap fast path not enabled (0x%x), falling back to sector reads", mmap_ret);
+        }
+    }
+#endif
+
     if (data_partition->readonly) {
         esp_vfs_set_readonly_flag(base_path);
     }
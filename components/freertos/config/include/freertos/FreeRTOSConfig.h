@@ -236,6 +236,30 @@
         #include "esp_trace_freertos.h"
     #endif
 
+    #if CONFIG_PERFMON_TASK_STATS
+        #include "xtensa_perfmon_freertos.h"
+    #endif
+
+    #if CONFIG_FREERTOS_TASK_LATENCY_HISTOGRAM
+
+/* Scheduler latency instrumentation (see freertos/task_latency.h). The hook
+ * prototypes are repeated here as this header cannot pull in the kernel types
+ * the public header depends on. */
+        void vTaskLatencyTaskReady( void * pxTCB );
+        void vTaskLatencyTaskSwitchedOut( void );
+        void vTaskLatencyTaskSwitchedIn( void );
+
+        #ifndef traceMOVED_TASK_TO_READY_STATE
+            #define traceMOVED_TASK_TO_READY_STATE( pxTCB )    vTaskLatencyTaskReady( ( void * ) ( pxTCB ) )
+        #endif
+        #ifndef traceTASK_SWITCHED_OUT
+            #define traceTASK_SWITCHED_OUT()                   vTaskLatencyTaskSwitchedOut()
+        #endif
+        #ifndef traceTASK_SWITCHED_IN
+            #define traceTASK_SWITCHED_IN()                    vTaskLatencyTaskSwitchedIn()
+        #endif
+    #endif /* CONFIG_FREERTOS_TASK_LATENCY_HISTOGRAM */
+
     #if CONFIG_FREERTOS_SMP
 
 /* Default values for trace macros added to ESP-IDF implementation of SYSVIEW
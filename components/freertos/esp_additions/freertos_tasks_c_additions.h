@@ -542,6 +542,24 @@ BaseType_t xTaskGetCoreID( TaskHandle_t xTask )
     }
 
 #endif /* ( !CONFIG_FREERTOS_SMP && ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
+/*----------------------------------------------------------*/
+
+#if ( !CONFIG_FREERTOS_SMP && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+    configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* A critical section is not required here. The counter is only
+         * written on a context switch, and callers merely compare successive
+         * samples, so a stale value is indistinguishable from the task not
+         * having run yet. */
+        return pxTCB->ulRunTimeCounter;
+    }
+
+#endif /* ( !CONFIG_FREERTOS_SMP && ( configGENERATE_RUN_TIME_STATS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 StackType_t * xTaskGetStackStart( TaskHandle_t xTask )
@@ -22,6 +22,66 @@
 #include "esp_log.h"
 #include "freertos/portmacro.h"
 
+/* ------------------------------------------------ Adaptive Mutexes ------------------------------------------------ */
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    BaseType_t xSemaphoreTakeAdaptive( SemaphoreHandle_t xMutex,
+                                       TickType_t xBlockTime,
+                                       UBaseType_t uxMaxSpins )
+    {
+        configASSERT( xMutex != NULL );
+        configASSERT( xPortInIsrContext() == pdFALSE );
+
+        /* Fast path: uncontended take */
+        if( xSemaphoreTake( xMutex, 0 ) == pdTRUE )
+        {
+            return pdTRUE;
+        }
+
+        if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+        {
+            const BaseType_t xCurCoreID = xPortGetCoreID();
+
+            for( UBaseType_t uxSpin = 0; uxSpin < uxMaxSpins; uxSpin++ )
+            {
+                TaskHandle_t xHolder = xSemaphoreGetMutexHolder( xMutex );
+
+                if( xHolder != NULL )
+                {
+                    /* Spinning only helps while the holder is making progress
+                     * on another core. If it is not currently running, block
+                     * right away instead of burning cycles. */
+                    BaseType_t xHolderRunning = pdFALSE;
+
+                    for( BaseType_t xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+                    {
+                        if( ( xCoreID != xCurCoreID ) && ( xTaskGetCurrentTaskHandleForCore( xCoreID ) == xHolder ) )
+                        {
+                            xHolderRunning = pdTRUE;
+                            break;
+                        }
+                    }
+
+                    if( xHolderRunning == pdFALSE )
+                    {
+                        break;
+                    }
+                }
+
+                if( xSemaphoreTake( xMutex, 0 ) == pdTRUE )
+                {
+                    return pdTRUE;
+                }
+            }
+        }
+
+        /* Spin phase exhausted (or not applicable), block as usual */
+        return xSemaphoreTake( xMutex, xBlockTime );
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+
 /* -------------------------------------------- Creation With Memory Caps ------------------------------------------- */
 
 /* ---------------------------------- Tasks --------------------------------- */
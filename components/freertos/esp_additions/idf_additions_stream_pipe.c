@@ -0,0 +1,330 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * This file implements the zero-copy stream pipe declared in
+ * freertos/stream_pipe.h. See the header for the usage model.
+ *
+ * Synchronization: a spinlock protects the ring state. A task that finds the
+ * pipe full (producer) or empty (consumer) registers itself as the waiter
+ * and blocks on a direct task notification; the opposite side sends the
+ * notification from inside the commit/consume path. Timeouts are tracked
+ * with xTaskCheckForTimeOut() so a woken-but-raced task waits only for the
+ * remaining time.
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/stream_pipe.h"
+#include "esp_heap_caps.h"
+
+#define STREAM_PIPE_ALIGN_UP( num, align )    ( ( ( num ) + ( ( align ) - 1 ) ) & ~( ( align ) - 1 ) )
+
+typedef struct StreamPipeDef_t
+{
+    uint8_t * pucBuffer;            /* Frame storage, xFrameCount slots of xSlotStrideBytes */
+    size_t * pxLengths;             /* Valid data length of each slot */
+    size_t xFrameSizeBytes;         /* Usable size of each frame */
+    size_t xSlotStrideBytes;        /* Distance between frame starts, frame size aligned up */
+    size_t xFrameCount;
+    size_t xHead;                   /* Next slot to reserve */
+    size_t xTail;                   /* Oldest committed slot */
+    size_t xFreeCount;              /* Slots available for reserving */
+    size_t xReadyCount;             /* Slots committed and not yet consumed */
+    BaseType_t xFrameReserved;      /* pdTRUE while a reserve is outstanding */
+    TaskHandle_t xProducerWaiting;  /* Task blocked in pvStreamPipeReserve(), or NULL */
+    TaskHandle_t xConsumerWaiting;  /* Task blocked in pvStreamPipePeek(), or NULL */
+    portMUX_TYPE xLock;
+} StreamPipe_t;
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    StreamPipeHandle_t xStreamPipeCreateWithCaps( size_t xFrameSizeBytes,
+                                                  size_t xFrameCount,
+                                                  size_t xAlignment,
+                                                  UBaseType_t uxMemoryCaps )
+    {
+        StreamPipe_t * pxPipe;
+
+        if( xAlignment == 0 )
+        {
+            xAlignment = 4;
+        }
+
+        if( ( xFrameSizeBytes == 0 ) || ( xFrameCount == 0 ) ||
+            ( ( xAlignment & ( xAlignment - 1 ) ) != 0 ) )
+        {
+            return NULL;
+        }
+
+        /* The control structure always lives in internal memory, only the
+         * frame storage uses the caller provided caps */
+        pxPipe = heap_caps_calloc( 1, sizeof( StreamPipe_t ), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT );
+
+        if( pxPipe == NULL )
+        {
+            return NULL;
+        }
+
+        pxPipe->pxLengths = heap_caps_calloc( xFrameCount, sizeof( size_t ), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT );
+
+        /* Align the slot stride as well, so every frame start (not just the
+         * first) satisfies the requested alignment */
+        pxPipe->xSlotStrideBytes = STREAM_PIPE_ALIGN_UP( xFrameSizeBytes, xAlignment );
+        pxPipe->pucBuffer = heap_caps_aligned_calloc( xAlignment, xFrameCount, pxPipe->xSlotStrideBytes, uxMemoryCaps );
+
+        if( ( pxPipe->pxLengths == NULL ) || ( pxPipe->pucBuffer == NULL ) )
+        {
+            heap_caps_free( pxPipe->pxLengths );
+            heap_caps_free( pxPipe->pucBuffer );
+            heap_caps_free( pxPipe );
+            return NULL;
+        }
+
+        pxPipe->xFrameSizeBytes = xFrameSizeBytes;
+        pxPipe->xFrameCount = xFrameCount;
+        pxPipe->xFreeCount = xFrameCount;
+        portMUX_INITIALIZE( &pxPipe->xLock );
+
+        return pxPipe;
+    }
+
+    void vStreamPipeDelete( StreamPipeHandle_t xStreamPipe )
+    {
+        configASSERT( xStreamPipe != NULL );
+        configASSERT( xStreamPipe->xProducerWaiting == NULL );
+        configASSERT( xStreamPipe->xConsumerWaiting == NULL );
+
+        heap_caps_free( xStreamPipe->pucBuffer );
+        heap_caps_free( xStreamPipe->pxLengths );
+        heap_caps_free( xStreamPipe );
+    }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*----------------------------------------------------------*/
+
+void * pvStreamPipeReserve( StreamPipeHandle_t xStreamPipe,
+                            TickType_t xTicksToWait )
+{
+    TimeOut_t xTimeOut;
+    void * pvFrame = NULL;
+
+    configASSERT( xStreamPipe != NULL );
+
+    vTaskSetTimeOutState( &xTimeOut );
+
+    for( ; ; )
+    {
+        portENTER_CRITICAL( &xStreamPipe->xLock );
+
+        if( ( xStreamPipe->xFreeCount > 0 ) && ( xStreamPipe->xFrameReserved == pdFALSE ) )
+        {
+            xStreamPipe->xFrameReserved = pdTRUE;
+            pvFrame = xStreamPipe->pucBuffer + ( xStreamPipe->xHead * xStreamPipe->xSlotStrideBytes );
+            portEXIT_CRITICAL( &xStreamPipe->xLock );
+            return pvFrame;
+        }
+
+        if( ( xStreamPipe->xFrameReserved == pdTRUE ) || ( xTicksToWait == 0 ) )
+        {
+            /* A reserve is already outstanding, or the caller doesn't want
+             * to block */
+            portEXIT_CRITICAL( &xStreamPipe->xLock );
+            return NULL;
+        }
+
+        xStreamPipe->xProducerWaiting = xTaskGetCurrentTaskHandle();
+        portEXIT_CRITICAL( &xStreamPipe->xLock );
+
+        ( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+
+        portENTER_CRITICAL( &xStreamPipe->xLock );
+        xStreamPipe->xProducerWaiting = NULL;
+        portEXIT_CRITICAL( &xStreamPipe->xLock );
+
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdTRUE )
+        {
+            xTicksToWait = 0;
+        }
+    }
+}
+
+void * pvStreamPipeReserveFromISR( StreamPipeHandle_t xStreamPipe )
+{
+    void * pvFrame = NULL;
+
+    configASSERT( xStreamPipe != NULL );
+
+    portENTER_CRITICAL_ISR( &xStreamPipe->xLock );
+
+    if( ( xStreamPipe->xFreeCount > 0 ) && ( xStreamPipe->xFrameReserved == pdFALSE ) )
+    {
+        xStreamPipe->xFrameReserved = pdTRUE;
+        pvFrame = xStreamPipe->pucBuffer + ( xStreamPipe->xHead * xStreamPipe->xSlotStrideBytes );
+    }
+
+    portEXIT_CRITICAL_ISR( &xStreamPipe->xLock );
+
+    return pvFrame;
+}
+/*----------------------------------------------------------*/
+
+static BaseType_t prvStreamPipeCommit( StreamPipeHandle_t xStreamPipe,
+                                       size_t xLengthBytes,
+                                       TaskHandle_t * pxTaskToNotify )
+{
+    if( ( xStreamPipe->xFrameReserved == pdFALSE ) ||
+        ( xLengthBytes > xStreamPipe->xFrameSizeBytes ) )
+    {
+        return pdFALSE;
+    }
+
+    xStreamPipe->pxLengths[ xStreamPipe->xHead ] = xLengthBytes;
+    xStreamPipe->xHead = ( xStreamPipe->xHead + 1 ) % xStreamPipe->xFrameCount;
+    xStreamPipe->xFreeCount--;
+    xStreamPipe->xReadyCount++;
+    xStreamPipe->xFrameReserved = pdFALSE;
+
+    *pxTaskToNotify = xStreamPipe->xConsumerWaiting;
+
+    return pdTRUE;
+}
+
+BaseType_t xStreamPipeCommit( StreamPipeHandle_t xStreamPipe,
+                              size_t xLengthBytes )
+{
+    BaseType_t xResult;
+    TaskHandle_t xTaskToNotify = NULL;
+
+    configASSERT( xStreamPipe != NULL );
+
+    portENTER_CRITICAL( &xStreamPipe->xLock );
+    xResult = prvStreamPipeCommit( xStreamPipe, xLengthBytes, &xTaskToNotify );
+    portEXIT_CRITICAL( &xStreamPipe->xLock );
+
+    if( xTaskToNotify != NULL )
+    {
+        xTaskNotifyGive( xTaskToNotify );
+    }
+
+    return xResult;
+}
+
+BaseType_t xStreamPipeCommitFromISR( StreamPipeHandle_t xStreamPipe,
+                                     size_t xLengthBytes,
+                                     BaseType_t * pxHigherPriorityTaskWoken )
+{
+    BaseType_t xResult;
+    TaskHandle_t xTaskToNotify = NULL;
+
+    configASSERT( xStreamPipe != NULL );
+
+    portENTER_CRITICAL_ISR( &xStreamPipe->xLock );
+    xResult = prvStreamPipeCommit( xStreamPipe, xLengthBytes, &xTaskToNotify );
+    portEXIT_CRITICAL_ISR( &xStreamPipe->xLock );
+
+    if( xTaskToNotify != NULL )
+    {
+        vTaskNotifyGiveFromISR( xTaskToNotify, pxHigherPriorityTaskWoken );
+    }
+
+    return xResult;
+}
+/*----------------------------------------------------------*/
+
+const void * pvStreamPipePeek( StreamPipeHandle_t xStreamPipe,
+                               size_t * pxLengthBytes,
+                               TickType_t xTicksToWait )
+{
+    TimeOut_t xTimeOut;
+    const void * pvFrame = NULL;
+
+    configASSERT( xStreamPipe != NULL );
+
+    vTaskSetTimeOutState( &xTimeOut );
+
+    for( ; ; )
+    {
+        portENTER_CRITICAL( &xStreamPipe->xLock );
+
+        if( xStreamPipe->xReadyCount > 0 )
+        {
+            pvFrame = xStreamPipe->pucBuffer + ( xStreamPipe->xTail * xStreamPipe->xSlotStrideBytes );
+
+            if( pxLengthBytes != NULL )
+            {
+                *pxLengthBytes = xStreamPipe->pxLengths[ xStreamPipe->xTail ];
+            }
+
+            portEXIT_CRITICAL( &xStreamPipe->xLock );
+            return pvFrame;
+        }
+
+        if( xTicksToWait == 0 )
+        {
+            portEXIT_CRITICAL( &xStreamPipe->xLock );
+            return NULL;
+        }
+
+        xStreamPipe->xConsumerWaiting = xTaskGetCurrentTaskHandle();
+        portEXIT_CRITICAL( &xStreamPipe->xLock );
+
+        ( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+
+        portENTER_CRITICAL( &xStreamPipe->xLock );
+        xStreamPipe->xConsumerWaiting = NULL;
+        portEXIT_CRITICAL( &xStreamPipe->xLock );
+
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdTRUE )
+        {
+            xTicksToWait = 0;
+        }
+    }
+}
+
+BaseType_t xStreamPipeConsume( StreamPipeHandle_t xStreamPipe )
+{
+    TaskHandle_t xTaskToNotify = NULL;
+
+    configASSERT( xStreamPipe != NULL );
+
+    portENTER_CRITICAL( &xStreamPipe->xLock );
+
+    if( xStreamPipe->xReadyCount == 0 )
+    {
+        portEXIT_CRITICAL( &xStreamPipe->xLock );
+        return pdFALSE;
+    }
+
+    xStreamPipe->xTail = ( xStreamPipe->xTail + 1 ) % xStreamPipe->xFrameCount;
+    xStreamPipe->xReadyCount--;
+    xStreamPipe->xFreeCount++;
+    xTaskToNotify = xStreamPipe->xProducerWaiting;
+
+    portEXIT_CRITICAL( &xStreamPipe->xLock );
+
+    if( xTaskToNotify != NULL )
+    {
+        xTaskNotifyGive( xTaskToNotify );
+    }
+
+    return pdTRUE;
+}
+
+size_t uxStreamPipeFramesReady( StreamPipeHandle_t xStreamPipe )
+{
+    size_t xReady;
+
+    configASSERT( xStreamPipe != NULL );
+
+    portENTER_CRITICAL( &xStreamPipe->xLock );
+    xReady = xStreamPipe->xReadyCount;
+    portEXIT_CRITICAL( &xStreamPipe->xLock );
+
+    return xReady;
+}
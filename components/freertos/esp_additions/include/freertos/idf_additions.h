@@ -189,6 +189,22 @@ BaseType_t xTaskGetCoreID( TaskHandle_t xTask );
 
 #endif /* ( !CONFIG_FREERTOS_SMP && ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
 
+#if ( !CONFIG_FREERTOS_SMP && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+/**
+ * @brief Get the total execution time of a particular task
+ *
+ * This function back-ports ulTaskGetRunTimeCounter() from upstream FreeRTOS,
+ * which is not available in the IDF FreeRTOS kernel.
+ *
+ * @param xTask Handle of the task to query. Set xTask to NULL to query the
+ * calling task.
+ * @return The total run time of the task
+ */
+    configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask );
+
+#endif /* ( !CONFIG_FREERTOS_SMP && ( configGENERATE_RUN_TIME_STATS == 1 ) ) */
+
 /**
  * Returns the start of the stack associated with xTask.
  *
@@ -244,6 +260,51 @@ StackType_t * xTaskGetStackStart( TaskHandle_t xTask );
 
 #endif /* CONFIG_FREERTOS_TLSP_DELETION_CALLBACKS */
 
+/* ------------------------------------------------ Adaptive Mutexes ------------------------------------------------ */
+
+/**
+ * Default number of spin iterations used with xSemaphoreTakeAdaptive().
+ */
+#define semADAPTIVE_MUTEX_DEFAULT_SPINS    ( ( UBaseType_t ) 64 )
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+/**
+ * @brief Take a mutex, spinning briefly on contention before blocking
+ *
+ * On multi-core targets, short critical sections guarded by a mutex often
+ * become free again within a fraction of the time a context switch takes.
+ * This function first tries to take the mutex without blocking; if the mutex
+ * is held by a task that is currently running on another core, it spins for
+ * up to uxMaxSpins iterations retrying the take, and only then falls back to
+ * a regular blocking xSemaphoreTake(). If the holder is not running (i.e.,
+ * it has been preempted), spinning cannot help and the caller blocks
+ * immediately.
+ *
+ * The spin count is a per-call parameter, so each lock site can be tuned
+ * independently; semADAPTIVE_MUTEX_DEFAULT_SPINS is a reasonable starting
+ * point. The spin phase is not counted towards xBlockTime.
+ *
+ * Must not be called from an interrupt context. Only plain (non-recursive)
+ * mutexes are supported.
+ *
+ * @param xMutex Mutex created with xSemaphoreCreateMutex()
+ * @param xBlockTime Ticks to block for once the spin phase has been exhausted
+ * @param uxMaxSpins Maximum number of spin iterations before blocking
+ * @return pdTRUE if the mutex was obtained, pdFALSE on timeout
+ */
+    BaseType_t xSemaphoreTakeAdaptive( SemaphoreHandle_t xMutex,
+                                       TickType_t xBlockTime,
+                                       UBaseType_t uxMaxSpins );
+
+#else /* configNUMBER_OF_CORES > 1 */
+
+/* On single core targets a held mutex can never be released concurrently,
+ * so spinning degenerates to a regular take. */
+    #define xSemaphoreTakeAdaptive( xMutex, xBlockTime, uxMaxSpins )    xSemaphoreTake( ( xMutex ), ( xBlockTime ) )
+
+#endif /* configNUMBER_OF_CORES > 1 */
+
 /* -------------------------------------------- Creation With Memory Caps ----------------------------------------------
  * Helper functions to create various FreeRTOS objects (e.g., queues, semaphores) with specific memory capabilities
  * (e.g., MALLOC_CAP_INTERNAL).
@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * Zero-copy stream pipe
+ *
+ * A stream pipe is an ESP-IDF specific, fixed-frame-size ring of buffers for
+ * single-producer single-consumer streaming, designed for data paths where a
+ * DMA engine fills or drains the frames. Unlike FreeRTOS stream buffers
+ * (xStreamBufferSend()/xStreamBufferReceive()), which copy on both ends, the
+ * pipe hands out pointers into its internal storage:
+ *
+ * - The producer reserves a frame (pvStreamPipeReserve()), lets the DMA or
+ *   CPU fill it in place, then commits it (xStreamPipeCommit()).
+ * - The consumer peeks the oldest committed frame (pvStreamPipePeek()),
+ *   processes it in place, then consumes it (xStreamPipeConsume()).
+ *
+ * Frames are allocated with caller-provided heap capabilities and alignment,
+ * so each frame can satisfy DMA and cache-line requirements (see
+ * esp_cache_get_alignment()). Blocked tasks are woken with direct task
+ * notifications (the default notification index), so tasks calling the
+ * blocking APIs must not use that index for anything else.
+ *
+ * The pipe is safe for one producer and one consumer running concurrently;
+ * multiple producers or consumers require external locking.
+ */
+
+typedef struct StreamPipeDef_t * StreamPipeHandle_t;
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+/**
+ * @brief Create a stream pipe with specific memory capabilities for its frames
+ *
+ * @param xFrameSizeBytes Usable size of each frame in bytes
+ * @param xFrameCount Number of frames in the pipe
+ * @param xAlignment Start address alignment of each frame, in bytes. Must be
+ * a power of 2. Pass the data cache line size to make frames suitable for
+ * DMA on cached memory, or 0 for the default (4 bytes).
+ * @param uxMemoryCaps Memory capabilities of the frame storage (MALLOC_CAP_*)
+ * @return Handle to the created stream pipe, or NULL on failure
+ */
+StreamPipeHandle_t xStreamPipeCreateWithCaps( size_t xFrameSizeBytes,
+                                              size_t xFrameCount,
+                                              size_t xAlignment,
+                                              UBaseType_t uxMemoryCaps );
+
+/**
+ * @brief Delete a stream pipe previously created with xStreamPipeCreateWithCaps()
+ *
+ * The pipe must not be deleted while a task is blocked on it.
+ *
+ * @param xStreamPipe Stream pipe handle
+ */
+void vStreamPipeDelete( StreamPipeHandle_t xStreamPipe );
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+/**
+ * @brief Reserve the next free frame for filling
+ *
+ * The returned pointer stays owned by the caller until the frame is committed
+ * with xStreamPipeCommit(); it can be handed to a DMA engine for in-place
+ * fill. Only one frame can be reserved at a time.
+ *
+ * @param xStreamPipe Stream pipe handle
+ * @param xTicksToWait Maximum time to wait for a free frame
+ * @return Pointer to the frame to fill, or NULL on timeout (or if a frame is
+ * already reserved)
+ */
+void * pvStreamPipeReserve( StreamPipeHandle_t xStreamPipe,
+                            TickType_t xTicksToWait );
+
+/**
+ * @brief Reserve the next free frame from an ISR
+ *
+ * Same as pvStreamPipeReserve() but never blocks.
+ *
+ * @param xStreamPipe Stream pipe handle
+ * @return Pointer to the frame to fill, or NULL if no frame is free (or if a
+ * frame is already reserved)
+ */
+void * pvStreamPipeReserveFromISR( StreamPipeHandle_t xStreamPipe );
+
+/**
+ * @brief Commit the currently reserved frame, making it visible to the consumer
+ *
+ * Wakes the consumer if it is blocked in pvStreamPipePeek().
+ *
+ * @param xStreamPipe Stream pipe handle
+ * @param xLengthBytes Number of valid bytes in the frame, at most the frame size
+ * @return pdTRUE on success, pdFALSE if no frame is reserved or the length
+ * exceeds the frame size
+ */
+BaseType_t xStreamPipeCommit( StreamPipeHandle_t xStreamPipe,
+                              size_t xLengthBytes );
+
+/**
+ * @brief Commit the currently reserved frame from an ISR
+ *
+ * Typically called from a DMA completion interrupt.
+ *
+ * @param xStreamPipe Stream pipe handle
+ * @param xLengthBytes Number of valid bytes in the frame, at most the frame size
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if committing unblocked a
+ * task of higher priority than the interrupted one. Can be NULL.
+ * @return pdTRUE on success, pdFALSE if no frame is reserved or the length
+ * exceeds the frame size
+ */
+BaseType_t xStreamPipeCommitFromISR( StreamPipeHandle_t xStreamPipe,
+                                     size_t xLengthBytes,
+                                     BaseType_t * pxHigherPriorityTaskWoken );
+
+/**
+ * @brief Peek the oldest committed frame without removing it
+ *
+ * The returned pointer stays valid until xStreamPipeConsume() is called. A
+ * repeated peek before consuming returns the same frame.
+ *
+ * @param xStreamPipe Stream pipe handle
+ * @param[out] pxLengthBytes Returned number of valid bytes in the frame. Can be NULL.
+ * @param xTicksToWait Maximum time to wait for a committed frame
+ * @return Pointer to the frame data, or NULL on timeout
+ */
+const void * pvStreamPipePeek( StreamPipeHandle_t xStreamPipe,
+                               size_t * pxLengthBytes,
+                               TickType_t xTicksToWait );
+
+/**
+ * @brief Release the oldest committed frame, returning it to the free pool
+ *
+ * Wakes the producer if it is blocked in pvStreamPipeReserve().
+ *
+ * @param xStreamPipe Stream pipe handle
+ * @return pdTRUE on success, pdFALSE if there is no committed frame
+ */
+BaseType_t xStreamPipeConsume( StreamPipeHandle_t xStreamPipe );
+
+/**
+ * @brief Get the number of committed frames waiting to be consumed
+ *
+ * @param xStreamPipe Stream pipe handle
+ * @return Number of frames that can be peeked/consumed
+ */
+size_t uxStreamPipeFramesReady( StreamPipeHandle_t xStreamPipe );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
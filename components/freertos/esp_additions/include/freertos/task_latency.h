@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/*
+ * This header contains the public API of the scheduler latency instrumentation
+ * (CONFIG_FREERTOS_TASK_LATENCY_HISTOGRAM). The kernel trace hooks timestamp
+ * each task when it becomes ready and when it is switched in, and maintain a
+ * per-task histogram of the ready-to-running latency.
+ */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#if CONFIG_FREERTOS_TASK_LATENCY_HISTOGRAM || __DOXYGEN__
+
+/**
+ * @brief Number of histogram buckets
+ *
+ * Bucket n counts latencies in [2^n, 2^(n+1)) microseconds; bucket 0 also
+ * includes sub-microsecond samples and the last bucket saturates.
+ */
+#define TASK_LATENCY_BUCKET_NUM    16
+
+/**
+ * @brief Scheduler latency statistics of one task
+ *
+ * Only the ready-after-blocking to running transition is measured; time slices
+ * where a preempted task resumes without having blocked are not sampled.
+ */
+typedef struct xTASK_LATENCY_STATS
+{
+    TaskHandle_t xTask;                                /*!< Handle of the measured task */
+    const char * pcTaskName;                           /*!< Name of the measured task */
+    uint32_t ulSampleCount;                            /*!< Number of latency samples recorded */
+    uint32_t ulBucketCounts[ TASK_LATENCY_BUCKET_NUM ]; /*!< Log-scale latency histogram */
+    uint64_t ullMaxLatencyUs;                          /*!< Worst-case latency observed, in microseconds */
+    TaskHandle_t xMaxPreemptingTask;                   /*!< Task that was running when the worst case ended, NULL if unknown or deleted */
+} TaskLatencyStats_t;
+
+/**
+ * @brief Get the latency statistics of every measured task
+ *
+ * @param pxStatsArray Array to fill with per-task statistics
+ * @param uxArraySize Capacity of pxStatsArray
+ *
+ * @return Number of entries written to pxStatsArray
+ */
+UBaseType_t uxTaskLatencyGetStatsAll( TaskLatencyStats_t * pxStatsArray,
+                                      UBaseType_t uxArraySize );
+
+/**
+ * @brief Get the latency statistics of one task
+ *
+ * @param xTask Handle of the task, NULL for the calling task
+ * @param pxStats Filled with the task's statistics
+ *
+ * @return pdTRUE if the task has been measured, pdFALSE otherwise
+ */
+BaseType_t xTaskLatencyGetStats( TaskHandle_t xTask,
+                                 TaskLatencyStats_t * pxStats );
+
+/**
+ * @brief Reset all collected latency statistics
+ *
+ * Also frees the tracking slots of deleted tasks.
+ */
+void vTaskLatencyReset( void );
+
+/**
+ * @brief Print the latency histograms of all measured tasks to stdout
+ *
+ * One line per task with sample count, worst-case latency, the task that was
+ * running when the worst case ended and the histogram buckets. Intended to be
+ * called from a console command.
+ */
+void vTaskLatencyDump( void );
+
+#endif /* CONFIG_FREERTOS_TASK_LATENCY_HISTOGRAM || __DOXYGEN__ */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
@@ -0,0 +1,269 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/task_latency.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+
+/*
+ * Scheduler latency instrumentation. The trace hooks below are wired into
+ * traceMOVED_TASK_TO_READY_STATE / traceTASK_SWITCHED_OUT /
+ * traceTASK_SWITCHED_IN by FreeRTOSConfig.h and run inside kernel critical
+ * sections, possibly from ISRs, so they are kept in IRAM and only touch the
+ * statically allocated slot table under a dedicated spinlock.
+ */
+
+typedef struct
+{
+    TaskHandle_t xTask;                                  /* NULL marks a free slot */
+    int64_t llReadyAtUs;                                 /* 0 when no measurement is pending */
+    uint32_t ulSampleCount;
+    uint32_t ulBucketCounts[ TASK_LATENCY_BUCKET_NUM ];
+    uint64_t ullMaxLatencyUs;
+    TaskHandle_t xMaxPreemptingTask;
+} task_latency_slot_t;
+
+static task_latency_slot_t s_slots[ CONFIG_FREERTOS_TASK_LATENCY_MAX_TASKS ];
+static TaskHandle_t s_prev_task[ configNUMBER_OF_CORES ];
+static uint32_t s_dropped_samples;                       /* ready events with no free slot left */
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* called with s_lock held */
+static task_latency_slot_t * IRAM_ATTR prvFindSlot( TaskHandle_t xTask,
+                                                    BaseType_t xCreate )
+{
+    task_latency_slot_t * pxFree = NULL;
+
+    for( int i = 0; i < CONFIG_FREERTOS_TASK_LATENCY_MAX_TASKS; i++ )
+    {
+        if( s_slots[ i ].xTask == xTask )
+        {
+            return &s_slots[ i ];
+        }
+
+        if( ( s_slots[ i ].xTask == NULL ) && ( pxFree == NULL ) )
+        {
+            pxFree = &s_slots[ i ];
+        }
+    }
+
+    if( ( xCreate == pdTRUE ) && ( pxFree != NULL ) )
+    {
+        pxFree->xTask = xTask;
+        return pxFree;
+    }
+
+    return NULL;
+}
+
+void IRAM_ATTR vTaskLatencyTaskReady( void * pxTCB )
+{
+    int64_t llNowUs = esp_timer_get_time();
+
+    portENTER_CRITICAL_SAFE( &s_lock );
+    task_latency_slot_t * pxSlot = prvFindSlot( ( TaskHandle_t ) pxTCB, pdTRUE );
+
+    if( pxSlot != NULL )
+    {
+        pxSlot->llReadyAtUs = llNowUs;
+    }
+    else
+    {
+        s_dropped_samples++;
+    }
+
+    portEXIT_CRITICAL_SAFE( &s_lock );
+}
+
+void IRAM_ATTR vTaskLatencyTaskSwitchedOut( void )
+{
+    s_prev_task[ esp_cpu_get_core_id() ] = xTaskGetCurrentTaskHandle();
+}
+
+void IRAM_ATTR vTaskLatencyTaskSwitchedIn( void )
+{
+    TaskHandle_t xTask = xTaskGetCurrentTaskHandle();
+    int64_t llNowUs = esp_timer_get_time();
+
+    portENTER_CRITICAL_SAFE( &s_lock );
+    task_latency_slot_t * pxSlot = prvFindSlot( xTask, pdFALSE );
+
+    if( ( pxSlot != NULL ) && ( pxSlot->llReadyAtUs != 0 ) )
+    {
+        uint64_t ullLatencyUs = 0;
+
+        if( llNowUs > pxSlot->llReadyAtUs )
+        {
+            ullLatencyUs = ( uint64_t ) ( llNowUs - pxSlot->llReadyAtUs );
+        }
+
+        int iBucket = ( ullLatencyUs == 0 ) ? 0 : ( 63 - __builtin_clzll( ullLatencyUs ) );
+
+        if( iBucket >= TASK_LATENCY_BUCKET_NUM )
+        {
+            iBucket = TASK_LATENCY_BUCKET_NUM - 1;
+        }
+
+        pxSlot->ulBucketCounts[ iBucket ]++;
+        pxSlot->ulSampleCount++;
+
+        if( ullLatencyUs > pxSlot->ullMaxLatencyUs )
+        {
+            pxSlot->ullMaxLatencyUs = ullLatencyUs;
+            pxSlot->xMaxPreemptingTask = s_prev_task[ esp_cpu_get_core_id() ];
+        }
+
+        pxSlot->llReadyAtUs = 0;
+    }
+
+    portEXIT_CRITICAL_SAFE( &s_lock );
+}
+
+static void prvCopySlotStats( const task_latency_slot_t * pxSlot,
+                              TaskLatencyStats_t * pxStats )
+{
+    pxStats->xTask = pxSlot->xTask;
+    pxStats->pcTaskName = NULL;
+    pxStats->ulSampleCount = pxSlot->ulSampleCount;
+    memcpy( pxStats->ulBucketCounts, pxSlot->ulBucketCounts, sizeof( pxStats->ulBucketCounts ) );
+    pxStats->ullMaxLatencyUs = pxSlot->ullMaxLatencyUs;
+    pxStats->xMaxPreemptingTask = pxSlot->xMaxPreemptingTask;
+}
+
+UBaseType_t uxTaskLatencyGetStatsAll( TaskLatencyStats_t * pxStatsArray,
+                                      UBaseType_t uxArraySize )
+{
+    UBaseType_t uxNum = 0;
+
+    if( pxStatsArray == NULL )
+    {
+        return 0;
+    }
+
+    portENTER_CRITICAL( &s_lock );
+
+    for( int i = 0; ( i < CONFIG_FREERTOS_TASK_LATENCY_MAX_TASKS ) && ( uxNum < uxArraySize ); i++ )
+    {
+        if( s_slots[ i ].xTask != NULL )
+        {
+            prvCopySlotStats( &s_slots[ i ], &pxStatsArray[ uxNum ] );
+            uxNum++;
+        }
+    }
+
+    portEXIT_CRITICAL( &s_lock );
+
+    /* Resolve the names outside the critical section; the handles stay valid
+     * as long as the tasks are not deleted */
+    for( UBaseType_t i = 0; i < uxNum; i++ )
+    {
+        pxStatsArray[ i ].pcTaskName = pcTaskGetName( pxStatsArray[ i ].xTask );
+    }
+
+    return uxNum;
+}
+
+BaseType_t xTaskLatencyGetStats( TaskHandle_t xTask,
+                                 TaskLatencyStats_t * pxStats )
+{
+    BaseType_t xFound = pdFALSE;
+
+    if( pxStats == NULL )
+    {
+        return pdFALSE;
+    }
+
+    if( xTask == NULL )
+    {
+        xTask = xTaskGetCurrentTaskHandle();
+    }
+
+    portENTER_CRITICAL( &s_lock );
+    task_latency_slot_t * pxSlot = prvFindSlot( xTask, pdFALSE );
+
+    if( pxSlot != NULL )
+    {
+        prvCopySlotStats( pxSlot, pxStats );
+        xFound = pdTRUE;
+    }
+
+    portEXIT_CRITICAL( &s_lock );
+
+    if( xFound == pdTRUE )
+    {
+        pxStats->pcTaskName = pcTaskGetName( xTask );
+    }
+
+    return xFound;
+}
+
+void vTaskLatencyReset( void )
+{
+    portENTER_CRITICAL( &s_lock );
+    memset( s_slots, 0, sizeof( s_slots ) );
+    s_dropped_samples = 0;
+    portEXIT_CRITICAL( &s_lock );
+}
+
+void vTaskLatencyDump( void )
+{
+    TaskLatencyStats_t * pxStats = calloc( CONFIG_FREERTOS_TASK_LATENCY_MAX_TASKS, sizeof( TaskLatencyStats_t ) );
+
+    if( pxStats == NULL )
+    {
+        printf( "task latency dump: no memory\n" );
+        return;
+    }
+
+    UBaseType_t uxNum = uxTaskLatencyGetStatsAll( pxStats, CONFIG_FREERTOS_TASK_LATENCY_MAX_TASKS );
+
+    printf( "%-*s %10s %10s %-*s  buckets (1us, 2us, 4us, ... log2 scale)\n",
+            configMAX_TASK_NAME_LEN, "Task", "Samples", "Max(us)",
+            configMAX_TASK_NAME_LEN, "Max ended by" );
+
+    for( UBaseType_t i = 0; i < uxNum; i++ )
+    {
+        const char * pcPreemptor = "-";
+
+        /* the worst-case preemptor may have been deleted meanwhile, only
+         * resolve handles that are still tracked */
+        for( UBaseType_t j = 0; j < uxNum; j++ )
+        {
+            if( ( pxStats[ i ].xMaxPreemptingTask != NULL ) &&
+                ( pxStats[ j ].xTask == pxStats[ i ].xMaxPreemptingTask ) )
+            {
+                pcPreemptor = pxStats[ j ].pcTaskName;
+                break;
+            }
+        }
+
+        printf( "%-*s %10" PRIu32 " %10" PRIu64 " %-*s ",
+                configMAX_TASK_NAME_LEN, pxStats[ i ].pcTaskName,
+                pxStats[ i ].ulSampleCount, pxStats[ i ].ullMaxLatencyUs,
+                configMAX_TASK_NAME_LEN, pcPreemptor );
+
+        for( int b = 0; b < TASK_LATENCY_BUCKET_NUM; b++ )
+        {
+            printf( " %" PRIu32, pxStats[ i ].ulBucketCounts[ b ] );
+        }
+
+        printf( "\n" );
+    }
+
+    if( s_dropped_samples != 0 )
+    {
+        printf( "dropped samples (increase FREERTOS_TASK_LATENCY_MAX_TASKS): %" PRIu32 "\n", s_dropped_samples );
+    }
+
+    free( pxStats );
+}
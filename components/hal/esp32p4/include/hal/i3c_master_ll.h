@@ -29,6 +29,7 @@ extern "C" {
 #define I3C_LL_MASTER_DATA_BUFFER_SIZE       (128) // The TX Data Buffer and the RX Data Buffer can store up to 128 bytes at a time
 #define I3C_LL_MASTER_TRANSMIT_EVENT_INTR    (I3C_MST_TX_DATA_BUF_THLD_INT_ENA_M | I3C_MST_TRANSFER_COMPLETE_INT_ENA_M | I3C_MST_COMMAND_DONE_INT_ENA_M)
 #define I3C_LL_MASTER_RECEIVE_EVENT_INTR     (I3C_MST_RX_DATA_BUF_THLD_INT_ENA_M | I3C_MST_TRANSFER_COMPLETE_INT_ENA_M | I3C_MST_COMMAND_DONE_INT_ENA_M)
+#define I3C_LL_MASTER_IBI_EVENT_INTR         (I3C_MST_IBI_DETECT_INT_ENA_M)
 #define I3C_MASTER_LL_DEFAULT_SETUP_TIME     (600)
 
 /**
@@ -208,6 +209,23 @@ typedef union {
     uint32_t val;
 } i3c_master_ll_response_descriptor_t;
 
+/**
+ * @brief I3C master IBI status data
+ *
+ * Every In-Band Interrupt received by the controller pushes one status entry
+ * into the IBI buffer. This union represents a single entry of that buffer.
+ */
+typedef union {
+    struct {
+        uint32_t data_length : 8;  ///< Length of the data received along with the IBI, in bytes.
+        uint32_t ibi_id      : 8;  ///< IBI identifier, the byte received after START: device address and the R/W bit.
+        uint32_t reserved16  : 12;
+        uint32_t ibi_sts     : 1;  ///< Indicates how the controller responded to the incoming IBI (SIR, MR and HJ).
+        uint32_t reserved29  : 3;
+    };
+    uint32_t val;
+} i3c_master_ll_ibi_status_descriptor_t;
+
 /**
  * @brief I3C master operating mode
  *
@@ -735,6 +753,53 @@ static inline i3c_master_ll_response_descriptor_t i3c_master_ll_get_response_dat
     return (i3c_master_ll_response_descriptor_t)(I3C_MST_MEM.response_buf_port.val);
 }
 
+/**
+ * @brief Set the response for incoming Slave Interrupt Requests, device by device
+ *
+ * @param dev I3C master hardware instance
+ * @param reject_bitmap Bitmap of the rejected devices. 0: ACK the SIR request, 1: NACK and send direct auto disable CCC
+ */
+static inline void i3c_master_ll_set_ibi_sir_reject(i3c_mst_dev_t *dev, uint32_t reject_bitmap)
+{
+    dev->ibi_sir_req_reject.reg_sir_req_reject = reject_bitmap;
+}
+
+/**
+ * @brief Get the number of valid status entries in the IBI buffer
+ *
+ * @param dev I3C master hardware instance
+ * @return IBI status entry count
+ */
+__attribute__((always_inline))
+static inline uint8_t i3c_master_ll_get_ibi_status_count(i3c_mst_dev_t *dev)
+{
+    return dev->buffer_status_level.ibi_status_buf_cnt;
+}
+
+/**
+ * @brief Pop one status entry from the IBI buffer
+ *
+ * @param dev I3C master hardware instance
+ * @return IBI status data
+ */
+__attribute__((always_inline))
+static inline i3c_master_ll_ibi_status_descriptor_t i3c_master_ll_get_ibi_status(i3c_mst_dev_t *dev)
+{
+    return (i3c_master_ll_ibi_status_descriptor_t)(I3C_MST_MEM.ibi_status_buf.val);
+}
+
+/**
+ * @brief Pop one data word from the IBI buffer
+ *
+ * @param dev I3C master hardware instance
+ * @return IBI payload data, packed in 4-byte units
+ */
+__attribute__((always_inline))
+static inline uint32_t i3c_master_ll_get_ibi_data(i3c_mst_dev_t *dev)
+{
+    return I3C_MST_MEM.ibi_data_buf.ibi_data;
+}
+
 /**
  * @brief Set the init value of dct_index, which points to the entry in the DCT table
  *
@@ -81,7 +81,15 @@ Routine to allocate a bit of memory with certain capabilities. caps is a bitfiel
 */
 HEAP_IRAM_ATTR void *heap_caps_malloc( size_t size, uint32_t caps)
 {
+#if CONFIG_HEAP_PER_TASK_CACHE
+    void* ptr = heap_caps_task_cache_try_alloc(size, caps);
+    if (ptr != NULL) {
+        return ptr;
+    }
+    ptr = heap_caps_malloc_base(size, caps);
+#else
     void* ptr = heap_caps_malloc_base(size, caps);
+#endif
 
 
     if (!ptr && size > 0){
@@ -111,6 +119,12 @@ void heap_caps_malloc_extmem_enable(size_t limit)
 */
 HEAP_IRAM_ATTR void *heap_caps_malloc_default( size_t size )
 {
+#if CONFIG_HEAP_PLACEMENT_POLICY
+    void *policy_ptr;
+    if (heap_caps_policy_try_alloc(size, &policy_ptr)) {
+        return policy_ptr;
+    }
+#endif
     if (malloc_alwaysinternal_limit==MALLOC_DISABLE_EXTERNAL_ALLOCS) {
         return heap_caps_malloc( size, MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL);
     } else {
@@ -144,6 +158,12 @@ HEAP_IRAM_ATTR void *heap_caps_malloc_default( size_t size )
  */
 HEAP_IRAM_ATTR void *heap_caps_realloc_default( void *ptr, size_t size )
 {
+#if CONFIG_HEAP_PLACEMENT_POLICY
+    void *policy_ptr;
+    if (heap_caps_policy_try_realloc(ptr, size, &policy_ptr)) {
+        return policy_ptr;
+    }
+#endif
     if (malloc_alwaysinternal_limit==MALLOC_DISABLE_EXTERNAL_ALLOCS) {
         return heap_caps_realloc( ptr, size, MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL );
     } else {
@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_heap_caps.h"
+
+/*
+Region/arena allocator on top of heap_caps.
+
+An arena owns one or more blocks obtained from heap_caps_malloc and serves
+allocations by bumping an offset inside the current block, so an allocation is
+a couple of additions and no heap lock is taken. Nothing is freed individually:
+heap_caps_arena_reset() drops every allocation at once by rewinding the first
+block and returning the overflow blocks to the heap, which makes the
+alloc-many/free-all pattern of request-scoped workloads O(1) instead of one
+TLSF free per allocation.
+
+An arena is meant to be owned by a single task (e.g. one per request context);
+the functions are not thread safe.
+*/
+
+// Every allocation is aligned to this, matching the guarantee of heap_caps_malloc
+#define ARENA_ALIGNMENT   sizeof(max_align_t)
+
+#define ARENA_ALIGN_UP(num, align)   (((num) + ((align) - 1)) & ~((align) - 1))
+
+/// One backing block; overflow blocks are chained off the first (static) one
+typedef struct heap_caps_arena_block {
+    struct heap_caps_arena_block *next;   // next (older) overflow block, NULL on the first block
+    size_t size;                          // usable bytes following this header
+    size_t used;                          // bump offset into the usable bytes
+    // usable bytes follow immediately, allocations are aligned relative to their address
+} heap_caps_arena_block_t;
+
+typedef struct heap_caps_arena {
+    uint32_t caps;                        // capabilities the backing blocks are allocated with
+    size_t block_size;                    // usable size of the first block, also the growth step
+    heap_caps_arena_block_t *cur;         // block currently bumped, head of the block chain
+    heap_caps_arena_block_t first;        // first block, allocated together with this header
+} heap_caps_arena_t;
+
+static inline uint8_t *arena_block_data(heap_caps_arena_block_t *block)
+{
+    return (uint8_t *)(block + 1);
+}
+
+heap_caps_arena_handle_t heap_caps_arena_create(size_t size, uint32_t caps)
+{
+    if (size == 0) {
+        return NULL;
+    }
+
+    size = ARENA_ALIGN_UP(size, ARENA_ALIGNMENT);
+
+    heap_caps_arena_t *arena = heap_caps_malloc(sizeof(heap_caps_arena_t) + size, caps);
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    arena->caps = caps;
+    arena->block_size = size;
+    arena->first.next = NULL;
+    arena->first.size = size;
+    arena->first.used = 0;
+    arena->cur = &arena->first;
+    return arena;
+}
+
+void *heap_caps_arena_aligned_alloc(heap_caps_arena_handle_t arena, size_t alignment, size_t size)
+{
+    if (arena == NULL || size == 0 || alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return NULL;
+    }
+
+    heap_caps_arena_block_t *block = arena->cur;
+    uintptr_t base = (uintptr_t)arena_block_data(block);
+    size_t offset = ARENA_ALIGN_UP(base + block->used, alignment) - base;
+
+    if (offset + size > block->size) {
+        // Current block exhausted: grow by one block, large requests get a block of their own
+        size_t block_size = size + alignment > arena->block_size ? size + alignment : arena->block_size;
+        heap_caps_arena_block_t *grown = heap_caps_malloc(sizeof(heap_caps_arena_block_t) + block_size, arena->caps);
+        if (grown == NULL) {
+            return NULL;
+        }
+        grown->next = block;
+        grown->size = block_size;
+        grown->used = 0;
+        arena->cur = grown;
+
+        block = grown;
+        base = (uintptr_t)arena_block_data(block);
+        offset = ARENA_ALIGN_UP(base, alignment) - base;
+    }
+
+    block->used = offset + size;
+    return (void *)(base + offset);
+}
+
+void *heap_caps_arena_alloc(heap_caps_arena_handle_t arena, size_t size)
+{
+    return heap_caps_arena_aligned_alloc(arena, ARENA_ALIGNMENT, size);
+}
+
+void *heap_caps_arena_calloc(heap_caps_arena_handle_t arena, size_t n, size_t size)
+{
+    size_t size_bytes;
+    if (__builtin_mul_overflow(n, size, &size_bytes)) {
+        return NULL;
+    }
+
+    void *ptr = heap_caps_arena_alloc(arena, size_bytes);
+    if (ptr != NULL) {
+        memset(ptr, 0, size_bytes);
+    }
+    return ptr;
+}
+
+bool heap_caps_arena_contains(heap_caps_arena_handle_t arena, const void *ptr)
+{
+    if (arena == NULL || ptr == NULL) {
+        return false;
+    }
+
+    for (heap_caps_arena_block_t *block = arena->cur; block != NULL; block = block->next) {
+        uint8_t *data = arena_block_data(block);
+        if ((const uint8_t *)ptr >= data && (const uint8_t *)ptr < data + block->size) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void heap_caps_arena_reset(heap_caps_arena_handle_t arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+
+    // Return the overflow blocks to the heap and rewind the first block. When the
+    // allocations fitted into the first block this frees nothing and takes no lock.
+    heap_caps_arena_block_t *block = arena->cur;
+    while (block != &arena->first) {
+        heap_caps_arena_block_t *next = block->next;
+        heap_caps_free(block);
+        block = next;
+    }
+
+    arena->first.used = 0;
+    arena->cur = &arena->first;
+}
+
+void heap_caps_arena_destroy(heap_caps_arena_handle_t arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+
+    heap_caps_arena_reset(arena);
+    heap_caps_free(arena);
+}
@@ -61,12 +61,32 @@ HEAP_IRAM_ATTR static void *dram_alloc_to_iram_addr(void *addr, size_t len)
     return iptr + 1;
 }
 
+#if CONFIG_HEAP_PER_TASK_CACHE
 HEAP_IRAM_ATTR void heap_caps_free( void *ptr)
 {
     if (ptr == NULL) {
         return;
     }
 
+    // Try to park the block in the per-task cache first; blocks the cache
+    // doesn't take (wrong size/memory type, cache full, ISR context) are
+    // returned to their heap as usual.
+    if (heap_caps_task_cache_try_free(ptr)) {
+        return;
+    }
+
+    heap_caps_free_base(ptr);
+}
+
+HEAP_IRAM_ATTR void heap_caps_free_base( void *ptr)
+#else
+HEAP_IRAM_ATTR void heap_caps_free( void *ptr)
+#endif
+{
+    if (ptr == NULL) {
+        return;
+    }
+
     if ((!esp_dram_match_iram() && esp_ptr_in_diram_iram(ptr)) ||
         (!esp_rtc_dram_match_rtc_iram() && esp_ptr_in_rtc_iram_fast(ptr))) {
         //Memory allocated here is actually allocated in the DRAM alias region and
@@ -0,0 +1,231 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_heap_caps_policy.h"
+#include "heap_private.h"
+
+/*
+Allocation placement policy engine.
+
+Default allocations (malloc/realloc resolve to heap_caps_malloc_default and
+heap_caps_realloc_default) are matched against an ordered rule table before
+the global fallback order is applied. A rule selects allocations by the
+calling task name and a size class and redirects them to a priority list of
+capability sets, so e.g. lwip pbufs can be pinned internal and a JSON parser
+pushed to PSRAM without touching the calling code. Rules can be installed at
+build time through the weak heap_caps_policy_default_rules table or at
+runtime, and every rule keeps hit/miss/byte counters for tuning.
+*/
+
+typedef struct {
+    heap_caps_policy_rule_t rule;
+    heap_caps_policy_rule_stats_t stats;
+} policy_entry_t;
+
+static policy_entry_t s_policy_rules[CONFIG_HEAP_PLACEMENT_POLICY_MAX_RULES];
+static size_t s_policy_rule_count;
+static bool s_policy_defaults_loaded;
+static portMUX_TYPE s_policy_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* Empty build-time rule table, overridden by defining the symbols strongly
+ * in the application */
+const heap_caps_policy_rule_t __attribute__((weak)) heap_caps_policy_default_rules[] = {};
+const size_t __attribute__((weak)) heap_caps_policy_default_rule_count = 0;
+
+/* called with the lock held */
+static void policy_load_defaults(void)
+{
+    if (s_policy_defaults_loaded) {
+        return;
+    }
+    s_policy_defaults_loaded = true;
+    for (size_t i = 0; i < heap_caps_policy_default_rule_count &&
+            s_policy_rule_count < CONFIG_HEAP_PLACEMENT_POLICY_MAX_RULES; i++) {
+        s_policy_rules[s_policy_rule_count++].rule = heap_caps_policy_default_rules[i];
+    }
+}
+
+HEAP_IRAM_ATTR static bool policy_rule_matches(const heap_caps_policy_rule_t *rule,
+                                               const char *task_name, size_t size)
+{
+    if (size < rule->min_size || (rule->max_size != 0 && size > rule->max_size)) {
+        return false;
+    }
+    if (rule->task_name == NULL || rule->task_name[0] == '\0') {
+        return true;
+    }
+    if (task_name == NULL) {
+        return false;
+    }
+    return strncmp(task_name, rule->task_name, strlen(rule->task_name)) == 0;
+}
+
+HEAP_IRAM_ATTR bool heap_caps_policy_try_alloc(size_t size, void **out)
+{
+    const char *task_name = NULL;
+
+    if (s_policy_rule_count == 0 && s_policy_defaults_loaded) {
+        return false;
+    }
+    if (!xPortInIsrContext() && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+        task_name = pcTaskGetName(NULL);
+    }
+
+    portENTER_CRITICAL_SAFE(&s_policy_lock);
+    policy_load_defaults();
+    policy_entry_t *match = NULL;
+    for (size_t i = 0; i < s_policy_rule_count; i++) {
+        if (policy_rule_matches(&s_policy_rules[i].rule, task_name, size)) {
+            match = &s_policy_rules[i];
+            break;
+        }
+    }
+    portEXIT_CRITICAL_SAFE(&s_policy_lock);
+    if (match == NULL) {
+        return false;
+    }
+
+    void *ptr = NULL;
+    for (int p = 0; p < HEAP_POLICY_CAPS_PRIO_NUM && match->rule.caps[p] != 0; p++) {
+        ptr = heap_caps_malloc_base(size, match->rule.caps[p]);
+        if (ptr != NULL) {
+            break;
+        }
+    }
+
+    portENTER_CRITICAL_SAFE(&s_policy_lock);
+    if (ptr != NULL) {
+        match->stats.hits++;
+        match->stats.bytes_served += size;
+    } else {
+        match->stats.misses++;
+    }
+    portEXIT_CRITICAL_SAFE(&s_policy_lock);
+
+    if (ptr == NULL) {
+        /* matched but could not be served, let the caller fall back to the
+         * global default order */
+        return false;
+    }
+    *out = ptr;
+    return true;
+}
+
+HEAP_IRAM_ATTR bool heap_caps_policy_try_realloc(void *old, size_t size, void **out)
+{
+    /* reallocations follow the same rules; heap_caps_realloc_base moves the
+     * data when the selected capability set requires a different heap */
+    const char *task_name = NULL;
+
+    if (s_policy_rule_count == 0 && s_policy_defaults_loaded) {
+        return false;
+    }
+    if (!xPortInIsrContext() && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+        task_name = pcTaskGetName(NULL);
+    }
+
+    portENTER_CRITICAL_SAFE(&s_policy_lock);
+    policy_load_defaults();
+    policy_entry_t *match = NULL;
+    for (size_t i = 0; i < s_policy_rule_count; i++) {
+        if (policy_rule_matches(&s_policy_rules[i].rule, task_name, size)) {
+            match = &s_policy_rules[i];
+            break;
+        }
+    }
+    portEXIT_CRITICAL_SAFE(&s_policy_lock);
+    if (match == NULL) {
+        return false;
+    }
+
+    void *ptr = NULL;
+    for (int p = 0; p < HEAP_POLICY_CAPS_PRIO_NUM && match->rule.caps[p] != 0; p++) {
+        ptr = heap_caps_realloc_base(old, size, match->rule.caps[p]);
+        if (ptr != NULL) {
+            break;
+        }
+    }
+
+    portENTER_CRITICAL_SAFE(&s_policy_lock);
+    if (ptr != NULL) {
+        match->stats.hits++;
+        match->stats.bytes_served += size;
+    } else {
+        match->stats.misses++;
+    }
+    portEXIT_CRITICAL_SAFE(&s_policy_lock);
+
+    if (ptr == NULL) {
+        return false;
+    }
+    *out = ptr;
+    return true;
+}
+
+esp_err_t heap_caps_policy_add_rule(const heap_caps_policy_rule_t *rule)
+{
+    if (rule == NULL || rule->caps[0] == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t err = ESP_OK;
+    portENTER_CRITICAL(&s_policy_lock);
+    policy_load_defaults();
+    if (s_policy_rule_count >= CONFIG_HEAP_PLACEMENT_POLICY_MAX_RULES) {
+        err = ESP_ERR_NO_MEM;
+    } else {
+        /* runtime rules take precedence, insert at the head */
+        memmove(&s_policy_rules[1], &s_policy_rules[0],
+                s_policy_rule_count * sizeof(s_policy_rules[0]));
+        s_policy_rules[0].rule = *rule;
+        memset(&s_policy_rules[0].stats, 0, sizeof(s_policy_rules[0].stats));
+        s_policy_rule_count++;
+    }
+    portEXIT_CRITICAL(&s_policy_lock);
+    return err;
+}
+
+void heap_caps_policy_clear_rules(void)
+{
+    portENTER_CRITICAL(&s_policy_lock);
+    s_policy_rule_count = 0;
+    s_policy_defaults_loaded = true;
+    portEXIT_CRITICAL(&s_policy_lock);
+}
+
+size_t heap_caps_policy_get_rule_count(void)
+{
+    portENTER_CRITICAL(&s_policy_lock);
+    policy_load_defaults();
+    size_t count = s_policy_rule_count;
+    portEXIT_CRITICAL(&s_policy_lock);
+    return count;
+}
+
+esp_err_t heap_caps_policy_get_rule_stats(size_t index, heap_caps_policy_rule_t *rule,
+                                          heap_caps_policy_rule_stats_t *stats)
+{
+    esp_err_t err = ESP_OK;
+    portENTER_CRITICAL(&s_policy_lock);
+    policy_load_defaults();
+    if (index >= s_policy_rule_count) {
+        err = ESP_ERR_INVALID_ARG;
+    } else {
+        if (rule != NULL) {
+            *rule = s_policy_rules[index].rule;
+        }
+        if (stats != NULL) {
+            *stats = s_policy_rules[index].stats;
+        }
+    }
+    portEXIT_CRITICAL(&s_policy_lock);
+    return err;
+}
@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "heap_private.h"
+
+/*
+Per-task front-end cache for small allocations.
+
+Freed blocks of cacheable sizes are linked into a small per-task free list (one
+list per power-of-two size class) instead of being returned to multi_heap/TLSF
+right away. A later allocation of the same class from the same task is then
+served with a couple of loads and stores and no heap lock taken at all, which
+removes the allocator lock contention between tasks with a high alloc/free
+rate. The cache lives in a FreeRTOS thread local storage pointer and is given
+back to the heap by a TLSP deletion callback when the task is deleted.
+
+Only byte-accessible internal memory is cached, so a cached block can satisfy
+any request for MALLOC_CAP_DEFAULT / MALLOC_CAP_INTERNAL / MALLOC_CAP_8BIT.
+*/
+
+/* With TLSP deletion callbacks enabled FreeRTOS doubles its TLSP array and the
+ * set-with-callback API only accepts indices below the configured count, while
+ * pvTaskGetThreadLocalStoragePointer() accepts indices into the doubled array
+ * and would hand back a deletion callback pointer. An out-of-range index would
+ * therefore leak every "cached" free and corrupt memory on the next lookup, so
+ * reject it at build time. */
+_Static_assert(CONFIG_HEAP_PER_TASK_CACHE_TLSP_INDEX < CONFIG_FREERTOS_THREAD_LOCAL_STORAGE_POINTERS,
+               "CONFIG_HEAP_PER_TASK_CACHE_TLSP_INDEX must be less than CONFIG_FREERTOS_THREAD_LOCAL_STORAGE_POINTERS");
+
+// Size classes: 16, 32, 64, 128, 256 bytes
+#define TASK_CACHE_CLASS_COUNT  5
+#define TASK_CACHE_MIN_SHIFT    4
+#define TASK_CACHE_MIN_SIZE     (1 << TASK_CACHE_MIN_SHIFT)
+#define TASK_CACHE_MAX_SIZE     (TASK_CACHE_MIN_SIZE << (TASK_CACHE_CLASS_COUNT - 1))
+
+// Capabilities every cached block provides; requests for anything else bypass the cache
+#define TASK_CACHE_CAPS         (MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+
+typedef struct {
+    // Heads of the per-class free lists, blocks are linked through their first word
+    void *head[TASK_CACHE_CLASS_COUNT];
+    uint8_t count[TASK_CACHE_CLASS_COUNT];
+} heap_task_cache_t;
+
+// Smallest class whose size is >= size (caller guarantees size <= TASK_CACHE_MAX_SIZE)
+HEAP_IRAM_ATTR static inline int task_cache_class_ceil(size_t size)
+{
+    int cls = 0;
+    while ((size_t)(TASK_CACHE_MIN_SIZE << cls) < size) {
+        cls++;
+    }
+    return cls;
+}
+
+// Largest class whose size is <= size, or -1 when the block doesn't fit any class
+HEAP_IRAM_ATTR static inline int task_cache_class_floor(size_t size)
+{
+    if (size < TASK_CACHE_MIN_SIZE) {
+        return -1;
+    }
+    int cls = 0;
+    while (cls + 1 < TASK_CACHE_CLASS_COUNT && (size_t)(TASK_CACHE_MIN_SIZE << (cls + 1)) <= size) {
+        cls++;
+    }
+    // Don't cache blocks much larger than the class they would serve,
+    // they would only waste memory while parked in the cache
+    if (size >= (size_t)(TASK_CACHE_MIN_SIZE << (cls + 1))) {
+        return -1;
+    }
+    return cls;
+}
+
+HEAP_IRAM_ATTR static inline bool task_cache_usable(void)
+{
+    return !xPortInIsrContext() && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+}
+
+HEAP_IRAM_ATTR static void task_cache_flush(heap_task_cache_t *cache)
+{
+    for (int cls = 0; cls < TASK_CACHE_CLASS_COUNT; cls++) {
+        void *ptr = cache->head[cls];
+        while (ptr != NULL) {
+            void *next = *(void **)ptr;
+            heap_caps_free_base(ptr);
+            ptr = next;
+        }
+        cache->head[cls] = NULL;
+        cache->count[cls] = 0;
+    }
+}
+
+static void task_cache_delete_cb(int index, void *tls)
+{
+    heap_task_cache_t *cache = (heap_task_cache_t *)tls;
+    task_cache_flush(cache);
+    heap_caps_free_base(cache);
+}
+
+HEAP_IRAM_ATTR void *heap_caps_task_cache_try_alloc(size_t size, uint32_t caps)
+{
+    if ((caps & ~TASK_CACHE_CAPS) != 0 || size == 0 || size > TASK_CACHE_MAX_SIZE) {
+        return NULL;
+    }
+    if (!task_cache_usable()) {
+        return NULL;
+    }
+
+    heap_task_cache_t *cache = pvTaskGetThreadLocalStoragePointer(NULL, CONFIG_HEAP_PER_TASK_CACHE_TLSP_INDEX);
+    if (cache == NULL) {
+        return NULL;
+    }
+
+    int cls = task_cache_class_ceil(size);
+    void *ptr = cache->head[cls];
+    if (ptr == NULL) {
+        return NULL;
+    }
+    cache->head[cls] = *(void **)ptr;
+    cache->count[cls]--;
+    return ptr;
+}
+
+HEAP_IRAM_ATTR bool heap_caps_task_cache_try_free(void *ptr)
+{
+    if (!task_cache_usable()) {
+        return false;
+    }
+    // Only cache plain internal DRAM blocks: anything else (PSRAM, IRAM/D-IRAM
+    // aliases, RTC memory) has capabilities a cached block must not promise
+    if (!esp_ptr_internal(ptr) || !esp_ptr_byte_accessible(ptr)) {
+        return false;
+    }
+
+    int cls = task_cache_class_floor(heap_caps_get_allocated_size(ptr));
+    if (cls < 0) {
+        return false;
+    }
+
+    heap_task_cache_t *cache = pvTaskGetThreadLocalStoragePointer(NULL, CONFIG_HEAP_PER_TASK_CACHE_TLSP_INDEX);
+    if (cache == NULL) {
+        cache = heap_caps_malloc_base(sizeof(heap_task_cache_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (cache == NULL) {
+            return false;
+        }
+        memset(cache, 0, sizeof(*cache));
+        vTaskSetThreadLocalStoragePointerAndDelCallback(NULL, CONFIG_HEAP_PER_TASK_CACHE_TLSP_INDEX,
+                                                        cache, task_cache_delete_cb);
+    }
+
+    if (cache->count[cls] >= CONFIG_HEAP_PER_TASK_CACHE_DEPTH) {
+        return false;
+    }
+
+    *(void **)ptr = cache->head[cls];
+    cache->head[cls] = ptr;
+    cache->count[cls]++;
+    return true;
+}
+
+void heap_caps_flush_task_cache(void)
+{
+    if (!task_cache_usable()) {
+        return;
+    }
+    heap_task_cache_t *cache = pvTaskGetThreadLocalStoragePointer(NULL, CONFIG_HEAP_PER_TASK_CACHE_TLSP_INDEX);
+    if (cache != NULL) {
+        task_cache_flush(cache);
+    }
+}
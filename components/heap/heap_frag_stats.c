@@ -0,0 +1,231 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <freertos/FreeRTOS.h>
+#include "esp_heap_caps.h"
+#include "esp_heap_frag.h"
+
+/* Map a block size to its power-of-two histogram bucket. Sizes below 16
+ * bytes land in bucket 0, oversized blocks in the last bucket */
+static inline int frag_size_to_bucket(size_t size)
+{
+    if (size < 32) {
+        return 0;
+    }
+    int bucket = 31 - __builtin_clz((uint32_t)size) - 4;
+    return (bucket >= HEAP_FRAG_HIST_BUCKETS) ? HEAP_FRAG_HIST_BUCKETS - 1 : bucket;
+}
+
+static bool frag_histogram_walker(walker_heap_into_t heap_info, walker_block_info_t block_info, void *user_data)
+{
+    (void)heap_info;
+    heap_frag_histogram_t *hist = (heap_frag_histogram_t *)user_data;
+    if (!block_info.used && block_info.size > 0) {
+        hist->buckets[frag_size_to_bucket(block_info.size)]++;
+        hist->free_blocks++;
+        hist->total_free_bytes += block_info.size;
+        if (block_info.size > hist->largest_free_block) {
+            hist->largest_free_block = block_info.size;
+        }
+    }
+    return true;
+}
+
+esp_err_t heap_caps_get_frag_histogram(uint32_t caps, heap_frag_histogram_t *hist)
+{
+    if (hist == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(hist, 0, sizeof(*hist));
+    heap_caps_walk(caps, frag_histogram_walker, hist);
+    return ESP_OK;
+}
+
+void heap_caps_print_frag_histogram(uint32_t caps)
+{
+    heap_frag_histogram_t hist;
+    heap_caps_get_frag_histogram(caps, &hist);
+
+    printf("Free block histogram for capabilities 0x%08"PRIX32":\n", caps);
+    printf("  free %u blocks %u largest %u\n",
+           (unsigned)hist.total_free_bytes, (unsigned)hist.free_blocks, (unsigned)hist.largest_free_block);
+    for (int i = 0; i < HEAP_FRAG_HIST_BUCKETS; i++) {
+        if (hist.buckets[i] == 0) {
+            continue;
+        }
+        printf("  [%7u..%7u) %u\n", 1U << (i + 4), 1U << (i + 5), (unsigned)hist.buckets[i]);
+    }
+}
+
+#ifdef CONFIG_HEAP_ALLOC_SITE_LEDGER
+
+#define LEDGER_SIZE CONFIG_HEAP_ALLOC_SITE_LEDGER_SIZE
+
+typedef struct {
+    void *caller_pc;
+    uint8_t size_class;         // log2 of the class lower bound
+    uint32_t count;
+} ledger_entry_t;
+
+static ledger_entry_t s_ledger[LEDGER_SIZE];
+static uint32_t s_ledger_overflow;
+static portMUX_TYPE s_ledger_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static inline uint8_t ledger_size_class(size_t size)
+{
+    if (size < 2) {
+        return 0;
+    }
+    return (uint8_t)(31 - __builtin_clz((uint32_t)size));
+}
+
+/* Count one allocation in the (caller, size class) slot, open addressing
+ * with linear probing. Constant memory, no per-allocation records */
+static void ledger_record(void *caller, size_t size)
+{
+    uint8_t size_class = ledger_size_class(size);
+    uint32_t slot = (((uintptr_t)caller >> 2) ^ size_class) * 2654435761U % LEDGER_SIZE;
+
+    portENTER_CRITICAL_SAFE(&s_ledger_mux);
+    for (int probe = 0; probe < LEDGER_SIZE; probe++) {
+        ledger_entry_t *entry = &s_ledger[slot];
+        if (entry->caller_pc == NULL) {
+            entry->caller_pc = caller;
+            entry->size_class = size_class;
+            entry->count = 1;
+            portEXIT_CRITICAL_SAFE(&s_ledger_mux);
+            return;
+        }
+        if (entry->caller_pc == caller && entry->size_class == size_class) {
+            entry->count++;
+            portEXIT_CRITICAL_SAFE(&s_ledger_mux);
+            return;
+        }
+        slot = (slot + 1) % LEDGER_SIZE;
+    }
+    s_ledger_overflow++;
+    portEXIT_CRITICAL_SAFE(&s_ledger_mux);
+}
+
+esp_err_t heap_caps_get_alloc_sites(heap_alloc_site_record_t *records, size_t capacity, size_t *out_count)
+{
+    if (records == NULL || out_count == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t count = 0;
+    portENTER_CRITICAL_SAFE(&s_ledger_mux);
+    for (int i = 0; i < LEDGER_SIZE && count < capacity; i++) {
+        if (s_ledger[i].caller_pc == NULL) {
+            continue;
+        }
+        records[count].caller_pc = s_ledger[i].caller_pc;
+        records[count].size_class_min = (size_t)1 << s_ledger[i].size_class;
+        records[count].count = s_ledger[i].count;
+        count++;
+    }
+    portEXIT_CRITICAL_SAFE(&s_ledger_mux);
+    *out_count = count;
+    return ESP_OK;
+}
+
+void heap_caps_print_alloc_sites(void)
+{
+    printf("Allocation sites (pc size-class count):\n");
+    for (int i = 0; i < LEDGER_SIZE; i++) {
+        /* Snapshot the entry outside the critical section - the table only
+         * grows, so a torn count is the worst that can happen */
+        ledger_entry_t entry = s_ledger[i];
+        if (entry.caller_pc == NULL) {
+            continue;
+        }
+        printf("  %p %7" PRIu32 " %" PRIu32 "\n",
+               entry.caller_pc, (uint32_t)1 << entry.size_class, entry.count);
+    }
+    if (s_ledger_overflow != 0) {
+        printf("  ledger full, %" PRIu32 " allocations not attributed\n", s_ledger_overflow);
+    }
+}
+
+void heap_caps_reset_alloc_sites(void)
+{
+    portENTER_CRITICAL_SAFE(&s_ledger_mux);
+    memset(s_ledger, 0, sizeof(s_ledger));
+    s_ledger_overflow = 0;
+    portEXIT_CRITICAL_SAFE(&s_ledger_mux);
+}
+
+/* The public heap_caps entry points are wrapped at link time (see the
+ * component CMakeLists), so the return address is the real call site.
+ * Calls that stay inside the heap component resolve locally and are not
+ * double counted. */
+
+void *__real_heap_caps_malloc(size_t size, uint32_t caps);
+void *__real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void *__real_heap_caps_realloc(void *ptr, size_t size, uint32_t caps);
+void *__real_heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void *__real_heap_caps_malloc_default(size_t size);
+void *__real_heap_caps_realloc_default(void *ptr, size_t size);
+
+void *__wrap_heap_caps_malloc(size_t size, uint32_t caps)
+{
+    void *ptr = __real_heap_caps_malloc(size, caps);
+    if (ptr != NULL) {
+        ledger_record(__builtin_return_address(0), size);
+    }
+    return ptr;
+}
+
+void *__wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    void *ptr = __real_heap_caps_calloc(n, size, caps);
+    if (ptr != NULL) {
+        ledger_record(__builtin_return_address(0), n * size);
+    }
+    return ptr;
+}
+
+void *__wrap_heap_caps_realloc(void *old_ptr, size_t size, uint32_t caps)
+{
+    void *ptr = __real_heap_caps_realloc(old_ptr, size, caps);
+    if (ptr != NULL) {
+        ledger_record(__builtin_return_address(0), size);
+    }
+    return ptr;
+}
+
+void *__wrap_heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+    void *ptr = __real_heap_caps_aligned_alloc(alignment, size, caps);
+    if (ptr != NULL) {
+        ledger_record(__builtin_return_address(0), size);
+    }
+    return ptr;
+}
+
+/* malloc()/realloc() from libc funnel through the _default entry points,
+ * so the recorded site is the libc glue unless frame pointers are enabled */
+void *__wrap_heap_caps_malloc_default(size_t size)
+{
+    void *ptr = __real_heap_caps_malloc_default(size);
+    if (ptr != NULL) {
+        ledger_record(__builtin_return_address(0), size);
+    }
+    return ptr;
+}
+
+void *__wrap_heap_caps_realloc_default(void *old_ptr, size_t size)
+{
+    void *ptr = __real_heap_caps_realloc_default(old_ptr, size);
+    if (ptr != NULL) {
+        ledger_record(__builtin_return_address(0), size);
+    }
+    return ptr;
+}
+
+#endif // CONFIG_HEAP_ALLOC_SITE_LEDGER
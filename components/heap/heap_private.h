@@ -95,6 +95,25 @@ void *heap_caps_calloc_base(size_t n, size_t size, uint32_t caps);
 void *heap_caps_malloc_base(size_t size, uint32_t caps);
 void *heap_caps_aligned_alloc_base(size_t alignment, size_t size, uint32_t caps);
 
+#if CONFIG_HEAP_PER_TASK_CACHE
+/* Free implementation that bypasses the per-task cache and always returns the
+   block to its heap. heap_caps_free() resolves to this when the cache is off. */
+void heap_caps_free_base(void *ptr);
+/* Per-task cache fast paths, see heap_caps_task_cache.c */
+void *heap_caps_task_cache_try_alloc(size_t size, uint32_t caps);
+bool heap_caps_task_cache_try_free(void *ptr);
+#else
+#define heap_caps_free_base heap_caps_free
+#endif
+
+#if CONFIG_HEAP_PLACEMENT_POLICY
+/* Placement policy fast paths, see heap_caps_policy.c. Both return true with
+   *out set when a rule matched and could serve the request; the caller falls
+   back to the global default order otherwise. */
+bool heap_caps_policy_try_alloc(size_t size, void **out);
+bool heap_caps_policy_try_realloc(void *old, size_t size, void **out);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,523 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include "sdkconfig.h"
+#include <inttypes.h>
+#include "esp_log.h"
+
+#include "esp_heap_trace.h"
+#include "esp_heap_caps.h"
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static __attribute__((unused)) const char* TAG = "heaptrace";
+
+#define STACK_DEPTH CONFIG_HEAP_TRACING_STACK_DEPTH
+#define PTR_TRACK_SIZE CONFIG_HEAP_TRACE_STREAM_PTR_TRACK_SIZE
+
+/* Number of events copied out of the ring per critical section in
+   heap_trace_stream_drain(). Bounds both the stack usage of the drain
+   call and the time the allocation path can be held off by a drain. */
+#define DRAIN_CHUNK 16
+
+typedef enum {
+    TRACING_STARTED, // start recording allocs and free
+    TRACING_STOPPED, // stop recording allocs and free
+    TRACING_ALLOC_PAUSED, // stop recording allocs but keep recording free
+    TRACING_UNKNOWN // default value
+} tracing_state_t;
+
+static portMUX_TYPE trace_mux = portMUX_INITIALIZER_UNLOCKED;
+static tracing_state_t tracing = TRACING_UNKNOWN;
+static heap_trace_mode_t mode;
+
+// defined in heap_trace.inc, included at the end of this file
+inline static uint32_t get_ccount(void);
+
+/* Ring of pending events. Unlike the standalone record table this never
+   stores one entry per outstanding allocation: events sit here only until
+   the next heap_trace_stream_drain() call. */
+static heap_trace_stream_event_t *ring;
+static size_t ring_capacity;
+static size_t ring_head;  // oldest undrained event
+static size_t ring_count;
+static size_t ring_high_water;
+
+/* Per-call-site aggregation, an open-addressed hash table keyed by the
+   caller PC. caller == NULL marks an empty slot. */
+static heap_trace_stream_site_t *sites;
+static size_t sites_capacity;
+static size_t sites_count;
+
+/* Outstanding allocations, so that a free can be attributed back to the
+   site which made the allocation. Open-addressed with backward-shift
+   deletion; one slot is always kept empty so probing terminates. */
+typedef struct {
+    void *address;
+    uint32_t size;
+    uint32_t site_idx;
+} ptr_track_t;
+
+static ptr_track_t *ptr_track;
+static size_t ptr_track_count;
+
+static heap_trace_stream_stats_t stats;
+
+static HEAP_IRAM_ATTR size_t pointer_hash(void* p, size_t table_size)
+{
+    static const uint32_t fnv_prime = 16777619UL;
+    // code addresses and heap addresses are at least 4 bytes aligned,
+    // fold the low bits in before multiplying (see hash_idx in
+    // heap_trace_standalone.c for the rationale)
+    return ((((uint32_t)p >> 3) +
+             ((uint32_t)p >> 5) +
+             ((uint32_t)p >> 7)) * fnv_prime) % (uint32_t)table_size;
+}
+
+/* Find the aggregation slot for a call site, claiming an empty slot on
+   first sight of the caller. Returns NULL if the table is full. */
+static HEAP_IRAM_ATTR heap_trace_stream_site_t* site_find_or_add(void *caller)
+{
+    size_t idx = pointer_hash(caller, sites_capacity);
+    for (size_t probes = 0; probes < sites_capacity; probes++) {
+        heap_trace_stream_site_t *site = &sites[idx];
+        if (site->caller == caller) {
+            return site;
+        }
+        if (site->caller == NULL) {
+            site->caller = caller;
+            sites_count++;
+            return site;
+        }
+        idx = (idx + 1) % sites_capacity;
+    }
+    return NULL;
+}
+
+static HEAP_IRAM_ATTR bool ptr_track_insert(void *address, uint32_t size, uint32_t site_idx)
+{
+    // keep one slot empty so that lookups always hit an empty slot
+    if (ptr_track_count + 1 >= PTR_TRACK_SIZE) {
+        return false;
+    }
+    size_t idx = pointer_hash(address, PTR_TRACK_SIZE);
+    while (ptr_track[idx].address != NULL) {
+        idx = (idx + 1) % PTR_TRACK_SIZE;
+    }
+    ptr_track[idx].address = address;
+    ptr_track[idx].size = size;
+    ptr_track[idx].site_idx = site_idx;
+    ptr_track_count++;
+    return true;
+}
+
+/* Remove the entry for 'address' and return it via 'out'. Uses the
+   backward-shift deletion for linear probing: entries displaced past the
+   vacated slot are moved back so no tombstones are needed. */
+static HEAP_IRAM_ATTR bool ptr_track_remove(void *address, ptr_track_t *out)
+{
+    size_t idx = pointer_hash(address, PTR_TRACK_SIZE);
+    while (ptr_track[idx].address != address) {
+        if (ptr_track[idx].address == NULL) {
+            return false;
+        }
+        idx = (idx + 1) % PTR_TRACK_SIZE;
+    }
+    *out = ptr_track[idx];
+
+    size_t hole = idx;
+    ptr_track[hole].address = NULL;
+    size_t cur = hole;
+    while (true) {
+        cur = (cur + 1) % PTR_TRACK_SIZE;
+        if (ptr_track[cur].address == NULL) {
+            break;
+        }
+        size_t home = pointer_hash(ptr_track[cur].address, PTR_TRACK_SIZE);
+        // keep the entry if its home slot lies cyclically in (hole, cur]
+        bool keep = (hole <= cur) ? (home > hole && home <= cur)
+                                  : (home > hole || home <= cur);
+        if (!keep) {
+            ptr_track[hole] = ptr_track[cur];
+            ptr_track[cur].address = NULL;
+            hole = cur;
+        }
+    }
+    ptr_track_count--;
+    return true;
+}
+
+/* Push an event onto the ring. When the ring is full the oldest pending
+   event is overwritten (matching the standalone tracer, which pops the
+   oldest record), so a stalled drain loses history, not recency. */
+static HEAP_IRAM_ATTR void ring_push(const heap_trace_stream_event_t *event)
+{
+    if (ring_count == ring_capacity) {
+        ring_head = (ring_head + 1) % ring_capacity;
+        ring_count--;
+        stats.events_dropped++;
+    }
+    ring[(ring_head + ring_count) % ring_capacity] = *event;
+    ring_count++;
+    if (ring_count > ring_high_water) {
+        ring_high_water = ring_count;
+    }
+}
+
+esp_err_t heap_trace_stream_init(heap_trace_stream_event_t *event_buffer, size_t num_events,
+                                 heap_trace_stream_site_t *site_buffer, size_t num_sites)
+{
+    if ((tracing == TRACING_STARTED) || (tracing == TRACING_ALLOC_PAUSED)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (event_buffer == NULL || num_events == 0 || site_buffer == NULL || num_sites == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (ptr_track == NULL) {
+        uint32_t track_size = sizeof(ptr_track_t) * PTR_TRACK_SIZE;
+        ESP_LOGI(TAG, "pointer tracking: allocating %" PRIu32 " bytes (Internal RAM)", track_size);
+        ptr_track = heap_caps_calloc(1, track_size, MALLOC_CAP_INTERNAL);
+        if (ptr_track == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    ring = event_buffer;
+    ring_capacity = num_events;
+    sites = site_buffer;
+    sites_capacity = num_sites;
+
+    return ESP_OK;
+}
+
+static esp_err_t set_tracing(tracing_state_t state)
+{
+    if (tracing == state) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    tracing = state;
+    return ESP_OK;
+}
+
+esp_err_t heap_trace_start(heap_trace_mode_t mode_param)
+{
+    if (ring == NULL || sites == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    portENTER_CRITICAL(&trace_mux);
+
+    set_tracing(TRACING_STOPPED);
+    mode = mode_param;
+
+    // clear buffers
+    memset(ring, 0, sizeof(heap_trace_stream_event_t) * ring_capacity);
+    memset(sites, 0, sizeof(heap_trace_stream_site_t) * sites_capacity);
+    memset(ptr_track, 0, sizeof(ptr_track_t) * PTR_TRACK_SIZE);
+
+    ring_head = 0;
+    ring_count = 0;
+    ring_high_water = 0;
+    sites_count = 0;
+    ptr_track_count = 0;
+    memset(&stats, 0, sizeof(stats));
+
+    const esp_err_t ret_val = set_tracing(TRACING_STARTED);
+
+    portEXIT_CRITICAL(&trace_mux);
+    return ret_val;
+}
+
+esp_err_t heap_trace_stop(void)
+{
+    portENTER_CRITICAL(&trace_mux);
+    const esp_err_t ret_val = set_tracing(TRACING_STOPPED);
+    portEXIT_CRITICAL(&trace_mux);
+    return ret_val;
+}
+
+esp_err_t heap_trace_alloc_pause(void)
+{
+    portENTER_CRITICAL(&trace_mux);
+    const esp_err_t ret_val = set_tracing(TRACING_ALLOC_PAUSED);
+    portEXIT_CRITICAL(&trace_mux);
+    return ret_val;
+}
+
+esp_err_t heap_trace_resume(void)
+{
+    portENTER_CRITICAL(&trace_mux);
+    const esp_err_t ret_val = set_tracing(TRACING_STARTED);
+    portEXIT_CRITICAL(&trace_mux);
+    return ret_val;
+}
+
+size_t heap_trace_get_count(void)
+{
+    return ring_count;
+}
+
+esp_err_t heap_trace_get(size_t index, heap_trace_record_t *r_out)
+{
+    if (r_out == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t result = ESP_OK;
+
+    portENTER_CRITICAL(&trace_mux);
+
+    if (index >= ring_count) {
+        result = ESP_ERR_INVALID_ARG; /* out of range for 'count' */
+    } else {
+        const heap_trace_stream_event_t *event = &ring[(ring_head + index) % ring_capacity];
+        memset(r_out, 0, sizeof(heap_trace_record_t));
+        r_out->ccount = event->ccount;
+        r_out->address = event->address;
+        r_out->size = event->size;
+        r_out->freed = (event->type == HEAP_TRACE_STREAM_EVENT_FREE);
+#if STACK_DEPTH > 0
+        if (r_out->freed) {
+            r_out->freed_by[0] = event->caller;
+        } else {
+            r_out->alloced_by[0] = event->caller;
+        }
+#endif
+    }
+
+    portEXIT_CRITICAL(&trace_mux);
+    return result;
+}
+
+esp_err_t heap_trace_summary(heap_trace_summary_t *summary)
+{
+    if (summary == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&trace_mux);
+    summary->mode = mode;
+    summary->total_allocations = stats.total_allocations;
+    summary->total_frees = stats.total_frees;
+    summary->count = ring_count;
+    summary->capacity = ring_capacity;
+    summary->high_water_mark = ring_high_water;
+    summary->has_overflowed = stats.events_dropped > 0;
+    portEXIT_CRITICAL(&trace_mux);
+
+    return ESP_OK;
+}
+
+esp_err_t heap_trace_stream_drain(heap_trace_stream_drain_cb_t drain_cb, void *ctx)
+{
+    if (drain_cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (ring == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    heap_trace_stream_event_t chunk[DRAIN_CHUNK];
+
+    while (true) {
+        size_t chunk_count = 0;
+
+        // pop a bounded chunk under the lock, deliver it outside: the
+        // callback typically blocks (apptrace, socket) and must not run
+        // in a critical section
+        portENTER_CRITICAL(&trace_mux);
+        while (chunk_count < DRAIN_CHUNK && ring_count > 0) {
+            chunk[chunk_count++] = ring[ring_head];
+            ring_head = (ring_head + 1) % ring_capacity;
+            ring_count--;
+        }
+        portEXIT_CRITICAL(&trace_mux);
+
+        if (chunk_count == 0) {
+            return ESP_OK;
+        }
+
+        esp_err_t err = drain_cb(chunk, chunk_count, ctx);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+}
+
+esp_err_t heap_trace_stream_get_site(size_t index, heap_trace_stream_site_t *site_out)
+{
+    if (site_out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (sites == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (index >= sites_capacity) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&trace_mux);
+    *site_out = sites[index];
+    portEXIT_CRITICAL(&trace_mux);
+    return ESP_OK;
+}
+
+esp_err_t heap_trace_stream_get_stats(heap_trace_stream_stats_t *stats_out)
+{
+    if (stats_out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&trace_mux);
+    *stats_out = stats;
+    stats_out->site_count = sites_count;
+    portEXIT_CRITICAL(&trace_mux);
+    return ESP_OK;
+}
+
+void heap_trace_dump(void) {
+    heap_trace_dump_caps(MALLOC_CAP_INTERNAL | MALLOC_CAP_SPIRAM);
+}
+
+void heap_trace_dump_caps(const uint32_t caps) {
+    (void) caps; // sites aggregate over all heaps, there is no per-address data to filter
+
+    portENTER_CRITICAL(&trace_mux);
+
+    esp_rom_printf("====== Heap Trace: %"PRIu32" call sites (%"PRIu32" capacity) ======\n",
+        sites_count, sites_capacity);
+
+    for (size_t i = 0; i < sites_capacity; i++) {
+        const heap_trace_stream_site_t *site = &sites[i];
+        if (site->caller == NULL) {
+            continue;
+        }
+        esp_rom_printf("caller %p: %"PRIu32" allocations, %"PRIu32" bytes total, %"PRIu32" bytes alive, %"PRIu32" high water\n",
+            site->caller, site->count, site->bytes_allocated, site->cur_bytes, site->high_water);
+    }
+
+    esp_rom_printf("====== Heap Trace Summary ======\n");
+    esp_rom_printf("%"PRIu32" bytes alive in trace (%"PRIu32" high water mark)\n",
+        stats.cur_bytes, stats.high_water_bytes);
+    esp_rom_printf("events: %"PRIu32" pending (%"PRIu32" capacity, %"PRIu32" high water mark, %"PRIu32" dropped)\n",
+        ring_count, ring_capacity, ring_high_water, stats.events_dropped);
+    esp_rom_printf("total allocations: %"PRIu32" (%"PRIu32" untracked)\n",
+        stats.total_allocations, stats.untracked_allocs);
+    esp_rom_printf("total frees: %"PRIu32" (%"PRIu32" untracked)\n",
+        stats.total_frees, stats.untracked_frees);
+    if (stats.sites_dropped > 0) {
+        esp_rom_printf("(NB: site table overflowed, %"PRIu32" allocations were not aggregated.)\n",
+            stats.sites_dropped);
+    }
+    esp_rom_printf("================================\n");
+
+    portEXIT_CRITICAL(&trace_mux);
+}
+
+/* Record a new allocation: one event in the ring plus an incremental
+   update of the per-call-site aggregation. */
+static HEAP_IRAM_ATTR void record_allocation(const heap_trace_record_t *r_allocation)
+{
+    if ((tracing != TRACING_STARTED) || (r_allocation->address == NULL)) {
+        return;
+    }
+    portENTER_CRITICAL(&trace_mux);
+
+    if (tracing == TRACING_STARTED) {
+        void *caller = NULL;
+#if STACK_DEPTH > 0
+        caller = r_allocation->alloced_by[0];
+#endif
+        stats.total_allocations++;
+
+        heap_trace_stream_event_t event = {
+            .ccount = r_allocation->ccount,
+            .address = r_allocation->address,
+            .size = r_allocation->size,
+            .caller = caller,
+            .type = HEAP_TRACE_STREAM_EVENT_ALLOC,
+        };
+        ring_push(&event);
+
+        heap_trace_stream_site_t *site = site_find_or_add(caller);
+        if (site != NULL) {
+            site->count++;
+            site->bytes_allocated += r_allocation->size;
+            site->cur_bytes += r_allocation->size;
+            if (site->cur_bytes > site->high_water) {
+                site->high_water = site->cur_bytes;
+            }
+        } else {
+            stats.sites_dropped++;
+        }
+
+        stats.cur_bytes += r_allocation->size;
+        if (stats.cur_bytes > stats.high_water_bytes) {
+            stats.high_water_bytes = stats.cur_bytes;
+        }
+
+        uint32_t site_idx = (site != NULL) ? (uint32_t)(site - sites) : UINT32_MAX;
+        if (!ptr_track_insert(r_allocation->address, r_allocation->size, site_idx)) {
+            // pointer table full, the matching free will not be attributed
+            stats.untracked_allocs++;
+        }
+    }
+
+    portEXIT_CRITICAL(&trace_mux);
+}
+
+/* Record a free event: attribute it back to the allocating site via the
+   pointer-tracking table and stream it (unless in leaks mode, where only
+   allocation events are streamed and a matched free simply cancels its
+   allocation out of the aggregation). */
+static HEAP_IRAM_ATTR void record_free(void *p, void **callers)
+{
+    if ((tracing == TRACING_STOPPED) || (p == NULL)) {
+        return;
+    }
+
+    portENTER_CRITICAL(&trace_mux);
+
+    if (tracing != TRACING_STOPPED) {
+        void *caller = NULL;
+#if STACK_DEPTH > 0
+        caller = callers[0];
+#else
+        (void) callers;
+#endif
+        stats.total_frees++;
+
+        ptr_track_t entry;
+        bool tracked = ptr_track_remove(p, &entry);
+        if (tracked) {
+            if (entry.site_idx != UINT32_MAX) {
+                heap_trace_stream_site_t *site = &sites[entry.site_idx];
+                site->cur_bytes -= entry.size;
+            }
+            stats.cur_bytes -= entry.size;
+        } else {
+            stats.untracked_frees++;
+        }
+
+        if (mode == HEAP_TRACE_ALL) {
+            heap_trace_stream_event_t event = {
+                .ccount = get_ccount(),
+                .address = p,
+                .size = tracked ? entry.size : 0,
+                .caller = caller,
+                .type = HEAP_TRACE_STREAM_EVENT_FREE,
+            };
+            ring_push(&event);
+        }
+    }
+
+    portEXIT_CRITICAL(&trace_mux);
+}
+
+#include "heap_trace.inc"
@@ -371,6 +371,109 @@ bool heap_caps_check_integrity_addr(intptr_t addr, bool print_errors);
  */
 void heap_caps_malloc_extmem_enable(size_t limit);
 
+#ifdef CONFIG_HEAP_PER_TASK_CACHE
+/**
+ * @brief Return all blocks parked in the calling task's allocation cache to the heap
+ *
+ * Only available when CONFIG_HEAP_PER_TASK_CACHE is enabled. The cache of a task is
+ * flushed automatically when the task is deleted; call this from tasks which are done
+ * with their allocation-heavy phase and want to give the cached memory back early.
+ */
+void heap_caps_flush_task_cache(void);
+#endif
+
+/**
+ * @brief Opaque handle to a heap_caps arena allocator
+ */
+typedef struct heap_caps_arena *heap_caps_arena_handle_t;
+
+/**
+ * @brief Create an arena (region) allocator backed by memory with the given capabilities
+ *
+ * An arena serves allocations by bumping an offset inside a backing block, without taking
+ * the heap lock, and releases all of its allocations at once on heap_caps_arena_reset().
+ * This suits request-scoped workloads which perform many allocations and then free
+ * everything together. When the backing block is exhausted the arena transparently grows
+ * by further blocks of the same size (allocated with the same capabilities); the growth
+ * blocks are given back to the heap on reset.
+ *
+ * @note An arena and its allocation functions are not thread safe, an arena is meant to
+ *       be used from a single task.
+ *
+ * @param size Usable size of the backing block, in bytes
+ * @param caps Bitwise OR of MALLOC_CAP_* flags indicating the type of backing memory
+ *
+ * @return Handle to the new arena, or NULL if the backing block could not be allocated
+ */
+heap_caps_arena_handle_t heap_caps_arena_create(size_t size, uint32_t caps);
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * The memory stays valid until heap_caps_arena_reset() or heap_caps_arena_destroy() is
+ * called on the arena; there is no way to free an individual allocation.
+ *
+ * @param arena Arena to allocate from
+ * @param size Size of the allocation, in bytes
+ *
+ * @return A pointer to the memory allocated on success, NULL on failure
+ */
+void *heap_caps_arena_alloc(heap_caps_arena_handle_t arena, size_t size);
+
+/**
+ * @brief Allocate memory from an arena with a specific alignment
+ *
+ * @param arena Arena to allocate from
+ * @param alignment How the pointer received needs to be aligned, must be a power of two
+ * @param size Size of the allocation, in bytes
+ *
+ * @return A pointer to the memory allocated on success, NULL on failure
+ */
+void *heap_caps_arena_aligned_alloc(heap_caps_arena_handle_t arena, size_t alignment, size_t size);
+
+/**
+ * @brief Allocate zero-initialized memory for an array of n items from an arena
+ *
+ * @param arena Arena to allocate from
+ * @param n Number of items to allocate
+ * @param size Size of one item, in bytes
+ *
+ * @return A pointer to the memory allocated on success, NULL on failure
+ */
+void *heap_caps_arena_calloc(heap_caps_arena_handle_t arena, size_t n, size_t size);
+
+/**
+ * @brief Check whether a pointer was allocated from the arena
+ *
+ * Useful when routing an allocator interface without user context (e.g. cJSON hooks)
+ * through an arena: the matching free hook can skip pointers the arena owns and forward
+ * the rest to heap_caps_free().
+ *
+ * @param arena Arena to check against
+ * @param ptr Pointer to check
+ *
+ * @return True if ptr points into one of the arena's backing blocks
+ */
+bool heap_caps_arena_contains(heap_caps_arena_handle_t arena, const void *ptr);
+
+/**
+ * @brief Release every allocation made from the arena at once
+ *
+ * Rewinds the arena to its state right after creation. Growth blocks are returned to the
+ * heap; if the allocations fitted into the initial backing block, no heap interaction
+ * happens at all.
+ *
+ * @param arena Arena to reset
+ */
+void heap_caps_arena_reset(heap_caps_arena_handle_t arena);
+
+/**
+ * @brief Delete the arena and return its backing memory to the heap
+ *
+ * @param arena Arena to delete
+ */
+void heap_caps_arena_destroy(heap_caps_arena_handle_t arena);
+
 /**
  * @brief Allocate a chunk of memory as preference in decreasing order.
  *
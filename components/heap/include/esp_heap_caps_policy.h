@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of capability sets a placement rule tries in order
+ */
+#define HEAP_POLICY_CAPS_PRIO_NUM 2
+
+/**
+ * @brief One allocation placement rule
+ *
+ * A rule matches a default allocation (malloc/realloc and the heap_caps
+ * default paths) when the calling task name starts with task_name and the
+ * requested size lies in [min_size, max_size]. The capability sets in caps
+ * are then tried in order; if none can serve the request, the allocation
+ * falls back to the global default behavior.
+ */
+typedef struct {
+    const char *task_name;  /*!< Prefix matched against the calling task name, NULL matches any task
+                                 (and allocations made before the scheduler runs or from ISRs) */
+    size_t min_size;        /*!< Smallest request size the rule applies to */
+    size_t max_size;        /*!< Largest request size the rule applies to, 0 for no upper bound */
+    uint32_t caps[HEAP_POLICY_CAPS_PRIO_NUM]; /*!< Capability sets tried in order, 0 ends the list */
+} heap_caps_policy_rule_t;
+
+/**
+ * @brief Per-rule usage counters
+ */
+typedef struct {
+    uint32_t hits;          /*!< Allocations served through the rule */
+    uint32_t misses;        /*!< Matches where no capability set could serve the request */
+    uint64_t bytes_served;  /*!< Sum of the request sizes of all hits */
+} heap_caps_policy_rule_stats_t;
+
+/**
+ * @brief Build-time placement rules, applied in array order
+ *
+ * Both symbols are weak and empty by default; define them in the application
+ * to install rules without any runtime call. Runtime rules added with
+ * heap_caps_policy_add_rule() are matched before the build-time rules.
+ */
+extern const heap_caps_policy_rule_t heap_caps_policy_default_rules[];
+extern const size_t heap_caps_policy_default_rule_count;
+
+/**
+ * @brief Add a placement rule at runtime
+ *
+ * The rule is matched before all previously installed rules. The task_name
+ * pointer is stored, not copied, and must stay valid while the rule is
+ * installed.
+ *
+ * @param rule Rule to install
+ *
+ * @return
+ *      - ESP_OK: rule installed
+ *      - ESP_ERR_INVALID_ARG: rule is NULL or has no capability set
+ *      - ESP_ERR_NO_MEM: rule table is full (CONFIG_HEAP_PLACEMENT_POLICY_MAX_RULES)
+ */
+esp_err_t heap_caps_policy_add_rule(const heap_caps_policy_rule_t *rule);
+
+/**
+ * @brief Remove all placement rules, including the build-time ones
+ */
+void heap_caps_policy_clear_rules(void);
+
+/**
+ * @brief Get the number of installed placement rules
+ *
+ * @return Number of rules, in matching order
+ */
+size_t heap_caps_policy_get_rule_count(void);
+
+/**
+ * @brief Get one placement rule and its usage counters
+ *
+ * @param index Rule index, 0 is matched first
+ * @param[out] rule Filled with the rule, can be NULL
+ * @param[out] stats Filled with the rule's counters, can be NULL
+ *
+ * @return
+ *      - ESP_OK: on success
+ *      - ESP_ERR_INVALID_ARG: index is out of range
+ */
+esp_err_t heap_caps_policy_get_rule_stats(size_t index, heap_caps_policy_rule_t *rule,
+                                          heap_caps_policy_rule_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of power-of-two buckets in a fragmentation histogram.
+ *
+ * Bucket i counts free blocks with a size in [2^(i+4), 2^(i+5)) bytes,
+ * i.e. bucket 0 covers 16..31 bytes and the last bucket also absorbs
+ * everything larger than its lower bound.
+ */
+#define HEAP_FRAG_HIST_BUCKETS 16
+
+/**
+ * @brief Free-block size histogram of the heaps matching a capability set
+ */
+typedef struct {
+    size_t buckets[HEAP_FRAG_HIST_BUCKETS];     ///< Free block count per power-of-two size bucket
+    size_t free_blocks;                         ///< Total number of free blocks
+    size_t largest_free_block;                  ///< Size of the largest free block, in bytes
+    size_t total_free_bytes;                    ///< Sum of all free block sizes, in bytes
+} heap_frag_histogram_t;
+
+/**
+ * @brief Build the free-block histogram of all heaps matching the given capabilities
+ *
+ * Walks the matching heaps under their locks; the cost is proportional to the
+ * number of blocks, no state is kept between calls.
+ *
+ * @param[in]  caps  Capabilities of the heaps to sample (e.g. MALLOC_CAP_INTERNAL)
+ * @param[out] hist  Filled with the histogram
+ *
+ * @return
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_ARG if hist is NULL
+ */
+esp_err_t heap_caps_get_frag_histogram(uint32_t caps, heap_frag_histogram_t *hist);
+
+/**
+ * @brief Print the free-block histogram of the heaps matching the given capabilities
+ *
+ * One line per non-empty bucket, suitable for periodic logging from a
+ * monitor task on long soak runs.
+ *
+ * @param[in] caps  Capabilities of the heaps to sample
+ */
+void heap_caps_print_frag_histogram(uint32_t caps);
+
+#ifdef CONFIG_HEAP_ALLOC_SITE_LEDGER
+/**
+ * @brief One allocation-site ledger entry
+ */
+typedef struct {
+    void *caller_pc;            ///< Return address of the allocating call site
+    size_t size_class_min;      ///< Lower bound of the size class, in bytes (power of two)
+    uint32_t count;             ///< Cumulative number of allocations from this site and class
+} heap_alloc_site_record_t;
+
+/**
+ * @brief Copy the current allocation-site ledger into a caller provided array
+ *
+ * @param[out] records    Array to fill
+ * @param[in]  capacity   Number of elements in the array
+ * @param[out] out_count  Number of records copied
+ *
+ * @return
+ *  - ESP_OK on success (also when the ledger holds more records than fit)
+ *  - ESP_ERR_INVALID_ARG on null arguments
+ */
+esp_err_t heap_caps_get_alloc_sites(heap_alloc_site_record_t *records, size_t capacity, size_t *out_count);
+
+/**
+ * @brief Print the allocation-site ledger, one "pc size-class count" line per entry
+ *
+ * Addresses can be symbolized offline with addr2line against the app ELF.
+ */
+void heap_caps_print_alloc_sites(void);
+
+/**
+ * @brief Reset all ledger counters, e.g. at the start of a soak interval
+ */
+void heap_caps_reset_alloc_sites(void);
+#endif // CONFIG_HEAP_ALLOC_SITE_LEDGER
+
+#ifdef __cplusplus
+}
+#endif
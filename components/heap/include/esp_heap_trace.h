@@ -195,6 +195,133 @@ void heap_trace_dump_caps(const uint32_t caps);
  */
 esp_err_t heap_trace_summary(heap_trace_summary_t *summary);
 
+/*
+ * Streaming heap tracing (CONFIG_HEAP_TRACING_STREAMING)
+ *
+ * Instead of storing one record per outstanding allocation, the streaming
+ * tracer pushes a compact event per alloc/free into a fixed-size ring and
+ * updates a per-call-site aggregation table incrementally. The ring is
+ * emptied with heap_trace_stream_drain(), so the memory cost is bounded by
+ * the drain period rather than by the number of live allocations.
+ */
+
+/**
+ * @brief Type of a streamed heap trace event
+ */
+typedef enum {
+    HEAP_TRACE_STREAM_EVENT_ALLOC, ///< Memory was allocated (malloc, calloc, realloc)
+    HEAP_TRACE_STREAM_EVENT_FREE,  ///< Memory was freed (free, realloc)
+} heap_trace_stream_event_type_t;
+
+/**
+ * @brief One alloc/free event in the streaming trace ring.
+ */
+typedef struct {
+    uint32_t ccount; ///< CCOUNT of the CPU when the event happened. LSB (bit value 1) is the CPU number (0 or 1).
+    void *address;   ///< Address which was allocated or freed
+    uint32_t size;   ///< Size of the allocation. 0 on a free the tracer could not attribute.
+    void *caller;    ///< PC of the first traced stack frame of the caller (NULL if CONFIG_HEAP_TRACING_STACK_DEPTH is 0)
+    uint8_t type;    ///< Event type, one of heap_trace_stream_event_type_t
+} heap_trace_stream_event_t;
+
+/**
+ * @brief Per-call-site aggregation entry, updated incrementally on every traced event.
+ */
+typedef struct {
+    void *caller;             ///< PC of the allocating call site. If NULL, then this entry is empty.
+    uint32_t count;           ///< Number of allocations made from this site
+    uint32_t bytes_allocated; ///< Cumulative bytes allocated from this site
+    uint32_t cur_bytes;       ///< Bytes currently outstanding from this site
+    uint32_t high_water;      ///< Maximum value that 'cur_bytes' got to
+} heap_trace_stream_site_t;
+
+/**
+ * @brief Counters describing the state of the streaming tracer.
+ */
+typedef struct {
+    size_t total_allocations; ///< The total number of allocations traced
+    size_t total_frees;       ///< The total number of frees traced
+    size_t events_dropped;    ///< Events overwritten because the ring filled up before a drain
+    size_t sites_dropped;     ///< Allocations not aggregated because the site table was full
+    size_t untracked_allocs;  ///< Allocations whose matching free cannot be attributed (pointer table was full)
+    size_t untracked_frees;   ///< Frees which could not be matched to a traced allocation
+    size_t site_count;        ///< Number of call sites currently in the aggregation table
+    size_t cur_bytes;         ///< Bytes currently outstanding across all traced sites
+    size_t high_water_bytes;  ///< Maximum value that 'cur_bytes' got to
+} heap_trace_stream_stats_t;
+
+/**
+ * @brief Callback invoked by heap_trace_stream_drain() with a batch of events.
+ *
+ * Called outside of any critical section, so it may block: typical sinks are
+ * esp_apptrace_write() or a socket send. Returning anything other than ESP_OK
+ * aborts the drain (the events of the current batch are already consumed).
+ */
+typedef esp_err_t (*heap_trace_stream_drain_cb_t)(const heap_trace_stream_event_t *events, size_t num_events, void *ctx);
+
+/**
+ * @brief Initialise heap tracing in streaming mode.
+ *
+ * This function must be called before any other heap tracing functions.
+ * Tracing is then controlled with the regular heap_trace_start()/heap_trace_stop()
+ * functions. In HEAP_TRACE_LEAKS mode only allocation events are streamed; a
+ * matched free cancels its allocation out of the aggregation silently.
+ *
+ * @param event_buffer Buffer used as the event ring. Size it for the expected
+ * allocation rate times the drain period.
+ * @param num_events Capacity of the event ring, as number of event structures.
+ * When the ring fills up before a drain, the oldest pending events are dropped.
+ * @param site_buffer Buffer used for the per-call-site aggregation table.
+ * @param num_sites Capacity of the aggregation table, as number of site structures.
+ * @return
+ *  - ESP_ERR_NOT_SUPPORTED Project was compiled without streaming heap tracing enabled in menuconfig.
+ *  - ESP_ERR_INVALID_STATE Heap tracing is currently in progress.
+ *  - ESP_ERR_INVALID_ARG A buffer is NULL or has zero capacity.
+ *  - ESP_ERR_NO_MEM Failed to allocate the internal pointer-tracking table.
+ *  - ESP_OK Heap tracing initialised successfully.
+ */
+esp_err_t heap_trace_stream_init(heap_trace_stream_event_t *event_buffer, size_t num_events,
+                                 heap_trace_stream_site_t *site_buffer, size_t num_sites);
+
+/**
+ * @brief Drain all pending events from the ring through a callback.
+ *
+ * Pops events in bounded batches and hands each batch to 'drain_cb'. Call this
+ * periodically (or when the pending count grows) from a task of the
+ * application's choosing; the callback decides where the events go.
+ *
+ * @param drain_cb Callback receiving the event batches.
+ * @param ctx Opaque pointer passed through to the callback.
+ * @return
+ *  - ESP_ERR_INVALID_ARG drain_cb is NULL.
+ *  - ESP_ERR_INVALID_STATE Heap tracing was not initialised.
+ *  - ESP_OK The ring was fully drained, or the error returned by the callback.
+ */
+esp_err_t heap_trace_stream_drain(heap_trace_stream_drain_cb_t drain_cb, void *ctx);
+
+/**
+ * @brief Return one raw entry of the per-call-site aggregation table.
+ *
+ * Iterate 'index' from 0 to the num_sites passed to heap_trace_stream_init()
+ * and skip entries whose 'caller' is NULL: the table is a hash table and
+ * occupied slots are not contiguous.
+ *
+ * @param index Index (zero-based) of the table entry to return.
+ * @param[out] site_out Entry where the aggregation data will be copied.
+ * @return
+ *  - ESP_ERR_INVALID_ARG site_out is NULL or index is out of bounds for the table capacity.
+ *  - ESP_ERR_INVALID_STATE Heap tracing was not initialised.
+ *  - ESP_OK Entry returned successfully.
+ */
+esp_err_t heap_trace_stream_get_site(size_t index, heap_trace_stream_site_t *site_out);
+
+/**
+ * @brief Get the counters of the streaming tracer.
+ *
+ * @note It is safe to call this function while heap tracing is running.
+ */
+esp_err_t heap_trace_stream_get_stats(heap_trace_stream_stats_t *stats_out);
+
 #ifdef __cplusplus
 }
 #endif
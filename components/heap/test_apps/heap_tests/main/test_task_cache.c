@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Unlicense OR CC0-1.0
+ */
+/*
+ Tests for the per-task small allocation cache
+*/
+
+#include "sdkconfig.h"
+
+#ifdef CONFIG_HEAP_PER_TASK_CACHE
+
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "unity.h"
+#include "esp_heap_caps.h"
+
+TEST_CASE("task cache round-trips small blocks without touching the heap", "[heap]")
+{
+    heap_caps_flush_task_cache();
+
+    void *ptr = heap_caps_malloc(64, MALLOC_CAP_DEFAULT);
+    TEST_ASSERT_NOT_NULL(ptr);
+    memset(ptr, 0xa5, 64);
+    heap_caps_free(ptr);
+
+    // The freed block must be parked in this task's cache and serve the next
+    // allocation of the same size class
+    void *again = heap_caps_malloc(64, MALLOC_CAP_DEFAULT);
+    TEST_ASSERT_EQUAL_PTR(ptr, again);
+    heap_caps_free(again);
+
+    // Compatible capability subsets are served from the cache as well
+    again = heap_caps_malloc(64, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    TEST_ASSERT_EQUAL_PTR(ptr, again);
+    heap_caps_free(again);
+
+    heap_caps_flush_task_cache();
+}
+
+TEST_CASE("task cache respects size class boundaries", "[heap]")
+{
+    heap_caps_flush_task_cache();
+
+    // A cached 16-byte class block must not serve a request of the next class
+    void *small = heap_caps_malloc(16, MALLOC_CAP_DEFAULT);
+    TEST_ASSERT_NOT_NULL(small);
+    heap_caps_free(small);
+    void *larger = heap_caps_malloc(17, MALLOC_CAP_DEFAULT);
+    TEST_ASSERT_NOT_EQUAL(small, larger);
+    heap_caps_free(larger);
+
+    // Largest cacheable class is 256 bytes; a request above it bypasses the cache
+    void *big = heap_caps_malloc(256, MALLOC_CAP_DEFAULT);
+    TEST_ASSERT_NOT_NULL(big);
+    heap_caps_free(big);
+    void *too_big = heap_caps_malloc(257, MALLOC_CAP_DEFAULT);
+    TEST_ASSERT_NOT_EQUAL(big, too_big);
+    heap_caps_free(too_big);
+
+    heap_caps_flush_task_cache();
+}
+
+TEST_CASE("task cache does not serve requests with incompatible caps", "[heap]")
+{
+    heap_caps_flush_task_cache();
+
+    void *ptr = heap_caps_malloc(64, MALLOC_CAP_DEFAULT);
+    TEST_ASSERT_NOT_NULL(ptr);
+    heap_caps_free(ptr);
+
+    // A cached DRAM block promises byte access only, a 32BIT request must go
+    // to the heap proper (the cached block cannot be returned, it is parked)
+    void *word_only = heap_caps_malloc(64, MALLOC_CAP_32BIT);
+    TEST_ASSERT_NOT_EQUAL(ptr, word_only);
+    heap_caps_free(word_only);
+
+    heap_caps_flush_task_cache();
+}
+
+TEST_CASE("task cache rejects blocks that are not byte-accessible DRAM", "[heap]")
+{
+    heap_caps_flush_task_cache();
+
+    // An executable allocation lands in IRAM / the IRAM alias of D/IRAM;
+    // freeing it must bypass the cache (it cannot satisfy 8BIT requests).
+    // Skipped silently on configs without an executable heap region.
+    void *exec_ptr = heap_caps_malloc(64, MALLOC_CAP_EXEC | MALLOC_CAP_32BIT);
+    if (exec_ptr != NULL) {
+        heap_caps_free(exec_ptr);
+        void *dram_ptr = heap_caps_malloc(64, MALLOC_CAP_DEFAULT);
+        TEST_ASSERT_NOT_EQUAL(exec_ptr, dram_ptr);
+        heap_caps_free(dram_ptr);
+    }
+
+    heap_caps_flush_task_cache();
+}
+
+static void populate_cache_and_delete(void *arg)
+{
+    SemaphoreHandle_t done = (SemaphoreHandle_t)arg;
+    // Park blocks of several classes in this task's cache, then die without
+    // flushing: the TLSP deletion callback has to return everything
+    for (size_t size = 16; size <= 256; size *= 2) {
+        void *ptr = heap_caps_malloc(size, MALLOC_CAP_DEFAULT);
+        TEST_ASSERT_NOT_NULL(ptr);
+        heap_caps_free(ptr);
+    }
+    xSemaphoreGive(done);
+    vTaskDelete(NULL);
+}
+
+TEST_CASE("task cache is flushed by the TLSP deletion callback", "[heap]")
+{
+    SemaphoreHandle_t done = xSemaphoreCreateBinary();
+    TEST_ASSERT_NOT_NULL(done);
+
+    size_t free_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    TEST_ASSERT(xTaskCreate(populate_cache_and_delete, "cache_del", 2048, done, 5, NULL) == pdTRUE);
+    TEST_ASSERT(xSemaphoreTake(done, pdMS_TO_TICKS(1000)) == pdTRUE);
+    // Let the idle task reclaim the deleted task's TCB and stack
+    vTaskDelay(pdMS_TO_TICKS(50));
+
+    size_t free_after = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    TEST_ASSERT_EQUAL(free_before, free_after);
+    vSemaphoreDelete(done);
+}
+
+#endif // CONFIG_HEAP_PER_TASK_CACHE
@@ -41,6 +41,13 @@ def test_heap_in_flash(dut: Dut) -> None:
     dut.run_all_single_board_cases()
 
 
+@pytest.mark.generic
+@pytest.mark.parametrize('config', ['task_cache'])
+@idf_parametrize('target', ['supported_targets'], indirect=['target'])
+def test_heap_task_cache(dut: Dut) -> None:
+    dut.run_all_single_board_cases()
+
+
 @pytest.mark.generic
 @pytest.mark.parametrize(
     'target',
@@ -426,6 +426,32 @@ enum http_host_state
 
 #define STRICT_TOKEN(c)     (tokens[(unsigned char)c])
 
+/* Word-at-a-time (SWAR) helpers for skipping runs of header-name bytes.
+ * The predicate accepts a conservative subset of the token table
+ * (alphanumerics, '-' and '_' -- the characters real header names are made
+ * of); any other byte stops the scan, so the state machine keeps exact
+ * byte-level control at field boundaries and on unusual input. */
+typedef unsigned long http_swar_word_t;
+
+#define SWAR_ONES           ((http_swar_word_t)~(http_swar_word_t)0 / 0xff)
+#define SWAR_HIGHS          (SWAR_ONES * 0x80)
+/* Per-byte flag in the MSB when the byte is >= c; only valid when no byte
+ * has its own MSB set */
+#define SWAR_GE(x, c)       (((x) + SWAR_ONES * (0x80 - (c))) & SWAR_HIGHS)
+#define SWAR_IN(x, lo, hi)  (SWAR_GE(x, lo) & ~SWAR_GE(x, (hi) + 1))
+
+static int
+http_swar_all_name_chars (http_swar_word_t w)
+{
+  http_swar_word_t flags;
+
+  if (w & SWAR_HIGHS)
+    return 0;
+  flags = SWAR_IN(w, '0', '9') | SWAR_IN(w, 'A', 'Z') | SWAR_IN(w, 'a', 'z') |
+          SWAR_IN(w, '-', '-') | SWAR_IN(w, '_', '_');
+  return flags == SWAR_HIGHS;
+}
+
 #if HTTP_PARSER_STRICT
 #define TOKEN(c)            (tokens[(unsigned char)c])
 #define IS_URL_CHAR(c)      (BIT_AT(normal_url_char, (unsigned char)c))
@@ -1323,6 +1349,7 @@ reexecute:
       case s_header_field:
       {
         const char* start = p;
+        const char* swar_retry = p;
         for (; p != data + len; p++) {
           ch = *p;
           c = TOKEN(ch);
@@ -1332,6 +1359,22 @@ reexecute:
 
           switch (parser->header_state) {
             case h_general:
+              /* Fast path: consume whole words of certain header-name bytes
+               * at a time. p currently holds a verified token byte, so the
+               * scan looks ahead from p + 1 and leaves p on the last byte it
+               * verified; the byte loop picks up from there. Once a word
+               * fails the check, retries are held off until the byte loop
+               * has walked past it, so each word is tested at most once. */
+              if (p >= swar_retry) {
+                while (data + len - p > (ptrdiff_t) sizeof(http_swar_word_t)) {
+                  http_swar_word_t w;
+                  memcpy(&w, p + 1, sizeof(w));
+                  if (!http_swar_all_name_chars(w))
+                    break;
+                  p += sizeof(w);
+                }
+                swar_retry = p + sizeof(http_swar_word_t) + 1;
+              }
               break;
 
             case h_C:
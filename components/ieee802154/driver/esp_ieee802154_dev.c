@@ -48,7 +48,7 @@ extern uint32_t bt_bb_get_cur_rx_info(void);
 
 IEEE802154_STATIC volatile ieee802154_state_t s_ieee802154_state;
 static uint8_t *s_tx_frame = NULL;
-#define IEEE802154_RX_FRAME_SIZE (127 + 1 + 1) // +1: len, +1: for dma test
+#define IEEE802154_RX_FRAME_SIZE ((127 + 1 + 1 + 3) & ~3) // +1: len, +1: for dma test, rounded up so each buffer keeps word alignment
 
 // +1: for the stub buffer when the valid buffers are full.
 //
@@ -62,8 +62,12 @@ static uint8_t *s_tx_frame = NULL;
 //
 // VB: Valid buffer, used for storing the frame received by HW.
 // STUB : Stub buffer, used when all valid buffers are under processing, the received frame will be dropped.
-static uint8_t s_rx_frame[CONFIG_IEEE802154_RX_BUFFER_SIZE + 1][IEEE802154_RX_FRAME_SIZE];
+static WORD_ALIGNED_ATTR uint8_t s_rx_frame[CONFIG_IEEE802154_RX_BUFFER_SIZE + 1][IEEE802154_RX_FRAME_SIZE];
 static esp_ieee802154_frame_info_t s_rx_frame_info[CONFIG_IEEE802154_RX_BUFFER_SIZE + 1];
+// Reference count for each valid buffer. A buffer is handed to the upper layer with one
+// reference; `ieee802154_receive_handle_ref()` adds more and the buffer is recycled only
+// when `ieee802154_receive_handle_done()` has released the last one.
+static uint8_t s_rx_frame_ref[CONFIG_IEEE802154_RX_BUFFER_SIZE + 1];
 
 static bool s_needs_next_operation = false;
 
@@ -87,6 +91,7 @@ static void ieee802154_receive_done(uint8_t *data, esp_ieee802154_frame_info_t *
         // Ignore bit8 for the frame length, due to the max frame length is 127 based 802.15.4 spec.
         data[0] = data[0] & 0x7f;
         frame_info->process = true;
+        s_rx_frame_ref[frame_info - s_rx_frame_info] = 1;
         ieee802154_inner_receive_done(data, frame_info);
     }
 }
@@ -99,6 +104,7 @@ static void ieee802154_transmit_done(const uint8_t *frame, const uint8_t *ack, e
             ieee802154_inner_transmit_failed(frame, ESP_IEEE802154_TX_ERR_NO_ACK);
         } else {
             ack_frame_info->process = true;
+            s_rx_frame_ref[ack_frame_info - s_rx_frame_info] = 1;
             ieee802154_inner_transmit_done(frame, ack, ack_frame_info);
         }
     } else {
@@ -113,11 +119,34 @@ esp_err_t ieee802154_receive_handle_done(const uint8_t *data)
             || (size / IEEE802154_RX_FRAME_SIZE) >= CONFIG_IEEE802154_RX_BUFFER_SIZE) {
         return ESP_FAIL;
     }
-    s_rx_frame_info[size / IEEE802154_RX_FRAME_SIZE].process = false;
-    IEEE802154_RX_BUFFER_STAT_IS_FREE(true);
+    uint8_t index = size / IEEE802154_RX_FRAME_SIZE;
+    ieee802154_enter_critical();
+    if (s_rx_frame_ref[index] > 0 && --s_rx_frame_ref[index] == 0) {
+        s_rx_frame_info[index].process = false;
+        IEEE802154_RX_BUFFER_STAT_IS_FREE(true);
+    }
+    ieee802154_exit_critical();
     return ESP_OK;
 }
 
+esp_err_t ieee802154_receive_handle_ref(const uint8_t *data)
+{
+    uint16_t size = data - &s_rx_frame[0][0];
+    esp_err_t ret = ESP_FAIL;
+    if ((size % IEEE802154_RX_FRAME_SIZE) != 0
+            || (size / IEEE802154_RX_FRAME_SIZE) >= CONFIG_IEEE802154_RX_BUFFER_SIZE) {
+        return ESP_FAIL;
+    }
+    uint8_t index = size / IEEE802154_RX_FRAME_SIZE;
+    ieee802154_enter_critical();
+    if (s_rx_frame_info[index].process == true) {
+        s_rx_frame_ref[index]++;
+        ret = ESP_OK;
+    }
+    ieee802154_exit_critical();
+    return ret;
+}
+
 static IRAM_ATTR void event_end_process(void)
 {
     ieee802154_etm_channel_clear(IEEE802154_ETM_CHANNEL0);
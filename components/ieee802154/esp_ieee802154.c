@@ -388,6 +388,11 @@ esp_err_t esp_ieee802154_receive_handle_done(const uint8_t *frame)
     return ieee802154_receive_handle_done(frame);
 }
 
+esp_err_t esp_ieee802154_receive_handle_ref(const uint8_t *frame)
+{
+    return ieee802154_receive_handle_ref(frame);
+}
+
 __attribute__((weak)) void esp_ieee802154_receive_done(uint8_t *data, esp_ieee802154_frame_info_t *frame_info)
 {
 
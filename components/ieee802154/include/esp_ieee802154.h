@@ -526,6 +526,22 @@ esp_err_t esp_ieee802154_energy_detect(uint32_t duration);
  */
 esp_err_t esp_ieee802154_receive_handle_done(const uint8_t *frame);
 
+/**
+ * @brief  Take an additional reference on a received frame, so that it can be shared by several
+ *         consumers without copying. Each reference must be released with a matching call to
+ *         `esp_ieee802154_receive_handle_done()`; the driver recycles the buffer only after the
+ *         last release.
+ *
+ * @param[in]  frame  The pointer to the frame which was passed from the function `esp_ieee802154_receive_done()`
+ *                    or ack frame from `esp_ieee802154_transmit_done()`.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL if frame is invalid or has already been released.
+ *
+ */
+esp_err_t esp_ieee802154_receive_handle_ref(const uint8_t *frame);
+
 /** Below are the events generated by IEEE 802.15.4 subsystem, which are in ISR context **/
 /**
  * @brief  A Frame was received.
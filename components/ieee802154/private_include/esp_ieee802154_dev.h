@@ -122,6 +122,19 @@ esp_err_t ieee802154_receive(void);
  */
 esp_err_t ieee802154_receive_handle_done(const uint8_t* frame);
 
+/**
+ * @brief  Take an additional reference on a received frame buffer.
+ *
+ * @param[in]  frame  The pointer to the frame which was passed from the function esp_ieee802154_receive_done.
+ *                    or ack frame from esp_ieee802154_transmit_done.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL if frame is invalid or not currently owned by the upper layer.
+ *
+ */
+esp_err_t ieee802154_receive_handle_ref(const uint8_t* frame);
+
 /**
  * @brief  Transmit the given frame at a specific time.
  *
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_LOG_MODE_BINARY_DEFERRED
+
+/**
+ * @brief Reserve space in the deferred log buffer for one binary log packet
+ *
+ * Creates the drain task on first use. Must be called with the log lock held
+ * (esp_log_format_binary() takes it for non-constrained environments), which
+ * makes the producer side single-threaded.
+ *
+ * @param len Packet length in bytes
+ * @return true if the whole packet fits, false if the packet must be dropped
+ */
+bool esp_log_binary_deferred_reserve(unsigned len);
+
+/**
+ * @brief Append one byte of the current packet to the deferred log buffer
+ *
+ * Only valid after a successful esp_log_binary_deferred_reserve() call,
+ * with the log lock still held.
+ */
+void esp_log_binary_deferred_out(uint8_t data);
+
+/**
+ * @brief Finish the current packet and wake the drain task
+ */
+void esp_log_binary_deferred_commit(void);
+
+/**
+ * @brief Number of packets dropped because the deferred log buffer was full
+ */
+uint32_t esp_log_binary_deferred_dropped_count(void);
+
+#endif // CONFIG_LOG_MODE_BINARY_DEFERRED
+
+#ifdef __cplusplus
+}
+#endif
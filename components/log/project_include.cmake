@@ -0,0 +1,25 @@
+# Restrict the highest compiled-in log level for a single component, overriding
+# CONFIG_LOG_MAXIMUM_LEVEL for that component only. Log macros above the given level
+# compile to nothing in all sources of the component, so suppressed messages cost
+# neither code size nor a runtime level check.
+#
+# Call from the project CMakeLists.txt, after project():
+#
+#   esp_log_set_component_max_level(wifi WARN)
+#
+# level: one of NONE, ERROR, WARN, INFO, DEBUG, VERBOSE
+#
+# Note that this works by predefining LOG_LOCAL_LEVEL for the whole component, so it
+# must not be combined with source files that define LOG_LOCAL_LEVEL themselves.
+function(esp_log_set_component_max_level component level)
+    set(known_levels NONE ERROR WARN INFO DEBUG VERBOSE)
+    if(NOT level IN_LIST known_levels)
+        message(FATAL_ERROR "esp_log_set_component_max_level: unknown log level '${level}', "
+                            "expected one of: ${known_levels}")
+    endif()
+    idf_component_get_property(lib ${component} COMPONENT_LIB)
+    if(NOT lib)
+        message(FATAL_ERROR "esp_log_set_component_max_level: unknown component '${component}'")
+    endif()
+    target_compile_definitions(${lib} PRIVATE "LOG_LOCAL_LEVEL=ESP_LOG_${level}")
+endfunction()
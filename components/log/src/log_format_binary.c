@@ -16,6 +16,9 @@
 #include "esp_private/log_util.h"
 #include "soc/soc.h"
 #include "esp_rom_serial_output.h"
+#if CONFIG_LOG_MODE_BINARY_DEFERRED && !BOOTLOADER_BUILD
+#include "esp_private/log_binary_deferred.h"
+#endif
 
 #if BOOTLOADER_BUILD
 #define APP_TYPE 0x01
@@ -66,6 +69,9 @@ typedef struct {
     bool buffer_hexdump_log;
     int buffer_len;
     bool len_calculation_stage;
+#if CONFIG_LOG_MODE_BINARY_DEFERRED && !BOOTLOADER_BUILD
+    bool deferred;
+#endif
 } pkg_info_t;
 
 extern const char __ESP_BUFFER_HEX_FORMAT__[];
@@ -111,7 +117,14 @@ static unsigned output(const void *src, unsigned length, pkg_info_t *pkg_info)
     for (unsigned i = 0; i < length; i++) {
         uint8_t data = ((uint8_t *)src)[length - 1 - i];
         if (pkg_info->len_calculation_stage == false) {
-            esp_rom_output_tx_one_char(data);
+#if CONFIG_LOG_MODE_BINARY_DEFERRED && !BOOTLOADER_BUILD
+            if (pkg_info->deferred) {
+                esp_log_binary_deferred_out(data);
+            } else
+#endif
+            {
+                esp_rom_output_tx_one_char(data);
+            }
             update_crc8(data, pkg_info);
         }
     }
@@ -271,6 +284,12 @@ void esp_log_format_binary(esp_log_msg_t *message)
         .buffer_hexdump_log = message->format == __ESP_BUFFER_HEXDUMP_FORMAT__,
         .buffer_len = 0,
         .len_calculation_stage = false,
+#if CONFIG_LOG_MODE_BINARY_DEFERRED && !BOOTLOADER_BUILD
+        /* Constrained environments (ISR, panic, early startup) bypass the
+         * deferred buffer and transmit synchronously.
+         */
+        .deferred = !message->config.opts.constrained_env,
+#endif
     };
 
     // Output control byte
@@ -283,6 +302,13 @@ void esp_log_format_binary(esp_log_msg_t *message)
         },
         .app_identifier = APP_TYPE,
     };
+#if CONFIG_LOG_MODE_BINARY_DEFERRED && !BOOTLOADER_BUILD
+    if (pkg_info.deferred && !esp_log_binary_deferred_reserve(control.opts.pkg_len)) {
+        // No room for the whole packet: drop it to keep the stream parseable
+        esp_log_impl_unlock();
+        return;
+    }
+#endif
     output(&control, sizeof(control), &pkg_info);
     output_pointer(message->format, &pkg_info);
     output_pointer(message->tag, &pkg_info);
@@ -290,6 +316,12 @@ void esp_log_format_binary(esp_log_msg_t *message)
     output_arguments(message, message->args, &pkg_info);
     output(&pkg_info.crc, sizeof(pkg_info.crc), &pkg_info);
 
+#if CONFIG_LOG_MODE_BINARY_DEFERRED && !BOOTLOADER_BUILD
+    if (pkg_info.deferred) {
+        esp_log_binary_deferred_commit();
+    }
+#endif
+
     if (!message->config.opts.constrained_env) {
         esp_log_impl_unlock();
     }
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * This file implements an open-addressing hash table for storing and retrieving
+ * log tag levels in the ESP-IDF log library. Tags are interned into the table
+ * the first time they are used: a copy of the tag string is stored together
+ * with its log level, so subsequent lookups hash the string and probe at most
+ * a few neighboring slots. This keeps the retrieval cost constant regardless
+ * of how many tags the application logs with, unlike the linked list approach
+ * whose search time grows with the number of tags.
+ *
+ * The table uses linear probing with a power-of-two capacity. Individual
+ * entries are never removed, only the whole table is cleared (when the
+ * wildcard tag "*" is used to reset all levels), so no tombstone handling is
+ * needed. Once the table becomes more than two-thirds full, it grows by
+ * doubling and the existing entries are rehashed in place.
+ *
+ * All functions in this file expect the caller to hold the log lock, same as
+ * the linked list and cache implementations.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include "log_hash_table.h"
+#include "sdkconfig.h"
+
+typedef struct {
+    char *tag;              // interned zero-terminated copy of the tag, NULL if the slot is empty
+    uint8_t level;          // esp_log_level_t as uint8_t
+} tag_entry_t;
+
+static tag_entry_t *s_table = NULL;
+static uint32_t s_capacity = 0;     // always a power of two
+static uint32_t s_count = 0;
+
+// FNV-1a, good distribution for short strings at negligible cost
+static uint32_t hash_tag(const char *tag)
+{
+    uint32_t hash = 2166136261u;
+    for (const char *p = tag; *p != '\0'; p++) {
+        hash ^= (uint8_t)*p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Returns the slot holding the tag, or the empty slot where it would be inserted
+static tag_entry_t *find_slot(tag_entry_t *table, uint32_t capacity, const char *tag)
+{
+    uint32_t idx = hash_tag(tag) & (capacity - 1);
+    while (table[idx].tag != NULL && strcmp(table[idx].tag, tag) != 0) {
+        idx = (idx + 1) & (capacity - 1);
+    }
+    return &table[idx];
+}
+
+static bool grow_table(void)
+{
+    uint32_t new_capacity = (s_capacity == 0) ? CONFIG_LOG_TAG_LEVEL_HASH_TABLE_INIT_SIZE : s_capacity * 2;
+    tag_entry_t *new_table = (tag_entry_t *) calloc(new_capacity, sizeof(tag_entry_t));
+    if (!new_table) {
+        return false;
+    }
+    // rehash the interned tags into the larger table, the strings are reused as is
+    for (uint32_t i = 0; i < s_capacity; i++) {
+        if (s_table[i].tag != NULL) {
+            *find_slot(new_table, new_capacity, s_table[i].tag) = s_table[i];
+        }
+    }
+    free(s_table);
+    s_table = new_table;
+    s_capacity = new_capacity;
+    return true;
+}
+
+bool esp_log_hash_table_set_level(const char *tag, esp_log_level_t level)
+{
+    // keep the load factor below 2/3 so that probe sequences stay short
+    if ((s_count + 1) * 3 > s_capacity * 2) {
+        if (!grow_table()) {
+            return false;
+        }
+    }
+    tag_entry_t *slot = find_slot(s_table, s_capacity, tag);
+    if (slot->tag == NULL) {
+        // intern the tag: the caller's string may live in a temporary buffer
+        size_t tag_len = strlen(tag) + 1;
+        char *tag_copy = (char *) malloc(tag_len);
+        if (!tag_copy) {
+            return false;
+        }
+        memcpy(tag_copy, tag, tag_len);
+        slot->tag = tag_copy;
+        s_count++;
+    }
+    slot->level = (uint8_t) level;
+    return true;
+}
+
+bool esp_log_hash_table_get_level(const char *tag, esp_log_level_t *level)
+{
+    if (s_count == 0) {
+        return false;
+    }
+    tag_entry_t *slot = find_slot(s_table, s_capacity, tag);
+    if (slot->tag == NULL) {
+        return false;
+    }
+    *level = (esp_log_level_t) slot->level;
+    return true;
+}
+
+void esp_log_hash_table_clean(void)
+{
+    for (uint32_t i = 0; i < s_capacity; i++) {
+        free(s_table[i].tag);
+    }
+    free(s_table);
+    s_table = NULL;
+    s_capacity = 0;
+    s_count = 0;
+}
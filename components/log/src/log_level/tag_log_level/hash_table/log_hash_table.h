@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+#include <stdbool.h>
+#include "esp_log_level.h"
+
+/**
+ * @brief Set the log level for a specific log tag using the hash table
+ * approach.
+ *
+ * If the tag already exists in the hash table, its log level will be updated
+ * with the new value. If the tag is not found in the hash table, it is interned:
+ * a copy of the tag string is inserted together with the provided log level.
+ * The table grows automatically once it becomes too full.
+ *
+ * @param tag The log tag for which to set the log level.
+ * @param level The log level to be set for the specified log tag.
+ * @return true   If the log level was successfully set or updated,
+ *         false  Otherwise (out of memory).
+ */
+bool esp_log_hash_table_set_level(const char *tag, esp_log_level_t level);
+
+/**
+ * @brief Get the log level for a specific log tag using the hash table
+ * approach.
+ *
+ * If the tag is found in the hash table, its corresponding log level will be
+ * returned via the `level` pointer argument. The lookup hashes the tag string
+ * and probes at most a few neighboring slots, so the cost does not depend on
+ * the number of tags.
+ *
+ * @param tag The log tag for which to retrieve the log level.
+ * @param level Pointer to a variable where the retrieved log level will be
+ * stored.
+ * @return true  if the log level was successfully retrieved from the hash table,
+ *         false if the tag was not found in the hash table.
+ */
+bool esp_log_hash_table_get_level(const char *tag, esp_log_level_t *level);
+
+/**
+ * @brief Clears the hash table of all tags and frees the memory allocated for
+ * the interned tag strings and the table itself.
+ *
+ * This function clears the hash table of all tags that have been set using
+ * esp_log_level_set() or interned on first lookup.
+ */
+void esp_log_hash_table_clean(void);
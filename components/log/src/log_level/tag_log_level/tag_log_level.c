@@ -18,6 +18,10 @@
 #include "linked_list/log_linked_list.h"
 #endif
 
+#if CONFIG_LOG_TAG_LEVEL_IMPL_HASH_TABLE
+#include "hash_table/log_hash_table.h"
+#endif
+
 #if CONFIG_LOG_TAG_LEVEL_CACHE_ARRAY || CONFIG_LOG_TAG_LEVEL_CACHE_BINARY_MIN_HEAP
 #define CACHE_ENABLED 1
 #include "cache/log_cache.h"
@@ -40,16 +44,24 @@ static inline void log_level_set(const char *tag, esp_log_level_t level)
     // for wildcard tag, remove all linked list items and clear the cache
     if (strcmp(tag, "*") == 0) {
         esp_log_set_default_level(level);
+#if CONFIG_LOG_TAG_LEVEL_IMPL_HASH_TABLE
+        esp_log_hash_table_clean();
+#else
         esp_log_linked_list_clean();
 #if CACHE_ENABLED
         esp_log_cache_clean();
+#endif
 #endif
     } else {
+#if CONFIG_LOG_TAG_LEVEL_IMPL_HASH_TABLE
+        esp_log_hash_table_set_level(tag, level);
+#else
         __attribute__((unused)) bool success = esp_log_linked_list_set_level(tag, level);
 #if CACHE_ENABLED
         if (success) {
             esp_log_cache_set_level(tag, level);
         }
+#endif
 #endif
     }
     esp_log_impl_unlock();
@@ -68,7 +80,13 @@ static esp_log_level_t log_level_get(const char *tag, bool timeout)
     } else {
         esp_log_impl_lock();
     }
-#if CACHE_ENABLED
+#if CONFIG_LOG_TAG_LEVEL_IMPL_HASH_TABLE
+    if (!esp_log_hash_table_get_level(tag, &level_for_tag)) {
+        // First lookup of this tag: intern it with the current default level,
+        // so that the next lookup is a single probe.
+        esp_log_hash_table_set_level(tag, level_for_tag);
+    }
+#elif CACHE_ENABLED
     bool cache_miss = !esp_log_cache_get_level(tag, &level_for_tag);
     if (cache_miss) {
         esp_log_linked_list_get_level(tag, &level_for_tag);
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_rom_serial_output.h"
+#include "esp_private/log_binary_deferred.h"
+#include "sdkconfig.h"
+
+#if CONFIG_LOG_MODE_BINARY_DEFERRED
+
+#define DEFERRED_LOG_BUF_SIZE CONFIG_LOG_MODE_BINARY_DEFERRED_BUF_SIZE
+#define DEFERRED_LOG_TASK_STACK_SIZE 2048
+
+/* Single-producer (whoever holds the log lock) / single-consumer (drain task)
+ * byte ring. Head and tail are free-running indices; the difference gives the
+ * fill level, modulo gives the buffer position.
+ */
+static uint8_t s_buf[DEFERRED_LOG_BUF_SIZE];
+static volatile uint32_t s_head;
+static volatile uint32_t s_tail;
+static TaskHandle_t s_drain_task;
+static uint32_t s_dropped;
+
+static void log_drain_task(void *arg)
+{
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (s_tail != s_head) {
+            esp_rom_output_tx_one_char(s_buf[s_tail % DEFERRED_LOG_BUF_SIZE]);
+            s_tail++;
+        }
+    }
+}
+
+bool esp_log_binary_deferred_reserve(unsigned len)
+{
+    if (s_drain_task == NULL) {
+        /* Lazy creation; the caller holds the log lock, so this runs once */
+        if (xTaskCreate(log_drain_task, "log_drain", DEFERRED_LOG_TASK_STACK_SIZE, NULL,
+                        CONFIG_LOG_MODE_BINARY_DEFERRED_TASK_PRIORITY, &s_drain_task) != pdPASS) {
+            return false;
+        }
+    }
+    if (DEFERRED_LOG_BUF_SIZE - (s_head - s_tail) < len) {
+        /* Dropping the whole packet keeps the stream parseable for the host */
+        s_dropped++;
+        return false;
+    }
+    return true;
+}
+
+void esp_log_binary_deferred_out(uint8_t data)
+{
+    s_buf[s_head % DEFERRED_LOG_BUF_SIZE] = data;
+    s_head++;
+}
+
+void esp_log_binary_deferred_commit(void)
+{
+    xTaskNotifyGive(s_drain_task);
+}
+
+uint32_t esp_log_binary_deferred_dropped_count(void)
+{
+    return s_dropped;
+}
+
+#endif // CONFIG_LOG_MODE_BINARY_DEFERRED
@@ -8,13 +8,19 @@
 #include <stddef.h>
 #include <string.h>
 #include <stdio.h>
+#include "sdkconfig.h"
 #include "esp_log_write.h"
 #include "esp_private/log_lock.h"
 #include "esp_log_level.h"
 #include "esp_log_config.h"
 #include "esp_log.h"
 
+#if CONFIG_LIBC_FAST_PRINTF
+#include "esp_fast_printf.h"
+vprintf_like_t esp_log_vprint_func = &esp_fast_vprintf;
+#else
 vprintf_like_t esp_log_vprint_func = &vprintf;
+#endif
 
 vprintf_like_t esp_log_set_vprintf(vprintf_like_t func)
 {
@@ -5,10 +5,14 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 #include <sys/time.h>
 #include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "soc/soc_caps.h"
 #include "esp_sntp.h"
 
 // Remove compat macro and include lwip API
@@ -32,6 +36,56 @@ static volatile sntp_sync_status_t sntp_sync_status = SNTP_SYNC_STATUS_RESET;
 static sntp_sync_time_cb_t time_sync_notification_cb = NULL;
 static uint32_t s_sync_interval = CONFIG_LWIP_SNTP_UPDATE_DELAY;
 
+/* Burst mode: several rapid exchanges are collected without touching the
+ * clock, then only the sample with the lowest request-to-response latency
+ * (least queueing noise) is applied. Samples are taken in the tcpip thread. */
+typedef struct {
+    struct timeval server_time; /* server time when the response arrived */
+    int64_t arrived_us;         /* esp_timer time the response arrived */
+    int64_t latency_us;         /* request-to-response latency */
+} sntp_burst_sample_t;
+
+static volatile uint8_t s_burst_remaining = 0;
+static sntp_burst_sample_t s_burst_best;
+static int64_t s_burst_request_us;
+
+/* Clock-skew estimate, kept in RTC memory where available so sleep-cycle
+ * nodes can correct the RTC-kept system time between syncs. */
+#if SOC_RTC_MEM_SUPPORTED
+#define SNTP_SKEW_MEM_ATTR RTC_DATA_ATTR
+#else
+#define SNTP_SKEW_MEM_ATTR
+#endif
+static SNTP_SKEW_MEM_ATTR int64_t s_last_sync_wall_us;
+static SNTP_SKEW_MEM_ATTR int32_t s_skew_ppm;
+static SNTP_SKEW_MEM_ATTR bool s_skew_valid;
+
+/* Minimum time between syncs for a meaningful skew sample: short intervals
+ * make the quotient mostly measurement noise */
+#define SNTP_SKEW_MIN_INTERVAL_US   (60 * 1000000LL)
+/* Corrections beyond this are clock steps (lost time, manual set), not
+ * oscillator skew; they would also overflow the ppm computation */
+#define SNTP_SKEW_MAX_CORRECTION_US (3600 * 1000000LL)
+
+static void sntp_update_skew(int64_t correction_us, int64_t new_wall_us)
+{
+    if (s_last_sync_wall_us != 0 &&
+            correction_us < SNTP_SKEW_MAX_CORRECTION_US && correction_us > -SNTP_SKEW_MAX_CORRECTION_US) {
+        int64_t elapsed_us = new_wall_us - correction_us - s_last_sync_wall_us;
+        if (elapsed_us > SNTP_SKEW_MIN_INTERVAL_US) {
+            int32_t inst_ppm = (int32_t)(correction_us * 1000000LL / elapsed_us);
+            if (s_skew_valid) {
+                /* exponential smoothing keeps single outliers from dominating */
+                s_skew_ppm = (3 * s_skew_ppm + inst_ppm) / 4;
+            } else {
+                s_skew_ppm = inst_ppm;
+                s_skew_valid = true;
+            }
+        }
+    }
+    s_last_sync_wall_us = new_wall_us;
+}
+
 inline void sntp_set_sync_status(sntp_sync_status_t sync_status)
 {
     sntp_sync_status = sync_status;
@@ -39,7 +93,39 @@ inline void sntp_set_sync_status(sntp_sync_status_t sync_status)
 
 void __attribute__((weak)) sntp_sync_time(struct timeval *tv)
 {
+    if (s_burst_remaining > 0) {
+        int64_t now_us = esp_timer_get_time();
+        int64_t latency_us = now_us - s_burst_request_us;
+        if (s_burst_best.arrived_us == 0 || latency_us < s_burst_best.latency_us) {
+            s_burst_best.server_time = *tv;
+            s_burst_best.arrived_us = now_us;
+            s_burst_best.latency_us = latency_us;
+        }
+        if (--s_burst_remaining > 0) {
+            s_burst_request_us = esp_timer_get_time();
+            sntp_restart();
+            return;
+        }
+        /* Apply the best sample, advanced by the time that passed since it arrived */
+        int64_t elapsed_us = esp_timer_get_time() - s_burst_best.arrived_us;
+        int64_t best_us = (int64_t)s_burst_best.server_time.tv_sec * 1000000L +
+                          s_burst_best.server_time.tv_usec + elapsed_us;
+        struct timeval tv_best = { .tv_sec = best_us / 1000000L, .tv_usec = best_us % 1000000L };
+        struct timeval tv_now;
+        gettimeofday(&tv_now, NULL);
+        sntp_update_skew(best_us - ((int64_t)tv_now.tv_sec * 1000000L + tv_now.tv_usec), best_us);
+        settimeofday(&tv_best, NULL);
+        sntp_set_sync_status(SNTP_SYNC_STATUS_COMPLETED);
+        if (time_sync_notification_cb) {
+            time_sync_notification_cb(&tv_best);
+        }
+        return;
+    }
     if (sntp_sync_mode == SNTP_SYNC_MODE_IMMED) {
+        struct timeval tv_now;
+        gettimeofday(&tv_now, NULL);
+        int64_t new_wall_us = (int64_t)tv->tv_sec * 1000000L + tv->tv_usec;
+        sntp_update_skew(new_wall_us - ((int64_t)tv_now.tv_sec * 1000000L + tv_now.tv_usec), new_wall_us);
         settimeofday(tv, NULL);
         sntp_set_sync_status(SNTP_SYNC_STATUS_COMPLETED);
     } else if (sntp_sync_mode == SNTP_SYNC_MODE_SMOOTH) {
@@ -181,6 +267,7 @@ void esp_sntp_init(void)
 
 static void do_stop(void *ctx)
 {
+    s_burst_remaining = 0;
     sntp_stop();
 }
 
@@ -274,3 +361,43 @@ bool esp_sntp_enabled(void)
 {
     return sntp_enabled();
 }
+
+bool sntp_burst_active(void)
+{
+    return s_burst_remaining > 0;
+}
+
+void esp_sntp_stop_burst(void)
+{
+    s_burst_remaining = 0;
+}
+
+esp_err_t esp_sntp_start_burst(uint8_t exchanges)
+{
+    if (exchanges == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!sntp_enabled() || sntp_get_sync_mode() != SNTP_SYNC_MODE_IMMED || s_burst_remaining > 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    memset(&s_burst_best, 0, sizeof(s_burst_best));
+    s_burst_request_us = esp_timer_get_time();
+    s_burst_remaining = exchanges;
+    if (!sntp_restart()) {
+        s_burst_remaining = 0;
+        return ESP_ERR_INVALID_STATE;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_sntp_get_clock_skew(int32_t *skew_ppm)
+{
+    if (skew_ppm == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_skew_valid) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *skew_ppm = s_skew_ppm;
+    return ESP_OK;
+}
@@ -0,0 +1,277 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host benchmark for the lwIP stack on the linux target. All traffic stays
+ * on lwIP's loopback interface (127.0.0.1), so both ends of every connection
+ * run through the full lwIP TCP/IP code — nothing touches the host network
+ * stack. That makes the app suitable for profiling algorithmic changes in
+ * lwIP with perf or valgrind: gigabyte-scale bulk transfers exercise the
+ * segmentation/reassembly and window handling paths, and the ping-pong
+ * scenario exposes per-segment processing latency.
+ *
+ * Scenarios (tunable via environment variables):
+ *   tcp_bulk       LWIP_PERF_TOTAL_MB (default 1024) MB sent through one
+ *                  loopback TCP connection in LWIP_PERF_CHUNK (default 16384)
+ *                  byte writes; reports MB/s.
+ *   tcp_pingpong   LWIP_PERF_RTTS (default 100000) round trips of a 64-byte
+ *                  message; reports us per round trip.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <inttypes.h>
+
+#include "esp_log.h"
+#include "esp_netif.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "lwip/sockets.h"
+
+#define PERF_PORT           23460
+#define PINGPONG_MSG_SIZE   64
+
+static const char *TAG = "lwip_perf";
+
+typedef struct {
+    SemaphoreHandle_t listen_ready;
+    SemaphoreHandle_t done;
+    uint64_t total_bytes;       /* tcp_bulk: bytes the sink should consume */
+    uint32_t rtts;              /* tcp_pingpong: round trips to echo */
+    int listen_sock;
+} perf_ctx_t;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t env_u64(const char *name, uint64_t def)
+{
+    const char *val = getenv(name);
+    return val ? strtoull(val, NULL, 0) : def;
+}
+
+static int listen_loopback(void)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(PERF_PORT),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (sock < 0) {
+        return -1;
+    }
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(sock, 1) != 0) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+static int connect_loopback(void)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(PERF_PORT),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (sock < 0) {
+        return -1;
+    }
+    if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+/* Accepts one connection and discards total_bytes of received data */
+static void bulk_sink_task(void *arg)
+{
+    perf_ctx_t *ctx = (perf_ctx_t *)arg;
+    static uint8_t buf[16384];
+    uint64_t received = 0;
+
+    ctx->listen_sock = listen_loopback();
+    xSemaphoreGive(ctx->listen_ready);
+    if (ctx->listen_sock >= 0) {
+        int sock = accept(ctx->listen_sock, NULL, NULL);
+        if (sock >= 0) {
+            while (received < ctx->total_bytes) {
+                int len = recv(sock, buf, sizeof(buf), 0);
+                if (len <= 0) {
+                    break;
+                }
+                received += len;
+            }
+            close(sock);
+        }
+        close(ctx->listen_sock);
+    }
+    if (received < ctx->total_bytes) {
+        ESP_LOGE(TAG, "bulk sink stopped early: %" PRIu64 "/%" PRIu64 " bytes",
+                 received, ctx->total_bytes);
+    }
+    xSemaphoreGive(ctx->done);
+    vTaskDelete(NULL);
+}
+
+static int run_tcp_bulk(perf_ctx_t *ctx, uint64_t total_bytes, uint32_t chunk_size)
+{
+    uint8_t *chunk = malloc(chunk_size);
+    if (chunk == NULL) {
+        return -1;
+    }
+    memset(chunk, 0x5a, chunk_size);
+
+    ctx->total_bytes = total_bytes;
+    if (xTaskCreate(bulk_sink_task, "bulk_sink", 8192, ctx,
+                    tskIDLE_PRIORITY + 2, NULL) != pdPASS) {
+        free(chunk);
+        return -1;
+    }
+    xSemaphoreTake(ctx->listen_ready, portMAX_DELAY);
+
+    int sock = connect_loopback();
+    if (sock < 0) {
+        ESP_LOGE(TAG, "tcp_bulk: failed to connect to loopback sink");
+        free(chunk);
+        return -1;
+    }
+
+    uint64_t sent = 0;
+    uint64_t start = now_ns();
+    while (sent < total_bytes) {
+        size_t to_send = (total_bytes - sent) < chunk_size ? (size_t)(total_bytes - sent)
+                                                           : chunk_size;
+        int len = send(sock, chunk, to_send, 0);
+        if (len <= 0) {
+            ESP_LOGE(TAG, "tcp_bulk: send failed after %" PRIu64 " bytes", sent);
+            break;
+        }
+        sent += len;
+    }
+    close(sock);
+    xSemaphoreTake(ctx->done, portMAX_DELAY);
+    uint64_t elapsed = now_ns() - start;
+
+    free(chunk);
+    if (sent < total_bytes) {
+        return -1;
+    }
+    printf("tcp_bulk        bytes=%-12" PRIu64 " total_ms=%-8" PRIu64 " MB/s=%" PRIu64 "\n",
+           sent, elapsed / 1000000ULL,
+           elapsed ? (sent * 1000000000ULL) / elapsed / (1024 * 1024) : 0);
+    return 0;
+}
+
+/* Accepts one connection and echoes rtts messages back to the sender */
+static void pingpong_echo_task(void *arg)
+{
+    perf_ctx_t *ctx = (perf_ctx_t *)arg;
+    uint8_t buf[PINGPONG_MSG_SIZE];
+
+    ctx->listen_sock = listen_loopback();
+    xSemaphoreGive(ctx->listen_ready);
+    if (ctx->listen_sock >= 0) {
+        int sock = accept(ctx->listen_sock, NULL, NULL);
+        if (sock >= 0) {
+            for (uint32_t i = 0; i < ctx->rtts; i++) {
+                int len = recv(sock, buf, sizeof(buf), MSG_WAITALL);
+                if (len != PINGPONG_MSG_SIZE ||
+                    send(sock, buf, PINGPONG_MSG_SIZE, 0) != PINGPONG_MSG_SIZE) {
+                    break;
+                }
+            }
+            close(sock);
+        }
+        close(ctx->listen_sock);
+    }
+    xSemaphoreGive(ctx->done);
+    vTaskDelete(NULL);
+}
+
+static int run_tcp_pingpong(perf_ctx_t *ctx, uint32_t rtts)
+{
+    uint8_t msg[PINGPONG_MSG_SIZE] = { 0 };
+
+    ctx->rtts = rtts;
+    if (xTaskCreate(pingpong_echo_task, "pp_echo", 8192, ctx,
+                    tskIDLE_PRIORITY + 2, NULL) != pdPASS) {
+        return -1;
+    }
+    xSemaphoreTake(ctx->listen_ready, portMAX_DELAY);
+
+    int sock = connect_loopback();
+    if (sock < 0) {
+        ESP_LOGE(TAG, "tcp_pingpong: failed to connect to loopback echo");
+        return -1;
+    }
+    /* Each message must go out as its own segment for the RTT to be honest */
+    int flag = 1;
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+
+    uint32_t completed = 0;
+    uint64_t start = now_ns();
+    for (uint32_t i = 0; i < rtts; i++) {
+        if (send(sock, msg, sizeof(msg), 0) != sizeof(msg) ||
+            recv(sock, msg, sizeof(msg), MSG_WAITALL) != sizeof(msg)) {
+            ESP_LOGE(TAG, "tcp_pingpong: round trip %" PRIu32 " failed", i);
+            break;
+        }
+        completed++;
+    }
+    uint64_t elapsed = now_ns() - start;
+    close(sock);
+    xSemaphoreTake(ctx->done, portMAX_DELAY);
+
+    if (completed < rtts) {
+        return -1;
+    }
+    printf("tcp_pingpong    rtts=%-12" PRIu32 " total_ms=%-8" PRIu64 " us/rtt=%" PRIu64 "\n",
+           completed, elapsed / 1000000ULL,
+           completed ? elapsed / completed / 1000ULL : 0);
+    return 0;
+}
+
+void app_main(void)
+{
+    uint64_t total_bytes = env_u64("LWIP_PERF_TOTAL_MB", 1024) * 1024 * 1024;
+    uint32_t chunk_size = (uint32_t)env_u64("LWIP_PERF_CHUNK", 16384);
+    uint32_t rtts = (uint32_t)env_u64("LWIP_PERF_RTTS", 100000);
+
+    ESP_ERROR_CHECK(esp_netif_init());
+
+    perf_ctx_t ctx = {
+        .listen_ready = xSemaphoreCreateBinary(),
+        .done = xSemaphoreCreateBinary(),
+    };
+
+    ESP_LOGI(TAG, "total_bytes=%" PRIu64 " chunk_size=%" PRIu32 " rtts=%" PRIu32,
+             total_bytes, chunk_size, rtts);
+
+    int failures = 0;
+    if (run_tcp_bulk(&ctx, total_bytes, chunk_size) != 0) {
+        failures++;
+    }
+    if (run_tcp_pingpong(&ctx, rtts) != 0) {
+        failures++;
+    }
+
+    vSemaphoreDelete(ctx.listen_ready);
+    vSemaphoreDelete(ctx.done);
+
+    ESP_LOGI(TAG, "done, %d scenario(s) failed", failures);
+    exit(failures == 0 ? 0 : 1);
+}
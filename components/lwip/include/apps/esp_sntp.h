@@ -9,6 +9,7 @@
 
 #include "lwip/err.h"
 #include "lwip/ip.h"
+#include "esp_err.h"
 
 
 #ifdef __cplusplus
@@ -218,6 +219,53 @@ const ip_addr_t* esp_sntp_getserver(u8_t idx);
  */
 bool esp_sntp_enabled(void);
 
+/**
+ * @brief Run a burst of rapid SNTP exchanges and apply the best sample
+ *
+ * The clock is left untouched while the given number of exchanges runs
+ * back-to-back; only the sample with the lowest request-to-response latency
+ * is applied, which filters out queueing noise from single-sample syncs.
+ * Completion is reported through the usual time sync notification callback
+ * (or NETIF_SNTP_TIME_SYNC when using esp_netif_sntp), fired once for the
+ * applied sample. Burst mode requires the immediate sync mode and the
+ * default sntp_sync_time() implementation.
+ *
+ * @note If CONFIG_LWIP_SNTP_STARTUP_DELAY is enabled, its random delay is
+ *       skipped while a burst is active so the exchanges stay rapid.
+ *
+ * @param exchanges Number of exchanges to run (must be non-zero)
+ * @return ESP_OK on success,
+ *         ESP_ERR_INVALID_ARG when exchanges is zero,
+ *         ESP_ERR_INVALID_STATE when sntp is not enabled, not in immediate
+ *         sync mode, or a burst is already running
+ */
+esp_err_t esp_sntp_start_burst(uint8_t exchanges);
+
+/**
+ * @brief Abort a running burst without applying a sample
+ *
+ * Later responses are processed as ordinary syncs again. Also implied by
+ * esp_sntp_stop().
+ */
+void esp_sntp_stop_burst(void);
+
+/**
+ * @brief Get the estimated system clock skew against server time
+ *
+ * The estimate is updated on every applied sync (burst or plain immediate)
+ * from the correction and the time elapsed since the previous sync, and is
+ * kept in RTC memory where available, so it survives deep sleep. Sleep-cycle
+ * nodes can use it to correct the RTC-kept system time and extend the
+ * interval between radio-on syncs.
+ *
+ * @param skew_ppm Filled with the estimated skew in parts per million
+ *                 (positive means the local clock runs slow)
+ * @return ESP_OK on success,
+ *         ESP_ERR_INVALID_ARG when skew_ppm is NULL,
+ *         ESP_ERR_INVALID_STATE when no estimate is available yet
+ */
+esp_err_t esp_sntp_get_clock_skew(int32_t *skew_ppm);
+
 /**
  * @brief Gets the server reachability shift register as described in RFC 5905.
  * @param idx Index of the SNTP server
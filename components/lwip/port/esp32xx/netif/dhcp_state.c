@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <time.h>
 #include "nvs.h"
 #include "lwip/dhcp.h"
 #include "lwip/netif.h"
@@ -11,6 +13,7 @@
 
 #define DHCP_NAMESPACE "dhcp_state"
 #define IF_KEY_SIZE 3
+#define LEASE_KEY_SIZE (IF_KEY_SIZE + 2)
 
 /*
  * As a NVS key, use string representation of the interface index number
@@ -21,6 +24,101 @@ static inline char *gen_if_key(struct netif *netif, char *name)
     return name;
 }
 
+#ifdef CONFIG_LWIP_DHCP_RESTORE_LAST_LEASE
+/*
+ * Complete lease record, stored next to the plain address under the
+ * "<if>_l" key. Wall-clock bounds let the boot-time restore compute the
+ * remaining lease time; both are checked so a cold boot with a reset
+ * system clock fails the validation and falls back to discovery.
+ */
+typedef struct {
+    uint32_t ip;
+    uint32_t netmask;
+    uint32_t gw;
+    uint32_t server_ip;
+    int64_t stored_at;      /* wall-clock time the lease was bound */
+    int64_t valid_until;    /* wall-clock time the lease expires */
+} dhcp_lease_state_t;
+
+static inline char *gen_lease_key(struct netif *netif, char *name)
+{
+    lwip_itoa(name, IF_KEY_SIZE, netif->num);
+    strcat(name, "_l");
+    return name;
+}
+
+static void dhcp_lease_store(struct netif *netif)
+{
+    nvs_handle_t nvs;
+    char lease_key[LEASE_KEY_SIZE];
+    struct dhcp *dhcp = netif_dhcp_data(netif);
+
+    dhcp_lease_state_t lease = {
+        .ip = dhcp->offered_ip_addr.addr,
+        .netmask = ip4_addr_get_u32(netif_ip4_netmask(netif)),
+        .gw = ip4_addr_get_u32(netif_ip4_gw(netif)),
+        .server_ip = ip_addr_get_ip4_u32(&dhcp->server_ip_addr),
+        .stored_at = (int64_t)time(NULL),
+    };
+    lease.valid_until = lease.stored_at + dhcp->offered_t0_lease;
+
+    if (nvs_open(DHCP_NAMESPACE, NVS_READWRITE, &nvs) == ESP_OK) {
+        nvs_set_blob(nvs, gen_lease_key(netif, lease_key), &lease, sizeof(lease));
+        nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+}
+
+bool dhcp_lease_restore(struct netif *netif)
+{
+    nvs_handle_t nvs;
+    char lease_key[LEASE_KEY_SIZE];
+    dhcp_lease_state_t lease;
+    size_t length = sizeof(lease);
+    bool ok = false;
+    if (netif == NULL) {
+        return false;
+    }
+    struct dhcp *dhcp = netif_dhcp_data(netif);
+
+    if (nvs_open(DHCP_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return false;
+    }
+    if (nvs_get_blob(nvs, gen_lease_key(netif, lease_key), &lease, &length) == ESP_OK &&
+            length == sizeof(lease)) {
+        int64_t now = (int64_t)time(NULL);
+        /* Leave at least one coarse timer period of lease time so the
+         * background renew can complete before the lease runs out */
+        if (now >= lease.stored_at && now + DHCP_COARSE_TIMER_SECS < lease.valid_until) {
+            ip4_addr_t ip, netmask, gw;
+            ip4_addr_set_u32(&ip, lease.ip);
+            ip4_addr_set_u32(&netmask, lease.netmask);
+            ip4_addr_set_u32(&gw, lease.gw);
+            ip4_addr_set_u32(&dhcp->offered_ip_addr, lease.ip);
+            ip4_addr_set_u32(&dhcp->offered_sn_mask, lease.netmask);
+            ip4_addr_set_u32(&dhcp->offered_gw_addr, lease.gw);
+            ip_addr_set_ip4_u32(&dhcp->server_ip_addr, lease.server_ip);
+            dhcp->offered_t0_lease = (uint32_t)(lease.valid_until - now);
+            dhcp->offered_t1_renew = dhcp->offered_t0_lease / 2;
+            dhcp->offered_t2_rebind = (dhcp->offered_t0_lease * 7) / 8;
+            /* Arm the coarse timer like dhcp_bind() would, so the lease
+             * still rebinds and expires normally even when the immediate
+             * renew request goes unanswered */
+            DHCP_SET_TIMEOUT_FROM_OFFERED_T0_LEASE(dhcp->t0_timeout, dhcp);
+            DHCP_SET_TIMEOUT_FROM_OFFERED_T1_RENEW(dhcp->t1_timeout, dhcp);
+            DHCP_SET_TIMEOUT_FROM_OFFERED_T2_REBIND(dhcp->t2_timeout, dhcp);
+            dhcp->t1_renew_time = dhcp->t1_timeout;
+            dhcp->t2_rebind_time = dhcp->t2_timeout;
+            dhcp->lease_used = 0;
+            netif_set_addr(netif, &ip, &netmask, &gw);
+            ok = true;
+        }
+    }
+    nvs_close(nvs);
+    return ok;
+}
+#endif /* CONFIG_LWIP_DHCP_RESTORE_LAST_LEASE */
+
 bool dhcp_ip_addr_restore(struct netif *netif)
 {
     nvs_handle_t nvs;
@@ -56,6 +154,9 @@ void dhcp_ip_addr_store(struct netif *netif)
         nvs_commit(nvs);
         nvs_close(nvs);
     }
+#ifdef CONFIG_LWIP_DHCP_RESTORE_LAST_LEASE
+    dhcp_lease_store(netif);
+#endif
 }
 
 void dhcp_ip_addr_erase(struct netif *netif)
@@ -67,6 +168,10 @@ void dhcp_ip_addr_erase(struct netif *netif)
     }
     if (nvs_open(DHCP_NAMESPACE, NVS_READWRITE, &nvs) == ESP_OK) {
         nvs_erase_key(nvs, gen_if_key(netif, if_key));
+#ifdef CONFIG_LWIP_DHCP_RESTORE_LAST_LEASE
+        char lease_key[LEASE_KEY_SIZE];
+        nvs_erase_key(nvs, gen_lease_key(netif, lease_key));
+#endif
         nvs_commit(nvs);
         nvs_close(nvs);
     }
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include "esp_chksum.h"
+
+/*
+ * Word-at-a-time Internet checksum.
+ *
+ * The ones' complement sum is associative and byte-order independent as long
+ * as the result of a byte-swapped computation is swapped back, so the data can
+ * be summed with aligned 32-bit loads regardless of how the caller's buffer is
+ * aligned: an odd leading byte is accounted for as the high octet of a
+ * halfword and the final sum is byte-swapped to compensate.
+ */
+uint16_t esp_ip_chksum(const void *dataptr, int len)
+{
+    const uint8_t *pb = (const uint8_t *)dataptr;
+    uint32_t sum = 0;
+    uint32_t word;
+    int odd = ((uintptr_t)pb & 1);
+
+    if (odd && len > 0) {
+        sum = (uint32_t)(*pb++) << 8;
+        len--;
+    }
+
+    /* reach 32-bit alignment (pb is 16-bit aligned here) */
+    if (len >= 2 && ((uintptr_t)pb & 2)) {
+        sum += *(const uint16_t *)pb;
+        pb += 2;
+        len -= 2;
+    }
+
+    const uint32_t *pw = (const uint32_t *)pb;
+    while (len >= 16) {
+        word = pw[0]; sum += word; if (sum < word) { sum++; }
+        word = pw[1]; sum += word; if (sum < word) { sum++; }
+        word = pw[2]; sum += word; if (sum < word) { sum++; }
+        word = pw[3]; sum += word; if (sum < word) { sum++; }
+        pw += 4;
+        len -= 16;
+    }
+    while (len >= 4) {
+        word = *pw++;
+        sum += word;
+        if (sum < word) {
+            sum++;
+        }
+        len -= 4;
+    }
+
+    pb = (const uint8_t *)pw;
+    if (len >= 2) {
+        word = *(const uint16_t *)pb;
+        sum += word;
+        if (sum < word) {
+            sum++;
+        }
+        pb += 2;
+        len -= 2;
+    }
+    if (len > 0) {
+        word = *pb;
+        sum += word;
+        if (sum < word) {
+            sum++;
+        }
+    }
+
+    /* fold the 32-bit sum to 16 bits */
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+
+    if (odd) {
+        sum = ((sum & 0xff) << 8) | ((sum >> 8) & 0xff);
+    }
+    return (uint16_t)sum;
+}
@@ -53,6 +53,9 @@ void sys_delay_ms(uint32_t ms);
 #define sys_mbox_valid(mbox)       (*(mbox) != NULL)
 #define sys_mbox_set_invalid(mbox) (*(mbox) = NULL)
 
+int sys_mbox_resize(sys_mbox_t *mbox, int size);
+int sys_mbox_depth(sys_mbox_t *mbox);
+
 /**
  * @brief Check if a static semaphore is valid (initialized)
  *
@@ -13,6 +13,7 @@
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "freertos/queue.h"
+#include "freertos/idf_additions.h"
 #include "lwip/debug.h"
 #include "lwip/def.h"
 #include "lwip/sys.h"
@@ -27,6 +28,10 @@
 
 static const char* TAG = "lwip_arch";
 
+/* lwIP mutexes guard short critical sections; on multi-core targets spin
+ * briefly on contention before paying for a context switch */
+#define SYS_MUTEX_MAX_SPINS semADAPTIVE_MUTEX_DEFAULT_SPINS
+
 static sys_mutex_t g_lwip_protect_mutex = NULL;
 
 static pthread_key_t sys_thread_sem_key;
@@ -62,7 +67,7 @@ sys_mutex_new(sys_mutex_t *pxMutex)
 void
 sys_mutex_lock(sys_mutex_t *pxMutex)
 {
-  BaseType_t ret = xSemaphoreTake(*pxMutex, portMAX_DELAY);
+  BaseType_t ret = xSemaphoreTakeAdaptive(*pxMutex, portMAX_DELAY, SYS_MUTEX_MAX_SPINS);
 
   LWIP_ASSERT("failed to take the mutex", ret == pdTRUE);
   (void)ret;
@@ -378,6 +383,53 @@ sys_mbox_free(sys_mbox_t *mbox)
   (void)msgs_waiting;
 }
 
+/**
+ * @brief Change the depth of an existing mailbox
+ *
+ * FreeRTOS queues cannot grow in place, so a new queue of the requested
+ * depth is allocated and messages already waiting are migrated before the
+ * old queue is deleted. The caller must guarantee that no task is blocked
+ * on the mailbox and that nothing posts to it for the duration of the call
+ * (e.g. by running in tcpip thread context).
+ *
+ * @param mbox pointer of the mailbox to resize
+ * @param size new depth of the mailbox (number of messages)
+ * @return 0 on success, -1 when out of memory or when more messages are
+ *         already queued than the new depth can hold
+ */
+int
+sys_mbox_resize(sys_mbox_t *mbox, int size)
+{
+  sys_mbox_t new_mbox;
+  void *msg;
+
+  if (uxQueueMessagesWaiting((QueueHandle_t)&(*mbox)->os_mbox) > (UBaseType_t)size) {
+    return -1;
+  }
+  if (sys_mbox_new(&new_mbox, size) != ERR_OK) {
+    return -1;
+  }
+  while (xQueueReceive((QueueHandle_t)&(*mbox)->os_mbox, &msg, 0) == pdTRUE) {
+    xQueueSendToBack((QueueHandle_t)&new_mbox->os_mbox, &msg, 0);
+  }
+  sys_mbox_free(mbox);
+  *mbox = new_mbox;
+  return 0;
+}
+
+/**
+ * @brief Query the depth of a mailbox
+ *
+ * @param mbox pointer of the mailbox
+ * @return total number of message slots
+ */
+int
+sys_mbox_depth(sys_mbox_t *mbox)
+{
+  return (int)(uxQueueMessagesWaiting((QueueHandle_t)&(*mbox)->os_mbox) +
+               uxQueueSpacesAvailable((QueueHandle_t)&(*mbox)->os_mbox));
+}
+
 /**
  * @brief Create a new thread
  *
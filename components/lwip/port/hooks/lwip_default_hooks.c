@@ -91,6 +91,125 @@ int __weak lwip_hook_ip6_input(struct pbuf *p, struct netif *inp)
 }
 #endif
 
+#if defined(CONFIG_LWIP_HOOK_IP4_INPUT_DEFAULT) && defined(CONFIG_LWIP_IPV4)
+#include "lwip/prot/ip4.h"
+#include "lwip/stats.h"
+#include "lwip/sys.h"
+
+/*
+ * Admission guard in front of the core IPv4 reassembler. Each reassembly in
+ * progress ("flow": source address + identification + protocol) is tracked in
+ * a static table; fragments only pass through while the table and the global
+ * byte budget have room, so the memory the reassembler can tie up is bounded
+ * regardless of how many fragmented bursts arrive, and the main pbuf supply
+ * stays available for TCP. When the budget is exhausted the least recently
+ * active flow is evicted and its remaining fragments are dropped until the
+ * entry ages out, matching the reassembly timeout of the core so the
+ * accounting expires together with the buffers it describes.
+ */
+#define FRAG_GUARD_FLOW_TIMEOUT_MS 3000
+
+enum {
+    FLOW_FREE = 0,
+    FLOW_ADMITTED, /* fragments pass through to the reassembler */
+    FLOW_BLOCKED,  /* evicted or over quota: fragments are dropped */
+};
+
+typedef struct {
+    ip4_addr_t src;
+    u32_t last_ms;
+    u16_t id;
+    u16_t bytes;
+    u8_t proto;
+    u8_t state;
+} frag_guard_flow_t;
+
+static frag_guard_flow_t s_frag_flows[CONFIG_LWIP_IP4_FRAG_GUARD_MAX_FLOWS];
+
+int __weak lwip_hook_ip4_input(struct pbuf *p, struct netif *inp)
+{
+    LWIP_UNUSED_ARG(inp);
+    const struct ip_hdr *iphdr = (const struct ip_hdr *)p->payload;
+
+    if ((p->len < IP_HLEN) ||
+        ((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) == 0)) {
+        return 0; /* not a fragment; none of our business */
+    }
+
+    u32_t now = sys_now();
+    u32_t admitted_bytes = 0;
+    int src_flows = 0;
+    frag_guard_flow_t *flow = NULL;
+    frag_guard_flow_t *victim = NULL; /* free slot, or oldest entry */
+
+    for (int i = 0; i < CONFIG_LWIP_IP4_FRAG_GUARD_MAX_FLOWS; i++) {
+        frag_guard_flow_t *e = &s_frag_flows[i];
+        if ((e->state != FLOW_FREE) &&
+            ((u32_t)(now - e->last_ms) > FRAG_GUARD_FLOW_TIMEOUT_MS)) {
+            e->state = FLOW_FREE;
+        }
+        if (e->state == FLOW_FREE) {
+            if ((victim == NULL) || (victim->state != FLOW_FREE)) {
+                victim = e;
+            }
+            continue;
+        }
+        if (ip4_addr_eq(&e->src, &iphdr->src)) {
+            if ((e->id == IPH_ID(iphdr)) && (e->proto == IPH_PROTO(iphdr))) {
+                flow = e;
+            }
+            src_flows++;
+        }
+        if (e->state == FLOW_ADMITTED) {
+            admitted_bytes += e->bytes;
+        }
+        if ((victim == NULL) ||
+            ((victim->state != FLOW_FREE) && (e->last_ms < victim->last_ms))) {
+            victim = e;
+        }
+    }
+
+    u16_t frag_bytes = lwip_ntohs(IPH_LEN(iphdr));
+
+    if (flow != NULL) {
+        if (flow->state == FLOW_BLOCKED) {
+            goto drop;
+        }
+        if (admitted_bytes + frag_bytes > CONFIG_LWIP_IP4_FRAG_GUARD_BUDGET) {
+            /* Over budget: stop feeding this flow rather than let it push
+             * the reassembler past the bound */
+            flow->state = FLOW_BLOCKED;
+            goto drop;
+        }
+        flow->bytes += frag_bytes;
+        flow->last_ms = now;
+        return 0;
+    }
+
+    /* New flow */
+    if (src_flows >= CONFIG_LWIP_IP4_FRAG_GUARD_PER_SRC_FLOWS) {
+        IPFRAG_STATS_INC(ip_frag.proterr);
+        goto drop;
+    }
+    if (admitted_bytes + frag_bytes > CONFIG_LWIP_IP4_FRAG_GUARD_BUDGET) {
+        goto drop;
+    }
+    /* victim is a free slot if one exists, otherwise the LRU entry */
+    ip4_addr_copy(victim->src, iphdr->src);
+    victim->id = IPH_ID(iphdr);
+    victim->proto = IPH_PROTO(iphdr);
+    victim->bytes = frag_bytes;
+    victim->last_ms = now;
+    victim->state = FLOW_ADMITTED;
+    return 0;
+
+drop:
+    IPFRAG_STATS_INC(ip_frag.drop);
+    pbuf_free(p);
+    return 1;
+}
+#endif /* CONFIG_LWIP_HOOK_IP4_INPUT_DEFAULT && CONFIG_LWIP_IPV4 */
+
 #ifdef CONFIG_LWIP_IPV4
 
 #ifdef LWIP_HOOK_IP4_ROUTE_SRC
@@ -354,7 +354,27 @@ extern "C" {
  * CONFIG_LWIP_DHCP_RESTORE_LAST_IP==1: Last valid IP address obtained from DHCP server
  * is restored after reset/power-up.
  */
-#ifdef CONFIG_LWIP_DHCP_RESTORE_LAST_IP
+#if defined(CONFIG_LWIP_DHCP_RESTORE_LAST_LEASE)
+/*
+ * Make the post-init hook try to restore the complete stored lease first
+ * - if its remaining time is still good the netif comes up bound with the
+ *   stored address right away and the lease is validated by an immediate
+ *   renew running in the background (a NAK restarts discovery)
+ * - otherwise fall back to restoring just the address, which is validated
+ *   with an init-reboot REQUEST before it is used
+ * - if nothing is stored, return false to continue normally to the discovery state
+ */
+#define LWIP_HOOK_DHCP_POST_INIT(netif, result) \
+    (dhcp_lease_restore(netif) ? ( dhcp_set_state(dhcp, DHCP_STATE_BOUND), \
+                                   dhcp_renew(netif), \
+                                   (result) = ERR_OK , \
+        true ) : \
+     dhcp_ip_addr_restore(netif) ? ( dhcp_set_state(dhcp, DHCP_STATE_BOUND), \
+                                     dhcp_network_changed_link_up(netif), \
+                                     (result) = ERR_OK , \
+        true ) : \
+        false)
+#elif defined(CONFIG_LWIP_DHCP_RESTORE_LAST_IP)
 /*
  * Make the post-init hook check if we could restore the previously bound address
  * - if yes reset the state to bound and mark result as ERR_OK (which skips discovery state)
@@ -1219,6 +1239,15 @@ static inline uint32_t timeout_from_offered(uint32_t lease, uint32_t min)
 #define CHECKSUM_CHECK_ICMP             0
 #endif
 
+/**
+ * LWIP_CHKSUM: Compute checksums with the word-at-a-time port routine
+ * instead of the byte-wise lwIP default.
+ */
+#ifdef CONFIG_LWIP_OPTIMIZED_CHKSUM
+#include "esp_chksum.h"
+#define LWIP_CHKSUM                     esp_ip_chksum
+#endif
+
 /*
    ---------------------------------------
    ---------- IPv6 options ---------------
@@ -1610,7 +1639,10 @@ static inline uint32_t timeout_from_offered(uint32_t lease, uint32_t min)
 #ifdef CONFIG_LWIP_SNTP_STARTUP_DELAY
 #define SNTP_STARTUP_DELAY 1
 #ifdef CONFIG_LWIP_SNTP_MAXIMUM_STARTUP_DELAY
-#define SNTP_STARTUP_DELAY_FUNC     (LWIP_RAND() % CONFIG_LWIP_SNTP_MAXIMUM_STARTUP_DELAY)
+#define SNTP_STARTUP_DELAY_FUNC     (sntp_burst_active() ? 0 : (LWIP_RAND() % CONFIG_LWIP_SNTP_MAXIMUM_STARTUP_DELAY))
+#else
+/* Keep burst exchanges rapid also with the default random delay */
+#define SNTP_STARTUP_DELAY_FUNC     (sntp_burst_active() ? 0 : (LWIP_RAND() % 5000))
 #endif /* CONFIG_LWIP_SNTP_MAXIMUM_STARTUP_DELAY */
 #else
 #define SNTP_STARTUP_DELAY 0
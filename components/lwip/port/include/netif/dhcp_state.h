@@ -20,6 +20,16 @@ void dhcp_ip_addr_store(struct netif *netif);
 
 void dhcp_ip_addr_erase(struct netif *netif);
 
+#ifdef CONFIG_LWIP_DHCP_RESTORE_LAST_LEASE
+/*
+ * Restore the complete stored lease (address, server, remaining lease time)
+ * into the netif's dhcp struct and assign the address to the netif, so the
+ * stack can come up bound and validate the lease with a background renew.
+ * Returns false when no lease is stored or its remaining time ran out.
+ */
+bool dhcp_lease_restore(struct netif *netif);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -8,6 +8,7 @@
 #define __SNTP_GET_SET_TIME_H__
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +41,12 @@ void sntp_set_system_time(uint32_t sec, uint32_t us);
  */
 void sntp_get_system_time(uint32_t* sec, uint32_t* us);
 
+/**
+ * @brief Tells whether a burst sync is running, used in SNTP_STARTUP_DELAY_FUNC
+ * to skip the random startup delay between burst exchanges
+ */
+bool sntp_burst_active(void);
+
 #ifdef __cplusplus
 }
 #endif
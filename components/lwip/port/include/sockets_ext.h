@@ -5,6 +5,7 @@
  */
 #pragma once
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -15,10 +16,129 @@ extern "C" {
 #define IPV6_MULTICAST_HOPS  0x301
 #define IPV6_MULTICAST_LOOP  0x302
 
+/* ESP-specific, SOL_SOCKET level: depth of the socket's receive mailbox in
+ * messages. Lets a bursty UDP socket get a deeper queue (and a bulk TCP
+ * socket a shallower one) than the global Kconfig default. Apply it before
+ * traffic flows; messages already queued are preserved, but no thread may be
+ * blocked in a receive call on the socket while the option is changed. */
+#define SO_RCVMBOX_SIZE      0x1030
+
+/* ESP-specific, SOL_SOCKET level, set only: assign the socket to a buffer
+ * class (esp_sock_class_t). Applies the class profile configured with
+ * esp_sock_class_configure() to the socket in one step; see there. */
+#define SO_SOCK_CLASS        0x1031
+
 struct lwip_sock;
+struct msghdr;
+
+/**
+ * @brief Buffer classes a socket can be assigned to with SO_SOCK_CLASS
+ *
+ * The ESP port backs pbufs and protocol control blocks by the system heap
+ * (MEM_LIBC_MALLOC/MEMP_MEM_MALLOC), so there are no static pools to carve
+ * up; isolation between traffic types instead comes from bounding how much
+ * buffered receive data each socket may accumulate. Assigning a bulk socket
+ * to ESP_SOCK_CLASS_BULK caps its queued data, so an OTA download cannot
+ * starve a small, latency-critical control socket of memory, and the control
+ * socket's own queue stays short and cache-hot.
+ */
+typedef enum {
+    ESP_SOCK_CLASS_DEFAULT = 0, /* global Kconfig defaults, no per-class limits */
+    ESP_SOCK_CLASS_CONTROL,     /* small footprint, short queue, low latency */
+    ESP_SOCK_CLASS_BULK,        /* bounded buffering for throughput transfers */
+    ESP_SOCK_CLASS_MAX,
+} esp_sock_class_t;
+
+/**
+ * @brief Buffer profile of one socket class
+ */
+typedef struct {
+    int recv_budget_bytes; /* cap on queued receive data per socket in bytes,
+                              0 keeps the socket's current limit; requires
+                              CONFIG_LWIP_SO_RCVBUF to take effect */
+    int recvmbox_depth;    /* receive mailbox depth per socket in messages,
+                              0 keeps the socket's current depth */
+} esp_sock_class_profile_t;
+
+/**
+ * @brief Configure the buffer profile applied by SO_SOCK_CLASS for a class
+ *
+ * Affects sockets assigned to the class afterwards; sockets already assigned
+ * keep the profile that was active when they were assigned. The default and
+ * bulk/control built-in profiles can be inspected with
+ * esp_sock_class_get_profile().
+ *
+ * @param sock_class class to configure (not ESP_SOCK_CLASS_DEFAULT)
+ * @param profile    profile to apply to sockets of this class
+ * @return 0 on success, -1 with errno set on invalid arguments
+ */
+int esp_sock_class_configure(esp_sock_class_t sock_class, const esp_sock_class_profile_t *profile);
+
+/**
+ * @brief Read back the buffer profile of a socket class
+ *
+ * @param sock_class class to query
+ * @param profile    filled with the class profile
+ * @return 0 on success, -1 with errno set on invalid arguments
+ */
+int esp_sock_class_get_profile(esp_sock_class_t sock_class, esp_sock_class_profile_t *profile);
 
 bool lwip_setsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, const void *optval, uint32_t optlen, int *err);
 bool lwip_getsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, void *optval, uint32_t *optlen, int *err);
+
+/**
+ * @brief Receive multiple messages from a socket in one call
+ *
+ * Blocks for the first message according to the socket's mode and the given
+ * flags, then drains further already-queued messages without blocking, so a
+ * burst of small UDP datagrams costs one task wakeup instead of one per
+ * packet.
+ *
+ * @param s           socket descriptor
+ * @param msgvec      array of vlen message headers to fill in
+ * @param msg_len_vec array of vlen ints receiving the byte count of each message
+ * @param vlen        maximum number of messages to receive
+ * @param flags       flags passed through to lwip_recvmsg() (e.g. MSG_DONTWAIT)
+ * @return number of messages received, or -1 with errno set if the first
+ *         receive failed
+ */
+int esp_recvmmsg(int s, struct msghdr *msgvec, int *msg_len_vec, unsigned int vlen, int flags);
+
+/**
+ * @brief Completion callback for esp_send_pinned()
+ *
+ * Invoked from the tcpip thread, so it must not block; defer any heavy work
+ * to another task.
+ *
+ * @param arg user argument given to esp_send_pinned()
+ * @param err 0 once the remote end has acknowledged all enqueued bytes, or a
+ *            negative errno value if the connection was closed or reset first
+ */
+typedef void (*esp_send_pinned_cb_t)(void *arg, int err);
+
+/**
+ * @brief Enqueue an application-owned buffer for zero-copy TCP send
+ *
+ * Unlike send(), the data is not copied into the stack's send buffers: the
+ * segments reference the caller's memory directly, so the buffer must stay
+ * valid and unmodified until the completion callback fires. Acknowledgement
+ * is detected by a periodic check in the tcpip thread, so the callback may
+ * lag the final ACK by a few milliseconds.
+ *
+ * At most min(len, free send buffer space) bytes are enqueued; like send(),
+ * the caller is expected to loop over the remainder (typically from the
+ * completion callback, once buffer space has drained). The socket must stay
+ * open until the callback has been invoked.
+ *
+ * @param s        TCP socket descriptor
+ * @param data     buffer to send; pinned by the caller until completion
+ * @param len      number of bytes available in the buffer
+ * @param acked_cb invoked once all enqueued bytes are acknowledged (or lost)
+ * @param arg      user argument passed to acked_cb
+ * @return number of bytes enqueued (possibly less than len), or -1 with
+ *         errno set (EWOULDBLOCK if the send buffer is currently full)
+ */
+int esp_send_pinned(int s, const void *data, size_t len, esp_send_pinned_cb_t acked_cb, void *arg);
 #ifdef __cplusplus
 }
 #endif
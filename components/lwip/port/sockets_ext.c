@@ -6,9 +6,13 @@
 
 #include "lwip/sockets.h"
 #include "lwip/priv/sockets_priv.h"
+#include "lwip/priv/tcp_priv.h"
 #include "lwip/api.h"
 #include "lwip/sys.h"
 #include "lwip/tcp.h"
+#include "lwip/tcpip.h"
+#include "lwip/timeouts.h"
+#include "lwip/mem.h"
 #include "lwip/raw.h"
 #include "lwip/udp.h"
 
@@ -20,8 +24,67 @@
   if (NETCONNTYPE_GROUP(netconn_type((sock)->conn)) != netconntype) { *err=ENOPROTOOPT; goto exit; } } while(0)
 
 
+/* Upper bound for SO_RCVMBOX_SIZE: each slot costs sizeof(void *) of
+ * internal RAM for the lifetime of the socket */
+#define RCVMBOX_SIZE_MAX 1024
+
+/* Built-in SO_SOCK_CLASS profiles: control keeps roughly two full-size TCP
+ * segments and a short mailbox so its working set stays small; bulk is
+ * bounded so a fast sender cannot grow its queue without limit. Both can be
+ * overridden at runtime with esp_sock_class_configure(). */
+static esp_sock_class_profile_t s_sock_class_profiles[ESP_SOCK_CLASS_MAX] = {
+    [ESP_SOCK_CLASS_DEFAULT] = { .recv_budget_bytes = 0,     .recvmbox_depth = 0 },
+    [ESP_SOCK_CLASS_CONTROL] = { .recv_budget_bytes = 2920,  .recvmbox_depth = 8 },
+    [ESP_SOCK_CLASS_BULK]    = { .recv_budget_bytes = 16384, .recvmbox_depth = 6 },
+};
+
 bool lwip_setsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, const void *optval, socklen_t optlen, int *err)
 {
+    if ((level == SOL_SOCKET) && (optname == SO_RCVMBOX_SIZE)) {
+        if ((optlen < sizeof(int)) || (sock->conn == NULL) || !sys_mbox_valid(&sock->conn->recvmbox)) {
+            *err = EINVAL;
+            return true;
+        }
+        int size = *(const int *)optval;
+        if ((size <= 0) || (size > RCVMBOX_SIZE_MAX)) {
+            *err = EINVAL;
+            return true;
+        }
+        /* The hook runs in tcpip thread context (or with the core locked),
+         * so nothing can post to recvmbox while it is swapped out */
+        if (sys_mbox_resize(&sock->conn->recvmbox, size) != 0) {
+            *err = ENOMEM;
+            return true;
+        }
+        return true;
+    }
+
+    if ((level == SOL_SOCKET) && (optname == SO_SOCK_CLASS)) {
+        if ((optlen < sizeof(int)) || (sock->conn == NULL)) {
+            *err = EINVAL;
+            return true;
+        }
+        int sock_class = *(const int *)optval;
+        if ((sock_class < 0) || (sock_class >= ESP_SOCK_CLASS_MAX)) {
+            *err = EINVAL;
+            return true;
+        }
+        const esp_sock_class_profile_t *profile = &s_sock_class_profiles[sock_class];
+        if ((profile->recvmbox_depth > 0) && sys_mbox_valid(&sock->conn->recvmbox)) {
+            /* Same context guarantee as SO_RCVMBOX_SIZE above */
+            if (sys_mbox_resize(&sock->conn->recvmbox, profile->recvmbox_depth) != 0) {
+                *err = ENOMEM;
+                return true;
+            }
+        }
+#if LWIP_SO_RCVBUF
+        if (profile->recv_budget_bytes > 0) {
+            netconn_set_recvbufsize(sock->conn, profile->recv_budget_bytes);
+        }
+#endif /* LWIP_SO_RCVBUF */
+        return true;
+    }
+
 #if LWIP_IPV6
     if (level != IPPROTO_IPV6)
 #endif /* LWIP_IPV6 */
@@ -57,8 +120,44 @@ exit:
 #endif /* LWIP_IPV6 */
 }
 
+int esp_recvmmsg(int s, struct msghdr *msgvec, int *msg_len_vec, unsigned int vlen, int flags)
+{
+    unsigned int received = 0;
+
+    if ((msgvec == NULL) || (msg_len_vec == NULL) || (vlen == 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    while (received < vlen) {
+        /* only the first message may block; the rest just drain the
+         * messages that were already queued in the receive mailbox */
+        int recv_flags = (received == 0) ? flags : (flags | MSG_DONTWAIT);
+        int ret = lwip_recvmsg(s, &msgvec[received], recv_flags);
+        if (ret < 0) {
+            if (received > 0) {
+                break;
+            }
+            return -1;
+        }
+        msg_len_vec[received] = ret;
+        received++;
+    }
+    return (int)received;
+}
+
 bool lwip_getsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, void *optval, uint32_t *optlen, int *err)
 {
+    if ((level == SOL_SOCKET) && (optname == SO_RCVMBOX_SIZE)) {
+        if ((*optlen < sizeof(int)) || (sock->conn == NULL) || !sys_mbox_valid(&sock->conn->recvmbox)) {
+            *err = EINVAL;
+            return true;
+        }
+        *(int *)optval = sys_mbox_depth(&sock->conn->recvmbox);
+        *optlen = sizeof(int);
+        return true;
+    }
+
 #if LWIP_IPV6
     if (level != IPPROTO_IPV6)
 #endif /* LWIP_IPV6 */
@@ -106,3 +205,195 @@ exit:
     return true;
 #endif /* LWIP_IPV6 */
 }
+
+/* How often the tcpip thread checks pinned sends for acknowledgement while
+ * any are outstanding. Coarse on purpose: one timer serves all records and
+ * the senders this is meant for move tens of kilobytes per completion. */
+#define SEND_PINNED_POLL_MS 10
+
+typedef struct send_pinned_rec {
+    struct send_pinned_rec *next;
+    int fd;
+    struct netconn *conn;     /* identity check when re-resolving fd */
+    u32_t end_seq;            /* first sequence number after the pinned data */
+    esp_send_pinned_cb_t cb;
+    void *arg;
+} send_pinned_rec_t;
+
+/* Only ever touched from tcpip thread context */
+static send_pinned_rec_t *s_send_pinned_recs;
+
+static int send_pinned_errno(err_t err)
+{
+    switch (err) {
+        case ERR_MEM:
+        case ERR_BUF:
+            return ENOMEM;
+        case ERR_CONN:
+        case ERR_CLSD:
+            return ENOTCONN;
+        case ERR_RST:
+            return ECONNRESET;
+        case ERR_ABRT:
+            return ECONNABORTED;
+        default:
+            return EIO;
+    }
+}
+
+static void send_pinned_poll(void *ctx)
+{
+    LWIP_UNUSED_ARG(ctx);
+    send_pinned_rec_t **prev = &s_send_pinned_recs;
+    while (*prev != NULL) {
+        send_pinned_rec_t *rec = *prev;
+        int status = 0;
+        bool done = false;
+
+        /* Re-resolve the descriptor on every pass instead of caching the pcb:
+         * the pcb is freed when the socket closes, while a stale fd simply
+         * resolves to NULL (or to a different conn, if it was reused) */
+        struct lwip_sock *sock = lwip_socket_dbg_get_socket(rec->fd);
+        if ((sock == NULL) || (sock->conn != rec->conn) || (sock->conn->pcb.tcp == NULL) ||
+            (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_TCP)) {
+            done = true;
+            status = -ECONNRESET;
+        } else {
+            struct tcp_pcb *pcb = sock->conn->pcb.tcp;
+            if (TCP_SEQ_GEQ(pcb->lastack, rec->end_seq)) {
+                done = true;
+            } else if ((pcb->state != ESTABLISHED) && (pcb->state != CLOSE_WAIT)) {
+                /* connection is past the states that can carry our data */
+                done = true;
+                status = -ENOTCONN;
+            }
+        }
+
+        if (done) {
+            *prev = rec->next;
+            rec->cb(rec->arg, status);
+            mem_free(rec);
+        } else {
+            prev = &rec->next;
+        }
+    }
+    if (s_send_pinned_recs != NULL) {
+        sys_timeout(SEND_PINNED_POLL_MS, send_pinned_poll, NULL);
+    }
+}
+
+struct send_pinned_msg {
+    struct tcpip_api_call_data call;
+    struct lwip_sock *sock;
+    int fd;
+    const void *data;
+    size_t len;
+    esp_send_pinned_cb_t cb;
+    void *arg;
+    size_t written;
+    int err;
+};
+
+static err_t send_pinned_do(struct tcpip_api_call_data *call)
+{
+    struct send_pinned_msg *msg = (struct send_pinned_msg *)call;
+    struct tcp_pcb *pcb = msg->sock->conn->pcb.tcp;
+
+    if ((pcb == NULL) || ((pcb->state != ESTABLISHED) && (pcb->state != CLOSE_WAIT))) {
+        msg->err = ENOTCONN;
+        return ERR_OK;
+    }
+    size_t chunk = LWIP_MIN(msg->len, tcp_sndbuf(pcb));
+    chunk = LWIP_MIN(chunk, 0xffff); /* tcp_write() takes a u16_t length */
+    if (chunk == 0) {
+        msg->err = EWOULDBLOCK;
+        return ERR_OK;
+    }
+    send_pinned_rec_t *rec = (send_pinned_rec_t *)mem_malloc(sizeof(send_pinned_rec_t));
+    if (rec == NULL) {
+        msg->err = ENOMEM;
+        return ERR_OK;
+    }
+    /* No TCP_WRITE_FLAG_COPY: segments reference the caller's buffer */
+    err_t werr = tcp_write(pcb, msg->data, (u16_t)chunk, 0);
+    if (werr != ERR_OK) {
+        mem_free(rec);
+        msg->err = send_pinned_errno(werr);
+        return ERR_OK;
+    }
+    rec->fd = msg->fd;
+    rec->conn = msg->sock->conn;
+    rec->end_seq = pcb->snd_lbb; /* tcp_write() advanced it past our data */
+    rec->cb = msg->cb;
+    rec->arg = msg->arg;
+    rec->next = s_send_pinned_recs;
+    if (s_send_pinned_recs == NULL) {
+        sys_timeout(SEND_PINNED_POLL_MS, send_pinned_poll, NULL);
+    }
+    s_send_pinned_recs = rec;
+    msg->written = chunk;
+    tcp_output(pcb);
+    return ERR_OK;
+}
+
+int esp_sock_class_configure(esp_sock_class_t sock_class, const esp_sock_class_profile_t *profile)
+{
+    if ((profile == NULL) ||
+        (sock_class <= ESP_SOCK_CLASS_DEFAULT) || (sock_class >= ESP_SOCK_CLASS_MAX) ||
+        (profile->recv_budget_bytes < 0) || (profile->recvmbox_depth < 0) ||
+        (profile->recvmbox_depth > RCVMBOX_SIZE_MAX)) {
+        errno = EINVAL;
+        return -1;
+    }
+    SYS_ARCH_DECL_PROTECT(lev);
+    SYS_ARCH_PROTECT(lev);
+    s_sock_class_profiles[sock_class] = *profile;
+    SYS_ARCH_UNPROTECT(lev);
+    return 0;
+}
+
+int esp_sock_class_get_profile(esp_sock_class_t sock_class, esp_sock_class_profile_t *profile)
+{
+    if ((profile == NULL) || (sock_class < 0) || (sock_class >= ESP_SOCK_CLASS_MAX)) {
+        errno = EINVAL;
+        return -1;
+    }
+    SYS_ARCH_DECL_PROTECT(lev);
+    SYS_ARCH_PROTECT(lev);
+    *profile = s_sock_class_profiles[sock_class];
+    SYS_ARCH_UNPROTECT(lev);
+    return 0;
+}
+
+int esp_send_pinned(int s, const void *data, size_t len, esp_send_pinned_cb_t acked_cb, void *arg)
+{
+    if ((data == NULL) || (len == 0) || (acked_cb == NULL)) {
+        errno = EINVAL;
+        return -1;
+    }
+    struct lwip_sock *sock = lwip_socket_dbg_get_socket(s);
+    if ((sock == NULL) || (sock->conn == NULL)) {
+        errno = EBADF;
+        return -1;
+    }
+    if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_TCP) {
+        errno = EOPNOTSUPP;
+        return -1;
+    }
+    struct send_pinned_msg msg = {
+        .sock = sock,
+        .fd = s,
+        .data = data,
+        .len = len,
+        .cb = acked_cb,
+        .arg = arg,
+        .written = 0,
+        .err = 0,
+    };
+    tcpip_api_call(send_pinned_do, &msg.call);
+    if (msg.err != 0) {
+        errno = msg.err;
+        return -1;
+    }
+    return (int)msg.written;
+}
@@ -5,6 +5,7 @@
  */
 #include <string.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <sys/param.h>
 
 #include "esp_check.h"
@@ -129,6 +130,94 @@ static cert_t esp_crt_get_cert(const bundle_t bundle, const uint32_t index)
     return bundle + esp_crt_get_cert_offset(bundle, index);
 }
 
+#if defined(CONFIG_MBEDTLS_CERTIFICATE_BUNDLE_HASH_INDEX)
+typedef struct {
+    uint32_t name_hash;  //!< FNV-1a hash of the DER-encoded subject name
+    uint32_t cert_index; //!< index of the certificate within the bundle
+} crt_hash_entry_t;
+
+/* Sorted by name_hash; lives in RAM so that lookups do not touch the
+ * flash-mapped bundle until a candidate has been found. */
+static crt_hash_entry_t* s_crt_hash_index;
+static uint32_t s_crt_hash_index_count;
+
+static uint32_t esp_crt_name_hash(const uint8_t* data, const size_t len)
+{
+    // 32-bit FNV-1a
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static int esp_crt_hash_entry_cmp(const void* a, const void* b)
+{
+    const crt_hash_entry_t* entry_a = (const crt_hash_entry_t*)a;
+    const crt_hash_entry_t* entry_b = (const crt_hash_entry_t*)b;
+    if (entry_a->name_hash != entry_b->name_hash) {
+        return (entry_a->name_hash < entry_b->name_hash) ? -1 : 1;
+    }
+    // Stable order among (unlikely) hash collisions
+    return (entry_a->cert_index < entry_b->cert_index) ? -1 : 1;
+}
+
+static void esp_crt_free_hash_index(void)
+{
+    free(s_crt_hash_index);
+    s_crt_hash_index = NULL;
+    s_crt_hash_index_count = 0;
+}
+
+static void esp_crt_build_hash_index(const bundle_t bundle)
+{
+    esp_crt_free_hash_index();
+    const uint32_t num_certs = esp_crt_get_certcount(bundle);
+    crt_hash_entry_t* index = malloc(num_certs * sizeof(*index));
+    if (unlikely(index == NULL)) {
+        ESP_LOGW(TAG, "No memory for subject hash index, using bundle search");
+        return;
+    }
+    for (uint32_t i = 0; i < num_certs; i++) {
+        const cert_t cert = esp_crt_get_cert(bundle, i);
+        index[i].name_hash = esp_crt_name_hash(esp_crt_get_name(cert), esp_crt_get_name_len(cert));
+        index[i].cert_index = i;
+    }
+    qsort(index, num_certs, sizeof(*index), esp_crt_hash_entry_cmp);
+    s_crt_hash_index = index;
+    s_crt_hash_index_count = num_certs;
+}
+
+static cert_t esp_crt_find_cert_by_hash(const unsigned char* const issuer, const size_t issuer_len)
+{
+    const uint32_t issuer_hash = esp_crt_name_hash(issuer, issuer_len);
+
+    int start = 0;
+    int end = s_crt_hash_index_count - 1;
+
+    /* Find the first index entry with the issuer's hash */
+    while (start < end) {
+        const int middle = (start + end) / 2;
+        if (s_crt_hash_index[middle].name_hash < issuer_hash) {
+            start = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+
+    /* Confirm candidates against the actual subject name; collisions keep
+     * equal hashes adjacent in the sorted index */
+    for (; start < (int)s_crt_hash_index_count && s_crt_hash_index[start].name_hash == issuer_hash; start++) {
+        const cert_t cert = esp_crt_get_cert(s_crt_bundle, s_crt_hash_index[start].cert_index);
+        if (esp_crt_get_name_len(cert) == issuer_len &&
+                memcmp(issuer, esp_crt_get_name(cert), issuer_len) == 0) {
+            return cert;
+        }
+    }
+    return NULL;
+}
+#endif /* CONFIG_MBEDTLS_CERTIFICATE_BUNDLE_HASH_INDEX */
+
 static int esp_crt_check_signature(const mbedtls_x509_crt* child, const uint8_t* pub_key_buf, const size_t pub_key_len)
 {
     int ret = 0;
@@ -275,6 +364,12 @@ static cert_t esp_crt_find_cert(const unsigned char* const issuer, const size_t
         return NULL;
     }
 
+#if defined(CONFIG_MBEDTLS_CERTIFICATE_BUNDLE_HASH_INDEX)
+    if (likely(s_crt_hash_index != NULL)) {
+        return esp_crt_find_cert_by_hash(issuer, issuer_len);
+    }
+#endif
+
     int start = 0;
     int end = esp_crt_get_certcount(s_crt_bundle) - 1;
     int middle = (start + end) / 2;
@@ -422,6 +517,9 @@ static esp_err_t esp_crt_bundle_init(const uint8_t* const x509_bundle, const siz
 {
     if (likely(esp_crt_check_bundle(x509_bundle, bundle_size))) {
         s_crt_bundle = x509_bundle;
+#if defined(CONFIG_MBEDTLS_CERTIFICATE_BUNDLE_HASH_INDEX)
+        esp_crt_build_hash_index(s_crt_bundle);
+#endif
         return ESP_OK;
     } else {
         return ESP_ERR_INVALID_ARG;
@@ -574,6 +672,9 @@ esp_err_t esp_crt_bundle_attach(void *conf)
 void esp_crt_bundle_detach(mbedtls_ssl_config *conf)
 {
     s_crt_bundle = NULL;
+#if defined(CONFIG_MBEDTLS_CERTIFICATE_BUNDLE_HASH_INDEX)
+    esp_crt_free_hash_index();
+#endif
     if (conf) {
         mbedtls_ssl_conf_verify(conf, NULL, NULL);
     }
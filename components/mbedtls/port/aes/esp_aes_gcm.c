@@ -599,31 +599,14 @@ static int esp_aes_gcm_crypt_and_tag_partial_hw( esp_gcm_context *ctx,
     return ret;
 }
 
-int esp_aes_gcm_crypt_and_tag( esp_gcm_context *ctx,
-                               int mode,
-                               size_t length,
-                               const unsigned char *iv,
-                               size_t iv_len,
-                               const unsigned char *aad,
-                               size_t aad_len,
-                               const unsigned char *input,
-                               unsigned char *output,
-                               size_t tag_len,
-                               unsigned char *tag )
-{
-    if (!ctx) {
-        ESP_LOGE(TAG, "No AES context supplied");
-        return PSA_ERROR_INVALID_ARGUMENT;
-    }
 #if CONFIG_MBEDTLS_HARDWARE_GCM
-    int ret;
-    size_t remainder_bit;
-
-    /* Due to hardware limitation only certain cases are fully supported in HW */
-    if (!esp_aes_gcm_input_support_hw_accel(length, aad, aad_len, input, output)) {
-        return esp_aes_gcm_crypt_and_tag_partial_hw(ctx, mode, length, iv, iv_len, aad, aad_len, input, output, tag_len, tag);
-    }
-
+/* Validate arguments of the fully hardware-accelerated path; the caller has already
+   checked esp_aes_gcm_input_support_hw_accel() */
+static int esp_aes_gcm_check_hw_args( const unsigned char *iv,
+                                      size_t iv_len,
+                                      const unsigned char *aad,
+                                      size_t aad_len )
+{
     /*  Limit aad len to a single DMA descriptor to simplify DMA handling
         In practice, e.g. with mbedtls the length of aad will always be short
         the size field has 12 bits, but 0 not for 4096.
@@ -651,6 +634,26 @@ int esp_aes_gcm_crypt_and_tag( esp_gcm_context *ctx,
         return PSA_ERROR_INVALID_ARGUMENT;
     }
 
+    return 0;
+}
+
+/* Core of the fully hardware-accelerated path. The caller must have acquired the AES
+   hardware and validated the arguments with esp_aes_gcm_check_hw_args() */
+static int esp_aes_gcm_crypt_and_tag_hw_locked( esp_gcm_context *ctx,
+        int mode,
+        size_t length,
+        const unsigned char *iv,
+        size_t iv_len,
+        const unsigned char *aad,
+        size_t aad_len,
+        const unsigned char *input,
+        unsigned char *output,
+        size_t tag_len,
+        unsigned char *tag )
+{
+    int ret;
+    size_t remainder_bit;
+
     /* Initialize AES-GCM context */
     memset(ctx->ghash, 0, sizeof(ctx->ghash));
     ctx->data_len = 0;
@@ -661,7 +664,6 @@ int esp_aes_gcm_crypt_and_tag( esp_gcm_context *ctx,
     ctx->aad_len = aad_len;
     ctx->mode = mode;
 
-    esp_aes_acquire_hardware();
     ctx->aes_ctx.key_in_hardware = 0;
     ctx->aes_ctx.key_in_hardware = aes_hal_setkey(ctx->aes_ctx.key, ctx->aes_ctx.key_bytes, mode);
 
@@ -679,12 +681,48 @@ int esp_aes_gcm_crypt_and_tag( esp_gcm_context *ctx,
 
     ret = esp_aes_process_dma_gcm(&ctx->aes_ctx, input, output, length, aad, aad_len);
     if (ret != 0) {
-        esp_aes_release_hardware();
         return ret;
     }
 
     aes_hal_gcm_read_tag(tag, tag_len);
 
+    return ret;
+}
+#endif /* CONFIG_MBEDTLS_HARDWARE_GCM */
+
+int esp_aes_gcm_crypt_and_tag( esp_gcm_context *ctx,
+                               int mode,
+                               size_t length,
+                               const unsigned char *iv,
+                               size_t iv_len,
+                               const unsigned char *aad,
+                               size_t aad_len,
+                               const unsigned char *input,
+                               unsigned char *output,
+                               size_t tag_len,
+                               unsigned char *tag )
+{
+    if (!ctx) {
+        ESP_LOGE(TAG, "No AES context supplied");
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+#if CONFIG_MBEDTLS_HARDWARE_GCM
+    int ret;
+
+    /* Due to hardware limitation only certain cases are fully supported in HW */
+    if (!esp_aes_gcm_input_support_hw_accel(length, aad, aad_len, input, output)) {
+        return esp_aes_gcm_crypt_and_tag_partial_hw(ctx, mode, length, iv, iv_len, aad, aad_len, input, output, tag_len, tag);
+    }
+
+    ret = esp_aes_gcm_check_hw_args(iv, iv_len, aad, aad_len);
+    if (ret != 0) {
+        return ret;
+    }
+
+    esp_aes_acquire_hardware();
+
+    ret = esp_aes_gcm_crypt_and_tag_hw_locked(ctx, mode, length, iv, iv_len, aad, aad_len, input, output, tag_len, tag);
+
     esp_aes_release_hardware();
 
     return ( ret );
@@ -693,6 +731,70 @@ int esp_aes_gcm_crypt_and_tag( esp_gcm_context *ctx,
 #endif
 }
 
+int esp_aes_gcm_crypt_batch( esp_gcm_context *ctx,
+                             esp_aes_gcm_op_t *ops,
+                             size_t num_ops )
+{
+    int first_error = 0;
+
+    if (!ctx || (!ops && num_ops > 0)) {
+        ESP_LOGE(TAG, "No AES context or operations supplied");
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+#if CONFIG_MBEDTLS_HARDWARE_GCM
+    bool hw_held = false;
+
+    for (size_t i = 0; i < num_ops; i++) {
+        esp_aes_gcm_op_t *op = &ops[i];
+
+        if (esp_aes_gcm_input_support_hw_accel(op->length, op->aad, op->aad_len, op->input, op->output)) {
+            op->ret = esp_aes_gcm_check_hw_args(op->iv, op->iv_len, op->aad, op->aad_len);
+            if (op->ret == 0) {
+                /* The hardware is held across consecutive records, so the records of one batch
+                   share a single lock acquisition and peripheral setup */
+                if (!hw_held) {
+                    esp_aes_acquire_hardware();
+                    hw_held = true;
+                }
+                op->ret = esp_aes_gcm_crypt_and_tag_hw_locked(ctx, op->mode, op->length, op->iv, op->iv_len,
+                                                              op->aad, op->aad_len, op->input, op->output,
+                                                              op->tag_len, op->tag);
+            }
+        } else {
+            /* The partial path acquires the hardware on its own, give the lock up first */
+            if (hw_held) {
+                esp_aes_release_hardware();
+                hw_held = false;
+            }
+            op->ret = esp_aes_gcm_crypt_and_tag_partial_hw(ctx, op->mode, op->length, op->iv, op->iv_len,
+                                                           op->aad, op->aad_len, op->input, op->output,
+                                                           op->tag_len, op->tag);
+        }
+
+        if (op->ret != 0 && first_error == 0) {
+            first_error = op->ret;
+        }
+    }
+
+    if (hw_held) {
+        esp_aes_release_hardware();
+    }
+#else
+    for (size_t i = 0; i < num_ops; i++) {
+        esp_aes_gcm_op_t *op = &ops[i];
+        op->ret = esp_aes_gcm_crypt_and_tag(ctx, op->mode, op->length, op->iv, op->iv_len,
+                                            op->aad, op->aad_len, op->input, op->output,
+                                            op->tag_len, op->tag);
+        if (op->ret != 0 && first_error == 0) {
+            first_error = op->ret;
+        }
+    }
+#endif
+
+    return first_error;
+}
+
 
 int esp_aes_gcm_auth_decrypt( esp_gcm_context *ctx,
                               size_t length,
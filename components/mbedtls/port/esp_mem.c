@@ -4,15 +4,123 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <esp_attr.h>
 #include <esp_heap_caps.h>
 #include <sdkconfig.h>
 #include "esp_mem.h"
 
+#ifdef CONFIG_MBEDTLS_SSL_BUFFER_POOL
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#endif
+
 #ifndef CONFIG_MBEDTLS_CUSTOM_MEM_ALLOC
 
+#ifdef CONFIG_MBEDTLS_SSL_BUFFER_POOL
+
+/* Each slot must fit the larger of the TLS input/output buffers, i.e. the
+ * configured content length plus the record header/counter overhead
+ * (MBEDTLS_SSL_IN/OUT_BUFFER_LEN, private to mbedtls). 512 bytes cover the
+ * overhead for every supported configuration and are also used as the upper
+ * margin when deciding whether an allocation request is an I/O buffer. */
+#define SSL_BUFFER_POOL_RECORD_OVERHEAD 512
+
+#ifdef CONFIG_MBEDTLS_ASYMMETRIC_CONTENT_LEN
+#if CONFIG_MBEDTLS_SSL_IN_CONTENT_LEN > CONFIG_MBEDTLS_SSL_OUT_CONTENT_LEN
+#define SSL_BUFFER_POOL_CONTENT_LEN CONFIG_MBEDTLS_SSL_IN_CONTENT_LEN
+#else
+#define SSL_BUFFER_POOL_CONTENT_LEN CONFIG_MBEDTLS_SSL_OUT_CONTENT_LEN
+#endif
+#else
+#define SSL_BUFFER_POOL_CONTENT_LEN CONFIG_MBEDTLS_SSL_MAX_CONTENT_LEN
+#endif
+
+#define SSL_BUFFER_POOL_SLOT_SIZE (SSL_BUFFER_POOL_CONTENT_LEN + SSL_BUFFER_POOL_RECORD_OVERHEAD)
+
+static uint8_t s_ssl_buffer_pool[CONFIG_MBEDTLS_SSL_BUFFER_POOL_SLOTS][SSL_BUFFER_POOL_SLOT_SIZE] __attribute__((aligned(4)));
+static bool s_ssl_buffer_pool_slot_used[CONFIG_MBEDTLS_SSL_BUFFER_POOL_SLOTS];
+static size_t s_ssl_buffer_pool_used;
+static size_t s_ssl_buffer_pool_high_watermark;
+static size_t s_ssl_buffer_pool_heap_fallbacks;
+static portMUX_TYPE s_ssl_buffer_pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static bool is_ssl_buffer_request(size_t len)
+{
+#ifdef CONFIG_MBEDTLS_ASYMMETRIC_CONTENT_LEN
+    return (len >= CONFIG_MBEDTLS_SSL_IN_CONTENT_LEN && len <= CONFIG_MBEDTLS_SSL_IN_CONTENT_LEN + SSL_BUFFER_POOL_RECORD_OVERHEAD) ||
+           (len >= CONFIG_MBEDTLS_SSL_OUT_CONTENT_LEN && len <= CONFIG_MBEDTLS_SSL_OUT_CONTENT_LEN + SSL_BUFFER_POOL_RECORD_OVERHEAD);
+#else
+    return len >= CONFIG_MBEDTLS_SSL_MAX_CONTENT_LEN && len <= CONFIG_MBEDTLS_SSL_MAX_CONTENT_LEN + SSL_BUFFER_POOL_RECORD_OVERHEAD;
+#endif
+}
+
+static void *ssl_buffer_pool_calloc(size_t len)
+{
+    void *buf = NULL;
+    portENTER_CRITICAL(&s_ssl_buffer_pool_lock);
+    for (int i = 0; i < CONFIG_MBEDTLS_SSL_BUFFER_POOL_SLOTS; i++) {
+        if (!s_ssl_buffer_pool_slot_used[i]) {
+            s_ssl_buffer_pool_slot_used[i] = true;
+            s_ssl_buffer_pool_used++;
+            if (s_ssl_buffer_pool_used > s_ssl_buffer_pool_high_watermark) {
+                s_ssl_buffer_pool_high_watermark = s_ssl_buffer_pool_used;
+            }
+            buf = s_ssl_buffer_pool[i];
+            break;
+        }
+    }
+    if (buf == NULL) {
+        s_ssl_buffer_pool_heap_fallbacks++;
+    }
+    portEXIT_CRITICAL(&s_ssl_buffer_pool_lock);
+    if (buf != NULL) {
+        memset(buf, 0, len);
+    }
+    return buf;
+}
+
+static bool ssl_buffer_pool_free(void *ptr)
+{
+    uint8_t *p = (uint8_t *)ptr;
+    if (p < &s_ssl_buffer_pool[0][0] || p >= &s_ssl_buffer_pool[CONFIG_MBEDTLS_SSL_BUFFER_POOL_SLOTS][0]) {
+        return false;
+    }
+    int slot = (p - &s_ssl_buffer_pool[0][0]) / SSL_BUFFER_POOL_SLOT_SIZE;
+    portENTER_CRITICAL(&s_ssl_buffer_pool_lock);
+    s_ssl_buffer_pool_slot_used[slot] = false;
+    s_ssl_buffer_pool_used--;
+    portEXIT_CRITICAL(&s_ssl_buffer_pool_lock);
+    return true;
+}
+
+void esp_mbedtls_ssl_buffer_pool_get_stats(esp_mbedtls_ssl_buffer_pool_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_ssl_buffer_pool_lock);
+    stats->total_slots = CONFIG_MBEDTLS_SSL_BUFFER_POOL_SLOTS;
+    stats->used_slots = s_ssl_buffer_pool_used;
+    stats->high_watermark = s_ssl_buffer_pool_high_watermark;
+    stats->heap_fallbacks = s_ssl_buffer_pool_heap_fallbacks;
+    portEXIT_CRITICAL(&s_ssl_buffer_pool_lock);
+}
+
+#endif /* CONFIG_MBEDTLS_SSL_BUFFER_POOL */
+
 void *esp_mbedtls_mem_calloc(size_t n, size_t size)
 {
+#ifdef CONFIG_MBEDTLS_SSL_BUFFER_POOL
+    if (is_ssl_buffer_request(n * size)) {
+        void *buf = ssl_buffer_pool_calloc(n * size);
+        if (buf != NULL) {
+            return buf;
+        }
+        /* Pool exhausted, fall through to the configured heap strategy */
+    }
+#endif
 #ifdef CONFIG_MBEDTLS_INTERNAL_MEM_ALLOC
     return heap_caps_calloc(n, size, MALLOC_CAP_INTERNAL|MALLOC_CAP_8BIT);
 #elif CONFIG_MBEDTLS_EXTERNAL_MEM_ALLOC
@@ -35,6 +143,11 @@ void *esp_mbedtls_mem_calloc(size_t n, size_t size)
 
 void esp_mbedtls_mem_free(void *ptr)
 {
+#ifdef CONFIG_MBEDTLS_SSL_BUFFER_POOL
+    if (ssl_buffer_pool_free(ptr)) {
+        return;
+    }
+#endif
     return heap_caps_free(ptr);
 }
 
@@ -251,6 +251,49 @@ int esp_aes_gcm_crypt_and_tag( esp_gcm_context *ctx,
                                size_t tag_len,
                                unsigned char *tag );
 
+/**
+ * \brief           One GCM record operation of a batch, see esp_aes_gcm_crypt_batch()
+ */
+typedef struct {
+    int mode;                   /*!< #MBEDTLS_GCM_ENCRYPT or #MBEDTLS_GCM_DECRYPT */
+    size_t length;              /*!< Length of the input data */
+    const unsigned char *iv;    /*!< Initialization vector */
+    size_t iv_len;              /*!< Length of the IV */
+    const unsigned char *aad;   /*!< Buffer holding the additional data */
+    size_t aad_len;             /*!< Length of the additional data */
+    const unsigned char *input; /*!< Buffer holding the input data */
+    unsigned char *output;      /*!< Buffer for holding the output data */
+    size_t tag_len;             /*!< Length of the tag to generate */
+    unsigned char *tag;         /*!< Buffer for holding the tag */
+    int ret;                    /*!< Result of this operation, filled in by esp_aes_gcm_crypt_batch() */
+} esp_aes_gcm_op_t;
+
+/**
+ * \brief           This function performs GCM encryption or decryption of a batch
+ *                  of independent records with a shared key.
+ *
+ *                  Each record is processed like by esp_aes_gcm_crypt_and_tag(), but
+ *                  the AES hardware lock is taken once for the consecutive
+ *                  hardware-capable records of the batch instead of once per record,
+ *                  so the per-record peripheral setup cost is amortized over the
+ *                  batch. Records the hardware cannot process in full fall back to
+ *                  the partial-hardware path transparently.
+ *
+ * \note            Batching raises throughput, not fairness: the AES hardware is
+ *                  held for the whole batch, so keep batches reasonably sized when
+ *                  other tasks also use AES.
+ *
+ * \param ctx       The GCM context to use for encryption or decryption.
+ * \param ops       Array of record operations; the \c ret field of every entry is
+ *                  filled with the result of that record.
+ * \param num_ops   Number of entries in \p ops.
+ *
+ * \return         \c 0 if all records succeeded, otherwise the result of the first
+ *                 failed record (the remaining records are still processed).
+ */
+int esp_aes_gcm_crypt_batch( esp_gcm_context *ctx,
+                             esp_aes_gcm_op_t *ops,
+                             size_t num_ops );
 
 /**
  * \brief           This function performs a GCM authenticated decryption of a
@@ -7,6 +7,26 @@
 #pragma once
 
 #include <stdlib.h>
+#include "sdkconfig.h"
 
 void *esp_mbedtls_mem_calloc(size_t n, size_t size);
 void esp_mbedtls_mem_free(void *ptr);
+
+#ifdef CONFIG_MBEDTLS_SSL_BUFFER_POOL
+/**
+ * Occupancy counters of the static TLS I/O buffer pool
+ */
+typedef struct {
+    size_t total_slots;     /*!< Number of slots in the pool (CONFIG_MBEDTLS_SSL_BUFFER_POOL_SLOTS) */
+    size_t used_slots;      /*!< Slots currently handed out to TLS connections */
+    size_t high_watermark;  /*!< Maximum number of slots used simultaneously since boot */
+    size_t heap_fallbacks;  /*!< I/O buffer allocations served from the heap because the pool was full */
+} esp_mbedtls_ssl_buffer_pool_stats_t;
+
+/**
+ * @brief Get occupancy metrics of the static TLS I/O buffer pool
+ *
+ * @param[out] stats Filled with the current pool counters
+ */
+void esp_mbedtls_ssl_buffer_pool_get_stats(esp_mbedtls_ssl_buffer_pool_stats_t *stats);
+#endif /* CONFIG_MBEDTLS_SSL_BUFFER_POOL */
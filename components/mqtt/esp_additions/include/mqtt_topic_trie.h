@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Topic filter trie for MQTT subscription dispatch
+ *
+ * Stores subscription filters in a segment-wise prefix tree with dedicated
+ * '+' (single level) and '#' (multi level) wildcard nodes, so matching an
+ * inbound PUBLISH topic costs O(topic length) independent of the number of
+ * subscriptions, instead of one wildcard comparison per filter.
+ *
+ * Matching follows MQTT-4.7: '+' matches exactly one topic level, '#' matches
+ * any number of trailing levels including zero, and filters starting with a
+ * wildcard do not match topics beginning with '$'. Handlers are stored in the
+ * terminal nodes, so a match dispatches directly without a second lookup.
+ *
+ * The trie is not internally locked; callers serialize access the same way
+ * they serialize the subscription list (typically everything runs on the
+ * mqtt client task).
+ */
+typedef struct mqtt_topic_trie mqtt_topic_trie_t;
+
+/**
+ * @brief Handler invoked for every subscription filter matching a topic
+ *
+ * @param topic       Topic of the inbound message (not NUL terminated)
+ * @param topic_len   Length of the topic
+ * @param handler_arg Argument registered with the filter
+ * @param user_data   Per-dispatch pointer passed to mqtt_topic_trie_dispatch()
+ */
+typedef void (*mqtt_topic_trie_handler_t)(const char *topic, size_t topic_len, void *handler_arg, void *user_data);
+
+/**
+ * @brief Create an empty topic trie
+ *
+ * @return Trie handle, or NULL if allocation failed
+ */
+mqtt_topic_trie_t *mqtt_topic_trie_create(void);
+
+/**
+ * @brief Destroy a topic trie and free all nodes
+ *
+ * @param trie Trie handle (NULL is allowed)
+ */
+void mqtt_topic_trie_destroy(mqtt_topic_trie_t *trie);
+
+/**
+ * @brief Insert a subscription filter
+ *
+ * Inserting a filter that is already present replaces its handler.
+ *
+ * @param trie        Trie handle
+ * @param filter      Topic filter, e.g. "sensors/+/state" or "gateway/#"
+ * @param handler     Handler to dispatch matching topics to
+ * @param handler_arg Argument passed through to the handler
+ *
+ * @return
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_ARG on NULL arguments or a filter violating MQTT-4.7
+ *    ('+'/'#' sharing a level with other characters, '#' not last)
+ *  - ESP_ERR_NO_MEM if a node allocation failed
+ */
+esp_err_t mqtt_topic_trie_insert(mqtt_topic_trie_t *trie, const char *filter, mqtt_topic_trie_handler_t handler, void *handler_arg);
+
+/**
+ * @brief Remove a subscription filter
+ *
+ * Nodes left without handlers or children are pruned.
+ *
+ * @param trie   Trie handle
+ * @param filter Topic filter previously passed to mqtt_topic_trie_insert()
+ *
+ * @return
+ *  - ESP_OK on success
+ *  - ESP_ERR_NOT_FOUND if the exact filter is not in the trie
+ *  - ESP_ERR_INVALID_ARG on NULL arguments
+ */
+esp_err_t mqtt_topic_trie_remove(mqtt_topic_trie_t *trie, const char *filter);
+
+/**
+ * @brief Dispatch a topic to the handlers of every matching filter
+ *
+ * @param trie      Trie handle
+ * @param topic     Topic of the inbound message (need not be NUL terminated)
+ * @param topic_len Length of the topic
+ * @param user_data Pointer handed to each invoked handler, e.g. the event
+ *
+ * @return Number of handlers invoked (0 if nothing matched)
+ */
+int mqtt_topic_trie_dispatch(mqtt_topic_trie_t *trie, const char *topic, size_t topic_len, void *user_data);
+
+/**
+ * @brief Test whether any subscription filter matches a topic
+ *
+ * Same matching rules as mqtt_topic_trie_dispatch(), without invoking
+ * handlers.
+ *
+ * @param trie      Trie handle
+ * @param topic     Topic to test (need not be NUL terminated)
+ * @param topic_len Length of the topic
+ *
+ * @return true if at least one filter matches
+ */
+bool mqtt_topic_trie_match(mqtt_topic_trie_t *trie, const char *topic, size_t topic_len);
+
+#ifdef __cplusplus
+}
+#endif
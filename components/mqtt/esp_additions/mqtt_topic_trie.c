@@ -0,0 +1,318 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "mqtt_topic_trie.h"
+
+/*
+ * One node per topic level. Literal children of a level form a singly linked
+ * sibling list; the '+' and '#' wildcard children get dedicated pointers so
+ * the matcher reaches them without scanning the list. A node carries a
+ * handler when a filter terminates in it.
+ */
+typedef struct trie_node {
+    char *segment;                  /* literal level, NULL for root and wildcard nodes */
+    struct trie_node *child;        /* first literal child */
+    struct trie_node *sibling;      /* next literal node on the same level */
+    struct trie_node *plus;         /* '+' child, matches exactly one level */
+    struct trie_node *hash;         /* '#' child, matches all remaining levels */
+    mqtt_topic_trie_handler_t handler;
+    void *handler_arg;
+} trie_node_t;
+
+struct mqtt_topic_trie {
+    trie_node_t root;
+};
+
+static size_t segment_len(const char *s, size_t remaining)
+{
+    const char *sep = memchr(s, '/', remaining);
+    return sep ? (size_t)(sep - s) : remaining;
+}
+
+static bool filter_is_valid(const char *filter)
+{
+    size_t remaining = strlen(filter);
+    const char *pos = filter;
+    while (true) {
+        size_t seg = segment_len(pos, remaining);
+        if (memchr(pos, '+', seg) && seg != 1) {
+            return false;   /* '+' must occupy a whole level */
+        }
+        if (memchr(pos, '#', seg) && (seg != 1 || seg != remaining)) {
+            return false;   /* '#' must occupy the whole last level */
+        }
+        if (seg == remaining) {
+            return true;
+        }
+        pos += seg + 1;
+        remaining -= seg + 1;
+    }
+}
+
+static trie_node_t *node_new(const char *segment, size_t seg_len)
+{
+    trie_node_t *node = calloc(1, sizeof(trie_node_t));
+    if (!node) {
+        return NULL;
+    }
+    if (segment) {
+        node->segment = malloc(seg_len + 1);
+        if (!node->segment) {
+            free(node);
+            return NULL;
+        }
+        memcpy(node->segment, segment, seg_len);
+        node->segment[seg_len] = '\0';
+    }
+    return node;
+}
+
+static void node_free_subtree(trie_node_t *node)
+{
+    if (!node) {
+        return;
+    }
+    trie_node_t *child = node->child;
+    while (child) {
+        trie_node_t *next = child->sibling;
+        node_free_subtree(child);
+        child = next;
+    }
+    node_free_subtree(node->plus);
+    node_free_subtree(node->hash);
+    free(node->segment);
+    free(node);
+}
+
+static trie_node_t *node_find_literal(trie_node_t *node, const char *seg, size_t seg_len)
+{
+    for (trie_node_t *child = node->child; child; child = child->sibling) {
+        if (strlen(child->segment) == seg_len && memcmp(child->segment, seg, seg_len) == 0) {
+            return child;
+        }
+    }
+    return NULL;
+}
+
+mqtt_topic_trie_t *mqtt_topic_trie_create(void)
+{
+    return calloc(1, sizeof(mqtt_topic_trie_t));
+}
+
+void mqtt_topic_trie_destroy(mqtt_topic_trie_t *trie)
+{
+    if (!trie) {
+        return;
+    }
+    trie_node_t *child = trie->root.child;
+    while (child) {
+        trie_node_t *next = child->sibling;
+        node_free_subtree(child);
+        child = next;
+    }
+    node_free_subtree(trie->root.plus);
+    node_free_subtree(trie->root.hash);
+    free(trie);
+}
+
+esp_err_t mqtt_topic_trie_insert(mqtt_topic_trie_t *trie, const char *filter, mqtt_topic_trie_handler_t handler, void *handler_arg)
+{
+    if (!trie || !filter || !filter[0] || !handler || !filter_is_valid(filter)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    trie_node_t *node = &trie->root;
+    size_t remaining = strlen(filter);
+    const char *pos = filter;
+
+    while (true) {
+        size_t seg = segment_len(pos, remaining);
+        trie_node_t **slot;
+        trie_node_t *next;
+
+        if (seg == 1 && pos[0] == '#') {
+            slot = &node->hash;
+        } else if (seg == 1 && pos[0] == '+') {
+            slot = &node->plus;
+        } else {
+            next = node_find_literal(node, pos, seg);
+            if (!next) {
+                next = node_new(pos, seg);
+                if (!next) {
+                    return ESP_ERR_NO_MEM;
+                }
+                next->sibling = node->child;
+                node->child = next;
+            }
+            slot = NULL;
+            node = next;
+        }
+        if (slot) {
+            if (!*slot) {
+                *slot = node_new(NULL, 0);
+                if (!*slot) {
+                    return ESP_ERR_NO_MEM;
+                }
+            }
+            node = *slot;
+        }
+
+        if (seg == remaining) {
+            node->handler = handler;
+            node->handler_arg = handler_arg;
+            return ESP_OK;
+        }
+        pos += seg + 1;
+        remaining -= seg + 1;
+    }
+}
+
+/* Removes the filter below `node`; returns ESP_OK if found. A node that ends
+ * up without handler and children is freed and its slot cleared. */
+static esp_err_t node_remove(trie_node_t *node, const char *pos, size_t remaining)
+{
+    if (remaining == 0) {
+        if (!node->handler) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        node->handler = NULL;
+        node->handler_arg = NULL;
+        return ESP_OK;
+    }
+
+    size_t seg = segment_len(pos, remaining);
+    const char *next_pos = (seg == remaining) ? pos + seg : pos + seg + 1;
+    size_t next_remaining = (seg == remaining) ? 0 : remaining - seg - 1;
+    trie_node_t **slot = NULL;
+    trie_node_t *child = NULL;
+
+    if (seg == 1 && pos[0] == '#') {
+        slot = &node->hash;
+    } else if (seg == 1 && pos[0] == '+') {
+        slot = &node->plus;
+    } else {
+        child = node_find_literal(node, pos, seg);
+    }
+    if (slot) {
+        child = *slot;
+    }
+    if (!child) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_err_t err = node_remove(child, next_pos, next_remaining);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    if (!child->handler && !child->child && !child->plus && !child->hash) {
+        if (slot) {
+            *slot = NULL;
+        } else {
+            trie_node_t **link = &node->child;
+            while (*link != child) {
+                link = &(*link)->sibling;
+            }
+            *link = child->sibling;
+        }
+        free(child->segment);
+        free(child);
+    }
+    return ESP_OK;
+}
+
+esp_err_t mqtt_topic_trie_remove(mqtt_topic_trie_t *trie, const char *filter)
+{
+    if (!trie || !filter || !filter[0]) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return node_remove(&trie->root, filter, strlen(filter));
+}
+
+typedef struct {
+    const char *topic;
+    size_t topic_len;
+    void *user_data;
+    bool invoke;
+    int matches;
+} match_ctx_t;
+
+static void node_match(trie_node_t *node, const char *pos, size_t remaining, match_ctx_t *ctx)
+{
+    /* '#' also matches the parent level, i.e. "a/#" matches "a" */
+    if (node->hash && node->hash->handler) {
+        ctx->matches++;
+        if (ctx->invoke) {
+            node->hash->handler(ctx->topic, ctx->topic_len, node->hash->handler_arg, ctx->user_data);
+        }
+    }
+
+    if (remaining == 0) {
+        if (node->handler) {
+            ctx->matches++;
+            if (ctx->invoke) {
+                node->handler(ctx->topic, ctx->topic_len, node->handler_arg, ctx->user_data);
+            }
+        }
+        return;
+    }
+
+    size_t seg = segment_len(pos, remaining);
+    const char *next_pos = (seg == remaining) ? pos + seg : pos + seg + 1;
+    size_t next_remaining = (seg == remaining) ? 0 : remaining - seg - 1;
+
+    trie_node_t *literal = node_find_literal(node, pos, seg);
+    if (literal) {
+        node_match(literal, next_pos, next_remaining, ctx);
+    }
+    if (node->plus) {
+        node_match(node->plus, next_pos, next_remaining, ctx);
+    }
+}
+
+static int trie_match(mqtt_topic_trie_t *trie, const char *topic, size_t topic_len, void *user_data, bool invoke)
+{
+    match_ctx_t ctx = {
+        .topic = topic,
+        .topic_len = topic_len,
+        .user_data = user_data,
+        .invoke = invoke,
+    };
+
+    /* MQTT-4.7.2-1: wildcard filters do not match topics starting with '$'.
+     * Walk the first level through the literal child only, then match
+     * normally below it. */
+    if (topic_len && topic[0] == '$') {
+        size_t seg = segment_len(topic, topic_len);
+        trie_node_t *literal = node_find_literal(&trie->root, topic, seg);
+        if (literal) {
+            const char *next_pos = (seg == topic_len) ? topic + seg : topic + seg + 1;
+            size_t next_remaining = (seg == topic_len) ? 0 : topic_len - seg - 1;
+            node_match(literal, next_pos, next_remaining, &ctx);
+        }
+        return ctx.matches;
+    }
+
+    node_match(&trie->root, topic, topic_len, &ctx);
+    return ctx.matches;
+}
+
+int mqtt_topic_trie_dispatch(mqtt_topic_trie_t *trie, const char *topic, size_t topic_len, void *user_data)
+{
+    if (!trie || !topic || !topic_len) {
+        return 0;
+    }
+    return trie_match(trie, topic, topic_len, user_data, true);
+}
+
+bool mqtt_topic_trie_match(mqtt_topic_trie_t *trie, const char *topic, size_t topic_len)
+{
+    if (!trie || !topic || !topic_len) {
+        return false;
+    }
+    return trie_match(trie, topic, topic_len, NULL, false) > 0;
+}
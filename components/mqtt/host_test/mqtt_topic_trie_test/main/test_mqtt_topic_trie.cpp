@@ -0,0 +1,159 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "mqtt_topic_trie.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+struct trie_fixture {
+    mqtt_topic_trie_t *trie;
+    std::vector<std::string> hits;
+
+    trie_fixture() : trie(mqtt_topic_trie_create())
+    {
+        REQUIRE(trie != nullptr);
+    }
+    ~trie_fixture()
+    {
+        mqtt_topic_trie_destroy(trie);
+    }
+
+    static void record(const char *topic, size_t topic_len, void *handler_arg, void *user_data)
+    {
+        (void)topic;
+        (void)topic_len;
+        auto *self = static_cast<trie_fixture *>(user_data);
+        self->hits.push_back(static_cast<const char *>(handler_arg));
+    }
+
+    esp_err_t insert(const char *filter)
+    {
+        return mqtt_topic_trie_insert(trie, filter, record, const_cast<char *>(filter));
+    }
+
+    std::vector<std::string> dispatch(const std::string &topic)
+    {
+        hits.clear();
+        int count = mqtt_topic_trie_dispatch(trie, topic.data(), topic.size(), this);
+        REQUIRE(count == static_cast<int>(hits.size()));
+        std::sort(hits.begin(), hits.end());
+        return hits;
+    }
+
+    bool match(const std::string &topic)
+    {
+        return mqtt_topic_trie_match(trie, topic.data(), topic.size());
+    }
+};
+
+} // namespace
+
+TEST_CASE("literal and wildcard matching follows MQTT-4.7", "[mqtt_topic_trie]")
+{
+    trie_fixture f;
+    REQUIRE(f.insert("sensors/kitchen/state") == ESP_OK);
+    REQUIRE(f.insert("sensors/+/state") == ESP_OK);
+    REQUIRE(f.insert("sensors/#") == ESP_OK);
+
+    // overlapping filters all dispatch for one PUBLISH
+    auto hits = f.dispatch("sensors/kitchen/state");
+    REQUIRE(hits == std::vector<std::string>{"sensors/#", "sensors/+/state", "sensors/kitchen/state"});
+
+    // '+' matches exactly one level
+    REQUIRE(f.dispatch("sensors/attic/state") == std::vector<std::string>{"sensors/#", "sensors/+/state"});
+    REQUIRE(f.dispatch("sensors/attic/low/state") == std::vector<std::string>{"sensors/#"});
+
+    // '#' also matches the parent level with zero trailing levels
+    REQUIRE(f.dispatch("sensors") == std::vector<std::string>{"sensors/#"});
+    REQUIRE(f.dispatch("actuators/valve") == std::vector<std::string>{});
+}
+
+TEST_CASE("wildcard filters do not match $-prefixed topics", "[mqtt_topic_trie]")
+{
+    trie_fixture f;
+    REQUIRE(f.insert("#") == ESP_OK);
+    REQUIRE(f.insert("+/broker/load") == ESP_OK);
+    REQUIRE(f.insert("$SYS/broker/load") == ESP_OK);
+
+    // MQTT-4.7.2-1: only the literal $SYS filter may match
+    REQUIRE(f.dispatch("$SYS/broker/load") == std::vector<std::string>{"$SYS/broker/load"});
+    REQUIRE(f.dispatch("$SYS/broker/uptime") == std::vector<std::string>{});
+
+    // ordinary topics still see the wildcards
+    REQUIRE(f.dispatch("my/broker/load") == std::vector<std::string>{"#", "+/broker/load"});
+}
+
+TEST_CASE("invalid filters are rejected on insert", "[mqtt_topic_trie]")
+{
+    trie_fixture f;
+    REQUIRE(f.insert("a+/b") == ESP_ERR_INVALID_ARG);    // '+' sharing a level
+    REQUIRE(f.insert("a/b+") == ESP_ERR_INVALID_ARG);
+    REQUIRE(f.insert("a/#/b") == ESP_ERR_INVALID_ARG);   // '#' not last
+    REQUIRE(f.insert("a/b#") == ESP_ERR_INVALID_ARG);    // '#' sharing a level
+    REQUIRE(f.insert("") == ESP_ERR_INVALID_ARG);
+    REQUIRE(mqtt_topic_trie_insert(f.trie, "a/b", nullptr, nullptr) == ESP_ERR_INVALID_ARG);
+}
+
+TEST_CASE("removal prunes empty nodes and leaves overlaps intact", "[mqtt_topic_trie]")
+{
+    trie_fixture f;
+    REQUIRE(f.insert("a/b/c") == ESP_OK);
+    REQUIRE(f.insert("a/+/c") == ESP_OK);
+    REQUIRE(f.insert("a/b") == ESP_OK);
+
+    REQUIRE(mqtt_topic_trie_remove(f.trie, "a/b/c") == ESP_OK);
+    REQUIRE(f.dispatch("a/b/c") == std::vector<std::string>{"a/+/c"});
+    // the pruned branch must not take "a/b" (still a terminal) with it
+    REQUIRE(f.dispatch("a/b") == std::vector<std::string>{"a/b"});
+
+    // removing twice, or a filter that was never inserted
+    REQUIRE(mqtt_topic_trie_remove(f.trie, "a/b/c") == ESP_ERR_NOT_FOUND);
+    REQUIRE(mqtt_topic_trie_remove(f.trie, "x/y") == ESP_ERR_NOT_FOUND);
+
+    // a pruned branch can be re-inserted
+    REQUIRE(f.insert("a/b/c") == ESP_OK);
+    REQUIRE(f.dispatch("a/b/c") == std::vector<std::string>{"a/+/c", "a/b/c"});
+}
+
+TEST_CASE("empty levels are distinct levels", "[mqtt_topic_trie]")
+{
+    trie_fixture f;
+    REQUIRE(f.insert("a//b") == ESP_OK);
+    REQUIRE(f.insert("a/+/b") == ESP_OK);
+    REQUIRE(f.insert("/a") == ESP_OK);
+
+    // '+' matches the empty level, "a/b" has no empty level
+    REQUIRE(f.dispatch("a//b") == std::vector<std::string>{"a/+/b", "a//b"});
+    REQUIRE(f.dispatch("a/b") == std::vector<std::string>{});
+
+    // leading '/' is an empty first level
+    REQUIRE(f.dispatch("/a") == std::vector<std::string>{"/a"});
+    REQUIRE(f.dispatch("a") == std::vector<std::string>{});
+}
+
+TEST_CASE("re-inserting a filter replaces its handler argument", "[mqtt_topic_trie]")
+{
+    trie_fixture f;
+    REQUIRE(mqtt_topic_trie_insert(f.trie, "a/b", trie_fixture::record,
+                                   const_cast<char *>("old")) == ESP_OK);
+    REQUIRE(mqtt_topic_trie_insert(f.trie, "a/b", trie_fixture::record,
+                                   const_cast<char *>("new")) == ESP_OK);
+    REQUIRE(f.dispatch("a/b") == std::vector<std::string>{"new"});
+}
+
+TEST_CASE("match reports without dispatching", "[mqtt_topic_trie]")
+{
+    trie_fixture f;
+    REQUIRE(f.insert("a/#") == ESP_OK);
+    REQUIRE(f.match("a/b"));
+    REQUIRE(!f.match("b"));
+    REQUIRE(f.hits.empty());
+}
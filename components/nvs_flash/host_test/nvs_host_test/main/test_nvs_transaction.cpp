@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "sdkconfig.h"
+
+#ifdef CONFIG_NVS_TRANSACTION
+
+#include <string.h>
+#include "nvs.h"
+#include "nvs_flash.h"
+#include "test_fixtures.hpp"
+
+#define TEST_DEFAULT_PARTITION_NAME "nvs"   // Default partition name used in the tests - 10 sectors
+
+#define TEST_ESP_ERR(rc, res) CHECK((rc) == (res))
+#define TEST_ESP_OK(rc) CHECK((rc) == ESP_OK)
+
+namespace {
+
+void write_initial_values(nvs_handle_t handle)
+{
+    TEST_ESP_OK(nvs_set_i32(handle, "key1", 1));
+    TEST_ESP_OK(nvs_set_i32(handle, "key2", 2));
+    TEST_ESP_OK(nvs_set_str(handle, "key3", "old"));
+}
+
+// Returns true when all three keys hold the old values, false when all three
+// hold the new ones, and fails the test on any mix of the two generations
+bool keys_hold_old_values(nvs_handle_t handle)
+{
+    int32_t val1 = 0;
+    int32_t val2 = 0;
+    char str[8] = {};
+    size_t str_size = sizeof(str);
+    TEST_ESP_OK(nvs_get_i32(handle, "key1", &val1));
+    TEST_ESP_OK(nvs_get_i32(handle, "key2", &val2));
+    TEST_ESP_OK(nvs_get_str(handle, "key3", str, &str_size));
+
+    const bool all_old = (val1 == 1) && (val2 == 2) && (strcmp(str, "old") == 0);
+    const bool all_new = (val1 == 11) && (val2 == 12) && (strcmp(str, "new") == 0);
+    CHECK((all_old || all_new));
+    return all_old;
+}
+
+} // namespace
+
+TEST_CASE("transaction: staged values become visible and durable only on commit", "[nvs][transaction]")
+{
+    TEST_ESP_OK(NVSPartitionTestHelper::erase_partition(TEST_DEFAULT_PARTITION_NAME));
+    TEST_ESP_OK(nvs_flash_init_partition(TEST_DEFAULT_PARTITION_NAME));
+
+    nvs_handle_t handle;
+    TEST_ESP_OK(nvs_open_from_partition(TEST_DEFAULT_PARTITION_NAME, "txn_ns", NVS_READWRITE, &handle));
+    write_initial_values(handle);
+
+    TEST_ESP_OK(nvs_transaction_begin(handle));
+    TEST_ESP_OK(nvs_set_i32(handle, "key1", 11));
+    TEST_ESP_OK(nvs_set_i32(handle, "key2", 12));
+    TEST_ESP_OK(nvs_set_str(handle, "key3", "new"));
+
+    // staged values must not be readable before commit
+    CHECK(keys_hold_old_values(handle));
+
+    TEST_ESP_OK(nvs_transaction_commit(handle));
+    CHECK(!keys_hold_old_values(handle));
+
+    // the commit is durable without nvs_commit(): reopen and check
+    nvs_close(handle);
+    TEST_ESP_OK(nvs_flash_deinit_partition(TEST_DEFAULT_PARTITION_NAME));
+    TEST_ESP_OK(nvs_flash_init_partition(TEST_DEFAULT_PARTITION_NAME));
+    TEST_ESP_OK(nvs_open_from_partition(TEST_DEFAULT_PARTITION_NAME, "txn_ns", NVS_READWRITE, &handle));
+    CHECK(!keys_hold_old_values(handle));
+
+    nvs_close(handle);
+    TEST_ESP_OK(nvs_flash_deinit_partition(TEST_DEFAULT_PARTITION_NAME));
+}
+
+TEST_CASE("transaction: abort discards every staged value", "[nvs][transaction]")
+{
+    TEST_ESP_OK(NVSPartitionTestHelper::erase_partition(TEST_DEFAULT_PARTITION_NAME));
+    TEST_ESP_OK(nvs_flash_init_partition(TEST_DEFAULT_PARTITION_NAME));
+
+    nvs_handle_t handle;
+    TEST_ESP_OK(nvs_open_from_partition(TEST_DEFAULT_PARTITION_NAME, "txn_ns", NVS_READWRITE, &handle));
+    write_initial_values(handle);
+
+    TEST_ESP_OK(nvs_transaction_begin(handle));
+    TEST_ESP_OK(nvs_set_i32(handle, "key1", 11));
+    TEST_ESP_OK(nvs_set_i32(handle, "key2", 12));
+    TEST_ESP_OK(nvs_set_str(handle, "key3", "new"));
+    TEST_ESP_OK(nvs_transaction_abort(handle));
+
+    CHECK(keys_hold_old_values(handle));
+
+    // a new transaction on the same handle works normally after an abort
+    TEST_ESP_OK(nvs_transaction_begin(handle));
+    TEST_ESP_OK(nvs_set_i32(handle, "key1", 11));
+    TEST_ESP_OK(nvs_set_i32(handle, "key2", 12));
+    TEST_ESP_OK(nvs_set_str(handle, "key3", "new"));
+    TEST_ESP_OK(nvs_transaction_commit(handle));
+    CHECK(!keys_hold_old_values(handle));
+
+    nvs_close(handle);
+    TEST_ESP_OK(nvs_flash_deinit_partition(TEST_DEFAULT_PARTITION_NAME));
+}
+
+TEST_CASE("transaction: journal key is reserved, erases are rejected", "[nvs][transaction]")
+{
+    TEST_ESP_OK(NVSPartitionTestHelper::erase_partition(TEST_DEFAULT_PARTITION_NAME));
+    TEST_ESP_OK(nvs_flash_init_partition(TEST_DEFAULT_PARTITION_NAME));
+
+    nvs_handle_t handle;
+    TEST_ESP_OK(nvs_open_from_partition(TEST_DEFAULT_PARTITION_NAME, "txn_ns", NVS_READWRITE, &handle));
+    write_initial_values(handle);
+
+    TEST_ESP_OK(nvs_transaction_begin(handle));
+    TEST_ESP_ERR(nvs_set_i32(handle, "nvs.txn.jrnl", 1), ESP_ERR_NVS_INVALID_NAME);
+    TEST_ESP_ERR(nvs_erase_key(handle, "key1"), ESP_ERR_NVS_INVALID_STATE);
+    TEST_ESP_ERR(nvs_erase_all(handle), ESP_ERR_NVS_INVALID_STATE);
+    TEST_ESP_OK(nvs_transaction_abort(handle));
+
+    nvs_close(handle);
+    TEST_ESP_OK(nvs_flash_deinit_partition(TEST_DEFAULT_PARTITION_NAME));
+}
+
+TEST_CASE("transaction: a power cut during commit leaves all old or all new values", "[nvs][transaction]")
+{
+    // Sweep the moment of the simulated power cut through the whole commit:
+    // through the journal write (no commit marker yet, the old values must
+    // survive untouched) and through the applies (journal committed, the next
+    // read-write open must roll the transaction forward). Any mix of old and
+    // new values after recovery is a failure.
+    const size_t max_err_delay = 1000;
+    size_t errDelay;
+    for (errDelay = 0; errDelay < max_err_delay; errDelay++) {
+        TEST_ESP_OK(NVSPartitionTestHelper::erase_partition(TEST_DEFAULT_PARTITION_NAME));
+        TEST_ESP_OK(nvs_flash_init_partition(TEST_DEFAULT_PARTITION_NAME));
+
+        nvs_handle_t handle;
+        TEST_ESP_OK(nvs_open_from_partition(TEST_DEFAULT_PARTITION_NAME, "txn_ns", NVS_READWRITE, &handle));
+        write_initial_values(handle);
+
+        NVSPartitionTestHelper::fail_after(errDelay, ESP_PARTITION_FAIL_AFTER_MODE_BOTH);
+
+        TEST_ESP_OK(nvs_transaction_begin(handle));
+        TEST_ESP_OK(nvs_set_i32(handle, "key1", 11));
+        TEST_ESP_OK(nvs_set_i32(handle, "key2", 12));
+        TEST_ESP_OK(nvs_set_str(handle, "key3", "new"));
+        esp_err_t commit_err = nvs_transaction_commit(handle);
+
+        nvs_close(handle);
+        TEST_ESP_OK(nvs_flash_deinit_partition(TEST_DEFAULT_PARTITION_NAME));
+
+        // Reopening read-write rolls forward a journal the cut left behind
+        // (the fault emulation is disarmed after its first hit)
+        TEST_ESP_OK(nvs_flash_init_partition(TEST_DEFAULT_PARTITION_NAME));
+        TEST_ESP_OK(nvs_open_from_partition(TEST_DEFAULT_PARTITION_NAME, "txn_ns", NVS_READWRITE, &handle));
+        bool old_values = keys_hold_old_values(handle);
+        nvs_close(handle);
+        TEST_ESP_OK(nvs_flash_deinit_partition(TEST_DEFAULT_PARTITION_NAME));
+
+        if (commit_err == ESP_OK) {
+            // The delay is past the whole commit: values must be the new ones
+            // and the sweep is complete
+            CHECK(!old_values);
+            break;
+        }
+    }
+    CHECK(errDelay < max_err_delay);
+}
+
+#endif // CONFIG_NVS_TRANSACTION
@@ -12,6 +12,7 @@ from pytest_embedded_idf.utils import idf_parametrize
         'default_set_key',
         'legacy_set_key',
         'esp_blockdev',
+        'transaction',
     ],
     indirect=True,
 )
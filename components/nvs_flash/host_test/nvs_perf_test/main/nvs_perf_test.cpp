@@ -0,0 +1,318 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host benchmark for the NVS core (nvs::Page / nvs::PageManager / nvs::Storage)
+ * over the linux partition emulation. Unlike the unit test apps next to it,
+ * this app runs large-scale scenarios (millions of key operations, page
+ * rotation/compaction churn, blob chunking) so that algorithmic regressions
+ * can be profiled on the host with perf or valgrind before they reach
+ * hardware.
+ *
+ * Usage: nvs_perf_host.elf [name=value ...]
+ *   ops=N        total key operations per scenario       (default 1000000)
+ *   keys=N       distinct keys the operations cycle over (default 64)
+ *   sectors=N    emulated partition size in 4K sectors   (default 16)
+ *   blob_size=N  blob payload size in bytes, 0 disables  (default 1024)
+ *   read_ns=N    simulated flash latency per read call   (default 0)
+ *   write_ns=N   simulated flash latency per write call  (default 0)
+ *   erase_us=N   simulated flash latency per sector erase (default 0)
+ *
+ * With the latency knobs at 0 the run is purely algorithmic (ideal for
+ * valgrind/callgrind); non-zero values approximate real flash so that the
+ * relative cost of page compaction and erase cycles shows up in the profile.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <cinttypes>
+
+#include "nvs.h"
+#include "nvs_partition.hpp"
+#include "nvs_storage.hpp"
+#include "esp_private/partition_linux.h"
+
+using namespace nvs;
+
+typedef struct {
+    uint64_t ops;
+    uint32_t keys;
+    uint32_t sectors;
+    uint32_t blob_size;
+    uint32_t read_ns;
+    uint32_t write_ns;
+    uint32_t erase_us;
+} perf_config_t;
+
+static uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Busy-waits so the simulated flash time is attributed to the NVS call
+// stack in profiler output, instead of disappearing into the scheduler.
+static void spin_ns(uint64_t ns)
+{
+    if (ns == 0) {
+        return;
+    }
+    uint64_t until = now_ns() + ns;
+    while (now_ns() < until) { }
+}
+
+/*
+ * NVSPartition wrapper injecting a configurable latency into every flash
+ * access, approximating the read/program/erase times of a real NOR flash.
+ */
+class LatencyPartition : public NVSPartition {
+public:
+    LatencyPartition(const esp_partition_t *partition, const perf_config_t &cfg)
+        : NVSPartition(partition), mCfg(cfg) { }
+
+    esp_err_t read_raw(size_t src_offset, void *dst, size_t size) override
+    {
+        spin_ns(mCfg.read_ns);
+        return NVSPartition::read_raw(src_offset, dst, size);
+    }
+
+    esp_err_t read(size_t src_offset, void *dst, size_t size) override
+    {
+        spin_ns(mCfg.read_ns);
+        return NVSPartition::read(src_offset, dst, size);
+    }
+
+    esp_err_t write_raw(size_t dst_offset, const void *src, size_t size) override
+    {
+        spin_ns(mCfg.write_ns);
+        return NVSPartition::write_raw(dst_offset, src, size);
+    }
+
+    esp_err_t write(size_t dst_offset, const void *src, size_t size) override
+    {
+        spin_ns(mCfg.write_ns);
+        return NVSPartition::write(dst_offset, src, size);
+    }
+
+    esp_err_t erase_range(size_t dst_offset, size_t size) override
+    {
+        spin_ns((uint64_t)mCfg.erase_us * 1000ULL *
+                ((size + ESP_PARTITION_EMULATED_SECTOR_SIZE - 1) / ESP_PARTITION_EMULATED_SECTOR_SIZE));
+        return NVSPartition::erase_range(dst_offset, size);
+    }
+
+private:
+    perf_config_t mCfg;
+};
+
+// Stripped-down variant of the unit tests' PartitionEmulationFixture:
+// no unity, partition size configurable beyond the default 4MB flash file.
+class PerfPartitionFixture {
+public:
+    explicit PerfPartitionFixture(const perf_config_t &cfg)
+        : esp_partition(), part(&esp_partition, cfg)
+    {
+        const size_t needed = (size_t)cfg.sectors * ESP_PARTITION_EMULATED_SECTOR_SIZE;
+        if (needed > ESP_PARTITION_DEFAULT_EMULATED_FLASH_SIZE) {
+            esp_partition_get_file_mmap_ctrl_input()->flash_file_size = needed;
+        }
+
+        const uint8_t *unused;
+        if (esp_partition_file_mmap(&unused) != ESP_OK) {
+            fprintf(stderr, "Failed to initialize esp_partition_file_mmap\n");
+            exit(1);
+        }
+
+        esp_partition.address = 0;
+        esp_partition.size = needed;
+        esp_partition.erase_size = ESP_PARTITION_EMULATED_SECTOR_SIZE;
+        esp_partition.type = ESP_PARTITION_TYPE_DATA;
+        esp_partition.subtype = ESP_PARTITION_SUBTYPE_DATA_NVS;
+        strncpy(esp_partition.label, NVS_DEFAULT_PART_NAME, NVS_PART_NAME_MAX_SIZE);
+        esp_partition.label[NVS_PART_NAME_MAX_SIZE] = 0;
+
+        esp_partition_erase_range(&esp_partition, 0, esp_partition.size);
+    }
+
+    ~PerfPartitionFixture()
+    {
+        esp_partition_get_file_mmap_ctrl_input()->remove_dump = true;
+        esp_partition_file_munmap();
+    }
+
+protected:
+    esp_partition_t esp_partition;
+public:
+    LatencyPartition part;
+};
+
+static void report(const char *name, uint64_t ops, uint64_t elapsed_ns)
+{
+    printf("%-24s ops=%-10" PRIu64 " total_ms=%-8" PRIu64 " ns/op=%-8" PRIu64 " ops/s=%" PRIu64 "\n",
+           name, ops, elapsed_ns / 1000000ULL,
+           ops ? elapsed_ns / ops : 0,
+           elapsed_ns ? (ops * 1000000000ULL) / elapsed_ns : 0);
+}
+
+static void make_key(char *key, uint32_t i)
+{
+    snprintf(key, Item::MAX_KEY_LENGTH + 1, "key_%08" PRIx32, i);
+}
+
+// Repeated u32 updates over a rotating key set. With keys * rewrites well
+// beyond the partition's entry capacity this is dominated by page rotation
+// and compaction — the hot path for wear-related regressions.
+static int bench_u32_update_churn(Storage &storage, uint8_t ns, const perf_config_t &cfg)
+{
+    char key[Item::MAX_KEY_LENGTH + 1];
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < cfg.ops; i++) {
+        make_key(key, (uint32_t)(i % cfg.keys));
+        esp_err_t err = storage.writeItem(ns, key, (uint32_t)i);
+        if (err != ESP_OK) {
+            fprintf(stderr, "writeItem failed at op %" PRIu64 ": 0x%x\n", i, err);
+            return 1;
+        }
+    }
+    report("u32_update_churn", cfg.ops, now_ns() - start);
+    return 0;
+}
+
+// Repeated reads of resident keys — exercises the item hash list lookup
+// without touching write paths.
+static int bench_u32_read_hot(Storage &storage, uint8_t ns, const perf_config_t &cfg)
+{
+    char key[Item::MAX_KEY_LENGTH + 1];
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < cfg.ops; i++) {
+        make_key(key, (uint32_t)(i % cfg.keys));
+        uint32_t val;
+        esp_err_t err = storage.readItem(ns, key, val);
+        if (err != ESP_OK) {
+            fprintf(stderr, "readItem failed at op %" PRIu64 ": 0x%x\n", i, err);
+            return 1;
+        }
+    }
+    report("u32_read_hot", cfg.ops, now_ns() - start);
+    return 0;
+}
+
+// Blob rewrite/read cycle — exercises chunked writes, blob index handling
+// and the multi-page reclaim path. Op count is scaled down since each
+// operation moves blob_size bytes.
+static int bench_blob_churn(Storage &storage, uint8_t ns, const perf_config_t &cfg)
+{
+    if (cfg.blob_size == 0) {
+        return 0;
+    }
+    uint8_t *buf = (uint8_t *)malloc(cfg.blob_size);
+    if (buf == NULL) {
+        return 1;
+    }
+    memset(buf, 0xa5, cfg.blob_size);
+
+    uint64_t blob_ops = cfg.ops / 64 ? cfg.ops / 64 : 1;
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < blob_ops; i++) {
+        buf[0] = (uint8_t)i;
+        esp_err_t err = storage.writeItem(ns, ItemType::BLOB, "blob", buf, cfg.blob_size);
+        if (err == ESP_OK) {
+            err = storage.readItem(ns, ItemType::BLOB, "blob", buf, cfg.blob_size);
+        }
+        if (err != ESP_OK) {
+            fprintf(stderr, "blob op failed at op %" PRIu64 ": 0x%x\n", i, err);
+            free(buf);
+            return 1;
+        }
+    }
+    report("blob_churn", blob_ops * 2, now_ns() - start);
+    free(buf);
+    return 0;
+}
+
+static int parse_args(int argc, char **argv, perf_config_t *cfg)
+{
+    for (int i = 1; i < argc; i++) {
+        char name[32];
+        uint64_t value;
+        if (sscanf(argv[i], "%31[a-z_]=%" SCNu64, name, &value) != 2) {
+            fprintf(stderr, "Unrecognized argument: %s\n", argv[i]);
+            return 1;
+        }
+        if (strcmp(name, "ops") == 0) {
+            cfg->ops = value;
+        } else if (strcmp(name, "keys") == 0) {
+            cfg->keys = (uint32_t)value;
+        } else if (strcmp(name, "sectors") == 0) {
+            cfg->sectors = (uint32_t)value;
+        } else if (strcmp(name, "blob_size") == 0) {
+            cfg->blob_size = (uint32_t)value;
+        } else if (strcmp(name, "read_ns") == 0) {
+            cfg->read_ns = (uint32_t)value;
+        } else if (strcmp(name, "write_ns") == 0) {
+            cfg->write_ns = (uint32_t)value;
+        } else if (strcmp(name, "erase_us") == 0) {
+            cfg->erase_us = (uint32_t)value;
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", name);
+            return 1;
+        }
+    }
+    if (cfg->ops == 0 || cfg->keys == 0 || cfg->sectors < 3) {
+        fprintf(stderr, "Invalid configuration (need ops > 0, keys > 0, sectors >= 3)\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    perf_config_t cfg = {
+        .ops = 1000000,
+        .keys = 64,
+        .sectors = 16,
+        .blob_size = 1024,
+        .read_ns = 0,
+        .write_ns = 0,
+        .erase_us = 0,
+    };
+    if (parse_args(argc, argv, &cfg) != 0) {
+        return 1;
+    }
+
+    printf("nvs_perf: ops=%" PRIu64 " keys=%" PRIu32 " sectors=%" PRIu32
+           " blob_size=%" PRIu32 " read_ns=%" PRIu32 " write_ns=%" PRIu32
+           " erase_us=%" PRIu32 "\n",
+           cfg.ops, cfg.keys, cfg.sectors, cfg.blob_size,
+           cfg.read_ns, cfg.write_ns, cfg.erase_us);
+
+    PerfPartitionFixture fix(cfg);
+    Storage storage(&fix.part);
+
+    esp_err_t err = storage.init(0, cfg.sectors);
+    if (err != ESP_OK) {
+        fprintf(stderr, "Storage::init failed: 0x%x\n", err);
+        return 1;
+    }
+
+    uint8_t ns;
+    err = storage.createOrOpenNamespace("perf", true, ns);
+    if (err != ESP_OK) {
+        fprintf(stderr, "createOrOpenNamespace failed: 0x%x\n", err);
+        return 1;
+    }
+
+    if (bench_u32_update_churn(storage, ns, cfg) != 0 ||
+        bench_u32_read_hot(storage, ns, cfg) != 0 ||
+        bench_blob_churn(storage, ns, cfg) != 0) {
+        return 1;
+    }
+
+    return 0;
+}
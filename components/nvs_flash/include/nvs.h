@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include "esp_attr.h"
 #include "esp_err.h"
+#include "sdkconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -500,6 +501,35 @@ esp_err_t nvs_get_str (nvs_handle_t handle, const char* key, char* out_value, si
 esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out_value, size_t* length);
 /**@}*/
 
+/**
+ * @brief      Read part of a blob value for given key
+ *
+ * Unlike \c nvs_get_blob, this function reads only the requested byte range of
+ * the stored blob, so a single record can be picked out of a large blob with a
+ * buffer of just the record size. Only the data chunks overlapping the range
+ * are read from flash; chunks before the range are skipped entirely. Reading a
+ * chunk that only partially overlaps the range still transfers that whole
+ * chunk internally, since the data checksum covers complete chunks.
+ *
+ * @param[in]   handle     Handle obtained from nvs_open function.
+ * @param[in]   key        Key name. Maximum length is (NVS_KEY_NAME_MAX_SIZE-1) characters. Shouldn't be empty.
+ * @param[in]   offset     Byte offset into the stored blob to start reading at.
+ * @param[out]  out_value  Buffer receiving the range; must hold at least length bytes.
+ * @param[in]   length     Number of bytes to read. offset + length must not
+ *                         exceed the stored blob size; use nvs_get_blob with
+ *                         out_value set to NULL to query the size.
+ *
+ * @return
+ *             - ESP_OK if the range was retrieved successfully
+ *             - ESP_ERR_INVALID_ARG if out_value is NULL and length is non-zero
+ *             - ESP_ERR_NVS_NOT_FOUND if the requested key doesn't exist or the
+ *               stored blob is corrupt
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - ESP_ERR_NVS_INVALID_LENGTH if offset + length exceeds the stored blob size
+ *             - ESP_ERR_NO_MEM if a temporary chunk buffer can't be allocated
+ */
+esp_err_t nvs_get_blob_range(nvs_handle_t handle, const char* key, size_t offset, void* out_value, size_t length);
+
 /**
  * @brief      Lookup key-value pair with given key name.
  *
@@ -575,6 +605,123 @@ esp_err_t nvs_erase_all(nvs_handle_t handle);
  */
 esp_err_t nvs_commit(nvs_handle_t handle);
 
+#ifdef CONFIG_NVS_ASYNC_COMMIT
+/**
+ * @brief      Queue a write to be performed by the background commit task
+ *
+ * The key and value are copied into a RAM journal and the call returns without touching
+ * flash; a low-priority background task performs the actual write, including any page
+ * erase or garbage collection it triggers. This keeps worst-case flash stalls off the
+ * calling task.
+ *
+ * A queued write is not durable and not visible to nvs_get_* until the background task
+ * has applied it; call nvs_async_commit_barrier() to wait for that. The barrier must also
+ * be called before nvs_close() on the handle, otherwise pending writes for it fail with
+ * ESP_ERR_NVS_INVALID_HANDLE.
+ *
+ * If the queue is full, the call blocks until the background task drains an entry.
+ *
+ * @param[in]  handle  Handle obtained from nvs_open function.
+ *                     Handles that were opened read only cannot be used.
+ * @param[in]  key     Key name. Maximum length is (NVS_KEY_NAME_MAX_SIZE-1) characters. Shouldn't be empty.
+ * @param[in]  type    Type of the value; NVS_TYPE_ANY is not allowed.
+ * @param[in]  value   Pointer to the value to copy into the journal.
+ * @param[in]  length  Length of the value in bytes. For NVS_TYPE_STR, zero means
+ *                     strlen(value) + 1. For integer types it must match the type size.
+ *
+ * @return
+ *             - ESP_OK if the write was queued successfully
+ *             - ESP_ERR_INVALID_ARG if key or value is NULL, the type is invalid or the
+ *               length does not match the type
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - ESP_ERR_NVS_READ_ONLY if storage handle was opened as read only
+ *             - ESP_ERR_NVS_KEY_TOO_LONG if the key name is too long
+ *             - ESP_ERR_NO_MEM if the journal copy or the background task can't be allocated
+ */
+esp_err_t nvs_set_deferred(nvs_handle_t handle, const char* key, nvs_type_t type, const void* value, size_t length);
+
+/**
+ * @brief      Wait until all queued deferred writes have been applied to flash
+ *
+ * Returns once the write-behind queue is empty and the background task is idle. After
+ * this call, every value queued with nvs_set_deferred() before the barrier is durable
+ * and readable through nvs_get_*.
+ *
+ * @return
+ *             - ESP_OK if all pending writes were applied successfully
+ *             - the first error encountered by the background task since the previous
+ *               barrier, if any write failed; the remaining writes are still applied
+ */
+esp_err_t nvs_async_commit_barrier(void);
+#endif // CONFIG_NVS_ASYNC_COMMIT
+
+#ifdef CONFIG_NVS_TRANSACTION
+/**
+ * @brief      Start an atomic multi-key transaction on the handle
+ *
+ * Until nvs_transaction_commit() or nvs_transaction_abort() is called, all
+ * nvs_set_* calls on this handle stage their values in RAM instead of writing
+ * to flash. Staging the same key again replaces its staged value. Reads keep
+ * returning the last committed values and nvs_erase_key()/nvs_erase_all() are
+ * rejected with ESP_ERR_NVS_INVALID_STATE while the transaction is open.
+ *
+ * @param[in]  handle  Handle obtained from nvs_open function.
+ *                     Handles that were opened read only cannot be used.
+ *
+ * @return
+ *             - ESP_OK if the transaction was started
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - ESP_ERR_NVS_READ_ONLY if storage handle was opened as read only
+ *             - ESP_ERR_NVS_INVALID_STATE if a transaction is already open on the handle
+ */
+esp_err_t nvs_transaction_begin(nvs_handle_t handle);
+
+/**
+ * @brief      Atomically commit all values staged since nvs_transaction_begin()
+ *
+ * The staged values are serialized into a single journal entry written to the
+ * namespace in one contiguous pass, then applied key by key and the journal is
+ * erased. The journal write is the commit point: a power cut before it leaves
+ * every key at its old value, a power cut after it is rolled forward the next
+ * time the namespace is opened read-write. Readers on other handles never see
+ * a partially applied transaction survive a reboot.
+ *
+ * The commit is durable when this function returns; no separate nvs_commit()
+ * call is needed.
+ *
+ * If applying fails partway after the journal was written (e.g. out of
+ * space), the journal is kept on flash and the error is returned: reads may
+ * then observe a mix of old and new values until the next read-write open of
+ * the namespace rolls the transaction forward.
+ *
+ * @param[in]  handle  Handle with an open transaction.
+ *
+ * @return
+ *             - ESP_OK if all staged values were written
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - ESP_ERR_NVS_INVALID_STATE if no transaction is open on the handle
+ *             - ESP_ERR_NVS_NOT_ENOUGH_SPACE if the journal or the values do not fit;
+ *               note the journal temporarily needs space for all staged values at once
+ *             - ESP_ERR_NO_MEM if the journal buffer can't be allocated
+ *             - other error codes from the underlying storage driver
+ */
+esp_err_t nvs_transaction_commit(nvs_handle_t handle);
+
+/**
+ * @brief      Discard all staged values of the open transaction
+ *
+ * No flash is touched; every key keeps its last committed value.
+ *
+ * @param[in]  handle  Handle with an open transaction.
+ *
+ * @return
+ *             - ESP_OK if the staged values were discarded
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - ESP_ERR_NVS_INVALID_STATE if no transaction is open on the handle
+ */
+esp_err_t nvs_transaction_abort(nvs_handle_t handle);
+#endif // CONFIG_NVS_TRANSACTION
+
 /**
  * @brief      Close the storage handle and free any allocated resources
  *
@@ -773,6 +920,31 @@ esp_err_t nvs_entry_find_in_handle(nvs_handle_t handle, nvs_type_t type, nvs_ite
  */
 esp_err_t nvs_entry_next(nvs_iterator_t *iterator);
 
+/**
+ * @brief       Copies a batch of entries to out_entries and advances the iterator past them.
+ *
+ * The batch starts with the entry the iterator currently points to. Entries are served from an
+ * in-RAM copy of each visited page, so every page is read from flash only once per batch instead
+ * of entry by entry, which makes enumerating large namespaces considerably faster than repeated
+ * nvs_entry_next() calls.
+ *
+ * When the iteration is finished during the call, the iterator is freed and set to NULL; the
+ * entries collected up to that point are still returned with ESP_OK.
+ *
+ * @param[inout] iterator       Iterator obtained from nvs_entry_find or nvs_entry_find_in_handle.
+ *                              Must be non-NULL and must point to a non-NULL iterator.
+ * @param[out]   out_entries    Array receiving up to entry_capacity entry descriptions
+ * @param[in]    entry_capacity Size of the out_entries array in entries
+ * @param[out]   copied         Number of entries written to out_entries
+ *
+ * @return
+ *          - ESP_OK if at least one entry was copied
+ *          - ESP_ERR_NVS_NOT_FOUND if the iterator was already exhausted; iterator is freed and
+ *            set to NULL
+ *          - ESP_ERR_INVALID_ARG if any of the arguments is NULL
+ */
+esp_err_t nvs_entry_next_batch(nvs_iterator_t *iterator, nvs_entry_info_t *out_entries, size_t entry_capacity, size_t *copied);
+
 /**
  * @brief       Fills nvs_entry_info_t structure with information about entry pointed to by the iterator.
  *
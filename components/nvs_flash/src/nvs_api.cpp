@@ -19,6 +19,13 @@
 #include "nvs_internal.h"
 #include "nvs_partition_lookup.hpp"
 
+#ifdef CONFIG_NVS_ASYNC_COMMIT
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/event_groups.h"
+#endif
+
 // Uncomment this line to force output from this module
 // #define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
 #include "esp_log.h"
@@ -447,6 +454,251 @@ extern "C" esp_err_t nvs_commit(nvs_handle_t c_handle)
     return handle->commit();
 }
 
+#ifdef CONFIG_NVS_ASYNC_COMMIT
+
+typedef struct {
+    nvs_handle_t handle;
+    ItemType datatype;
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    void* data;
+    size_t dataSize;
+} nvs_deferred_op_t;
+
+#define NVS_DEFERRED_DRAINED_BIT BIT0
+
+static QueueHandle_t s_deferred_queue;
+static EventGroupHandle_t s_deferred_events;
+// Both guarded by s_deferred_mux
+static size_t s_deferred_pending;
+static esp_err_t s_deferred_err = ESP_OK;
+static portMUX_TYPE s_deferred_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static void nvs_deferred_worker(void*)
+{
+    nvs_deferred_op_t op;
+    for (;;) {
+        if (xQueueReceive(s_deferred_queue, &op, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        esp_err_t err;
+        {
+            Lock lock;
+            NVSHandleSimple *handle;
+            err = nvs_find_ns_handle(op.handle, &handle);
+            if (err == ESP_OK) {
+                err = handle->set_typed_item(op.datatype, op.key, op.data, op.dataSize);
+            }
+        }
+        free(op.data);
+
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "deferred write of key '%s' failed (0x%x)", op.key, err);
+        }
+
+        portENTER_CRITICAL(&s_deferred_mux);
+        if (err != ESP_OK && s_deferred_err == ESP_OK) {
+            s_deferred_err = err;
+        }
+        bool drained = (--s_deferred_pending == 0);
+        portEXIT_CRITICAL(&s_deferred_mux);
+
+        if (drained) {
+            xEventGroupSetBits(s_deferred_events, NVS_DEFERRED_DRAINED_BIT);
+        }
+    }
+}
+
+// Create queue and worker task on first use; called with Lock held
+static esp_err_t nvs_deferred_start(void)
+{
+    if (s_deferred_queue != nullptr) {
+        return ESP_OK;
+    }
+
+    QueueHandle_t queue = xQueueCreate(CONFIG_NVS_ASYNC_COMMIT_QUEUE_DEPTH, sizeof(nvs_deferred_op_t));
+    EventGroupHandle_t events = xEventGroupCreate();
+    if (queue == nullptr || events == nullptr) {
+        if (queue != nullptr) {
+            vQueueDelete(queue);
+        }
+        if (events != nullptr) {
+            vEventGroupDelete(events);
+        }
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_deferred_queue = queue;
+    s_deferred_events = events;
+    if (xTaskCreate(nvs_deferred_worker, "nvs_async", CONFIG_NVS_ASYNC_COMMIT_TASK_STACK_SIZE,
+                    nullptr, CONFIG_NVS_ASYNC_COMMIT_TASK_PRIORITY, nullptr) != pdPASS) {
+        s_deferred_queue = nullptr;
+        s_deferred_events = nullptr;
+        vQueueDelete(queue);
+        vEventGroupDelete(events);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+extern "C" esp_err_t nvs_set_deferred(nvs_handle_t c_handle, const char* key, nvs_type_t type, const void* value, size_t length)
+{
+    if (key == nullptr || value == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (strlen(key) >= NVS_KEY_NAME_MAX_SIZE) {
+        return ESP_ERR_NVS_KEY_TOO_LONG;
+    }
+
+    size_t dataSize = length;
+    switch (type) {
+        case NVS_TYPE_U8:
+        case NVS_TYPE_I8:
+            if (length != sizeof(uint8_t)) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            break;
+        case NVS_TYPE_U16:
+        case NVS_TYPE_I16:
+            if (length != sizeof(uint16_t)) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            break;
+        case NVS_TYPE_U32:
+        case NVS_TYPE_I32:
+            if (length != sizeof(uint32_t)) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            break;
+        case NVS_TYPE_U64:
+        case NVS_TYPE_I64:
+            if (length != sizeof(uint64_t)) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            break;
+        case NVS_TYPE_STR:
+            if (dataSize == 0) {
+                dataSize = strlen(static_cast<const char*>(value)) + 1;
+            }
+            break;
+        case NVS_TYPE_BLOB:
+            break;
+        default:
+            return ESP_ERR_INVALID_ARG;
+    }
+
+    nvs_deferred_op_t op;
+    op.handle = c_handle;
+    op.datatype = static_cast<ItemType>(type);
+    strlcpy(op.key, key, sizeof(op.key));
+    op.dataSize = dataSize;
+    op.data = malloc(dataSize);
+    if (op.data == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(op.data, value, dataSize);
+
+    {
+        Lock lock;
+        NVSHandleSimple *handle;
+        esp_err_t err = nvs_find_ns_handle(c_handle, &handle);
+        if (err == ESP_OK && handle->is_read_only()) {
+            err = ESP_ERR_NVS_READ_ONLY;
+        }
+        if (err == ESP_OK) {
+            err = nvs_deferred_start();
+        }
+        if (err != ESP_OK) {
+            free(op.data);
+            return err;
+        }
+
+        portENTER_CRITICAL(&s_deferred_mux);
+        s_deferred_pending++;
+        portEXIT_CRITICAL(&s_deferred_mux);
+    }
+
+    // Block outside of the NVS lock so the worker can drain the queue
+    if (xQueueSend(s_deferred_queue, &op, portMAX_DELAY) != pdTRUE) {
+        portENTER_CRITICAL(&s_deferred_mux);
+        bool drained = (--s_deferred_pending == 0);
+        portEXIT_CRITICAL(&s_deferred_mux);
+        if (drained) {
+            xEventGroupSetBits(s_deferred_events, NVS_DEFERRED_DRAINED_BIT);
+        }
+        free(op.data);
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+extern "C" esp_err_t nvs_async_commit_barrier(void)
+{
+    if (s_deferred_queue == nullptr) {
+        return ESP_OK;
+    }
+
+    xEventGroupClearBits(s_deferred_events, NVS_DEFERRED_DRAINED_BIT);
+
+    portENTER_CRITICAL(&s_deferred_mux);
+    size_t pending = s_deferred_pending;
+    portEXIT_CRITICAL(&s_deferred_mux);
+
+    if (pending != 0) {
+        xEventGroupWaitBits(s_deferred_events, NVS_DEFERRED_DRAINED_BIT, pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+
+    portENTER_CRITICAL(&s_deferred_mux);
+    esp_err_t err = s_deferred_err;
+    s_deferred_err = ESP_OK;
+    portEXIT_CRITICAL(&s_deferred_mux);
+
+    return err;
+}
+
+#endif // CONFIG_NVS_ASYNC_COMMIT
+
+#ifdef CONFIG_NVS_TRANSACTION
+
+extern "C" esp_err_t nvs_transaction_begin(nvs_handle_t c_handle)
+{
+    Lock lock;
+    ESP_LOGD(TAG, "%s", __func__);
+    NVSHandleSimple *handle;
+    auto err = nvs_find_ns_handle(c_handle, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    return handle->beginTransaction();
+}
+
+extern "C" esp_err_t nvs_transaction_commit(nvs_handle_t c_handle)
+{
+    Lock lock;
+    ESP_LOGD(TAG, "%s", __func__);
+    NVSHandleSimple *handle;
+    auto err = nvs_find_ns_handle(c_handle, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    return handle->commitTransaction();
+}
+
+extern "C" esp_err_t nvs_transaction_abort(nvs_handle_t c_handle)
+{
+    Lock lock;
+    ESP_LOGD(TAG, "%s", __func__);
+    NVSHandleSimple *handle;
+    auto err = nvs_find_ns_handle(c_handle, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    return handle->abortTransaction();
+}
+
+#endif // CONFIG_NVS_TRANSACTION
+
 extern "C" esp_err_t nvs_set_str(nvs_handle_t c_handle, const char* key, const char* value)
 {
     Lock lock;
@@ -565,6 +817,23 @@ extern "C" esp_err_t nvs_get_blob(nvs_handle_t c_handle, const char* key, void*
     return nvs_get_str_or_blob(c_handle, nvs::ItemType::BLOB, key, out_value, length);
 }
 
+extern "C" esp_err_t nvs_get_blob_range(nvs_handle_t c_handle, const char* key, size_t offset, void* out_value, size_t length)
+{
+    Lock lock;
+    ESP_LOGD(TAG, "%s %s %u %u", __func__, key, static_cast<unsigned>(offset), static_cast<unsigned>(length));
+    NVSHandleSimple *handle;
+    auto err = nvs_find_ns_handle(c_handle, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    if (out_value == nullptr && length != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return handle->get_blob_range(key, offset, out_value, length);
+}
+
 extern "C" esp_err_t nvs_get_stats(const char* part_name, nvs_stats_t* nvs_stats)
 {
     Lock lock;
@@ -898,6 +1167,24 @@ extern "C" esp_err_t nvs_entry_next(nvs_iterator_t *iterator)
     return ESP_OK;
 }
 
+extern "C" esp_err_t nvs_entry_next_batch(nvs_iterator_t *iterator, nvs_entry_info_t *out_entries, size_t entry_capacity, size_t *copied)
+{
+    if (iterator == nullptr || *iterator == nullptr || out_entries == nullptr || copied == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    Lock lock;
+
+    bool moreEntries = (*iterator)->storage->nextEntryBatch(*iterator, out_entries, entry_capacity, *copied);
+    if (!moreEntries) {
+        free(*iterator);
+        *iterator = nullptr;
+        return (*copied == 0) ? ESP_ERR_NVS_NOT_FOUND : ESP_OK;
+    }
+
+    return ESP_OK;
+}
+
 extern "C" esp_err_t nvs_entry_info(const nvs_iterator_t it, nvs_entry_info_t *out_info)
 {
     if (it == nullptr || out_info == nullptr) {
@@ -4,6 +4,10 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <cstring>
+#include "sdkconfig.h"
+#ifdef CONFIG_NVS_ENCRYPTED_PAGE_CACHE
+#include "esp_heap_caps.h"
+#endif
 #include "nvs_encrypted_partition.hpp"
 #include "nvs_types.hpp"
 #include "nvs_constants.h"
@@ -43,6 +47,19 @@ esp_err_t NVSEncryptedPartition::read(size_t src_offset, void* dst, size_t size)
     // here we make sure that the size is really compliant with the minimal encryption block size.
     if (size % NVS_ENCRYPT_BLOCK_SIZE != 0) return ESP_ERR_INVALID_SIZE;
 
+#ifdef CONFIG_NVS_ENCRYPTED_PAGE_CACHE
+    // Only whole entries are served from the page cache; anything else keeps
+    // the direct path below (one XTS data unit over the requested range)
+    if (size == NVS_CONST_ENTRY_SIZE && src_offset % NVS_CONST_ENTRY_SIZE == 0) {
+        return readViaPageCache(src_offset, dst, size);
+    }
+#endif
+
+    return readDecrypted(src_offset, dst, size);
+}
+
+esp_err_t NVSEncryptedPartition::readDecrypted(size_t src_offset, void* dst, size_t size)
+{
     // read data
     esp_err_t read_result = NVSPartition::read(src_offset, dst, size);
     if (read_result != ESP_OK) {
@@ -113,7 +130,123 @@ esp_err_t NVSEncryptedPartition::write(size_t addr, const void* src, size_t size
 
     delete [] buf;
 
+#ifdef CONFIG_NVS_ENCRYPTED_PAGE_CACHE
+    // write-through: drop the cached pages the write touched so the next
+    // read decrypts the current flash content
+    if (result == ESP_OK) {
+        invalidateCachedRange(addr, size);
+    }
+#endif
+
     return result;
 }
 
+#ifdef CONFIG_NVS_ENCRYPTED_PAGE_CACHE
+
+NVSEncryptedPartition::~NVSEncryptedPartition()
+{
+    for (auto& page : mPageCache) {
+        if (page.data != nullptr) {
+            memset(page.data, 0, NVS_CONST_PAGE_SIZE);
+            free(page.data);
+            page.data = nullptr;
+        }
+        page.valid = false;
+    }
+}
+
+esp_err_t NVSEncryptedPartition::erase_range(size_t dst_offset, size_t size)
+{
+    esp_err_t result = NVSPartition::erase_range(dst_offset, size);
+    if (result == ESP_OK) {
+        invalidateCachedRange(dst_offset, size);
+    }
+    return result;
+}
+
+void NVSEncryptedPartition::zeroizePageCache()
+{
+    for (auto& page : mPageCache) {
+        if (page.data != nullptr) {
+            memset(page.data, 0, NVS_CONST_PAGE_SIZE);
+        }
+        page.valid = false;
+    }
+}
+
+void NVSEncryptedPartition::invalidateCachedRange(size_t addr, size_t size)
+{
+    uint32_t first = addr & ~(NVS_CONST_PAGE_SIZE - 1);
+    uint32_t last = (addr + size - 1) & ~(NVS_CONST_PAGE_SIZE - 1);
+
+    for (auto& page : mPageCache) {
+        if (page.valid && page.pageAddr >= first && page.pageAddr <= last) {
+            memset(page.data, 0, NVS_CONST_PAGE_SIZE);
+            page.valid = false;
+        }
+    }
+}
+
+esp_err_t NVSEncryptedPartition::readViaPageCache(size_t src_offset, void* dst, size_t size)
+{
+    // NVS serializes all partition access behind its global lock, so the
+    // cache state needs no locking of its own
+    uint32_t pageAddr = src_offset & ~(NVS_CONST_PAGE_SIZE - 1);
+    CachedPage* page = nullptr;
+    CachedPage* victim = &mPageCache[0];
+
+    for (auto& entry : mPageCache) {
+        if (entry.valid && entry.pageAddr == pageAddr) {
+            page = &entry;
+            break;
+        }
+        if ((victim->valid && !entry.valid) ||
+                (victim->valid == entry.valid && entry.lastUsed < victim->lastUsed)) {
+            victim = &entry;
+        }
+    }
+
+    if (page == nullptr) {
+        if (victim->data == nullptr) {
+            victim->data = static_cast<uint8_t*>(
+                heap_caps_malloc(NVS_CONST_PAGE_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+            if (victim->data == nullptr) {
+                // no internal RAM for the page buffer, serve the entry directly
+                return readDecrypted(src_offset, dst, size);
+            }
+        }
+        victim->valid = false;
+
+        esp_err_t err = NVSPartition::read(pageAddr, victim->data, NVS_CONST_PAGE_SIZE);
+        if (err != ESP_OK) {
+            return err;
+        }
+
+        // decrypt entry by entry, matching the per-entry XTS data units used
+        // by write()
+        uint8_t data_unit[NVS_ENCRYPT_BLOCK_SIZE];
+        memset(data_unit, 0, sizeof(data_unit));
+
+        for (uint32_t offset = 0; offset < NVS_CONST_PAGE_SIZE; offset += NVS_CONST_ENTRY_SIZE) {
+            uint32_t *addr_loc = (uint32_t*) &data_unit[0];
+            *addr_loc = pageAddr + offset;
+            if (mbedtls_aes_crypt_xts(&mDctxt, MBEDTLS_AES_DECRYPT, NVS_CONST_ENTRY_SIZE,
+                                      data_unit, victim->data + offset, victim->data + offset) != 0) {
+                memset(victim->data, 0, NVS_CONST_PAGE_SIZE);
+                return ESP_ERR_NVS_XTS_DECR_FAILED;
+            }
+        }
+
+        victim->pageAddr = pageAddr;
+        victim->valid = true;
+        page = victim;
+    }
+
+    page->lastUsed = ++mCacheUseCounter;
+    memcpy(dst, page->data + (src_offset - pageAddr), size);
+    return ESP_OK;
+}
+
+#endif // CONFIG_NVS_ENCRYPTED_PAGE_CACHE
+
 } // nvs
@@ -29,7 +29,11 @@ public:
     NVSEncryptedPartition(const esp_partition_t *partition);
 #endif
 
+#ifdef CONFIG_NVS_ENCRYPTED_PAGE_CACHE
+    virtual ~NVSEncryptedPartition();
+#else
     virtual ~NVSEncryptedPartition() { }
+#endif
 
     /**
      * Initializes the AES encryption components with the provided configuration.
@@ -72,9 +76,49 @@ public:
      */
     esp_err_t write(size_t dst_offset, const void* src, size_t size) override;
 
+#ifdef CONFIG_NVS_ENCRYPTED_PAGE_CACHE
+    /**
+     * Erases the range and drops the cached pages it overlaps.
+     *
+     * @param dst_offset the offset in the storage to erase from
+     * @param size the size of the range to erase in bytes
+     *
+     * @return
+     *      - ESP_OK on success
+     *      - other error codes from the esp_partition or BDL API
+     */
+    esp_err_t erase_range(size_t dst_offset, size_t size) override;
+
+    /**
+     * Zeroizes all cached decrypted pages and invalidates the cache.
+     * The page buffers stay allocated and are refilled on the next read.
+     */
+    void zeroizePageCache();
+#endif
+
 protected:
+    // Direct read path: reads and decrypts the range as one XTS data unit
+    esp_err_t readDecrypted(size_t src_offset, void* dst, size_t size);
+
     mbedtls_aes_xts_context mEctxt;     // AES context for encryption
     mbedtls_aes_xts_context mDctxt;     // AES context for decryption
+
+#ifdef CONFIG_NVS_ENCRYPTED_PAGE_CACHE
+    // One cached decrypted page. Buffers are allocated from internal RAM on
+    // first use so plaintext never lands in PSRAM.
+    struct CachedPage {
+        uint8_t* data = nullptr;
+        uint32_t pageAddr = 0;
+        uint32_t lastUsed = 0;
+        bool valid = false;
+    };
+
+    esp_err_t readViaPageCache(size_t src_offset, void* dst, size_t size);
+    void invalidateCachedRange(size_t addr, size_t size);
+
+    CachedPage mPageCache[CONFIG_NVS_ENCRYPTED_PAGE_CACHE_SIZE];
+    uint32_t mCacheUseCounter = 0;
+#endif
 };
 
 } // nvs
@@ -4,12 +4,17 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <cstdlib>
+// for strlcpy
+#include <string.h>
 #include "nvs_handle.hpp"
 #include "nvs_partition_manager.hpp"
 
 namespace nvs {
 
 NVSHandleSimple::~NVSHandleSimple() {
+#ifdef CONFIG_NVS_TRANSACTION
+    mStaged.clearAndFreeNodes();
+#endif
     NVSPartitionManager::get_instance()->close_handle(this);
 }
 
@@ -18,6 +23,12 @@ esp_err_t NVSHandleSimple::set_typed_item(ItemType datatype, const char *key, co
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_TRANSACTION
+    if (mTransactionActive) {
+        return stageItem(datatype, key, data, dataSize);
+    }
+#endif
+
     return mStoragePtr->writeItem(mNsIndex, datatype, key, data, dataSize);
 }
 
@@ -33,6 +44,12 @@ esp_err_t NVSHandleSimple::set_string(const char *key, const char* str)
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_TRANSACTION
+    if (mTransactionActive) {
+        return stageItem(nvs::ItemType::SZ, key, str, strlen(str) + 1);
+    }
+#endif
+
     return mStoragePtr->writeItem(mNsIndex, nvs::ItemType::SZ, key, str, strlen(str) + 1);
 }
 
@@ -41,6 +58,12 @@ esp_err_t NVSHandleSimple::set_blob(const char *key, const void* blob, size_t le
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_TRANSACTION
+    if (mTransactionActive) {
+        return stageItem(nvs::ItemType::BLOB, key, blob, len);
+    }
+#endif
+
     return mStoragePtr->writeItem(mNsIndex, nvs::ItemType::BLOB, key, blob, len);
 }
 
@@ -58,6 +81,13 @@ esp_err_t NVSHandleSimple::get_blob(const char *key, void* out_blob, size_t len)
     return mStoragePtr->readItem(mNsIndex, nvs::ItemType::BLOB, key, out_blob, len);
 }
 
+esp_err_t NVSHandleSimple::get_blob_range(const char *key, size_t offset, void* out_blob, size_t len)
+{
+    if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
+
+    return mStoragePtr->readBlobRange(mNsIndex, key, offset, out_blob, len);
+}
+
 esp_err_t NVSHandleSimple::get_item_size(ItemType datatype, const char *key, size_t &size)
 {
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
@@ -87,6 +117,11 @@ esp_err_t NVSHandleSimple::erase_item(const char* key)
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_TRANSACTION
+    // erases are not journaled, they would break the all-or-nothing guarantee
+    if (mTransactionActive) return ESP_ERR_NVS_INVALID_STATE;
+#endif
+
     return mStoragePtr->eraseItem(mNsIndex, key);
 }
 
@@ -95,6 +130,10 @@ esp_err_t NVSHandleSimple::erase_all()
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_TRANSACTION
+    if (mTransactionActive) return ESP_ERR_NVS_INVALID_STATE;
+#endif
+
     return mStoragePtr->eraseNamespace(mNsIndex);
 }
 
@@ -151,4 +190,233 @@ Storage *NVSHandleSimple::get_storage() const {
     return mStoragePtr;
 }
 
+#ifdef CONFIG_NVS_TRANSACTION
+
+// Reserved key holding the serialized transaction journal of a namespace.
+// Applications must not use this key themselves.
+static const char NVS_TXN_JOURNAL_KEY[] = "nvs.txn.jrnl";
+
+// Journal layout: TxnJournalHeader followed by count times
+// (TxnJournalItem, key bytes incl. NUL, data bytes), unaligned.
+struct TxnJournalHeader {
+    uint32_t magic;
+    uint32_t count;
+};
+
+struct TxnJournalItem {
+    uint8_t datatype;
+    uint8_t keyLen;
+    uint16_t reserved;
+    uint32_t dataSize;
+};
+
+static const uint32_t NVS_TXN_JOURNAL_MAGIC = 0x4e725458; // "XTrN"
+
+esp_err_t NVSHandleSimple::beginTransaction()
+{
+    if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
+    if (mTransactionActive) return ESP_ERR_NVS_INVALID_STATE;
+
+    mTransactionActive = true;
+    return ESP_OK;
+}
+
+esp_err_t NVSHandleSimple::abortTransaction()
+{
+    if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (!mTransactionActive) return ESP_ERR_NVS_INVALID_STATE;
+
+    mStaged.clearAndFreeNodes();
+    mTransactionActive = false;
+    return ESP_OK;
+}
+
+esp_err_t NVSHandleSimple::stageItem(ItemType datatype, const char *key, const void *data, size_t dataSize)
+{
+    if (key == nullptr || strlen(key) > Item::MAX_KEY_LENGTH) {
+        return ESP_ERR_NVS_KEY_TOO_LONG;
+    }
+    if (strcmp(key, NVS_TXN_JOURNAL_KEY) == 0) {
+        return ESP_ERR_NVS_INVALID_NAME;
+    }
+
+    // re-staging a key replaces its previous staged value
+    StagedItem* staged = nullptr;
+    for (auto it = mStaged.begin(); it != mStaged.end(); ++it) {
+        if (strcmp(it->key, key) == 0) {
+            staged = it;
+            break;
+        }
+    }
+
+    uint8_t* copy = new (std::nothrow) uint8_t [dataSize];
+    if (copy == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(copy, data, dataSize);
+
+    if (staged == nullptr) {
+        staged = new (std::nothrow) StagedItem();
+        if (staged == nullptr) {
+            delete [] copy;
+            return ESP_ERR_NO_MEM;
+        }
+        strlcpy(staged->key, key, sizeof(staged->key));
+        mStaged.push_back(staged);
+    } else {
+        delete [] staged->data;
+    }
+
+    staged->datatype = datatype;
+    staged->data = copy;
+    staged->dataSize = dataSize;
+    return ESP_OK;
+}
+
+esp_err_t NVSHandleSimple::applyJournal(const uint8_t *journal, size_t journalSize)
+{
+    TxnJournalHeader header;
+    if (journalSize < sizeof(header)) {
+        return ESP_ERR_NVS_INVALID_STATE;
+    }
+    memcpy(&header, journal, sizeof(header));
+    if (header.magic != NVS_TXN_JOURNAL_MAGIC) {
+        return ESP_ERR_NVS_INVALID_STATE;
+    }
+
+    size_t offset = sizeof(header);
+    for (uint32_t i = 0; i < header.count; i++) {
+        TxnJournalItem entry;
+        if (journalSize - offset < sizeof(entry)) {
+            return ESP_ERR_NVS_INVALID_STATE;
+        }
+        memcpy(&entry, journal + offset, sizeof(entry));
+        offset += sizeof(entry);
+
+        if (entry.keyLen > Item::MAX_KEY_LENGTH
+                || journalSize - offset < (size_t) entry.keyLen + 1 + entry.dataSize) {
+            return ESP_ERR_NVS_INVALID_STATE;
+        }
+        const char* key = reinterpret_cast<const char*>(journal + offset);
+        if (key[entry.keyLen] != '\0') {
+            return ESP_ERR_NVS_INVALID_STATE;
+        }
+        offset += (size_t) entry.keyLen + 1;
+
+        esp_err_t err = mStoragePtr->writeItem(mNsIndex, (ItemType) entry.datatype, key,
+                                               journal + offset, entry.dataSize);
+        if (err != ESP_OK) {
+            return err;
+        }
+        offset += entry.dataSize;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t NVSHandleSimple::commitTransaction()
+{
+    if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (!mTransactionActive) return ESP_ERR_NVS_INVALID_STATE;
+
+    if (mStaged.empty()) {
+        mTransactionActive = false;
+        return ESP_OK;
+    }
+
+    size_t journalSize = sizeof(TxnJournalHeader);
+    uint32_t count = 0;
+    for (auto it = mStaged.begin(); it != mStaged.end(); ++it) {
+        journalSize += sizeof(TxnJournalItem) + strlen(it->key) + 1 + it->dataSize;
+        count++;
+    }
+
+    uint8_t* journal = new (std::nothrow) uint8_t [journalSize];
+    if (journal == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    TxnJournalHeader header = {NVS_TXN_JOURNAL_MAGIC, count};
+    memcpy(journal, &header, sizeof(header));
+    size_t offset = sizeof(header);
+    for (auto it = mStaged.begin(); it != mStaged.end(); ++it) {
+        TxnJournalItem entry = {};
+        entry.datatype = (uint8_t) it->datatype;
+        entry.keyLen = (uint8_t) strlen(it->key);
+        entry.dataSize = (uint32_t) it->dataSize;
+        memcpy(journal + offset, &entry, sizeof(entry));
+        offset += sizeof(entry);
+        memcpy(journal + offset, it->key, (size_t) entry.keyLen + 1);
+        offset += (size_t) entry.keyLen + 1;
+        memcpy(journal + offset, it->data, it->dataSize);
+        offset += it->dataSize;
+    }
+
+    // One contiguous flash write; the blob index entry written last is the
+    // commit marker. Before it lands the old values stay in effect, after it
+    // the transaction survives any power cut (rolled forward on next open).
+    esp_err_t err = mStoragePtr->writeItem(mNsIndex, ItemType::BLOB, NVS_TXN_JOURNAL_KEY,
+                                           journal, journalSize);
+    if (err == ESP_OK) {
+        err = applyJournal(journal, journalSize);
+
+        // Drop the journal only once applying completed (or the journal is
+        // malformed beyond repair, where a replay cannot help either). A
+        // partial apply keeps it on flash so the next RW open rolls the
+        // transaction forward, the same policy recoverTransaction() uses;
+        // until that happens reads may observe a mix of old and new values.
+        if (err == ESP_OK || err == ESP_ERR_NVS_INVALID_STATE) {
+            esp_err_t erase_err = mStoragePtr->eraseItem(mNsIndex, NVS_TXN_JOURNAL_KEY);
+            if (err == ESP_OK) {
+                err = erase_err;
+            }
+        }
+    }
+
+    delete [] journal;
+    mStaged.clearAndFreeNodes();
+    mTransactionActive = false;
+    return err;
+}
+
+esp_err_t NVSHandleSimple::recoverTransaction()
+{
+    if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
+
+    size_t journalSize = 0;
+    esp_err_t err = mStoragePtr->getItemDataSize(mNsIndex, ItemType::BLOB, NVS_TXN_JOURNAL_KEY, journalSize);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        return ESP_OK;
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    uint8_t* journal = new (std::nothrow) uint8_t [journalSize];
+    if (journal == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    err = mStoragePtr->readItem(mNsIndex, ItemType::BLOB, NVS_TXN_JOURNAL_KEY, journal, journalSize);
+    if (err == ESP_OK) {
+        err = applyJournal(journal, journalSize);
+    }
+
+    if (err == ESP_OK || err == ESP_ERR_NVS_INVALID_STATE) {
+        // applied, or malformed beyond repair: retrying cannot help, drop it.
+        // Flash-level failures keep the journal for the next open.
+        esp_err_t erase_err = mStoragePtr->eraseItem(mNsIndex, NVS_TXN_JOURNAL_KEY);
+        if (err == ESP_OK) {
+            err = erase_err;
+        }
+    }
+
+    delete [] journal;
+    return err;
+}
+
+#endif // CONFIG_NVS_TRANSACTION
+
 }
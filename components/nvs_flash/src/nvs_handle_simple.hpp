@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include "sdkconfig.h"
 #include "intrusive_list.h"
 #include "nvs_storage.hpp"
 #include "nvs_platform.hpp"
@@ -48,6 +49,8 @@ public:
 
     esp_err_t get_blob(const char *key, void *out_blob, size_t len) override;
 
+    esp_err_t get_blob_range(const char *key, size_t offset, void *out_blob, size_t len);
+
     esp_err_t get_item_size(ItemType datatype, const char *key, size_t &size) override;
 
     esp_err_t find_key(const char *key, nvs_type_t &nvstype) override;
@@ -78,7 +81,68 @@ public:
 
     Storage *get_storage() const;
 
+    bool is_read_only() const
+    {
+        return mReadOnly != 0;
+    }
+
+#ifdef CONFIG_NVS_TRANSACTION
+    /**
+     * Starts a transaction on this handle. Until commitTransaction() or
+     * abortTransaction() is called, set_typed_item, set_string and set_blob
+     * stage their values in RAM instead of writing them; reads keep returning
+     * the committed state and erase operations are rejected with
+     * ESP_ERR_NVS_INVALID_STATE.
+     */
+    esp_err_t beginTransaction();
+
+    /**
+     * Commits all staged values. The staged items are first serialized into a
+     * single journal blob written contiguously in one pass; the blob index
+     * entry doubles as the commit marker, so a power cut either leaves the old
+     * values fully intact or the journal complete. The items are then applied
+     * and the journal is erased. If applying fails, the journal is removed and
+     * the error is returned; the staging area is released either way.
+     */
+    esp_err_t commitTransaction();
+
+    /**
+     * Discards all staged values without touching flash.
+     */
+    esp_err_t abortTransaction();
+
+    /**
+     * Rolls forward a journal left behind by a power cut between the journal
+     * write and the journal erase of a previous commitTransaction(). Called
+     * by the partition manager when a read-write handle is opened; applying
+     * is idempotent, so a crash during recovery just repeats it on next open.
+     * A journal that fails to apply is kept for the next attempt.
+     */
+    esp_err_t recoverTransaction();
+#endif
+
 private:
+#ifdef CONFIG_NVS_TRANSACTION
+    struct StagedItem : public intrusive_list_node<StagedItem>, public ExceptionlessAllocatable {
+        ItemType datatype;
+        char key[Item::MAX_KEY_LENGTH + 1];
+        uint8_t *data = nullptr;
+        size_t dataSize = 0;
+        ~StagedItem()
+        {
+            delete [] data;
+        }
+    };
+
+    esp_err_t stageItem(ItemType datatype, const char *key, const void *data, size_t dataSize);
+
+    esp_err_t applyJournal(const uint8_t *journal, size_t journalSize);
+
+    intrusive_list<StagedItem> mStaged;
+
+    bool mTransactionActive = false;
+#endif
+
     /**
      * The underlying storage's object.
      */
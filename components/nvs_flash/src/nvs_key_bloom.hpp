@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include "esp_rom_crc.h"
+#include "sdkconfig.h"
+
+namespace nvs
+{
+
+#if CONFIG_NVS_KEY_BLOOM_FILTER_SIZE > 0
+
+/**
+ * @brief Partition level bloom filter over (namespace index, key) pairs.
+ *
+ * The filter answers "was this key possibly ever written?" without touching the
+ * per-page hash lists, so lookups of absent keys can return immediately instead
+ * of scanning every page. False positives only cost the regular page scan,
+ * false negatives cannot happen as long as every write is inserted.
+ *
+ * Bits are never cleared on erase (a plain bloom filter cannot unset them), the
+ * stale bits merely degrade a miss back to the regular page scan. The filter is
+ * rebuilt from scratch on every Storage::init.
+ */
+class KeyBloomFilter
+{
+public:
+    static constexpr bool ENABLED = true;
+
+    void clear()
+    {
+        memset(mBits, 0, sizeof(mBits));
+    }
+
+    void insert(uint8_t nsIndex, const char* key)
+    {
+        uint32_t h1, h2;
+        hashKey(nsIndex, key, h1, h2);
+        for (uint32_t i = 0; i < HASH_COUNT; ++i) {
+            uint32_t bit = (h1 + i * h2) % BIT_COUNT;
+            mBits[bit / 8] |= (uint8_t)(1 << (bit % 8));
+        }
+    }
+
+    bool mayContain(uint8_t nsIndex, const char* key) const
+    {
+        uint32_t h1, h2;
+        hashKey(nsIndex, key, h1, h2);
+        for (uint32_t i = 0; i < HASH_COUNT; ++i) {
+            uint32_t bit = (h1 + i * h2) % BIT_COUNT;
+            if ((mBits[bit / 8] & (uint8_t)(1 << (bit % 8))) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr uint32_t BIT_COUNT = CONFIG_NVS_KEY_BLOOM_FILTER_SIZE * 8;
+    static constexpr uint32_t HASH_COUNT = 3;
+
+    // derive two independent sub-hashes from one crc32, the probe positions are
+    // composed from them (Kirsch-Mitzenmacher double hashing)
+    static void hashKey(uint8_t nsIndex, const char* key, uint32_t& h1, uint32_t& h2)
+    {
+        uint32_t crc = esp_rom_crc32_le(0xffffffff, &nsIndex, sizeof(nsIndex));
+        crc = esp_rom_crc32_le(crc, reinterpret_cast<const uint8_t*>(key), strlen(key));
+        h1 = crc & 0xffff;
+        h2 = (crc >> 16) | 1; // force odd, so the probe stride never degenerates to zero
+    }
+
+    uint8_t mBits[CONFIG_NVS_KEY_BLOOM_FILTER_SIZE] = {};
+};
+
+#else // CONFIG_NVS_KEY_BLOOM_FILTER_SIZE == 0
+
+/**
+ * @brief No-op stand-in keeping the call sites free of preprocessor conditions
+ *        when the bloom filter is disabled.
+ */
+class KeyBloomFilter
+{
+public:
+    static constexpr bool ENABLED = false;
+
+    void clear() {}
+    void insert(uint8_t, const char*) {}
+    bool mayContain(uint8_t, const char*) const
+    {
+        return true;
+    }
+};
+
+#endif // CONFIG_NVS_KEY_BLOOM_FILTER_SIZE
+
+} // namespace nvs
@@ -406,6 +406,96 @@ esp_err_t Page::findItem(uint8_t nsIndex, ItemType datatype, const char* key, ui
     return findItem(nsIndex, datatype, key, index, item, chunkIdx, chunkStart);
 }
 
+esp_err_t Page::loadEntryCache(Item* entryCache) const
+{
+    if (mState == PageState::CORRUPT || mState == PageState::INVALID || mState == PageState::UNINITIALIZED) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    return mPartition->read(mBaseAddress + ENTRY_DATA_OFFSET, entryCache, ENTRY_COUNT * ENTRY_SIZE);
+}
+
+esp_err_t Page::findItemCached(uint8_t nsIndex, ItemType datatype, size_t &itemIndex, Item &item, const Item* entryCache)
+{
+    if (mState == PageState::CORRUPT || mState == PageState::INVALID || mState == PageState::UNINITIALIZED) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+
+    size_t findBeginIndex = itemIndex;
+    if (findBeginIndex >= ENTRY_COUNT) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+
+    size_t start = mFirstUsedEntry;
+    if (findBeginIndex > mFirstUsedEntry && findBeginIndex < ENTRY_COUNT) {
+        start = findBeginIndex;
+    }
+
+    size_t end = mNextFreeEntry;
+    if (end > ENTRY_COUNT) {
+        end = ENTRY_COUNT;
+    }
+
+    size_t next;
+    EntryState state;
+    esp_err_t rc;
+    for (size_t i = start; i < end; i = next) {
+        next = i + 1;
+        rc = mEntryTable.get(i, &state);
+        if (rc != ESP_OK) {
+            return rc;
+        }
+        if (state != EntryState::WRITTEN) {
+            continue;
+        }
+
+        item = entryCache[i];
+
+        if (!item.checkHeaderConsistency(i)) {
+            // This is a read-only path: leave the inconsistent entry in place,
+            // the next regular findItem() pass will erase it
+            continue;
+        }
+
+        if (isVariableLengthType(item.datatype)) {
+            next = i + item.span;
+        }
+
+        if (nsIndex != NS_ANY && item.nsIndex != nsIndex) {
+            continue;
+        }
+
+        // Same BLOB family handling as in findItem() with chunkIdx == CHUNK_ANY
+        if (datatype == ItemType::BLOB_DATA && item.datatype != ItemType::BLOB_DATA) {
+            continue;
+        }
+
+        if (datatype == ItemType::BLOB && item.datatype == ItemType::BLOB_IDX) {
+            return ESP_ERR_NVS_TYPE_MISMATCH;
+        }
+
+        if (datatype == ItemType::BLOB && item.datatype == ItemType::BLOB_DATA) {
+            continue;
+        }
+
+        if (datatype == ItemType::BLOB_IDX && item.chunkIndex != CHUNK_ANY) {
+            continue;
+        }
+
+        if (datatype != ItemType::ANY && item.datatype != datatype) {
+            if (nsIndex == NS_ANY) {
+                continue; // continue for bruteforce search on blob indices.
+            }
+            itemIndex = i;
+            return ESP_ERR_NVS_TYPE_MISMATCH;
+        }
+
+        itemIndex = i;
+        return ESP_OK;
+    }
+
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
 esp_err_t Page::eraseEntryAndSpan(size_t index)
 {
     uint32_t seq_num;
@@ -92,6 +92,23 @@ public:
 
     esp_err_t findItem(uint8_t nsIndex, ItemType datatype, const char* key, size_t &itemIndex, Item& item, uint8_t chunkIdx = CHUNK_ANY, VerOffset chunkStart = VerOffset::VER_ANY);
 
+    /**
+     * @brief Read the whole entry area of the page into entryCache with one flash read
+     *
+     * Used by the batch iteration path so that a page is read from flash once instead
+     * of entry by entry. The caller provides a buffer of ENTRY_COUNT entries.
+     */
+    esp_err_t loadEntryCache(Item* entryCache) const;
+
+    /**
+     * @brief Variant of the scanning findItem() which serves entries from a RAM copy of the page
+     *
+     * Follows the iteration semantics of findItem() with key == nullptr, chunkIdx == CHUNK_ANY.
+     * The page is never modified: entries with inconsistent headers are skipped instead of
+     * being erased.
+     */
+    esp_err_t findItemCached(uint8_t nsIndex, ItemType datatype, size_t &itemIndex, Item& item, const Item* entryCache);
+
     esp_err_t eraseEntryAndSpan(size_t index);
 
     template<typename T>
@@ -212,6 +212,14 @@ esp_err_t NVSPartitionManager::open_handle(const char *part_name,
 
     nvs_handles.push_back(new_handle);
 
+#ifdef CONFIG_NVS_TRANSACTION
+    // roll forward a transaction journal a power cut may have left behind;
+    // best effort, a flash-level failure keeps the journal for the next open
+    if (open_mode == NVS_READWRITE) {
+        new_handle->recoverTransaction();
+    }
+#endif
+
     *handle = new_handle;
     return ESP_OK;
 }
@@ -224,6 +224,23 @@ esp_err_t Storage::init(uint32_t baseSector, uint32_t sectorCount)
         return ESP_FAIL;
     }
 
+    // build the partition level key presence filter, so that lookups of keys which were
+    // never written can return without walking every page's hash list
+    mKeyBloom.clear();
+    if(KeyBloomFilter::ENABLED) {
+        for(auto it = mPageManager.begin(); it != mPageManager.end(); ++it) {
+            Page& p = *it;
+            size_t itemIndex = 0;
+            Item item;
+            char itemKey[Item::MAX_KEY_LENGTH + 1];
+            while(p.findItem(Page::NS_ANY, ItemType::ANY, nullptr, itemIndex, item) == ESP_OK) {
+                item.getKey(itemKey, sizeof(itemKey));
+                mKeyBloom.insert(item.nsIndex, itemKey);
+                itemIndex += item.span;
+            }
+        }
+    }
+
     // Populate list of multi-page index entries.
     TBlobIndexList blobIdxList;
     err = populateBlobIndices(blobIdxList);
@@ -256,6 +273,11 @@ bool Storage::isValid() const
 
 esp_err_t Storage::findItem(uint8_t nsIndex, ItemType datatype, const char* key, Page* &page, Item& item, uint8_t chunkIdx, VerOffset chunkStart, size_t* itemIndex)
 {
+    // the bloom filter cannot produce false negatives, so a miss proves the key was
+    // never written and the page scan below can be skipped entirely
+    if(key != nullptr && !mKeyBloom.mayContain(nsIndex, key)) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
     for(auto it = std::begin(mPageManager); it != std::end(mPageManager); ++it) {
         size_t tmpItemIndex = 0;
         auto err = it->findItem(nsIndex, datatype, key, tmpItemIndex, item, chunkIdx, chunkStart);
@@ -272,6 +294,8 @@ esp_err_t Storage::findItem(uint8_t nsIndex, ItemType datatype, const char* key,
 
 esp_err_t Storage::writeMultiPageBlob(uint8_t nsIndex, const char* key, const void* data, size_t dataSize, VerOffset chunkStart)
 {
+    // blob chunks and the blob index share the key of the logical item, one insertion covers them all
+    mKeyBloom.insert(nsIndex, key);
     uint8_t chunkCount = 0;
     TUsedPageList usedPages;
     size_t remainingSize = dataSize;
@@ -383,6 +407,9 @@ esp_err_t Storage::writeItem(uint8_t nsIndex, ItemType datatype, const char* key
         return ESP_ERR_NVS_NOT_INITIALIZED;
     }
 
+    // record the key up front, a failed write merely leaves a benign extra bit set
+    mKeyBloom.insert(nsIndex, key);
+
     // pointer to the page where the existing item was found
     Page* findPage = nullptr;
     // index of the item in the page where the existing item was found
@@ -704,6 +731,123 @@ esp_err_t Storage::readMultiPageBlob(uint8_t nsIndex, const char* key, void* dat
     return err;
 }
 
+esp_err_t Storage::readBlobRange(uint8_t nsIndex, const char* key, size_t srcOffset, void* data, size_t readSize)
+{
+    if(mState != StorageState::ACTIVE) {
+        return ESP_ERR_NVS_NOT_INITIALIZED;
+    }
+
+    Item item;
+    Page* findPage = nullptr;
+    size_t itemIndex = 0;
+
+    auto err = findItem(nsIndex, ItemType::BLOB_IDX, key, findPage, item);
+    if(err == ESP_OK) {
+        size_t totalSize = item.blobIndex.dataSize;
+        if(srcOffset > totalSize || readSize > totalSize - srcOffset) {
+            return ESP_ERR_NVS_INVALID_LENGTH;
+        }
+        if(readSize == 0) {
+            return ESP_OK;
+        }
+
+        uint8_t chunkCount = item.blobIndex.chunkCount;
+        VerOffset chunkStart = item.blobIndex.chunkStart;
+        // offset of the current chunk within the whole blob
+        size_t chunkOffset = 0;
+        size_t copied = 0;
+        uint8_t* dst = reinterpret_cast<uint8_t*>(data);
+
+        for(uint8_t chunkNum = 0; chunkNum < chunkCount && copied < readSize; chunkNum++) {
+            err = findItem(nsIndex, ItemType::BLOB_DATA, key, findPage, item, static_cast<uint8_t> (chunkStart) + chunkNum, nvs::VerOffset::VER_ANY, &itemIndex);
+            if(err != ESP_OK) {
+                break;
+            }
+
+            size_t chunkSize = item.varLength.dataSize;
+
+            // chunks entirely before the requested range are skipped without reading their data
+            if(chunkOffset + chunkSize <= srcOffset) {
+                chunkOffset += chunkSize;
+                continue;
+            }
+
+            size_t sliceStart = (srcOffset > chunkOffset) ? srcOffset - chunkOffset : 0;
+            size_t sliceLen = chunkSize - sliceStart;
+            if(sliceLen > readSize - copied) {
+                sliceLen = readSize - copied;
+            }
+
+            if(sliceStart == 0 && sliceLen == chunkSize) {
+                // chunk lies completely inside the range, read it straight into the output
+                err = findPage->readVariableLengthItemData(item, itemIndex, dst + copied);
+                if(err != ESP_OK) {
+                    break;
+                }
+            } else {
+                // partially overlapping chunk: the data CRC covers the whole chunk,
+                // so it has to be read completely before the slice can be taken
+                uint8_t* chunkBuf = new (std::nothrow) uint8_t [chunkSize];
+                if(chunkBuf == nullptr) {
+                    return ESP_ERR_NO_MEM;
+                }
+                err = findPage->readVariableLengthItemData(item, itemIndex, chunkBuf);
+                if(err == ESP_OK) {
+                    memcpy(dst + copied, chunkBuf + sliceStart, sliceLen);
+                }
+                delete [] chunkBuf;
+                if(err != ESP_OK) {
+                    break;
+                }
+            }
+
+            copied += sliceLen;
+            chunkOffset += chunkSize;
+        }
+
+        // ran out of chunks before the range was filled: index and data disagree
+        if(err == ESP_OK && copied != readSize) {
+            err = ESP_ERR_NVS_NOT_FOUND;
+        }
+
+        if(err == ESP_ERR_NVS_NOT_FOUND) {
+            // same cleanup as the full multi-page read: a missing chunk or a CRC
+            // mismatch makes the whole blob unusable
+            eraseMultiPageBlob(nsIndex, key);
+        }
+        return err;
+    }
+
+    if(err != ESP_ERR_NVS_NOT_FOUND) {
+        return err;
+    }
+
+    // check if the blob is stored with earlier version format without index (single chunk)
+    err = findItem(nsIndex, ItemType::BLOB, key, findPage, item, Page::CHUNK_ANY, VerOffset::VER_ANY, &itemIndex);
+    if(err != ESP_OK) {
+        return err;
+    }
+
+    size_t totalSize = item.varLength.dataSize;
+    if(srcOffset > totalSize || readSize > totalSize - srcOffset) {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    if(readSize == 0) {
+        return ESP_OK;
+    }
+
+    uint8_t* chunkBuf = new (std::nothrow) uint8_t [totalSize];
+    if(chunkBuf == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    err = findPage->readVariableLengthItemData(item, itemIndex, chunkBuf);
+    if(err == ESP_OK) {
+        memcpy(data, chunkBuf + srcOffset, readSize);
+    }
+    delete [] chunkBuf;
+    return err;
+}
+
 esp_err_t Storage::cmpMultiPageBlob(uint8_t nsIndex, const char* key, const void* data, size_t dataSize)
 {
     Item item;
@@ -1119,6 +1263,68 @@ bool Storage::nextEntry(nvs_opaque_iterator_t* it)
     return false;
 }
 
+bool Storage::nextEntryBatch(nvs_opaque_iterator_t* it, nvs_entry_info_t* out_entries, size_t capacity, size_t& copied)
+{
+    copied = 0;
+    if(capacity == 0) {
+        return true;
+    }
+
+    // The entry the iterator currently points to has not been handed out yet;
+    // it becomes the first element of the batch.
+    out_entries[copied++] = it->entry_info;
+
+    Item* entryCache = new (std::nothrow) Item[Page::ENTRY_COUNT];
+    if(entryCache == nullptr) {
+        // Not enough memory for the page cache; fall back to entry-wise scanning.
+        while(copied < capacity) {
+            if(!nextEntry(it)) {
+                return false;
+            }
+            out_entries[copied++] = it->entry_info;
+        }
+        // Leave the iterator on the first entry which did not fit into the batch.
+        return nextEntry(it);
+    }
+
+    Item item;
+    esp_err_t err;
+    auto page = it->page;
+    bool cacheLoaded = false;
+
+    while(page != mPageManager.end()) {
+        if(!cacheLoaded) {
+            if(page->loadEntryCache(entryCache) != ESP_OK) {
+                ++page;
+                it->entryIndex = 0;
+                continue;
+            }
+            cacheLoaded = true;
+        }
+
+        err = page->findItemCached(it->nsIndex, (ItemType)it->type, it->entryIndex, item, entryCache);
+        it->entryIndex += item.span;
+        if(err == ESP_OK && isIterableItem(item) && !isMultipageBlob(item)) {
+            fillEntryInfo(item, it->entry_info);
+            it->page = page;
+            if(copied < capacity) {
+                out_entries[copied++] = it->entry_info;
+            } else {
+                // Batch is full; this entry stays pending on the iterator for the next call.
+                delete [] entryCache;
+                return true;
+            }
+        } else if(err == ESP_ERR_NVS_NOT_FOUND) {
+            ++page;
+            it->entryIndex = 0;
+            cacheLoaded = false;
+        }
+    }
+
+    delete [] entryCache;
+    return false;
+}
+
 
 }
 
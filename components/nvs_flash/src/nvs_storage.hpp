@@ -13,6 +13,7 @@
 #include "nvs_page.hpp"
 #include "nvs_pagemanager.hpp"
 #include "nvs_memory_management.hpp"
+#include "nvs_key_bloom.hpp"
 #include "partition.hpp"
 
 //extern void dumpBytes(const uint8_t* data, size_t count);
@@ -117,6 +118,8 @@ public:
 
     esp_err_t readMultiPageBlob(uint8_t nsIndex, const char* key, void* data, size_t dataSize);
 
+    esp_err_t readBlobRange(uint8_t nsIndex, const char* key, size_t srcOffset, void* data, size_t readSize);
+
     esp_err_t cmpMultiPageBlob(uint8_t nsIndex, const char* key, const void* data, size_t dataSize);
 
     esp_err_t eraseMultiPageBlob(uint8_t nsIndex, const char* key, VerOffset chunkStart = VerOffset::VER_ANY);
@@ -135,6 +138,8 @@ public:
 
     bool nextEntry(nvs_opaque_iterator_t* it);
 
+    bool nextEntryBatch(nvs_opaque_iterator_t* it, nvs_entry_info_t* out_entries, size_t capacity, size_t& copied);
+
 protected:
 
     Page& getCurrentPage()
@@ -160,6 +165,7 @@ protected:
     PageManager mPageManager;
     TNamespaces mNamespaces;
     CompressedEnumTable<bool, 1, 256> mNamespaceUsage;
+    KeyBloomFilter mKeyBloom;
     StorageState mState = StorageState::INVALID;
 };
 
@@ -21,6 +21,13 @@
 
 #include "esp_efuse.h"
 #include "esp_efuse_chip.h"
+
+#if CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+#include "esp_attr.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif  // CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
 #endif  // SOC_HMAC_SUPPORTED
 
 static __attribute__((unused)) const char *TAG = "nvs_sec_provider";
@@ -110,8 +117,59 @@ ESP_SYSTEM_INIT_FN(nvs_sec_provider_register_flash_enc_scheme, SECONDARY, BIT(0)
 #error "NVS Encryption (HMAC): Configured eFuse block (CONFIG_NVS_SEC_HMAC_EFUSE_KEY_ID) out of range!"
 #endif
 
+#if CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+
+/* Cache of the HMAC-derived XTS keys, kept in RTC noinit memory so that it
+ * survives soft resets and deep sleep. The checksum guards against garbage
+ * after a power-on reset and against layout changes across OTA updates. */
+typedef struct {
+    uint32_t hmac_key_id;
+    nvs_sec_cfg_t cfg;
+    uint32_t crc;
+} nvs_sec_key_cache_t;
+
+static RTC_NOINIT_ATTR nvs_sec_key_cache_t s_key_cache;
+static portMUX_TYPE s_key_cache_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t key_cache_crc(const nvs_sec_key_cache_t *cache)
+{
+    return esp_rom_crc32_le(UINT32_MAX, (const uint8_t *)cache, offsetof(nvs_sec_key_cache_t, crc));
+}
+
+static bool key_cache_lookup(hmac_key_id_t hmac_key_id, nvs_sec_cfg_t *cfg)
+{
+    bool hit = false;
+
+    portENTER_CRITICAL(&s_key_cache_lock);
+    if (s_key_cache.hmac_key_id == (uint32_t)hmac_key_id && key_cache_crc(&s_key_cache) == s_key_cache.crc) {
+        memcpy(cfg, &s_key_cache.cfg, sizeof(nvs_sec_cfg_t));
+        hit = true;
+    }
+    portEXIT_CRITICAL(&s_key_cache_lock);
+
+    return hit;
+}
+
+static void key_cache_store(hmac_key_id_t hmac_key_id, const nvs_sec_cfg_t *cfg)
+{
+    portENTER_CRITICAL(&s_key_cache_lock);
+    s_key_cache.hmac_key_id = (uint32_t)hmac_key_id;
+    memcpy(&s_key_cache.cfg, cfg, sizeof(nvs_sec_cfg_t));
+    s_key_cache.crc = key_cache_crc(&s_key_cache);
+    portEXIT_CRITICAL(&s_key_cache_lock);
+}
+
+#endif  // CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+
 static esp_err_t compute_nvs_keys_with_hmac(hmac_key_id_t hmac_key_id, nvs_sec_cfg_t* cfg)
 {
+#if CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+    if (key_cache_lookup(hmac_key_id, cfg)) {
+        ESP_LOGD(TAG, "Using cached NVS encryption keys");
+        return ESP_OK;
+    }
+#endif
+
     uint32_t ekey_seed[8] = {[0 ... 7] = EKEY_SEED};
     uint32_t tkey_seed[8] = {[0 ... 7] = TKEY_SEED};
 
@@ -132,6 +190,10 @@ static esp_err_t compute_nvs_keys_with_hmac(hmac_key_id_t hmac_key_id, nvs_sec_c
     /* NOTE: If the XTS E-key and T-key are the same, we have a hash collision */
     ESP_FAULT_ASSERT(memcmp(cfg->eky, cfg->tky, NVS_KEY_SIZE) != 0);
 
+#if CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+    key_cache_store(hmac_key_id, cfg);
+#endif
+
     return ESP_OK;
 }
 
@@ -264,6 +326,27 @@ esp_err_t nvs_sec_provider_register_hmac(const nvs_sec_config_hmac_t *sec_scheme
 }
 
 #if CONFIG_NVS_SEC_KEY_PROTECT_USING_HMAC
+
+#if CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+static void nvs_sec_key_derive_task(void *arg)
+{
+    hmac_key_id_t hmac_key_id = (hmac_key_id_t)(uintptr_t)arg;
+    nvs_sec_cfg_t cfg;
+
+    /* Only warm the cache from an already provisioned HMAC key; key
+     * generation (and the eFuse write it implies) stays with the regular
+     * scheme invocation path */
+    if (is_hmac_key_burnt_in_efuse(hmac_key_id)) {
+        if (compute_nvs_keys_with_hmac(hmac_key_id, &cfg) == ESP_OK) {
+            ESP_LOGD(TAG, "NVS encryption keys derived ahead of first use");
+        }
+        memset(&cfg, 0x00, sizeof(nvs_sec_cfg_t));
+    }
+
+    vTaskDelete(NULL);
+}
+#endif  // CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+
 ESP_SYSTEM_INIT_FN(nvs_sec_provider_register_hmac_scheme, SECONDARY, BIT(0), 151)
 {
     ESP_EARLY_LOGI(TAG, "NVS Encryption - Registering HMAC-based scheme...");
@@ -272,7 +355,23 @@ ESP_SYSTEM_INIT_FN(nvs_sec_provider_register_hmac_scheme, SECONDARY, BIT(0), 151
 
     nvs_sec_scheme_t *sec_scheme_handle_out = NULL;
 
-    return nvs_sec_provider_register_hmac(&sec_scheme_cfg, &sec_scheme_handle_out);
+    esp_err_t err = nvs_sec_provider_register_hmac(&sec_scheme_cfg, &sec_scheme_handle_out);
+
+#if CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+    if (err == ESP_OK) {
+        /* Kick off key derivation in the background, so that it overlaps the
+         * remaining boot work instead of delaying the first encrypted NVS
+         * initialization. Best effort - if the task cannot be created, the
+         * keys are simply derived on first use as before. */
+        if (xTaskCreate(nvs_sec_key_derive_task, "nvs_key_derive", 3072,
+                        (void *)(uintptr_t)sec_scheme_cfg.hmac_key_id,
+                        tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+            ESP_EARLY_LOGW(TAG, "Failed to create the key derivation task");
+        }
+    }
+#endif  // CONFIG_NVS_SEC_KEY_CACHE_HMAC_DERIVED
+
+    return err;
 }
 #endif  // CONFIG_NVS_SEC_KEY_PROTECT_USING_HMAC
 
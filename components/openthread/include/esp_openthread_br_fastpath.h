@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Border router data-plane fast path statistics.
+ *
+ */
+typedef struct {
+    uint32_t fast_forwarded;    /*!< Packets forwarded directly to the backbone interface */
+    uint32_t slow_path;         /*!< Packets handed to the IP stack (local delivery, no route, first packet of a flow, ...) */
+    uint32_t dropped;           /*!< Packets dropped due to resource exhaustion */
+    uint32_t active_flows;      /*!< Number of flow table entries currently in use */
+} esp_openthread_br_fastpath_stats_t;
+
+/**
+ * @brief   Gets the border router fast path statistics.
+ *
+ * @param[out] stats    The statistics to fill.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if stats is NULL
+ *
+ */
+esp_err_t esp_openthread_br_fastpath_get_stats(esp_openthread_br_fastpath_stats_t *stats);
+
+/**
+ * @brief   Flushes all learned flows from the fast path flow table.
+ *
+ * @note    Subsequent packets will take the slow path until their flows are learned again.
+ *
+ */
+void esp_openthread_br_fastpath_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <stdbool.h>
+
 #include "esp_openthread.h"
 #include "openthread/ip6.h"
 #include "openthread/instance.h"
+#include "openthread/message.h"
+#include "sdkconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -36,6 +40,23 @@ void esp_openthread_netif_glue_update(esp_openthread_mainloop_context_t *mainloo
  */
 esp_err_t esp_openthread_netif_glue_process(otInstance *instance, const esp_openthread_mainloop_context_t *mainloop);
 
+#if CONFIG_OPENTHREAD_BR_DATA_FASTPATH
+/**
+ * @brief This function tries to forward a received Thread packet directly to the backbone interface.
+ *
+ * @note Must be called from the OpenThread task. If the packet is claimed, it is forwarded (or dropped)
+ *       by the fast path and must not be passed to the network stack anymore.
+ *
+ * @param[in]    message    The received IPv6 message.
+ *
+ * @return
+ *      - True if the packet was claimed by the fast path
+ *      - False if the packet should take the normal path through the network stack
+ *
+ */
+bool esp_openthread_br_fastpath_input(otMessage *message);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
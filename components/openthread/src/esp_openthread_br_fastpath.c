@@ -0,0 +1,230 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_openthread_br_fastpath.h"
+
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_netif.h"
+#include "esp_netif_net_stack.h"
+#include "esp_openthread.h"
+#include "esp_openthread_border_router.h"
+#include "esp_openthread_common_macro.h"
+#include "esp_openthread_netif_glue.h"
+#include "esp_openthread_netif_glue_priv.h"
+#include "lwip/ip6.h"
+#include "lwip/ip6_addr.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "lwip/prot/ip6.h"
+#include "lwip/sys.h"
+#include "lwip/tcpip.h"
+#include "openthread/ip6.h"
+#include "openthread/message.h"
+
+#define FASTPATH_FLOW_NUM CONFIG_OPENTHREAD_BR_DATA_FASTPATH_FLOW_NUM
+// Idle flows are recycled after this period so stale routes do not linger.
+#define FASTPATH_FLOW_IDLE_MS 30000
+
+#define IP6_PROTO_TCP 6
+#define IP6_PROTO_UDP 17
+
+typedef struct {
+    otIp6Address src;
+    otIp6Address dst;
+    uint16_t src_port;
+    uint16_t dst_port;
+    uint8_t proto;
+    bool in_use;
+    struct netif *out_netif;
+    uint32_t last_used_ms;
+} fastpath_flow_t;
+
+// The flow table and statistics are only touched from the lwIP tcpip thread,
+// so no extra locking is needed.
+static fastpath_flow_t s_flow_table[FASTPATH_FLOW_NUM];
+static esp_openthread_br_fastpath_stats_t s_stats;
+
+static fastpath_flow_t *fastpath_flow_lookup(const struct ip6_hdr *hdr, uint16_t src_port, uint16_t dst_port)
+{
+    for (int i = 0; i < FASTPATH_FLOW_NUM; i++) {
+        fastpath_flow_t *flow = &s_flow_table[i];
+        if (flow->in_use && flow->proto == IP6H_NEXTH(hdr) && flow->src_port == src_port &&
+            flow->dst_port == dst_port && memcmp(flow->src.mFields.m8, &hdr->src, sizeof(flow->src)) == 0 &&
+            memcmp(flow->dst.mFields.m8, &hdr->dest, sizeof(flow->dst)) == 0) {
+            return flow;
+        }
+    }
+    return NULL;
+}
+
+static void fastpath_flow_learn(const struct ip6_hdr *hdr, uint16_t src_port, uint16_t dst_port,
+                                struct netif *out_netif)
+{
+    uint32_t now = sys_now();
+    fastpath_flow_t *victim = &s_flow_table[0];
+
+    for (int i = 0; i < FASTPATH_FLOW_NUM; i++) {
+        fastpath_flow_t *flow = &s_flow_table[i];
+        if (!flow->in_use) {
+            victim = flow;
+            break;
+        }
+        if ((uint32_t)(now - flow->last_used_ms) > (uint32_t)(now - victim->last_used_ms)) {
+            victim = flow;
+        }
+    }
+    if (victim->in_use) {
+        s_stats.active_flows--;
+    }
+    memcpy(victim->src.mFields.m8, &hdr->src, sizeof(victim->src));
+    memcpy(victim->dst.mFields.m8, &hdr->dest, sizeof(victim->dst));
+    victim->src_port = src_port;
+    victim->dst_port = dst_port;
+    victim->proto = IP6H_NEXTH(hdr);
+    victim->out_netif = out_netif;
+    victim->last_used_ms = now;
+    victim->in_use = true;
+    s_stats.active_flows++;
+}
+
+static void fastpath_slow_path(struct pbuf *buf)
+{
+    struct netif *openthread_lwip_netif = esp_netif_get_netif_impl(esp_openthread_get_netif());
+
+    s_stats.slow_path++;
+    if (openthread_lwip_netif == NULL) {
+        pbuf_free(buf);
+        return;
+    }
+    // ip6_input() takes ownership of the pbuf in all cases.
+    if (ip6_input(buf, openthread_lwip_netif) != ERR_OK) {
+        ESP_LOGD(OT_PLAT_LOG_TAG, "fast path failed to queue packet to IP stack");
+    }
+}
+
+// Runs in the lwIP tcpip thread on a linear pbuf holding a full IPv6 packet.
+static void fastpath_forward(void *ctx)
+{
+    struct pbuf *buf = (struct pbuf *)ctx;
+    struct ip6_hdr *hdr = (struct ip6_hdr *)buf->payload;
+    const uint16_t *ports = (const uint16_t *)((const uint8_t *)buf->payload + IP6_HLEN);
+    uint16_t src_port = lwip_ntohs(ports[0]);
+    uint16_t dst_port = lwip_ntohs(ports[1]);
+    struct netif *out_netif = NULL;
+    ip6_addr_t dest;
+
+    fastpath_flow_t *flow = fastpath_flow_lookup(hdr, src_port, dst_port);
+    if (flow != NULL && netif_is_up(flow->out_netif) && netif_is_link_up(flow->out_netif)) {
+        out_netif = flow->out_netif;
+        flow->last_used_ms = sys_now();
+    } else {
+        // First packet of a flow (or the cached interface went down): consult the
+        // routing table once and cache the result for the packets that follow.
+        ip6_addr_t src;
+        ip6_addr_copy_from_packed(src, hdr->src);
+        ip6_addr_copy_from_packed(dest, hdr->dest);
+        ip6_addr_clear_zone(&src);
+        ip6_addr_clear_zone(&dest);
+        out_netif = ip6_route(&src, &dest);
+        if (out_netif == NULL || out_netif == esp_netif_get_netif_impl(esp_openthread_get_netif()) ||
+            !netif_is_up(out_netif) || !netif_is_link_up(out_netif)) {
+            // Not a pure forwarding case (local delivery, no route, or a route back
+            // into the Thread network) -- let the IP stack handle it.
+            fastpath_slow_path(buf);
+            return;
+        }
+        fastpath_flow_learn(hdr, src_port, dst_port, out_netif);
+    }
+
+    ip6_addr_copy_from_packed(dest, hdr->dest);
+    ip6_addr_clear_zone(&dest);
+    IP6H_HOPLIM_SET(hdr, IP6H_HOPLIM(hdr) - 1);
+    if (out_netif->output_ip6(out_netif, buf, &dest) != ERR_OK) {
+        s_stats.dropped++;
+    } else {
+        s_stats.fast_forwarded++;
+    }
+    pbuf_free(buf);
+}
+
+static bool fastpath_addr_is_ours(const otIp6Address *address)
+{
+    for (const otNetifAddress *addr = otIp6GetUnicastAddresses(esp_openthread_get_instance()); addr != NULL;
+         addr = addr->mNext) {
+        if (otIp6IsAddressEqual(&addr->mAddress, address)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool esp_openthread_br_fastpath_input(otMessage *message)
+{
+    uint8_t header[IP6_HLEN];
+    uint16_t length = otMessageGetLength(message);
+
+    if (esp_openthread_get_backbone_netif() == NULL || length < IP6_HLEN + 2 * sizeof(uint16_t)) {
+        return false;
+    }
+    if (otMessageRead(message, 0, header, sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+
+    const struct ip6_hdr *hdr = (const struct ip6_hdr *)header;
+    const otIp6Address *dst = (const otIp6Address *)&hdr->dest;
+    // Only plain TCP and UDP unicast flows with a routable hop limit take the
+    // fast path; extension headers, multicast, link-local destinations and
+    // packets addressed to this node all go through the IP stack.
+    if (IP6H_V(hdr) != 6 || (IP6H_NEXTH(hdr) != IP6_PROTO_TCP && IP6H_NEXTH(hdr) != IP6_PROTO_UDP)) {
+        return false;
+    }
+    if (IP6H_HOPLIM(hdr) <= 1 || dst->mFields.m8[0] == 0xff ||
+        (dst->mFields.m32[0] == lwip_htonl(0xfe800000) && dst->mFields.m32[1] == 0)) {
+        return false;
+    }
+    if (fastpath_addr_is_ours(dst)) {
+        return false;
+    }
+
+    struct pbuf *buf = pbuf_alloc(PBUF_RAW, length, PBUF_RAM);
+    if (buf == NULL) {
+        s_stats.dropped++;
+        // Claim the packet anyway: the slow path would have to make the same
+        // allocation and would fail the same way.
+        return true;
+    }
+    if (otMessageRead(message, 0, buf->payload, length) != length) {
+        pbuf_free(buf);
+        return false;
+    }
+    if (tcpip_callback(fastpath_forward, buf) != ERR_OK) {
+        pbuf_free(buf);
+        return false;
+    }
+    return true;
+}
+
+esp_err_t esp_openthread_br_fastpath_get_stats(esp_openthread_br_fastpath_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(stats, &s_stats, sizeof(*stats));
+    return ESP_OK;
+}
+
+static void fastpath_flush_in_tcpip(void *ctx)
+{
+    memset(s_flow_table, 0, sizeof(s_flow_table));
+    s_stats.active_flows = 0;
+}
+
+void esp_openthread_br_fastpath_flush(void)
+{
+    tcpip_callback(fastpath_flush_in_tcpip, NULL);
+}
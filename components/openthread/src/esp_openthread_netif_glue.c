@@ -136,6 +136,13 @@ static void process_thread_receive(otMessage *message, void *context)
     esp_err_t error;
     uint16_t length = otMessageGetLength(message);
 
+#if CONFIG_OPENTHREAD_BR_DATA_FASTPATH
+    if (esp_openthread_br_fastpath_input(message)) {
+        otMessageFree(message);
+        return;
+    }
+#endif
+
     error = esp_netif_receive(s_openthread_netif_glue.base.netif, message, length, NULL);
 
     if (error != ESP_OK) {
@@ -708,6 +708,9 @@ void IRAM_ATTR esp_ieee802154_receive_done(uint8_t *data, esp_ieee802154_frame_i
 
     if (atomic_load(&s_recv_queue.used) == CONFIG_IEEE802154_RX_BUFFER_SIZE) {
         ESP_EARLY_LOGE(OT_PLAT_LOG_TAG, "radio receive buffer full!");
+        // Release the frame back to the driver pool, otherwise the buffer slot stays
+        // reserved and the pool shrinks permanently.
+        esp_ieee802154_receive_handle_done(data);
         return;
     }
 
@@ -0,0 +1,35 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _PERF_MON_FREERTOS_H_
+#define _PERF_MON_FREERTOS_H_
+
+/*
+ * Trace macro definitions for per-task performance counter statistics.
+ *
+ * This header is included from FreeRTOSConfig.h when PERFMON_TASK_STATS is
+ * enabled, so it must not pull in any FreeRTOS headers itself. Task handles
+ * are passed around as plain pointers for the same reason.
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void xtensa_perfmon_task_stats_switched_in(void);
+void xtensa_perfmon_task_stats_switched_out(void);
+void xtensa_perfmon_task_stats_task_deleted(void *task);
+
+#define traceTASK_SWITCHED_IN()     xtensa_perfmon_task_stats_switched_in()
+#define traceTASK_SWITCHED_OUT()    xtensa_perfmon_task_stats_switched_out()
+#define traceTASK_DELETE( pxTCB )   xtensa_perfmon_task_stats_task_deleted(pxTCB)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _PERF_MON_FREERTOS_H_
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _PERF_MON_TASK_STATS_H_
+#define _PERF_MON_TASK_STATS_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Per-task performance counter totals
+ *
+ * Counter deltas are sampled around every time slice and accumulated here,
+ * so the values cover only the time during which collection was running.
+ */
+typedef struct xtensa_perfmon_task_counters {
+    uint64_t load_misses;  /*!< Data-load cache misses (XTPERF_CNT_D_LOAD_U1, cache miss mask) */
+    uint64_t stall_cycles; /*!< Data-related GlobalStall cycles (XTPERF_CNT_D_STALL, all causes) */
+    uint32_t switch_count; /*!< Number of time slices accumulated into the totals */
+} xtensa_perfmon_task_counters_t;
+
+/**@{*/
+/**
+ * @brief      Start per-task counter collection
+ *
+ * Programs performance counters 0 and 1 for data-load cache misses and
+ * data-related stall cycles and begins attributing their deltas to the
+ * running task on every context switch. Counters are programmed lazily on
+ * each core from its first context switch, so no cross-core call is needed.
+ *
+ * Collection reserves counters 0 and 1; do not reprogram them through the
+ * xtensa_perfmon_init() API while it is running.
+ */
+void xtensa_perfmon_task_stats_start(void);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      Stop per-task counter collection
+ *
+ * Accumulated totals are kept and can still be read until
+ * xtensa_perfmon_task_stats_reset() is called.
+ */
+void xtensa_perfmon_task_stats_stop(void);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      Reset all accumulated per-task totals
+ */
+void xtensa_perfmon_task_stats_reset(void);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      Read accumulated counters for one task
+ *
+ * @param[in]  task: task to query
+ * @param[out] out_counters: filled with the task's accumulated totals
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if task or out_counters is NULL
+ *      - ESP_ERR_NOT_FOUND if the task has not been seen by the collector
+ */
+esp_err_t xtensa_perfmon_task_stats_get(TaskHandle_t task, xtensa_perfmon_task_counters_t *out_counters);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      Dump per-task counters as a table
+ *
+ * Prints one line per tracked task with its name, time slice count and
+ * accumulated cache miss / stall cycle totals.
+ *
+ * @param[in] stream: output stream, or NULL for stdout
+ */
+void xtensa_perfmon_task_stats_dump(FILE *stream);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _PERF_MON_TASK_STATS_H_
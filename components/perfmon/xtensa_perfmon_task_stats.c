@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "xtensa/xt_perf_consts.h"
+#include "xtensa_perfmon_access.h"
+#include "xtensa_perfmon_task_stats.h"
+
+// Counters reserved for task statistics while collection is running
+#define TASK_STATS_COUNTER_MISS    0
+#define TASK_STATS_COUNTER_STALL   1
+
+typedef struct {
+    void *task; // task handle, NULL if the slot is free
+    xtensa_perfmon_task_counters_t counters;
+} task_stats_slot_t;
+
+typedef struct {
+    uint32_t miss_base;  // counter values captured when the current task was switched in
+    uint32_t stall_base;
+    bool counting;       // baselines are valid for the task running on this core
+    bool hw_ready;       // counters are programmed and running on this core
+} task_stats_core_t;
+
+static task_stats_slot_t s_slots[CONFIG_PERFMON_TASK_STATS_MAX_TASKS];
+static task_stats_core_t s_core[configNUMBER_OF_CORES];
+static uint32_t s_dropped;
+static volatile bool s_enabled;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static task_stats_slot_t *task_stats_slot_find(void *task, bool allocate)
+{
+    task_stats_slot_t *free_slot = NULL;
+    for (int i = 0; i < CONFIG_PERFMON_TASK_STATS_MAX_TASKS; i++) {
+        if (s_slots[i].task == task) {
+            return &s_slots[i];
+        }
+        if (free_slot == NULL && s_slots[i].task == NULL) {
+            free_slot = &s_slots[i];
+        }
+    }
+    if (allocate && free_slot != NULL) {
+        free_slot->task = task;
+        memset(&free_slot->counters, 0, sizeof(free_slot->counters));
+        return free_slot;
+    }
+    return NULL;
+}
+
+void xtensa_perfmon_task_stats_switched_in(void)
+{
+    task_stats_core_t *core = &s_core[xPortGetCoreID()];
+    if (!s_enabled) {
+        if (core->hw_ready) {
+            xtensa_perfmon_stop();
+            core->hw_ready = false;
+        }
+        core->counting = false;
+        return;
+    }
+    if (!core->hw_ready) {
+        // Counter programming only takes effect on the local core, so it is
+        // done lazily from the first switch on each core instead of via IPC.
+        // tracelevel -1 counts at all interrupt levels, kernelcnt includes
+        // kernel mode, so ISR cost lands on the task it preempted.
+        xtensa_perfmon_init(TASK_STATS_COUNTER_MISS, XTPERF_CNT_D_LOAD_U1,
+                            XTPERF_MASK_D_LOAD_CACHE_MISSES, 1, -1);
+        xtensa_perfmon_init(TASK_STATS_COUNTER_STALL, XTPERF_CNT_D_STALL,
+                            XTPERF_MASK_D_STALL_ALL, 1, -1);
+        xtensa_perfmon_start();
+        core->hw_ready = true;
+    }
+    core->miss_base = xtensa_perfmon_value(TASK_STATS_COUNTER_MISS);
+    core->stall_base = xtensa_perfmon_value(TASK_STATS_COUNTER_STALL);
+    core->counting = true;
+}
+
+void xtensa_perfmon_task_stats_switched_out(void)
+{
+    task_stats_core_t *core = &s_core[xPortGetCoreID()];
+    if (!core->counting) {
+        return;
+    }
+    core->counting = false;
+    uint32_t miss_delta = xtensa_perfmon_value(TASK_STATS_COUNTER_MISS) - core->miss_base;
+    uint32_t stall_delta = xtensa_perfmon_value(TASK_STATS_COUNTER_STALL) - core->stall_base;
+    void *task = xTaskGetCurrentTaskHandle();
+
+    portENTER_CRITICAL_SAFE(&s_lock);
+    task_stats_slot_t *slot = task_stats_slot_find(task, true);
+    if (slot != NULL) {
+        slot->counters.load_misses += miss_delta;
+        slot->counters.stall_cycles += stall_delta;
+        slot->counters.switch_count++;
+    } else {
+        s_dropped++;
+    }
+    portEXIT_CRITICAL_SAFE(&s_lock);
+}
+
+void xtensa_perfmon_task_stats_task_deleted(void *task)
+{
+    portENTER_CRITICAL_SAFE(&s_lock);
+    task_stats_slot_t *slot = task_stats_slot_find(task, false);
+    if (slot != NULL) {
+        slot->task = NULL;
+        memset(&slot->counters, 0, sizeof(slot->counters));
+    }
+    portEXIT_CRITICAL_SAFE(&s_lock);
+}
+
+void xtensa_perfmon_task_stats_start(void)
+{
+    // Counters are programmed from the switch hooks; just arm them.
+    s_enabled = true;
+}
+
+void xtensa_perfmon_task_stats_stop(void)
+{
+    // Each core stops its counters from the next switch hook it executes.
+    s_enabled = false;
+}
+
+void xtensa_perfmon_task_stats_reset(void)
+{
+    portENTER_CRITICAL(&s_lock);
+    memset(s_slots, 0, sizeof(s_slots));
+    s_dropped = 0;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+esp_err_t xtensa_perfmon_task_stats_get(TaskHandle_t task, xtensa_perfmon_task_counters_t *out_counters)
+{
+    if (task == NULL || out_counters == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL(&s_lock);
+    task_stats_slot_t *slot = task_stats_slot_find(task, false);
+    if (slot != NULL) {
+        *out_counters = slot->counters;
+        err = ESP_OK;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return err;
+}
+
+void xtensa_perfmon_task_stats_dump(FILE *stream)
+{
+    if (stream == NULL) {
+        stream = stdout;
+    }
+    fprintf(stream, "%-*s %10s %14s %14s\n", configMAX_TASK_NAME_LEN, "Task",
+            "Slices", "Load misses", "Stall cycles");
+    for (int i = 0; i < CONFIG_PERFMON_TASK_STATS_MAX_TASKS; i++) {
+        char name[configMAX_TASK_NAME_LEN];
+        xtensa_perfmon_task_counters_t counters;
+
+        // Copy under the lock: the deletion hook runs before the TCB is
+        // freed, so a task handle found here is still safe to read.
+        portENTER_CRITICAL(&s_lock);
+        void *task = s_slots[i].task;
+        if (task != NULL) {
+            strlcpy(name, pcTaskGetName((TaskHandle_t)task), sizeof(name));
+            counters = s_slots[i].counters;
+        }
+        portEXIT_CRITICAL(&s_lock);
+
+        if (task != NULL) {
+            fprintf(stream, "%-*s %10" PRIu32 " %14" PRIu64 " %14" PRIu64 "\n",
+                    configMAX_TASK_NAME_LEN, name, counters.switch_count,
+                    counters.load_misses, counters.stall_cycles);
+        }
+    }
+    if (s_dropped != 0) {
+        fprintf(stream, "dropped %" PRIu32 " slices (task table full)\n", s_dropped);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <esp_heap_caps.h>
+
+#include "esp_protobuf_arena.h"
+
+#define ESP_PROTOBUF_ARENA_DEF_BLOCK_SIZE  512
+#define ESP_PROTOBUF_ARENA_ALIGNMENT       sizeof(max_align_t)
+
+struct esp_protobuf_arena_block {
+    struct esp_protobuf_arena_block *next;
+    size_t size;    /* usable bytes in data[] */
+    size_t used;    /* bytes already handed out */
+    max_align_t data[];
+};
+
+static void *arena_alloc(void *allocator_data, size_t size)
+{
+    esp_protobuf_arena_t *arena = (esp_protobuf_arena_t *) allocator_data;
+
+    /* Keep every returned pointer suitably aligned */
+    size = (size + ESP_PROTOBUF_ARENA_ALIGNMENT - 1) & ~(ESP_PROTOBUF_ARENA_ALIGNMENT - 1);
+
+    struct esp_protobuf_arena_block *block = arena->head;
+    if (!block || block->size - block->used < size) {
+        size_t block_size = size > arena->block_size ? size : arena->block_size;
+        block = heap_caps_malloc(sizeof(struct esp_protobuf_arena_block) + block_size,
+                                 arena->caps);
+        if (!block) {
+            return NULL;
+        }
+        block->size = block_size;
+        block->used = 0;
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    void *ptr = (uint8_t *) block->data + block->used;
+    block->used += size;
+    return ptr;
+}
+
+static void arena_free(void *allocator_data, void *pointer)
+{
+    /* Individual frees are no-ops; memory is reclaimed all at once
+     * by esp_protobuf_arena_free() */
+    (void) allocator_data;
+    (void) pointer;
+}
+
+esp_err_t esp_protobuf_arena_init(esp_protobuf_arena_t *arena, size_t block_size, uint32_t malloc_caps)
+{
+    if (!arena) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    arena->allocator.alloc = arena_alloc;
+    arena->allocator.free = arena_free;
+    arena->allocator.allocator_data = arena;
+    arena->head = NULL;
+    arena->block_size = block_size ? block_size : ESP_PROTOBUF_ARENA_DEF_BLOCK_SIZE;
+    arena->caps = malloc_caps ? malloc_caps : MALLOC_CAP_DEFAULT;
+    return ESP_OK;
+}
+
+void esp_protobuf_arena_free(esp_protobuf_arena_t *arena)
+{
+    if (!arena) {
+        return;
+    }
+    struct esp_protobuf_arena_block *block = arena->head;
+    while (block) {
+        struct esp_protobuf_arena_block *next = block->next;
+        heap_caps_free(block);
+        block = next;
+    }
+    arena->head = NULL;
+}
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <esp_err.h>
+#include <protobuf-c/protobuf-c.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Arena backed ProtobufCAllocator
+ *
+ * Unpacking a protobuf-c message allocates every submessage and repeated
+ * field separately, and `*__free_unpacked()` walks the entire message tree
+ * to release them. For transient messages (unpacked, processed and freed
+ * within a single handler invocation) this churns the heap needlessly.
+ * An arena serves all those allocations from a small number of larger
+ * blocks with a bump pointer, and releases the whole message tree by
+ * freeing just the blocks.
+ *
+ * Typical usage:
+ *
+ *     esp_protobuf_arena_t arena;
+ *     esp_protobuf_arena_init(&arena, 0, 0);
+ *     MyMessage *msg = my_message__unpack(&arena.allocator, len, buf);
+ *     // ... process msg ...
+ *     esp_protobuf_arena_free(&arena); // releases msg and all submessages
+ */
+typedef struct {
+    ProtobufCAllocator allocator;       /*!< Pass `&arena.allocator` to `*__unpack()` */
+    struct esp_protobuf_arena_block *head;  /*!< Internal list of allocated blocks */
+    size_t block_size;                  /*!< Size of each arena block */
+    uint32_t caps;                      /*!< Capabilities used for allocating blocks */
+} esp_protobuf_arena_t;
+
+/**
+ * @brief   Initialize an arena for use as a ProtobufCAllocator
+ *
+ * No memory is allocated until the first allocation request; an arena
+ * that never gets used need not be freed (though freeing it is harmless).
+ *
+ * @param[out] arena        Pointer to arena structure to initialize,
+ *                          usually on the caller's stack
+ * @param[in]  block_size   Size of each arena block, or 0 for the default.
+ *                          Allocations larger than the block size get a
+ *                          dedicated block of the required size
+ * @param[in]  malloc_caps  Capabilities (MALLOC_CAP_*) used for allocating
+ *                          blocks, or 0 for MALLOC_CAP_DEFAULT
+ *
+ * @return
+ *  - ESP_OK : Success
+ *  - ESP_ERR_INVALID_ARG : Null arena pointer
+ */
+esp_err_t esp_protobuf_arena_init(esp_protobuf_arena_t *arena, size_t block_size, uint32_t malloc_caps);
+
+/**
+ * @brief   Release all memory held by an arena
+ *
+ * Frees every block in one pass, releasing all messages unpacked through
+ * this arena without walking their trees. There is no need to call
+ * `*__free_unpacked()` on such messages. The arena returns to its
+ * initialized state and may be reused.
+ *
+ * @param[in] arena   Arena to release, previously initialized with
+ *                    `esp_protobuf_arena_init()`
+ */
+void esp_protobuf_arena_free(esp_protobuf_arena_t *arena);
+
+#ifdef __cplusplus
+}
+#endif
@@ -18,6 +18,8 @@
 #include "sec0.pb-c.h"
 #include "constants.pb-c.h"
 
+#include <esp_protobuf_arena.h>
+
 static const char* TAG = "security0";
 
 static esp_err_t sec0_session_setup(uint32_t session_id,
@@ -67,14 +69,20 @@ static esp_err_t sec0_req_handler(protocomm_security_handle_t handle,
     SessionData resp;
     esp_err_t ret;
 
-    req = session_data__unpack(NULL, inlen, inbuf);
+    /* The request lives only for the duration of this handler, so unpack
+     * it into an arena which is released in one go instead of walking the
+     * message tree */
+    esp_protobuf_arena_t arena;
+    esp_protobuf_arena_init(&arena, 0, 0);
+    req = session_data__unpack(&arena.allocator, inlen, inbuf);
     if (!req) {
         ESP_LOGE(TAG, "Unable to unpack setup_req");
+        esp_protobuf_arena_free(&arena);
         return ESP_ERR_INVALID_ARG;
     }
     if (req->sec_ver != protocomm_security0.ver) {
         ESP_LOGE(TAG, "Security version mismatch. Closing connection");
-        session_data__free_unpacked(req, NULL);
+        esp_protobuf_arena_free(&arena);
         return ESP_ERR_INVALID_ARG;
     }
 
@@ -82,12 +90,12 @@ static esp_err_t sec0_req_handler(protocomm_security_handle_t handle,
     ret = sec0_session_setup(session_id, req, &resp);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Session setup error %d", ret);
-        session_data__free_unpacked(req, NULL);
+        esp_protobuf_arena_free(&arena);
         return ESP_FAIL;
     }
 
     resp.sec_ver = req->sec_ver;
-    session_data__free_unpacked(req, NULL);
+    esp_protobuf_arena_free(&arena);
 
     *outlen = session_data__get_packed_size(&resp);
     *outbuf = (uint8_t *) malloc(*outlen);
@@ -22,6 +22,8 @@
 #include "sec2.pb-c.h"
 #include "constants.pb-c.h"
 
+#include <esp_protobuf_arena.h>
+
 #include "esp_srp.h"
 #include "endian.h"
 
@@ -588,14 +590,19 @@ static esp_err_t sec2_req_handler(protocomm_security_handle_t handle,
     SessionData resp;
     esp_err_t ret;
 
-    req = session_data__unpack(NULL, inlen, inbuf);
+    /* The request is transient, so unpack it into an arena which is
+     * released in one go instead of walking the message tree */
+    esp_protobuf_arena_t arena;
+    esp_protobuf_arena_init(&arena, 0, 0);
+    req = session_data__unpack(&arena.allocator, inlen, inbuf);
     if (!req) {
         ESP_LOGE(TAG, "Unable to unpack setup_req");
+        esp_protobuf_arena_free(&arena);
         return ESP_ERR_INVALID_ARG;
     }
     if (req->sec_ver != protocomm_security2.ver) {
         ESP_LOGE(TAG, "Security version mismatch. Closing connection");
-        session_data__free_unpacked(req, NULL);
+        esp_protobuf_arena_free(&arena);
         return ESP_ERR_INVALID_ARG;
     }
 
@@ -603,12 +610,12 @@ static esp_err_t sec2_req_handler(protocomm_security_handle_t handle,
     ret = sec2_session_setup(cur_session, session_id, req, &resp, (protocomm_security2_params_t *) sec_params);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Session setup error %d", ret);
-        session_data__free_unpacked(req, NULL);
+        esp_protobuf_arena_free(&arena);
         return ESP_FAIL;
     }
 
     resp.sec_ver = req->sec_ver;
-    session_data__free_unpacked(req, NULL);
+    esp_protobuf_arena_free(&arena);
 
     *outlen = session_data__get_packed_size(&resp);
     *outbuf = (uint8_t *) malloc(*outlen);
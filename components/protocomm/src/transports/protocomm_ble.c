@@ -31,6 +31,14 @@ ESP_EVENT_DEFINE_BASE(PROTOCOMM_TRANSPORT_BLE_EVENT);
 
 #define PREPARE_BUF_MAX_SIZE     CHAR_VAL_LEN_MAX
 
+/* With extended prepared writes, the reassembly buffer may grow beyond a
+ * single characteristic value up to the configured limit. */
+#if CONFIG_ESP_PROTOCOMM_BLE_EXT_PREPARE_WRITE
+    #define PREPARE_BUF_LIMIT    CONFIG_ESP_PROTOCOMM_BLE_PREPARE_BUF_MAX_SIZE
+#else
+    #define PREPARE_BUF_LIMIT    PREPARE_BUF_MAX_SIZE
+#endif
+
 static const char *TAG = "protocomm_ble";
 
 /* BLE specific configuration parameters */
@@ -50,6 +58,7 @@ typedef struct {
 typedef struct {
     uint8_t                *prepare_buf;
     int                     prepare_len;
+    int                     prepare_cap;
     uint16_t                handle;
 } prepare_type_env_t;
 
@@ -84,6 +93,7 @@ static void protocomm_ble_reset_prepare_write(void)
         prepare_write_env.prepare_buf = NULL;
     }
     prepare_write_env.prepare_len = 0;
+    prepare_write_env.prepare_cap = 0;
     prepare_write_env.handle = 0;
 }
 
@@ -215,21 +225,43 @@ static esp_err_t prepare_write_event_env(esp_gatt_if_t gatts_if,
              param->write.handle, param->write.len, param->write.offset);
     esp_gatt_status_t status = ESP_GATT_OK;
 
-    /* Ensure that write data is not larger than max attribute length */
-    if (param->write.offset > PREPARE_BUF_MAX_SIZE) {
+    /* Ensure that write data is not larger than the reassembly limit */
+    if (param->write.offset > PREPARE_BUF_LIMIT) {
         status = ESP_GATT_INVALID_OFFSET;
-    } else if ((param->write.offset + param->write.len) > PREPARE_BUF_MAX_SIZE) {
+    } else if ((param->write.offset + param->write.len) > PREPARE_BUF_LIMIT) {
         status = ESP_GATT_INVALID_ATTR_LEN;
     } else {
         /* If prepare buffer is not allocated, then allocate it */
         if (prepare_write_env.prepare_buf == NULL) {
             prepare_write_env.prepare_len = 0;
+            prepare_write_env.prepare_cap = PREPARE_BUF_MAX_SIZE;
             prepare_write_env.prepare_buf = (uint8_t *) malloc(PREPARE_BUF_MAX_SIZE * sizeof(uint8_t));
             if (prepare_write_env.prepare_buf == NULL) {
                 ESP_LOGE(TAG, "%s , failed to allocate prepare buf", __func__);
                 status = ESP_GATT_NO_RESOURCES;
             }
         }
+#if CONFIG_ESP_PROTOCOMM_BLE_EXT_PREPARE_WRITE
+        /* Grow the reassembly buffer in MTU-sized steps, so a long write
+         * only pays for the fragments the connection actually carries */
+        if (status == ESP_GATT_OK &&
+                (param->write.offset + param->write.len) > prepare_write_env.prepare_cap) {
+            int step = protoble_internal->gatt_mtu;
+            int new_cap = prepare_write_env.prepare_cap;
+            while (new_cap < (param->write.offset + param->write.len)) {
+                new_cap += step;
+            }
+            new_cap = MIN(new_cap, PREPARE_BUF_LIMIT);
+            uint8_t *new_buf = (uint8_t *) realloc(prepare_write_env.prepare_buf, new_cap);
+            if (new_buf == NULL) {
+                ESP_LOGE(TAG, "%s , failed to grow prepare buf to %d", __func__, new_cap);
+                status = ESP_GATT_NO_RESOURCES;
+            } else {
+                prepare_write_env.prepare_buf = new_buf;
+                prepare_write_env.prepare_cap = new_cap;
+            }
+        }
+#endif
     }
 
     /* If prepare buffer is allocated copy incoming data into it */
@@ -267,11 +299,7 @@ static esp_err_t prepare_write_event_env(esp_gatt_if_t gatts_if,
         }
     }
     if (status != ESP_GATT_OK) {
-        if (prepare_write_env.prepare_buf) {
-            free(prepare_write_env.prepare_buf);
-            prepare_write_env.prepare_buf = NULL;
-            prepare_write_env.prepare_len = 0;
-        }
+        protocomm_ble_reset_prepare_write();
         return ESP_FAIL;
     }
     return ESP_OK;
@@ -368,11 +396,7 @@ static void transport_simple_ble_exec_write(esp_gatts_cb_event_t event, esp_gatt
             esp_ble_gatts_set_attr_value(prepare_write_env.handle, outlen, outbuf);
         }
     }
-    if (prepare_write_env.prepare_buf) {
-        free(prepare_write_env.prepare_buf);
-        prepare_write_env.prepare_buf = NULL;
-        prepare_write_env.prepare_len = 0;
-    }
+    protocomm_ble_reset_prepare_write();
 
     err = esp_ble_gatts_send_response(gatts_if, param->exec_write.conn_id, param->exec_write.trans_id, ESP_GATT_OK, NULL);
     if (err != ESP_OK) {
@@ -29,6 +29,10 @@ typedef struct {
     uint32_t stack_alloc_caps;  /**< A bit mask of memory capabilities (MALLOC_CAPS*) to use when
                                      allocating the stack. The memory must be 8 bit accessible (MALLOC_CAP_8BIT).
                                      The developer is responsible for the correctenss of \c stack_alloc_caps. */
+    bool use_task_pool;         /**< Serve the thread from the pre-allocated task pool (see PTHREAD_ENABLE_TASK_POOL)
+                                     instead of allocating a fresh stack and TCB. Creation falls back to a dedicated
+                                     task when the pool is exhausted or stack_size exceeds the pool slot size;
+                                     pin_to_core is ignored for pooled threads. */
 } esp_pthread_cfg_t;
 
 /**
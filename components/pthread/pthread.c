@@ -9,6 +9,9 @@
 #include <errno.h>
 #include <pthread.h>
 #include <string.h>
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+#include <setjmp.h>
+#endif
 #include <sys/lock.h>
 #include "esp_err.h"
 #include "esp_attr.h"
@@ -45,6 +48,9 @@ typedef struct esp_pthread_entry {
     TaskHandle_t                join_task;      ///< Handle of the task waiting to join
     enum esp_pthread_task_state state;          ///< pthread task state
     bool                        detached;       ///< True if pthread is detached
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+    bool                        pooled;         ///< True if the thread runs on a task pool slot; the task must not be deleted
+#endif
     void                       *retval;         ///< Value supplied to calling thread during join
     void                       *task_arg;       ///< Task arguments
 } esp_pthread_t;
@@ -150,6 +156,12 @@ esp_err_t esp_pthread_set_cfg(const esp_pthread_cfg_t *cfg)
         return ESP_ERR_INVALID_ARG;
     }
 
+#if !CONFIG_PTHREAD_ENABLE_TASK_POOL
+    if (cfg->use_task_pool) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
+
     // 0 is treated as default value, hence change caps to MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL in that case
     int heap_caps;
     if (cfg->stack_alloc_caps == 0) {
@@ -246,6 +258,123 @@ static void pthread_task_func(void *arg)
     ESP_LOGV(TAG, "%s EXIT", __FUNCTION__);
 }
 
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+/** task pool slot: a statically created task recycled across pthread lifetimes */
+typedef struct {
+    StaticTask_t tcb;                   ///< TCB of the pool task
+    StackType_t *stack;                 ///< stack of the pool task; allocated once on pool init
+    TaskHandle_t handle;                ///< handle of the pool task
+    esp_pthread_task_arg_t *task_arg;   ///< argument of the thread currently served by this slot
+    jmp_buf exit_jmp;                   ///< longjmp target used by pthread_exit() to return to the worker loop
+    bool busy;                          ///< slot currently serves a thread
+} pthread_pool_slot_t;
+
+static pthread_pool_slot_t s_pool_slots[CONFIG_PTHREAD_TASK_POOL_SIZE];
+static bool s_pool_ready;
+
+static pthread_pool_slot_t *pthread_pool_find_slot(TaskHandle_t handle)
+{
+    for (int i = 0; i < CONFIG_PTHREAD_TASK_POOL_SIZE; i++) {
+        if (s_pool_slots[i].handle == handle) {
+            return &s_pool_slots[i];
+        }
+    }
+    return NULL;
+}
+
+static void pthread_pool_task_func(void *arg)
+{
+    pthread_pool_slot_t *slot = (pthread_pool_slot_t *)arg;
+    while (true) {
+        // wait for a dispatch; pthread_create() sends the same "start"
+        // notification as it does for dedicated tasks
+        xTaskNotifyWait(0, 0, NULL, portMAX_DELAY);
+        esp_pthread_task_arg_t *task_arg = slot->task_arg;
+        if (task_arg->cfg.inherit_cfg) {
+            /* see the comment in pthread_task_func() */
+            esp_pthread_cfg_t *cfg = &task_arg->cfg;
+            cfg->thread_name = NULL;
+            esp_pthread_set_cfg(cfg);
+        }
+        if (setjmp(slot->exit_jmp) == 0) {
+            ESP_LOGV(TAG, "%s START %p", __FUNCTION__, task_arg->func);
+            void *rval = task_arg->func(task_arg->arg);
+            ESP_LOGV(TAG, "%s END %p", __FUNCTION__, task_arg->func);
+            pthread_exit(rval); // comes back through the longjmp below
+        }
+        // pthread_exit() has run the TLS destructors and the join hand-shake
+        // and jumped back here; the slot can serve the next thread
+        _lock_acquire(&s_threads_lock);
+        slot->task_arg = NULL;
+        slot->busy = false;
+        _lock_release(&s_threads_lock);
+    }
+}
+
+// Create the pool tasks on first use. Called with s_threads_lock held.
+static esp_err_t pthread_pool_init(void)
+{
+    if (s_pool_ready) {
+        return ESP_OK;
+    }
+    for (int i = 0; i < CONFIG_PTHREAD_TASK_POOL_SIZE; i++) {
+        pthread_pool_slot_t *slot = &s_pool_slots[i];
+        slot->stack = heap_caps_malloc(CONFIG_PTHREAD_TASK_POOL_STACK_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (slot->stack == NULL) {
+            goto rollback;
+        }
+        slot->handle = xTaskCreateStatic(&pthread_pool_task_func,
+                                         CONFIG_PTHREAD_TASK_NAME_DEFAULT,
+                                         CONFIG_PTHREAD_TASK_POOL_STACK_SIZE / sizeof(StackType_t),
+                                         slot,
+                                         CONFIG_PTHREAD_TASK_PRIO_DEFAULT,
+                                         slot->stack,
+                                         &slot->tcb);
+        if (slot->handle == NULL) {
+            goto rollback;
+        }
+    }
+    s_pool_ready = true;
+    return ESP_OK;
+
+rollback:
+    for (int i = 0; i < CONFIG_PTHREAD_TASK_POOL_SIZE; i++) {
+        pthread_pool_slot_t *slot = &s_pool_slots[i];
+        if (slot->handle) {
+            // the pool tasks are all parked in xTaskNotifyWait at this point
+            vTaskDelete(slot->handle);
+            slot->handle = NULL;
+        }
+        free(slot->stack);
+        slot->stack = NULL;
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+// Claim a free pool slot for a thread. Called with s_threads_lock held;
+// returns NULL if the pool cannot serve the request, in which case the
+// caller falls back to a dedicated task.
+static TaskHandle_t pthread_pool_claim(size_t stack_size, BaseType_t prio, esp_pthread_task_arg_t *task_arg)
+{
+    if (stack_size > CONFIG_PTHREAD_TASK_POOL_STACK_SIZE) {
+        return NULL;
+    }
+    if (pthread_pool_init() != ESP_OK) {
+        return NULL;
+    }
+    for (int i = 0; i < CONFIG_PTHREAD_TASK_POOL_SIZE; i++) {
+        pthread_pool_slot_t *slot = &s_pool_slots[i];
+        if (!slot->busy) {
+            slot->busy = true;
+            slot->task_arg = task_arg;
+            vTaskPrioritySet(slot->handle, prio);
+            return slot->handle;
+        }
+    }
+    return NULL;
+}
+#endif // CONFIG_PTHREAD_ENABLE_TASK_POOL
+
 #if CONFIG_SPIRAM && CONFIG_FREERTOS_SMP
 static UBaseType_t coreID_to_AffinityMask(BaseType_t core_id)
 {
@@ -375,32 +504,44 @@ int pthread_create(pthread_t *thread, const pthread_attr_t *attr,
         }
     }
 
-    // stack_size is in bytes. This transformation ensures that the units are
-    // transformed to the units used in FreeRTOS.
-    // Note: float division of ceil(m / n) ==
-    //       integer division of (m + n - 1) / n
-    stack_size = (stack_size + sizeof(StackType_t) - 1) / sizeof(StackType_t);
     task_arg->func = start_routine;
     task_arg->arg = arg;
     pthread->task_arg = task_arg;
 
-    BaseType_t res = pthread_create_freertos_task_with_caps(&pthread_task_func,
-                                                            task_name,
-                                                            stack_size,
-                                                            task_arg,
-                                                            prio,
-                                                            core_id,
-                                                            stack_alloc_caps,
-                                                            &xHandle);
-
-    if (res != pdPASS) {
-        ESP_LOGE(TAG, "Failed to create task!");
-        free(pthread);
-        free(task_arg);
-        if (res == errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY) {
-            return ENOMEM;
-        } else {
-            return EAGAIN;
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+    if (pthread_cfg && pthread_cfg->use_task_pool) {
+        _lock_acquire(&s_threads_lock);
+        xHandle = pthread_pool_claim(stack_size, prio, task_arg);
+        _lock_release(&s_threads_lock);
+        pthread->pooled = (xHandle != NULL);
+    }
+    if (xHandle == NULL)
+#endif
+    {
+        // stack_size is in bytes. This transformation ensures that the units are
+        // transformed to the units used in FreeRTOS.
+        // Note: float division of ceil(m / n) ==
+        //       integer division of (m + n - 1) / n
+        stack_size = (stack_size + sizeof(StackType_t) - 1) / sizeof(StackType_t);
+
+        BaseType_t res = pthread_create_freertos_task_with_caps(&pthread_task_func,
+                                                                task_name,
+                                                                stack_size,
+                                                                task_arg,
+                                                                prio,
+                                                                core_id,
+                                                                stack_alloc_caps,
+                                                                &xHandle);
+
+        if (res != pdPASS) {
+            ESP_LOGE(TAG, "Failed to create task!");
+            free(pthread);
+            free(task_arg);
+            if (res == errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY) {
+                return ENOMEM;
+            } else {
+                return EAGAIN;
+            }
         }
     }
     pthread->handle = xHandle;
@@ -425,6 +566,9 @@ int pthread_join(pthread_t thread, void **retval)
     esp_pthread_t *pthread = (esp_pthread_t *)thread;
     int ret = 0;
     bool wait = false;
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+    bool pooled = false;
+#endif
     void *child_task_retval = 0;
 
     ESP_LOGV(TAG, "%s %p", __FUNCTION__, pthread);
@@ -456,6 +600,9 @@ int pthread_join(pthread_t thread, void **retval)
                 wait = true;
             } else { // thread has exited and task is already suspended, or about to be suspended
                 child_task_retval = pthread->retval;
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+                pooled = pthread->pooled;
+#endif
                 pthread_delete(pthread);
             }
         }
@@ -467,12 +614,22 @@ int pthread_join(pthread_t thread, void **retval)
             xTaskNotifyWait(0, 0, NULL, portMAX_DELAY);
             _lock_acquire(&s_threads_lock);
             child_task_retval = pthread->retval;
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+            pooled = pthread->pooled;
+#endif
             pthread_delete(pthread);
             _lock_release(&s_threads_lock);
         }
-        /* clean up thread local storage before task deletion */
-        pthread_internal_local_storage_destructor_callback(handle);
-        vTaskDelete(handle);
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+        // a pooled thread already ran its TLS destructors in pthread_exit()
+        // and its task is recycled instead of deleted
+        if (!pooled)
+#endif
+        {
+            /* clean up thread local storage before task deletion */
+            pthread_internal_local_storage_destructor_callback(handle);
+            vTaskDelete(handle);
+        }
     }
 
     if (retval) {
@@ -504,10 +661,18 @@ int pthread_detach(pthread_t thread)
         pthread->detached = true;
     } else {
         // pthread already stopped
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+        bool pooled = pthread->pooled;
+#endif
         pthread_delete(pthread);
-        /* clean up thread local storage before task deletion */
-        pthread_internal_local_storage_destructor_callback(handle);
-        vTaskDelete(handle);
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+        if (!pooled)
+#endif
+        {
+            /* clean up thread local storage before task deletion */
+            pthread_internal_local_storage_destructor_callback(handle);
+            vTaskDelete(handle);
+        }
     }
     _lock_release(&s_threads_lock);
     ESP_LOGV(TAG, "%s %p EXIT %d", __FUNCTION__, pthread, ret);
@@ -529,6 +694,9 @@ void pthread_exit(void *value_ptr)
     if (pthread->task_arg) {
         free(pthread->task_arg);
     }
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+    bool pooled = pthread->pooled;
+#endif
     if (pthread->detached) {
         // auto-free for detached threads
         pthread_delete(pthread);
@@ -552,6 +720,17 @@ void pthread_exit(void *value_ptr)
     // this task could be deleted at any time, so don't take another lock or
     // do anything that might lock (such as printing to stdout)
 
+#if CONFIG_PTHREAD_ENABLE_TASK_POOL
+    if (pooled) {
+        // jump back into the worker loop of the pool slot so the stack and
+        // TCB get recycled; the joiner (if any) only touches the pthread
+        // bookkeeping structure, never this task
+        pthread_pool_slot_t *slot = pthread_pool_find_slot(xTaskGetCurrentTaskHandle());
+        assert(slot != NULL);
+        longjmp(slot->exit_jmp, 1);
+    }
+#endif
+
     if (detached) {
         vTaskDelete(NULL);
     } else {
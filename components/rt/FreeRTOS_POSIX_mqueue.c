@@ -46,9 +46,16 @@
 #include "FreeRTOS_POSIX.h"
 #include "FreeRTOS_POSIX/utils.h"
 
+#include "freertos/list.h"
 #include "aws_doubly_linked_list.h"
 #include "esp_private/critical_section.h"
 
+/**
+ * @brief Task notification index used to wake a single reader blocked on an
+ * empty message queue.
+ */
+#define posixconfigMQ_NOTIFY_INDEX    0
+
 /**
  * @brief Element of the FreeRTOS queues that store mq data.
  */
@@ -67,11 +74,27 @@ typedef struct QueueElement
 typedef struct QueueListElement
 {
     Link_t xLink;              /**< Pointer to the next element in the list. */
-    QueueHandle_t xQueue;      /**< FreeRTOS queue handle. */
+    QueueHandle_t xQueue;      /**< FreeRTOS queue handle. NULL when the fast path ring is used. */
     size_t xOpenDescriptors;   /**< Number of threads that have opened this queue. */
     char * pcName;             /**< Null-terminated queue name. */
     struct mq_attr xAttr;      /**< Queue attributes. */
     BaseType_t xPendingUnlink; /**< If pdTRUE, this queue will be unlinked once all descriptors close. */
+
+    /* Fast path members, used when pucRingStorage is not NULL. Messages are
+     * stored in a preallocated ring of mq_maxmsg slots of mq_msgsize bytes
+     * each, avoiding the per-message heap allocation and FreeRTOS queue
+     * transfer of the generic path. */
+    char * pucRingStorage;          /**< Preallocated message slot storage, or NULL for the generic path. */
+    size_t * pxRingSizes;           /**< Length of the message stored in each slot. */
+    UBaseType_t uxRingHead;         /**< Slot the next message is written to. */
+    UBaseType_t uxRingTail;         /**< Slot the next message is read from. */
+    UBaseType_t uxRingCount;        /**< Number of messages currently stored. */
+    TaskHandle_t xReaderTask;       /**< First task to receive from this queue, owner of the notification fast path. */
+    TaskHandle_t xReaderWaiting;    /**< Reader blocked waiting for a task notification, or NULL. */
+    BaseType_t xMultiReader;        /**< Set once a second task receives from this queue, disabling the notification fast path. */
+    List_t xTasksWaitingToSend;     /**< Tasks blocked waiting for a free slot. */
+    List_t xTasksWaitingToReceive;  /**< Tasks blocked waiting for a message, multi-reader case only. */
+    portMUX_TYPE xRingLock;         /**< Spinlock protecting the ring state. */
 } QueueListElement_t;
 
 /*-----------------------------------------------------------*/
@@ -150,6 +173,42 @@ static void prvInitializeQueueList( void );
 static BaseType_t prvValidateQueueName( const char * const pcName,
                                         size_t * pxNameLength );
 
+/**
+ * @brief Copy a message into the fast path ring, blocking up to xTimeoutTicks
+ * for a free slot.
+ *
+ * @param[in] pxMessageQueue Queue to send to. Must be a fast path queue.
+ * @param[in] pcMsg The message to copy.
+ * @param[in] xMsgLength Length of pcMsg. Must fit in a slot.
+ * @param[in] xTimeoutTicks How long to wait for a free slot.
+ *
+ * @return pdTRUE if the message was stored; pdFALSE on timeout.
+ */
+static BaseType_t prvRingSend( QueueListElement_t * pxMessageQueue,
+                               const char * pcMsg,
+                               size_t xMsgLength,
+                               TickType_t xTimeoutTicks );
+
+/**
+ * @brief Copy the oldest message out of the fast path ring, blocking up to
+ * xTimeoutTicks for a message to arrive.
+ *
+ * A single reader blocks on a direct task notification
+ * (posixconfigMQ_NOTIFY_INDEX); once a second task receives from the same
+ * queue, readers block on an event list instead.
+ *
+ * @param[in] pxMessageQueue Queue to receive from. Must be a fast path queue.
+ * @param[out] pcMsgBuffer Buffer the message is copied to. Must hold mq_msgsize bytes.
+ * @param[out] pxMsgLength Length of the received message.
+ * @param[in] xTimeoutTicks How long to wait for a message.
+ *
+ * @return pdTRUE if a message was received; pdFALSE on timeout.
+ */
+static BaseType_t prvRingReceive( QueueListElement_t * pxMessageQueue,
+                                  char * pcMsgBuffer,
+                                  size_t * pxMsgLength,
+                                  TickType_t xTimeoutTicks );
+
 /**
  * @brief Guards access to the list of message queues.
  */
@@ -221,17 +280,56 @@ static BaseType_t prvCreateNewMessageQueue( QueueListElement_t ** ppxMessageQueu
         xStatus = pdFALSE;
     }
 
-    /* Create the FreeRTOS queue. */
+    /* Try to set up the fast path: a preallocated ring of message slots. */
     if( xStatus == pdTRUE )
     {
-        ( *ppxMessageQueue )->xQueue =
-            xQueueCreate( pxAttr->mq_maxmsg, sizeof( QueueElement_t ) );
+        QueueListElement_t * pxNewQueue = *ppxMessageQueue;
+
+        pxNewQueue->xQueue = NULL;
+        pxNewQueue->pucRingStorage = NULL;
 
-        /* Check that queue creation succeeded. */
-        if( ( *ppxMessageQueue )->xQueue == NULL )
+        /* Guard against overflow of the slot storage size. */
+        if( ( size_t ) pxAttr->mq_msgsize <= ( SIZE_MAX / ( size_t ) pxAttr->mq_maxmsg ) )
         {
-            vPortFree( *ppxMessageQueue );
-            xStatus = pdFALSE;
+            pxNewQueue->pucRingStorage = pvPortMalloc( ( size_t ) pxAttr->mq_maxmsg * ( size_t ) pxAttr->mq_msgsize );
+        }
+
+        if( pxNewQueue->pucRingStorage != NULL )
+        {
+            pxNewQueue->pxRingSizes = pvPortMalloc( ( size_t ) pxAttr->mq_maxmsg * sizeof( size_t ) );
+
+            if( pxNewQueue->pxRingSizes == NULL )
+            {
+                vPortFree( pxNewQueue->pucRingStorage );
+                pxNewQueue->pucRingStorage = NULL;
+            }
+        }
+
+        if( pxNewQueue->pucRingStorage != NULL )
+        {
+            pxNewQueue->uxRingHead = 0;
+            pxNewQueue->uxRingTail = 0;
+            pxNewQueue->uxRingCount = 0;
+            pxNewQueue->xReaderTask = NULL;
+            pxNewQueue->xReaderWaiting = NULL;
+            pxNewQueue->xMultiReader = pdFALSE;
+            vListInitialise( &pxNewQueue->xTasksWaitingToSend );
+            vListInitialise( &pxNewQueue->xTasksWaitingToReceive );
+            portMUX_INITIALIZE( &pxNewQueue->xRingLock );
+        }
+        else
+        {
+            /* Ring storage could not be allocated as a whole. Fall back to the
+             * generic path which allocates each message separately. */
+            pxNewQueue->xQueue =
+                xQueueCreate( pxAttr->mq_maxmsg, sizeof( QueueElement_t ) );
+
+            /* Check that queue creation succeeded. */
+            if( pxNewQueue->xQueue == NULL )
+            {
+                vPortFree( pxNewQueue );
+                xStatus = pdFALSE;
+            }
         }
     }
 
@@ -243,7 +341,16 @@ static BaseType_t prvCreateNewMessageQueue( QueueListElement_t ** ppxMessageQueu
         /* Check that memory was successfully allocated for queue name. */
         if( ( *ppxMessageQueue )->pcName == NULL )
         {
-            vQueueDelete( ( *ppxMessageQueue )->xQueue );
+            if( ( *ppxMessageQueue )->pucRingStorage != NULL )
+            {
+                vPortFree( ( *ppxMessageQueue )->pucRingStorage );
+                vPortFree( ( *ppxMessageQueue )->pxRingSizes );
+            }
+            else
+            {
+                vQueueDelete( ( *ppxMessageQueue )->xQueue );
+            }
+
             vPortFree( *ppxMessageQueue );
             xStatus = pdFALSE;
         }
@@ -279,17 +386,27 @@ static void prvDeleteMessageQueue( const QueueListElement_t * const pxMessageQue
 {
     QueueElement_t xQueueElement = { 0 };
 
-    /* Free all data in the queue. It's assumed that no more data will be added
-     * to the queue, so xQueueReceive does not block. */
-    while( xQueueReceive( pxMessageQueue->xQueue,
-                          ( void * ) &xQueueElement,
-                          0 ) == pdTRUE )
+    if( pxMessageQueue->pucRingStorage != NULL )
+    {
+        /* Fast path queue. All messages live in the preallocated ring. */
+        vPortFree( pxMessageQueue->pucRingStorage );
+        vPortFree( pxMessageQueue->pxRingSizes );
+    }
+    else
     {
-        vPortFree( xQueueElement.pcData );
+        /* Free all data in the queue. It's assumed that no more data will be added
+         * to the queue, so xQueueReceive does not block. */
+        while( xQueueReceive( pxMessageQueue->xQueue,
+                              ( void * ) &xQueueElement,
+                              0 ) == pdTRUE )
+        {
+            vPortFree( xQueueElement.pcData );
+        }
+
+        vQueueDelete( pxMessageQueue->xQueue );
     }
 
     /* Free memory used by this message queue. */
-    vQueueDelete( pxMessageQueue->xQueue );
     vPortFree( ( void * ) pxMessageQueue->pcName );
     vPortFree( ( void * ) pxMessageQueue );
 }
@@ -400,6 +517,186 @@ static BaseType_t prvValidateQueueName( const char * const pcName,
 
 /*-----------------------------------------------------------*/
 
+static BaseType_t prvRingSend( QueueListElement_t * pxMessageQueue,
+                               const char * pcMsg,
+                               size_t xMsgLength,
+                               TickType_t xTimeoutTicks )
+{
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+
+    for( ; ; )
+    {
+        TaskHandle_t xReaderToNotify = NULL;
+
+        portENTER_CRITICAL( &pxMessageQueue->xRingLock );
+
+        if( pxMessageQueue->uxRingCount < ( UBaseType_t ) pxMessageQueue->xAttr.mq_maxmsg )
+        {
+            /* A slot is free. Copy the message in place. */
+            char * pcSlot = pxMessageQueue->pucRingStorage +
+                            ( ( size_t ) pxMessageQueue->uxRingHead * ( size_t ) pxMessageQueue->xAttr.mq_msgsize );
+            ( void ) memcpy( pcSlot, pcMsg, xMsgLength );
+            pxMessageQueue->pxRingSizes[ pxMessageQueue->uxRingHead ] = xMsgLength;
+            pxMessageQueue->uxRingHead = ( pxMessageQueue->uxRingHead + 1 ) % ( UBaseType_t ) pxMessageQueue->xAttr.mq_maxmsg;
+            pxMessageQueue->uxRingCount++;
+
+            /* Claim the reader blocked on the notification fast path, if any.
+             * The notification itself is sent outside the critical section. */
+            xReaderToNotify = pxMessageQueue->xReaderWaiting;
+            pxMessageQueue->xReaderWaiting = NULL;
+
+            /* Wake a reader blocked on the event list (multi-reader case). */
+            if( listLIST_IS_EMPTY( &pxMessageQueue->xTasksWaitingToReceive ) == pdFALSE )
+            {
+                if( xTaskRemoveFromEventList( &pxMessageQueue->xTasksWaitingToReceive ) == pdTRUE )
+                {
+                    /* The unblocked task will preempt us. Trigger a yield here. */
+                    portYIELD_WITHIN_API();
+                }
+            }
+
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+
+            if( xReaderToNotify != NULL )
+            {
+                xTaskNotifyGiveIndexed( xReaderToNotify, posixconfigMQ_NOTIFY_INDEX );
+            }
+
+            return pdTRUE;
+        }
+
+        /* The ring is full. Return or block depending on the timeout. */
+        if( xTimeoutTicks == ( TickType_t ) 0 )
+        {
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+            return pdFALSE;
+        }
+
+        if( xEntryTimeSet == pdFALSE )
+        {
+            /* This is our first block. Set entry time. */
+            vTaskSetTimeOutState( &xTimeOut );
+            xEntryTimeSet = pdTRUE;
+        }
+
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTimeoutTicks ) == pdFALSE )
+        {
+            /* Not timed out yet. Block the current task. */
+            vTaskPlaceOnEventList( &pxMessageQueue->xTasksWaitingToSend, xTimeoutTicks );
+            portYIELD_WITHIN_API();
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+        }
+        else
+        {
+            /* We have timed out. */
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+            return pdFALSE;
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvRingReceive( QueueListElement_t * pxMessageQueue,
+                                  char * pcMsgBuffer,
+                                  size_t * pxMsgLength,
+                                  TickType_t xTimeoutTicks )
+{
+    TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+
+    for( ; ; )
+    {
+        BaseType_t xUseNotification;
+
+        portENTER_CRITICAL( &pxMessageQueue->xRingLock );
+
+        /* Track the reader population. The first reader owns the notification
+         * fast path; once a second task receives from the same queue, all
+         * readers block on the event list instead. */
+        if( pxMessageQueue->xReaderTask == NULL )
+        {
+            pxMessageQueue->xReaderTask = xCurrentTask;
+        }
+        else if( pxMessageQueue->xReaderTask != xCurrentTask )
+        {
+            pxMessageQueue->xMultiReader = pdTRUE;
+        }
+
+        if( pxMessageQueue->uxRingCount > 0 )
+        {
+            /* A message is available. Copy it out of its slot. */
+            const char * pcSlot = pxMessageQueue->pucRingStorage +
+                                  ( ( size_t ) pxMessageQueue->uxRingTail * ( size_t ) pxMessageQueue->xAttr.mq_msgsize );
+            *pxMsgLength = pxMessageQueue->pxRingSizes[ pxMessageQueue->uxRingTail ];
+            ( void ) memcpy( pcMsgBuffer, pcSlot, *pxMsgLength );
+            pxMessageQueue->uxRingTail = ( pxMessageQueue->uxRingTail + 1 ) % ( UBaseType_t ) pxMessageQueue->xAttr.mq_maxmsg;
+            pxMessageQueue->uxRingCount--;
+
+            /* Wake a sender blocked waiting for a free slot. */
+            if( listLIST_IS_EMPTY( &pxMessageQueue->xTasksWaitingToSend ) == pdFALSE )
+            {
+                if( xTaskRemoveFromEventList( &pxMessageQueue->xTasksWaitingToSend ) == pdTRUE )
+                {
+                    /* The unblocked task will preempt us. Trigger a yield here. */
+                    portYIELD_WITHIN_API();
+                }
+            }
+
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+            return pdTRUE;
+        }
+
+        /* The ring is empty. Return or block depending on the timeout. */
+        if( xTimeoutTicks == ( TickType_t ) 0 )
+        {
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+            return pdFALSE;
+        }
+
+        if( xEntryTimeSet == pdFALSE )
+        {
+            /* This is our first block. Set entry time. */
+            vTaskSetTimeOutState( &xTimeOut );
+            xEntryTimeSet = pdTRUE;
+        }
+
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTimeoutTicks ) == pdTRUE )
+        {
+            /* We have timed out. */
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+            return pdFALSE;
+        }
+
+        xUseNotification = ( pxMessageQueue->xMultiReader == pdFALSE ) ? pdTRUE : pdFALSE;
+
+        if( xUseNotification == pdTRUE )
+        {
+            /* Single reader. Block on a direct task notification, which a
+             * sender delivers without touching any event list. */
+            pxMessageQueue->xReaderWaiting = xCurrentTask;
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+
+            ( void ) ulTaskNotifyTakeIndexed( posixconfigMQ_NOTIFY_INDEX, pdTRUE, xTimeoutTicks );
+
+            portENTER_CRITICAL( &pxMessageQueue->xRingLock );
+            pxMessageQueue->xReaderWaiting = NULL;
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+        }
+        else
+        {
+            /* Multiple readers. Block on the event list. */
+            vTaskPlaceOnEventList( &pxMessageQueue->xTasksWaitingToReceive, xTimeoutTicks );
+            portYIELD_WITHIN_API();
+            portEXIT_CRITICAL( &pxMessageQueue->xRingLock );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
 int mq_close( mqd_t mqdes )
 {
     int iStatus = 0;
@@ -478,7 +775,14 @@ int mq_getattr( mqd_t mqdes,
     {
         /* Update the number of messages in the queue and copy the attributes
          * into mqstat. */
-        pxMessageQueue->xAttr.mq_curmsgs = ( long ) uxQueueMessagesWaiting( pxMessageQueue->xQueue );
+        if( pxMessageQueue->pucRingStorage != NULL )
+        {
+            pxMessageQueue->xAttr.mq_curmsgs = ( long ) pxMessageQueue->uxRingCount;
+        }
+        else
+        {
+            pxMessageQueue->xAttr.mq_curmsgs = ( long ) uxQueueMessagesWaiting( pxMessageQueue->xQueue );
+        }
         *mqstat = pxMessageQueue->xAttr;
     }
     else
@@ -700,6 +1004,35 @@ ssize_t mq_timedreceive( mqd_t mqdes,
     /* Release the mutex protecting the queue list. */
     ( void ) xSemaphoreGive( ( SemaphoreHandle_t ) &xQueueListMutex );
 
+    /* Fast path: receive directly out of the preallocated ring. */
+    if( ( xStatus == 0 ) && ( pxMessageQueue->pucRingStorage != NULL ) )
+    {
+        size_t xReceivedLength = 0;
+
+        if( prvRingReceive( pxMessageQueue, msg_ptr, &xReceivedLength, xTimeoutTicks ) == pdTRUE )
+        {
+            xStatus = ( ssize_t ) xReceivedLength;
+        }
+        else
+        {
+            /* If the ring receive fails, set the appropriate errno. */
+            if( pxMessageQueue->xAttr.mq_flags & O_NONBLOCK )
+            {
+                /* Set errno to EAGAIN for nonblocking mq. */
+                errno = EAGAIN;
+            }
+            else
+            {
+                /* Otherwise, set errno to ETIMEDOUT. */
+                errno = ETIMEDOUT;
+            }
+
+            xStatus = -1;
+        }
+
+        return xStatus;
+    }
+
     if( xStatus == 0 )
     {
         /* Receive data from the FreeRTOS queue. */
@@ -792,6 +1125,29 @@ int mq_timedsend( mqd_t mqdes,
     /* Release the mutex protecting the queue list. */
     ( void ) xSemaphoreGive( ( SemaphoreHandle_t ) &xQueueListMutex );
 
+    /* Fast path: copy the message directly into the preallocated ring. */
+    if( ( iStatus == 0 ) && ( pxMessageQueue->pucRingStorage != NULL ) )
+    {
+        if( prvRingSend( pxMessageQueue, msg_ptr, msg_len, xTimeoutTicks ) == pdFALSE )
+        {
+            /* If the ring send fails, set the appropriate errno. */
+            if( pxMessageQueue->xAttr.mq_flags & O_NONBLOCK )
+            {
+                /* Set errno to EAGAIN for nonblocking mq. */
+                errno = EAGAIN;
+            }
+            else
+            {
+                /* Otherwise, set errno to ETIMEDOUT. */
+                errno = ETIMEDOUT;
+            }
+
+            iStatus = -1;
+        }
+
+        return iStatus;
+    }
+
     /* Allocate memory for the message. */
     if( iStatus == 0 )
     {
@@ -158,6 +158,8 @@ esp_err_t sdmmc_io_init_check_card_cap(sdmmc_card_t* card, uint8_t* card_cap);
 esp_err_t sdmmc_init_mmc_bus_width(sdmmc_card_t* card);
 esp_err_t sdmmc_init_card_hs_mode(sdmmc_card_t* card);
 esp_err_t sdmmc_init_host_frequency(sdmmc_card_t* card);
+esp_err_t sdmmc_init_mmc_hs200(sdmmc_card_t* card);
+esp_err_t sdmmc_init_mmc_hs200_tuning(sdmmc_card_t* card);
 esp_err_t sdmmc_init_mmc_check_ext_csd(sdmmc_card_t* card);
 esp_err_t sdmmc_init_sd_uhs1(sdmmc_card_t* card);
 esp_err_t sdmmc_init_sd_driver_strength(sdmmc_card_t *card);
@@ -49,6 +49,7 @@ extern "C" {
 #define MMC_READ_BLOCK_MULTIPLE         18      /* R1 */
 #define MMC_SEND_TUNING_BLOCK           19      /* R1 */
 #define MMC_WRITE_DAT_UNTIL_STOP        20      /* R1 */
+#define MMC_SEND_TUNING_BLOCK_HS200     21      /* R1 */
 #define MMC_SET_BLOCK_COUNT             23      /* R1 */
 #define MMC_WRITE_BLOCK_SINGLE          24      /* R1 */
 #define MMC_WRITE_BLOCK_MULTIPLE        25      /* R1 */
@@ -226,6 +227,8 @@ extern "C" {
 #define EXT_CSD_CARD_TYPE_F_52M         (1 << 1)        /* SDR at "rated voltages */
 #define EXT_CSD_CARD_TYPE_F_52M_1_8V    (1 << 2)        /* DDR, 1.8V or 3.3V I/O */
 #define EXT_CSD_CARD_TYPE_F_52M_1_2V    (1 << 3)        /* DDR, 1.2V I/O */
+#define EXT_CSD_CARD_TYPE_F_HS200_1_8V  (1 << 4)        /* SDR 200MHz, 1.8V I/O */
+#define EXT_CSD_CARD_TYPE_F_HS200_1_2V  (1 << 5)        /* SDR 200MHz, 1.2V I/O */
 #define EXT_CSD_CARD_TYPE_26M           0x01
 #define EXT_CSD_CARD_TYPE_52M           0x03
 #define EXT_CSD_CARD_TYPE_52M_V18       0x07
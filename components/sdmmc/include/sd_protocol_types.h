@@ -67,7 +67,8 @@ typedef struct {
     uint32_t sd_spec: 4;            /*!< SD Physical layer specification version, reported by card */
     uint32_t erase_mem_state: 1;    /*!< data state on card after erase whether 0 or 1 (card vendor dependent) */
     uint32_t bus_width: 4;          /*!< bus widths supported by card: BIT(0) — 1-bit bus, BIT(2) — 4-bit bus */
-    uint32_t reserved: 23;          /*!< reserved for future expansion */
+    uint32_t cmd23_support: 1;      /*!< card supports SET_BLOCK_COUNT (CMD23) */
+    uint32_t reserved: 22;          /*!< reserved for future expansion */
     uint32_t rsvd_mnf;              /*!< reserved for manufacturer usage */
 } sdmmc_scr_t;
 
@@ -146,6 +147,7 @@ typedef struct {
 #define SCF_RSP_R7       (SCF_RSP_PRESENT|SCF_RSP_CRC|SCF_RSP_IDX)
     /* special flags */
 #define SCF_WAIT_BUSY    0x2000     /*!< Wait for completion of card busy signal before returning */
+#define SCF_NO_AUTO_STOP 0x4000     /*!< Transfer is pre-sized with SET_BLOCK_COUNT (CMD23), host must not send auto CMD12 */
     /** @endcond */
     esp_err_t error;            /*!< error returned from transfer */
     uint32_t timeout_ms;        /*!< response timeout, in milliseconds */
@@ -254,7 +256,8 @@ typedef struct {
     uint32_t log_bus_width : 2; /*!< log2(bus width supported by card) */
     uint32_t is_ddr : 1;        /*!< Card supports DDR mode */
     uint32_t is_uhs1 : 1;       /*!< Card supports UHS-1 mode */
-    uint32_t reserved : 22;     /*!< Reserved for future expansion */
+    uint32_t is_hs200 : 1;      /*!< Card is switched to HS200 timing */
+    uint32_t reserved : 21;     /*!< Reserved for future expansion */
 } sdmmc_card_t;
 
 /**
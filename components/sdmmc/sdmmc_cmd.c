@@ -444,6 +444,30 @@ esp_err_t sdmmc_send_cmd_num_of_written_blocks(sdmmc_card_t* card, size_t* out_n
     return err;
 }
 
+#if CONFIG_SD_ENABLE_CMD23_MULTIBLOCK
+static bool sdmmc_can_use_cmd23(sdmmc_card_t* card, size_t block_count)
+{
+    if (host_is_spi(card)) {
+        return false;
+    }
+    /* CMD23 argument carries the block count in bits [15:0] */
+    if (block_count > UINT16_MAX) {
+        return false;
+    }
+    return card->is_mmc || card->scr.cmd23_support;
+}
+
+static esp_err_t sdmmc_send_cmd_set_block_count(sdmmc_card_t* card, size_t block_count)
+{
+    sdmmc_command_t cmd = {
+            .opcode = MMC_SET_BLOCK_COUNT,
+            .arg = block_count,
+            .flags = SCF_CMD_AC | SCF_RSP_R1,
+    };
+    return sdmmc_send_cmd(card, &cmd);
+}
+#endif // CONFIG_SD_ENABLE_CMD23_MULTIBLOCK
+
 esp_err_t sdmmc_write_sectors(sdmmc_card_t* card, const void* src,
         size_t start_block, size_t block_count)
 {
@@ -511,6 +535,14 @@ esp_err_t sdmmc_write_sectors_dma(sdmmc_card_t* card, const void* src,
         cmd.opcode = MMC_WRITE_BLOCK_SINGLE;
     } else {
         cmd.opcode = MMC_WRITE_BLOCK_MULTIPLE;
+#if CONFIG_SD_ENABLE_CMD23_MULTIBLOCK
+        /* Pre-size the transfer so it ends without CMD12; if CMD23 fails,
+         * fall back to an open-ended transfer with auto stop */
+        if (sdmmc_can_use_cmd23(card, block_count) &&
+                sdmmc_send_cmd_set_block_count(card, block_count) == ESP_OK) {
+            cmd.flags |= SCF_NO_AUTO_STOP;
+        }
+#endif
     }
     if (card->ocr & SD_OCR_SDHC_CAP) {
         cmd.arg = start_block;
@@ -646,6 +678,12 @@ esp_err_t sdmmc_read_sectors_dma(sdmmc_card_t* card, void* dst,
         cmd.opcode = MMC_READ_BLOCK_SINGLE;
     } else {
         cmd.opcode = MMC_READ_BLOCK_MULTIPLE;
+#if CONFIG_SD_ENABLE_CMD23_MULTIBLOCK
+        if (sdmmc_can_use_cmd23(card, block_count) &&
+                sdmmc_send_cmd_set_block_count(card, block_count) == ESP_OK) {
+            cmd.flags |= SCF_NO_AUTO_STOP;
+        }
+#endif
     }
     if (card->ocr & SD_OCR_SDHC_CAP) {
         cmd.arg = start_block;
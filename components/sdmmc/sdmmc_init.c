@@ -171,12 +171,18 @@ esp_err_t sdmmc_card_init(const sdmmc_host_t* config, sdmmc_card_t* card)
     /* SD card: read SD Status register */
     SDMMC_INIT_STEP(is_sdmem, sdmmc_init_sd_ssr);
 
+    /* eMMC: switch to HS200 timing before raising the bus frequency. */
+    SDMMC_INIT_STEP(is_mmc && !is_spi, sdmmc_init_mmc_hs200);
+
     /* Switch to the host to use card->max_freq_khz frequency. */
     SDMMC_INIT_STEP(always, sdmmc_init_host_frequency);
 
     /* Timing tuning */
     SDMMC_INIT_STEP(is_uhs1, sdmmc_init_sd_timing_tuning);
 
+    /* eMMC: HS200 timing tuning, falls back to HS mode if tuning fails. */
+    SDMMC_INIT_STEP(is_mmc && !is_spi, sdmmc_init_mmc_hs200_tuning);
+
     /* Sanity check after switching the bus mode and frequency */
     SDMMC_INIT_STEP(is_sdmem, sdmmc_check_scr);
     /* Sanity check after eMMC switch to HS mode */
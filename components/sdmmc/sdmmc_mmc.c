@@ -50,11 +50,20 @@ esp_err_t sdmmc_init_mmc_read_ext_csd(sdmmc_card_t* card)
     }
     card_type = ext_csd[EXT_CSD_CARD_TYPE];
     card->is_ddr = 0;
-    if (card_type & EXT_CSD_CARD_TYPE_F_52M_1_8V) {
+    card->is_hs200 = 0;
+    if ((card_type & EXT_CSD_CARD_TYPE_F_HS200_1_8V) &&
+            card->host.max_freq_khz >= SDMMC_FREQ_SDR104 &&
+            (card->host.flags & (SDMMC_HOST_FLAG_4BIT | SDMMC_HOST_FLAG_8BIT)) &&
+            card->host.set_input_delay != NULL) {
+        ESP_LOGD(TAG, "card and host support HS200 mode");
+        card->max_freq_khz = SDMMC_FREQ_SDR104;
+        card->is_hs200 = 1;
+    } else if (card_type & EXT_CSD_CARD_TYPE_F_52M_1_8V) {
         card->max_freq_khz = SDMMC_FREQ_52M;
+        int host_bus_width = card->host.get_bus_width(card->host.slot);
         if ((card->host.flags & SDMMC_HOST_FLAG_DDR) &&
                 card->host.max_freq_khz >= SDMMC_FREQ_26M &&
-                card->host.get_bus_width(card->host.slot) == 4) {
+                (host_bus_width == 4 || host_bus_width == 8)) {
             ESP_LOGD(TAG, "card and host support DDR mode");
             card->is_ddr = 1;
         }
@@ -160,6 +169,66 @@ esp_err_t sdmmc_mmc_enable_hs_mode(sdmmc_card_t* card)
     return ESP_OK;
 }
 
+esp_err_t sdmmc_init_mmc_hs200(sdmmc_card_t* card)
+{
+    if (!card->is_hs200) {
+        return ESP_OK;
+    }
+    /* Bus width has already been set to 4 or 8 bit at this point; HS200
+     * timing is not allowed on a 1-line bus. The bus clock is still low here,
+     * it is raised by sdmmc_init_host_frequency afterwards.
+     */
+    esp_err_t err = sdmmc_mmc_switch(card, EXT_CSD_CMD_SET_NORMAL,
+            EXT_CSD_HS_TIMING, EXT_CSD_HS_TIMING_HS200);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "%s: HS200 timing switch failed (0x%x), staying in HS mode",
+                __func__, err);
+        card->is_hs200 = 0;
+        card->max_freq_khz = MIN(SDMMC_FREQ_52M, card->host.max_freq_khz);
+        card->csd.tr_speed = card->max_freq_khz * 1000;
+    }
+    return ESP_OK;
+}
+
+esp_err_t sdmmc_init_mmc_hs200_tuning(sdmmc_card_t* card)
+{
+    if (!card->is_hs200) {
+        return ESP_OK;
+    }
+    esp_err_t err = sdmmc_do_timing_tuning(card, SDMMC_DELAY_MODE_PHASE);
+    if (err == ESP_OK && card->host.max_freq_khz == SDMMC_FREQ_SDR104 &&
+            card->host.set_input_delayline != NULL) {
+        err = sdmmc_do_timing_tuning(card, SDMMC_DELAY_MODE_LINE);
+    }
+    if (err == ESP_OK) {
+        return ESP_OK;
+    }
+    ESP_LOGW(TAG, "%s: tuning failed (0x%x), falling back to HS mode", __func__, err);
+    /* drop the bus clock first so that the switch back to HS timing
+     * goes through with untuned sampling */
+    err = (*card->host.set_card_clk)(card->host.slot, SDMMC_FREQ_52M);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "failed to switch bus frequency (0x%x)", err);
+        return err;
+    }
+    err = sdmmc_mmc_switch(card, EXT_CSD_CMD_SET_NORMAL,
+            EXT_CSD_HS_TIMING, EXT_CSD_HS_TIMING_HS);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s: mmc_switch EXT_CSD_HS_TIMING_HS error 0x%x",
+                __func__, err);
+        return err;
+    }
+    card->is_hs200 = 0;
+    card->max_freq_khz = MIN(SDMMC_FREQ_52M, card->host.max_freq_khz);
+    card->csd.tr_speed = card->max_freq_khz * 1000;
+    err = (*card->host.get_real_freq)(card->host.slot, &(card->real_freq_khz));
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "failed to get real working frequency (0x%x)", err);
+        return err;
+    }
+    return ESP_OK;
+}
+
 esp_err_t sdmmc_mmc_decode_cid(int mmc_ver, sdmmc_response_t resp, sdmmc_cid_t* out_cid)
 {
     if (mmc_ver == MMC_CSD_MMCVER_1_0 ||
@@ -331,6 +331,26 @@ static const uint8_t s_tuning_block_pattern[] = {
 	0xbb, 0xff, 0xf7, 0xff, 0xf7, 0x7f, 0x7b, 0xde,
 };
 
+/* Pattern sent by an eMMC card in response to CMD21 on an 8-bit bus */
+static const uint8_t s_tuning_block_pattern_8bit[] = {
+	0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xff, 0xff, 0xcc, 0xcc, 0xcc, 0x33, 0xcc, 0xcc,
+	0xcc, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xff, 0xff,
+	0xff, 0xee, 0xff, 0xff, 0xff, 0xee, 0xee, 0xff,
+	0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xdd, 0xdd,
+	0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xbb,
+	0xbb, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff,
+	0x77, 0x77, 0xff, 0x77, 0xbb, 0xdd, 0xee, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0x33, 0xcc,
+	0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xff,
+	0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xee, 0xee,
+	0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xdd,
+	0xdd, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff,
+	0xbb, 0xbb, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff,
+	0xff, 0x77, 0x77, 0xff, 0x77, 0xbb, 0xdd, 0xee,
+};
+
 /**
  * Find consecutive successful sampling points.
  * e.g. array: {1, 1, 0, 0, 1, 1, 1, 0}
@@ -373,14 +393,24 @@ static void find_max_consecutive_success_points(int *array, size_t size, size_t
 static esp_err_t read_tuning_block(sdmmc_card_t *card)
 {
     esp_err_t ret = ESP_FAIL;
+    const uint8_t *pattern = s_tuning_block_pattern;
     size_t tuning_block_size = sizeof(s_tuning_block_pattern);
+    uint32_t opcode = MMC_SEND_TUNING_BLOCK;
+    if (card->is_mmc) {
+        /* eMMC HS200 tuning uses CMD21; on an 8-bit bus the card sends the longer pattern */
+        opcode = MMC_SEND_TUNING_BLOCK_HS200;
+        if (card->log_bus_width == 3) {
+            pattern = s_tuning_block_pattern_8bit;
+            tuning_block_size = sizeof(s_tuning_block_pattern_8bit);
+        }
+    }
     ESP_LOGV(TAG, "tuning_block_size: %zu", tuning_block_size);
     uint8_t *databuf = NULL;
     databuf = heap_caps_calloc(1, tuning_block_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
     ESP_RETURN_ON_FALSE(databuf, ESP_ERR_NO_MEM, TAG, "no mem for tuning block databuf");
 
     sdmmc_command_t cmd = {
-        .opcode = MMC_SEND_TUNING_BLOCK,
+        .opcode = opcode,
         .flags = SCF_CMD_ADTC | SCF_CMD_READ | SCF_RSP_R1,
         .blklen = tuning_block_size,
         .data = (void *) databuf,
@@ -420,7 +450,7 @@ static esp_err_t read_tuning_block(sdmmc_card_t *card)
     }
 
     bool success = false;
-    if (memcmp(s_tuning_block_pattern, databuf, tuning_block_size) == 0) {
+    if (memcmp(pattern, databuf, tuning_block_size) == 0) {
         success = true;
     }
 
@@ -715,6 +745,7 @@ esp_err_t sdmmc_decode_scr(uint32_t *raw_scr, sdmmc_scr_t* out_scr)
     out_scr->sd_spec = SCR_SD_SPEC(resp);
     out_scr->erase_mem_state = SCR_DATA_STAT_AFTER_ERASE(resp);
     out_scr->bus_width = SCR_SD_BUS_WIDTHS(resp);
+    out_scr->cmd23_support = SCR_CMD_SUPPORT_CMD23(resp);
     return ESP_OK;
 }
 
@@ -305,6 +305,7 @@
 
 /*-------------------------- PCNT CAPS ---------------------------------------*/
 #define SOC_PCNT_SUPPORT_RUNTIME_THRES_UPDATE 1
+#define SOC_PCNT_SUPPORT_ETM                  1
 
 /*--------------------------- RMT CAPS ---------------------------------------*/
 #define SOC_RMT_MEM_WORDS_PER_CHANNEL         48 /*!< Each channel owns 48 words memory (1 word = 4 Bytes) */
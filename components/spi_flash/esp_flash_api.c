@@ -30,6 +30,10 @@
 #include "esp_crypto_lock.h" // for locking flash encryption peripheral
 #endif //CONFIG_IDF_TARGET_ESP32S2
 
+#if CONFIG_SPI_FLASH_READ_CACHE
+#include "esp_private/spi_flash_read_cache.h"
+#endif
+
 DRAM_ATTR static const char TAG[] = "spi_flash";
 
 #ifdef CONFIG_SPI_FLASH_WRITE_CHUNK_SIZE
@@ -77,11 +81,24 @@ DRAM_ATTR static const char TAG[] = "spi_flash";
 #if CONFIG_SPI_FLASH_ENABLE_COUNTERS
 static esp_flash_counters_t esp_flash_stats;
 
+// log2 bucket index: 0-1 us -> 0, 2-3 us -> 1, 4-7 us -> 2, ...
+// capped at the last bucket
+static inline uint32_t counter_hist_idx(uint32_t time_us)
+{
+    uint32_t idx = 31 - __builtin_clz(time_us | 1);
+    return MIN(idx, ESP_FLASH_COUNTERS_HIST_BUCKETS - 1);
+}
+
 #define COUNTER_START()     uint32_t ts_begin = esp_cpu_get_cycle_count()
 #define COUNTER_STOP(counter)  \
     do{ \
+        uint32_t time_us = (esp_cpu_get_cycle_count() - ts_begin) / (esp_clk_cpu_freq() / 1000000); \
         esp_flash_stats.counter.count++; \
-        esp_flash_stats.counter.time += (esp_cpu_get_cycle_count() - ts_begin) / (esp_clk_cpu_freq() / 1000000); \
+        esp_flash_stats.counter.time += time_us; \
+        esp_flash_stats.counter.time_hist[counter_hist_idx(time_us)]++; \
+        if (time_us > esp_flash_stats.counter.time_max) { \
+            esp_flash_stats.counter.time_max = time_us; \
+        } \
     } while(0)
 
 #define COUNTER_ADD_BYTES(counter, size) \
@@ -96,17 +113,50 @@ const esp_flash_counters_t *esp_flash_get_counters(void)
     return &esp_flash_stats;
 }
 
+uint32_t esp_flash_counter_time_percentile(const esp_flash_counter_t *counter, uint32_t percentile)
+{
+    if (counter == NULL || counter->count == 0 || percentile == 0 || percentile > 100) {
+        return 0;
+    }
+    // number of operations at or below the requested percentile, rounded up
+    uint64_t threshold = ((uint64_t) counter->count * percentile + 99) / 100;
+    uint64_t cumulative = 0;
+    for (uint32_t i = 0; i < ESP_FLASH_COUNTERS_HIST_BUCKETS; i++) {
+        cumulative += counter->time_hist[i];
+        if (cumulative >= threshold) {
+            if (i == ESP_FLASH_COUNTERS_HIST_BUCKETS - 1) {
+                // last bucket has no upper bound
+                return counter->time_max;
+            }
+            return (1UL << (i + 1)) - 1;
+        }
+    }
+    return counter->time_max;
+}
+
 void esp_flash_reset_counters(void)
 {
     memset(&esp_flash_stats, 0, sizeof(esp_flash_stats));
 }
 
+static void dump_one_counter(FILE* stream, const char* name, const esp_flash_counter_t* counter)
+{
+    fprintf(stream, "%s: count=%8ld  time=%8ldus  bytes=%8ld  max=%8ldus  p99=%8ldus\n",
+            name, counter->count, counter->time, counter->bytes,
+            counter->time_max, esp_flash_counter_time_percentile(counter, 99));
+    for (uint32_t i = 0; i < ESP_FLASH_COUNTERS_HIST_BUCKETS; i++) {
+        if (counter->time_hist[i] != 0) {
+            fprintf(stream, "       <%8ldus: %8ld\n", (1UL << (i + 1)) - 1, counter->time_hist[i]);
+        }
+    }
+}
+
 void esp_flash_dump_counters(FILE* stream)
 {
     if (stream != NULL) {
-        fprintf(stream, " read: count=%8ld  time=%8ldus  bytes=%8ld\n", esp_flash_stats.read.count, esp_flash_stats.read.time, esp_flash_stats.read.bytes);
-        fprintf(stream, "write: count=%8ld  time=%8ldus  bytes=%8ld\n", esp_flash_stats.write.count, esp_flash_stats.write.time, esp_flash_stats.write.bytes);
-        fprintf(stream, "erase: count=%8ld  time=%8ldus  bytes=%8ld\n", esp_flash_stats.erase.count, esp_flash_stats.erase.time, esp_flash_stats.erase.bytes);
+        dump_one_counter(stream, " read", &esp_flash_stats.read);
+        dump_one_counter(stream, "write", &esp_flash_stats.write);
+        dump_one_counter(stream, "erase", &esp_flash_stats.erase);
     }
 }
 
@@ -702,6 +752,10 @@ esp_err_t esp_flash_erase_region(esp_flash_t *chip, uint32_t start, uint32_t len
         if (chip->chip_drv->yield) {
             err = chip->chip_drv->yield(chip, 0);
             if (err != ESP_OK) {
+#if CONFIG_SPI_FLASH_READ_CACHE
+                // some sectors may have been erased already
+                spi_flash_read_cache_invalidate(chip, start, len);
+#endif
                 return err;
             }
         }
@@ -748,6 +802,9 @@ esp_err_t esp_flash_erase_region(esp_flash_t *chip, uint32_t start, uint32_t len
 
     COUNTER_STOP(erase);
 
+#if CONFIG_SPI_FLASH_READ_CACHE
+    spi_flash_read_cache_invalidate(chip, start, len);
+#endif
     return rom_spiflash_api_funcs->flash_end_flush_cache(chip, err, bus_acquired, start, len);
 }
 #else //!CONFIG_SPI_FLASH_ROM_IMPL
@@ -918,7 +975,17 @@ esp_err_t esp_flash_set_protected_region(esp_flash_t *chip, const esp_flash_regi
     return rom_spiflash_api_funcs->end(chip, err);
 }
 
+#if CONFIG_SPI_FLASH_READ_CACHE
 esp_err_t esp_flash_read(esp_flash_t *chip, void *buffer, uint32_t address, uint32_t length)
+{
+    return spi_flash_read_cache_read(chip, buffer, address, length);
+}
+#define ESP_FLASH_READ_IMPL esp_flash_read_uncached
+#else
+#define ESP_FLASH_READ_IMPL esp_flash_read
+#endif // CONFIG_SPI_FLASH_READ_CACHE
+
+esp_err_t ESP_FLASH_READ_IMPL(esp_flash_t *chip, void *buffer, uint32_t address, uint32_t length)
 {
     esp_err_t err = rom_spiflash_api_funcs->chip_check(&chip);
     VERIFY_CHIP_OP(read);
@@ -1155,6 +1222,10 @@ esp_err_t esp_flash_write(esp_flash_t *chip, const void *buffer, uint32_t addres
         if (chip->chip_drv->yield) {
             err = chip->chip_drv->yield(chip, 0);
             if (err != ESP_OK) {
+#if CONFIG_SPI_FLASH_READ_CACHE
+                // part of the region may have been written already
+                spi_flash_read_cache_invalidate(chip, address, length);
+#endif
                 return err;
             }
         }
@@ -1211,6 +1282,9 @@ esp_err_t esp_flash_write(esp_flash_t *chip, const void *buffer, uint32_t addres
     COUNTER_STOP(write);
     err = rom_spiflash_api_funcs->flash_end_flush_cache(chip, err, bus_acquired, address, length);
 
+#if CONFIG_SPI_FLASH_READ_CACHE
+    spi_flash_read_cache_invalidate(chip, address, length);
+#endif
     return err;
 
 restore_cache:
@@ -1220,6 +1294,9 @@ restore_cache:
        ESP_DRAM_LOGE(TAG, "restore cache fail\n");
     }
 
+#if CONFIG_SPI_FLASH_READ_CACHE
+    spi_flash_read_cache_invalidate(chip, address, length);
+#endif
     return err;
 }
 #else
@@ -1543,6 +1620,9 @@ esp_err_t esp_flash_write_encrypted(esp_flash_t *chip, uint32_t address, const v
     COUNTER_STOP(write);
     err = rom_spiflash_api_funcs->flash_end_flush_cache(chip, err, bus_acquired, address, length);
 
+#if CONFIG_SPI_FLASH_READ_CACHE
+    spi_flash_read_cache_invalidate(chip, address, length);
+#endif
     return err;
 
 restore_cache:
@@ -1554,6 +1634,9 @@ restore_cache:
        ESP_DRAM_LOGE(TAG, "restore cache fail\n");
     }
 
+#if CONFIG_SPI_FLASH_READ_CACHE
+    spi_flash_read_cache_invalidate(chip, address, length);
+#endif
     return err;
 }
 #else
@@ -0,0 +1,229 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_flash.h"
+#include "esp_flash_bg_erase.h"
+#include "spi_flash_mmap.h" // for SPI_FLASH_SEC_SIZE
+#include "spi_flash_chip_driver.h"
+
+static const char TAG[] = "bg_erase";
+
+/// Max number of operations waiting in the service queue
+#define BG_ERASE_QUEUE_DEPTH 8
+
+struct esp_flash_bg_erase_op_t {
+    esp_flash_t *chip;         // chip to erase, NULL for the main chip
+    uint32_t next_addr;        // address of the next slice
+    uint32_t bytes_remaining;  // updated by the worker after each slice
+    esp_err_t result;          // valid once 'done' was given
+    SemaphoreHandle_t done;    // given by the worker on completion
+    bool completed;
+};
+
+typedef struct {
+    esp_flash_bg_erase_config_t config;
+    QueueHandle_t op_queue;    // esp_flash_bg_erase_op_t* entries; NULL is the shutdown marker
+    SemaphoreHandle_t stopped; // given by the worker on shutdown
+    bool running;
+} bg_erase_service_t;
+
+static bg_erase_service_t s_service;
+static portMUX_TYPE s_service_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t slice_size_for_chip(esp_flash_t *chip)
+{
+    if (chip == NULL) {
+        chip = esp_flash_default_chip;
+    }
+    uint32_t sector_size = SPI_FLASH_SEC_SIZE;
+    if (chip != NULL && chip->chip_drv != NULL && chip->chip_drv->sector_size != 0) {
+        sector_size = chip->chip_drv->sector_size;
+    }
+    // round the configured slice up to a whole number of sectors
+    uint32_t slice = MAX(s_service.config.slice_size, sector_size);
+    return (slice / sector_size) * sector_size;
+}
+
+static void bg_erase_task(void *arg)
+{
+    (void) arg;
+    struct esp_flash_bg_erase_op_t *op;
+
+    while (true) {
+        if (xQueueReceive(s_service.op_queue, &op, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (op == NULL) { // shutdown marker
+            break;
+        }
+
+        const uint32_t slice_size = slice_size_for_chip(op->chip);
+        esp_err_t err = ESP_OK;
+        while (op->bytes_remaining > 0) {
+            uint32_t slice = MIN(slice_size, op->bytes_remaining);
+            // each slice is a regular synchronous erase: auto-suspend, power
+            // management locks and cache handling apply per slice
+            err = esp_flash_erase_region(op->chip, op->next_addr, slice);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "erase slice at 0x%" PRIx32 " failed: 0x%x", op->next_addr, err);
+                break;
+            }
+            portENTER_CRITICAL(&s_service_mux);
+            op->next_addr += slice;
+            op->bytes_remaining -= slice;
+            portEXIT_CRITICAL(&s_service_mux);
+
+            if (op->bytes_remaining > 0 && s_service.config.slice_interval_ms > 0) {
+                vTaskDelay(pdMS_TO_TICKS(s_service.config.slice_interval_ms));
+            }
+        }
+
+        portENTER_CRITICAL(&s_service_mux);
+        op->result = err;
+        op->completed = true;
+        portEXIT_CRITICAL(&s_service_mux);
+        xSemaphoreGive(op->done);
+    }
+    xSemaphoreGive(s_service.stopped);
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_flash_bg_erase_start_service(const esp_flash_bg_erase_config_t *config)
+{
+    if (config == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_service.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_service.config = *config;
+    s_service.op_queue = xQueueCreate(BG_ERASE_QUEUE_DEPTH, sizeof(struct esp_flash_bg_erase_op_t *));
+    s_service.stopped = xSemaphoreCreateBinary();
+    if (s_service.op_queue == NULL || s_service.stopped == NULL) {
+        goto fail;
+    }
+
+    if (xTaskCreatePinnedToCore(bg_erase_task, "flash_bg_erase", config->task_stack_size, NULL,
+                                config->task_priority, NULL,
+                                (config->core_id < 0) ? tskNO_AFFINITY : config->core_id) != pdPASS) {
+        goto fail;
+    }
+
+    s_service.running = true;
+    return ESP_OK;
+
+fail:
+    if (s_service.op_queue != NULL) {
+        vQueueDelete(s_service.op_queue);
+        s_service.op_queue = NULL;
+    }
+    if (s_service.stopped != NULL) {
+        vSemaphoreDelete(s_service.stopped);
+        s_service.stopped = NULL;
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t esp_flash_bg_erase_stop_service(void)
+{
+    if (!s_service.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // stop accepting new operations; queued ones finish before the marker
+    s_service.running = false;
+
+    struct esp_flash_bg_erase_op_t *marker = NULL;
+    while (xQueueSend(s_service.op_queue, &marker, portMAX_DELAY) != pdTRUE) { }
+    xSemaphoreTake(s_service.stopped, portMAX_DELAY);
+
+    vQueueDelete(s_service.op_queue);
+    s_service.op_queue = NULL;
+    vSemaphoreDelete(s_service.stopped);
+    s_service.stopped = NULL;
+    return ESP_OK;
+}
+
+esp_err_t esp_flash_bg_erase_submit(esp_flash_t *chip, uint32_t start, uint32_t len,
+                                    esp_flash_bg_erase_handle_t *out_handle)
+{
+    if (out_handle == NULL || len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_service.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    struct esp_flash_bg_erase_op_t *op = calloc(1, sizeof(*op));
+    if (op == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    op->chip = chip;
+    op->next_addr = start;
+    op->bytes_remaining = len;
+    op->done = xSemaphoreCreateBinary();
+    if (op->done == NULL) {
+        free(op);
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xQueueSend(s_service.op_queue, &op, 0) != pdTRUE) {
+        vSemaphoreDelete(op->done);
+        free(op);
+        return ESP_ERR_NO_MEM; // queue full, retry after some operations completed
+    }
+    *out_handle = op;
+    return ESP_OK;
+}
+
+esp_err_t esp_flash_bg_erase_wait(esp_flash_bg_erase_handle_t handle, uint32_t timeout_ms)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    TickType_t ticks = (timeout_ms == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTake(handle->done, ticks) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    // give the token back so that further waiters return immediately
+    xSemaphoreGive(handle->done);
+    return handle->result;
+}
+
+esp_err_t esp_flash_bg_erase_get_progress(esp_flash_bg_erase_handle_t handle, uint32_t *out_bytes_remaining)
+{
+    if (handle == NULL || out_bytes_remaining == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_service_mux);
+    *out_bytes_remaining = handle->bytes_remaining;
+    portEXIT_CRITICAL(&s_service_mux);
+    return ESP_OK;
+}
+
+esp_err_t esp_flash_bg_erase_release(esp_flash_bg_erase_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_service_mux);
+    bool completed = handle->completed;
+    portEXIT_CRITICAL(&s_service_mux);
+    if (!completed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    vSemaphoreDelete(handle->done);
+    free(handle);
+    return ESP_OK;
+}
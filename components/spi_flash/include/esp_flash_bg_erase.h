@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_flash.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_SPI_FLASH_BG_ERASE || defined __DOXYGEN__
+
+/*
+ * Background erase service: erase regions are queued and processed by a
+ * low-priority task in small slices (one or a few sectors per call into
+ * esp_flash_erase_region), with a configurable pause between slices. Every
+ * slice goes through the regular esp_flash path, so auto-suspend, power
+ * management locks and cache handling apply per slice; the foreground only
+ * ever sees the cache-disabled window of a single slice instead of the
+ * whole region. Intended for TRIM-style maintenance erases from FATFS or
+ * SPIFFS which don't have to complete synchronously.
+ */
+
+/**
+ * @brief Handle of one queued erase operation
+ */
+typedef struct esp_flash_bg_erase_op_t *esp_flash_bg_erase_handle_t;
+
+/**
+ * @brief Configuration of the background erase service
+ */
+typedef struct {
+    uint32_t task_priority;    /*!< Priority of the erase task, usually low (below the tasks it must not disturb) */
+    uint32_t task_stack_size;  /*!< Stack size of the erase task, in bytes */
+    int core_id;               /*!< Core the erase task is pinned to, or -1 for no affinity */
+    uint32_t slice_interval_ms; /*!< Pause between erase slices, gives foreground tasks and power management room */
+    uint32_t slice_size;       /*!< Bytes erased per slice; rounded up to the sector size, 0 means one sector */
+} esp_flash_bg_erase_config_t;
+
+#define ESP_FLASH_BG_ERASE_CONFIG_DEFAULT() { \
+    .task_priority = 1, \
+    .task_stack_size = 3072, \
+    .core_id = -1, \
+    .slice_interval_ms = 2, \
+    .slice_size = 0, \
+}
+
+/**
+ * @brief Start the background erase service
+ *
+ * @param config Service configuration
+ * @return
+ *      - ESP_OK: service started
+ *      - ESP_ERR_INVALID_ARG: config is NULL
+ *      - ESP_ERR_INVALID_STATE: service is already running
+ *      - ESP_ERR_NO_MEM: out of memory
+ */
+esp_err_t esp_flash_bg_erase_start_service(const esp_flash_bg_erase_config_t *config);
+
+/**
+ * @brief Stop the background erase service
+ *
+ * Waits for all queued operations to finish first. Handles of finished
+ * operations stay valid and must still be released.
+ *
+ * @return
+ *      - ESP_OK: service stopped
+ *      - ESP_ERR_INVALID_STATE: service is not running
+ */
+esp_err_t esp_flash_bg_erase_stop_service(void);
+
+/**
+ * @brief Queue a region for background erasing
+ *
+ * Alignment requirements are the same as for esp_flash_erase_region: start
+ * and length must be multiples of the sector size. The region must not be
+ * read or written until the operation completed.
+ *
+ * @param chip Pointer to the chip to erase, or NULL for the main flash chip
+ * @param start Address where the erase region starts, relative to the start of the chip
+ * @param len Length of the region to erase, in bytes
+ * @param[out] out_handle Handle used to wait for and release the operation
+ * @return
+ *      - ESP_OK: operation queued
+ *      - ESP_ERR_INVALID_ARG: out_handle is NULL or len is 0
+ *      - ESP_ERR_INVALID_STATE: service is not running
+ *      - ESP_ERR_NO_MEM: out of memory or queue full
+ */
+esp_err_t esp_flash_bg_erase_submit(esp_flash_t *chip, uint32_t start, uint32_t len,
+                                    esp_flash_bg_erase_handle_t *out_handle);
+
+/**
+ * @brief Wait until an operation completed and get its result
+ *
+ * Can be called repeatedly, also after completion.
+ *
+ * @param handle Handle returned by esp_flash_bg_erase_submit
+ * @param timeout_ms Maximum time to wait, in milliseconds; UINT32_MAX to wait forever
+ * @return
+ *      - ESP_ERR_TIMEOUT: operation did not complete within the timeout
+ *      - ESP_ERR_INVALID_ARG: handle is NULL
+ *      - otherwise: result of the erase (ESP_OK on success)
+ */
+esp_err_t esp_flash_bg_erase_wait(esp_flash_bg_erase_handle_t handle, uint32_t timeout_ms);
+
+/**
+ * @brief Get the number of bytes not erased yet
+ *
+ * @param handle Handle returned by esp_flash_bg_erase_submit
+ * @param[out] out_bytes_remaining Bytes still to erase; 0 once the operation completed
+ * @return
+ *      - ESP_OK: progress returned
+ *      - ESP_ERR_INVALID_ARG: an argument is NULL
+ */
+esp_err_t esp_flash_bg_erase_get_progress(esp_flash_bg_erase_handle_t handle, uint32_t *out_bytes_remaining);
+
+/**
+ * @brief Release the handle of a completed operation
+ *
+ * @param handle Handle returned by esp_flash_bg_erase_submit
+ * @return
+ *      - ESP_OK: handle released
+ *      - ESP_ERR_INVALID_ARG: handle is NULL
+ *      - ESP_ERR_INVALID_STATE: the operation is still pending
+ */
+esp_err_t esp_flash_bg_erase_release(esp_flash_bg_erase_handle_t handle);
+
+#endif // CONFIG_SPI_FLASH_BG_ERASE || defined __DOXYGEN__
+
+#ifdef __cplusplus
+}
+#endif
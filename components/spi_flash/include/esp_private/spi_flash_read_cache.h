@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_flash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Internal interface of the esp_flash read cache (CONFIG_SPI_FLASH_READ_CACHE).
+ *
+ * The cache keeps recently read flash sectors in internal RAM so that small
+ * repeated reads (typically filesystem metadata) are served without a flash
+ * transaction and without suspending the cache/XIP on shared-bus targets.
+ * Writes and erases going through the esp_flash API invalidate overlapping
+ * cache lines; writes bypassing the esp_flash API are not tracked.
+ */
+
+/**
+ * @brief Read directly from flash, bypassing the read cache
+ *
+ * This is the original esp_flash_read() implementation; the cache uses it to
+ * fill lines and falls back to it for reads that should not be cached.
+ */
+esp_err_t esp_flash_read_uncached(esp_flash_t *chip, void *buffer, uint32_t address, uint32_t length);
+
+/**
+ * @brief Serve a read through the cache, filling lines on miss
+ *
+ * Reads of a full sector or more bypass the cache. Arguments are validated by
+ * the underlying uncached read.
+ */
+esp_err_t spi_flash_read_cache_read(esp_flash_t *chip, void *buffer, uint32_t address, uint32_t length);
+
+/**
+ * @brief Drop cache lines overlapping the given region of the chip
+ *
+ * Called by esp_flash_write()/esp_flash_write_encrypted()/esp_flash_erase_region()
+ * after the flash content changed. @p chip may be NULL for the default chip.
+ */
+void spi_flash_read_cache_invalidate(esp_flash_t *chip, uint32_t address, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
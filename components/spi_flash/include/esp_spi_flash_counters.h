@@ -17,6 +17,13 @@
 extern "C" {
 #endif
 
+/**
+ * Number of latency histogram buckets. Bucket N counts operations which took
+ * [2^N, 2^(N+1)) microseconds, except the first bucket which starts at 0 and
+ * the last bucket which has no upper bound.
+ */
+#define ESP_FLASH_COUNTERS_HIST_BUCKETS 20
+
 /**
  * Structure holding statistics for one type of operation
  */
@@ -24,6 +31,8 @@ typedef struct {
     uint32_t count;     /*!< number of times operation was executed */
     uint32_t time;      /*!< total time taken, in microseconds */
     uint32_t bytes;     /*!< total number of bytes */
+    uint32_t time_max;  /*!< longest single operation, in microseconds */
+    uint32_t time_hist[ESP_FLASH_COUNTERS_HIST_BUCKETS]; /*!< latency histogram, log2 buckets in microseconds */
 } esp_flash_counter_t;
 
 /**
@@ -53,6 +62,19 @@ void esp_flash_dump_counters(FILE* stream);
  */
 const esp_flash_counters_t* esp_flash_get_counters(void);
 
+/**
+ * @brief  Return a latency percentile for one operation type
+ *
+ * Computed from the log2 histogram, so the result is the upper bound of the
+ * bucket the percentile falls into (time_max is returned for the last
+ * bucket). Typical use: esp_flash_counter_time_percentile(&esp_flash_get_counters()->erase, 99)
+ *
+ * @param counter one of the counters returned by esp_flash_get_counters()
+ * @param percentile requested percentile, 1 to 100
+ * @return latency in microseconds, or 0 if no operation was recorded
+ */
+uint32_t esp_flash_counter_time_percentile(const esp_flash_counter_t *counter, uint32_t percentile);
+
 #ifdef __cplusplus
 }
 #endif
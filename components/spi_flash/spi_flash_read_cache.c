@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/lock.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_private/spi_flash_read_cache.h"
+
+/*
+ * Small fully-associative sector cache in front of esp_flash_read().
+ *
+ * Filesystem metadata sectors are re-read over and over with small reads;
+ * each of those reads is a separate flash transaction and, on shared-bus
+ * targets, a cache/XIP suspension window. A miss fills the whole enclosing
+ * sector in one transaction (the read-ahead), after which repeated small
+ * reads of that sector are served from RAM. Reads of a full sector or more
+ * bypass the cache so large sequential reads cannot thrash it.
+ */
+
+#define READ_CACHE_LINE_SIZE    4096
+#define READ_CACHE_NUM_LINES    (CONFIG_SPI_FLASH_READ_CACHE_SIZE / READ_CACHE_LINE_SIZE)
+
+typedef struct {
+    esp_flash_t *chip;
+    uint32_t address;       // sector-aligned address of the cached data
+    uint32_t last_use;      // LRU tick of the last hit or fill
+    bool valid;
+    uint8_t *data;
+} read_cache_line_t;
+
+static read_cache_line_t s_lines[READ_CACHE_NUM_LINES];
+static uint32_t s_use_tick;
+static bool s_alloc_failed;
+static _lock_t s_cache_lock;
+
+static const char *TAG = "flash_rcache";
+
+// Line buffers are allocated from the internal heap on first use; if that
+// fails once, the cache stays disabled and all reads go straight to flash.
+// Called with s_cache_lock taken.
+static bool read_cache_ensure_buffers(void)
+{
+    if (s_lines[0].data != NULL) {
+        return true;
+    }
+    if (s_alloc_failed) {
+        return false;
+    }
+    uint8_t *pool = heap_caps_malloc(READ_CACHE_NUM_LINES * READ_CACHE_LINE_SIZE,
+                                     MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (pool == NULL) {
+        ESP_LOGW(TAG, "No memory for read cache, falling back to uncached reads");
+        s_alloc_failed = true;
+        return false;
+    }
+    for (int i = 0; i < READ_CACHE_NUM_LINES; i++) {
+        s_lines[i].data = pool + i * READ_CACHE_LINE_SIZE;
+    }
+    return true;
+}
+
+// Called with s_cache_lock taken
+static read_cache_line_t *read_cache_find(esp_flash_t *chip, uint32_t address)
+{
+    for (int i = 0; i < READ_CACHE_NUM_LINES; i++) {
+        if (s_lines[i].valid && s_lines[i].chip == chip && s_lines[i].address == address) {
+            return &s_lines[i];
+        }
+    }
+    return NULL;
+}
+
+// Called with s_cache_lock taken; the lock is held across the fill so a
+// concurrent write/erase invalidation is ordered after the fill completes
+// (writes invalidate after the flash content changed, which drops any line
+// filled while the change was in progress).
+static read_cache_line_t *read_cache_fill(esp_flash_t *chip, uint32_t address, esp_err_t *out_err)
+{
+    read_cache_line_t *victim = &s_lines[0];
+    for (int i = 1; i < READ_CACHE_NUM_LINES; i++) {
+        if (!s_lines[i].valid) {
+            victim = &s_lines[i];
+            break;
+        }
+        if (s_lines[i].last_use < victim->last_use) {
+            victim = &s_lines[i];
+        }
+    }
+    victim->valid = false;
+    *out_err = esp_flash_read_uncached(chip, victim->data, address, READ_CACHE_LINE_SIZE);
+    if (*out_err != ESP_OK) {
+        return NULL;
+    }
+    victim->chip = chip;
+    victim->address = address;
+    victim->valid = true;
+    return victim;
+}
+
+esp_err_t spi_flash_read_cache_read(esp_flash_t *chip, void *buffer, uint32_t address, uint32_t length)
+{
+    if (chip == NULL) {
+        chip = esp_flash_default_chip;
+    }
+    // Large reads bypass the cache; delegate anything the uncached path would
+    // reject to it as well, so argument checking stays in one place
+    if (length >= READ_CACHE_LINE_SIZE || length == 0 ||
+            chip == NULL || buffer == NULL ||
+            address > chip->size || address + length > chip->size) {
+        return esp_flash_read_uncached(chip, buffer, address, length);
+    }
+
+    esp_err_t err = ESP_OK;
+    _lock_acquire(&s_cache_lock);
+    if (!read_cache_ensure_buffers()) {
+        _lock_release(&s_cache_lock);
+        return esp_flash_read_uncached(chip, buffer, address, length);
+    }
+    uint8_t *dst = (uint8_t *) buffer;
+    while (length > 0) {
+        uint32_t line_addr = address & ~(READ_CACHE_LINE_SIZE - 1);
+        uint32_t offset = address - line_addr;
+        uint32_t chunk = MIN(length, READ_CACHE_LINE_SIZE - offset);
+
+        read_cache_line_t *line = read_cache_find(chip, line_addr);
+        if (line == NULL) {
+            line = read_cache_fill(chip, line_addr, &err);
+            if (line == NULL) {
+                break;
+            }
+        }
+        line->last_use = ++s_use_tick;
+        memcpy(dst, line->data + offset, chunk);
+
+        dst += chunk;
+        address += chunk;
+        length -= chunk;
+    }
+    _lock_release(&s_cache_lock);
+    return err;
+}
+
+void spi_flash_read_cache_invalidate(esp_flash_t *chip, uint32_t address, uint32_t length)
+{
+    if (chip == NULL) {
+        chip = esp_flash_default_chip;
+    }
+    _lock_acquire(&s_cache_lock);
+    for (int i = 0; i < READ_CACHE_NUM_LINES; i++) {
+        read_cache_line_t *line = &s_lines[i];
+        if (line->valid && line->chip == chip &&
+                line->address < address + length &&
+                address < line->address + READ_CACHE_LINE_SIZE) {
+            line->valid = false;
+        }
+    }
+    _lock_release(&s_cache_lock);
+}
@@ -21,6 +21,7 @@
 #include <sys/lock.h>
 #include "esp_vfs.h"
 #include "esp_err.h"
+#include "esp_timer.h"
 #include "esp_rom_spiflash.h"
 
 #include "spiffs_api.h"
@@ -92,6 +93,9 @@ static void esp_spiffs_free(esp_spiffs_t ** efs)
     }
     *efs = NULL;
 
+#ifdef CONFIG_SPIFFS_META_CACHE
+    esp_spiffs_meta_cache_detach(e);
+#endif
     if (e->fs) {
         SPIFFS_unmount(e->fs);
         free(e->fs);
@@ -287,10 +291,27 @@ static esp_err_t esp_spiffs_init(const esp_vfs_spiffs_conf_t* conf)
         esp_spiffs_free(&efs);
         return ESP_FAIL;
     }
+#ifdef CONFIG_SPIFFS_META_CACHE
+    // best effort: without the cache everything still works, just slower
+    if (esp_spiffs_meta_cache_attach(efs) != ESP_OK) {
+        ESP_LOGW(TAG, "metadata cache could not be allocated");
+    }
+#endif
     _efs[index] = efs;
     return ESP_OK;
 }
 
+#ifdef CONFIG_SPIFFS_META_CACHE
+esp_spiffs_t *esp_spiffs_get_by_label(const char* label)
+{
+    int index;
+    if (esp_spiffs_by_label(label, &index) != ESP_OK) {
+        return NULL;
+    }
+    return _efs[index];
+}
+#endif
+
 bool esp_spiffs_mounted(const char* partition_label)
 {
     int index;
@@ -376,6 +397,9 @@ esp_err_t esp_spiffs_format(const char* partition_label)
             SPIFFS_clearerr(_efs[index]->fs);
             return ESP_FAIL;
         }
+#ifdef CONFIG_SPIFFS_META_CACHE
+        esp_spiffs_meta_cache_invalidate(_efs[index], NULL);
+#endif
     } else {
         esp_spiffs_free(&_efs[index]);
     }
@@ -400,6 +424,83 @@ esp_err_t esp_spiffs_gc(const char* partition_label, size_t size_to_gc)
     return ESP_OK;
 }
 
+esp_err_t esp_spiffs_gc_step(const char* partition_label, uint32_t max_us)
+{
+    int index;
+    if (esp_spiffs_by_label(partition_label, &index) != ESP_OK) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    spiffs *fs = _efs[index]->fs;
+    const int64_t deadline = esp_timer_get_time() + max_us;
+
+    // Deleted pages are the only thing GC can turn back into free space
+    while (fs->stats_p_deleted > 0) {
+        if (esp_timer_get_time() >= deadline) {
+            return ESP_ERR_NOT_FINISHED;
+        }
+        u32_t deleted_before = fs->stats_p_deleted;
+        // Cheap pass first: erase blocks which contain only deleted pages
+        s32_t res = SPIFFS_gc_quick(fs, 0);
+        if (res == SPIFFS_OK) {
+            continue;
+        }
+        if (SPIFFS_errno(fs) != SPIFFS_ERR_NO_DELETED_BLOCKS) {
+            ESP_LOGE(TAG, "SPIFFS_gc_quick failed, %" PRId32, SPIFFS_errno(fs));
+            SPIFFS_clearerr(fs);
+            return ESP_FAIL;
+        }
+        SPIFFS_clearerr(fs);
+        // Mixed blocks are left: move live pages out of one block and erase it
+        res = SPIFFS_gc(fs, _efs[index]->cfg.log_block_size);
+        if (res != SPIFFS_OK) {
+            ESP_LOGE(TAG, "SPIFFS_gc failed, %" PRId32, SPIFFS_errno(fs));
+            SPIFFS_clearerr(fs);
+            return ESP_FAIL;
+        }
+        if (fs->stats_p_deleted >= deleted_before) {
+            // No forward progress: the remaining deleted pages are spread too
+            // thinly to be worth relocating live data for, leave them be
+            break;
+        }
+    }
+    return ESP_OK;
+}
+
+static void esp_spiffs_gc_watermark_check(esp_spiffs_t *efs)
+{
+    uint32_t total = 0;
+    uint32_t used = 0;
+    if (SPIFFS_info(efs->fs, (u32_t *) &total, (u32_t *) &used) != SPIFFS_OK) {
+        SPIFFS_clearerr(efs->fs);
+        return;
+    }
+    size_t free_bytes = (used > total) ? 0 : (total - used);
+    if (free_bytes < efs->gc_min_free) {
+        if (!efs->gc_notified) {
+            efs->gc_notified = true;
+            (*efs->gc_notify_cb)(efs->partition->label, free_bytes, efs->gc_notify_arg);
+        }
+    } else {
+        efs->gc_notified = false;
+    }
+}
+
+esp_err_t esp_spiffs_gc_set_watermark(const char* partition_label, size_t min_free_bytes,
+                                      esp_spiffs_gc_notify_cb_t cb, void* arg)
+{
+    int index;
+    if (esp_spiffs_by_label(partition_label, &index) != ESP_OK) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_spiffs_t *efs = _efs[index];
+    efs->gc_notify_cb = NULL; // keep the write path away while the fields change
+    efs->gc_min_free = min_free_bytes;
+    efs->gc_notify_arg = arg;
+    efs->gc_notified = false;
+    efs->gc_notify_cb = cb;
+    return ESP_OK;
+}
+
 #ifdef CONFIG_VFS_SUPPORT_DIR
 static const esp_vfs_dir_ops_t s_vfs_spiffs_dir = {
     .stat_p = &vfs_spiffs_stat,
@@ -552,6 +653,10 @@ static int vfs_spiffs_open(void* ctx, const char * path, int flags, int mode)
     }
     if (!(spiffs_flags & SPIFFS_RDONLY)) {
         vfs_spiffs_update_mtime(efs->fs, fd);
+#ifdef CONFIG_SPIFFS_META_CACHE
+        // size and mtime are about to change, refill on the next stat
+        esp_spiffs_meta_cache_invalidate(efs, path);
+#endif
     }
     return fd;
 }
@@ -565,6 +670,9 @@ static ssize_t vfs_spiffs_write(void* ctx, int fd, const void * data, size_t siz
         SPIFFS_clearerr(efs->fs);
         return -1;
     }
+    if (efs->gc_notify_cb != NULL) {
+        esp_spiffs_gc_watermark_check(efs);
+    }
     return res;
 }
 
@@ -644,11 +752,22 @@ static int vfs_spiffs_stat(void* ctx, const char * path, struct stat * st)
     assert(st);
     spiffs_stat s;
     esp_spiffs_t * efs = (esp_spiffs_t *)ctx;
-    off_t res = SPIFFS_stat(efs->fs, path, &s);
-    if (res < 0) {
-        errno = spiffs_res_to_errno(SPIFFS_errno(efs->fs));
-        SPIFFS_clearerr(efs->fs);
-        return -1;
+    off_t res = 0;
+#ifdef CONFIG_SPIFFS_META_CACHE
+    bool cached = esp_spiffs_meta_cache_lookup(efs, path, &s);
+#else
+    bool cached = false;
+#endif
+    if (!cached) {
+        res = SPIFFS_stat(efs->fs, path, &s);
+        if (res < 0) {
+            errno = spiffs_res_to_errno(SPIFFS_errno(efs->fs));
+            SPIFFS_clearerr(efs->fs);
+            return -1;
+        }
+#ifdef CONFIG_SPIFFS_META_CACHE
+        esp_spiffs_meta_cache_store(efs, &s);
+#endif
     }
     memset(st, 0, sizeof(*st));
     st->st_size = s.size;
@@ -671,6 +790,10 @@ static int vfs_spiffs_rename(void* ctx, const char *src, const char *dst)
         SPIFFS_clearerr(efs->fs);
         return -1;
     }
+#ifdef CONFIG_SPIFFS_META_CACHE
+    esp_spiffs_meta_cache_invalidate(efs, src);
+    esp_spiffs_meta_cache_invalidate(efs, dst);
+#endif
     return res;
 }
 
@@ -684,6 +807,9 @@ static int vfs_spiffs_unlink(void* ctx, const char *path)
         SPIFFS_clearerr(efs->fs);
         return -1;
     }
+#ifdef CONFIG_SPIFFS_META_CACHE
+    esp_spiffs_meta_cache_invalidate(efs, path);
+#endif
     return res;
 }
 
@@ -842,6 +968,9 @@ static int vfs_spiffs_truncate(void* ctx, const char *path, off_t length)
     if (res < 0) {
        goto err;
     }
+#ifdef CONFIG_SPIFFS_META_CACHE
+    esp_spiffs_meta_cache_invalidate(efs, path);
+#endif
     return res;
 err:
     errno = spiffs_res_to_errno(SPIFFS_errno(efs->fs));
@@ -858,6 +987,14 @@ static int vfs_spiffs_ftruncate(void* ctx, int fd, off_t length)
         SPIFFS_clearerr(efs->fs);
         return -1;
     }
+#ifdef CONFIG_SPIFFS_META_CACHE
+    spiffs_stat s;
+    if (SPIFFS_fstat(efs->fs, fd, &s) == SPIFFS_OK) {
+        esp_spiffs_meta_cache_invalidate(efs, (const char *)s.name);
+    } else {
+        SPIFFS_clearerr(efs->fs);
+    }
+#endif
     return res;
 }
 
@@ -909,6 +1046,9 @@ static int vfs_spiffs_utime(void *ctx, const char *path, const struct utimbuf *t
         return -1;
     }
 
+#ifdef CONFIG_SPIFFS_META_CACHE
+    esp_spiffs_meta_cache_invalidate(efs, path);
+#endif
     return 0;
 }
 #endif //CONFIG_SPIFFS_USE_MTIME
@@ -0,0 +1,401 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
+
+#ifdef CONFIG_SPIFFS_META_CACHE
+
+#include "esp_spiffs.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "spiffs.h"
+#include "spiffs_api.h"
+
+static const char* TAG = "SPIFFS";
+
+/** Hot-list file persisted inside the filesystem itself */
+#define META_CACHE_HOTLIST_PATH "/.spiffs_hot"
+/** Upper bound on the hot-list file; one line per path */
+#define META_CACHE_HOTLIST_MAX_SIZE (CONFIG_SPIFFS_META_CACHE_MAX_ENTRIES * SPIFFS_OBJ_NAME_LEN)
+
+typedef struct {
+    spiffs_stat stat;       /*!< Cached object metadata; stat.name doubles as the key */
+    uint32_t last_used;     /*!< LRU stamp, taken from use_counter */
+    bool pinned;            /*!< Never evicted, saved to the hot-list */
+    bool valid;
+} meta_cache_entry_t;
+
+typedef struct {
+    SemaphoreHandle_t lock;
+    meta_cache_entry_t *entries;
+    size_t capacity;        /*!< Current table size, grows on demand up to the configured maximum */
+    uint32_t use_counter;
+    uint32_t miss_streak;   /*!< Consecutive misses on a full table, triggers growing */
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t prewarmed;
+} meta_cache_t;
+
+static meta_cache_entry_t *meta_cache_find(meta_cache_t *cache, const char *path);
+
+esp_err_t esp_spiffs_meta_cache_attach(esp_spiffs_t *efs)
+{
+    meta_cache_t *cache = calloc(1, sizeof(meta_cache_t));
+    if (cache == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    cache->capacity = CONFIG_SPIFFS_META_CACHE_MIN_ENTRIES;
+    cache->entries = calloc(cache->capacity, sizeof(meta_cache_entry_t));
+    if (cache->entries == NULL) {
+        free(cache);
+        return ESP_ERR_NO_MEM;
+    }
+
+    cache->lock = xSemaphoreCreateMutex();
+    if (cache->lock == NULL) {
+        free(cache->entries);
+        free(cache);
+        return ESP_ERR_NO_MEM;
+    }
+
+    efs->meta_cache = cache;
+
+#ifdef CONFIG_SPIFFS_META_CACHE_HOTLIST
+    // Pre-warm from the persisted hot-list: stat each listed path once so the
+    // first open of the boot already hits the cache. Missing list or missing
+    // paths are not errors, the list is only a hint.
+    spiffs_file fd = SPIFFS_open(efs->fs, META_CACHE_HOTLIST_PATH, SPIFFS_O_RDONLY, 0);
+    if (fd >= 0) {
+        char *list = malloc(META_CACHE_HOTLIST_MAX_SIZE + 1);
+        if (list != NULL) {
+            s32_t len = SPIFFS_read(efs->fs, fd, list, META_CACHE_HOTLIST_MAX_SIZE);
+            if (len > 0) {
+                list[len] = '\0';
+                char *save = NULL;
+                for (char *line = strtok_r(list, "\n", &save); line != NULL;
+                        line = strtok_r(NULL, "\n", &save)) {
+                    spiffs_stat s;
+                    if (line[0] == '\0' || SPIFFS_stat(efs->fs, line, &s) < 0) {
+                        SPIFFS_clearerr(efs->fs);
+                        continue;
+                    }
+                    esp_spiffs_meta_cache_store(efs, &s);
+                    // pin directly; the public pin API resolves the mount by
+                    // label, which is not registered yet at this point
+                    xSemaphoreTake(cache->lock, portMAX_DELAY);
+                    meta_cache_entry_t *entry = meta_cache_find(cache, line);
+                    if (entry != NULL) {
+                        entry->pinned = true;
+                    }
+                    xSemaphoreGive(cache->lock);
+                    cache->prewarmed++;
+                }
+            }
+            free(list);
+        }
+        SPIFFS_close(efs->fs, fd);
+    } else {
+        SPIFFS_clearerr(efs->fs);
+    }
+#endif // CONFIG_SPIFFS_META_CACHE_HOTLIST
+
+    return ESP_OK;
+}
+
+void esp_spiffs_meta_cache_detach(esp_spiffs_t *efs)
+{
+    meta_cache_t *cache = efs->meta_cache;
+    if (cache == NULL) {
+        return;
+    }
+    efs->meta_cache = NULL;
+    vSemaphoreDelete(cache->lock);
+    free(cache->entries);
+    free(cache);
+}
+
+static meta_cache_entry_t *meta_cache_find(meta_cache_t *cache, const char *path)
+{
+    for (size_t i = 0; i < cache->capacity; i++) {
+        if (cache->entries[i].valid
+                && strncmp((const char *)cache->entries[i].stat.name, path, SPIFFS_OBJ_NAME_LEN) == 0) {
+            return &cache->entries[i];
+        }
+    }
+    return NULL;
+}
+
+bool esp_spiffs_meta_cache_lookup(esp_spiffs_t *efs, const char *path, spiffs_stat *out_stat)
+{
+    meta_cache_t *cache = efs->meta_cache;
+    if (cache == NULL) {
+        return false;
+    }
+
+    bool hit = false;
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    meta_cache_entry_t *entry = meta_cache_find(cache, path);
+    if (entry != NULL) {
+        *out_stat = entry->stat;
+        entry->last_used = ++cache->use_counter;
+        cache->hits++;
+        cache->miss_streak = 0;
+        hit = true;
+    } else {
+        cache->misses++;
+        cache->miss_streak++;
+    }
+    xSemaphoreGive(cache->lock);
+    return hit;
+}
+
+void esp_spiffs_meta_cache_store(esp_spiffs_t *efs, const spiffs_stat *stat)
+{
+    meta_cache_t *cache = efs->meta_cache;
+    if (cache == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+
+    meta_cache_entry_t *slot = meta_cache_find(cache, (const char *)stat->name);
+    if (slot == NULL) {
+        // pick an invalid slot, or the least recently used unpinned one
+        meta_cache_entry_t *victim = NULL;
+        for (size_t i = 0; i < cache->capacity; i++) {
+            meta_cache_entry_t *entry = &cache->entries[i];
+            if (!entry->valid) {
+                victim = entry;
+                break;
+            }
+            if (!entry->pinned && (victim == NULL || entry->last_used < victim->last_used)) {
+                victim = entry;
+            }
+        }
+
+        // adapt the table size: a run of misses at least as long as the full
+        // table means the working set has outgrown it
+        if ((victim == NULL || victim->valid)
+                && cache->miss_streak >= cache->capacity
+                && cache->capacity < CONFIG_SPIFFS_META_CACHE_MAX_ENTRIES) {
+            size_t new_capacity = cache->capacity * 2;
+            if (new_capacity > CONFIG_SPIFFS_META_CACHE_MAX_ENTRIES) {
+                new_capacity = CONFIG_SPIFFS_META_CACHE_MAX_ENTRIES;
+            }
+            meta_cache_entry_t *grown = realloc(cache->entries, new_capacity * sizeof(meta_cache_entry_t));
+            if (grown != NULL) {
+                memset(&grown[cache->capacity], 0,
+                       (new_capacity - cache->capacity) * sizeof(meta_cache_entry_t));
+                victim = &grown[cache->capacity];
+                cache->entries = grown;
+                cache->capacity = new_capacity;
+                cache->miss_streak = 0;
+            }
+        }
+
+        if (victim == NULL) {
+            // every slot is pinned, nothing to evict
+            xSemaphoreGive(cache->lock);
+            return;
+        }
+        victim->pinned = false;
+        slot = victim;
+    }
+
+    slot->stat = *stat;
+    slot->valid = true;
+    slot->last_used = ++cache->use_counter;
+    xSemaphoreGive(cache->lock);
+}
+
+void esp_spiffs_meta_cache_invalidate(esp_spiffs_t *efs, const char *path)
+{
+    meta_cache_t *cache = efs->meta_cache;
+    if (cache == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    if (path == NULL) {
+        for (size_t i = 0; i < cache->capacity; i++) {
+            cache->entries[i].valid = false;
+            cache->entries[i].pinned = false;
+        }
+    } else {
+        meta_cache_entry_t *entry = meta_cache_find(cache, path);
+        if (entry != NULL) {
+            // pinning survives invalidation, the entry refills on the next stat
+            entry->valid = false;
+        }
+    }
+    xSemaphoreGive(cache->lock);
+}
+
+static esp_err_t meta_cache_from_label(const char *partition_label, esp_spiffs_t **out_efs, meta_cache_t **out_cache)
+{
+    esp_spiffs_t *efs = esp_spiffs_get_by_label(partition_label);
+    if (efs == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (efs->meta_cache == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *out_efs = efs;
+    *out_cache = efs->meta_cache;
+    return ESP_OK;
+}
+
+esp_err_t esp_spiffs_meta_cache_get_stats(const char *partition_label, esp_spiffs_meta_cache_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_spiffs_t *efs;
+    meta_cache_t *cache;
+    esp_err_t err = meta_cache_from_label(partition_label, &efs, &cache);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    stats->capacity = cache->capacity;
+    stats->entries = 0;
+    stats->pinned = 0;
+    for (size_t i = 0; i < cache->capacity; i++) {
+        if (cache->entries[i].valid) {
+            stats->entries++;
+        }
+        if (cache->entries[i].pinned) {
+            stats->pinned++;
+        }
+    }
+    stats->hits = cache->hits;
+    stats->misses = cache->misses;
+    stats->prewarmed = cache->prewarmed;
+    xSemaphoreGive(cache->lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_spiffs_meta_cache_pin(const char *partition_label, const char *path)
+{
+    if (path == NULL || strlen(path) >= SPIFFS_OBJ_NAME_LEN) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_spiffs_t *efs;
+    meta_cache_t *cache;
+    esp_err_t err = meta_cache_from_label(partition_label, &efs, &cache);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    meta_cache_entry_t *entry = meta_cache_find(cache, path);
+    if (entry == NULL) {
+        xSemaphoreGive(cache->lock);
+
+        // not cached yet: stat it once to populate, then retry
+        spiffs_stat s;
+        if (SPIFFS_stat(efs->fs, path, &s) < 0) {
+            SPIFFS_clearerr(efs->fs);
+            return ESP_ERR_NOT_FOUND;
+        }
+        esp_spiffs_meta_cache_store(efs, &s);
+
+        xSemaphoreTake(cache->lock, portMAX_DELAY);
+        entry = meta_cache_find(cache, path);
+        if (entry == NULL) {
+            // table full of pinned entries
+            xSemaphoreGive(cache->lock);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    entry->pinned = true;
+    xSemaphoreGive(cache->lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_spiffs_meta_cache_unpin(const char *partition_label, const char *path)
+{
+    if (path == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_spiffs_t *efs;
+    meta_cache_t *cache;
+    esp_err_t err = meta_cache_from_label(partition_label, &efs, &cache);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    meta_cache_entry_t *entry = meta_cache_find(cache, path);
+    if (entry != NULL) {
+        entry->pinned = false;
+    }
+    xSemaphoreGive(cache->lock);
+    return (entry != NULL) ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+#ifdef CONFIG_SPIFFS_META_CACHE_HOTLIST
+esp_err_t esp_spiffs_meta_cache_save_hotlist(const char *partition_label)
+{
+    esp_spiffs_t *efs;
+    meta_cache_t *cache;
+    esp_err_t err = meta_cache_from_label(partition_label, &efs, &cache);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    char *list = malloc(META_CACHE_HOTLIST_MAX_SIZE);
+    if (list == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    size_t used = 0;
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    for (size_t i = 0; i < cache->capacity; i++) {
+        meta_cache_entry_t *entry = &cache->entries[i];
+        if (!entry->pinned) {
+            continue;
+        }
+        size_t name_len = strnlen((const char *)entry->stat.name, SPIFFS_OBJ_NAME_LEN);
+        if (used + name_len + 1 > META_CACHE_HOTLIST_MAX_SIZE) {
+            break;
+        }
+        memcpy(list + used, entry->stat.name, name_len);
+        used += name_len;
+        list[used++] = '\n';
+    }
+    xSemaphoreGive(cache->lock);
+
+    spiffs_file fd = SPIFFS_open(efs->fs, META_CACHE_HOTLIST_PATH,
+                                 SPIFFS_O_CREAT | SPIFFS_O_TRUNC | SPIFFS_O_WRONLY, 0);
+    if (fd < 0) {
+        SPIFFS_clearerr(efs->fs);
+        free(list);
+        return ESP_FAIL;
+    }
+
+    err = ESP_OK;
+    if (used > 0 && SPIFFS_write(efs->fs, fd, list, used) < 0) {
+        ESP_LOGE(TAG, "hot-list write failed, %" PRId32, SPIFFS_errno(efs->fs));
+        SPIFFS_clearerr(efs->fs);
+        err = ESP_FAIL;
+    }
+    SPIFFS_close(efs->fs, fd);
+    free(list);
+    return err;
+}
+#endif // CONFIG_SPIFFS_META_CACHE_HOTLIST
+
+#endif // CONFIG_SPIFFS_META_CACHE
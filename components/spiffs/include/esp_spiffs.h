@@ -8,7 +8,10 @@
 #define _ESP_SPIFFS_H_
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "esp_err.h"
+#include "sdkconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -124,6 +127,144 @@ esp_err_t esp_spiffs_check(const char* partition_label);
  */
 esp_err_t esp_spiffs_gc(const char* partition_label, size_t size_to_gc);
 
+/**
+ * @brief Run one time-bounded increment of SPIFFS garbage collection
+ *
+ * Reclaims deleted pages in small steps, checking the time budget between
+ * steps, so it can be called repeatedly from an idle task. When enough space
+ * is reclaimed this way, foreground writes almost never have to trigger a
+ * full collection pass themselves.
+ *
+ * Deleted pages which cannot be reclaimed without exceeding the budget are
+ * left for the next call; ESP_ERR_NOT_FINISHED indicates that calling again
+ * will make further progress.
+ *
+ * @param partition_label  Label of the partition to be garbage-collected.
+ *                         The partition must be already mounted.
+ * @param max_us           Time budget for this call, in microseconds. The
+ *                         budget is checked between GC steps: one step erases
+ *                         at most a few logical blocks, so the call can
+ *                         overrun the budget by roughly one block erase time.
+ * @return
+ *          - ESP_OK if all reclaimable space has been collected
+ *          - ESP_ERR_NOT_FINISHED if the budget ran out with work remaining
+ *          - ESP_ERR_INVALID_STATE if the partition is not mounted
+ *          - ESP_FAIL on all other errors
+ */
+esp_err_t esp_spiffs_gc_step(const char* partition_label, uint32_t max_us);
+
+/**
+ * @brief Notification callback for the free space watermark
+ *
+ * @param partition_label  Label of the partition running low on space
+ * @param free_bytes       Current amount of free space, in bytes
+ * @param arg              User argument given to esp_spiffs_gc_set_watermark
+ */
+typedef void (*esp_spiffs_gc_notify_cb_t)(const char* partition_label, size_t free_bytes, void* arg);
+
+/**
+ * @brief Install a free space watermark for a SPIFFS partition
+ *
+ * After each successful write, the amount of free space is compared against
+ * the watermark. When it drops below min_free_bytes the callback is invoked
+ * once; it is re-armed as soon as free space rises above the watermark again
+ * (typically after garbage collection). The intended use is to wake a
+ * low-priority task which then calls esp_spiffs_gc_step() until it returns
+ * ESP_OK.
+ *
+ * @note The callback runs in the context of the task performing the write,
+ *       so it should only signal another task (e.g. give a semaphore) and
+ *       must not call SPIFFS functions itself.
+ *
+ * @param partition_label  Same label as passed to esp_vfs_spiffs_register.
+ *                         The partition must be already mounted.
+ * @param min_free_bytes   Watermark, in bytes
+ * @param cb               Callback to invoke; NULL removes the watermark
+ * @param arg              User argument passed to the callback
+ * @return
+ *          - ESP_OK on success
+ *          - ESP_ERR_INVALID_STATE if the partition is not mounted
+ */
+esp_err_t esp_spiffs_gc_set_watermark(const char* partition_label, size_t min_free_bytes,
+                                      esp_spiffs_gc_notify_cb_t cb, void* arg);
+
+#ifdef CONFIG_SPIFFS_META_CACHE
+/**
+ * @brief Counters of the SPIFFS metadata cache
+ */
+typedef struct {
+    size_t capacity;        /*!< Current number of cache slots; grows on demand up to the configured maximum */
+    size_t entries;         /*!< Slots holding valid metadata */
+    size_t pinned;          /*!< Slots pinned against eviction */
+    uint32_t hits;          /*!< stat requests served from the cache */
+    uint32_t misses;        /*!< stat requests that had to walk the object lookup pages */
+    uint32_t prewarmed;     /*!< Entries loaded from the persisted hot-list at mount */
+} esp_spiffs_meta_cache_stats_t;
+
+/**
+ * @brief Query the metadata cache counters of a mounted partition
+ *
+ * @param partition_label  Same label as passed to esp_vfs_spiffs_register.
+ * @param stats            Filled with the current counters
+ * @return
+ *          - ESP_OK on success
+ *          - ESP_ERR_INVALID_ARG if stats is NULL
+ *          - ESP_ERR_INVALID_STATE if the partition is not mounted or the cache
+ *            could not be allocated at mount time
+ */
+esp_err_t esp_spiffs_meta_cache_get_stats(const char* partition_label, esp_spiffs_meta_cache_stats_t* stats);
+
+/**
+ * @brief Pin the metadata of a path in the cache
+ *
+ * A pinned entry is never evicted, so frequently opened paths keep their
+ * metadata resident regardless of other filesystem traffic. If the path is
+ * not cached yet it is looked up once. Pinned paths are written to the
+ * hot-list by esp_spiffs_meta_cache_save_hotlist().
+ *
+ * @param partition_label  Same label as passed to esp_vfs_spiffs_register.
+ * @param path             Path of the file, as stored in SPIFFS
+ * @return
+ *          - ESP_OK on success
+ *          - ESP_ERR_INVALID_ARG if path is NULL or too long
+ *          - ESP_ERR_INVALID_STATE if the partition is not mounted or has no cache
+ *          - ESP_ERR_NOT_FOUND if the path does not exist
+ *          - ESP_ERR_NO_MEM if every cache slot is already pinned
+ */
+esp_err_t esp_spiffs_meta_cache_pin(const char* partition_label, const char* path);
+
+/**
+ * @brief Make a pinned path evictable again
+ *
+ * @param partition_label  Same label as passed to esp_vfs_spiffs_register.
+ * @param path             Path previously passed to esp_spiffs_meta_cache_pin
+ * @return
+ *          - ESP_OK on success
+ *          - ESP_ERR_INVALID_ARG if path is NULL
+ *          - ESP_ERR_INVALID_STATE if the partition is not mounted or has no cache
+ *          - ESP_ERR_NOT_FOUND if the path is not cached
+ */
+esp_err_t esp_spiffs_meta_cache_unpin(const char* partition_label, const char* path);
+
+#ifdef CONFIG_SPIFFS_META_CACHE_HOTLIST
+/**
+ * @brief Persist the pinned paths as the hot-list of the partition
+ *
+ * The list is stored in a hidden file inside the filesystem and read back on
+ * the next mount, which pre-warms and pins the listed paths before the
+ * application opens them for the first time.
+ *
+ * @param partition_label  Same label as passed to esp_vfs_spiffs_register.
+ * @return
+ *          - ESP_OK on success
+ *          - ESP_ERR_INVALID_STATE if the partition is not mounted or has no cache
+ *          - ESP_ERR_NO_MEM if the list buffer can't be allocated
+ *          - ESP_FAIL if writing the list file fails
+ */
+esp_err_t esp_spiffs_meta_cache_save_hotlist(const char* partition_label);
+#endif // CONFIG_SPIFFS_META_CACHE_HOTLIST
+#endif // CONFIG_SPIFFS_META_CACHE
+
 #ifdef __cplusplus
 }
 #endif
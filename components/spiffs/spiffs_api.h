@@ -35,8 +35,29 @@ typedef struct {
     uint32_t fds_sz;                        /*!< File Descriptor Buffer Length */
     uint8_t *cache;                         /*!< Cache Buffer */
     uint32_t cache_sz;                      /*!< Cache Buffer Length */
+    size_t gc_min_free;                     /*!< Free space watermark, in bytes */
+    void (*gc_notify_cb)(const char* partition_label, size_t free_bytes, void* arg); /*!< Called when free space falls below gc_min_free */
+    void *gc_notify_arg;                    /*!< User argument for gc_notify_cb */
+    bool gc_notified;                       /*!< gc_notify_cb already fired for the current low-space episode */
+#ifdef CONFIG_SPIFFS_META_CACHE
+    void *meta_cache;                       /*!< Metadata cache state, see esp_spiffs_meta_cache.c */
+#endif
 } esp_spiffs_t;
 
+#ifdef CONFIG_SPIFFS_META_CACHE
+/* Looks up a mounted filesystem by partition label (NULL matches a mount
+ * done without a label) */
+esp_spiffs_t *esp_spiffs_get_by_label(const char* label);
+
+/* Internal hooks of the metadata cache, called from the VFS glue.
+ * All of them tolerate efs->meta_cache == NULL (attach failure). */
+esp_err_t esp_spiffs_meta_cache_attach(esp_spiffs_t *efs);
+void esp_spiffs_meta_cache_detach(esp_spiffs_t *efs);
+bool esp_spiffs_meta_cache_lookup(esp_spiffs_t *efs, const char *path, spiffs_stat *out_stat);
+void esp_spiffs_meta_cache_store(esp_spiffs_t *efs, const spiffs_stat *stat);
+void esp_spiffs_meta_cache_invalidate(esp_spiffs_t *efs, const char *path);
+#endif
+
 s32_t spiffs_api_read(spiffs *fs, uint32_t addr, uint32_t size, uint8_t *dst);
 
 s32_t spiffs_api_write(spiffs *fs, uint32_t addr, uint32_t size, uint8_t *src);
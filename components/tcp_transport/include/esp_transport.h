@@ -9,6 +9,7 @@
 
 #include <esp_err.h>
 #include <stdbool.h>
+#include <sys/uio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,6 +30,7 @@ typedef struct esp_transport_item_t* esp_transport_handle_t;
 
 typedef int (*connect_func)(esp_transport_handle_t t, const char *host, int port, int timeout_ms);
 typedef int (*io_func)(esp_transport_handle_t t, const char *buffer, int len, int timeout_ms);
+typedef int (*io_vectored_func)(esp_transport_handle_t t, const struct iovec *iov, int iovcnt, int timeout_ms);
 typedef int (*io_read_func)(esp_transport_handle_t t, char *buffer, int len, int timeout_ms);
 typedef int (*trans_func)(esp_transport_handle_t t);
 typedef int (*poll_func)(esp_transport_handle_t t, int timeout_ms);
@@ -220,6 +222,25 @@ int esp_transport_poll_read(esp_transport_handle_t t, int timeout_ms);
  */
 int esp_transport_write(esp_transport_handle_t t, const char *buffer, int len, int timeout_ms);
 
+/**
+ * @brief      Transport vectored write function
+ *
+ *             Writes the buffers of the iovec array as one logical unit, e.g. a protocol
+ *             header followed by the payload, without requiring the caller to copy them
+ *             into a contiguous staging buffer first. Transports that do not implement a
+ *             vectored write fall back to writing the buffers one after another.
+ *
+ * @param      t           The transport handle
+ * @param[in]  iov         Array of buffers to write
+ * @param[in]  iovcnt      Number of buffers in the array
+ * @param[in]  timeout_ms  The timeout milliseconds (-1 indicates wait forever)
+ *
+ * @return
+ *  - Number of bytes was written
+ *  - (-1) if there are any errors, should check errno
+ */
+int esp_transport_writev(esp_transport_handle_t t, const struct iovec *iov, int iovcnt, int timeout_ms);
+
 /**
  * @brief      Poll the transport until writeable or timeout
  *
@@ -312,6 +333,18 @@ esp_err_t esp_transport_set_func(esp_transport_handle_t t,
  */
 esp_err_t esp_transport_set_async_connect_func(esp_transport_handle_t t, connect_async_func _connect_async_func);
 
+/**
+ * @brief      Set the vectored write function for the transport handle
+ *
+ * @param[in]  t              The transport handle
+ * @param[in]  _writev_func   The vectored write function pointer
+ *
+ * @return
+ *     - ESP_OK
+ *     - ESP_FAIL
+ */
+esp_err_t esp_transport_set_writev_func(esp_transport_handle_t t, io_vectored_func _writev_func);
+
 /**
  * @brief      Set parent transport function to the handle
  *
@@ -150,6 +150,33 @@ int esp_transport_write(esp_transport_handle_t t, const char *buffer, int len, i
     return -1;
 }
 
+int esp_transport_writev(esp_transport_handle_t t, const struct iovec *iov, int iovcnt, int timeout_ms)
+{
+    if (t == NULL || iov == NULL || iovcnt < 0) {
+        return -1;
+    }
+    if (t->_writev) {
+        return t->_writev(t, iov, iovcnt, timeout_ms);
+    }
+    // The transport has no scatter-gather support, write the buffers one after another
+    int total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        int len = (int)iov[i].iov_len;
+        if (len == 0) {
+            continue;
+        }
+        int ret = esp_transport_write(t, (const char *)iov[i].iov_base, len, timeout_ms);
+        if (ret < 0) {
+            return (total > 0) ? total : ret;
+        }
+        total += ret;
+        if (ret < len) {
+            break;
+        }
+    }
+    return total;
+}
+
 int esp_transport_poll_read(esp_transport_handle_t t, int timeout_ms)
 {
     if (t && t->_poll_read) {
@@ -241,6 +268,15 @@ esp_err_t esp_transport_set_async_connect_func(esp_transport_handle_t t, connect
     return ESP_OK;
 }
 
+esp_err_t esp_transport_set_writev_func(esp_transport_handle_t t, io_vectored_func _writev_func)
+{
+    if (t == NULL) {
+        return ESP_FAIL;
+    }
+    t->_writev = _writev_func;
+    return ESP_OK;
+}
+
 esp_err_t esp_transport_set_parent_transport_func(esp_transport_handle_t t, payload_transfer_func _parent_transport)
 {
     if (t == NULL) {
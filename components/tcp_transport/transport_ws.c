@@ -401,13 +401,16 @@ static int ws_connect(esp_transport_handle_t t, const char *host, int port, int
     return 0;
 }
 
-static int _ws_write(esp_transport_handle_t t, int opcode, int mask_flag, const char *b, int len, int timeout_ms)
+static int _ws_writev(esp_transport_handle_t t, int opcode, int mask_flag, const struct iovec *iov, int iovcnt, int timeout_ms)
 {
     transport_ws_t *ws = esp_transport_get_context_data(t);
-    char *buffer = (char *)b;
     char ws_header[MAX_WEBSOCKET_HEADER_SIZE];
     char *mask;
     int header_len = 0, i;
+    int len = 0;
+    for (i = 0; i < iovcnt; i++) {
+        len += (int)iov[i].iov_len;
+    }
 
     int poll_write;
     if ((poll_write = esp_transport_poll_write(ws->parent, timeout_ms)) <= 0) {
@@ -444,8 +447,12 @@ static int _ws_write(esp_transport_handle_t t, int opcode, int mask_flag, const
         }
         header_len += 4;
 
-        for (i = 0; i < len; ++i) {
-            buffer[i] = (buffer[i] ^ mask[i % 4]);
+        size_t idx = 0;
+        for (i = 0; i < iovcnt; i++) {
+            char *buffer = (char *)iov[i].iov_base;
+            for (size_t j = 0; j < iov[i].iov_len; ++j, ++idx) {
+                buffer[j] = (buffer[j] ^ mask[idx % 4]);
+            }
         }
     }
 
@@ -457,18 +464,31 @@ static int _ws_write(esp_transport_handle_t t, int opcode, int mask_flag, const
         return 0;
     }
 
-    int ret = esp_transport_write(ws->parent, buffer, len, timeout_ms);
+    int ret = esp_transport_writev(ws->parent, iov, iovcnt, timeout_ms);
     // in case of masked transport we have to revert back to the original data, as ws layer
     // does not create its own copy of data to be sent
     if (mask_flag) {
         mask = &ws_header[header_len - 4];
-        for (i = 0; i < len; ++i) {
-            buffer[i] = (buffer[i] ^ mask[i % 4]);
+        size_t idx = 0;
+        for (i = 0; i < iovcnt; i++) {
+            char *buffer = (char *)iov[i].iov_base;
+            for (size_t j = 0; j < iov[i].iov_len; ++j, ++idx) {
+                buffer[j] = (buffer[j] ^ mask[idx % 4]);
+            }
         }
     }
     return ret;
 }
 
+static int _ws_write(esp_transport_handle_t t, int opcode, int mask_flag, const char *b, int len, int timeout_ms)
+{
+    struct iovec iov = {
+        .iov_base = (void *)b,
+        .iov_len = len,
+    };
+    return _ws_writev(t, opcode, mask_flag, &iov, (len > 0) ? 1 : 0, timeout_ms);
+}
+
 int esp_transport_ws_send_raw(esp_transport_handle_t t, ws_transport_opcodes_t opcode, const char *b, int len, int timeout_ms)
 {
     uint8_t op_code = ws_get_bin_opcode(opcode);
@@ -492,6 +512,20 @@ static int ws_write(esp_transport_handle_t t, const char *b, int len, int timeou
     return _ws_write(t, WS_OPCODE_BINARY | WS_FIN, WS_MASK, b, len, timeout_ms);
 }
 
+static int ws_writev(esp_transport_handle_t t, const struct iovec *iov, int iovcnt, int timeout_ms)
+{
+    int len = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        len += (int)iov[i].iov_len;
+    }
+    if (len == 0) {
+        // Keep the behaviour of ws_write(): zero length payload sends out a ping message
+        ESP_LOGD(TAG, "Write PING message");
+        return _ws_writev(t, WS_OPCODE_PING | WS_FIN, WS_MASK, NULL, 0, timeout_ms);
+    }
+    return _ws_writev(t, WS_OPCODE_BINARY | WS_FIN, WS_MASK, iov, iovcnt, timeout_ms);
+}
+
 
 static int ws_read_payload(esp_transport_handle_t t, char *buffer, int len, int timeout_ms)
 {
@@ -815,6 +849,7 @@ esp_transport_handle_t esp_transport_ws_init(esp_transport_handle_t parent_handl
     });
 
     esp_transport_set_func(t, ws_connect, ws_read, ws_write, ws_close, ws_poll_read, ws_poll_write, ws_destroy);
+    esp_transport_set_writev_func(t, ws_writev);
     // websocket underlying transfer is the payload transfer handle
     esp_transport_set_parent_transport_func(t, ws_get_payload_transport_handle);
 
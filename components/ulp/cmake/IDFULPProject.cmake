@@ -131,7 +131,8 @@ function(ulp_apply_default_sources ulp_app_name)
         "${IDF_PATH}/components/ulp/lp_core/lp_core/lp_core_mailbox.c"
         "${IDF_PATH}/components/ulp/lp_core/shared/ulp_lp_core_lp_adc_shared.c"
         "${IDF_PATH}/components/ulp/lp_core/shared/ulp_lp_core_lp_vad_shared.c"
-        "${IDF_PATH}/components/ulp/lp_core/shared/ulp_lp_core_critical_section_shared.c")
+        "${IDF_PATH}/components/ulp/lp_core/shared/ulp_lp_core_critical_section_shared.c"
+        "${IDF_PATH}/components/ulp/lp_core/shared/ulp_lp_core_sample_ring_shared.c")
 
         if(CONFIG_SOC_LP_MAILBOX_SUPPORTED)
             list(APPEND ULP_S_SOURCES
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Single-producer single-consumer sample ring shared between the LP and HP core
+ *
+ * The structure and its buffer must live in LP/RTC RAM (e.g. defined as global
+ * variables in the LP core program) so both cores see the same addresses.
+ * The LP core produces, the HP core consumes; each side only ever writes its
+ * own index, so no lock is needed. Push can additionally wake the main
+ * processor once a configurable number of samples is pending, so the HP core
+ * wakes per batch rather than per sample.
+ */
+typedef struct {
+    volatile uint32_t head;     /*!< Free running produce index, written by the LP core only */
+    volatile uint32_t tail;     /*!< Free running consume index, written by the HP core only */
+    uint32_t item_size;         /*!< Size of one sample, in bytes */
+    uint32_t capacity;          /*!< Maximum number of samples in the ring */
+    uint32_t wake_threshold;    /*!< Pending sample count that triggers a main processor wakeup, 0 to never wake */
+    uint8_t *buffer;            /*!< Sample storage, capacity * item_size bytes in LP/RTC RAM */
+} ulp_lp_core_sample_ring_t;
+
+/**
+ * @brief Producer-side sample filters, used to decimate raw readings before they enter the ring
+ */
+typedef enum {
+    ULP_LP_CORE_SAMPLE_FILTER_DELTA,    /*!< Accept a sample when it differs from the last accepted one by at least the threshold */
+    ULP_LP_CORE_SAMPLE_FILTER_MIN,      /*!< Accept a sample when it is at or below the threshold */
+    ULP_LP_CORE_SAMPLE_FILTER_MAX,      /*!< Accept a sample when it is at or above the threshold */
+} ulp_lp_core_sample_filter_type_t;
+
+/**
+ * @brief State of one sample filter
+ */
+typedef struct {
+    ulp_lp_core_sample_filter_type_t type;  /*!< Filter type */
+    int32_t threshold;                      /*!< Delta or level threshold, meaning depends on the type */
+    int32_t last_accepted;                  /*!< Last accepted value (delta filter state) */
+    bool primed;                            /*!< Set once a first value has been accepted */
+} ulp_lp_core_sample_filter_t;
+
+/**
+ * @brief Initialize a sample ring
+ *
+ * Call once, before the LP core starts producing. Usually done by the HP core
+ * after loading the LP program, with the ring and buffer resolved through the
+ * generated ulp_ symbols.
+ *
+ * @param ring              Ring to initialize, in LP/RTC RAM
+ * @param buffer            Sample storage in LP/RTC RAM, capacity * item_size bytes
+ * @param item_size         Size of one sample, in bytes
+ * @param capacity          Maximum number of samples in the ring
+ * @param wake_threshold    Pending sample count that wakes the main processor, 0 to never wake
+ */
+void ulp_lp_core_sample_ring_init(ulp_lp_core_sample_ring_t *ring, void *buffer,
+                                  uint32_t item_size, uint32_t capacity, uint32_t wake_threshold);
+
+/**
+ * @brief Number of samples currently pending in the ring
+ *
+ * @param ring  Ring to query
+ *
+ * @return Pending sample count
+ */
+uint32_t ulp_lp_core_sample_ring_count(const ulp_lp_core_sample_ring_t *ring);
+
+/**
+ * @brief Push one sample into the ring (producer side)
+ *
+ * When built for the LP core, reaching the wake threshold wakes the main
+ * processor. A full ring drops the sample rather than overwriting.
+ *
+ * @param ring  Ring to push to
+ * @param item  Sample to copy into the ring, item_size bytes
+ *
+ * @return true if the sample was stored, false if the ring is full
+ */
+bool ulp_lp_core_sample_ring_push(ulp_lp_core_sample_ring_t *ring, const void *item);
+
+/**
+ * @brief Pop the oldest sample from the ring (consumer side)
+ *
+ * @param ring  Ring to pop from
+ * @param item  Filled with the oldest sample, item_size bytes
+ *
+ * @return true if a sample was returned, false if the ring is empty
+ */
+bool ulp_lp_core_sample_ring_pop(ulp_lp_core_sample_ring_t *ring, void *item);
+
+/**
+ * @brief Initialize a sample filter
+ *
+ * @param filter     Filter state to initialize
+ * @param type       Filter type
+ * @param threshold  Delta (DELTA type) or level (MIN/MAX types) threshold
+ */
+void ulp_lp_core_sample_filter_init(ulp_lp_core_sample_filter_t *filter,
+                                    ulp_lp_core_sample_filter_type_t type, int32_t threshold);
+
+/**
+ * @brief Run one value through a filter
+ *
+ * The first value offered to a delta filter is always accepted, so the HP
+ * core gets a baseline reading.
+ *
+ * @param filter  Filter state
+ * @param value   Raw sample value
+ *
+ * @return true if the value passes the filter and should be pushed
+ */
+bool ulp_lp_core_sample_filter_accept(ulp_lp_core_sample_filter_t *filter, int32_t value);
+
+/**
+ * @brief Filter a value and push it into the ring when it passes
+ *
+ * Convenience wrapper combining ulp_lp_core_sample_filter_accept() and
+ * ulp_lp_core_sample_ring_push() for the common int32 sample case.
+ *
+ * @param ring    Ring to push to, item_size must be sizeof(int32_t)
+ * @param filter  Filter state
+ * @param value   Raw sample value
+ *
+ * @return true if the value passed the filter and was stored
+ */
+bool ulp_lp_core_sample_ring_push_filtered(ulp_lp_core_sample_ring_t *ring,
+                                           ulp_lp_core_sample_filter_t *filter, int32_t value);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "ulp_lp_core_sample_ring_shared.h"
+#if IS_ULP_COCPU
+#include "ulp_lp_core_utils.h"
+#endif
+
+void ulp_lp_core_sample_ring_init(ulp_lp_core_sample_ring_t *ring, void *buffer,
+                                  uint32_t item_size, uint32_t capacity, uint32_t wake_threshold)
+{
+    ring->item_size = item_size;
+    ring->capacity = capacity;
+    ring->wake_threshold = wake_threshold;
+    ring->buffer = (uint8_t *)buffer;
+    ring->tail = 0;
+    ring->head = 0;
+}
+
+uint32_t ulp_lp_core_sample_ring_count(const ulp_lp_core_sample_ring_t *ring)
+{
+    /* The indices are free running, so the difference is the pending count
+     * even across wrap-around */
+    return ring->head - ring->tail;
+}
+
+bool ulp_lp_core_sample_ring_push(ulp_lp_core_sample_ring_t *ring, const void *item)
+{
+    uint32_t head = ring->head;
+    if (head - ring->tail >= ring->capacity) {
+        return false;
+    }
+    memcpy(&ring->buffer[(head % ring->capacity) * ring->item_size], item, ring->item_size);
+    /* Publish the sample only after its payload is in place */
+    ring->head = head + 1;
+
+#if IS_ULP_COCPU
+    if (ring->wake_threshold != 0 && ulp_lp_core_sample_ring_count(ring) >= ring->wake_threshold) {
+        ulp_lp_core_wakeup_main_processor();
+    }
+#endif
+    return true;
+}
+
+bool ulp_lp_core_sample_ring_pop(ulp_lp_core_sample_ring_t *ring, void *item)
+{
+    uint32_t tail = ring->tail;
+    if (ring->head == tail) {
+        return false;
+    }
+    memcpy(item, &ring->buffer[(tail % ring->capacity) * ring->item_size], ring->item_size);
+    /* Release the slot only after the payload has been copied out */
+    ring->tail = tail + 1;
+    return true;
+}
+
+void ulp_lp_core_sample_filter_init(ulp_lp_core_sample_filter_t *filter,
+                                    ulp_lp_core_sample_filter_type_t type, int32_t threshold)
+{
+    filter->type = type;
+    filter->threshold = threshold;
+    filter->last_accepted = 0;
+    filter->primed = false;
+}
+
+bool ulp_lp_core_sample_filter_accept(ulp_lp_core_sample_filter_t *filter, int32_t value)
+{
+    bool accept = false;
+    switch (filter->type) {
+    case ULP_LP_CORE_SAMPLE_FILTER_DELTA: {
+        int32_t delta = value - filter->last_accepted;
+        if (delta < 0) {
+            delta = -delta;
+        }
+        accept = !filter->primed || delta >= filter->threshold;
+        break;
+    }
+    case ULP_LP_CORE_SAMPLE_FILTER_MIN:
+        accept = value <= filter->threshold;
+        break;
+    case ULP_LP_CORE_SAMPLE_FILTER_MAX:
+        accept = value >= filter->threshold;
+        break;
+    }
+    if (accept) {
+        filter->last_accepted = value;
+        filter->primed = true;
+    }
+    return accept;
+}
+
+bool ulp_lp_core_sample_ring_push_filtered(ulp_lp_core_sample_ring_t *ring,
+                                           ulp_lp_core_sample_filter_t *filter, int32_t value)
+{
+    if (!ulp_lp_core_sample_filter_accept(filter, value)) {
+        return false;
+    }
+    return ulp_lp_core_sample_ring_push(ring, &value);
+}
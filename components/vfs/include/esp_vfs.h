@@ -466,6 +466,75 @@ ssize_t esp_vfs_pread(int fd, void *dst, size_t size, off_t offset);
  */
 ssize_t esp_vfs_pwrite(int fd, const void *src, size_t size, off_t offset);
 
+/**
+ *
+ * @brief Implements the VFS layer of POSIX writev()
+ *
+ * The whole vector is handed to the filesystem driver in a single dispatch when
+ * the driver implements writev; otherwise one write call is issued per iovec.
+ *
+ * @param fd         File descriptor used for write
+ * @param iov        Pointer to the array of output buffers
+ * @param iovcnt     Number of elements in the iov array
+ *
+ * @return           A positive return value indicates the number of bytes written. -1 is return on failure and errno is
+ *                   set accordingly.
+ */
+ssize_t esp_vfs_writev(int fd, const struct iovec *iov, int iovcnt);
+
+/**
+ *
+ * @brief Implements the VFS layer of POSIX readv()
+ *
+ * The whole vector is handed to the filesystem driver in a single dispatch when
+ * the driver implements readv; otherwise one read call is issued per iovec.
+ *
+ * @param fd         File descriptor used for read
+ * @param iov        Pointer to the array of input buffers
+ * @param iovcnt     Number of elements in the iov array
+ *
+ * @return           A positive return value indicates the number of bytes read. -1 is return on failure and errno is
+ *                   set accordingly.
+ */
+ssize_t esp_vfs_readv(int fd, const struct iovec *iov, int iovcnt);
+
+/**
+ *
+ * @brief Implements the VFS layer of POSIX mmap()
+ *
+ * The call is forwarded to the filesystem driver owning the file descriptor.
+ * Drivers backed by memory-mapped flash can hand out a pointer straight into
+ * the flash cache mapping, so read-only data (asset files, model weights) is
+ * consumed in place instead of being copied into RAM. Only read-only,
+ * file-backed mappings are supported; filesystems without an mmap driver op
+ * fail with ENODEV.
+ *
+ * @param addr       Mapping address hint, drivers may ignore it
+ * @param length     Length of the mapping in bytes
+ * @param prot       Desired protection of the mapping (PROT_READ)
+ * @param flags      Mapping flags (MAP_SHARED or MAP_PRIVATE; equivalent for read-only mappings)
+ * @param fd         File descriptor of the file to map
+ * @param offset     Offset of the mapped region from the start of the file
+ *
+ * @return           Pointer to the mapped region, or MAP_FAILED with errno set on failure
+ */
+void *esp_vfs_mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset);
+
+/**
+ *
+ * @brief Implements the VFS layer of POSIX munmap()
+ *
+ * Releases a region previously returned by esp_vfs_mmap(). Partial unmapping
+ * is not supported: the whole region is released regardless of length. All
+ * regions must be unmapped before the owning filesystem is unregistered.
+ *
+ * @param addr       Address returned by esp_vfs_mmap()
+ * @param length     Length of the mapping in bytes
+ *
+ * @return           0 on success, -1 with errno set on failure
+ */
+int esp_vfs_munmap(void *addr, size_t length);
+
 /**
  *
  * @brief Dump the existing VFS FDs data to FILE* fp
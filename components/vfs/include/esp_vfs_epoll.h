@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file esp_vfs_epoll.h
+ * @brief Persistent readiness monitoring on top of the VFS select machinery
+ *
+ * An epoll instance keeps a registration of file descriptors and the events of
+ * interest across calls, together with a persistent wake-up semaphore and the
+ * per-driver scratch buffers which a plain select()/poll() call allocates and
+ * frees on every invocation. Event loops which wake hundreds of times per second
+ * on the same small descriptor set should register once with esp_epoll_ctl() and
+ * then only call esp_epoll_wait(), which boils down to one wait on the shared
+ * semaphore plus a scan of the registered descriptors.
+ *
+ * Works with every descriptor that select() supports, including sockets, UART
+ * and eventfd. To wake a blocked esp_epoll_wait() from another task or an ISR,
+ * register an eventfd (see esp_vfs_eventfd.h) in the instance and write to it.
+ *
+ * Changes made with esp_epoll_ctl() while another task is blocked in
+ * esp_epoll_wait() on the same instance take effect on the next wait. At most
+ * one task may block in esp_epoll_wait() per instance at a time.
+ */
+
+/**
+ * @brief Events for esp_epoll_ctl() registration and esp_epoll_wait() reporting
+ */
+#define ESP_EPOLLIN  (1u << 0) /*!< descriptor is ready for reading */
+#define ESP_EPOLLOUT (1u << 1) /*!< descriptor is ready for writing */
+#define ESP_EPOLLERR (1u << 2) /*!< descriptor is in an error state */
+
+/**
+ * @brief User data returned verbatim with every reported event
+ */
+typedef union {
+    void *ptr;
+    int fd;
+    uint32_t u32;
+} esp_epoll_data_t;
+
+/**
+ * @brief Registration entry and wait result
+ */
+typedef struct {
+    uint32_t events;       /*!< bitwise OR of ESP_EPOLLIN, ESP_EPOLLOUT, ESP_EPOLLERR */
+    esp_epoll_data_t data; /*!< opaque user data, not interpreted by the implementation */
+} esp_epoll_event_t;
+
+/**
+ * @brief Operations for esp_epoll_ctl()
+ */
+typedef enum {
+    ESP_EPOLL_CTL_ADD, /*!< register a new file descriptor */
+    ESP_EPOLL_CTL_MOD, /*!< change the events or data of a registered file descriptor */
+    ESP_EPOLL_CTL_DEL, /*!< remove a registered file descriptor */
+} esp_epoll_op_t;
+
+typedef struct esp_epoll_instance *esp_epoll_handle_t;
+
+/**
+ * @brief Create an epoll instance
+ *
+ * @param[out] out_handle Returned handle of the new instance
+ *
+ * @return
+ *      - ESP_OK: instance created
+ *      - ESP_ERR_INVALID_ARG: out_handle is NULL
+ *      - ESP_ERR_NO_MEM: out of memory
+ */
+esp_err_t esp_epoll_create(esp_epoll_handle_t *out_handle);
+
+/**
+ * @brief Add, modify or remove a file descriptor registration
+ *
+ * @param handle Epoll instance handle
+ * @param op Operation to perform
+ * @param fd File descriptor to operate on
+ * @param event Events of interest and user data; ignored (may be NULL) for ESP_EPOLL_CTL_DEL
+ *
+ * @return
+ *      - ESP_OK: registration updated
+ *      - ESP_ERR_INVALID_ARG: invalid handle, fd out of range, or missing event
+ *      - ESP_ERR_INVALID_STATE: fd already registered (ADD)
+ *      - ESP_ERR_NOT_FOUND: fd not registered (MOD, DEL)
+ *      - ESP_ERR_NO_MEM: out of memory
+ */
+esp_err_t esp_epoll_ctl(esp_epoll_handle_t handle, esp_epoll_op_t op, int fd, const esp_epoll_event_t *event);
+
+/**
+ * @brief Wait for events on the registered file descriptors
+ *
+ * @param handle Epoll instance handle
+ * @param[out] out_events Array filled with the triggered events
+ * @param max_events Capacity of out_events, must be greater than 0
+ * @param timeout_ms Timeout in milliseconds; a negative value blocks indefinitely, 0 polls
+ *
+ * @return Number of events stored in out_events, 0 on timeout, or -1 with errno set on error
+ */
+int esp_epoll_wait(esp_epoll_handle_t handle, esp_epoll_event_t *out_events, int max_events, int timeout_ms);
+
+/**
+ * @brief Destroy an epoll instance
+ *
+ * No task may be blocked in esp_epoll_wait() on the instance when it is destroyed.
+ * The registered file descriptors themselves stay open.
+ *
+ * @param handle Epoll instance handle
+ *
+ * @return
+ *      - ESP_OK: instance destroyed
+ *      - ESP_ERR_INVALID_ARG: handle is NULL
+ */
+esp_err_t esp_epoll_close(esp_epoll_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
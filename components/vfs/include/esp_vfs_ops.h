@@ -19,6 +19,7 @@
 #include <sys/time.h>
 #include <sys/termios.h>
 #include <sys/poll.h>
+#include <sys/uio.h>
 #include <dirent.h>
 #include <string.h>
 #include "sdkconfig.h"
@@ -256,6 +257,10 @@ typedef ssize_t (*esp_vfs_pread_ctx_op_t)  (void *ctx, int fd, void *dst, size_t
 typedef ssize_t (*esp_vfs_pread_op_t)      (           int fd, void *dst, size_t size, off_t offset);       /*!< pread without context pointer */
 typedef ssize_t (*esp_vfs_pwrite_ctx_op_t) (void *ctx, int fd, const void *src, size_t size, off_t offset); /*!< pwrite with context pointer */
 typedef ssize_t (*esp_vfs_pwrite_op_t)     (           int fd, const void *src, size_t size, off_t offset); /*!< pwrite without context pointer */
+typedef ssize_t (*esp_vfs_writev_ctx_op_t) (void *ctx, int fd, const struct iovec *iov, int iovcnt);        /*!< writev with context pointer */
+typedef ssize_t (*esp_vfs_writev_op_t)     (           int fd, const struct iovec *iov, int iovcnt);        /*!< writev without context pointer */
+typedef ssize_t (*esp_vfs_readv_ctx_op_t)  (void *ctx, int fd, const struct iovec *iov, int iovcnt);        /*!< readv with context pointer */
+typedef ssize_t (*esp_vfs_readv_op_t)      (           int fd, const struct iovec *iov, int iovcnt);        /*!< readv without context pointer */
 typedef     int (*esp_vfs_open_ctx_op_t)   (void *ctx, const char *path, int flags, int mode);              /*!< open with context pointer */
 typedef     int (*esp_vfs_open_op_t)       (           const char *path, int flags, int mode);              /*!< open without context pointer */
 typedef     int (*esp_vfs_close_ctx_op_t)  (void *ctx, int fd);                                             /*!< close with context pointer */
@@ -268,6 +273,10 @@ typedef     int (*esp_vfs_ioctl_ctx_op_t)  (void *ctx, int fd, int cmd, va_list
 typedef     int (*esp_vfs_ioctl_op_t)      (           int fd, int cmd, va_list args);                      /*!< ioctl without context pointer */
 typedef     int (*esp_vfs_fsync_ctx_op_t)  (void *ctx, int fd);                                             /*!< fsync with context pointer */
 typedef     int (*esp_vfs_fsync_op_t)      (           int fd);                                             /*!< fsync without context pointer */
+typedef   void* (*esp_vfs_mmap_ctx_op_t)   (void *ctx, int fd, void *addr, size_t length, int prot, int flags, off_t offset); /*!< mmap with context pointer */
+typedef   void* (*esp_vfs_mmap_op_t)       (           int fd, void *addr, size_t length, int prot, int flags, off_t offset); /*!< mmap without context pointer */
+typedef     int (*esp_vfs_munmap_ctx_op_t) (void *ctx, void *addr, size_t length);                          /*!< munmap with context pointer */
+typedef     int (*esp_vfs_munmap_op_t)     (           void *addr, size_t length);                          /*!< munmap without context pointer */
 
 /**
  * @brief Main struct of the minified vfs API, containing basic function pointers as well as pointers to the other subcomponents.
@@ -294,6 +303,14 @@ typedef struct {
         const esp_vfs_pwrite_ctx_op_t pwrite_p; /*!< pwrite with context pointer */
         const esp_vfs_pwrite_op_t     pwrite;   /*!< pwrite without context pointer */
     };
+    union {
+        const esp_vfs_writev_ctx_op_t writev_p; /*!< writev with context pointer, optional: when NULL, VFS falls back to one write call per iovec */
+        const esp_vfs_writev_op_t     writev;   /*!< writev without context pointer */
+    };
+    union {
+        const esp_vfs_readv_ctx_op_t  readv_p;  /*!< readv with context pointer, optional: when NULL, VFS falls back to one read call per iovec */
+        const esp_vfs_readv_op_t      readv;    /*!< readv without context pointer */
+    };
     union {
         const esp_vfs_open_ctx_op_t   open_p;   /*!< open with context pointer */
         const esp_vfs_open_op_t       open;     /*!< open without context pointer */
@@ -318,6 +335,14 @@ typedef struct {
         const esp_vfs_fsync_ctx_op_t  fsync_p;  /*!< fsync with context pointer */
         const esp_vfs_fsync_op_t      fsync;    /*!< fsync without context pointer */
     };
+    union {
+        const esp_vfs_mmap_ctx_op_t   mmap_p;   /*!< mmap with context pointer, optional: when NULL, mmap() fails with ENODEV for fds on this filesystem */
+        const esp_vfs_mmap_op_t       mmap;     /*!< mmap without context pointer */
+    };
+    union {
+        const esp_vfs_munmap_ctx_op_t munmap_p; /*!< munmap with context pointer, optional */
+        const esp_vfs_munmap_op_t     munmap;   /*!< munmap without context pointer */
+    };
 
 #ifdef CONFIG_VFS_SUPPORT_DIR
     const esp_vfs_dir_ops_t *const dir;         /*!< pointer to the dir subcomponent */
@@ -109,7 +109,7 @@ void unregister_fd(int fd);
 
 int get_local_fd(const vfs_entry_t *vfs, int fd);
 
-const fd_table_t *get_fd_entry(int fd);
+fd_table_t get_fd_entry(int fd);
 
 size_t get_vfs_count(void);
 
@@ -122,6 +122,21 @@ static inline bool esp_vfs_safe_fd_isset(int fd, const fd_set *fds)
 
 fd_table_t start_select(int fd, fd_set *errorfds);
 
+#ifdef CONFIG_VFS_SUPPORT_SELECT
+/**
+ * The core of esp_vfs_select(), operating on caller provided scratch buffers.
+ *
+ * `vfs_fds_triple` and `driver_args` must be zero initialized arrays of `vfs_count`
+ * elements; their contents are clobbered. If `reusable_sem` is not NULL it is used
+ * instead of creating (and deleting) a local binary semaphore for the non-socket
+ * wait path; ownership stays with the caller. This lets a persistent waiter such as
+ * esp_epoll_wait() keep the per-call heap and semaphore churn out of its hot loop.
+ */
+int esp_vfs_select_with_scratch(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds, struct timeval *timeout,
+                                fds_triple_t *vfs_fds_triple, void **driver_args, size_t vfs_count,
+                                SemaphoreHandle_t reusable_sem);
+#endif // CONFIG_VFS_SUPPORT_SELECT
+
 #ifdef __cplusplus
 }
 #endif
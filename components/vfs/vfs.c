@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stdatomic.h>
 #include <sys/errno.h>
 #include <sys/fcntl.h>
 #include <sys/reent.h>
@@ -51,9 +52,38 @@ _Static_assert(((vfs_index_t) -1) < 0, "vfs_index_t must be a signed type");
 static vfs_entry_t* s_vfs[VFS_MAX_COUNT] = { 0 };
 static size_t s_vfs_count = 0;
 
-static fd_table_t s_fd_table[MAX_FDS] = { [0 ... MAX_FDS-1] = FD_TABLE_ENTRY_UNUSED };
+/* Each fd table entry is packed into a single 32-bit word. The hot I/O path (fd -> vfs
+ * translation on every read/write) takes a coherent snapshot of the whole entry with one
+ * atomic load and never touches s_fd_table_lock; the lock only serializes the writers
+ * (open/close/register and the select bookkeeping), which publish complete entries with
+ * one atomic store. Between mutations the entries are immutable, so readers can never
+ * observe a half-updated (vfs_index, local_fd) pair.
+ */
+typedef union {
+    fd_table_t entry;
+    uint32_t raw;
+} fd_table_word_t;
+
+_Static_assert(sizeof(fd_table_t) <= sizeof(uint32_t), "fd table entry must fit into one atomic word");
+
+static fd_table_word_t s_fd_table[MAX_FDS] = { [0 ... MAX_FDS-1] = { .entry = FD_TABLE_ENTRY_UNUSED } };
 static _lock_t s_fd_table_lock;
 
+// single atomic load -> a consistent view of all fields of the entry
+static inline fd_table_t fd_table_snapshot(int fd)
+{
+    fd_table_word_t w;
+    w.raw = atomic_load_explicit((const _Atomic uint32_t *)&s_fd_table[fd].raw, memory_order_acquire);
+    return w.entry;
+}
+
+// writers (holding s_fd_table_lock) publish the complete entry with a single atomic store
+static inline void fd_table_publish(int fd, fd_table_t entry)
+{
+    fd_table_word_t w = { .entry = entry };
+    atomic_store_explicit((_Atomic uint32_t *)&s_fd_table[fd].raw, w.raw, memory_order_release);
+}
+
 static ssize_t esp_get_free_index(void) {
     for (ssize_t i = 0; i < VFS_MAX_COUNT; i++) {
         if (s_vfs[i] == NULL) {
@@ -253,6 +283,10 @@ static esp_vfs_fs_ops_t* esp_vfs_duplicate_fs_ops(const esp_vfs_fs_ops_t *orig)
         .read = orig->read,
         .pread = orig->pread,
         .pwrite = orig->pwrite,
+        .writev = orig->writev,
+        .readv = orig->readv,
+        .mmap = orig->mmap,
+        .munmap = orig->munmap,
         .open = orig->open,
         .close = orig->close,
         .fstat = orig->fstat,
@@ -545,21 +579,23 @@ esp_err_t esp_vfs_register_fd_range(const esp_vfs_fs_ops_t *vfs, int flags, void
     if (ret == ESP_OK) {
         _lock_acquire(&s_fd_table_lock);
         for (int i = min_fd; i < max_fd; ++i) {
-            if (s_fd_table[i].vfs_index != -1) {
+            if (s_fd_table[i].entry.vfs_index != -1) {
                 free(s_vfs[index]);
                 s_vfs[index] = NULL;
                 for (int j = min_fd; j < i; ++j) {
-                    if (s_fd_table[j].vfs_index == index) {
-                        s_fd_table[j] = FD_TABLE_ENTRY_UNUSED;
+                    if (s_fd_table[j].entry.vfs_index == index) {
+                        fd_table_publish(j, FD_TABLE_ENTRY_UNUSED);
                     }
                 }
                 _lock_release(&s_fd_table_lock);
                 ESP_LOGW(TAG, "esp_vfs_register_fd_range cannot set fd %d (used by other VFS)", i);
                 return ESP_ERR_INVALID_ARG;
             }
-            s_fd_table[i].permanent = true;
-            s_fd_table[i].vfs_index = index;
-            s_fd_table[i].local_fd = i;
+            fd_table_publish(i, (fd_table_t) {
+                .permanent = true,
+                .vfs_index = index,
+                .local_fd = i,
+            });
         }
         _lock_release(&s_fd_table_lock);
 
@@ -591,8 +627,8 @@ esp_err_t esp_vfs_unregister_with_id(esp_vfs_id_t vfs_id)
     _lock_acquire(&s_fd_table_lock);
     // Delete all references from the FD lookup-table
     for (int j = 0; j < VFS_MAX_COUNT; ++j) {
-        if (s_fd_table[j].vfs_index == vfs_id) {
-            s_fd_table[j] = FD_TABLE_ENTRY_UNUSED;
+        if (s_fd_table[j].entry.vfs_index == vfs_id) {
+            fd_table_publish(j, FD_TABLE_ENTRY_UNUSED);
         }
     }
     _lock_release(&s_fd_table_lock);
@@ -641,14 +677,12 @@ esp_err_t esp_vfs_register_fd_with_local_fd(esp_vfs_id_t vfs_id, int local_fd, b
     esp_err_t ret = ESP_ERR_NO_MEM;
     _lock_acquire(&s_fd_table_lock);
     for (int i = 0; i < MAX_FDS; ++i) {
-        if (s_fd_table[i].vfs_index == -1) {
-            s_fd_table[i].permanent = permanent;
-            s_fd_table[i].vfs_index = vfs_id;
-            if (local_fd >= 0) {
-                s_fd_table[i].local_fd = local_fd;
-            } else {
-                s_fd_table[i].local_fd = i;
-            }
+        if (s_fd_table[i].entry.vfs_index == -1) {
+            fd_table_publish(i, (fd_table_t) {
+                .permanent = permanent,
+                .vfs_index = vfs_id,
+                .local_fd = (local_fd >= 0) ? local_fd : i,
+            });
             *fd = i;
             ret = ESP_OK;
             break;
@@ -672,9 +706,9 @@ esp_err_t esp_vfs_unregister_fd(esp_vfs_id_t vfs_id, int fd)
     }
 
     _lock_acquire(&s_fd_table_lock);
-    fd_table_t *item = s_fd_table + fd;
-    if (item->permanent == true && item->vfs_index == vfs_id && item->local_fd == fd) {
-        *item = FD_TABLE_ENTRY_UNUSED;
+    const fd_table_t item = s_fd_table[fd].entry;
+    if (item.permanent == true && item.vfs_index == vfs_id && item.local_fd == fd) {
+        fd_table_publish(fd, FD_TABLE_ENTRY_UNUSED);
         ret = ESP_OK;
     }
     _lock_release(&s_fd_table_lock);
@@ -692,12 +726,12 @@ void esp_vfs_dump_fds(FILE *fp)
     fprintf(fp, "------------------------------------------------------\n");
     _lock_acquire(&s_fd_table_lock);
     for (int index = 0; index < MAX_FDS; index++) {
-        if (s_fd_table[index].vfs_index != -1) {
-            vfs = s_vfs[s_fd_table[index].vfs_index];
+        if (s_fd_table[index].entry.vfs_index != -1) {
+            vfs = s_vfs[s_fd_table[index].entry.vfs_index];
             if (strcmp(vfs->path_prefix, "")) {
-                fprintf(fp, "(%s) - 0x%x - 0x%x\n", vfs->path_prefix, index, s_fd_table[index].local_fd);
+                fprintf(fp, "(%s) - 0x%x - 0x%x\n", vfs->path_prefix, index, s_fd_table[index].entry.local_fd);
             } else {
-                fprintf(fp, "(socket) - 0x%x - 0x%x\n", index, s_fd_table[index].local_fd);
+                fprintf(fp, "(socket) - 0x%x - 0x%x\n", index, s_fd_table[index].entry.local_fd);
             }
         }
     }
@@ -756,10 +790,12 @@ int register_fd(int vfs_index, int local_fd, bool permanent)
 {
     _lock_acquire(&s_fd_table_lock);
     for (int i = 0; i < MAX_FDS; ++i) {
-        if (s_fd_table[i].vfs_index == -1) {
-            s_fd_table[i].permanent = permanent;
-            s_fd_table[i].vfs_index = vfs_index;
-            s_fd_table[i].local_fd = local_fd;
+        if (s_fd_table[i].entry.vfs_index == -1) {
+            fd_table_publish(i, (fd_table_t) {
+                .permanent = permanent,
+                .vfs_index = vfs_index,
+                .local_fd = local_fd,
+            });
             _lock_release(&s_fd_table_lock);
             return i;
         }
@@ -772,17 +808,20 @@ void unregister_fd(int fd)
 {
     _lock_acquire(&s_fd_table_lock);
 
+    fd_table_t entry = s_fd_table[fd].entry;
+
     // Do not close permanent FDs
-    if (s_fd_table[fd].permanent) {
+    if (entry.permanent) {
         _lock_release(&s_fd_table_lock);
         return;
     }
 
     // If the FD is in use by select, mark it for closure
-    if (s_fd_table[fd].has_pending_select) {
-        s_fd_table[fd].has_pending_close = true;
+    if (entry.has_pending_select) {
+        entry.has_pending_close = true;
+        fd_table_publish(fd, entry);
     } else {
-        s_fd_table[fd] = FD_TABLE_ENTRY_UNUSED;
+        fd_table_publish(fd, FD_TABLE_ENTRY_UNUSED);
     }
     _lock_release(&s_fd_table_lock);
 }
@@ -792,16 +831,16 @@ static inline bool fd_valid(int fd)
     return (fd < MAX_FDS) && (fd >= 0);
 }
 
-const fd_table_t *get_fd_entry(int fd)
+fd_table_t get_fd_entry(int fd)
 {
-    return fd_valid(fd) ? &s_fd_table[fd] : NULL;
+    return fd_valid(fd) ? fd_table_snapshot(fd) : FD_TABLE_ENTRY_UNUSED;
 }
 
 const vfs_entry_t *get_vfs_for_fd(int fd)
 {
     const vfs_entry_t *vfs = NULL;
     if (fd_valid(fd)) {
-        const int index = s_fd_table[fd].vfs_index; // single read -> no locking is required
+        const int index = fd_table_snapshot(fd).vfs_index; // lock-free atomic snapshot
         vfs = get_vfs_for_index(index);
     }
     return vfs;
@@ -812,7 +851,13 @@ int get_local_fd(const vfs_entry_t *vfs, int fd)
     int local_fd = -1;
 
     if (vfs && fd_valid(fd)) {
-        local_fd = s_fd_table[fd].local_fd; // single read -> no locking is required
+        // one snapshot delivers a coherent (vfs_index, local_fd) pair; checking that the
+        // entry still belongs to `vfs` rejects an fd that was closed (and possibly reused
+        // by another VFS) after the caller resolved it with get_vfs_for_fd()
+        const fd_table_t entry = fd_table_snapshot(fd);
+        if (entry.vfs_index == vfs->offset) {
+            local_fd = entry.local_fd;
+        }
     }
 
     return local_fd;
@@ -877,8 +922,8 @@ void close_pending(int nfds)
 {
     _lock_acquire(&s_fd_table_lock);
     for (int fd = 0; fd < nfds; ++fd) {
-        if (s_fd_table[fd].has_pending_close) {
-            s_fd_table[fd] = FD_TABLE_ENTRY_UNUSED;
+        if (s_fd_table[fd].entry.has_pending_close) {
+            fd_table_publish(fd, FD_TABLE_ENTRY_UNUSED);
         }
     }
     _lock_release(&s_fd_table_lock);
@@ -888,14 +933,14 @@ fd_table_t start_select(int fd, fd_set *errorfds)
 {
     _lock_acquire(&s_fd_table_lock);
 
+    fd_table_t out = s_fd_table[fd].entry;
+
     // Set flag
     if (esp_vfs_safe_fd_isset(fd, errorfds)) {
-        s_fd_table[fd].has_pending_select = true;
+        out.has_pending_select = true;
+        fd_table_publish(fd, out);
     }
 
-    // Make a copy
-    fd_table_t out = s_fd_table[fd];
-
     _lock_release(&s_fd_table_lock);
 
     return out;
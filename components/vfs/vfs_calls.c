@@ -11,6 +11,8 @@
 #include <sys/ioctl.h>
 #include <sys/reent.h>
 #include <sys/unistd.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
 #include <sys/lock.h>
 #include <sys/param.h>
 #include <dirent.h>
@@ -129,6 +131,170 @@ ssize_t esp_vfs_pwrite(int fd, const void *src, size_t size, off_t offset)
     return ret;
 }
 
+ssize_t esp_vfs_writev(int fd, const struct iovec *iov, int iovcnt)
+{
+    struct _reent __attribute__((unused)) *r = __getreent();
+    const vfs_entry_t *vfs = get_vfs_for_fd(fd);
+    const int local_fd = get_local_fd(vfs, fd);
+    if (vfs == NULL || local_fd < 0) {
+        __errno_r(r) = EBADF;
+        return -1;
+    }
+    if (iov == NULL || iovcnt < 0) {
+        __errno_r(r) = EINVAL;
+        return -1;
+    }
+    if (vfs->vfs->writev != NULL) {
+        ssize_t ret;
+        CHECK_AND_CALL(ret, r, vfs, writev, local_fd, iov, iovcnt);
+        return ret;
+    }
+    /* The driver has no vectored write; issue one write per iovec, resolving
+     * the fd to the VFS entry only once.
+     */
+    ssize_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        ssize_t ret;
+        CHECK_AND_CALL(ret, r, vfs, write, local_fd, iov[i].iov_base, iov[i].iov_len);
+        if (ret < 0) {
+            return (total > 0) ? total : -1;
+        }
+        total += ret;
+        if ((size_t) ret < iov[i].iov_len) {
+            break;
+        }
+    }
+    return total;
+}
+
+ssize_t esp_vfs_readv(int fd, const struct iovec *iov, int iovcnt)
+{
+    struct _reent __attribute__((unused)) *r = __getreent();
+    const vfs_entry_t *vfs = get_vfs_for_fd(fd);
+    const int local_fd = get_local_fd(vfs, fd);
+    if (vfs == NULL || local_fd < 0) {
+        __errno_r(r) = EBADF;
+        return -1;
+    }
+    if (iov == NULL || iovcnt < 0) {
+        __errno_r(r) = EINVAL;
+        return -1;
+    }
+    if (vfs->vfs->readv != NULL) {
+        ssize_t ret;
+        CHECK_AND_CALL(ret, r, vfs, readv, local_fd, iov, iovcnt);
+        return ret;
+    }
+    ssize_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        ssize_t ret;
+        CHECK_AND_CALL(ret, r, vfs, read, local_fd, iov[i].iov_base, iov[i].iov_len);
+        if (ret < 0) {
+            return (total > 0) ? total : -1;
+        }
+        total += ret;
+        if ((size_t) ret < iov[i].iov_len) {
+            break;
+        }
+    }
+    return total;
+}
+
+/* Registry of live mmap() regions: munmap() has no fd argument, so the region
+ * address is used to route the call back to the filesystem driver that
+ * created the mapping.
+ */
+typedef struct vfs_mmap_entry_ {
+    void *addr;
+    size_t length;
+    const vfs_entry_t *vfs;
+    struct vfs_mmap_entry_ *next;
+} vfs_mmap_entry_t;
+
+static vfs_mmap_entry_t *s_mmap_head = NULL;
+static _lock_t s_mmap_lock;
+
+void *esp_vfs_mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
+{
+    struct _reent __attribute__((unused)) *r = __getreent();
+    const vfs_entry_t *vfs = get_vfs_for_fd(fd);
+    const int local_fd = get_local_fd(vfs, fd);
+    if (vfs == NULL || local_fd < 0) {
+        __errno_r(r) = EBADF;
+        return MAP_FAILED;
+    }
+    if (length == 0 || offset < 0) {
+        __errno_r(r) = EINVAL;
+        return MAP_FAILED;
+    }
+    if (vfs->vfs->mmap == NULL) {
+        __errno_r(r) = ENODEV;
+        return MAP_FAILED;
+    }
+    vfs_mmap_entry_t *entry = malloc(sizeof(vfs_mmap_entry_t));
+    if (entry == NULL) {
+        __errno_r(r) = ENOMEM;
+        return MAP_FAILED;
+    }
+    void *ret;
+    if (vfs->flags & ESP_VFS_FLAG_CONTEXT_PTR) {
+        ret = (*vfs->vfs->mmap_p)(vfs->ctx, local_fd, addr, length, prot, flags, offset);
+    } else {
+        ret = (*vfs->vfs->mmap)(local_fd, addr, length, prot, flags, offset);
+    }
+    if (ret == MAP_FAILED) {
+        free(entry);
+        return MAP_FAILED;
+    }
+    entry->addr = ret;
+    entry->length = length;
+    entry->vfs = vfs;
+    _lock_acquire(&s_mmap_lock);
+    entry->next = s_mmap_head;
+    s_mmap_head = entry;
+    _lock_release(&s_mmap_lock);
+    return ret;
+}
+
+int esp_vfs_munmap(void *addr, size_t length)
+{
+    struct _reent __attribute__((unused)) *r = __getreent();
+    _lock_acquire(&s_mmap_lock);
+    vfs_mmap_entry_t **it = &s_mmap_head;
+    while (*it != NULL && (*it)->addr != addr) {
+        it = &(*it)->next;
+    }
+    vfs_mmap_entry_t *entry = *it;
+    if (entry != NULL) {
+        *it = entry->next;
+    }
+    _lock_release(&s_mmap_lock);
+    if (entry == NULL) {
+        __errno_r(r) = EINVAL;
+        return -1;
+    }
+    /* Partial unmapping is not supported: the whole region is released
+     * regardless of the length argument.
+     */
+    const vfs_entry_t *vfs = entry->vfs;
+    int ret = 0;
+    if (vfs->vfs->munmap != NULL) {
+        if (vfs->flags & ESP_VFS_FLAG_CONTEXT_PTR) {
+            ret = (*vfs->vfs->munmap_p)(vfs->ctx, entry->addr, entry->length);
+        } else {
+            ret = (*vfs->vfs->munmap)(entry->addr, entry->length);
+        }
+    }
+    free(entry);
+    return ret;
+}
+
 int esp_vfs_close(struct _reent *r, int fd)
 {
     const vfs_entry_t *vfs = get_vfs_for_fd(fd);
@@ -491,9 +657,9 @@ static int set_global_fd_sets(const fds_triple_t *vfs_fds_triple, int size, fd_s
         const fds_triple_t *item = &vfs_fds_triple[i];
         if (item->isset) {
             for (int fd = 0; fd < MAX_FDS; ++fd) {
-                const fd_table_t *fd_entry = get_fd_entry(fd);
-                if (fd_entry->vfs_index == i) {
-                    const int local_fd = fd_entry->local_fd; // single read -> no locking is required
+                const fd_table_t fd_entry = get_fd_entry(fd);
+                if (fd_entry.vfs_index == i) {
+                    const int local_fd = fd_entry.local_fd; // atomic snapshot -> no locking is required
                     if (readfds && esp_vfs_safe_fd_isset(local_fd, &item->readfds)) {
                         ESP_LOGD(TAG, "FD %d in readfds was set from VFS ID %d", fd, i);
                         FD_SET(fd, readfds);
@@ -529,38 +695,15 @@ static void esp_vfs_log_fd_set(const char *fds_name, const fd_set *fds)
     }
 }
 
-int esp_vfs_select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds, struct timeval *timeout)
+int esp_vfs_select_with_scratch(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds, struct timeval *timeout,
+                                fds_triple_t *vfs_fds_triple, void **driver_args, size_t vfs_count,
+                                SemaphoreHandle_t reusable_sem)
 {
     // NOTE: Please see the "Synchronous input/output multiplexing" section of the ESP-IDF Programming Guide
     // (API Reference -> Storage -> Virtual Filesystem) for a general overview of the implementation of VFS select().
     int ret = 0;
     struct _reent __attribute__((unused)) *r = __getreent();
 
-    ESP_LOGD(TAG, "esp_vfs_select starts with nfds = %d", nfds);
-    if (timeout) {
-        ESP_LOGD(TAG, "timeout is %lds + %ldus", (long)timeout->tv_sec, timeout->tv_usec);
-    }
-    esp_vfs_log_fd_set("readfds", readfds);
-    esp_vfs_log_fd_set("writefds", writefds);
-    esp_vfs_log_fd_set("errorfds", errorfds);
-
-    if (nfds > MAX_FDS || nfds < 0) {
-        ESP_LOGD(TAG, "incorrect nfds");
-        __errno_r(r) = EINVAL;
-        return -1;
-    }
-
-    // Capture s_vfs_count to a local variable in case a new driver is registered or removed during this actual select()
-    // call. s_vfs_count cannot be protected with a mutex during a select() call (which can be one without a timeout)
-    // because that could block the registration of new driver.
-    const size_t vfs_count = get_vfs_count();
-    fds_triple_t *vfs_fds_triple;
-    if ((vfs_fds_triple = heap_caps_calloc(vfs_count, sizeof(fds_triple_t), VFS_MALLOC_FLAGS)) == NULL) {
-        __errno_r(r) = ENOMEM;
-        ESP_LOGD(TAG, "calloc is unsuccessful");
-        return -1;
-    }
-
     esp_vfs_select_sem_t sel_sem = {
         .is_sem_local = false,
         .sem = NULL,
@@ -620,23 +763,19 @@ int esp_vfs_select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds
         // There is no socket VFS registered or select() wasn't called for
         // any socket. Therefore, we will use our own signalization.
         sel_sem.is_sem_local = true;
-        if ((sel_sem.sem = xSemaphoreCreateBinary()) == NULL) {
-            free(vfs_fds_triple);
+        if (reusable_sem != NULL) {
+            // A persistent waiter (esp_epoll) supplies its own semaphore so that one isn't
+            // created and deleted on every call. Drain a stale token which a driver may
+            // have given between the wake-up and the end_select of the previous round.
+            sel_sem.sem = reusable_sem;
+            xSemaphoreTake(sel_sem.sem, 0);
+        } else if ((sel_sem.sem = xSemaphoreCreateBinary()) == NULL) {
             __errno_r(r) = ENOMEM;
             ESP_LOGD(TAG, "cannot create select semaphore");
             return -1;
         }
     }
 
-    void **driver_args = heap_caps_calloc(vfs_count, sizeof(void *), VFS_MALLOC_FLAGS);
-
-    if (driver_args == NULL) {
-        free(vfs_fds_triple);
-        __errno_r(r) = ENOMEM;
-        ESP_LOGD(TAG, "calloc is unsuccessful for driver args");
-        return -1;
-    }
-
     for (size_t i = 0; i < vfs_count; ++i) {
         const vfs_entry_t *vfs = get_vfs_for_index(i);
         fds_triple_t *item = &vfs_fds_triple[i];
@@ -664,12 +803,10 @@ int esp_vfs_select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds
                 call_end_selects(i, vfs_fds_triple, driver_args);
             }
             (void) set_global_fd_sets(vfs_fds_triple, vfs_count, readfds, writefds, errorfds);
-            if (sel_sem.is_sem_local && sel_sem.sem) {
+            if (sel_sem.is_sem_local && sel_sem.sem && sel_sem.sem != reusable_sem) {
                 vSemaphoreDelete(sel_sem.sem);
                 sel_sem.sem = NULL;
             }
-            free(vfs_fds_triple);
-            free(driver_args);
             __errno_r(r) = EINTR;
             ESP_LOGD(TAG, "start_select failed: %s", esp_err_to_name(err));
             return -1;
@@ -720,7 +857,9 @@ int esp_vfs_select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds
     }
     if (sel_sem.sem) { // Cleanup the select semaphore
         if (sel_sem.is_sem_local) {
-            vSemaphoreDelete(sel_sem.sem);
+            if (sel_sem.sem != reusable_sem) {
+                vSemaphoreDelete(sel_sem.sem);
+            }
         } else if (socket_select) {
             SemaphoreHandle_t *s = sel_sem.sem;
             /* Select might have been triggered from both lwip and vfs fds at the same time, and
@@ -731,6 +870,50 @@ int esp_vfs_select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds
         sel_sem.sem = NULL;
     }
     close_pending(nfds);
+
+    return ret;
+}
+
+int esp_vfs_select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds, struct timeval *timeout)
+{
+    struct _reent __attribute__((unused)) *r = __getreent();
+
+    ESP_LOGD(TAG, "esp_vfs_select starts with nfds = %d", nfds);
+    if (timeout) {
+        ESP_LOGD(TAG, "timeout is %lds + %ldus", (long)timeout->tv_sec, timeout->tv_usec);
+    }
+    esp_vfs_log_fd_set("readfds", readfds);
+    esp_vfs_log_fd_set("writefds", writefds);
+    esp_vfs_log_fd_set("errorfds", errorfds);
+
+    if (nfds > MAX_FDS || nfds < 0) {
+        ESP_LOGD(TAG, "incorrect nfds");
+        __errno_r(r) = EINVAL;
+        return -1;
+    }
+
+    // Capture s_vfs_count to a local variable in case a new driver is registered or removed during this actual select()
+    // call. s_vfs_count cannot be protected with a mutex during a select() call (which can be one without a timeout)
+    // because that could block the registration of new driver.
+    const size_t vfs_count = get_vfs_count();
+    fds_triple_t *vfs_fds_triple;
+    if ((vfs_fds_triple = heap_caps_calloc(vfs_count, sizeof(fds_triple_t), VFS_MALLOC_FLAGS)) == NULL) {
+        __errno_r(r) = ENOMEM;
+        ESP_LOGD(TAG, "calloc is unsuccessful");
+        return -1;
+    }
+
+    void **driver_args = heap_caps_calloc(vfs_count, sizeof(void *), VFS_MALLOC_FLAGS);
+    if (driver_args == NULL) {
+        free(vfs_fds_triple);
+        __errno_r(r) = ENOMEM;
+        ESP_LOGD(TAG, "calloc is unsuccessful for driver args");
+        return -1;
+    }
+
+    const int ret = esp_vfs_select_with_scratch(nfds, readfds, writefds, errorfds, timeout,
+                                                vfs_fds_triple, driver_args, vfs_count, NULL);
+
     free(vfs_fds_triple);
     free(driver_args);
 
@@ -914,6 +1097,14 @@ ssize_t pread(int fd, void *dst, size_t size, off_t offset)
     __attribute__((alias("esp_vfs_pread")));
 ssize_t pwrite(int fd, const void *src, size_t size, off_t offset)
     __attribute__((alias("esp_vfs_pwrite")));
+ssize_t writev(int fd, const struct iovec *iov, int iovcnt)
+    __attribute__((alias("esp_vfs_writev")));
+ssize_t readv(int fd, const struct iovec *iov, int iovcnt)
+    __attribute__((alias("esp_vfs_readv")));
+void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
+    __attribute__((alias("esp_vfs_mmap")));
+int munmap(void *addr, size_t length)
+    __attribute__((alias("esp_vfs_munmap")));
 off_t _lseek_r(struct _reent *r, int fd, off_t size, int mode)
     __attribute__((alias("esp_vfs_lseek")));
 int _fcntl_r(struct _reent *r, int fd, int cmd, int arg)
@@ -0,0 +1,276 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/errno.h>
+#include <sys/reent.h>
+#include <sys/lock.h>
+#include <sys/select.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_vfs.h"
+#include "esp_vfs_epoll.h"
+#include "esp_vfs_private.h"
+#include "sdkconfig.h"
+
+#ifdef CONFIG_VFS_SUPPORT_SELECT
+
+static const char *TAG = "vfs_epoll";
+
+#define EPOLL_INTEREST_INITIAL_CAPACITY 4
+
+typedef struct {
+    int fd;
+    uint32_t events;
+    esp_epoll_data_t data;
+} epoll_interest_t;
+
+struct esp_epoll_instance {
+    _lock_t lock;                  // guards the interest list against concurrent esp_epoll_ctl()
+    epoll_interest_t *interest;    // registered descriptors, unordered
+    size_t interest_count;
+    size_t interest_capacity;
+    epoll_interest_t *snapshot;    // copy of the interest list used while the waiter is blocked
+    size_t snapshot_capacity;
+    SemaphoreHandle_t sem;         // persistent wake-up semaphore shared by all waits
+    fds_triple_t *vfs_fds_triple;  // cached per-VFS scratch for the select machinery
+    void **driver_args;
+    size_t vfs_capacity;           // number of elements in vfs_fds_triple and driver_args
+};
+
+esp_err_t esp_epoll_create(esp_epoll_handle_t *out_handle)
+{
+    if (out_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct esp_epoll_instance *inst = heap_caps_calloc(1, sizeof(struct esp_epoll_instance), VFS_MALLOC_FLAGS);
+    if (inst == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    inst->sem = xSemaphoreCreateBinary();
+    if (inst->sem == NULL) {
+        free(inst);
+        return ESP_ERR_NO_MEM;
+    }
+    _lock_init(&inst->lock);
+
+    *out_handle = inst;
+    return ESP_OK;
+}
+
+static epoll_interest_t *find_interest(struct esp_epoll_instance *inst, int fd)
+{
+    for (size_t i = 0; i < inst->interest_count; ++i) {
+        if (inst->interest[i].fd == fd) {
+            return &inst->interest[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t esp_epoll_ctl(esp_epoll_handle_t handle, esp_epoll_op_t op, int fd, const esp_epoll_event_t *event)
+{
+    if (handle == NULL || fd < 0 || fd >= MAX_FDS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (op != ESP_EPOLL_CTL_DEL && event == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+    _lock_acquire(&handle->lock);
+    epoll_interest_t *entry = find_interest(handle, fd);
+
+    switch (op) {
+    case ESP_EPOLL_CTL_ADD:
+        if (entry != NULL) {
+            ret = ESP_ERR_INVALID_STATE;
+            break;
+        }
+        if (handle->interest_count == handle->interest_capacity) {
+            const size_t new_capacity = (handle->interest_capacity == 0) ?
+                                        EPOLL_INTEREST_INITIAL_CAPACITY : handle->interest_capacity * 2;
+            epoll_interest_t *new_interest = heap_caps_realloc(handle->interest,
+                                                               new_capacity * sizeof(epoll_interest_t),
+                                                               VFS_MALLOC_FLAGS);
+            if (new_interest == NULL) {
+                ret = ESP_ERR_NO_MEM;
+                break;
+            }
+            handle->interest = new_interest;
+            handle->interest_capacity = new_capacity;
+        }
+        handle->interest[handle->interest_count++] = (epoll_interest_t) {
+            .fd = fd,
+            .events = event->events,
+            .data = event->data,
+        };
+        break;
+    case ESP_EPOLL_CTL_MOD:
+        if (entry == NULL) {
+            ret = ESP_ERR_NOT_FOUND;
+            break;
+        }
+        entry->events = event->events;
+        entry->data = event->data;
+        break;
+    case ESP_EPOLL_CTL_DEL:
+        if (entry == NULL) {
+            ret = ESP_ERR_NOT_FOUND;
+            break;
+        }
+        // order is not significant, move the last entry into the hole
+        *entry = handle->interest[--handle->interest_count];
+        break;
+    default:
+        ret = ESP_ERR_INVALID_ARG;
+        break;
+    }
+    _lock_release(&handle->lock);
+    return ret;
+}
+
+// Grow the cached per-VFS scratch buffers when drivers were registered since the last wait.
+// The buffers are reused (just zeroed) between waits, which is the point of the whole exercise.
+static esp_err_t ensure_vfs_scratch(struct esp_epoll_instance *inst, size_t vfs_count)
+{
+    if (vfs_count > inst->vfs_capacity) {
+        fds_triple_t *new_triple = heap_caps_realloc(inst->vfs_fds_triple,
+                                                     vfs_count * sizeof(fds_triple_t), VFS_MALLOC_FLAGS);
+        if (new_triple == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        inst->vfs_fds_triple = new_triple;
+
+        void **new_args = heap_caps_realloc(inst->driver_args, vfs_count * sizeof(void *), VFS_MALLOC_FLAGS);
+        if (new_args == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        inst->driver_args = new_args;
+        inst->vfs_capacity = vfs_count;
+    }
+    memset(inst->vfs_fds_triple, 0, vfs_count * sizeof(fds_triple_t));
+    memset(inst->driver_args, 0, vfs_count * sizeof(void *));
+    return ESP_OK;
+}
+
+int esp_epoll_wait(esp_epoll_handle_t handle, esp_epoll_event_t *out_events, int max_events, int timeout_ms)
+{
+    struct _reent __attribute__((unused)) *r = __getreent();
+
+    if (handle == NULL || out_events == NULL || max_events <= 0) {
+        __errno_r(r) = EINVAL;
+        return -1;
+    }
+
+    // Work on a snapshot of the interest list so that esp_epoll_ctl() from another
+    // task is never blocked for the duration of the wait; such changes take effect
+    // on the next call.
+    _lock_acquire(&handle->lock);
+    const size_t count = handle->interest_count;
+    if (count > handle->snapshot_capacity) {
+        epoll_interest_t *new_snapshot = heap_caps_realloc(handle->snapshot,
+                                                           handle->interest_capacity * sizeof(epoll_interest_t),
+                                                           VFS_MALLOC_FLAGS);
+        if (new_snapshot == NULL) {
+            _lock_release(&handle->lock);
+            __errno_r(r) = ENOMEM;
+            return -1;
+        }
+        handle->snapshot = new_snapshot;
+        handle->snapshot_capacity = handle->interest_capacity;
+    }
+    memcpy(handle->snapshot, handle->interest, count * sizeof(epoll_interest_t));
+    _lock_release(&handle->lock);
+
+    // Capture the VFS count like esp_vfs_select() does; a driver registered while
+    // we are blocked is picked up on the next call.
+    const size_t vfs_count = get_vfs_count();
+    if (ensure_vfs_scratch(handle, vfs_count) != ESP_OK) {
+        __errno_r(r) = ENOMEM;
+        ESP_LOGD(TAG, "cannot grow the per-VFS scratch buffers");
+        return -1;
+    }
+
+    fd_set readfds;
+    fd_set writefds;
+    fd_set errorfds;
+    FD_ZERO(&readfds);
+    FD_ZERO(&writefds);
+    FD_ZERO(&errorfds);
+    int nfds = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const epoll_interest_t *item = &handle->snapshot[i];
+        if (item->events & ESP_EPOLLIN) {
+            FD_SET(item->fd, &readfds);
+        }
+        if (item->events & ESP_EPOLLOUT) {
+            FD_SET(item->fd, &writefds);
+        }
+        if (item->events & ESP_EPOLLERR) {
+            FD_SET(item->fd, &errorfds);
+        }
+        nfds = MAX(nfds, item->fd + 1);
+    }
+
+    struct timeval timeout;
+    struct timeval *timeout_ptr = NULL;
+    if (timeout_ms >= 0) {
+        timeout.tv_sec = timeout_ms / 1000;
+        timeout.tv_usec = (timeout_ms % 1000) * 1000;
+        timeout_ptr = &timeout;
+    }
+
+    const int ret = esp_vfs_select_with_scratch(nfds, &readfds, &writefds, &errorfds, timeout_ptr,
+                                                handle->vfs_fds_triple, handle->driver_args, vfs_count,
+                                                handle->sem);
+    if (ret <= 0) {
+        return ret; // on error, errno has been set by the select machinery
+    }
+
+    int triggered = 0;
+    for (size_t i = 0; i < count && triggered < max_events; ++i) {
+        const epoll_interest_t *item = &handle->snapshot[i];
+        uint32_t revents = 0;
+        if ((item->events & ESP_EPOLLIN) && FD_ISSET(item->fd, &readfds)) {
+            revents |= ESP_EPOLLIN;
+        }
+        if ((item->events & ESP_EPOLLOUT) && FD_ISSET(item->fd, &writefds)) {
+            revents |= ESP_EPOLLOUT;
+        }
+        if ((item->events & ESP_EPOLLERR) && FD_ISSET(item->fd, &errorfds)) {
+            revents |= ESP_EPOLLERR;
+        }
+        if (revents != 0) {
+            out_events[triggered].events = revents;
+            out_events[triggered].data = item->data;
+            ++triggered;
+        }
+    }
+    return triggered;
+}
+
+esp_err_t esp_epoll_close(esp_epoll_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    vSemaphoreDelete(handle->sem);
+    _lock_close(&handle->lock);
+    free(handle->interest);
+    free(handle->snapshot);
+    free(handle->vfs_fds_triple);
+    free(handle->driver_args);
+    free(handle);
+    return ESP_OK;
+}
+
+#endif // CONFIG_VFS_SUPPORT_SELECT
@@ -17,14 +17,30 @@ static const char *TAG = "wl_ext_perf";
         return (result); \
     }
 
+#if CONFIG_WL_WRITE_CACHE
+#define WL_CACHE_SLOT_FREE UINT32_MAX
+#endif // CONFIG_WL_WRITE_CACHE
+
 WL_Ext_Perf::WL_Ext_Perf(): WL_Flash()
 {
     this->sector_buffer = NULL;
+#if CONFIG_WL_WRITE_CACHE
+    this->cache_slots = NULL;
+    this->cache_stamp_counter = 0;
+#endif // CONFIG_WL_WRITE_CACHE
 }
 
 WL_Ext_Perf::~WL_Ext_Perf()
 {
     free(this->sector_buffer);
+#if CONFIG_WL_WRITE_CACHE
+    if (this->cache_slots != NULL) {
+        for (int i = 0; i < CONFIG_WL_WRITE_CACHE_SLOTS; i++) {
+            free(this->cache_slots[i].data);
+        }
+        free(this->cache_slots);
+    }
+#endif // CONFIG_WL_WRITE_CACHE
 }
 
 esp_err_t WL_Ext_Perf::config(WL_Config_s *cfg, Partition *partition)
@@ -46,6 +62,24 @@ esp_err_t WL_Ext_Perf::config(WL_Config_s *cfg, Partition *partition)
         return ESP_ERR_NO_MEM;
     }
 
+#if CONFIG_WL_WRITE_CACHE
+    /*the dirty and valid bitmaps are 32 bits wide, and caching whole flash
+     sectors only pays off when several fat sectors share one of them*/
+    if ((this->flash_fat_sector_size_factor > 1) && (this->flash_fat_sector_size_factor <= 32)) {
+        this->cache_slots = (wl_cache_slot_t *)calloc(CONFIG_WL_WRITE_CACHE_SLOTS, sizeof(wl_cache_slot_t));
+        if (this->cache_slots == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        for (int i = 0; i < CONFIG_WL_WRITE_CACHE_SLOTS; i++) {
+            this->cache_slots[i].flash_sector = WL_CACHE_SLOT_FREE;
+            this->cache_slots[i].data = (uint8_t *)malloc(ext_cfg->flash_sector_size);
+            if (this->cache_slots[i].data == NULL) {
+                return ESP_ERR_NO_MEM; // remaining slots are freed by the destructor
+            }
+        }
+    }
+#endif // CONFIG_WL_WRITE_CACHE
+
     return WL_Flash::config(cfg, partition);
 }
 
@@ -66,6 +100,17 @@ size_t WL_Ext_Perf::get_sector_size()
 
 esp_err_t WL_Ext_Perf::erase_sector(size_t sector)
 {
+#if CONFIG_WL_WRITE_CACHE
+    if (this->cache_slots != NULL) {
+        // the whole flash sector is going away, cached content for it is obsolete
+        wl_cache_slot_t *slot = this->cache_find(sector);
+        if (slot != NULL) {
+            slot->flash_sector = WL_CACHE_SLOT_FREE;
+            slot->valid_map = 0;
+            slot->dirty_map = 0;
+        }
+    }
+#endif // CONFIG_WL_WRITE_CACHE
     return WL_Flash::erase_sector(sector);
 }
 
@@ -122,6 +167,12 @@ esp_err_t WL_Ext_Perf::erase_range(size_t start_address, size_t size)
     }
     WL_EXT_RESULT_CHECK(result);
 
+#if CONFIG_WL_WRITE_CACHE
+    if (this->cache_slots != NULL) {
+        return this->erase_range_cached(start_address, size);
+    }
+#endif // CONFIG_WL_WRITE_CACHE
+
     // The range to erase could be allocated in any possible way
     // ---------------------------------------------------------
     // |       |       |       |       |
@@ -184,3 +235,215 @@ esp_err_t WL_Ext_Perf::erase_range(size_t start_address, size_t size)
     }
     return ESP_OK;
 }
+
+#if CONFIG_WL_WRITE_CACHE
+
+WL_Ext_Perf::wl_cache_slot_t *WL_Ext_Perf::cache_find(uint32_t flash_sector)
+{
+    for (int i = 0; i < CONFIG_WL_WRITE_CACHE_SLOTS; i++) {
+        if (this->cache_slots[i].flash_sector == flash_sector) {
+            this->cache_slots[i].stamp = ++this->cache_stamp_counter;
+            return &this->cache_slots[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t WL_Ext_Perf::cache_get(uint32_t flash_sector, wl_cache_slot_t **out_slot)
+{
+    wl_cache_slot_t *slot = this->cache_find(flash_sector);
+    if (slot == NULL) {
+        // take a free slot if there is one, otherwise evict the least recently used
+        slot = &this->cache_slots[0];
+        for (int i = 0; i < CONFIG_WL_WRITE_CACHE_SLOTS; i++) {
+            if (this->cache_slots[i].flash_sector == WL_CACHE_SLOT_FREE) {
+                slot = &this->cache_slots[i];
+                break;
+            }
+            if (this->cache_slots[i].stamp < slot->stamp) {
+                slot = &this->cache_slots[i];
+            }
+        }
+        esp_err_t result = this->cache_flush_slot(slot);
+        WL_EXT_RESULT_CHECK(result);
+        slot->flash_sector = flash_sector;
+        slot->valid_map = 0;
+        slot->dirty_map = 0;
+        slot->stamp = ++this->cache_stamp_counter;
+    }
+    *out_slot = slot;
+    return ESP_OK;
+}
+
+esp_err_t WL_Ext_Perf::cache_flush_slot(wl_cache_slot_t *slot)
+{
+    esp_err_t result = ESP_OK;
+    if ((slot->flash_sector == WL_CACHE_SLOT_FREE) || (slot->dirty_map == 0)) {
+        return ESP_OK;
+    }
+    ESP_LOGV(TAG, "%s flash_sector = 0x%08" PRIx32 ", dirty_map = 0x%08" PRIx32, __func__, slot->flash_sector, slot->dirty_map);
+    // complete the sector image with the parts which were never touched
+    for (uint32_t i = 0; i < this->flash_fat_sector_size_factor; i++) {
+        if ((slot->valid_map & (1UL << i)) == 0) {
+            result = WL_Flash::read(slot->flash_sector * this->flash_sector_size + i * this->fat_sector_size,
+                                    &slot->data[i * this->fat_sector_size],
+                                    this->fat_sector_size);
+            WL_EXT_RESULT_CHECK(result);
+            slot->valid_map |= 1UL << i;
+        }
+    }
+    // one erase and one program instead of a read-modify-write per fat sector
+    result = WL_Flash::erase_sector(slot->flash_sector);
+    WL_EXT_RESULT_CHECK(result);
+    result = WL_Flash::write(slot->flash_sector * this->flash_sector_size, slot->data, this->flash_sector_size);
+    WL_EXT_RESULT_CHECK(result);
+    slot->dirty_map = 0;
+    return ESP_OK;
+}
+
+esp_err_t WL_Ext_Perf::cache_flush_range(size_t start_address, size_t size, bool drop)
+{
+    esp_err_t result = ESP_OK;
+    for (int i = 0; i < CONFIG_WL_WRITE_CACHE_SLOTS; i++) {
+        wl_cache_slot_t *slot = &this->cache_slots[i];
+        if (slot->flash_sector == WL_CACHE_SLOT_FREE) {
+            continue;
+        }
+        size_t slot_start = slot->flash_sector * this->flash_sector_size;
+        if ((slot_start < start_address + size) && (slot_start + this->flash_sector_size > start_address)) {
+            result = this->cache_flush_slot(slot);
+            WL_EXT_RESULT_CHECK(result);
+            if (drop) {
+                slot->flash_sector = WL_CACHE_SLOT_FREE;
+                slot->valid_map = 0;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t WL_Ext_Perf::erase_range_cached(size_t start_address, size_t size)
+{
+    esp_err_t result = ESP_OK;
+    ESP_LOGV(TAG, "%s begin, addr = 0x%08" PRIx32 ", size = %" PRIu32, __func__, (uint32_t) start_address, (uint32_t) size);
+
+    size_t addr = start_address;
+    size_t end_address = start_address + size;
+    while (addr < end_address) {
+        uint32_t flash_sector = addr / this->flash_sector_size;
+        uint32_t first_fat_sector = (addr % this->flash_sector_size) / this->fat_sector_size;
+        uint32_t fat_sector_count = (end_address - addr) / this->fat_sector_size;
+        if (fat_sector_count > this->flash_fat_sector_size_factor - first_fat_sector) {
+            fat_sector_count = this->flash_fat_sector_size_factor - first_fat_sector;
+        }
+        if (fat_sector_count == this->flash_fat_sector_size_factor) {
+            // the whole flash sector is erased, no need to buffer anything
+            result = this->erase_sector(flash_sector);
+            WL_EXT_RESULT_CHECK(result);
+        } else {
+            /* sub-sector erase is absorbed by the cache: the region is marked
+             erased in the slot and the physical erase happens on flush,
+             merged with the writes which typically follow right away */
+            wl_cache_slot_t *slot;
+            result = this->cache_get(flash_sector, &slot);
+            WL_EXT_RESULT_CHECK(result);
+            memset(&slot->data[first_fat_sector * this->fat_sector_size], 0xFF,
+                   fat_sector_count * this->fat_sector_size);
+            for (uint32_t i = first_fat_sector; i < first_fat_sector + fat_sector_count; i++) {
+                slot->valid_map |= 1UL << i;
+                slot->dirty_map |= 1UL << i;
+            }
+        }
+        addr += fat_sector_count * this->fat_sector_size;
+    }
+    return ESP_OK;
+}
+
+esp_err_t WL_Ext_Perf::write(size_t dest_addr, const void *src, size_t size)
+{
+    esp_err_t result = ESP_OK;
+    if (this->cache_slots == NULL) {
+        return WL_Flash::write(dest_addr, src, size);
+    }
+    if (((dest_addr % this->fat_sector_size) != 0) || ((size % this->fat_sector_size) != 0)) {
+        // unaligned writes bypass the cache; bring the flash up to date first
+        result = this->cache_flush_range(dest_addr, size, true);
+        WL_EXT_RESULT_CHECK(result);
+        return WL_Flash::write(dest_addr, src, size);
+    }
+    const uint8_t *src_bytes = (const uint8_t *)src;
+    for (size_t addr = dest_addr; addr < dest_addr + size; addr += this->fat_sector_size) {
+        uint32_t flash_sector = addr / this->flash_sector_size;
+        uint32_t fat_sector = (addr % this->flash_sector_size) / this->fat_sector_size;
+        wl_cache_slot_t *slot;
+        result = this->cache_get(flash_sector, &slot);
+        WL_EXT_RESULT_CHECK(result);
+        memcpy(&slot->data[fat_sector * this->fat_sector_size], src_bytes, this->fat_sector_size);
+        slot->valid_map |= 1UL << fat_sector;
+        slot->dirty_map |= 1UL << fat_sector;
+        src_bytes += this->fat_sector_size;
+    }
+    return ESP_OK;
+}
+
+esp_err_t WL_Ext_Perf::read(size_t src_addr, void *dest, size_t size)
+{
+    esp_err_t result = ESP_OK;
+    if (this->cache_slots == NULL) {
+        return WL_Flash::read(src_addr, dest, size);
+    }
+    uint8_t *dest_bytes = (uint8_t *)dest;
+    size_t addr = src_addr;
+    size_t remaining = size;
+    while (remaining > 0) {
+        uint32_t flash_sector = addr / this->flash_sector_size;
+        size_t sector_offset = addr % this->flash_sector_size;
+        size_t chunk = this->flash_sector_size - sector_offset;
+        if (chunk > remaining) {
+            chunk = remaining;
+        }
+        wl_cache_slot_t *slot = this->cache_find(flash_sector);
+        if (slot != NULL) {
+            uint32_t first_fat_sector = sector_offset / this->fat_sector_size;
+            uint32_t last_fat_sector = (sector_offset + chunk - 1) / this->fat_sector_size;
+            uint32_t mask = 0;
+            for (uint32_t i = first_fat_sector; i <= last_fat_sector; i++) {
+                mask |= 1UL << i;
+            }
+            if ((slot->valid_map & mask) != mask) {
+                /* part of the requested range is only on flash; flushing
+                 completes the slot image, after which it can serve the read */
+                result = this->cache_flush_slot(slot);
+                WL_EXT_RESULT_CHECK(result);
+            }
+            if ((slot->valid_map & mask) == mask) {
+                memcpy(dest_bytes, &slot->data[sector_offset], chunk);
+            } else {
+                // slot held no dirty data and was not completed, read through
+                result = WL_Flash::read(addr, dest_bytes, chunk);
+                WL_EXT_RESULT_CHECK(result);
+            }
+        } else {
+            result = WL_Flash::read(addr, dest_bytes, chunk);
+            WL_EXT_RESULT_CHECK(result);
+        }
+        addr += chunk;
+        dest_bytes += chunk;
+        remaining -= chunk;
+    }
+    return ESP_OK;
+}
+
+esp_err_t WL_Ext_Perf::flush()
+{
+    esp_err_t result = ESP_OK;
+    if (this->cache_slots != NULL) {
+        for (int i = 0; i < CONFIG_WL_WRITE_CACHE_SLOTS; i++) {
+            result = this->cache_flush_slot(&this->cache_slots[i]);
+            WL_EXT_RESULT_CHECK(result);
+        }
+    }
+    return WL_Flash::flush();
+}
+
+#endif // CONFIG_WL_WRITE_CACHE
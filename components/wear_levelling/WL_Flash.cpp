@@ -29,6 +29,23 @@ static const char *TAG = "wl_flash";
 static_assert(sizeof(wl_state_t) % 32 == 0, "wl_state_t structure size must be multiple of flash encryption unit size");
 #endif // _MSC_VER
 
+#if CONFIG_WL_PRE_ERASE
+static inline bool s_bit_get(const uint8_t *bits, size_t n)
+{
+    return (bits[n / 8] & (1 << (n % 8))) != 0;
+}
+
+static inline void s_bit_set(uint8_t *bits, size_t n)
+{
+    bits[n / 8] |= (1 << (n % 8));
+}
+
+static inline void s_bit_clear(uint8_t *bits, size_t n)
+{
+    bits[n / 8] &= ~(1 << (n % 8));
+}
+#endif // CONFIG_WL_PRE_ERASE
+
 
 WL_Flash::WL_Flash()
 {
@@ -37,6 +54,10 @@ WL_Flash::WL_Flash()
 WL_Flash::~WL_Flash()
 {
     free(this->temp_buff);
+#if CONFIG_WL_PRE_ERASE
+    free(this->clean_bits);
+    free(this->trim_bits);
+#endif
 }
 
 esp_err_t WL_Flash::config(wl_config_t *cfg, Partition *partition)
@@ -106,6 +127,19 @@ esp_err_t WL_Flash::config(wl_config_t *cfg, Partition *partition)
         result = ESP_ERR_NO_MEM;
     }
     WL_RESULT_CHECK(result);
+
+#if CONFIG_WL_PRE_ERASE
+    this->total_sec_count = this->flash_size / this->cfg.flash_sector_size;
+    size_t bitmap_size = (this->total_sec_count + 7) / 8;
+    this->clean_bits = (uint8_t *)calloc(1, bitmap_size);
+    this->trim_bits = (uint8_t *)calloc(1, bitmap_size);
+    if ((this->clean_bits == NULL) || (this->trim_bits == NULL)) {
+        result = ESP_ERR_NO_MEM;
+    }
+    WL_RESULT_CHECK(result);
+    this->clean_sec_count = 0;
+#endif // CONFIG_WL_PRE_ERASE
+
     this->configured = true;
     return ESP_OK;
 }
@@ -547,11 +581,26 @@ esp_err_t WL_Flash::erase_sector(size_t sector)
         return ESP_ERR_INVALID_STATE;
     }
     ESP_LOGD(TAG, "%s - sector= 0x%08" PRIx32 , __func__, (uint32_t) sector);
+#if CONFIG_WL_PRE_ERASE
+    if ((sector < this->total_sec_count) && s_bit_get(this->clean_bits, sector)) {
+        // The sector is already in erased state, both the physical erase and
+        // its wear accounting can be skipped
+        s_bit_clear(this->trim_bits, sector);
+        return ESP_OK;
+    }
+#endif
     result = this->updateWL();
     WL_RESULT_CHECK(result);
     size_t virt_addr = this->calcAddr(sector * this->cfg.flash_sector_size);
     result = this->partition->erase_sector((this->cfg.wl_partition_start_addr + virt_addr) / this->cfg.flash_sector_size);
     WL_RESULT_CHECK(result);
+#if CONFIG_WL_PRE_ERASE
+    if (sector < this->total_sec_count) {
+        s_bit_set(this->clean_bits, sector);
+        this->clean_sec_count++;
+        s_bit_clear(this->trim_bits, sector);
+    }
+#endif
     return result;
 }
 
@@ -572,6 +621,47 @@ esp_err_t WL_Flash::erase_range(size_t start_address, size_t size)
     return result;
 }
 
+#if CONFIG_WL_PRE_ERASE
+esp_err_t WL_Flash::trim(size_t start_address, size_t size)
+{
+    if (!this->initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    ESP_LOGD(TAG, "%s - start_address= 0x%08" PRIx32 ", size= 0x%08" PRIx32 , __func__, (uint32_t) start_address, (uint32_t) size);
+    // only sectors fully covered by the range may be erased in the background
+    size_t first_sec = (start_address + this->cfg.flash_sector_size - 1) / this->cfg.flash_sector_size;
+    size_t end_sec = (start_address + size) / this->cfg.flash_sector_size;
+    for (size_t sec = first_sec; (sec < end_sec) && (sec < this->total_sec_count); sec++) {
+        if (!s_bit_get(this->clean_bits, sec)) {
+            s_bit_set(this->trim_bits, sec);
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t WL_Flash::erase_next_trimmed(bool *out_erased)
+{
+    esp_err_t result = ESP_OK;
+    *out_erased = false;
+    if (!this->initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (this->clean_sec_count >= CONFIG_WL_PRE_ERASE_POOL_DEPTH) {
+        // enough sectors are ready, do not spend erase cycles ahead of time
+        return ESP_OK;
+    }
+    for (size_t sec = 0; sec < this->total_sec_count; sec++) {
+        if (s_bit_get(this->trim_bits, sec)) {
+            result = WL_Flash::erase_sector(sec);
+            WL_RESULT_CHECK(result);
+            *out_erased = true;
+            return ESP_OK;
+        }
+    }
+    return ESP_OK;
+}
+#endif // CONFIG_WL_PRE_ERASE
+
 esp_err_t WL_Flash::write(size_t dest_addr, const void *src, size_t size)
 {
     esp_err_t result = ESP_OK;
@@ -579,6 +669,17 @@ esp_err_t WL_Flash::write(size_t dest_addr, const void *src, size_t size)
         return ESP_ERR_INVALID_STATE;
     }
     ESP_LOGD(TAG, "%s - dest_addr= 0x%08" PRIx32 ", size= 0x%08" PRIx32 , __func__, (uint32_t) dest_addr, (uint32_t) size);
+#if CONFIG_WL_PRE_ERASE
+    size_t first_sec = dest_addr / this->cfg.flash_sector_size;
+    size_t last_sec = (dest_addr + size - 1) / this->cfg.flash_sector_size;
+    for (size_t sec = first_sec; (sec <= last_sec) && (sec < this->total_sec_count); sec++) {
+        if (s_bit_get(this->clean_bits, sec)) {
+            s_bit_clear(this->clean_bits, sec);
+            this->clean_sec_count--;
+        }
+        s_bit_clear(this->trim_bits, sec);
+    }
+#endif
     uint32_t count = (size - 1) / this->cfg.wl_page_size;
     for (size_t i = 0; i < count; i++) {
         size_t virt_addr = this->calcAddr(dest_addr + i * this->cfg.wl_page_size);
@@ -9,6 +9,7 @@
 
 #include "esp_log.h"
 #include "esp_partition.h"
+#include "sdkconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -104,6 +105,47 @@ esp_err_t wl_write(wl_handle_t handle, size_t dest_addr, const void *src, size_t
 */
 esp_err_t wl_read(wl_handle_t handle, size_t src_addr, void *dest, size_t size);
 
+#if CONFIG_WL_PRE_ERASE
+/**
+* @brief Mark part of the WL storage as unused
+*
+* The given range holds no live data and may be erased at any time. Sectors
+* fully covered by the range are handed to a low priority background task
+* which keeps a pool of pre-erased sectors (CONFIG_WL_PRE_ERASE_POOL_DEPTH).
+* A subsequent wl_erase_range of a pre-erased sector completes without the
+* physical erase, so the caller does not wait out the sector erase time.
+*
+* @param handle WL handle that is related to the partition
+* @param start_addr Address from where the unused range starts, relative to the
+*                   beginning of the partition.
+* @param size Size of the unused range, in bytes.
+*
+* @return
+*       - ESP_OK, if the range was recorded successfully;
+*       - ESP_ERR_NOT_FOUND, if the handle is not valid;
+*/
+esp_err_t wl_trim(wl_handle_t handle, size_t start_addr, size_t size);
+#endif // CONFIG_WL_PRE_ERASE
+
+#if CONFIG_WL_WRITE_CACHE
+/**
+* @brief Write back all data buffered in the WL write cache
+*
+* With CONFIG_WL_WRITE_CACHE enabled, sub-sector erase and write requests are
+* coalesced in RAM and programmed to flash when a cache slot is evicted. Call
+* this function to force the buffered data out, e.g. after the filesystem
+* reports a sync. Unmounting flushes implicitly.
+*
+* @param handle WL module instance that was initialized before
+*
+* @return
+*       - ESP_OK, if all buffered data was written back successfully;
+*       - ESP_ERR_NOT_FOUND, if the handle is not valid;
+*       - or one of error codes from lower-level flash driver.
+*/
+esp_err_t wl_flush(wl_handle_t handle);
+#endif // CONFIG_WL_WRITE_CACHE
+
 /**
 * @brief Get the actual flash size in use for the WL storage partition
 *
@@ -9,6 +9,7 @@
 #include "Partition.h"
 #include "WL_Flash.h"
 #include "WL_Ext_Cfg.h"
+#include "sdkconfig.h"
 
 class WL_Ext_Perf : public WL_Flash
 {
@@ -25,6 +26,12 @@ public:
     esp_err_t erase_sector(size_t sector) override;
     esp_err_t erase_range(size_t start_address, size_t size) override;
 
+#if CONFIG_WL_WRITE_CACHE
+    esp_err_t write(size_t dest_addr, const void *src, size_t size) override;
+    esp_err_t read(size_t src_addr, void *dest, size_t size) override;
+    esp_err_t flush() override;
+#endif // CONFIG_WL_WRITE_CACHE
+
 protected:
     uint32_t flash_sector_size;
     uint32_t fat_sector_size;
@@ -37,6 +44,27 @@ protected:
 
     virtual esp_err_t erase_sector_fit(uint32_t start_sector, uint32_t count);
 
+#if CONFIG_WL_WRITE_CACHE
+    /*Write cache slot buffering one flash device sector. Sub-sector erase and
+     write requests accumulate in the slot and are merged into a single
+     read-erase-program cycle when the slot is flushed*/
+    typedef struct {
+        uint32_t flash_sector;  // flash device sector held by the slot; WL_CACHE_SLOT_FREE if unused
+        uint8_t *data;          // buffer of flash_sector_size bytes
+        uint32_t valid_map;     // bitmap of fat sectors in data holding up-to-date content
+        uint32_t dirty_map;     // bitmap of fat sectors modified since the last flush
+        uint32_t stamp;         // LRU stamp; slots with older stamps are evicted first
+    } wl_cache_slot_t;
+
+    wl_cache_slot_t *cache_slots;   // array of CONFIG_WL_WRITE_CACHE_SLOTS slots; NULL if the cache is inactive
+    uint32_t cache_stamp_counter;   // monotonic stamp source for LRU eviction
+
+    wl_cache_slot_t *cache_find(uint32_t flash_sector);
+    esp_err_t cache_get(uint32_t flash_sector, wl_cache_slot_t **out_slot);
+    esp_err_t cache_flush_slot(wl_cache_slot_t *slot);
+    esp_err_t cache_flush_range(size_t start_address, size_t size, bool drop);
+    esp_err_t erase_range_cached(size_t start_address, size_t size);
+#endif // CONFIG_WL_WRITE_CACHE
 };
 
 #endif // _WL_Ext_Perf_H_
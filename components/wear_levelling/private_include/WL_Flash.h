@@ -7,6 +7,7 @@
 #define _WL_Flash_H_
 
 #include "esp_err.h"
+#include "sdkconfig.h"
 #include "Flash_Access.h"
 #include "Partition.h"
 #include "WL_Config.h"
@@ -36,6 +37,26 @@ public :
 
     esp_err_t flush() override;
 
+#if CONFIG_WL_PRE_ERASE
+    /**
+    * @brief Mark a range of the logical address space as unused
+    *
+    * Sectors fully covered by the range become candidates for the background
+    * pre-erase; a later erase_sector() of such a sector completes without
+    * touching the flash.
+    */
+    esp_err_t trim(size_t start_address, size_t size);
+
+    /**
+    * @brief Erase one trimmed sector, if the pre-erased pool is not full
+    *
+    * @param[out] out_erased set to true when a sector was erased and another
+    *             call may find more work, false when the pool is full or no
+    *             trimmed sector is left
+    */
+    esp_err_t erase_next_trimmed(bool *out_erased);
+#endif // CONFIG_WL_PRE_ERASE
+
     Partition *get_part();
     wl_config_t *get_cfg();
 
@@ -56,6 +77,12 @@ protected:
     uint32_t state_size;
     uint32_t cfg_size;
     uint8_t *temp_buff = NULL;
+#if CONFIG_WL_PRE_ERASE
+    uint8_t *clean_bits = NULL; // logical sectors known to be in erased state
+    uint8_t *trim_bits = NULL;  // logical sectors reported as unused, erasable in background
+    size_t clean_sec_count = 0;
+    size_t total_sec_count = 0;
+#endif // CONFIG_WL_PRE_ERASE
     size_t dummy_addr;
     uint32_t pos_data[4];
 
@@ -15,6 +15,10 @@
 #include "WL_Ext_Safe.h"
 #include "SPI_Flash.h"
 #include "Partition.h"
+#if CONFIG_WL_PRE_ERASE
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
 
 #ifndef MAX_WL_HANDLES
 #define MAX_WL_HANDLES 8
@@ -40,6 +44,10 @@
 #define WL_CURRENT_VERSION  2
 #endif //WL_CURRENT_VERSION
 
+#ifndef WL_PRE_ERASE_TASK_STACK_SIZE
+#define WL_PRE_ERASE_TASK_STACK_SIZE 3072
+#endif //WL_PRE_ERASE_TASK_STACK_SIZE
+
 typedef struct {
     WL_Flash *instance;
     _lock_t lock;
@@ -51,6 +59,59 @@ static const char *TAG = "wear_levelling";
 
 static esp_err_t check_handle(wl_handle_t handle, const char *func);
 
+#if CONFIG_WL_PRE_ERASE
+static TaskHandle_t s_pre_erase_task = NULL;
+
+// Replenishes the pool of pre-erased sectors while no other task of equal or
+// higher priority needs the CPU. One sector is erased per instance per pass,
+// so a single slow erase never blocks the instance lock for long.
+static void wl_pre_erase_task(void *arg)
+{
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        bool more = true;
+        while (more) {
+            more = false;
+            for (size_t i = 0; i < MAX_WL_HANDLES; i++) {
+                if (s_instances[i].instance == NULL) {
+                    continue;
+                }
+                bool erased = false;
+                _lock_acquire(&s_instances[i].lock);
+                if (s_instances[i].instance != NULL) {
+                    s_instances[i].instance->erase_next_trimmed(&erased);
+                }
+                _lock_release(&s_instances[i].lock);
+                more = more || erased;
+            }
+            if (more) {
+                vTaskDelay(1);
+            }
+        }
+    }
+}
+
+static void wl_pre_erase_signal(void)
+{
+    if (s_pre_erase_task == NULL) {
+        _lock_acquire(&s_instances_lock);
+        if (s_pre_erase_task == NULL) {
+            TaskHandle_t task = NULL;
+            if (xTaskCreate(&wl_pre_erase_task, "wl_erase", WL_PRE_ERASE_TASK_STACK_SIZE, NULL,
+                            CONFIG_WL_PRE_ERASE_TASK_PRIORITY, &task) == pdPASS) {
+                s_pre_erase_task = task;
+            } else {
+                ESP_LOGE(TAG, "%s: can't create pre-erase task", __func__);
+            }
+        }
+        _lock_release(&s_instances_lock);
+    }
+    if (s_pre_erase_task != NULL) {
+        xTaskNotifyGive(s_pre_erase_task);
+    }
+}
+#endif // CONFIG_WL_PRE_ERASE
+
 esp_err_t wl_mount(const esp_partition_t *partition, wl_handle_t *out_handle)
 {
     // Initialize variables before the first jump to cleanup label
@@ -212,8 +273,43 @@ esp_err_t wl_write(wl_handle_t handle, size_t dest_addr, const void *src, size_t
     _lock_acquire(&s_instances[handle].lock);
     result = s_instances[handle].instance->write(dest_addr, src, size);
     _lock_release(&s_instances[handle].lock);
+#if CONFIG_WL_PRE_ERASE
+    // the write may have consumed pre-erased sectors, let the pool refill
+    wl_pre_erase_signal();
+#endif
+    return result;
+}
+
+#if CONFIG_WL_PRE_ERASE
+esp_err_t wl_trim(wl_handle_t handle, size_t start_addr, size_t size)
+{
+    esp_err_t result = check_handle(handle, __func__);
+    if (result != ESP_OK) {
+        return result;
+    }
+    _lock_acquire(&s_instances[handle].lock);
+    result = s_instances[handle].instance->trim(start_addr, size);
+    _lock_release(&s_instances[handle].lock);
+    if (result == ESP_OK) {
+        wl_pre_erase_signal();
+    }
+    return result;
+}
+#endif // CONFIG_WL_PRE_ERASE
+
+#if CONFIG_WL_WRITE_CACHE
+esp_err_t wl_flush(wl_handle_t handle)
+{
+    esp_err_t result = check_handle(handle, __func__);
+    if (result != ESP_OK) {
+        return result;
+    }
+    _lock_acquire(&s_instances[handle].lock);
+    result = s_instances[handle].instance->flush();
+    _lock_release(&s_instances[handle].lock);
     return result;
 }
+#endif // CONFIG_WL_WRITE_CACHE
 
 esp_err_t wl_read(wl_handle_t handle, size_t src_addr, void *dest, size_t size)
 {
@@ -35,6 +35,116 @@ struct rsn_pmksa_cache {
 static void pmksa_cache_set_expiration(struct rsn_pmksa_cache *pmksa);
 
 
+#ifdef CONFIG_ESP_WIFI_STA_PMKSA_RTC_CACHE
+#include "esp_attr.h"
+
+#define PMKSA_RTC_CACHE_SIZE 4
+
+/*
+ * Copy of the most recently used PMKSA entries kept in RTC memory so that
+ * they survive deep sleep. Entries are mirrored on add, dropped on free and
+ * turned back into regular cache entries on the first lookup after wakeup.
+ */
+struct rsn_pmksa_rtc_entry {
+    u8 valid;
+    u8 aa[ETH_ALEN];
+    u8 pmkid[PMKID_LEN];
+    u8 pmk[PMK_LEN_MAX];
+    u16 pmk_len;
+    u16 akmp;
+    int64_t expiration;
+    int64_t reauth_time;
+};
+
+static RTC_DATA_ATTR struct rsn_pmksa_rtc_entry s_pmksa_rtc_cache[PMKSA_RTC_CACHE_SIZE];
+
+
+static void pmksa_cache_rtc_store(const struct rsn_pmksa_cache_entry *entry)
+{
+    struct rsn_pmksa_rtc_entry *slot = NULL;
+    int i;
+
+    /* Reuse the slot of the same Authenticator, else a free one, else the
+     * one expiring first */
+    for (i = 0; i < PMKSA_RTC_CACHE_SIZE; i++) {
+        if (s_pmksa_rtc_cache[i].valid &&
+                os_memcmp(s_pmksa_rtc_cache[i].aa, entry->aa, ETH_ALEN) == 0) {
+            slot = &s_pmksa_rtc_cache[i];
+            break;
+        }
+    }
+    for (i = 0; slot == NULL && i < PMKSA_RTC_CACHE_SIZE; i++) {
+        if (!s_pmksa_rtc_cache[i].valid)
+            slot = &s_pmksa_rtc_cache[i];
+    }
+    if (slot == NULL) {
+        slot = &s_pmksa_rtc_cache[0];
+        for (i = 1; i < PMKSA_RTC_CACHE_SIZE; i++) {
+            if (s_pmksa_rtc_cache[i].expiration < slot->expiration)
+                slot = &s_pmksa_rtc_cache[i];
+        }
+    }
+
+    os_memcpy(slot->aa, entry->aa, ETH_ALEN);
+    os_memcpy(slot->pmkid, entry->pmkid, PMKID_LEN);
+    os_memcpy(slot->pmk, entry->pmk, entry->pmk_len);
+    slot->pmk_len = entry->pmk_len;
+    slot->akmp = entry->akmp;
+    slot->expiration = entry->expiration;
+    slot->reauth_time = entry->reauth_time;
+    slot->valid = 1;
+}
+
+
+static void pmksa_cache_rtc_drop(const struct rsn_pmksa_cache_entry *entry)
+{
+    int i;
+
+    for (i = 0; i < PMKSA_RTC_CACHE_SIZE; i++) {
+        if (s_pmksa_rtc_cache[i].valid &&
+                os_memcmp(s_pmksa_rtc_cache[i].aa, entry->aa, ETH_ALEN) == 0 &&
+                os_memcmp(s_pmksa_rtc_cache[i].pmkid, entry->pmkid,
+                    PMKID_LEN) == 0)
+            os_memset(&s_pmksa_rtc_cache[i], 0,
+                    sizeof(s_pmksa_rtc_cache[i]));
+    }
+}
+
+
+static struct rsn_pmksa_cache_entry *
+pmksa_cache_rtc_restore(struct rsn_pmksa_cache *pmksa, const u8 *aa,
+        const u8 *pmkid, const void *network_ctx)
+{
+    struct os_reltime now;
+    int i;
+
+    os_get_reltime(&now);
+    for (i = 0; i < PMKSA_RTC_CACHE_SIZE; i++) {
+        struct rsn_pmksa_rtc_entry *slot = &s_pmksa_rtc_cache[i];
+
+        if (!slot->valid)
+            continue;
+        if (slot->expiration <= now.sec) {
+            os_memset(slot, 0, sizeof(*slot));
+            continue;
+        }
+        if ((aa == NULL || os_memcmp(slot->aa, aa, ETH_ALEN) == 0) &&
+                (pmkid == NULL ||
+                 os_memcmp(slot->pmkid, pmkid, PMKID_LEN) == 0)) {
+            wpa_printf(MSG_DEBUG, "RSN: restoring PMKSA cache entry "
+                    "for " MACSTR " from RTC memory",
+                    MAC2STR(slot->aa));
+            return pmksa_cache_add(pmksa, slot->pmk, slot->pmk_len,
+                    slot->pmkid, NULL, 0, slot->aa,
+                    pmksa->sm->own_addr,
+                    (void *) network_ctx, slot->akmp);
+        }
+    }
+    return NULL;
+}
+#endif /* CONFIG_ESP_WIFI_STA_PMKSA_RTC_CACHE */
+
+
 static void _pmksa_cache_free_entry(struct rsn_pmksa_cache_entry *entry)
 {
     bin_clear_free(entry, sizeof(*entry));
@@ -46,6 +156,9 @@ static void pmksa_cache_free_entry(struct rsn_pmksa_cache *pmksa,
         enum pmksa_free_reason reason)
 {
     pmksa->pmksa_count--;
+#ifdef CONFIG_ESP_WIFI_STA_PMKSA_RTC_CACHE
+    pmksa_cache_rtc_drop(entry);
+#endif
     pmksa->free_cb(entry, pmksa->ctx, reason);
     _pmksa_cache_free_entry(entry);
 }
@@ -233,6 +346,9 @@ pmksa_cache_add_entry(struct rsn_pmksa_cache *pmksa,
     pmksa->pmksa_count++;
     wpa_printf(MSG_DEBUG, "RSN: Added PMKSA cache entry for " MACSTR
             " network_ctx=%p", MAC2STR(entry->aa), entry->network_ctx);
+#ifdef CONFIG_ESP_WIFI_STA_PMKSA_RTC_CACHE
+    pmksa_cache_rtc_store(entry);
+#endif
 
     return entry;
 }
@@ -323,7 +439,13 @@ struct rsn_pmksa_cache_entry * pmksa_cache_get(struct rsn_pmksa_cache *pmksa,
             return entry;
         entry = entry->next;
     }
+#ifdef CONFIG_ESP_WIFI_STA_PMKSA_RTC_CACHE
+    /* After deep sleep the in-RAM cache starts empty; recreate the entry
+     * from the RTC mirror so that reassociation can use PMKSA caching */
+    return pmksa_cache_rtc_restore(pmksa, aa, pmkid, network_ctx);
+#else
     return NULL;
+#endif
 }
 
 
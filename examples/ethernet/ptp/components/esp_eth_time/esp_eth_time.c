@@ -34,6 +34,21 @@ int esp_eth_clock_adjtime(clockid_t clk_id, esp_eth_clock_adj_param_t *adj)
                 errno = esp_eth_clock_esp_err_to_errno(ret);
                 return -1;
             }
+        } else if (adj->mode == ETH_CLK_ADJ_TIME_OFFSET) {
+            int64_t offset_ns = (int64_t)adj->time_offset.tv_sec * 1000000000LL + adj->time_offset.tv_nsec;
+            eth_mac_ptp_time_offset_t time_offset = {
+                .negative = offset_ns < 0,
+            };
+            if (offset_ns < 0) {
+                offset_ns = -offset_ns;
+            }
+            time_offset.offset.seconds = offset_ns / 1000000000LL;
+            time_offset.offset.nanoseconds = offset_ns % 1000000000LL;
+            esp_err_t ret = esp_eth_ioctl(s_eth_hndl, ETH_MAC_ESP_CMD_ADJ_PTP_TIME_OFFSET, &time_offset);
+            if (ret != ESP_OK) {
+                errno = esp_eth_clock_esp_err_to_errno(ret);
+                return -1;
+            }
         } else {
             errno = EINVAL;
             return -1;
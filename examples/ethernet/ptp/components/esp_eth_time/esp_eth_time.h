@@ -31,6 +31,7 @@ typedef struct {
  */
 typedef enum {
     ETH_CLK_ADJ_FREQ_SCALE,
+    ETH_CLK_ADJ_TIME_OFFSET,
 } esp_eth_clock_adj_mode_t;
 
 /**
@@ -52,6 +53,15 @@ typedef struct {
      * less than 1 decreases the frequency.
      */
     double freq_scale;
+
+    /**
+     * @brief Signed time offset when in ETH_CLK_ADJ_TIME_OFFSET mode.
+     *
+     * The offset is applied to the running clock atomically in hardware,
+     * which makes it suitable for servo step corrections since no time is
+     * lost to a read-modify-write sequence.
+     */
+    struct timespec time_offset;
 } esp_eth_clock_adj_param_t;
 
 /**